@@ -2,6 +2,8 @@
 #include "../include/android/android_manager.h"
 #include "../include/android/android_container.h"
 #include "../include/android/binder.h"
+#include "../include/android/zygote.h"
+#include "../include/android/usage_sampler.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -50,9 +52,22 @@ int android_system_initialize(const android_config_t* config) {
     
     // Android alt sistemlerini başlat
     
+    // 0. Zygote: diğer alt sistemler (binder döngüleri, AOT havuzu, toplayıcı)
+    // iş parçacığı açmadan önce fork edilir ki zygote yalnızca bu iş
+    // parçacığının kopyası olsun. Önyükleme ART'ı zygote içinde başlatır;
+    // uygulama fork'ları sırasında zygote'ta çalışan AOT ve toplayıcı iş
+    // parçacıklarının kilitleri art_aot/art_heap pthread_atfork işleyicileriyle
+    // tutarlı kalır, iş parçacıkları çocukta ilk kullanımda yeniden başlar.
+    if (android_system->config.art_enabled) {
+        if (zygote_start(art_zygote_preload, art_zygote_app_main, &android_system->config) != 0) {
+            printf("Uyarı: Zygote başlatılamadı, uygulamalar başlatılamayacak\n");
+        }
+    }
+    
     // 1. Binder sistemini başlat
     if (android_system->config.binder_enabled) {
         if (binder_initialize() != 0) {
+            zygote_stop();
             free(android_system);
             android_system = NULL;
             return ANDROID_ERROR_BINDER_INIT;
@@ -68,6 +83,7 @@ int android_system_initialize(const android_config_t* config) {
                 binder_cleanup();
             }
             
+            zygote_stop();
             free(android_system);
             android_system = NULL;
             return ANDROID_ERROR_ART_INIT;
@@ -87,6 +103,7 @@ int android_system_initialize(const android_config_t* config) {
                 binder_cleanup();
             }
             
+            zygote_stop();
             free(android_system);
             android_system = NULL;
             return ANDROID_ERROR_CONTAINER_INIT;
@@ -110,6 +127,7 @@ int android_system_initialize(const android_config_t* config) {
                 binder_cleanup();
             }
             
+            zygote_stop();
             free(android_system);
             android_system = NULL;
             return ANDROID_ERROR_BRIDGE_INIT;
@@ -136,6 +154,7 @@ int android_system_initialize(const android_config_t* config) {
             binder_cleanup();
         }
         
+        zygote_stop();
         free(android_system);
         android_system = NULL;
         return ANDROID_ERROR_MANAGER_INIT;
@@ -190,7 +209,8 @@ int android_system_cleanup() {
         android_system->container_initialized = 0;
     }
     
-    // 4. Android Runtime kapat
+    // 4. Android Runtime kapat (zygote ART'tan bağımsız başlatılır)
+    zygote_stop();
     if (android_system->art_initialized) {
         art_cleanup();
         android_system->art_initialized = 0;
@@ -304,31 +324,74 @@ android_system_info_t android_get_system_info() {
     // Servis sayısı
     info.services_count = android_system->services_count;
     
-    // Çalışan uygulama sayısı
+    // Çalışan uygulama sayısı. Kullanım değerleri örnekleyicinin son
+    // örneklerinden alınır; burada ölçüm yapılmaz.
     android_manager_t* manager = android_manager_get_instance();
+    usage_sampler_t* sampler = manager ? manager->usage_sampler : NULL;
     if (manager) {
         for (uint32_t i = 0; i < manager->app_count; i++) {
-            if (manager->apps[i]->state == ANDROID_APP_STATE_RUNNING) {
+            android_app_t* app = manager->apps[i];
+            if (app->state == ANDROID_APP_STATE_RUNNING) {
                 info.running_apps_count++;
-            } else if (manager->apps[i]->state == ANDROID_APP_STATE_PAUSED) {
+            } else if (app->state == ANDROID_APP_STATE_PAUSED) {
                 info.paused_apps_count++;
             }
+            
+            usage_sample_t sample;
+            if (sampler && app->pid > 0 && usage_sampler_latest(sampler, (pid_t)app->pid, &sample) == 0) {
+                app->memory_usage = (uint64_t)sample.rss_kb * 1024;
+                app->cpu_usage = (float)sample.cpu_permille / 10.0f;
+            }
         }
         
         info.total_apps_count = manager->app_count;
     }
     
-    // Bellek kullanımı (gerçek sistemde, bellek kullanımı bilgisi alınır)
-    info.memory_usage_mb = 128; // Örnek değer
+    usage_totals_t totals;
+    memset(&totals, 0, sizeof(totals));
+    if (sampler) {
+        usage_sampler_totals(sampler, &totals);
+    }
+    
+    // Konteynerlerin kullanım alanları kaynak denetleyicisinin sayaçlarından
+    // tazelenir (sayfa ve CPU ücretlendirmesi, ölçüm yapılmaz)
+    if (android_system->container_initialized) {
+        android_container_t** containers = NULL;
+        uint32_t container_count = 0;
+        if (container_list_all(&containers, &container_count) == 0) {
+            for (uint32_t i = 0; i < container_count; i++) {
+                container_limits_t usage;
+                container_get_usage(containers[i], &usage);
+            }
+        }
+    }
+    
+    // Bellek kullanımı: uygulama süreçlerinin yerleşik belleği
+    info.memory_usage_mb = (uint32_t)(totals.rss_kb / 1024);
     info.memory_limit_mb = android_system->config.memory_limit_mb;
     
-    // CPU kullanımı (gerçek sistemde, CPU kullanımı bilgisi alınır)
-    info.cpu_usage_percent = 15.5f; // Örnek değer
+    // CPU kullanımı: son örnek aralığında (100 = bir çekirdek)
+    info.cpu_usage_percent = totals.cpu_percent;
     info.cpu_limit_percent = android_system->config.cpu_limit_percent;
     
     return info;
 }
 
+// Tüm uygulamaların kullanım geçmişi (usage_sampler_history); ölçüm yapmaz
+int android_get_usage_history(uint32_t tier, usage_sample_t* samples, uint32_t max_samples, uint32_t* count) {
+    if (!android_system || !android_system->initialized) {
+        return ANDROID_ERROR_INIT;
+    }
+    
+    android_manager_t* manager = android_manager_get_instance();
+    if (!manager || !manager->usage_sampler) {
+        return ANDROID_ERROR_MANAGER;
+    }
+    
+    return usage_sampler_history(manager->usage_sampler, tier, samples, max_samples, count) == 0 ?
+           ANDROID_SUCCESS : ANDROID_ERROR_RESOURCE;
+}
+
 // Android sistem konfigürasyonunu güncelle
 int android_update_config(const android_config_t* new_config) {
     if (!android_system || !android_system->initialized) {
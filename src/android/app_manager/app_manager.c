@@ -1,9 +1,14 @@
 #include "../../include/android/app_manager.h"
 #include "../../include/android/android.h"
+#include "../../include/android/art_aot.h"
+#include "../../include/android/apk_install.h"
+#include "../../include/android/package_db.h"
+#include "../../include/android/app_backup.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 #include <time.h>
+#include <unistd.h>
 
 // Demo uygulamaları
 static android_app_t demo_apps[] = {
@@ -70,7 +75,7 @@ static android_app_t demo_apps[] = {
         .permission_count = 5,
         .min_sdk_version = 26,
         .target_sdk_version = 30,
-        .apk_path = "/data/app/com.example.demo-1.apk",
+        .apk_path = "/data/app/com.example.demo-1",
         .data_path = "/data/user/0/com.example.demo",
         .app_name = "Demo Uygulama",
         .developer_name = "Example Inc."
@@ -87,7 +92,7 @@ static android_app_t demo_apps[] = {
         .permission_count = 10,
         .min_sdk_version = 26,
         .target_sdk_version = 30,
-        .apk_path = "/data/app/com.example.game-1.apk",
+        .apk_path = "/data/app/com.example.game-1",
         .data_path = "/data/user/0/com.example.game",
         .app_name = "Örnek Oyun",
         .developer_name = "Example Games Inc."
@@ -97,15 +102,26 @@ static android_app_t demo_apps[] = {
 // Demo uygulamaların toplam sayısı
 #define DEMO_APPS_COUNT (sizeof(demo_apps) / sizeof(demo_apps[0]))
 
+// Kurulan uygulamaların kalıcı kaydı (demo uygulamalar yazılmaz)
+#define INSTALLED_APPS_DB_PATH "/data/system/packages.db"
+
 // Yüklenmiş uygulamaları takip etmek için
 static android_app_t* installed_apps = NULL;
 static uint32_t installed_apps_count = 0;
 static uint32_t installed_apps_capacity = 0;
 
+// Paket adı -> dizideki konum + 1. Anahtarlar dizinin içindedir; dizi
+// büyütülünce indeks yeniden kurulur.
+static package_index_t installed_apps_index;
+static package_db_t* installed_apps_db = NULL;
+
 // İleri bildirimler
 static android_app_t* find_app_by_package(const char* package_name);
 static void initialize_app_manager();
 static int is_app_manager_initialized();
+static android_app_t* add_installed_app(const android_app_t* app);
+static void rebuild_app_index();
+static int load_installed_app(const char* name, const void* record, uint64_t stamp, void* arg);
 
 // Uygulama yöneticisini başlatma
 static void initialize_app_manager() {
@@ -122,9 +138,77 @@ static void initialize_app_manager() {
         return;
     }
     
+    if (package_index_init(&installed_apps_index, installed_apps_capacity) != 0) {
+        fprintf(stderr, "Android uygulama yöneticisi başlatılamadı: Bellek ayırma hatası\n");
+        free(installed_apps);
+        installed_apps = NULL;
+        return;
+    }
+    
     // Demo uygulamaları kopyalayın
     memcpy(installed_apps, demo_apps, DEMO_APPS_COUNT * sizeof(android_app_t));
     installed_apps_count = DEMO_APPS_COUNT;
+    rebuild_app_index();
+    
+    // Daha önce kurulan uygulamaları yükleyin; veritabanı açılamazsa liste
+    // yalnızca bellekte tutulur
+    if (package_db_open(INSTALLED_APPS_DB_PATH, sizeof(android_app_t), &installed_apps_db) == 0) {
+        package_db_foreach(installed_apps_db, load_installed_app, NULL);
+    }
+}
+
+// Uygulamayı listeye ekle, gerekirse kapasiteyi artır
+static android_app_t* add_installed_app(const android_app_t* app) {
+    if (installed_apps_count >= installed_apps_capacity) {
+        uint32_t new_capacity = installed_apps_capacity * 2;
+        android_app_t* new_apps = (android_app_t*)realloc(installed_apps, new_capacity * sizeof(android_app_t));
+        
+        if (new_apps == NULL) {
+            return NULL;
+        }
+        
+        installed_apps = new_apps;
+        installed_apps_capacity = new_capacity;
+        rebuild_app_index();
+    }
+    
+    android_app_t* slot = &installed_apps[installed_apps_count];
+    *slot = *app;
+    installed_apps_count++;
+    package_index_insert(&installed_apps_index, slot->package_name, (void*)(uintptr_t)installed_apps_count);
+    
+    return slot;
+}
+
+// İndeksi dizideki anahtarlarla yeniden kur
+static void rebuild_app_index() {
+    package_index_destroy(&installed_apps_index);
+    package_index_init(&installed_apps_index, installed_apps_capacity);
+    
+    for (uint32_t i = 0; i < installed_apps_count; i++) {
+        package_index_insert(&installed_apps_index, installed_apps[i].package_name, (void*)(uintptr_t)(i + 1));
+    }
+}
+
+// Veritabanındaki kaydı listeye ekle (uygulamalar durmuş olarak yüklenir)
+static int load_installed_app(const char* name, const void* record, uint64_t stamp, void* arg) {
+    (void)stamp;
+    (void)arg;
+    
+    if (find_app_by_package(name) != NULL) {
+        return 0;
+    }
+    
+    android_app_t app = *(const android_app_t*)record;
+    app.is_running = 0;
+    
+    // Eski kayıtlar var olmayan "<dizin>.apk" yolunu tutar; kurulum dizinine çevir
+    size_t length = strlen(app.apk_path);
+    if (!app.is_system_app && length > 4 && strcmp(app.apk_path + length - 4, ".apk") == 0) {
+        app.apk_path[length - 4] = '\0';
+    }
+    add_installed_app(&app);
+    return 0;
 }
 
 // Uygulama yöneticisinin başlatıldığını kontrol edin
@@ -138,18 +222,19 @@ static android_app_t* find_app_by_package(const char* package_name) {
         return NULL;
     }
     
-    for (uint32_t i = 0; i < installed_apps_count; i++) {
-        if (strcmp(installed_apps[i].package_name, package_name) == 0) {
-            return &installed_apps[i];
-        }
-    }
-    
-    return NULL;
+    uintptr_t position = (uintptr_t)package_index_find(&installed_apps_index, package_name);
+    return position ? &installed_apps[position - 1] : NULL;
 }
 
 // Uygulama yöneticisini temizle
 void app_manager_cleanup() {
+    if (installed_apps_db != NULL) {
+        package_db_close(installed_apps_db);
+        installed_apps_db = NULL;
+    }
+    
     if (installed_apps != NULL) {
+        package_index_destroy(&installed_apps_index);
         free(installed_apps);
         installed_apps = NULL;
         installed_apps_count = 0;
@@ -222,7 +307,11 @@ android_result_t android_app_manager_launch_app(const char* package_name) {
         return ANDROID_SUCCESS;  // Zaten çalışıyor, başarılı kabul et
     }
     
-    // Uygulamayı başlat (simülasyon)
+    // Süreç uygulama yöneticisinin zygote yolundan fork edilir; pid, kullanım
+    // örnekleyicisi ve intent yönlendirmesi orada kaydedilir
+    if (!android_launch_app(package_name)) {
+        return ANDROID_ERROR_FAILED;
+    }
     app->is_running = 1;
     printf("Uygulama başlatıldı: %s\n", package_name);
     
@@ -261,7 +350,8 @@ android_result_t android_app_manager_stop_app(const char* package_name) {
         return ANDROID_SUCCESS;  // Zaten durdurulmuş, başarılı kabul et
     }
     
-    // Uygulamayı durdur (simülasyon)
+    // Zygote'tan fork edilen süreci sonlandır; kayıt yoksa süreç de yoktur
+    android_stop_app(android_find_app_by_package(package_name));
     app->is_running = 0;
     printf("Uygulama durduruldu: %s\n", package_name);
     
@@ -289,22 +379,20 @@ android_result_t android_app_manager_install_app(const char* apk_path) {
         }
     }
     
-    // Kapasiteyi kontrol et ve gerekirse artır
-    if (installed_apps_count >= installed_apps_capacity) {
-        uint32_t new_capacity = installed_apps_capacity * 2;
-        android_app_t* new_apps = (android_app_t*)realloc(installed_apps, new_capacity * sizeof(android_app_t));
-        
-        if (new_apps == NULL) {
-            return ANDROID_ERROR_OUT_OF_MEMORY;
-        }
-        
-        installed_apps = new_apps;
-        installed_apps_capacity = new_capacity;
-    }
+    // Kurulum süresi çıkarma, derleme (eşzamanlıysa) ve kaydı kapsar
+    struct timespec started;
+    clock_gettime(CLOCK_MONOTONIC, &started);
     
-    // Yeni bir uygulama oluştur (örnek değerlerle)
+    // Yeni bir uygulama oluştur (örnek değerlerle). Paket adı APK dosya
+    // adından türetilir: aynı APK yeniden kurulursa aynı kayıt güncellenir.
     android_app_t new_app = {0};
-    snprintf(new_app.package_name, sizeof(new_app.package_name), "com.example.app%u", installed_apps_count);
+    const char* base = strrchr(apk_path, '/');
+    base = base ? base + 1 : apk_path;
+    int base_length = (int)strcspn(base, ".");
+    if (base_length == 0) {
+        return ANDROID_ERROR_INVALID_ARGS;
+    }
+    snprintf(new_app.package_name, sizeof(new_app.package_name), "com.example.%.*s", base_length, base);
     snprintf(new_app.version, sizeof(new_app.version), "1.0.0");
     
     // Tarih damgaları oluştur
@@ -321,19 +409,71 @@ android_result_t android_app_manager_install_app(const char* apk_path) {
     new_app.min_sdk_version = 26;
     new_app.target_sdk_version = 30;
     
-    // APK ve veri yolları
-    snprintf(new_app.apk_path, sizeof(new_app.apk_path), "/data/app/%s-1.apk", new_app.package_name);
+    // Kurulu uygulamanın yolu ayıklanmış içeriğin bulunduğu dizindir; ART
+    // classes*.dex dosyalarını buradan yükler
+    snprintf(new_app.apk_path, sizeof(new_app.apk_path), "/data/app/%s-1", new_app.package_name);
     snprintf(new_app.data_path, sizeof(new_app.data_path), "/data/user/0/%s", new_app.package_name);
     
     // Uygulama ve geliştirici adı
-    snprintf(new_app.app_name, sizeof(new_app.app_name), "Yeni Uygulama %u", installed_apps_count);
+    snprintf(new_app.app_name, sizeof(new_app.app_name), "%.*s", base_length, base);
     snprintf(new_app.developer_name, sizeof(new_app.developer_name), "Örnek Geliştirici");
     
-    // Uygulamayı listeye ekle
-    installed_apps[installed_apps_count] = new_app;
-    installed_apps_count++;
+    // DEX, kaynaklar ve yerel kütüphaneler kurulum dizinine paralel çıkarılır;
+    // imza özeti tutmazsa kurulum reddedilir
+    apk_install_stats_t install_stats;
+    int install_result = apk_install(apk_path, new_app.apk_path, NULL, 0, &install_stats);
+    if (install_result != 0) {
+        printf("APK kurulamadı: %s (hata %d)\n", apk_path, install_result);
+        return install_result == APK_INSTALL_ERROR_NO_MEMORY ? ANDROID_ERROR_OUT_OF_MEMORY : ANDROID_ERROR_FAILED;
+    }
+    new_app.size_kb = (uint32_t)(install_stats.apk_size / 1024);
+    
+    // Kod önceden derlenir: görüntü ayıklanmış DEX'lerden derlenip kurulum
+    // dizininin yanına yazılır (APK içindeki DEX genellikle sıkıştırılmıştır).
+    // Havuz yoksa (ART başlatılmamış) kurulum derlemeyi kendisi yapar.
+    char image_path[sizeof(new_app.apk_path) + 8];
+    art_aot_stats_t aot_stats;
+    memset(&aot_stats, 0, sizeof(aot_stats));
+    int aot_result = art_aot_image_path(new_app.apk_path, image_path, sizeof(image_path));
+    if (aot_result == 0) {
+        aot_result = art_aot_submit(new_app.apk_path, image_path);
+        if (aot_result == ART_AOT_ERROR_STATE) {
+            aot_result = art_aot_compile(new_app.apk_path, image_path, &aot_stats);
+        }
+    }
+    if (aot_result != 0) {
+        printf("Uyarı: %s önceden derlenemedi, ilk açılışta derlenecek\n", new_app.apk_path);
+    }
+    
+    // Uygulamayı listeye ekle; kuruluysa yerinde güncelle
+    android_app_t* existing_app = find_app_by_package(new_app.package_name);
+    if (existing_app != NULL) {
+        strcpy(new_app.install_date, existing_app->install_date);
+        *existing_app = new_app;
+    } else if (add_installed_app(&new_app) == NULL) {
+        return ANDROID_ERROR_OUT_OF_MEMORY;
+    }
+    
+    // Kaydı kalıcı yap
+    if (installed_apps_db != NULL) {
+        package_db_put(installed_apps_db, new_app.package_name, &new_app, (uint64_t)now);
+        package_db_sync(installed_apps_db);
+    }
     
-    printf("Uygulama yüklendi: %s\n", new_app.package_name);
+    struct timespec finished;
+    clock_gettime(CLOCK_MONOTONIC, &finished);
+    double install_ms = (double)(finished.tv_sec - started.tv_sec) * 1000.0 +
+                        (double)(finished.tv_nsec - started.tv_nsec) / 1000000.0;
+    
+    // Derleme havuzdaysa süresi kuruluma dahil değildir
+    if (aot_stats.image_size > 0) {
+        printf("Uygulama yüklendi: %s (%.1f ms; çıkarma %.1f ms, derleme %.1f ms, görüntü %llu KB)\n",
+               new_app.package_name, install_ms, install_stats.elapsed_ms, aot_stats.compile_ms,
+               (unsigned long long)(aot_stats.image_size / 1024));
+    } else {
+        printf("Uygulama yüklendi: %s (%.1f ms; çıkarma %.1f ms)\n",
+               new_app.package_name, install_ms, install_stats.elapsed_ms);
+    }
     
     return ANDROID_SUCCESS;
 }
@@ -360,32 +500,45 @@ android_result_t android_app_manager_uninstall_app(const char* package_name) {
     }
     
     // Uygulamayı bul
-    int found_index = -1;
-    for (uint32_t i = 0; i < installed_apps_count; i++) {
-        if (strcmp(installed_apps[i].package_name, package_name) == 0) {
-            // Sistem uygulamasını kaldırmayı engelle
-            if (installed_apps[i].is_system_app) {
-                return ANDROID_ERROR_PERMISSION_DENIED;
-            }
-            
-            found_index = i;
-            break;
-        }
+    android_app_t* found_app = find_app_by_package(package_name);
+    if (found_app == NULL) {
+        return ANDROID_ERROR_NOT_FOUND;
     }
     
-    if (found_index == -1) {
-        return ANDROID_ERROR_NOT_FOUND;
+    // Sistem uygulamasını kaldırmayı engelle
+    if (found_app->is_system_app) {
+        return ANDROID_ERROR_PERMISSION_DENIED;
     }
+    int found_index = (int)(found_app - installed_apps);
     
     // Uygulama çalışıyorsa durdur
     if (installed_apps[found_index].is_running) {
         installed_apps[found_index].is_running = 0;
     }
     
-    // Uygulamayı listeden kaldır (son uygulamayı buraya taşıyarak)
+    // Kurulum dizinini ve yanındaki derlenmiş görüntüyü sil
+    if (!installed_apps[found_index].is_system_app) {
+        char image_path[sizeof(installed_apps[found_index].apk_path) + 8];
+        if (art_aot_image_path(installed_apps[found_index].apk_path, image_path, sizeof(image_path)) == 0) {
+            unlink(image_path);
+        }
+        apk_install_remove(installed_apps[found_index].apk_path);
+    }
+    
+    // Kaydı kalıcı olarak sil
+    if (installed_apps_db != NULL && package_db_delete(installed_apps_db, package_name) == 0) {
+        package_db_sync(installed_apps_db);
+    }
+    
+    // Uygulamayı listeden kaldır (son uygulamayı buraya taşıyarak). Anahtar
+    // dizinin içinde olduğundan taşınan uygulama yeniden eklenir.
+    package_index_erase(&installed_apps_index, installed_apps[found_index].package_name);
     if (found_index < (int)(installed_apps_count - 1)) {
         // Son uygulamayı bu konuma kopyala
+        package_index_erase(&installed_apps_index, installed_apps[installed_apps_count - 1].package_name);
         installed_apps[found_index] = installed_apps[installed_apps_count - 1];
+        package_index_insert(&installed_apps_index, installed_apps[found_index].package_name,
+                             (void*)(uintptr_t)(found_index + 1));
     }
     
     installed_apps_count--;
@@ -463,8 +616,17 @@ android_result_t android_app_manager_backup_app(
         return ANDROID_ERROR_NOT_FOUND;
     }
     
-    // Yedekleme işlemi (simülasyon)
-    printf("Uygulama yedeklendi: %s -> %s\n", package_name, backup_path);
+    // Veri dizini yedek dizinindeki parça deposuna yazılır; yalnızca değişen
+    // parçalar eklenir. Uygulama kaydı manifeste gömülür.
+    app_backup_stats_t backup_stats;
+    int backup_result = app_backup_create(app->data_path, backup_path, app, sizeof(*app), 0, &backup_stats);
+    if (backup_result != 0) {
+        printf("Uygulama yedeklenemedi: %s (hata %d)\n", package_name, backup_result);
+        return backup_result == APP_BACKUP_ERROR_NO_MEMORY ? ANDROID_ERROR_OUT_OF_MEMORY : ANDROID_ERROR_FAILED;
+    }
+    
+    printf("Uygulama yedeklendi: %s -> %s (%u dosya, %llu yeni parça, %.1fx)\n", package_name, backup_path,
+           backup_stats.files, (unsigned long long)backup_stats.new_chunks, backup_stats.dedup_ratio);
     
     return ANDROID_SUCCESS;
 }
@@ -490,11 +652,51 @@ android_result_t android_app_manager_restore_app(const char* backup_path) {
         }
     }
     
-    // Geri yükleme işlemi (simülasyon)
-    printf("Yedekten geri yükleme: %s\n", backup_path);
+    // Manifestteki uygulama kaydını oku
+    android_app_t saved_app;
+    uint32_t saved_size = 0;
+    if (app_backup_read_meta(backup_path, &saved_app, sizeof(saved_app), &saved_size) != 0 ||
+        saved_size != sizeof(saved_app)) {
+        printf("Yedek okunamadı: %s\n", backup_path);
+        return ANDROID_ERROR_FAILED;
+    }
+    saved_app.package_name[sizeof(saved_app.package_name) - 1] = '\0';
+    saved_app.data_path[sizeof(saved_app.data_path) - 1] = '\0';
+    saved_app.is_running = 0;
+    
+    // Çalışan uygulamanın verisi altından değiştirilmez
+    android_app_t* app = find_app_by_package(saved_app.package_name);
+    if (app != NULL && app->is_running) {
+        return ANDROID_ERROR_APP_RUNNING;
+    }
+    
+    // Veri, kurulu uygulamanın veri dizinine (yoksa yedeklenen dizine) açılır
+    app_backup_stats_t restore_stats;
+    int restore_result = app_backup_restore(backup_path, app != NULL ? app->data_path : saved_app.data_path, 0, &restore_stats);
+    if (restore_result != 0) {
+        printf("Yedekten geri yüklenemedi: %s (hata %d)\n", backup_path, restore_result);
+        return restore_result == APP_BACKUP_ERROR_NO_MEMORY ? ANDROID_ERROR_OUT_OF_MEMORY : ANDROID_ERROR_FAILED;
+    }
+    
+    // Kurulu olmayan uygulama kaydıyla birlikte geri gelir
+    int added = 0;
+    if (app == NULL) {
+        app = add_installed_app(&saved_app);
+        if (app == NULL) {
+            return ANDROID_ERROR_OUT_OF_MEMORY;
+        }
+        added = 1;
+    }
+    app->data_size_kb = (uint32_t)(restore_stats.total_bytes / 1024);
+    
+    // Demo uygulamalar veritabanına yazılmaz
+    if (installed_apps_db != NULL && (added || package_db_get(installed_apps_db, app->package_name, NULL) != NULL)) {
+        package_db_put(installed_apps_db, app->package_name, app, (uint64_t)time(NULL));
+        package_db_sync(installed_apps_db);
+    }
     
-    // Burada gerçek bir uygulamada, yedek dosyasını analiz edip
-    // içindeki uygulamayı yükleme işlemi yapılır.
+    printf("Yedekten geri yüklendi: %s -> %s (%u dosya, %u değişmemiş)\n", backup_path, app->package_name,
+           restore_stats.files, restore_stats.unchanged_files);
     
     return ANDROID_SUCCESS;
 }
@@ -0,0 +1,678 @@
+#include "../../include/android/binder.h"
+#include "../../include/android/art_heap.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+// Alım tamponundaki blokların hizalaması ve bölünme eşiği
+#define BINDER_BLOCK_ALIGN      8
+#define BINDER_BLOCK_MIN_SPLIT  64
+#define BINDER_HASH_MASK        (BINDER_HASH_SIZE - 1)
+
+// Alım tamponu bloğu başlığı
+typedef struct {
+    uint32_t size;                 // Başlık dahil blok boyutu
+    uint32_t free;                 // Blok boş mu?
+} binder_block_t;
+
+// Bekleyen işlem; başlık ve paket verisi hedefin alım tamponunda birlikte durur
+typedef struct binder_transaction {
+    struct binder_transaction* next;
+    uint32_t code;                 // İşlem kodu
+    uint32_t flags;                // BINDER_FLAG_*
+    binder_parcel_t data;          // Gönderilen paket (alım tamponunda)
+    binder_parcel_t reply;         // Yanıt (gönderenin tamponunda)
+    int status;                    // İşleyicinin dönüş değeri
+    uint8_t done;                  // İşlendi mi?
+    pthread_cond_t* done_cond;     // Senkron gönderenin beklediği koşul
+} binder_transaction_t;
+
+// Servis düğümü (servisi barındıran süreç)
+typedef struct binder_node {
+    char name[BINDER_SERVICE_NAME_MAX];
+    uint32_t name_hash;
+    void* service;                 // Servis nesnesi
+    binder_transact_handler_t handler;
+    uint32_t refs;                 // Referans sayısı (kayıt, süren işlemler, döngü iş parçacıkları)
+    uint8_t dead;                  // Servis kaldırıldı mı?
+    
+    // Ad ve nesne işaretçisi karma zincirleri
+    struct binder_node* name_next;
+    struct binder_node* service_next;
+    
+    // Süreç başına alım tamponu
+    uint8_t* buffer;
+    uint32_t buffer_size;
+    
+    // İş kuyrukları: senkron işlemler sırayla, tek yönlü işlemler düğüm başına teker teker
+    pthread_mutex_t lock;
+    pthread_cond_t work_cond;
+    binder_transaction_t* todo_head;
+    binder_transaction_t* todo_tail;
+    binder_transaction_t* async_head;
+    binder_transaction_t* async_tail;
+    uint8_t async_busy;
+    
+    // Döngü iş parçacığı havuzu
+    pthread_t threads[BINDER_MAX_THREADS];
+    uint32_t thread_count;
+    uint32_t max_threads;
+    uint32_t idle_threads;
+} binder_node_t;
+
+// Binder sistemi durumu
+static uint8_t binder_initialized = 0;
+static pthread_rwlock_t binder_registry_lock = PTHREAD_RWLOCK_INITIALIZER;
+static binder_node_t* binder_names[BINDER_HASH_SIZE];
+static binder_node_t* binder_objects[BINDER_HASH_SIZE];
+static uint32_t binder_service_count = 0;
+static binder_stats_t binder_stats;
+
+// Yardımcı işlevler
+static uint32_t binder_hash_name(const char* name);
+static uint32_t binder_hash_pointer(const void* pointer);
+static binder_node_t* binder_find_name(const char* name, uint32_t hash);
+static binder_node_t* binder_acquire_node(void* service);
+static void binder_release_node(binder_node_t* node);
+static void binder_unlink_node(binder_node_t* node);
+static void binder_kill_node(binder_node_t* node);
+static void* binder_buffer_alloc(binder_node_t* node, uint32_t size);
+static void binder_buffer_free(binder_node_t* node, void* pointer);
+static int binder_spawn_looper(binder_node_t* node);
+static void* binder_looper(void* arg);
+
+// Binder sistemini başlat
+int binder_initialize() {
+    pthread_rwlock_wrlock(&binder_registry_lock);
+    
+    // Zaten başlatıldıysa
+    if (binder_initialized) {
+        pthread_rwlock_unlock(&binder_registry_lock);
+        return BINDER_SUCCESS;
+    }
+    
+    memset(binder_names, 0, sizeof(binder_names));
+    memset(binder_objects, 0, sizeof(binder_objects));
+    memset(&binder_stats, 0, sizeof(binder_stats));
+    binder_service_count = 0;
+    binder_initialized = 1;
+    
+    pthread_rwlock_unlock(&binder_registry_lock);
+    
+    return BINDER_SUCCESS;
+}
+
+// Binder sistemini kapat; tüm servisler kaldırılır
+int binder_cleanup() {
+    for (;;) {
+        pthread_rwlock_wrlock(&binder_registry_lock);
+        
+        binder_node_t* node = NULL;
+        for (uint32_t i = 0; i < BINDER_HASH_SIZE && !node; i++) {
+            node = binder_names[i];
+        }
+        
+        if (!node) {
+            binder_initialized = 0;
+            pthread_rwlock_unlock(&binder_registry_lock);
+            break;
+        }
+        
+        binder_unlink_node(node);
+        pthread_rwlock_unlock(&binder_registry_lock);
+        
+        binder_kill_node(node);
+        binder_release_node(node);
+    }
+    
+    return BINDER_SUCCESS;
+}
+
+// İşleyicisi olmayan servis kaydet (bulunabilir; işlemleri BINDER_ERROR_NO_HANDLER ile reddedilir)
+int binder_register_service(const char* name, void* service) {
+    return binder_add_service(name, service, NULL, 0);
+}
+
+// İşleyicili servis kaydet. Aynı adla kayıtlı servis varsa yenisiyle değiştirilir.
+int binder_add_service(const char* name, void* service, binder_transact_handler_t handler, uint32_t max_threads) {
+    if (!name || !name[0] || !service || strlen(name) >= BINDER_SERVICE_NAME_MAX) {
+        return BINDER_ERROR_INVALID;
+    }
+    
+    if (!binder_initialized) {
+        binder_initialize();
+    }
+    
+    binder_node_t* node = (binder_node_t*)malloc(sizeof(binder_node_t));
+    if (!node) {
+        return BINDER_ERROR_NO_MEMORY;
+    }
+    
+    memset(node, 0, sizeof(binder_node_t));
+    strcpy(node->name, name);
+    node->name_hash = binder_hash_name(name);
+    node->service = service;
+    node->handler = handler;
+    node->refs = 1;
+    node->max_threads = (max_threads == 0) ? BINDER_DEFAULT_MAX_THREADS : max_threads;
+    if (node->max_threads > BINDER_MAX_THREADS) {
+        node->max_threads = BINDER_MAX_THREADS;
+    }
+    pthread_mutex_init(&node->lock, NULL);
+    pthread_cond_init(&node->work_cond, NULL);
+    
+    if (handler) {
+        // Süreç başına alım tamponu; tek bir boş blokla başlar
+        void* buffer = mmap(NULL, BINDER_BUFFER_SIZE, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (buffer == MAP_FAILED) {
+            pthread_cond_destroy(&node->work_cond);
+            pthread_mutex_destroy(&node->lock);
+            free(node);
+            return BINDER_ERROR_NO_MEMORY;
+        }
+        
+        node->buffer = (uint8_t*)buffer;
+        node->buffer_size = BINDER_BUFFER_SIZE;
+        ((binder_block_t*)buffer)->size = BINDER_BUFFER_SIZE;
+        ((binder_block_t*)buffer)->free = 1;
+        
+        // Ana döngü iş parçacığı; diğerleri iş geldikçe başlatılır
+        pthread_mutex_lock(&node->lock);
+        int result = binder_spawn_looper(node);
+        pthread_mutex_unlock(&node->lock);
+        
+        if (result != 0) {
+            munmap(node->buffer, node->buffer_size);
+            pthread_cond_destroy(&node->work_cond);
+            pthread_mutex_destroy(&node->lock);
+            free(node);
+            return BINDER_ERROR_NO_MEMORY;
+        }
+    }
+    
+    pthread_rwlock_wrlock(&binder_registry_lock);
+    
+    // Servis zaten kayıtlı mı kontrol et
+    binder_node_t* old = binder_find_name(name, node->name_hash);
+    if (old) {
+        binder_unlink_node(old);
+    }
+    
+    uint32_t bucket = node->name_hash & BINDER_HASH_MASK;
+    node->name_next = binder_names[bucket];
+    binder_names[bucket] = node;
+    
+    bucket = binder_hash_pointer(service) & BINDER_HASH_MASK;
+    node->service_next = binder_objects[bucket];
+    binder_objects[bucket] = node;
+    binder_service_count++;
+    
+    pthread_rwlock_unlock(&binder_registry_lock);
+    
+    // Eski servisi güncelle: bekleyen işlemleri sonlandır
+    if (old) {
+        binder_kill_node(old);
+        binder_release_node(old);
+    }
+    
+    return BINDER_SUCCESS;
+}
+
+// Servisi kaldır
+int binder_remove_service(const char* name) {
+    if (!name) {
+        return BINDER_ERROR_INVALID;
+    }
+    
+    pthread_rwlock_wrlock(&binder_registry_lock);
+    
+    binder_node_t* node = binder_find_name(name, binder_hash_name(name));
+    if (!node) {
+        pthread_rwlock_unlock(&binder_registry_lock);
+        return BINDER_ERROR_NOT_FOUND;
+    }
+    
+    binder_unlink_node(node);
+    pthread_rwlock_unlock(&binder_registry_lock);
+    
+    binder_kill_node(node);
+    binder_release_node(node);
+    
+    return BINDER_SUCCESS;
+}
+
+// Servis nesnesini adıyla bul
+void* binder_get_service(const char* name) {
+    if (!name) {
+        return NULL;
+    }
+    
+    pthread_rwlock_rdlock(&binder_registry_lock);
+    binder_node_t* node = binder_find_name(name, binder_hash_name(name));
+    void* service = node ? node->service : NULL;
+    pthread_rwlock_unlock(&binder_registry_lock);
+    
+    return service;
+}
+
+// Servise işlem gönder. Paket hedefin alım tamponuna tek kez kopyalanır.
+// Senkron işlemlerde işleyicinin dönüş değeri döner; yanıt 'reply' tamponuna yazılır.
+int binder_transact(void* service, uint32_t code, const void* data, uint32_t size,
+                    void* reply, uint32_t reply_capacity, uint32_t* reply_size, uint32_t flags) {
+    if (!service || (!data && size > 0) || (!reply && reply_capacity > 0)) {
+        return BINDER_ERROR_INVALID;
+    }
+    
+    if (reply_size) {
+        *reply_size = 0;
+    }
+    
+    binder_node_t* node = binder_acquire_node(service);
+    if (!node) {
+        return BINDER_ERROR_NOT_FOUND;
+    }
+    
+    __atomic_add_fetch(&binder_stats.transactions, 1, __ATOMIC_RELAXED);
+    if (flags & BINDER_FLAG_ONEWAY) {
+        __atomic_add_fetch(&binder_stats.oneway_transactions, 1, __ATOMIC_RELAXED);
+    }
+    
+    // İşleyicisi olmayan servis işlemi yanıtlayamaz; gönderen hatayı görür
+    if (!node->handler) {
+        binder_release_node(node);
+        return BINDER_ERROR_NO_HANDLER;
+    }
+    
+    pthread_mutex_lock(&node->lock);
+    binder_transaction_t* transaction = (binder_transaction_t*)
+        (node->dead ? NULL : binder_buffer_alloc(node, sizeof(binder_transaction_t) + size));
+    uint8_t dead = node->dead;
+    pthread_mutex_unlock(&node->lock);
+    
+    if (!transaction) {
+        if (!dead) {
+            __atomic_add_fetch(&binder_stats.buffer_full, 1, __ATOMIC_RELAXED);
+        }
+        binder_release_node(node);
+        return dead ? BINDER_ERROR_DEAD : BINDER_ERROR_NO_SPACE;
+    }
+    
+    // Tek kopya: gönderenin verisi doğrudan hedefin alım tamponuna
+    memset(transaction, 0, sizeof(binder_transaction_t));
+    transaction->code = code;
+    transaction->flags = flags;
+    transaction->data.data = (uint8_t*)(transaction + 1);
+    transaction->data.size = size;
+    transaction->data.capacity = size;
+    if (size > 0) {
+        memcpy(transaction->data.data, data, size);
+    }
+    __atomic_add_fetch(&binder_stats.bytes_copied, size, __ATOMIC_RELAXED);
+    
+    if (!(flags & BINDER_FLAG_ONEWAY)) {
+        transaction->reply.data = (uint8_t*)reply;
+        transaction->reply.capacity = reply_capacity;
+    }
+    
+    pthread_cond_t done_cond;
+    if (!(flags & BINDER_FLAG_ONEWAY)) {
+        pthread_cond_init(&done_cond, NULL);
+        transaction->done_cond = &done_cond;
+    }
+    
+    pthread_mutex_lock(&node->lock);
+    
+    if (node->dead) {
+        binder_buffer_free(node, transaction);
+        pthread_mutex_unlock(&node->lock);
+        if (!(flags & BINDER_FLAG_ONEWAY)) {
+            pthread_cond_destroy(&done_cond);
+        }
+        binder_release_node(node);
+        return BINDER_ERROR_DEAD;
+    }
+    
+    // İşlemi kuyruğa ekle
+    if (flags & BINDER_FLAG_ONEWAY) {
+        if (node->async_tail) node->async_tail->next = transaction;
+        else node->async_head = transaction;
+        node->async_tail = transaction;
+    } else {
+        if (node->todo_tail) node->todo_tail->next = transaction;
+        else node->todo_head = transaction;
+        node->todo_tail = transaction;
+    }
+    
+    // Boşta döngü iş parçacığı yoksa havuzu büyüt, varsa birini uyandır
+    if (node->idle_threads == 0 && node->thread_count < node->max_threads) {
+        binder_spawn_looper(node);
+    } else {
+        pthread_cond_signal(&node->work_cond);
+    }
+    
+    if (flags & BINDER_FLAG_ONEWAY) {
+        pthread_mutex_unlock(&node->lock);
+        binder_release_node(node);
+        return BINDER_SUCCESS;
+    }
+    
+    // Yanıtı bekle
+    while (!transaction->done) {
+        pthread_cond_wait(&done_cond, &node->lock);
+    }
+    
+    int status = transaction->status;
+    if (reply_size) {
+        *reply_size = transaction->reply.size;
+    }
+    binder_buffer_free(node, transaction);
+    
+    pthread_mutex_unlock(&node->lock);
+    pthread_cond_destroy(&done_cond);
+    binder_release_node(node);
+    
+    return status;
+}
+
+// Pakete veri ekle
+int binder_parcel_write(binder_parcel_t* parcel, const void* data, uint32_t size) {
+    if (!parcel || (!data && size > 0)) {
+        return BINDER_ERROR_INVALID;
+    }
+    
+    if (size > parcel->capacity - parcel->size) {
+        return BINDER_ERROR_REPLY_TOO_LARGE;
+    }
+    
+    memcpy(parcel->data + parcel->size, data, size);
+    parcel->size += size;
+    
+    return BINDER_SUCCESS;
+}
+
+// Binder istatistiklerini al
+int binder_get_stats(binder_stats_t* stats) {
+    if (!stats) {
+        return BINDER_ERROR_INVALID;
+    }
+    
+    stats->transactions = __atomic_load_n(&binder_stats.transactions, __ATOMIC_RELAXED);
+    stats->oneway_transactions = __atomic_load_n(&binder_stats.oneway_transactions, __ATOMIC_RELAXED);
+    stats->bytes_copied = __atomic_load_n(&binder_stats.bytes_copied, __ATOMIC_RELAXED);
+    stats->buffer_full = __atomic_load_n(&binder_stats.buffer_full, __ATOMIC_RELAXED);
+    stats->threads_spawned = __atomic_load_n(&binder_stats.threads_spawned, __ATOMIC_RELAXED);
+    
+    pthread_rwlock_rdlock(&binder_registry_lock);
+    stats->service_count = binder_service_count;
+    pthread_rwlock_unlock(&binder_registry_lock);
+    
+    return BINDER_SUCCESS;
+}
+
+// FNV-1a ad karması
+static uint32_t binder_hash_name(const char* name) {
+    uint32_t hash = 2166136261u;
+    
+    while (*name) {
+        hash ^= (uint8_t)*name++;
+        hash *= 16777619u;
+    }
+    
+    return hash;
+}
+
+// Nesne işaretçisi karması
+static uint32_t binder_hash_pointer(const void* pointer) {
+    uint64_t value = (uint64_t)(uintptr_t)pointer;
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    
+    return (uint32_t)value;
+}
+
+// Adıyla düğüm bul (kayıt kilidi tutulurken)
+static binder_node_t* binder_find_name(const char* name, uint32_t hash) {
+    for (binder_node_t* node = binder_names[hash & BINDER_HASH_MASK]; node; node = node->name_next) {
+        if (node->name_hash == hash && strcmp(node->name, name) == 0) {
+            return node;
+        }
+    }
+    
+    return NULL;
+}
+
+// Servis nesnesinin düğümünü bul ve referansını al
+static binder_node_t* binder_acquire_node(void* service) {
+    pthread_rwlock_rdlock(&binder_registry_lock);
+    
+    binder_node_t* node = binder_objects[binder_hash_pointer(service) & BINDER_HASH_MASK];
+    while (node && node->service != service) {
+        node = node->service_next;
+    }
+    
+    if (node) {
+        __atomic_add_fetch(&node->refs, 1, __ATOMIC_ACQ_REL);
+    }
+    
+    pthread_rwlock_unlock(&binder_registry_lock);
+    
+    return node;
+}
+
+// Düğüm referansını bırak; son referansla düğüm serbest bırakılır
+static void binder_release_node(binder_node_t* node) {
+    if (__atomic_sub_fetch(&node->refs, 1, __ATOMIC_ACQ_REL) != 0) {
+        return;
+    }
+    
+    if (node->buffer) {
+        munmap(node->buffer, node->buffer_size);
+    }
+    pthread_cond_destroy(&node->work_cond);
+    pthread_mutex_destroy(&node->lock);
+    free(node);
+}
+
+// Düğümü karma tablolarından çıkar (kayıt kilidi yazma için tutulurken)
+static void binder_unlink_node(binder_node_t* node) {
+    binder_node_t** link = &binder_names[node->name_hash & BINDER_HASH_MASK];
+    while (*link && *link != node) {
+        link = &(*link)->name_next;
+    }
+    if (*link) {
+        *link = node->name_next;
+    }
+    
+    link = &binder_objects[binder_hash_pointer(node->service) & BINDER_HASH_MASK];
+    while (*link && *link != node) {
+        link = &(*link)->service_next;
+    }
+    if (*link) {
+        *link = node->service_next;
+    }
+    
+    binder_service_count--;
+}
+
+// Döngü iş parçacıklarını durdur, bekleyen işlemleri hatayla sonlandır.
+// İşleyici kendi servisini kaldırabilir: çağıran döngü iş parçacığı kendini
+// beklemez, ayrılır ve işleyici dönünce düğüm referansını bırakarak çıkar.
+static void binder_kill_node(binder_node_t* node) {
+    pthread_mutex_lock(&node->lock);
+    node->dead = 1;
+    pthread_cond_broadcast(&node->work_cond);
+    uint32_t thread_count = node->thread_count;
+    pthread_mutex_unlock(&node->lock);
+    
+    pthread_t self = pthread_self();
+    for (uint32_t i = 0; i < thread_count; i++) {
+        if (pthread_equal(node->threads[i], self)) {
+            pthread_detach(self);
+        } else {
+            pthread_join(node->threads[i], NULL);
+        }
+    }
+    
+    pthread_mutex_lock(&node->lock);
+    
+    // Senkron gönderenler hata ile uyandırılır, tek yönlü işlemler atılır
+    while (node->todo_head) {
+        binder_transaction_t* transaction = node->todo_head;
+        node->todo_head = transaction->next;
+        transaction->status = BINDER_ERROR_DEAD;
+        transaction->done = 1;
+        pthread_cond_signal(transaction->done_cond);
+    }
+    node->todo_tail = NULL;
+    
+    while (node->async_head) {
+        binder_transaction_t* transaction = node->async_head;
+        node->async_head = transaction->next;
+        binder_buffer_free(node, transaction);
+    }
+    node->async_tail = NULL;
+    
+    pthread_mutex_unlock(&node->lock);
+}
+
+// Alım tamponundan blok ayır (düğüm kilidi tutulurken). İlk uygun blok
+// kullanılır; ardışık boş bloklar tarama sırasında birleştirilir.
+static void* binder_buffer_alloc(binder_node_t* node, uint32_t size) {
+    if (size > node->buffer_size - sizeof(binder_block_t)) {
+        return NULL;
+    }
+    
+    uint32_t needed = (size + sizeof(binder_block_t) + BINDER_BLOCK_ALIGN - 1) & ~(uint32_t)(BINDER_BLOCK_ALIGN - 1);
+    uint32_t offset = 0;
+    
+    while (offset < node->buffer_size) {
+        binder_block_t* block = (binder_block_t*)(node->buffer + offset);
+        
+        if (block->free) {
+            // Sonraki boş blokları bu bloğa kat
+            while (offset + block->size < node->buffer_size) {
+                binder_block_t* next = (binder_block_t*)(node->buffer + offset + block->size);
+                if (!next->free) {
+                    break;
+                }
+                block->size += next->size;
+            }
+            
+            if (block->size >= needed) {
+                // Artan kısım yeterince büyükse ayrı boş blok olarak bırak
+                if (block->size - needed >= BINDER_BLOCK_MIN_SPLIT) {
+                    binder_block_t* rest = (binder_block_t*)(node->buffer + offset + needed);
+                    rest->size = block->size - needed;
+                    rest->free = 1;
+                    block->size = needed;
+                }
+                
+                block->free = 0;
+                return block + 1;
+            }
+        }
+        
+        offset += block->size;
+    }
+    
+    return NULL;
+}
+
+// Alım tamponu bloğunu serbest bırak (düğüm kilidi tutulurken)
+static void binder_buffer_free(binder_node_t* node, void* pointer) {
+    (void)node;
+    binder_block_t* block = (binder_block_t*)pointer - 1;
+    block->free = 1;
+}
+
+// Yeni döngü iş parçacığı başlat (düğüm kilidi tutulurken). İş parçacığı
+// çıkana kadar düğüme referans tutar.
+static int binder_spawn_looper(binder_node_t* node) {
+    if (node->thread_count >= node->max_threads) {
+        return -1;
+    }
+    
+    __atomic_add_fetch(&node->refs, 1, __ATOMIC_ACQ_REL);
+    if (pthread_create(&node->threads[node->thread_count], NULL, binder_looper, node) != 0) {
+        __atomic_sub_fetch(&node->refs, 1, __ATOMIC_ACQ_REL);
+        return -1;
+    }
+    
+    node->thread_count++;
+    __atomic_add_fetch(&binder_stats.threads_spawned, 1, __ATOMIC_RELAXED);
+    
+    return 0;
+}
+
+// Döngü iş parçacığı: kuyruktaki işlemleri servis işleyicisine ilet.
+// Çalışma zamanına bağlanır ve bloklu (yerel kod) durumda kalır: toplayıcı ve
+// dondurucu onu beklemez, her işlemden önce geçtiği güvenli noktada ise donmuş
+// konteynerde yeni işlem dağıtılmaz. Nesnelere dokunan işleyici önce
+// art_heap_thread_unblock ile çalışır duruma geçmelidir.
+static void* binder_looper(void* arg) {
+    binder_node_t* node = (binder_node_t*)arg;
+    
+    int attached = art_heap_attach_thread() == 0;
+    art_heap_thread_block();
+    
+    pthread_mutex_lock(&node->lock);
+    
+    for (;;) {
+        // İş bekle; tek yönlü işlemler düğüm başına sırayla işlenir
+        while (!node->dead && !node->todo_head && !(node->async_head && !node->async_busy)) {
+            node->idle_threads++;
+            pthread_cond_wait(&node->work_cond, &node->lock);
+            node->idle_threads--;
+        }
+        
+        if (node->dead) {
+            break;
+        }
+        
+        binder_transaction_t* transaction;
+        if (node->todo_head) {
+            transaction = node->todo_head;
+            node->todo_head = transaction->next;
+            if (!node->todo_head) node->todo_tail = NULL;
+        } else {
+            transaction = node->async_head;
+            node->async_head = transaction->next;
+            if (!node->async_head) node->async_tail = NULL;
+            node->async_busy = 1;
+        }
+        transaction->next = NULL;
+        
+        pthread_mutex_unlock(&node->lock);
+        
+        art_heap_thread_unblock();
+        art_heap_thread_block();
+        
+        int status = node->handler(node->service, transaction->code, &transaction->data, &transaction->reply);
+        
+        pthread_mutex_lock(&node->lock);
+        
+        if (transaction->flags & BINDER_FLAG_ONEWAY) {
+            binder_buffer_free(node, transaction);
+            node->async_busy = 0;
+        } else {
+            transaction->status = status;
+            transaction->done = 1;
+            pthread_cond_signal(transaction->done_cond);
+        }
+    }
+    
+    pthread_mutex_unlock(&node->lock);
+    
+    if (attached) {
+        art_heap_thread_unblock();
+        art_heap_detach_thread();
+    }
+    
+    binder_release_node(node);
+    
+    return NULL;
+}
@@ -1,22 +1,45 @@
 #include "../../include/android/android_bridge.h"
+#include "../../include/android/binder.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+// Yüzey tamponları sayfa hizalı ve paylaşımlı ayrılır
+#define BRIDGE_PAGE_SIZE 4096
+#define BRIDGE_INPUT_RING_MASK (ANDROID_INPUT_RING_SIZE - 1)
 
 // Global köprü dizisi
 #define MAX_BRIDGES 16
 static android_bridge_t* bridges[MAX_BRIDGES] = {NULL};
 static uint32_t bridge_count = 0;
 
-// Binder servis listesi
-#define MAX_SERVICES 32
-typedef struct {
-    char name[64];
-    void* service;
-} binder_service_t;
+// Yüzey tamponu yardımcıları
+static uint64_t bridge_now_us();
+static int bridge_alloc_slots(android_surface_t* surface, uint32_t stride, uint32_t rows);
+static void bridge_free_slots(android_surface_t* surface);
+static void bridge_free_retired(android_surface_t* surface);
+static const uint32_t* bridge_acquire_locked(android_surface_t* surface);
+static int8_t bridge_latest_slot(android_surface_t* surface);
+static int bridge_apply_resize(android_surface_t* surface, uint8_t allow_realloc);
+static void bridge_resize_in_place(android_surface_t* surface, uint32_t width, uint32_t height);
+static int bridge_grow_slots(android_surface_t* surface, uint32_t width, uint32_t height);
+static void bridge_notify_surface_changed(android_surface_t* surface);
+static void bridge_merge_damage(android_surface_buffer_t* dst, const android_surface_buffer_t* src);
+static int bridge_surface_transact(void* service, uint32_t code, const binder_parcel_t* data, binder_parcel_t* reply);
+static uint8_t bridge_window_paint(gui_window_t* window);
+static void bridge_window_resize(gui_window_t* window, uint16_t width, uint16_t height);
+static void bridge_window_resize_drag(gui_window_t* window, uint8_t active);
+static void bridge_detach_window(android_bridge_t* bridge);
 
-static binder_service_t binder_services[MAX_SERVICES];
-static uint32_t service_count = 0;
+// Giriş halkası yardımcıları
+static int bridge_input_push(android_bridge_t* bridge, const android_input_event_t* event);
+static void bridge_futex_wait(volatile uint32_t* word, uint32_t expected, uint32_t timeout_ms);
+static void bridge_futex_wake(volatile uint32_t* word);
 
 // Köprü sistemi başlatma
 int bridge_initialize() {
@@ -24,10 +47,6 @@ int bridge_initialize() {
     memset(bridges, 0, sizeof(bridges));
     bridge_count = 0;
     
-    // Binder servis listesini sıfırla
-    memset(binder_services, 0, sizeof(binder_services));
-    service_count = 0;
-    
     return 0;
 }
 
@@ -55,6 +74,15 @@ android_bridge_t* bridge_create(android_container_t* container) {
     bridge->last_frame_time = 0;
     bridge->fps = 0;
     
+    // Giriş halkası konteynerle paylaşılır (sıfırlanmış olarak gelir)
+    void* ring = mmap(NULL, sizeof(android_input_ring_t), PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (ring == MAP_FAILED) {
+        free(bridge);
+        return NULL;
+    }
+    bridge->input_events = (android_input_ring_t*)ring;
+    
     // Köprü dizisine ekle
     bridges[bridge_count++] = bridge;
     
@@ -69,11 +97,21 @@ int bridge_connect_to_window(android_bridge_t* bridge, gui_window_t* window) {
     
     // Mevcut pencereyi kaldır
     if (bridge->window) {
-        // TODO: Eski pencere bağlantısını temizle
+        bridge_detach_window(bridge);
     }
     
-    // Yeni pencere bağla
+    // Yeni pencere bağla; yüzey tamponu pencerenin arka tamponu olarak gösterilir.
+    // Pencerenin boyutlandırması yüzeye iletilir. Pencerenin kendi işleyicileri
+    // ayrılırken geri yüklenir.
     bridge->window = window;
+    bridge->window_on_paint = window->on_paint;
+    bridge->window_user_data = window->user_data;
+    bridge->window_on_resize = window->on_resize;
+    bridge->window_on_resize_drag = window->on_resize_drag;
+    window->on_paint = bridge_window_paint;
+    window->on_resize = bridge_window_resize;
+    window->on_resize_drag = bridge_window_resize_drag;
+    window->user_data = bridge;
     
     // Pencere boyutuna uygun yüzey oluştur
     uint32_t width = window->width;
@@ -103,8 +141,21 @@ int bridge_destroy(android_bridge_t* bridge) {
     }
     
     // Pencereyi temizle
+    bridge_detach_window(bridge);
     bridge->window = NULL;
     
+    // Ses akışını kapat
+    if (bridge->audio_stream) {
+        audio_stream_close(bridge->audio_stream);
+        bridge->audio_stream = NULL;
+    }
+    
+    // Giriş halkasını serbest bırak
+    if (bridge->input_events) {
+        munmap(bridge->input_events, sizeof(android_input_ring_t));
+        bridge->input_events = NULL;
+    }
+    
     // Köprü dizisinden çıkar
     for (uint32_t i = 0; i < bridge_count; i++) {
         if (bridges[i] == bridge) {
@@ -142,23 +193,33 @@ android_surface_t* bridge_create_surface(android_bridge_t* bridge, uint32_t widt
     surface->id = (uint32_t)(uintptr_t)surface;  // Basit ID oluştur
     surface->width = width;
     surface->height = height;
-    
-    // Piksel tamponu için bellek ayır
-    surface->buffer = (uint32_t*)malloc(width * height * sizeof(uint32_t));
-    if (!surface->buffer) {
+    surface->dequeued_slot = ANDROID_SURFACE_NO_SLOT;
+    surface->queued_slot = ANDROID_SURFACE_NO_SLOT;
+    surface->acquired_slot = ANDROID_SURFACE_NO_SLOT;
+    surface->next_frame_number = 1;
+    surface->create_time_us = bridge_now_us();
+    pthread_mutex_init(&surface->queue_lock, NULL);
+    
+    // Paylaşımlı piksel tamponlarını ayır (sıfırlanmış olarak gelir)
+    if (bridge_alloc_slots(surface, width, height) != 0) {
+        pthread_mutex_destroy(&surface->queue_lock);
         free(surface);
         return NULL;
     }
     
-    // Tamponu sıfırla
-    memset(surface->buffer, 0, width * height * sizeof(uint32_t));
-    
     // Alfa kanalı varsayılan olarak açık
     surface->has_alpha = 1;
     
     // İlk olarak kirli olarak işaretle
     surface->dirty = 1;
     
+    // Android tarafının çizim yolu: üretici servisini yayınla (tek döngü iş
+    // parçacığı kareleri gönderildikleri sırayla kuyruğa ekler)
+    snprintf(surface->service_name, sizeof(surface->service_name), "surface.%08x", surface->id);
+    if (binder_add_service(surface->service_name, surface, bridge_surface_transact, 1) != BINDER_SUCCESS) {
+        surface->service_name[0] = '\0';
+    }
+    
     // Köprüye yüzeyi ekle
     bridge->surface = surface;
     
@@ -170,53 +231,71 @@ android_surface_t* bridge_create_surface(android_bridge_t* bridge, uint32_t widt
     return surface;
 }
 
-// Yüzeyi yeniden boyutlandır
+// Yüzeyi yeniden boyutlandır. Ayrılmış alan yetiyorsa tamponlar yerinde
+// kullanılır; sürükleme sırasında yeniden ayırma sürükleme bitene kadar ertelenir.
 int bridge_resize_surface(android_surface_t* surface, uint32_t width, uint32_t height) {
     if (!surface || width == 0 || height == 0) {
         return -1;
     }
     
-    // Boyut değişmediyse, işlem yapma
-    if (surface->width == width && surface->height == height) {
+    pthread_mutex_lock(&surface->queue_lock);
+    
+    // Boyut değişmediyse ve bekleyen istek yoksa, işlem yapma
+    if (!surface->resize_pending && surface->width == width && surface->height == height) {
+        pthread_mutex_unlock(&surface->queue_lock);
         return 0;
     }
     
-    // Yeni piksel tamponu için bellek ayır
-    uint32_t* new_buffer = (uint32_t*)malloc(width * height * sizeof(uint32_t));
-    if (!new_buffer) {
+    // Yalnızca son istenen boyut saklanır, ara boyutlar birleştirilir
+    surface->pending_width = width;
+    surface->pending_height = height;
+    surface->resize_pending = 1;
+    
+    int result = bridge_apply_resize(surface, !surface->resizing);
+    
+    pthread_mutex_unlock(&surface->queue_lock);
+    
+    if (result < 0) {
         return -2;
     }
     
-    // Yeni tamponu sıfırla
-    memset(new_buffer, 0, width * height * sizeof(uint32_t));
-    
-    // Eski verileri kopyala (daha küçük boyutu kullan)
-    uint32_t copy_width = (width < surface->width) ? width : surface->width;
-    uint32_t copy_height = (height < surface->height) ? height : surface->height;
+    if (result > 0) {
+        bridge_notify_surface_changed(surface);
+    }
     
-    for (uint32_t y = 0; y < copy_height; y++) {
-        for (uint32_t x = 0; x < copy_width; x++) {
-            new_buffer[y * width + x] = surface->buffer[y * surface->width + x];
-        }
+    return 0;
+}
+
+// Boyutlandırma sürüklemesi başladı: ara boyutlar için tampon ayrılmaz
+int bridge_begin_resize(android_surface_t* surface) {
+    if (!surface) {
+        return -1;
     }
     
-    // Eski tamponu serbest bırak
-    free(surface->buffer);
+    pthread_mutex_lock(&surface->queue_lock);
+    surface->resizing = 1;
+    pthread_mutex_unlock(&surface->queue_lock);
     
-    // Yeni tampon ve boyutları ayarla
-    surface->buffer = new_buffer;
-    surface->width = width;
-    surface->height = height;
+    return 0;
+}
+
+// Boyutlandırma sürüklemesi bitti: gerekiyorsa yalnızca son boyut için yeniden ayır
+int bridge_end_resize(android_surface_t* surface) {
+    if (!surface) {
+        return -1;
+    }
     
-    // Kirli olarak işaretle
-    surface->dirty = 1;
+    pthread_mutex_lock(&surface->queue_lock);
+    surface->resizing = 0;
+    int result = bridge_apply_resize(surface, 1);
+    pthread_mutex_unlock(&surface->queue_lock);
     
-    // Yüzey değişti geri çağırması
-    for (uint32_t i = 0; i < bridge_count; i++) {
-        if (bridges[i]->surface == surface && bridges[i]->on_surface_changed) {
-            bridges[i]->on_surface_changed(surface);
-            break;
-        }
+    if (result < 0) {
+        return -2;
+    }
+    
+    if (result > 0) {
+        bridge_notify_surface_changed(surface);
     }
     
     return 0;
@@ -236,18 +315,27 @@ int bridge_destroy_surface(android_surface_t* surface) {
                 bridges[i]->on_surface_destroyed(surface);
             }
             
+            // Pencere artık yüzey tamponunu göstermemeli
+            if (bridges[i]->window) {
+                bridges[i]->window->backing_store = NULL;
+            }
+            
             // Köprüdeki yüzey referansını temizle
             bridges[i]->surface = NULL;
             break;
         }
     }
     
-    // Piksel tamponunu serbest bırak
-    if (surface->buffer) {
-        free(surface->buffer);
-        surface->buffer = NULL;
+    // Üretici servisini kaldır (döngü iş parçacıkları beklenir)
+    if (surface->service_name[0]) {
+        binder_remove_service(surface->service_name);
     }
     
+    // Piksel tamponlarını serbest bırak
+    bridge_free_slots(surface);
+    bridge_free_retired(surface);
+    pthread_mutex_destroy(&surface->queue_lock);
+    
     // Yerel tanıtıcıyı temizle
     surface->native_handle = NULL;
     
@@ -270,6 +358,11 @@ int bridge_lock_surface(android_surface_t* surface, void** buffer) {
         }
     }
     
+    // Çizim için boş bir tampon al
+    if (bridge_dequeue_buffer(surface, buffer) != 0) {
+        return -3;
+    }
+    
     // Köprüyü kilitle
     for (uint32_t i = 0; i < bridge_count; i++) {
         if (bridges[i]->surface == surface) {
@@ -278,15 +371,12 @@ int bridge_lock_surface(android_surface_t* surface, void** buffer) {
         }
     }
     
-    // Tampon işaretçisini döndür
-    *buffer = (void*)surface->buffer;
-    
     return 0;
 }
 
-// Yüzey erişimi için kilidi aç
-int bridge_unlock_surface(android_surface_t* surface) {
-    if (!surface) {
+// Yüzey erişimi için kilidi aç; değişen bölgeler kareyle birlikte kuyruğa girer
+int bridge_unlock_surface(android_surface_t* surface, const android_rect_t* damage, uint32_t damage_count) {
+    if (!surface || (!damage && damage_count > 0)) {
         return -1;
     }
     
@@ -304,14 +394,27 @@ int bridge_unlock_surface(android_surface_t* surface) {
         return -2;
     }
     
+    // Hasar kuyruğa eklemeden önce tampona yazılır; pencere yalnızca bu
+    // bölgeleri dönüştürüp çizer
+    if (damage && bridge_set_damage_region(surface, damage, damage_count) != 0) {
+        return -3;
+    }
+    
+    // Çizilen tamponu gösterim kuyruğuna ekle
+    if (bridge_queue_buffer(surface) != 0) {
+        return -3;
+    }
+    
     // Değişiklik olduğunu işaretle
+    pthread_mutex_lock(&surface->queue_lock);
     surface->dirty = 1;
+    pthread_mutex_unlock(&surface->queue_lock);
     
-    // Yeniden çizim planla
+    // Yeniden çizimi GUI döngüsüne bırak; pencere yeni kareyi orada
+    // kopyalamadan arka tampon olarak alır
     for (uint32_t i = 0; i < bridge_count; i++) {
         if (bridges[i]->surface == surface && bridges[i]->window) {
-            // Pencereyi güncelleme isteği gönder
-            // TODO: Gerçek bir uygulamada, burada pencere güncelleme işlemi yapılır
+            gui_window_post_invalidate(bridges[i]->window);
             break;
         }
     }
@@ -326,13 +429,14 @@ int bridge_invalidate_surface(android_surface_t* surface) {
     }
     
     // Değişiklik olduğunu işaretle
+    pthread_mutex_lock(&surface->queue_lock);
     surface->dirty = 1;
+    pthread_mutex_unlock(&surface->queue_lock);
     
-    // Yeniden çizim planla
+    // Yeniden çizimi GUI döngüsüne bırak
     for (uint32_t i = 0; i < bridge_count; i++) {
         if (bridges[i]->surface == surface && bridges[i]->window) {
-            // Pencereyi güncelleme isteği gönder
-            // TODO: Gerçek bir uygulamada, burada pencere güncelleme işlemi yapılır
+            gui_window_post_invalidate(bridges[i]->window);
             break;
         }
     }
@@ -340,6 +444,230 @@ int bridge_invalidate_surface(android_surface_t* surface) {
     return 0;
 }
 
+// Çizim için boş tampon al (Android tarafı)
+int bridge_dequeue_buffer(android_surface_t* surface, void** buffer) {
+    if (!surface || !buffer) {
+        return -1;
+    }
+    
+    pthread_mutex_lock(&surface->queue_lock);
+    
+    // Aynı anda yalnızca bir tampon çizilebilir
+    if (surface->dequeued_slot != ANDROID_SURFACE_NO_SLOT) {
+        pthread_mutex_unlock(&surface->queue_lock);
+        return -2;
+    }
+    
+    // Üçlü tamponlamada en fazla biri kuyrukta, biri ekranda olduğundan
+    // her zaman bir boş tampon bulunur
+    int8_t slot = ANDROID_SURFACE_NO_SLOT;
+    for (int8_t i = 0; i < ANDROID_SURFACE_BUFFER_COUNT; i++) {
+        if (surface->slots[i].state == SURFACE_BUFFER_FREE) {
+            slot = i;
+            break;
+        }
+    }
+    
+    if (slot == ANDROID_SURFACE_NO_SLOT) {
+        pthread_mutex_unlock(&surface->queue_lock);
+        return -3;
+    }
+    
+    // Tampon içeriğinin yaşı; Android tarafı yalnızca son 'yaş' karedeki
+    // hasarı yeniden çizerek tamponu güncel hale getirebilir
+    surface->buffer_age = (surface->slots[slot].frame_number != 0) ?
+                          (uint32_t)(surface->next_frame_number - surface->slots[slot].frame_number) : 0;
+    
+    // Hasar bölgesi belirtilmezse tüm tampon değişmiş sayılır
+    surface->slots[slot].damage_count = 0;
+    surface->slots[slot].full_damage = 1;
+    
+    surface->slots[slot].state = SURFACE_BUFFER_DEQUEUED;
+    surface->dequeued_slot = slot;
+    surface->buffer = surface->slots[slot].pixels;
+    *buffer = (void*)surface->buffer;
+    
+    pthread_mutex_unlock(&surface->queue_lock);
+    
+    return 0;
+}
+
+// Çizilen tamponda değişen bölgeleri bildir (Android tarafı, kuyruğa eklemeden önce).
+// Boş liste tüm tamponun değiştiği anlamına gelir.
+int bridge_set_damage_region(android_surface_t* surface, const android_rect_t* rects, uint32_t count) {
+    if (!surface || (!rects && count > 0)) {
+        return -1;
+    }
+    
+    pthread_mutex_lock(&surface->queue_lock);
+    
+    if (surface->dequeued_slot == ANDROID_SURFACE_NO_SLOT) {
+        pthread_mutex_unlock(&surface->queue_lock);
+        return -2;
+    }
+    
+    android_surface_buffer_t* slot = &surface->slots[surface->dequeued_slot];
+    slot->damage_count = 0;
+    slot->full_damage = (count == 0);
+    
+    for (uint32_t i = 0; i < count && !slot->full_damage; i++) {
+        // Yüzey sınırlarına kırp
+        if (rects[i].x >= surface->width || rects[i].y >= surface->height) continue;
+        
+        android_rect_t rect = rects[i];
+        if (rect.width > surface->width - rect.x) rect.width = surface->width - rect.x;
+        if (rect.height > surface->height - rect.y) rect.height = surface->height - rect.y;
+        if (rect.width == 0 || rect.height == 0) continue;
+        
+        // Dikdörtgen sayısı aşılırsa tüm tampon değişmiş sayılır
+        if (slot->damage_count >= ANDROID_SURFACE_MAX_DAMAGE) {
+            slot->full_damage = 1;
+            slot->damage_count = 0;
+            break;
+        }
+        
+        slot->damage[slot->damage_count++] = rect;
+    }
+    
+    pthread_mutex_unlock(&surface->queue_lock);
+    
+    return 0;
+}
+
+// Çizilen tamponu gösterim kuyruğuna ekle (Android tarafı)
+int bridge_queue_buffer(android_surface_t* surface) {
+    if (!surface) {
+        return -1;
+    }
+    
+    pthread_mutex_lock(&surface->queue_lock);
+    
+    if (surface->dequeued_slot == ANDROID_SURFACE_NO_SLOT) {
+        pthread_mutex_unlock(&surface->queue_lock);
+        return -2;
+    }
+    
+    android_surface_buffer_t* slot = &surface->slots[surface->dequeued_slot];
+    
+    // Henüz gösterilmemiş önceki kare yenisiyle değiştirilir; onun hasarı
+    // da ekranda henüz görünmediği için yeni kareye aktarılır
+    if (surface->queued_slot != ANDROID_SURFACE_NO_SLOT) {
+        bridge_merge_damage(slot, &surface->slots[surface->queued_slot]);
+        surface->slots[surface->queued_slot].state = SURFACE_BUFFER_FREE;
+        surface->stats.frames_dropped++;
+    }
+    
+    slot->state = SURFACE_BUFFER_QUEUED;
+    slot->width = surface->width;
+    slot->height = surface->height;
+    slot->frame_number = surface->next_frame_number++;
+    slot->queue_time_us = bridge_now_us();
+    
+    surface->queued_slot = surface->dequeued_slot;
+    surface->dequeued_slot = ANDROID_SURFACE_NO_SLOT;
+    surface->stats.frames_queued++;
+    
+    // Çizim sürerken gelen boyut isteği şimdi uygulanabilir
+    int resized = bridge_apply_resize(surface, !surface->resizing);
+    
+    pthread_mutex_unlock(&surface->queue_lock);
+    
+    if (resized > 0) {
+        bridge_notify_surface_changed(surface);
+    }
+    
+    return 0;
+}
+
+// Gösterilecek en yeni tamponu al (pencere yöneticisi tarafı)
+const uint32_t* bridge_acquire_buffer(android_surface_t* surface) {
+    if (!surface) {
+        return NULL;
+    }
+    
+    pthread_mutex_lock(&surface->queue_lock);
+    const uint32_t* pixels = bridge_acquire_locked(surface);
+    pthread_mutex_unlock(&surface->queue_lock);
+    
+    return pixels;
+}
+
+// Tampon alma (queue_lock tutulurken çağrılır)
+static const uint32_t* bridge_acquire_locked(android_surface_t* surface) {
+    // Pencere dönen işaretçiye geçeceğinden büyümeden kalan tamponlar artık
+    // okunmaz; yalnızca burada (GUI iş parçacığında) serbest bırakılır
+    bridge_free_retired(surface);
+    
+    if (surface->queued_slot != ANDROID_SURFACE_NO_SLOT) {
+        // Önceki kareyi serbest bırak, yenisini al (kopyalamadan işaretçi takası)
+        if (surface->acquired_slot != ANDROID_SURFACE_NO_SLOT) {
+            surface->slots[surface->acquired_slot].state = SURFACE_BUFFER_FREE;
+        }
+        
+        surface->acquired_slot = surface->queued_slot;
+        surface->queued_slot = ANDROID_SURFACE_NO_SLOT;
+        
+        android_surface_buffer_t* slot = &surface->slots[surface->acquired_slot];
+        slot->state = SURFACE_BUFFER_ACQUIRED;
+        
+        // Kuyruk -> gösterim gecikmesi
+        uint64_t now = bridge_now_us();
+        uint64_t latency = now - slot->queue_time_us;
+        surface->stats.total_latency_us += latency;
+        if (latency > surface->stats.max_latency_us) {
+            surface->stats.max_latency_us = latency;
+        }
+        if (surface->stats.frames_presented++ == 0) {
+            surface->stats.first_frame_us = now - surface->create_time_us;
+        }
+        
+        // Değişen bayt sayısı
+        if (slot->full_damage) {
+            surface->stats.damage_bytes += (uint64_t)surface->width * surface->height * sizeof(uint32_t);
+        } else {
+            for (uint8_t i = 0; i < slot->damage_count; i++) {
+                surface->stats.damage_bytes += (uint64_t)slot->damage[i].width * 
+                                               slot->damage[i].height * sizeof(uint32_t);
+            }
+        }
+        surface->dirty = 0;
+    }
+    
+    return (surface->acquired_slot != ANDROID_SURFACE_NO_SLOT) ?
+           surface->slots[surface->acquired_slot].pixels : NULL;
+}
+
+// Gösterilen tamponu serbest bırak (pencere yöneticisi tarafı)
+int bridge_release_buffer(android_surface_t* surface) {
+    if (!surface) {
+        return -1;
+    }
+    
+    pthread_mutex_lock(&surface->queue_lock);
+    
+    if (surface->acquired_slot != ANDROID_SURFACE_NO_SLOT) {
+        surface->slots[surface->acquired_slot].state = SURFACE_BUFFER_FREE;
+        surface->acquired_slot = ANDROID_SURFACE_NO_SLOT;
+    }
+    
+    pthread_mutex_unlock(&surface->queue_lock);
+    
+    return 0;
+}
+
+// Yüzey sunum istatistiklerini al
+int bridge_get_surface_stats(android_surface_t* surface, android_surface_stats_t* stats) {
+    if (!surface || !stats) {
+        return -1;
+    }
+    
+    pthread_mutex_lock(&surface->queue_lock);
+    *stats = surface->stats;
+    pthread_mutex_unlock(&surface->queue_lock);
+    
+    return 0;
+}
+
 // Görüntüleme modunu ayarla
 int bridge_set_display_mode(android_bridge_t* bridge, android_display_mode_t mode) {
     if (!bridge) {
@@ -421,9 +749,13 @@ int bridge_inject_key_event(android_bridge_t* bridge, uint8_t key_code, uint8_t
     }
     
     // Klavye olayını Android'e gönder
-    // TODO: Gerçek bir uygulamada, burada Android tarafına klavye olayı gönderilir
+    android_input_event_t event;
+    memset(&event, 0, sizeof(event));
+    event.type = ANDROID_INPUT_KEY;
+    event.action = is_press ? ANDROID_INPUT_ACTION_DOWN : ANDROID_INPUT_ACTION_UP;
+    event.key_code = key_code;
     
-    return 0;
+    return bridge_input_push(bridge, &event);
 }
 
 // Fare olayı enjekte et
@@ -432,10 +764,32 @@ int bridge_inject_mouse_event(android_bridge_t* bridge, uint32_t x, uint32_t y,
         return -1;
     }
     
+    // Düğme durumu değişmediyse olay bir harekettir
+    uint8_t mask = (uint8_t)(1 << (button & 7));
+    uint8_t action = ANDROID_INPUT_ACTION_MOVE;
+    
+    if (is_press && !(bridge->mouse_buttons & mask)) {
+        action = ANDROID_INPUT_ACTION_DOWN;
+    } else if (!is_press && (bridge->mouse_buttons & mask)) {
+        action = ANDROID_INPUT_ACTION_UP;
+    }
+    
     // Fare olayını Android'e gönder
-    // TODO: Gerçek bir uygulamada, burada Android tarafına fare olayı gönderilir
+    android_input_event_t event;
+    memset(&event, 0, sizeof(event));
+    event.type = ANDROID_INPUT_MOUSE;
+    event.action = action;
+    event.x = x;
+    event.y = y;
+    event.button = button;
+    
+    int result = bridge_input_push(bridge, &event);
+    if (result == 0) {
+        if (action == ANDROID_INPUT_ACTION_DOWN) bridge->mouse_buttons |= mask;
+        if (action == ANDROID_INPUT_ACTION_UP) bridge->mouse_buttons &= (uint8_t)~mask;
+    }
     
-    return 0;
+    return result;
 }
 
 // Dokunma olayı enjekte et
@@ -444,45 +798,156 @@ int bridge_inject_touch_event(android_bridge_t* bridge, uint32_t x, uint32_t y,
         return -1;
     }
     
+    // Temas yokken gelen konum bilgisi Android'e iletilmez
+    if (!is_down && !bridge->touch_down) {
+        return 0;
+    }
+    
     // Dokunma olayını Android'e gönder
-    // TODO: Gerçek bir uygulamada, burada Android tarafına dokunma olayı gönderilir
+    android_input_event_t event;
+    memset(&event, 0, sizeof(event));
+    event.type = ANDROID_INPUT_TOUCH;
+    event.action = !is_down ? ANDROID_INPUT_ACTION_UP :
+                   bridge->touch_down ? ANDROID_INPUT_ACTION_MOVE : ANDROID_INPUT_ACTION_DOWN;
+    event.x = x;
+    event.y = y;
+    
+    int result = bridge_input_push(bridge, &event);
+    if (result == 0) {
+        bridge->touch_down = is_down;
+    }
+    
+    return result;
+}
+
+// Bekleyen giriş olaylarını oku (konteyner tarafı). Art arda gelen aynı
+// kaynaklı hareketler tek olayda birleştirilir; okunan olay sayısı döner.
+int bridge_read_input_events(android_bridge_t* bridge, android_input_event_t* events, uint32_t max_events) {
+    if (!bridge || !bridge->input_events || !events || max_events == 0) {
+        return -1;
+    }
+    
+    android_input_ring_t* ring = bridge->input_events;
+    uint32_t head = ring->head;
+    uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    uint64_t now = bridge_now_us();
+    uint32_t count = 0;
+    
+    while (head != tail) {
+        const android_input_event_t* event = &ring->events[head & BRIDGE_INPUT_RING_MASK];
+        android_input_event_t* last = (count > 0) ? &events[count - 1] : NULL;
+        
+        uint8_t coalesce = last && event->action == ANDROID_INPUT_ACTION_MOVE &&
+                           last->action == ANDROID_INPUT_ACTION_MOVE &&
+                           last->type == event->type && last->button == event->button;
+        
+        if (!coalesce && count == max_events) {
+            break;
+        }
+        
+        // Enjeksiyon -> okuma gecikmesi
+        uint64_t latency = (now > event->timestamp_us) ? now - event->timestamp_us : 0;
+        ring->total_latency_us += latency;
+        if (latency > ring->max_latency_us) {
+            ring->max_latency_us = latency;
+        }
+        ring->events_read++;
+        
+        if (coalesce) {
+            // Son konum ve zaman geçerli, örnek sayısı birikir
+            last->x = event->x;
+            last->y = event->y;
+            last->timestamp_us = event->timestamp_us;
+            last->sample_count++;
+            ring->events_coalesced++;
+        } else {
+            events[count++] = *event;
+        }
+        
+        head++;
+    }
+    
+    // Okunan yuvaları üreticiye geri ver
+    __atomic_store_n(&ring->head, head, __ATOMIC_RELEASE);
+    ring->events_dispatched += count;
+    
+    return (int)count;
+}
+
+// Giriş olayı gelene kadar bekle (konteyner tarafı). Yoklama yapılmaz; üretici
+// kapı zilini çalınca uyanılır. Olay varsa 1, zaman aşımında 0 döner.
+int bridge_wait_input_events(android_bridge_t* bridge, uint32_t timeout_ms) {
+    if (!bridge || !bridge->input_events) {
+        return -1;
+    }
+    
+    android_input_ring_t* ring = bridge->input_events;
+    uint64_t deadline = bridge_now_us() + (uint64_t)timeout_ms * 1000;
+    
+    for (;;) {
+        uint32_t bell = __atomic_load_n(&ring->doorbell, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&ring->tail, __ATOMIC_SEQ_CST) != ring->head) {
+            return 1;
+        }
+        
+        // Uyumadan önce bildir ve tekrar kontrol et; aradaki olay kaçırılmaz
+        __atomic_store_n(&ring->consumer_waiting, 1, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&ring->tail, __ATOMIC_SEQ_CST) != ring->head) {
+            __atomic_store_n(&ring->consumer_waiting, 0, __ATOMIC_SEQ_CST);
+            return 1;
+        }
+        
+        uint64_t now = bridge_now_us();
+        if (now >= deadline) {
+            __atomic_store_n(&ring->consumer_waiting, 0, __ATOMIC_SEQ_CST);
+            return 0;
+        }
+        
+        bridge_futex_wait(&ring->doorbell, bell, (uint32_t)((deadline - now + 999) / 1000));
+        __atomic_store_n(&ring->consumer_waiting, 0, __ATOMIC_SEQ_CST);
+    }
+}
+
+// Giriş olayı istatistiklerini al
+int bridge_get_input_stats(android_bridge_t* bridge, android_input_stats_t* stats) {
+    if (!bridge || !bridge->input_events || !stats) {
+        return -1;
+    }
+    
+    android_input_ring_t* ring = bridge->input_events;
+    stats->events_injected = ring->events_injected;
+    stats->events_dropped = ring->events_dropped;
+    stats->events_read = ring->events_read;
+    stats->events_dispatched = ring->events_dispatched;
+    stats->events_coalesced = ring->events_coalesced;
+    stats->doorbell_wakeups = ring->doorbell_wakeups;
+    stats->total_latency_us = ring->total_latency_us;
+    stats->max_latency_us = ring->max_latency_us;
     
     return 0;
 }
 
 // Binder IPC sistemini başlat
 int bridge_init_binder() {
-    // Binder servis listesini sıfırla
-    memset(binder_services, 0, sizeof(binder_services));
-    service_count = 0;
-    
     // Binder IPC mekanizmasını başlat
-    // TODO: Gerçek bir uygulamada, burada Binder IPC mekanizması başlatılır
+    if (binder_initialize() != BINDER_SUCCESS) {
+        return -1;
+    }
     
     return 0;
 }
 
 // Binder servisi kaydet
 int bridge_register_service(const char* name, void* service) {
-    if (!name || !service || service_count >= MAX_SERVICES) {
+    if (!name || !service) {
         return -1;
     }
     
-    // Servis zaten kayıtlı mı kontrol et
-    for (uint32_t i = 0; i < service_count; i++) {
-        if (strcmp(binder_services[i].name, name) == 0) {
-            // Servis güncelle
-            binder_services[i].service = service;
-            return 0;
-        }
+    // Aynı adla kayıtlı servis varsa güncellenir
+    if (binder_register_service(name, service) != BINDER_SUCCESS) {
+        return -1;
     }
     
-    // Yeni servis ekle
-    strncpy(binder_services[service_count].name, name, sizeof(binder_services[0].name) - 1);
-    binder_services[service_count].name[sizeof(binder_services[0].name) - 1] = '\0';
-    binder_services[service_count].service = service;
-    service_count++;
-    
     return 0;
 }
 
@@ -492,14 +957,8 @@ void* bridge_get_service(const char* name) {
         return NULL;
     }
     
-    // Servisi ara
-    for (uint32_t i = 0; i < service_count; i++) {
-        if (strcmp(binder_services[i].name, name) == 0) {
-            return binder_services[i].service;
-        }
-    }
-    
-    return NULL;
+    // Servisi ara (ad karma tablosu)
+    return binder_get_service(name);
 }
 
 // Binder işlemi gönder
@@ -508,16 +967,32 @@ int bridge_send_transaction(void* service, uint32_t code, void* data, uint32_t s
         return -1;
     }
     
-    // Binder işlemini gerçekleştir
-    // TODO: Gerçek bir uygulamada, burada Binder işlemi gerçekleştirilir
+    // Binder işlemini gerçekleştir; yanıt beklenir ama kullanılmaz
+    return binder_transact(service, code, data, size, NULL, 0, NULL, 0);
+}
+
+// Tek yönlü Binder işlemi gönder (yanıt beklenmez)
+int bridge_send_oneway_transaction(void* service, uint32_t code, void* data, uint32_t size) {
+    if (!service || (!data && size > 0)) {
+        return -1;
+    }
     
-    return 0;
+    return binder_transact(service, code, data, size, NULL, 0, NULL, BINDER_FLAG_ONEWAY);
 }
 
 // Ses sistemini başlat
 int bridge_init_audio() {
-    // Ses sistemini başlat
-    // TODO: Gerçek bir uygulamada, burada ses sistemi başlatılır
+    // Ses sistemini başlat (kayıtlı ses donanımı yoksa çıkış atılır)
+    if (!audio_mixer_is_initialized()) {
+        if (audio_mixer_init(AUDIO_MIXER_DEFAULT_RATE, AUDIO_DEVICE_AUTO, NULL) != 0) {
+            return -1;
+        }
+    }
+    
+    // Gerçek zamanlı karıştırma iş parçacığı
+    if (audio_mixer_start() != 0) {
+        return -2;
+    }
     
     return 0;
 }
@@ -529,7 +1004,519 @@ int bridge_route_android_audio(android_bridge_t* bridge, uint8_t enable) {
     }
     
     // Ses yönlendirmesini ayarla
-    // TODO: Gerçek bir uygulamada, burada ses yönlendirmesi ayarlanır
+    if (enable && !bridge->audio_stream) {
+        bridge->audio_stream = audio_stream_open("android", ANDROID_AUDIO_SAMPLE_RATE, ANDROID_AUDIO_CHANNELS);
+        if (!bridge->audio_stream) {
+            return -2;
+        }
+    } else if (!enable && bridge->audio_stream) {
+        audio_stream_close(bridge->audio_stream);
+        bridge->audio_stream = NULL;
+    }
+    
+    return 0;
+}
+
+// Android tarafından gelen PCM karelerini karıştırıcıya ilet (engellemez).
+// Halkaya sığan kare sayısı döner.
+int bridge_write_audio(android_bridge_t* bridge, const int16_t* frames, uint32_t frame_count) {
+    if (!bridge || (!frames && frame_count > 0)) {
+        return -1;
+    }
+    
+    // Yönlendirme kapalıyken ses atılır
+    if (!bridge->audio_stream) {
+        return (int)frame_count;
+    }
+    
+    return audio_stream_write(bridge->audio_stream, frames, frame_count);
+}
+
+// Monoton saat (mikrosaniye)
+static uint64_t bridge_now_us() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);
+}
+
+// Yüzey için sayfa hizalı, paylaşımlı tamponlar ayır.
+// Pencere yöneticisi bu belleği doğrudan pencerenin arka tamponu olarak eşler.
+static int bridge_alloc_slots(android_surface_t* surface, uint32_t stride, uint32_t rows) {
+    uint32_t size = stride * rows * sizeof(uint32_t);
+    size = (size + BRIDGE_PAGE_SIZE - 1) & ~(uint32_t)(BRIDGE_PAGE_SIZE - 1);
+    
+    void* pixels[ANDROID_SURFACE_BUFFER_COUNT];
+    for (uint32_t i = 0; i < ANDROID_SURFACE_BUFFER_COUNT; i++) {
+        pixels[i] = mmap(NULL, size, PROT_READ | PROT_WRITE, 
+                         MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        if (pixels[i] == MAP_FAILED) {
+            // Ayrılmış tamponları geri ver, yüzeyin mevcut tamponlarına dokunma
+            for (uint32_t j = 0; j < i; j++) {
+                munmap(pixels[j], size);
+            }
+            return -1;
+        }
+    }
+    
+    for (uint32_t i = 0; i < ANDROID_SURFACE_BUFFER_COUNT; i++) {
+        surface->slots[i].pixels = (uint32_t*)pixels[i];
+        surface->slots[i].state = SURFACE_BUFFER_FREE;
+        surface->slots[i].frame_number = 0;
+        surface->slots[i].queue_time_us = 0;
+        surface->slots[i].width = 0;
+        surface->slots[i].height = 0;
+        surface->slots[i].damage_count = 0;
+        surface->slots[i].full_damage = 1;
+    }
+    
+    // Sayfa yuvarlamasından artan satırlar da kapasiteye dahil
+    surface->buffer_size = size;
+    surface->stride = stride;
+    surface->capacity_height = size / (stride * sizeof(uint32_t));
+    surface->buffer = surface->slots[0].pixels;
+    surface->dequeued_slot = ANDROID_SURFACE_NO_SLOT;
+    surface->queued_slot = ANDROID_SURFACE_NO_SLOT;
+    surface->acquired_slot = ANDROID_SURFACE_NO_SLOT;
     
     return 0;
-} 
\ No newline at end of file
+}
+
+// Yüzey tamponlarını serbest bırak
+static void bridge_free_slots(android_surface_t* surface) {
+    for (uint32_t i = 0; i < ANDROID_SURFACE_BUFFER_COUNT; i++) {
+        if (surface->slots[i].pixels) {
+            munmap(surface->slots[i].pixels, surface->buffer_size);
+            surface->slots[i].pixels = NULL;
+        }
+    }
+    
+    surface->buffer = NULL;
+}
+
+// Büyümeden kalan tamponları serbest bırak (queue_lock tutulurken ya da yok ederken)
+static void bridge_free_retired(android_surface_t* surface) {
+    for (uint32_t i = 0; i < ANDROID_SURFACE_BUFFER_COUNT; i++) {
+        if (surface->retired[i]) {
+            munmap(surface->retired[i], surface->retired_size);
+            surface->retired[i] = NULL;
+        }
+    }
+}
+
+// En son çizilmiş kareyi tutan tampon (kuyruktaki, yoksa ekrandaki)
+static int8_t bridge_latest_slot(android_surface_t* surface) {
+    if (surface->queued_slot != ANDROID_SURFACE_NO_SLOT) {
+        return surface->queued_slot;
+    }
+    
+    return surface->acquired_slot;
+}
+
+// Bekleyen boyut isteğini uygula (queue_lock tutulurken çağrılır).
+// Görünür boyut değiştiyse 1, değişmediyse 0, bellek yetersizse -1 döner.
+static int bridge_apply_resize(android_surface_t* surface, uint8_t allow_realloc) {
+    if (!surface->resize_pending) {
+        return 0;
+    }
+    
+    // Android tarafı çizerken tamponlara dokunulmaz; kare kuyruğa eklenince uygulanır
+    if (surface->dequeued_slot != ANDROID_SURFACE_NO_SLOT) {
+        return 0;
+    }
+    
+    uint32_t width = surface->pending_width;
+    uint32_t height = surface->pending_height;
+    uint32_t old_width = surface->width;
+    uint32_t old_height = surface->height;
+    
+    if (width <= surface->stride && height <= surface->capacity_height) {
+        // Küçülme ve ayrılmış alan içindeki büyüme tamponları yeniden kullanır
+        bridge_resize_in_place(surface, width, height);
+        surface->resize_pending = 0;
+    } else if (allow_realloc) {
+        surface->resize_pending = 0;
+        if (bridge_grow_slots(surface, width, height) != 0) {
+            return -1;
+        }
+    } else {
+        // Sürükleme sürüyor: ayrılmış alanın izin verdiği kadar büyü, kalanı sonra
+        bridge_resize_in_place(surface,
+                               (width < surface->stride) ? width : surface->stride,
+                               (height < surface->capacity_height) ? height : surface->capacity_height);
+    }
+    
+    if (surface->width == old_width && surface->height == old_height) {
+        return 0;
+    }
+    
+    surface->dirty = 1;
+    return 1;
+}
+
+// Mevcut tamponlarda boyut değiştir. Satır aralığı sabit olduğundan satırlar
+// yerinde kalır; son kare ekranda değilse yalnızca yeni açılan alanı temizlenir.
+// Ekrandaki tampon pencere tarafından okunurken yazılmaz: pencere o karenin
+// çizildiği boyutu gösterir, açılan alan bir sonraki karede gelir.
+static void bridge_resize_in_place(android_surface_t* surface, uint32_t width, uint32_t height) {
+    if (width == surface->width && height == surface->height) {
+        return;
+    }
+    
+    int8_t latest = bridge_latest_slot(surface);
+    uint32_t* pixels = NULL;
+    if (latest == ANDROID_SURFACE_NO_SLOT) {
+        pixels = surface->buffer;
+    } else if (surface->slots[latest].state != SURFACE_BUFFER_ACQUIRED) {
+        pixels = surface->slots[latest].pixels;
+        surface->slots[latest].width = width;
+        surface->slots[latest].height = height;
+    }
+    
+    if (pixels) {
+        uint32_t stride = surface->stride;
+        uint32_t kept_rows = (height < surface->height) ? height : surface->height;
+        
+        // Mevcut satırların sağında açılan sütunlar
+        if (width > surface->width) {
+            for (uint32_t y = 0; y < kept_rows; y++) {
+                memset(pixels + (size_t)y * stride + surface->width, 0,
+                       (width - surface->width) * sizeof(uint32_t));
+            }
+        }
+        
+        // Altta açılan satırlar
+        for (uint32_t y = surface->height; y < height; y++) {
+            memset(pixels + (size_t)y * stride, 0, width * sizeof(uint32_t));
+        }
+    }
+    
+    // Diğer tamponlarda açılan alan eski içerik taşır; Android tarafı
+    // bunları aldığında tamamını yeniden çizsin (yaş 0)
+    for (uint32_t i = 0; i < ANDROID_SURFACE_BUFFER_COUNT; i++) {
+        if (surface->slots[i].pixels != pixels) {
+            surface->slots[i].frame_number = 0;
+        }
+    }
+    
+    surface->width = width;
+    surface->height = height;
+    surface->stats.resizes_in_place++;
+}
+
+// Ayrılmış alanı aşan büyüme: yeni tamponları pay bırakarak ayır ve son kareyi
+// satır satır kopyala. Yeni sayfalar sıfırlanmış geldiğinden açılan alan ayrıca
+// temizlenmez. Pencere eski tamponlardan birini gösteriyor olabilir (bu işlev
+// üretici iş parçacığında da çalışır); onlar pencere yeni bir tampon alana dek
+// saklanır.
+static int bridge_grow_slots(android_surface_t* surface, uint32_t width, uint32_t height) {
+    // Sonraki küçük büyümeler yeniden ayırma gerektirmesin diye %25 pay bırak
+    uint32_t stride = (width + width / 4 + 15) & ~15u;
+    uint32_t rows = height + height / 4;
+    
+    android_surface_t old = *surface;
+    int8_t latest = bridge_latest_slot(surface);
+    const uint32_t* old_pixels = (latest != ANDROID_SURFACE_NO_SLOT) ? surface->slots[latest].pixels : surface->buffer;
+    android_surface_buffer_t latest_slot = { 0 };
+    if (latest != ANDROID_SURFACE_NO_SLOT) {
+        latest_slot = surface->slots[latest];
+    }
+    
+    if (bridge_alloc_slots(surface, stride, rows) != 0) {
+        return -1;
+    }
+    
+    // Eski verileri kopyala (daha küçük boyutu kullan; kare daha küçük
+    // çizildiyse yalnızca çizildiği alan)
+    uint32_t copy_width = (latest != ANDROID_SURFACE_NO_SLOT) ? latest_slot.width : old.width;
+    uint32_t copy_height = (latest != ANDROID_SURFACE_NO_SLOT) ? latest_slot.height : old.height;
+    if (copy_width > width) copy_width = width;
+    if (copy_height > height) copy_height = height;
+    
+    for (uint32_t y = 0; y < copy_height; y++) {
+        memcpy(surface->slots[0].pixels + (size_t)y * stride,
+               old_pixels + (size_t)y * old.stride,
+               copy_width * sizeof(uint32_t));
+    }
+    if (copy_width && copy_height) {
+        surface->stats.buffer_copies++;
+    }
+    
+    // Son kare durumunu korur: kuyruktaki kare gösterilmeyi bekler (gecikmesi
+    // ve sayımı kaybolmaz), ekrandaki kare yeni tamponda gösterilmeye devam eder.
+    // Kare yeni tampona taşındığından pencere tamamını yeniden çizer.
+    if (latest != ANDROID_SURFACE_NO_SLOT) {
+        surface->slots[0].state = latest_slot.state;
+        surface->slots[0].width = copy_width;
+        surface->slots[0].height = copy_height;
+        surface->slots[0].frame_number = latest_slot.frame_number;
+        surface->slots[0].queue_time_us = latest_slot.queue_time_us;
+        surface->slots[0].damage_count = 0;
+        surface->slots[0].full_damage = 1;
+        if (latest_slot.state == SURFACE_BUFFER_QUEUED) {
+            surface->queued_slot = 0;
+        } else {
+            surface->acquired_slot = 0;
+        }
+    }
+    
+    // Önceki büyümeden kalanlar hâlâ bekliyorsa pencere o zamandan beri tampon
+    // almamıştır, yani şimdiki eski tamponları hiç görmemiştir: hemen bırakılır.
+    // Aksi halde pencere bir sonraki bridge_acquire_buffer'a dek onları okuyabilir.
+    if (surface->retired[0]) {
+        bridge_free_slots(&old);
+    } else {
+        for (uint32_t i = 0; i < ANDROID_SURFACE_BUFFER_COUNT; i++) {
+            surface->retired[i] = old.slots[i].pixels;
+        }
+        surface->retired_size = old.buffer_size;
+    }
+    
+    surface->width = width;
+    surface->height = height;
+    surface->stats.resize_reallocations++;
+    
+    return 0;
+}
+
+// Yüzey değişti geri çağırması
+static void bridge_notify_surface_changed(android_surface_t* surface) {
+    for (uint32_t i = 0; i < bridge_count; i++) {
+        if (bridges[i]->surface == surface && bridges[i]->on_surface_changed) {
+            bridges[i]->on_surface_changed(surface);
+            break;
+        }
+    }
+}
+
+// Gösterilmeden düşürülen karenin hasarını yeni kareye ekle
+static void bridge_merge_damage(android_surface_buffer_t* dst, const android_surface_buffer_t* src) {
+    if (dst->full_damage) {
+        return;
+    }
+    
+    if (src->full_damage || dst->damage_count + src->damage_count > ANDROID_SURFACE_MAX_DAMAGE) {
+        dst->full_damage = 1;
+        dst->damage_count = 0;
+        return;
+    }
+    
+    for (uint8_t i = 0; i < src->damage_count; i++) {
+        dst->damage[dst->damage_count++] = src->damage[i];
+    }
+}
+
+// Pencere çizim işleyicisi: en yeni kareyi pencerenin arka tamponu yap
+static uint8_t bridge_window_paint(gui_window_t* window) {
+    android_bridge_t* bridge = (android_bridge_t*)window->user_data;
+    if (!bridge || !bridge->surface) {
+        return 0;
+    }
+    
+    android_surface_t* surface = bridge->surface;
+    
+    // Üretici kareyi kuyruğa eklerken ve boyut değiştirirken aynı alanlara
+    // yazar; sayaçlar, kirli bayrağı ve tampon bilgisi tek kilit altında okunur
+    pthread_mutex_lock(&surface->queue_lock);
+    uint64_t presented = surface->stats.frames_presented;
+    uint8_t invalidated = surface->dirty;
+    
+    // Kopyalama yok, yalnızca işaretçi değişir. Kare çizildikten sonra yüzey
+    // büyüdüyse yalnızca karenin çizildiği alan gösterilir.
+    window->backing_store = bridge_acquire_locked(surface);
+    window->backing_stride = surface->stride;
+    window->backing_width = surface->width;
+    window->backing_height = surface->height;
+    if (surface->acquired_slot != ANDROID_SURFACE_NO_SLOT) {
+        const android_surface_buffer_t* shown = &surface->slots[surface->acquired_slot];
+        if (shown->width < window->backing_width) window->backing_width = shown->width;
+        if (shown->height < window->backing_height) window->backing_height = shown->height;
+    }
+    
+    // Pencereye yalnızca değişen bölgeleri bildir
+    window->backing_damage_count = 0;
+    window->backing_full_damage = 0;
+    
+    if (surface->stats.frames_presented != presented) {
+        const android_surface_buffer_t* slot = &surface->slots[surface->acquired_slot];
+        
+        window->backing_full_damage = slot->full_damage;
+        for (uint8_t i = 0; i < slot->damage_count; i++) {
+            window->backing_damage[i].x = (uint16_t)slot->damage[i].x;
+            window->backing_damage[i].y = (uint16_t)slot->damage[i].y;
+            window->backing_damage[i].width = (uint16_t)slot->damage[i].width;
+            window->backing_damage[i].height = (uint16_t)slot->damage[i].height;
+        }
+        window->backing_damage_count = slot->damage_count;
+    } else if (invalidated) {
+        // Yeni kare yok ama yüzey geçersiz kılındı: tamamını yeniden çiz
+        window->backing_full_damage = 1;
+        surface->dirty = 0;
+    }
+    
+    // Yeni kare gösterildiyse FPS değerini güncelle
+    if (surface->stats.frames_presented != presented) {
+        uint64_t now = bridge_now_us();
+        if (bridge->last_frame_time && now > bridge->last_frame_time) {
+            bridge->fps = (uint32_t)(1000000ULL / (now - bridge->last_frame_time));
+        }
+        bridge->last_frame_time = now;
+    }
+    
+    pthread_mutex_unlock(&surface->queue_lock);
+    
+    return 1;
+}
+
+// Üretici servisi işleyicisi (binder döngü iş parçacığı). Kilit/kilit açma
+// köprünün kendi yolundan geçer; hasar bridge_unlock_surface ile kareye eklenir.
+static int bridge_surface_transact(void* service, uint32_t code, const binder_parcel_t* data, binder_parcel_t* reply) {
+    android_surface_t* surface = (android_surface_t*)service;
+    
+    switch (code) {
+        case ANDROID_SURFACE_TRANSACT_LOCK: {
+            void* buffer;
+            if (bridge_lock_surface(surface, &buffer) != 0) {
+                return -2;
+            }
+            
+            android_surface_lock_reply_t out;
+            pthread_mutex_lock(&surface->queue_lock);
+            out.slot = surface->dequeued_slot;
+            out.buffer_age = surface->buffer_age;
+            out.width = surface->width;
+            out.height = surface->height;
+            out.stride = surface->stride;
+            pthread_mutex_unlock(&surface->queue_lock);
+            
+            return binder_parcel_write(reply, &out, sizeof(out));
+        }
+        
+        case ANDROID_SURFACE_TRANSACT_UNLOCK: {
+            uint32_t count;
+            if (data->size < sizeof(count)) {
+                return -1;
+            }
+            memcpy(&count, data->data, sizeof(count));
+            if (count > (data->size - sizeof(count)) / sizeof(android_rect_t)) {
+                return -1;
+            }
+            
+            // Sınırı aşan liste zaten tüm tampon sayılır; yerel kopyaya sığanı yeter
+            android_rect_t rects[ANDROID_SURFACE_MAX_DAMAGE + 1];
+            if (count > ANDROID_SURFACE_MAX_DAMAGE + 1) {
+                count = ANDROID_SURFACE_MAX_DAMAGE + 1;
+            }
+            memcpy(rects, data->data + sizeof(count), count * sizeof(android_rect_t));
+            
+            return bridge_unlock_surface(surface, count ? rects : NULL, count);
+        }
+        
+        default:
+            return -1;
+    }
+}
+
+// Pencere boyutlandırıldı: yüzeye ilet (sürükleme sürerken yeniden ayırma ertelenir)
+static void bridge_window_resize(gui_window_t* window, uint16_t width, uint16_t height) {
+    android_bridge_t* bridge = (android_bridge_t*)window->user_data;
+    if (bridge && bridge->surface) {
+        bridge_resize_surface(bridge->surface, width, height);
+    }
+}
+
+// Boyutlandırma sürüklemesi başladı / bitti
+static void bridge_window_resize_drag(gui_window_t* window, uint8_t active) {
+    android_bridge_t* bridge = (android_bridge_t*)window->user_data;
+    if (!bridge || !bridge->surface) {
+        return;
+    }
+    
+    if (active) {
+        bridge_begin_resize(bridge->surface);
+    } else {
+        bridge_end_resize(bridge->surface);
+    }
+}
+
+// Köprünün bağlı olduğu pencereden ayrıl
+static void bridge_detach_window(android_bridge_t* bridge) {
+    gui_window_t* window = bridge->window;
+    if (!window) {
+        return;
+    }
+    
+    // Bağlanmadan önceki işleyiciyi geri yükle (pencere bu arada başka
+    // işleyiciye geçtiyse ona dokunma)
+    window->backing_store = NULL;
+    if (window->on_paint == bridge_window_paint && window->user_data == bridge) {
+        window->on_paint = bridge->window_on_paint;
+        window->user_data = bridge->window_user_data;
+    }
+    if (window->on_resize == bridge_window_resize) {
+        window->on_resize = bridge->window_on_resize;
+    }
+    if (window->on_resize_drag == bridge_window_resize_drag) {
+        window->on_resize_drag = bridge->window_on_resize_drag;
+    }
+    bridge->window_on_paint = NULL;
+    bridge->window_user_data = NULL;
+    bridge->window_on_resize = NULL;
+    bridge->window_on_resize_drag = NULL;
+    
+    // Ekrandaki tampon artık Android tarafına geri verilebilir
+    if (bridge->surface) {
+        bridge_release_buffer(bridge->surface);
+    }
+}
+
+// Olayı giriş halkasına yaz (pencere yöneticisi tarafı, tek üretici)
+static int bridge_input_push(android_bridge_t* bridge, const android_input_event_t* event) {
+    android_input_ring_t* ring = bridge->input_events;
+    if (!ring) {
+        return -2;
+    }
+    
+    uint32_t tail = ring->tail;
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    
+    // Halka dolu: tüketici geride kaldı
+    if (tail - head >= ANDROID_INPUT_RING_SIZE) {
+        ring->events_dropped++;
+        
+        // Hareket olayları sonrakilerle zaten geçersiz kalır, hata sayılmaz
+        return (event->action == ANDROID_INPUT_ACTION_MOVE) ? 0 : -3;
+    }
+    
+    android_input_event_t* slot = &ring->events[tail & BRIDGE_INPUT_RING_MASK];
+    *slot = *event;
+    slot->timestamp_us = bridge_now_us();
+    slot->sample_count = 1;
+    
+    __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_SEQ_CST);
+    ring->events_injected++;
+    bridge->input_event_count++;
+    
+    // Kapı zilini çal; sistem çağrısı yalnızca tüketici uyuyorsa yapılır
+    __atomic_add_fetch(&ring->doorbell, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&ring->consumer_waiting, __ATOMIC_SEQ_CST)) {
+        bridge_futex_wake(&ring->doorbell);
+        ring->doorbell_wakeups++;
+    }
+    
+    return 0;
+}
+
+// Kapı zili değeri değişene kadar uyu (halka süreçler arası paylaşıldığından özel olmayan futex)
+static void bridge_futex_wait(volatile uint32_t* word, uint32_t expected, uint32_t timeout_ms) {
+    struct timespec timeout;
+    timeout.tv_sec = timeout_ms / 1000;
+    timeout.tv_nsec = (long)(timeout_ms % 1000) * 1000000L;
+    
+    syscall(SYS_futex, word, FUTEX_WAIT, expected, &timeout, NULL, 0);
+}
+
+// Kapı zilinde bekleyen tüketiciyi uyandır
+static void bridge_futex_wake(volatile uint32_t* word) {
+    syscall(SYS_futex, word, FUTEX_WAKE, 1, NULL, NULL, 0);
+}
@@ -0,0 +1,878 @@
+#include "../../include/android/container_checkpoint.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE        0x100000
+#endif
+
+#define CHECKPOINT_MAGIC           0x504B434B  // "KCKP"
+#define CHECKPOINT_JOURNAL_MAGIC   0x4A4B434B  // "KCKJ"
+#define CHECKPOINT_VERSION         1
+
+// Kayıtlı bellek bölgesi. Tablo hata yakalayıcıdan kilitsiz okunduğu için
+// global tutulur; start == 0 boş yuva demektir.
+typedef struct {
+    uintptr_t start;
+    uintptr_t end;
+    uintptr_t released;            // Kaldırılmış bölgenin başı (yuva yeniden kullanılana dek)
+    uint8_t* dirty;                // Sayfa başına kirli bayrağı
+    uint8_t tracking;              // Yazma koruması etkin mi
+    uint64_t image_offset;         // memory.img içindeki konum
+    container_checkpoint_t* owner;
+} checkpoint_region_t;
+
+// İzlenen açık dosya
+typedef struct {
+    int fd;
+    int flags;
+    char path[OVERLAY_PATH_MAX];
+} checkpoint_file_t;
+
+// İmaj başlığı ve kayıtları (checkpoint.img)
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t generation;
+    uint32_t region_count;
+    uint32_t file_count;
+} checkpoint_header_t;
+
+typedef struct {
+    uint64_t address;
+    uint64_t size;
+    uint64_t offset;
+} checkpoint_region_record_t;
+
+typedef struct {
+    int32_t fd;
+    int32_t flags;
+    int64_t offset;
+    char path[OVERLAY_PATH_MAX];
+} checkpoint_file_record_t;
+
+// Kirli sayfa günlüğü (memory.journal): başlık, ardından her sayfa dizisi
+// için konum/boyut kaydı ve sayfaların kendisi
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t generation;           // Günlüğün ait olduğu kayıt
+    uint64_t pages;
+} checkpoint_journal_header_t;
+
+typedef struct {
+    uint64_t offset;               // memory.img içindeki konum
+    uint64_t size;
+} checkpoint_journal_record_t;
+
+// Denetim noktası yapısı
+struct container_checkpoint {
+    char image_dir[OVERLAY_PATH_MAX];
+    pthread_mutex_t lock;
+    checkpoint_file_t* files;
+    uint32_t file_count;
+    uint32_t file_capacity;
+    uint64_t image_size;           // Bölgelere ayrılan toplam imaj alanı
+    uint64_t generation;
+    uint64_t checkpoints;
+    uint64_t last_pages_written;
+    uint64_t pages_written;
+    uint64_t last_save_us;
+    uint64_t last_restore_us;
+};
+
+// Global bölge tablosu ve hata yakalayıcı
+static checkpoint_region_t checkpoint_regions[CHECKPOINT_MAX_REGIONS];
+static pthread_mutex_t checkpoint_regions_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct sigaction checkpoint_previous_action;
+static uint8_t checkpoint_handler_installed = 0;
+static uint64_t checkpoint_dirty_faults = 0;
+static uint32_t checkpoint_handlers_active = 0;    // Tabloyu okuyan yakalayıcı sayısı
+static __thread uintptr_t checkpoint_retry_address = 0;
+
+// Yardımcı fonksiyonlar
+static void checkpoint_fault_handler(int signal_number, siginfo_t* info, void* context);
+static int checkpoint_install_handler(void);
+static checkpoint_region_t* checkpoint_find_region(container_checkpoint_t* checkpoint, uintptr_t start);
+static checkpoint_region_t* checkpoint_claim_region(container_checkpoint_t* checkpoint, uintptr_t start, size_t size,
+                                                    uint64_t image_offset);
+static void checkpoint_release_region(checkpoint_region_t* region);
+static int checkpoint_write_pages(int fd, checkpoint_region_t* region, uint64_t* pages);
+static int checkpoint_write_full(int fd, const void* data, size_t size);
+static int checkpoint_replay_journal(container_checkpoint_t* checkpoint, uint64_t generation);
+static int checkpoint_write_header(container_checkpoint_t* checkpoint);
+static int checkpoint_append_file(container_checkpoint_t* checkpoint, int fd, const char* path, int flags);
+static uint64_t checkpoint_now_us(void);
+
+// Denetim noktası oluştur
+container_checkpoint_t* checkpoint_create(const char* image_dir) {
+    if (!image_dir || strlen(image_dir) >= OVERLAY_PATH_MAX) {
+        return NULL;
+    }
+    
+    container_checkpoint_t* checkpoint = (container_checkpoint_t*)calloc(1, sizeof(container_checkpoint_t));
+    if (!checkpoint) {
+        return NULL;
+    }
+    
+    strcpy(checkpoint->image_dir, image_dir);
+    pthread_mutex_init(&checkpoint->lock, NULL);
+    
+    return checkpoint;
+}
+
+// Denetim noktasını yok et (imaj diskte kalır)
+void checkpoint_destroy(container_checkpoint_t* checkpoint) {
+    if (!checkpoint) {
+        return;
+    }
+    
+    pthread_mutex_lock(&checkpoint_regions_lock);
+    for (uint32_t i = 0; i < CHECKPOINT_MAX_REGIONS; i++) {
+        checkpoint_region_t* region = &checkpoint_regions[i];
+        if (region->start && region->owner == checkpoint) {
+            checkpoint_release_region(region);
+        }
+    }
+    pthread_mutex_unlock(&checkpoint_regions_lock);
+    
+    free(checkpoint->files);
+    pthread_mutex_destroy(&checkpoint->lock);
+    free(checkpoint);
+}
+
+// Bellek bölgesi kaydet; ilk kayıtta tüm sayfaları yazılır
+int checkpoint_add_region(container_checkpoint_t* checkpoint, void* address, size_t size) {
+    uintptr_t start = (uintptr_t)address;
+    
+    if (!checkpoint || !address || size == 0 ||
+        (start % CHECKPOINT_PAGE_SIZE) != 0 || (size % CHECKPOINT_PAGE_SIZE) != 0) {
+        return CHECKPOINT_ERROR_INVALID;
+    }
+    
+    if (checkpoint_install_handler() != 0) {
+        return CHECKPOINT_ERROR_IO;
+    }
+    
+    pthread_mutex_lock(&checkpoint->lock);
+    pthread_mutex_lock(&checkpoint_regions_lock);
+    
+    checkpoint_region_t* region = checkpoint_claim_region(checkpoint, start, size, checkpoint->image_size);
+    if (region) {
+        memset(region->dirty, 1, size / CHECKPOINT_PAGE_SIZE);
+        checkpoint->image_size += size;
+    }
+    
+    pthread_mutex_unlock(&checkpoint_regions_lock);
+    pthread_mutex_unlock(&checkpoint->lock);
+    
+    return region ? 0 : CHECKPOINT_ERROR_NO_MEMORY;
+}
+
+// Bellek bölgesi kaydını kaldır
+int checkpoint_remove_region(container_checkpoint_t* checkpoint, void* address) {
+    if (!checkpoint || !address) {
+        return CHECKPOINT_ERROR_INVALID;
+    }
+    
+    pthread_mutex_lock(&checkpoint_regions_lock);
+    
+    checkpoint_region_t* region = checkpoint_find_region(checkpoint, (uintptr_t)address);
+    if (!region) {
+        pthread_mutex_unlock(&checkpoint_regions_lock);
+        return CHECKPOINT_ERROR_INVALID;
+    }
+    
+    checkpoint_release_region(region);
+    
+    pthread_mutex_unlock(&checkpoint_regions_lock);
+    
+    return 0;
+}
+
+// Açık dosyayı izlemeye al
+int checkpoint_track_file(container_checkpoint_t* checkpoint, int fd, const char* path, int flags) {
+    if (!checkpoint || fd < 0 || !path || strlen(path) >= OVERLAY_PATH_MAX) {
+        return CHECKPOINT_ERROR_INVALID;
+    }
+    
+    pthread_mutex_lock(&checkpoint->lock);
+    int result = checkpoint_append_file(checkpoint, fd, path, flags);
+    pthread_mutex_unlock(&checkpoint->lock);
+    
+    return result;
+}
+
+// Dosyayı izlemeden çıkar
+int checkpoint_untrack_file(container_checkpoint_t* checkpoint, int fd) {
+    if (!checkpoint) {
+        return CHECKPOINT_ERROR_INVALID;
+    }
+    
+    pthread_mutex_lock(&checkpoint->lock);
+    
+    for (uint32_t i = 0; i < checkpoint->file_count; i++) {
+        if (checkpoint->files[i].fd == fd) {
+            checkpoint->files[i] = checkpoint->files[--checkpoint->file_count];
+            pthread_mutex_unlock(&checkpoint->lock);
+            return 0;
+        }
+    }
+    
+    pthread_mutex_unlock(&checkpoint->lock);
+    
+    return CHECKPOINT_ERROR_INVALID;
+}
+
+// Kayıt al: kirli sayfalar önce günlüğe yazılır, başlık yerine taşınınca kayıt
+// tamamlanmış sayılır ve günlük memory.img'ye uygulanır. Arada kesilen kayıt
+// önceki imajı bozmaz. Ardından bölgeler yeniden korunur
+int checkpoint_save(container_checkpoint_t* checkpoint) {
+    char path[OVERLAY_PATH_MAX + 32];
+    checkpoint_journal_header_t journal;
+    uint64_t started = checkpoint_now_us();
+    uint64_t pages = 0;
+    
+    if (!checkpoint) {
+        return CHECKPOINT_ERROR_INVALID;
+    }
+    
+    if (mkdir(checkpoint->image_dir, 0700) != 0 && errno != EEXIST) {
+        return CHECKPOINT_ERROR_IO;
+    }
+    
+    pthread_mutex_lock(&checkpoint->lock);
+    
+    // Önceki kayıttan uygulanmamış günlük kaldıysa önce onu bitir
+    if (checkpoint_replay_journal(checkpoint, checkpoint->generation) != 0) {
+        pthread_mutex_unlock(&checkpoint->lock);
+        return CHECKPOINT_ERROR_IO;
+    }
+    
+    snprintf(path, sizeof(path), "%s/memory.journal", checkpoint->image_dir);
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0) {
+        pthread_mutex_unlock(&checkpoint->lock);
+        return CHECKPOINT_ERROR_IO;
+    }
+    
+    memset(&journal, 0, sizeof(journal));
+    journal.magic = CHECKPOINT_JOURNAL_MAGIC;
+    journal.version = CHECKPOINT_VERSION;
+    journal.generation = checkpoint->generation + 1;
+    int result = checkpoint_write_full(fd, &journal, sizeof(journal));
+    
+    pthread_mutex_lock(&checkpoint_regions_lock);
+    for (uint32_t i = 0; i < CHECKPOINT_MAX_REGIONS && result == 0; i++) {
+        checkpoint_region_t* region = &checkpoint_regions[i];
+        if (region->start && region->owner == checkpoint) {
+            result = checkpoint_write_pages(fd, region, &pages);
+        }
+    }
+    pthread_mutex_unlock(&checkpoint_regions_lock);
+    
+    // Günlük diske inmeden başlık değişmez
+    journal.pages = pages;
+    if (result == 0 && (pwrite(fd, &journal, sizeof(journal), 0) != (ssize_t)sizeof(journal) || fsync(fd) != 0)) {
+        result = CHECKPOINT_ERROR_IO;
+    }
+    close(fd);
+    
+    if (result == 0) {
+        checkpoint->generation++;
+        result = checkpoint_write_header(checkpoint);
+        if (result != 0) {
+            checkpoint->generation--;
+        }
+    }
+    
+    // Tamamlanmamış kayıt: kirli bayraklar korunur, sonraki kayıt yeniden dener
+    if (result != 0) {
+        unlink(path);
+        pthread_mutex_unlock(&checkpoint->lock);
+        return CHECKPOINT_ERROR_IO;
+    }
+    
+    pthread_mutex_lock(&checkpoint_regions_lock);
+    
+    for (uint32_t i = 0; i < CHECKPOINT_MAX_REGIONS; i++) {
+        checkpoint_region_t* region = &checkpoint_regions[i];
+        if (!region->start || region->owner != checkpoint) {
+            continue;
+        }
+        
+        // Sonraki yazmaları yakalamak için korumayı yeniden kur
+        memset(region->dirty, 0, (region->end - region->start) / CHECKPOINT_PAGE_SIZE);
+        if (mprotect((void*)region->start, region->end - region->start, PROT_READ) == 0) {
+            region->tracking = 1;
+        } else {
+            // Koruma kurulamazsa bir sonraki kayıt bölgenin tamamını yazar
+            memset(region->dirty, 1, (region->end - region->start) / CHECKPOINT_PAGE_SIZE);
+            region->tracking = 0;
+        }
+    }
+    
+    pthread_mutex_unlock(&checkpoint_regions_lock);
+    
+    // Kayıt tamamlandı; uygulama burada kesilirse günlük geri yüklemede yeniden uygulanır
+    result = checkpoint_replay_journal(checkpoint, checkpoint->generation);
+    
+    checkpoint->checkpoints++;
+    checkpoint->last_pages_written = pages;
+    checkpoint->pages_written += pages;
+    checkpoint->last_save_us = checkpoint_now_us() - started;
+    
+    pthread_mutex_unlock(&checkpoint->lock);
+    
+    return result;
+}
+
+// İmajdan geri yükle: bölgeler imaja özel olarak eşlenir, dosyalar yeniden açılır
+int checkpoint_restore(container_checkpoint_t* checkpoint, overlay_t* filesystem) {
+    char path[OVERLAY_PATH_MAX + 32];
+    checkpoint_header_t header;
+    uint64_t started = checkpoint_now_us();
+    
+    if (!checkpoint) {
+        return CHECKPOINT_ERROR_INVALID;
+    }
+    
+    if (checkpoint_install_handler() != 0) {
+        return CHECKPOINT_ERROR_IO;
+    }
+    
+    pthread_mutex_lock(&checkpoint->lock);
+    
+    snprintf(path, sizeof(path), "%s/checkpoint.img", checkpoint->image_dir);
+    FILE* image = fopen(path, "rb");
+    if (!image) {
+        pthread_mutex_unlock(&checkpoint->lock);
+        return CHECKPOINT_ERROR_IO;
+    }
+    
+    if (fread(&header, sizeof(header), 1, image) != 1 || header.magic != CHECKPOINT_MAGIC ||
+        header.version != CHECKPOINT_VERSION || header.region_count > CHECKPOINT_MAX_REGIONS ||
+        header.file_count > CHECKPOINT_MAX_FILES) {
+        fclose(image);
+        pthread_mutex_unlock(&checkpoint->lock);
+        return CHECKPOINT_ERROR_FORMAT;
+    }
+    
+    // Başlığı yazılmış ama imaja uygulanmamış kayıt varsa tamamla
+    if (checkpoint_replay_journal(checkpoint, header.generation) != 0) {
+        fclose(image);
+        pthread_mutex_unlock(&checkpoint->lock);
+        return CHECKPOINT_ERROR_IO;
+    }
+    
+    snprintf(path, sizeof(path), "%s/memory.img", checkpoint->image_dir);
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        fclose(image);
+        pthread_mutex_unlock(&checkpoint->lock);
+        return CHECKPOINT_ERROR_IO;
+    }
+    
+    int result = 0;
+    
+    // Bellek bölgeleri: sayfalar ilk erişimde imajdan okunur
+    pthread_mutex_lock(&checkpoint_regions_lock);
+    for (uint32_t i = 0; i < header.region_count && result == 0; i++) {
+        checkpoint_region_record_t record;
+        if (fread(&record, sizeof(record), 1, image) != 1) {
+            result = CHECKPOINT_ERROR_FORMAT;
+            break;
+        }
+        
+        checkpoint_region_t* region = checkpoint_find_region(checkpoint, (uintptr_t)record.address);
+        if (region && region->end - region->start != record.size) {
+            result = CHECKPOINT_ERROR_FORMAT;
+            break;
+        }
+        
+        // Kayıtlı bölgenin üzerine, yoksa boş adrese eşle
+        int flags = MAP_PRIVATE | (region ? MAP_FIXED : MAP_FIXED_NOREPLACE);
+        void* mapped = mmap((void*)(uintptr_t)record.address, record.size, PROT_READ, flags, fd, (off_t)record.offset);
+        if (mapped == MAP_FAILED || mapped != (void*)(uintptr_t)record.address) {
+            if (mapped != MAP_FAILED) {
+                munmap(mapped, record.size);
+            }
+            result = CHECKPOINT_ERROR_IO;
+            break;
+        }
+        
+        if (!region) {
+            region = checkpoint_claim_region(checkpoint, (uintptr_t)record.address, record.size, record.offset);
+            if (!region) {
+                munmap(mapped, record.size);
+                result = CHECKPOINT_ERROR_NO_MEMORY;
+                break;
+            }
+            if (record.offset + record.size > checkpoint->image_size) {
+                checkpoint->image_size = record.offset + record.size;
+            }
+        }
+        
+        region->image_offset = record.offset;
+        memset(region->dirty, 0, record.size / CHECKPOINT_PAGE_SIZE);
+        region->tracking = 1;
+    }
+    pthread_mutex_unlock(&checkpoint_regions_lock);
+    close(fd);
+    
+    // Dosya kayıtlarını oku; imaj kapanmadan yeniden açılırlarsa imajın
+    // tanımlayıcısı kapalı bir dosyanın numarasını almış olabilir
+    checkpoint_file_record_t* records = NULL;
+    if (result == 0 && header.file_count > 0) {
+        records = (checkpoint_file_record_t*)malloc(sizeof(checkpoint_file_record_t) * header.file_count);
+        if (!records) {
+            result = CHECKPOINT_ERROR_NO_MEMORY;
+        } else if (fread(records, sizeof(checkpoint_file_record_t), header.file_count, image) != header.file_count) {
+            result = CHECKPOINT_ERROR_FORMAT;
+        }
+    }
+    
+    fclose(image);
+    
+    // Açık dosyalar: hâlâ açık olanlar yalnızca konumlanır
+    if (result == 0) {
+        checkpoint->file_count = 0;
+    }
+    for (uint32_t i = 0; i < header.file_count && result == 0; i++) {
+        checkpoint_file_record_t record = records[i];
+        record.path[OVERLAY_PATH_MAX - 1] = '\0';
+        
+        if (fcntl(record.fd, F_GETFD) == -1) {
+            int flags = record.flags & ~(O_CREAT | O_TRUNC | O_EXCL);
+            int opened = filesystem ? overlay_open(filesystem, record.path, flags, 0) : open(record.path, flags);
+            if (opened < 0) {
+                result = CHECKPOINT_ERROR_IO;
+                break;
+            }
+            if (opened != record.fd) {
+                if (dup2(opened, record.fd) < 0) {
+                    close(opened);
+                    result = CHECKPOINT_ERROR_IO;
+                    break;
+                }
+                close(opened);
+            }
+        }
+        
+        lseek(record.fd, (off_t)record.offset, SEEK_SET);
+        result = checkpoint_append_file(checkpoint, record.fd, record.path, record.flags);
+    }
+    
+    free(records);
+    
+    if (result == 0) {
+        checkpoint->generation = header.generation;
+        checkpoint->last_restore_us = checkpoint_now_us() - started;
+    }
+    
+    pthread_mutex_unlock(&checkpoint->lock);
+    
+    return result;
+}
+
+// İstatistikleri al
+int checkpoint_get_stats(container_checkpoint_t* checkpoint, checkpoint_stats_t* stats) {
+    if (!checkpoint || !stats) {
+        return CHECKPOINT_ERROR_INVALID;
+    }
+    
+    memset(stats, 0, sizeof(checkpoint_stats_t));
+    
+    pthread_mutex_lock(&checkpoint_regions_lock);
+    for (uint32_t i = 0; i < CHECKPOINT_MAX_REGIONS; i++) {
+        if (checkpoint_regions[i].start && checkpoint_regions[i].owner == checkpoint) {
+            stats->regions++;
+        }
+    }
+    pthread_mutex_unlock(&checkpoint_regions_lock);
+    
+    pthread_mutex_lock(&checkpoint->lock);
+    stats->files = checkpoint->file_count;
+    stats->checkpoints = checkpoint->checkpoints;
+    stats->generation = checkpoint->generation;
+    stats->last_pages_written = checkpoint->last_pages_written;
+    stats->pages_written = checkpoint->pages_written;
+    stats->last_save_us = checkpoint->last_save_us;
+    stats->last_restore_us = checkpoint->last_restore_us;
+    pthread_mutex_unlock(&checkpoint->lock);
+    
+    stats->dirty_faults = __atomic_load_n(&checkpoint_dirty_faults, __ATOMIC_RELAXED);
+    
+    return 0;
+}
+
+// Yazma koruması hatası: sayfayı kirli işaretle ve yazmaya aç. Bölgelere ait
+// olmayan hatalar önceki yakalayıcıya devredilir. Çekirdeğin kullanıcı
+// belleğine yazdığı çağrılar (read() hedefi vb.) burada değil EFAULT ile
+// sonuçlanır; bu tür tamponlar kayıtlı bölgelerin dışında tutulmalıdır.
+static void checkpoint_fault_handler(int signal_number, siginfo_t* info, void* context) {
+    uintptr_t address = (uintptr_t)info->si_addr;
+    
+    // Bölge kaldırılırken kirli tablosu, bu sayaç sıfırlanmadan serbest bırakılmaz
+    __atomic_add_fetch(&checkpoint_handlers_active, 1, __ATOMIC_SEQ_CST);
+    
+    for (uint32_t i = 0; i < CHECKPOINT_MAX_REGIONS; i++) {
+        checkpoint_region_t* region = &checkpoint_regions[i];
+        uintptr_t start = __atomic_load_n(&region->start, __ATOMIC_SEQ_CST);
+        
+        if (!start || address < start || address >= region->end || !region->tracking) {
+            continue;
+        }
+        
+        uintptr_t page = (address - start) / CHECKPOINT_PAGE_SIZE;
+        if (mprotect((void*)(start + page * CHECKPOINT_PAGE_SIZE), CHECKPOINT_PAGE_SIZE,
+                     PROT_READ | PROT_WRITE) == 0) {
+            region->dirty[page] = 1;
+            __atomic_add_fetch(&checkpoint_dirty_faults, 1, __ATOMIC_RELAXED);
+            __atomic_sub_fetch(&checkpoint_handlers_active, 1, __ATOMIC_SEQ_CST);
+            checkpoint_retry_address = 0;
+            return;
+        }
+        break;
+    }
+    
+    // Hata bölge kaldırılmadan önce oluşmuş, yakalayıcı sonra çalışmış olabilir:
+    // kaldırma sayfaları yazılabilir bıraktığı için komut bir kez yeniden denenir
+    for (uint32_t i = 0; i < CHECKPOINT_MAX_REGIONS; i++) {
+        checkpoint_region_t* region = &checkpoint_regions[i];
+        uintptr_t released = __atomic_load_n(&region->released, __ATOMIC_SEQ_CST);
+        
+        if (released && address >= released && address < region->end && checkpoint_retry_address != address) {
+            checkpoint_retry_address = address;
+            __atomic_sub_fetch(&checkpoint_handlers_active, 1, __ATOMIC_SEQ_CST);
+            return;
+        }
+    }
+    
+    __atomic_sub_fetch(&checkpoint_handlers_active, 1, __ATOMIC_SEQ_CST);
+    checkpoint_retry_address = 0;
+    
+    if (checkpoint_previous_action.sa_flags & SA_SIGINFO) {
+        checkpoint_previous_action.sa_sigaction(signal_number, info, context);
+    } else if (checkpoint_previous_action.sa_handler != SIG_DFL &&
+               checkpoint_previous_action.sa_handler != SIG_IGN) {
+        checkpoint_previous_action.sa_handler(signal_number);
+    } else {
+        // Varsayılan davranış: yakalayıcıyı kaldır, hatalı komut yeniden çalışınca işlem sonlanır
+        signal(signal_number, SIG_DFL);
+    }
+}
+
+// SIGSEGV yakalayıcısını bir kez kur
+static int checkpoint_install_handler(void) {
+    struct sigaction action;
+    int result = 0;
+    
+    pthread_mutex_lock(&checkpoint_regions_lock);
+    
+    if (!checkpoint_handler_installed) {
+        memset(&action, 0, sizeof(action));
+        action.sa_sigaction = checkpoint_fault_handler;
+        action.sa_flags = SA_SIGINFO | SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        
+        if (sigaction(SIGSEGV, &action, &checkpoint_previous_action) == 0) {
+            checkpoint_handler_installed = 1;
+        } else {
+            result = -1;
+        }
+    }
+    
+    pthread_mutex_unlock(&checkpoint_regions_lock);
+    
+    return result;
+}
+
+// Bu denetim noktasına ait bölgeyi bul (tablo kilidi tutulurken çağrılır)
+static checkpoint_region_t* checkpoint_find_region(container_checkpoint_t* checkpoint, uintptr_t start) {
+    for (uint32_t i = 0; i < CHECKPOINT_MAX_REGIONS; i++) {
+        if (checkpoint_regions[i].start == start && checkpoint_regions[i].owner == checkpoint) {
+            return &checkpoint_regions[i];
+        }
+    }
+    return NULL;
+}
+
+// Boş yuvaya bölge yerleştir (tablo kilidi tutulurken çağrılır)
+static checkpoint_region_t* checkpoint_claim_region(container_checkpoint_t* checkpoint, uintptr_t start, size_t size,
+                                                    uint64_t image_offset) {
+    for (uint32_t i = 0; i < CHECKPOINT_MAX_REGIONS; i++) {
+        checkpoint_region_t* region = &checkpoint_regions[i];
+        
+        // Çakışan bölgeler kabul edilmez
+        if (region->start && start < region->end && start + size > region->start) {
+            return NULL;
+        }
+    }
+    
+    for (uint32_t i = 0; i < CHECKPOINT_MAX_REGIONS; i++) {
+        checkpoint_region_t* region = &checkpoint_regions[i];
+        if (region->start) {
+            continue;
+        }
+        
+        region->dirty = (uint8_t*)calloc(size / CHECKPOINT_PAGE_SIZE, 1);
+        if (!region->dirty) {
+            return NULL;
+        }
+        __atomic_store_n(&region->released, 0, __ATOMIC_SEQ_CST);
+        region->end = start + size;
+        region->tracking = 0;
+        region->image_offset = image_offset;
+        region->owner = checkpoint;
+        __atomic_store_n(&region->start, start, __ATOMIC_RELEASE);
+        
+        return region;
+    }
+    
+    return NULL;
+}
+
+// Bölge yuvasını boşalt (tablo kilidi tutulurken çağrılır). Yakalayıcı
+// tabloyu kilitsiz okur; yuva boşaltıldıktan sonra içeride kalan yakalayıcılar
+// çıkmadan kirli tablosu serbest bırakılmaz
+static void checkpoint_release_region(checkpoint_region_t* region) {
+    if (region->tracking) {
+        mprotect((void*)region->start, region->end - region->start, PROT_READ | PROT_WRITE);
+    }
+    __atomic_store_n(&region->released, region->start, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&region->start, 0, __ATOMIC_SEQ_CST);
+    
+    while (__atomic_load_n(&checkpoint_handlers_active, __ATOMIC_SEQ_CST) != 0) {
+        sched_yield();
+    }
+    
+    free(region->dirty);
+    region->dirty = NULL;
+    region->tracking = 0;
+    region->owner = NULL;
+}
+
+// Ardışık kirli sayfaları tek kayıt olarak günlüğe ekle
+static int checkpoint_write_pages(int fd, checkpoint_region_t* region, uint64_t* pages) {
+    uint64_t count = (region->end - region->start) / CHECKPOINT_PAGE_SIZE;
+    uint64_t page = 0;
+    
+    while (page < count) {
+        if (!region->dirty[page]) {
+            page++;
+            continue;
+        }
+        
+        uint64_t run = page;
+        while (run < count && region->dirty[run]) {
+            run++;
+        }
+        
+        checkpoint_journal_record_t record;
+        record.offset = region->image_offset + page * CHECKPOINT_PAGE_SIZE;
+        record.size = (run - page) * CHECKPOINT_PAGE_SIZE;
+        
+        if (checkpoint_write_full(fd, &record, sizeof(record)) != 0 ||
+            checkpoint_write_full(fd, (const void*)(region->start + page * CHECKPOINT_PAGE_SIZE), (size_t)record.size) != 0) {
+            return CHECKPOINT_ERROR_IO;
+        }
+        
+        *pages += run - page;
+        page = run;
+    }
+    
+    return 0;
+}
+
+// Tamponun tamamını yaz
+static int checkpoint_write_full(int fd, const void* data, size_t size) {
+    const char* position = (const char*)data;
+    
+    while (size > 0) {
+        ssize_t written = write(fd, position, size);
+        if (written <= 0) {
+            return CHECKPOINT_ERROR_IO;
+        }
+        position += written;
+        size -= (size_t)written;
+    }
+    
+    return 0;
+}
+
+// Günlüğü memory.img'ye uygula ve sil (kilit tutulurken). Yalnızca başlığı
+// yazılmış kaydın günlüğü uygulanır; başka kuşağa ait günlük yarım kalmış
+// bir kayıttır ve atılır
+static int checkpoint_replay_journal(container_checkpoint_t* checkpoint, uint64_t generation) {
+    char path[OVERLAY_PATH_MAX + 32];
+    char image_path[OVERLAY_PATH_MAX + 32];
+    checkpoint_journal_header_t header;
+    char buffer[16 * CHECKPOINT_PAGE_SIZE];
+    int result = 0;
+    
+    snprintf(path, sizeof(path), "%s/memory.journal", checkpoint->image_dir);
+    int journal = open(path, O_RDONLY);
+    if (journal < 0) {
+        return errno == ENOENT ? 0 : CHECKPOINT_ERROR_IO;
+    }
+    
+    if (read(journal, &header, sizeof(header)) != (ssize_t)sizeof(header) ||
+        header.magic != CHECKPOINT_JOURNAL_MAGIC || header.version != CHECKPOINT_VERSION ||
+        header.generation != generation) {
+        close(journal);
+        unlink(path);
+        return 0;
+    }
+    
+    snprintf(image_path, sizeof(image_path), "%s/memory.img", checkpoint->image_dir);
+    int image = open(image_path, O_RDWR | O_CREAT, 0600);
+    struct stat st;
+    if (image < 0 || fstat(image, &st) != 0 ||
+        (st.st_size < (off_t)checkpoint->image_size && ftruncate(image, (off_t)checkpoint->image_size) != 0)) {
+        if (image >= 0) {
+            close(image);
+        }
+        close(journal);
+        return CHECKPOINT_ERROR_IO;
+    }
+    
+    uint64_t pages = 0;
+    while (pages < header.pages && result == 0) {
+        checkpoint_journal_record_t record;
+        if (read(journal, &record, sizeof(record)) != (ssize_t)sizeof(record) ||
+            record.size == 0 || (record.size % CHECKPOINT_PAGE_SIZE) != 0) {
+            result = CHECKPOINT_ERROR_FORMAT;
+            break;
+        }
+        
+        for (uint64_t done = 0; done < record.size && result == 0; ) {
+            size_t chunk = record.size - done < sizeof(buffer) ? (size_t)(record.size - done) : sizeof(buffer);
+            if (read(journal, buffer, chunk) != (ssize_t)chunk ||
+                pwrite(image, buffer, chunk, (off_t)(record.offset + done)) != (ssize_t)chunk) {
+                result = CHECKPOINT_ERROR_IO;
+            }
+            done += chunk;
+        }
+        pages += record.size / CHECKPOINT_PAGE_SIZE;
+    }
+    
+    if (result == 0 && fsync(image) != 0) {
+        result = CHECKPOINT_ERROR_IO;
+    }
+    close(image);
+    close(journal);
+    
+    // İmaj diske inmeden günlük silinmez
+    if (result == 0) {
+        unlink(path);
+    }
+    
+    return result;
+}
+
+// Bölge ve dosya tablosunu geçici dosyaya yazıp yerine taşı (kilit tutulurken)
+static int checkpoint_write_header(container_checkpoint_t* checkpoint) {
+    char path[OVERLAY_PATH_MAX + 32];
+    char temp_path[OVERLAY_PATH_MAX + 32];
+    checkpoint_header_t header;
+    
+    snprintf(path, sizeof(path), "%s/checkpoint.img", checkpoint->image_dir);
+    snprintf(temp_path, sizeof(temp_path), "%s/checkpoint.img.tmp", checkpoint->image_dir);
+    
+    FILE* image = fopen(temp_path, "wb");
+    if (!image) {
+        return CHECKPOINT_ERROR_IO;
+    }
+    
+    memset(&header, 0, sizeof(header));
+    header.magic = CHECKPOINT_MAGIC;
+    header.version = CHECKPOINT_VERSION;
+    header.generation = checkpoint->generation;
+    header.file_count = checkpoint->file_count;
+    
+    pthread_mutex_lock(&checkpoint_regions_lock);
+    for (uint32_t i = 0; i < CHECKPOINT_MAX_REGIONS; i++) {
+        if (checkpoint_regions[i].start && checkpoint_regions[i].owner == checkpoint) {
+            header.region_count++;
+        }
+    }
+    
+    int ok = fwrite(&header, sizeof(header), 1, image) == 1;
+    
+    for (uint32_t i = 0; i < CHECKPOINT_MAX_REGIONS && ok; i++) {
+        checkpoint_region_t* region = &checkpoint_regions[i];
+        if (!region->start || region->owner != checkpoint) {
+            continue;
+        }
+        checkpoint_region_record_t record;
+        record.address = region->start;
+        record.size = region->end - region->start;
+        record.offset = region->image_offset;
+        ok = fwrite(&record, sizeof(record), 1, image) == 1;
+    }
+    pthread_mutex_unlock(&checkpoint_regions_lock);
+    
+    for (uint32_t i = 0; i < checkpoint->file_count && ok; i++) {
+        checkpoint_file_record_t record;
+        memset(&record, 0, sizeof(record));
+        record.fd = checkpoint->files[i].fd;
+        record.flags = checkpoint->files[i].flags;
+        record.offset = lseek(checkpoint->files[i].fd, 0, SEEK_CUR);
+        strcpy(record.path, checkpoint->files[i].path);
+        ok = fwrite(&record, sizeof(record), 1, image) == 1;
+    }
+    
+    // Yer değiştirme kaydın tamamlandığı andır; içerik önce diske inmeli
+    if (ok) {
+        ok = fflush(image) == 0 && fsync(fileno(image)) == 0;
+    }
+    
+    if (fclose(image) != 0 || !ok || rename(temp_path, path) != 0) {
+        unlink(temp_path);
+        return CHECKPOINT_ERROR_IO;
+    }
+    
+    return 0;
+}
+
+// Dosya tablosuna kayıt ekle (kilit tutulurken çağrılır)
+static int checkpoint_append_file(container_checkpoint_t* checkpoint, int fd, const char* path, int flags) {
+    if (checkpoint->file_count >= CHECKPOINT_MAX_FILES) {
+        return CHECKPOINT_ERROR_NO_MEMORY;
+    }
+    
+    if (checkpoint->file_count == checkpoint->file_capacity) {
+        uint32_t capacity = checkpoint->file_capacity ? checkpoint->file_capacity * 2 : 16;
+        checkpoint_file_t* files = (checkpoint_file_t*)realloc(checkpoint->files, sizeof(checkpoint_file_t) * capacity);
+        if (!files) {
+            return CHECKPOINT_ERROR_NO_MEMORY;
+        }
+        checkpoint->files = files;
+        checkpoint->file_capacity = capacity;
+    }
+    
+    checkpoint_file_t* file = &checkpoint->files[checkpoint->file_count++];
+    file->fd = fd;
+    file->flags = flags;
+    strcpy(file->path, path);
+    
+    return 0;
+}
+
+// Monoton saat (mikrosaniye)
+static uint64_t checkpoint_now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
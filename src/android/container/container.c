@@ -1,9 +1,16 @@
 #include "../../include/android/android_container.h"
 #include "../../include/android/android.h"
+#include "../../include/android/container_overlay.h"
+#include "../../include/android/container_resource.h"
+#include "../../include/android/container_freezer.h"
+#include "../../include/android/container_checkpoint.h"
+#include "../../include/android/art_heap.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 #include <time.h>
+#include <errno.h>
+#include <sys/stat.h>
 
 // Konteyner sistemi durumu
 static uint8_t container_initialized = 0;
@@ -16,6 +23,12 @@ static uint32_t max_containers = 0;
 // Konteyner sistemi yapılandırması
 static android_container_config_t container_config;
 
+// İş parçacıklarının güvenli noktaya ulaşması için beklenecek süre
+#define CONTAINER_FREEZE_TIMEOUT_MS 1000
+
+// Konteynerlerin paylaştığı Android sistem imajı
+static char container_system_image[256] = "/var/lib/android/system.img";
+
 // İzolasyon işlevleri için namespace fonksiyonları
 static int (*namespace_unshare)(int flags) = NULL;
 static int (*namespace_setns)(int fd, int nstype) = NULL;
@@ -42,11 +55,13 @@ int container_initialize(const android_config_t* android_config) {
         container_config.default_memory_limit = android_config->memory_limit_mb / 4;  // Toplam belleğin 1/4'ü
         container_config.enable_network = android_config->enable_network;
         container_config.enable_graphics_acceleration = android_config->enable_hw_acceleration;
+        if (android_config->system_image_path[0]) {
+            strncpy(container_system_image, android_config->system_image_path, sizeof(container_system_image) - 1);
+        }
     }
     
     // Konteyner dizinini oluştur
-    // Gerçek bir uygulamada, burada dizin oluşturma işlemleri yapılır
-    // mkdir_p(container_config.container_root);
+    mkdir(container_config.container_root, 0755);
     
     // Konteyner listesi için bellek ayır
     max_containers = container_config.max_containers;
@@ -137,10 +152,31 @@ android_container_t* container_create(const char* container_id, container_type_t
     container->storage_limit = container_config.default_storage_limit * 1024 * 1024;  // MB'dan byte'a
     container->create_time = time(NULL);
     
+    // Kaynak grubu; sınırlar konteyner başlatılırken uygulanır
+    container->resources = resource_group_create(NULL);
+    if (!container->resources) {
+        free(container);
+        return NULL;  // Bellek hatası
+    }
+    
     // Konteyner yolunu oluştur
     snprintf(container->root_path, sizeof(container->root_path), "%s/%s", 
              container_config.container_root, container_id);
     
+    // Dondurucu ve denetim noktası; çalışma zamanı iş parçacıklarını ve bellek
+    // bölgelerini bunlara kaydeder
+    char checkpoint_dir[sizeof(container->root_path) + sizeof("/checkpoint")];
+    snprintf(checkpoint_dir, sizeof(checkpoint_dir), "%s/checkpoint", container->root_path);
+    container->freezer = freezer_create();
+    container->checkpoint = checkpoint_create(checkpoint_dir);
+    if (!container->freezer || !container->checkpoint) {
+        freezer_destroy((container_freezer_t*)container->freezer);
+        checkpoint_destroy((container_checkpoint_t*)container->checkpoint);
+        resource_group_destroy((container_resource_t*)container->resources);
+        free(container);
+        return NULL;  // Bellek hatası
+    }
+    
     // Konteyner dizinlerini oluştur
     // Gerçek bir uygulamada, burada dizin oluşturma işlemleri yapılır
     // mkdir_p(container->root_path);
@@ -204,6 +240,13 @@ int container_start(android_container_t* container) {
     // Konteyner işlem ID'sini kaydet
     container->pid = pid;
     
+    // Çalışma zamanı bu süreçte konteyner adına çalışır: iş parçacıkları
+    // dondurucuya, yığın denetim noktasına kaydedilir. Başka bir konteynere
+    // bağlıysa ya da çalışma zamanı yoksa duraklatma sinyalle yapılır.
+    art_heap_bind_container((container_freezer_t*)container->freezer,
+                            (container_resource_t*)container->resources,
+                            (container_checkpoint_t*)container->checkpoint);
+    
     // Konteyner durumunu güncelle
     container->state = CONTAINER_STATE_RUNNING;
     container->start_time = time(NULL);
@@ -227,6 +270,10 @@ int container_stop(android_container_t* container) {
     container->state = CONTAINER_STATE_STOPPING;
     
     // Konteyner işlemini sonlandır
+    // Donmuş iş parçacıkları kapanışı görebilsin
+    freezer_thaw((container_freezer_t*)container->freezer);
+    art_heap_unbind_container((container_freezer_t*)container->freezer);
+    
     if (container->pid > 0) {
         // Önce düzgün bir kapanış sinyali gönder (SIGTERM)
         kill_process(container->pid, 15);  // SIGTERM
@@ -241,6 +288,7 @@ int container_stop(android_container_t* container) {
         }
         
         // İşlem durumunu sıfırla
+        resource_uncharge_process((container_resource_t*)container->resources);
         container->pid = 0;
     }
     
@@ -270,11 +318,14 @@ int container_pause(android_container_t* container) {
         return -2;  // Çalışmıyor
     }
     
-    // SIGSTOP sinyali gönder
-    if (container->pid > 0) {
+    // Tüm iş parçacıklarını güvenli noktalarda durdur; kayıtlı iş parçacığı
+    // yoksa (çalışma zamanı bağlı değil) işlemi sinyalle durdur
+    if (freezer_get_thread_count((container_freezer_t*)container->freezer) == 0) {
         if (kill_process(container->pid, 19) != 0) {  // SIGSTOP
-            return -3;  // Sinyal gönderme hatası
+            return -3;
         }
+    } else if (freezer_freeze((container_freezer_t*)container->freezer, CONTAINER_FREEZE_TIMEOUT_MS) != 0) {
+        return -3;  // İş parçacıkları durdurulamadı
     }
     
     // Konteyner durumunu güncelle
@@ -294,11 +345,13 @@ int container_resume(android_container_t* container) {
         return -2;  // Duraklatılmamış
     }
     
-    // SIGCONT sinyali gönder
-    if (container->pid > 0) {
+    // Durdurulan iş parçacıklarını serbest bırak; dondurulmadıysa sinyalle durdurulmuştur
+    if (freezer_get_state((container_freezer_t*)container->freezer) == FREEZER_THAWED) {
         if (kill_process(container->pid, 18) != 0) {  // SIGCONT
-            return -3;  // Sinyal gönderme hatası
+            return -3;
         }
+    } else if (freezer_thaw((container_freezer_t*)container->freezer) != 0) {
+        return -3;
     }
     
     // Konteyner durumunu güncelle
@@ -307,6 +360,55 @@ int container_resume(android_container_t* container) {
     return 0;
 }
 
+// Duraklatılmış konteynerin denetim noktasını al (ilk kayıttan sonra
+// yalnızca değişen sayfalar yazılır)
+int container_checkpoint(android_container_t* container) {
+    if (!container_initialized || !container) {
+        return -1;
+    }
+    
+    // Kayıt sırasında bellek değişmemeli
+    if (container->state != CONTAINER_STATE_PAUSED) {
+        return -2;  // Önce duraklatılmalı
+    }
+    
+    if (checkpoint_save((container_checkpoint_t*)container->checkpoint) != 0) {
+        return -3;  // İmaj yazılamadı
+    }
+    
+    return 0;
+}
+
+// Konteyneri son denetim noktasından geri yükle ve devam ettir
+int container_restore(android_container_t* container) {
+    if (!container_initialized || !container) {
+        return -1;
+    }
+    
+    if (container->state == CONTAINER_STATE_RUNNING) {
+        return -2;  // Çalışan konteyner geri yüklenemez
+    }
+    
+    // Açık dosyalar kök dosya sistemi üzerinden yeniden açılır
+    if (mount_rootfs(container) != 0) {
+        return -3;
+    }
+    
+    if (checkpoint_restore((container_checkpoint_t*)container->checkpoint,
+                           (overlay_t*)container->filesystem) != 0) {
+        return -3;  // İmaj okunamadı
+    }
+    
+    if (container->state != CONTAINER_STATE_PAUSED) {
+        container->start_time = time(NULL);
+    }
+    
+    freezer_thaw((container_freezer_t*)container->freezer);
+    container->state = CONTAINER_STATE_RUNNING;
+    
+    return 0;
+}
+
 // Konteyneri temizle ve yok et
 int container_destroy(android_container_t* container) {
     if (!container_initialized || !container) {
@@ -327,6 +429,9 @@ int container_destroy(android_container_t* container) {
     for (uint32_t i = 0; i < active_container_count; i++) {
         if (active_containers[i] == container) {
             // Konteyner belleğini serbest bırak
+            checkpoint_destroy((container_checkpoint_t*)container->checkpoint);
+            freezer_destroy((container_freezer_t*)container->freezer);
+            resource_group_destroy((container_resource_t*)container->resources);
             free(container);
             
             // Listedeki boşluğu kapat
@@ -362,10 +467,13 @@ int container_get_info(android_container_t* container, android_container_info_t*
     info->start_time = container->start_time;
     info->stop_time = container->stop_time;
     
-    // Kullanım istatistiklerini topla
-    info->memory_usage = get_memory_usage(container->pid);
-    info->cpu_usage = get_cpu_usage(container->pid);
-    info->storage_usage = get_storage_usage(container->root_path);
+    // Kullanım istatistiklerini topla; konteynerin kendi alanları da son
+    // okunan değerleri taşır
+    info->memory_usage = get_memory_usage(container);
+    info->cpu_usage = get_cpu_usage(container);
+    info->storage_usage = get_storage_usage(container);
+    container->memory_usage = info->memory_usage;
+    container->cpu_usage = info->cpu_usage;
     
     return 0;
 }
@@ -480,17 +588,89 @@ static int setup_namespaces(android_container_t* container) {
     return 0;  // Başarılı
 }
 
+// Android sistem imajını yazarken kopyalanan katman olarak bağla
+int container_mount_android_fs(android_container_t* container, const char* system_image) {
+    char lower_path[256];
+    char upper_path[300];
+    struct stat st;
+    
+    if (!container || !system_image) {
+        return -1;
+    }
+    
+    // Zaten bağlı
+    if (container->filesystem) {
+        return 0;
+    }
+    
+    // İmaj dosyası verilirse bir kez açılmış paylaşılan ağacı kullan
+    // ("/var/lib/android/system.img" -> "/var/lib/android/system")
+    strncpy(lower_path, system_image, sizeof(lower_path) - 1);
+    lower_path[sizeof(lower_path) - 1] = '\0';
+    if (stat(lower_path, &st) == 0 && !S_ISDIR(st.st_mode)) {
+        char* extension = strrchr(lower_path, '.');
+        if (!extension || strchr(extension, '/')) {
+            return -2;  // Açılmış imaj ağacı bulunamadı
+        }
+        *extension = '\0';
+    }
+    
+    // Konteynere özel üst katman: yalnızca değişen dosyalar burada tutulur
+    if (mkdir(container->root_path, 0755) != 0 && errno != EEXIST) {
+        return -3;
+    }
+    snprintf(upper_path, sizeof(upper_path), "%s/upper", container->root_path);
+    
+    // Alt katman dizini tüm konteynerler arasında paylaşılır; ilk konteynerden
+    // sonrakiler yalnızca kendi üst katmanlarını tarar
+    overlay_t* overlay = overlay_create(lower_path, upper_path);
+    if (!overlay) {
+        return -2;
+    }
+    
+    container->filesystem = overlay;
+    
+    return 0;
+}
+
+// Konteyner dosyasını aç (yollar konteyner köküne göredir)
+int container_open_file(android_container_t* container, const char* path, int flags, mode_t mode) {
+    if (!container || !container->filesystem) {
+        return OVERLAY_ERROR_INVALID;
+    }
+    
+    return overlay_open((overlay_t*)container->filesystem, path, flags, mode);
+}
+
+// Konteyner dosyasına yaz; büyüme disk kotasından düşülür
+ssize_t container_write_file(android_container_t* container, int fd, const void* buffer, size_t size) {
+    if (!container || !container->filesystem) {
+        return OVERLAY_ERROR_INVALID;
+    }
+    
+    return overlay_write((overlay_t*)container->filesystem, fd, buffer, size);
+}
+
+// Konteyner dosyasının boyutunu değiştir
+int container_truncate_file(android_container_t* container, int fd, off_t length) {
+    if (!container || !container->filesystem) {
+        return OVERLAY_ERROR_INVALID;
+    }
+    
+    return overlay_truncate((overlay_t*)container->filesystem, fd, length);
+}
+
 // Konteyner kök dosya sistemini bağla
 static int mount_rootfs(android_container_t* container) {
-    // Gerçek bir uygulamada, burada dosya sistemi bağlama işlemleri yapılır
-    // mount(...);
-    return 0;  // Başarılı
+    return container_mount_android_fs(container, container_system_image);
 }
 
-// Konteyner kök dosya sistemini ayır
+// Konteyner kök dosya sistemini ayır (üst katman diskte korunur)
 static int unmount_rootfs(android_container_t* container) {
-    // Gerçek bir uygulamada, burada dosya sistemi ayırma işlemleri yapılır
-    // umount(...);
+    if (container->filesystem) {
+        overlay_destroy((overlay_t*)container->filesystem);
+        container->filesystem = NULL;
+    }
     return 0;  // Başarılı
 }
 
@@ -508,10 +688,62 @@ static int cleanup_network(android_container_t* container) {
     return 0;  // Başarılı
 }
 
+// Konteyner kaynak limitlerini değiştir (çalışırken de uygulanır)
+int container_set_limits(android_container_t* container, container_limits_t* limits) {
+    if (!container || !limits) {
+        return -1;
+    }
+    
+    container->limits = *limits;
+    if (limits->max_memory_mb) {
+        container->memory_limit = (uint64_t)limits->max_memory_mb * 1024 * 1024;
+    }
+    if (limits->max_disk_mb) {
+        container->storage_limit = (uint64_t)limits->max_disk_mb * 1024 * 1024;
+    }
+    
+    return setup_resource_limits(container);
+}
+
+// Konteyner kaynak kullanımını al (alanlar sınır yerine kullanımı taşır)
+int container_get_usage(android_container_t* container, container_limits_t* usage) {
+    if (!container || !usage) {
+        return -1;
+    }
+    
+    container_resource_usage_t resource_usage;
+    if (resource_get_usage((container_resource_t*)container->resources, &resource_usage) != 0) {
+        return -2;
+    }
+    
+    container->memory_usage = resource_usage.memory_bytes;
+    container->cpu_usage = resource_usage.cpu_percent;
+    
+    usage->max_memory_mb = (uint32_t)(resource_usage.memory_bytes / (1024 * 1024));
+    usage->max_cpu_percent = (uint32_t)resource_usage.cpu_percent;
+    usage->max_disk_mb = (uint32_t)(get_storage_usage(container) / (1024 * 1024));
+    usage->max_processes = resource_usage.processes;
+    
+    return 0;
+}
+
 // Konteyner kaynak limitleri ayarla
 static int setup_resource_limits(android_container_t* container) {
-    // Gerçek bir uygulamada, burada kaynak limitleri ayarlanır
-    // setrlimit(...) / cgroups vb.
+    container_limits_t limits = container->limits;
+    
+    // Bellek ve disk sınırları konteynerin bayt cinsinden alanlarından gelir
+    limits.max_memory_mb = (uint32_t)(container->memory_limit / (1024 * 1024));
+    limits.max_disk_mb = (uint32_t)(container->storage_limit / (1024 * 1024));
+    
+    if (resource_set_limits((container_resource_t*)container->resources, &limits) != 0) {
+        return -1;
+    }
+    
+    // Disk kotası üst katmanda yazma anında uygulanır
+    if (container->filesystem) {
+        overlay_set_quota((overlay_t*)container->filesystem, container->storage_limit);
+    }
+    
     return 0;  // Başarılı
 }
 
@@ -520,29 +752,40 @@ static pid_t fork_container_process(android_container_t* container) {
     // Gerçek bir uygulamada, burada yeni işlem oluşturulur
     // fork() / execve() vb.
     
+    // İşlem sınırı dolduysa başlatma
+    if (resource_charge_process((container_resource_t*)container->resources) != 0) {
+        return -1;
+    }
+    
     // Sahte işlem ID'si döndür
     return 1000 + rand() % 9000;
 }
 
 // Kaynak kullanımı ölçümleri için yardımcı fonksiyonlar
 
-// Bellek kullanımını ölç
-static uint64_t get_memory_usage(pid_t pid) {
-    // Gerçek bir uygulamada, burada bellek kullanımı ölçülür
-    // /proc/[pid]/statm vb.
-    return 50 * 1024 * 1024;  // Örnek: 50MB
+// Bellek kullanımı: konteynere ücretlendirilmiş sayfalar
+static uint64_t get_memory_usage(android_container_t* container) {
+    container_resource_usage_t usage;
+    if (resource_get_usage((container_resource_t*)container->resources, &usage) != 0) {
+        return 0;
+    }
+    return usage.memory_bytes;
 }
 
-// CPU kullanımını ölç
-static float get_cpu_usage(pid_t pid) {
-    // Gerçek bir uygulamada, burada CPU kullanımı ölçülür
-    // /proc/[pid]/stat vb.
-    return 5.0f;  // Örnek: %5 CPU
+// CPU kullanımı: son tamamlanan bant genişliği dönemindeki oran
+static float get_cpu_usage(android_container_t* container) {
+    container_resource_usage_t usage;
+    if (resource_get_usage((container_resource_t*)container->resources, &usage) != 0) {
+        return 0.0f;
+    }
+    return usage.cpu_percent;
 }
 
-// Depolama kullanımını ölç
-static uint64_t get_storage_usage(const char* path) {
-    // Gerçek bir uygulamada, burada depolama kullanımı ölçülür
-    // statvfs() vb.
-    return 100 * 1024 * 1024;  // Örnek: 100MB
+// Depolama kullanımı: yazma anında güncellenen üst katman sayacı
+static uint64_t get_storage_usage(android_container_t* container) {
+    overlay_stats_t stats;
+    if (!container->filesystem || overlay_get_stats((overlay_t*)container->filesystem, &stats) != 0) {
+        return 0;
+    }
+    return stats.upper_bytes;
 } 
\ No newline at end of file
@@ -0,0 +1,233 @@
+#include "../../include/android/container_freezer.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <pthread.h>
+
+// Dondurucu yapısı
+struct container_freezer {
+    int state;                     // FREEZER_* (güvenli noktada atomik okunur)
+    pthread_mutex_t lock;
+    pthread_cond_t parked_cond;    // Durdurma isteğini yapan bekler
+    pthread_cond_t thaw_cond;      // Durdurulan iş parçacıkları bekler
+    uint32_t threads;              // Kayıtlı iş parçacığı sayısı
+    uint32_t stopped;              // Güvenli noktada ya da bloklu olanlar
+    freezer_notify_t notify;       // Donma isteği bildirimi
+    void* notify_context;
+};
+
+// Yardımcı fonksiyonlar
+static void freezer_park(container_freezer_t* freezer);
+
+// Dondurucu oluştur
+container_freezer_t* freezer_create(void) {
+    container_freezer_t* freezer = (container_freezer_t*)calloc(1, sizeof(container_freezer_t));
+    if (!freezer) {
+        return NULL;
+    }
+    
+    pthread_mutex_init(&freezer->lock, NULL);
+    pthread_cond_init(&freezer->parked_cond, NULL);
+    pthread_cond_init(&freezer->thaw_cond, NULL);
+    freezer->state = FREEZER_THAWED;
+    
+    return freezer;
+}
+
+// Dondurucuyu yok et
+void freezer_destroy(container_freezer_t* freezer) {
+    if (!freezer) {
+        return;
+    }
+    
+    pthread_cond_destroy(&freezer->thaw_cond);
+    pthread_cond_destroy(&freezer->parked_cond);
+    pthread_mutex_destroy(&freezer->lock);
+    free(freezer);
+}
+
+// Çağıran iş parçacığını kaydet; donmuş konteynere yeni iş parçacığı girmez
+int freezer_thread_enter(container_freezer_t* freezer) {
+    if (!freezer) {
+        return FREEZER_ERROR_INVALID;
+    }
+    
+    pthread_mutex_lock(&freezer->lock);
+    while (freezer->state != FREEZER_THAWED) {
+        pthread_cond_wait(&freezer->thaw_cond, &freezer->lock);
+    }
+    freezer->threads++;
+    pthread_mutex_unlock(&freezer->lock);
+    
+    return 0;
+}
+
+// İş parçacığı kaydını kaldır
+void freezer_thread_exit(container_freezer_t* freezer) {
+    if (!freezer) {
+        return;
+    }
+    
+    pthread_mutex_lock(&freezer->lock);
+    freezer->threads--;
+    if (freezer->state == FREEZER_FREEZING) {
+        pthread_cond_signal(&freezer->parked_cond);
+    }
+    pthread_mutex_unlock(&freezer->lock);
+}
+
+// Güvenli nokta: hızlı yol yalnızca bir atomik okuma
+void freezer_safepoint(container_freezer_t* freezer) {
+    if (freezer && __atomic_load_n(&freezer->state, __ATOMIC_ACQUIRE) != FREEZER_THAWED) {
+        freezer_park(freezer);
+    }
+}
+
+// Bloklayan çağrıya gir: iş parçacığı bu sürede donmuş sayılır
+void freezer_thread_block(container_freezer_t* freezer) {
+    if (!freezer) {
+        return;
+    }
+    
+    pthread_mutex_lock(&freezer->lock);
+    freezer->stopped++;
+    if (freezer->state == FREEZER_FREEZING) {
+        pthread_cond_signal(&freezer->parked_cond);
+    }
+    pthread_mutex_unlock(&freezer->lock);
+}
+
+// Bloklayan çağrıdan çık: konteyner donmuşsa çözülene kadar bekle
+void freezer_thread_unblock(container_freezer_t* freezer) {
+    if (!freezer) {
+        return;
+    }
+    
+    pthread_mutex_lock(&freezer->lock);
+    while (freezer->state != FREEZER_THAWED) {
+        pthread_cond_wait(&freezer->thaw_cond, &freezer->lock);
+    }
+    freezer->stopped--;
+    pthread_mutex_unlock(&freezer->lock);
+}
+
+// Konteyneri dondur; tüm kayıtlı iş parçacıkları durunca döner
+int freezer_freeze(container_freezer_t* freezer, uint32_t timeout_ms) {
+    struct timespec deadline;
+    
+    if (!freezer) {
+        return FREEZER_ERROR_INVALID;
+    }
+    
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += timeout_ms / 1000;
+    deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000;
+    if (deadline.tv_nsec >= 1000000000) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000;
+    }
+    
+    pthread_mutex_lock(&freezer->lock);
+    
+    if (freezer->state != FREEZER_THAWED) {
+        int state = freezer->state;
+        pthread_mutex_unlock(&freezer->lock);
+        return state == FREEZER_FROZEN ? 0 : FREEZER_ERROR_STATE;
+    }
+    
+    __atomic_store_n(&freezer->state, FREEZER_FREEZING, __ATOMIC_RELEASE);
+    if (freezer->notify) {
+        freezer->notify(freezer->notify_context, FREEZER_FREEZING);
+    }
+    
+    while (freezer->stopped < freezer->threads) {
+        if (pthread_cond_timedwait(&freezer->parked_cond, &freezer->lock, &deadline) == ETIMEDOUT &&
+            freezer->stopped < freezer->threads) {
+            // Güvenli noktaya ulaşmayan iş parçacığı var: donmayı geri al
+            __atomic_store_n(&freezer->state, FREEZER_THAWED, __ATOMIC_RELEASE);
+            if (freezer->notify) {
+                freezer->notify(freezer->notify_context, FREEZER_THAWED);
+            }
+            pthread_cond_broadcast(&freezer->thaw_cond);
+            pthread_mutex_unlock(&freezer->lock);
+            return FREEZER_ERROR_TIMEOUT;
+        }
+    }
+    
+    __atomic_store_n(&freezer->state, FREEZER_FROZEN, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&freezer->lock);
+    
+    return 0;
+}
+
+// Konteyneri çöz
+int freezer_thaw(container_freezer_t* freezer) {
+    if (!freezer) {
+        return FREEZER_ERROR_INVALID;
+    }
+    
+    pthread_mutex_lock(&freezer->lock);
+    __atomic_store_n(&freezer->state, FREEZER_THAWED, __ATOMIC_RELEASE);
+    if (freezer->notify) {
+        freezer->notify(freezer->notify_context, FREEZER_THAWED);
+    }
+    pthread_cond_broadcast(&freezer->thaw_cond);
+    pthread_mutex_unlock(&freezer->lock);
+    
+    return 0;
+}
+
+// Dondurucu durumunu al
+int freezer_get_state(container_freezer_t* freezer) {
+    if (!freezer) {
+        return FREEZER_ERROR_INVALID;
+    }
+    
+    return __atomic_load_n(&freezer->state, __ATOMIC_ACQUIRE);
+}
+
+// Kayıtlı iş parçacığı sayısı; sıfırsa dondurma hiçbir şeyi durdurmaz
+uint32_t freezer_get_thread_count(container_freezer_t* freezer) {
+    uint32_t threads;
+    
+    if (!freezer) {
+        return 0;
+    }
+    
+    pthread_mutex_lock(&freezer->lock);
+    threads = freezer->threads;
+    pthread_mutex_unlock(&freezer->lock);
+    
+    return threads;
+}
+
+// Donma isteği bildirimini ayarla (NULL kaldırır)
+void freezer_set_notify(container_freezer_t* freezer, freezer_notify_t notify, void* context) {
+    if (!freezer) {
+        return;
+    }
+    
+    pthread_mutex_lock(&freezer->lock);
+    freezer->notify = notify;
+    freezer->notify_context = context;
+    pthread_mutex_unlock(&freezer->lock);
+}
+
+// Güvenli noktada dur ve çözülmeyi bekle
+static void freezer_park(container_freezer_t* freezer) {
+    pthread_mutex_lock(&freezer->lock);
+    
+    if (freezer->state != FREEZER_THAWED) {
+        freezer->stopped++;
+        pthread_cond_signal(&freezer->parked_cond);
+        
+        while (freezer->state != FREEZER_THAWED) {
+            pthread_cond_wait(&freezer->thaw_cond, &freezer->lock);
+        }
+        
+        freezer->stopped--;
+    }
+    
+    pthread_mutex_unlock(&freezer->lock);
+}
@@ -0,0 +1,1106 @@
+#include "../../include/android/container_overlay.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <pthread.h>
+
+// Dizin girdisi (alt katman dizini ve üst katman tablosu için ortak)
+typedef struct {
+    char* path;                    // Köke göre yol ("" = kök, "system/bin/sh")
+    uint32_t hash;                 // Yol özeti
+    mode_t mode;                   // Dosya türü ve izinleri
+    uint8_t state;                 // Üst katman durumu (OVERLAY_STATE_*)
+    int32_t next;                  // Aynı kovadaki sonraki girdi
+    int32_t first_child;           // İlk alt girdi (yalnızca alt katman)
+    int32_t next_sibling;          // Sonraki kardeş girdi (yalnızca alt katman)
+} overlay_entry_t;
+
+// Yol -> girdi karma tablosu
+typedef struct {
+    overlay_entry_t* entries;
+    uint32_t count;
+    uint32_t capacity;
+    int32_t* buckets;
+    uint32_t bucket_count;
+} overlay_table_t;
+
+// Paylaşılan salt okunur alt katman; kurulduktan sonra değişmez, kilitsiz okunur
+typedef struct overlay_lower {
+    char root[OVERLAY_PATH_MAX];
+    overlay_table_t table;
+    uint32_t refs;
+    struct overlay_lower* next;
+} overlay_lower_t;
+
+// Konteyner başına birleşik görünüm
+struct overlay {
+    overlay_lower_t* lower;
+    char upper_root[OVERLAY_PATH_MAX];
+    overlay_table_t upper;         // Üst katmandaki dosyalar ve beyaz çıkışlar
+    pthread_mutex_t lock;
+    uint64_t copy_ups;
+    uint64_t copy_up_bytes;
+    uint64_t whiteouts;
+    uint64_t upper_bytes;          // Üst katman disk kullanımı (atomik)
+    uint64_t quota_bytes;          // Disk kotası (0 = sınırsız)
+};
+
+// Üst katman girdi durumları
+#define OVERLAY_STATE_PRESENT      1   // Dosya üst katmanda var
+#define OVERLAY_STATE_WHITEOUT     2   // Alt katmandaki dosya silinmiş
+#define OVERLAY_STATE_OPAQUE       3   // Dizin alt katmanı tamamen gizliyor
+
+#define OVERLAY_COPY_CHUNK         (64 * 1024)
+
+// Paylaşılan alt katman kaydı
+static overlay_lower_t* lower_images = NULL;
+static pthread_mutex_t lower_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Yardımcı fonksiyonlar
+static uint32_t overlay_hash(const char* path, uint32_t length);
+static int overlay_table_init(overlay_table_t* table, uint32_t bucket_count);
+static void overlay_table_free(overlay_table_t* table);
+static int32_t overlay_table_find(const overlay_table_t* table, const char* path, uint32_t length);
+static int32_t overlay_table_add(overlay_table_t* table, const char* path, mode_t mode, uint8_t state);
+static int overlay_normalize(const char* path, char* out, uint32_t size);
+static int overlay_scan_lower(overlay_lower_t* lower, int32_t parent, const char* relative);
+static int overlay_scan_upper(overlay_t* overlay, const char* relative);
+static overlay_lower_t* overlay_lower_acquire(const char* root);
+static void overlay_lower_release(overlay_lower_t* lower);
+static int overlay_resolve(overlay_t* overlay, const char* path, int32_t* lower_index, int32_t* upper_index);
+static int overlay_make_parents(overlay_t* overlay, const char* path);
+static int overlay_copy_up(overlay_t* overlay, const char* path, int32_t lower_index, int truncate);
+static int overlay_write_marker(overlay_t* overlay, const char* path, const char* marker);
+static int overlay_whiteout_path(overlay_t* overlay, const char* path, char* out, uint32_t size);
+static int overlay_charge(overlay_t* overlay, int64_t delta);
+
+// Birleşik katman oluştur
+overlay_t* overlay_create(const char* lower_root, const char* upper_root) {
+    if (!lower_root || !upper_root || strlen(upper_root) >= OVERLAY_PATH_MAX) {
+        return NULL;
+    }
+    
+    overlay_t* overlay = (overlay_t*)calloc(1, sizeof(overlay_t));
+    if (!overlay) {
+        return NULL;
+    }
+    
+    // Üst katman dizini yoksa oluştur
+    strcpy(overlay->upper_root, upper_root);
+    if (mkdir(upper_root, 0755) != 0 && errno != EEXIST) {
+        free(overlay);
+        return NULL;
+    }
+    
+    if (overlay_table_init(&overlay->upper, 256) != 0) {
+        free(overlay);
+        return NULL;
+    }
+    
+    // Önceki çalıştırmalardan kalan üst katmanı yükle
+    if (overlay_scan_upper(overlay, "") != 0) {
+        overlay_table_free(&overlay->upper);
+        free(overlay);
+        return NULL;
+    }
+    
+    // Alt katmanı paylaş; yalnızca ilk konteyner dizini tarar
+    overlay->lower = overlay_lower_acquire(lower_root);
+    if (!overlay->lower) {
+        overlay_table_free(&overlay->upper);
+        free(overlay);
+        return NULL;
+    }
+    
+    pthread_mutex_init(&overlay->lock, NULL);
+    
+    return overlay;
+}
+
+// Birleşik katmanı yok et (üst katman diskte kalır)
+void overlay_destroy(overlay_t* overlay) {
+    if (!overlay) {
+        return;
+    }
+    
+    overlay_lower_release(overlay->lower);
+    overlay_table_free(&overlay->upper);
+    pthread_mutex_destroy(&overlay->lock);
+    free(overlay);
+}
+
+// Yolu ana sistemdeki gerçek yola çevir
+int overlay_lookup(overlay_t* overlay, const char* path, char* host_path, uint32_t size) {
+    char relative[OVERLAY_PATH_MAX];
+    int32_t lower_index, upper_index;
+    
+    if (!overlay || !path || overlay_normalize(path, relative, sizeof(relative)) != 0) {
+        return OVERLAY_ERROR_INVALID;
+    }
+    
+    pthread_mutex_lock(&overlay->lock);
+    int layer = overlay_resolve(overlay, relative, &lower_index, &upper_index);
+    pthread_mutex_unlock(&overlay->lock);
+    
+    if (layer < 0) {
+        return layer;
+    }
+    
+    if (host_path) {
+        const char* root = (layer == OVERLAY_LAYER_UPPER) ? overlay->upper_root : overlay->lower->root;
+        if ((uint32_t)snprintf(host_path, size, "%s/%s", root, relative) >= size) {
+            return OVERLAY_ERROR_INVALID;
+        }
+    }
+    
+    return layer;
+}
+
+// Dosya aç; yazma amaçlı açılışlar alt katman dosyasını önce üst katmana kopyalar
+int overlay_open(overlay_t* overlay, const char* path, int flags, mode_t mode) {
+    char relative[OVERLAY_PATH_MAX];
+    char host_path[OVERLAY_PATH_MAX * 2];
+    int32_t lower_index, upper_index;
+    int writing = (flags & (O_WRONLY | O_RDWR | O_CREAT | O_TRUNC | O_APPEND)) != 0;
+    
+    if (!overlay || !path || overlay_normalize(path, relative, sizeof(relative)) != 0 || relative[0] == '\0') {
+        return OVERLAY_ERROR_INVALID;
+    }
+    
+    pthread_mutex_lock(&overlay->lock);
+    
+    int layer = overlay_resolve(overlay, relative, &lower_index, &upper_index);
+    
+    if (layer == OVERLAY_LAYER_LOWER && writing) {
+        // Yazarken kopyala: O_TRUNC varsa veri kopyalanmaz
+        if ((flags & O_CREAT) && (flags & O_EXCL)) {
+            pthread_mutex_unlock(&overlay->lock);
+            return OVERLAY_ERROR_EXISTS;
+        }
+        int result = overlay_copy_up(overlay, relative, lower_index, (flags & O_TRUNC) != 0);
+        if (result != 0) {
+            pthread_mutex_unlock(&overlay->lock);
+            return result;
+        }
+        layer = OVERLAY_LAYER_UPPER;
+    } else if (layer == OVERLAY_ERROR_NOT_FOUND && (flags & O_CREAT)) {
+        // Yeni dosya her zaman üst katmanda oluşturulur
+        if (overlay_make_parents(overlay, relative) != 0) {
+            pthread_mutex_unlock(&overlay->lock);
+            return OVERLAY_ERROR_NOT_FOUND;
+        }
+        
+        // Beyaz çıkış varsa kaldır
+        if (upper_index >= 0 && overlay->upper.entries[upper_index].state == OVERLAY_STATE_WHITEOUT) {
+            if (overlay_whiteout_path(overlay, relative, host_path, sizeof(host_path)) == 0) {
+                unlink(host_path);
+            }
+        }
+        
+        snprintf(host_path, sizeof(host_path), "%s/%s", overlay->upper_root, relative);
+        int fd = open(host_path, flags, mode);
+        if (fd < 0) {
+            pthread_mutex_unlock(&overlay->lock);
+            return OVERLAY_ERROR_IO;
+        }
+        
+        if (upper_index >= 0) {
+            overlay->upper.entries[upper_index].state = OVERLAY_STATE_PRESENT;
+            overlay->upper.entries[upper_index].mode = S_IFREG | (mode & 07777);
+        } else if (overlay_table_add(&overlay->upper, relative, S_IFREG | (mode & 07777), OVERLAY_STATE_PRESENT) < 0) {
+            close(fd);
+            unlink(host_path);
+            pthread_mutex_unlock(&overlay->lock);
+            return OVERLAY_ERROR_NO_MEMORY;
+        }
+        
+        pthread_mutex_unlock(&overlay->lock);
+        return fd;
+    }
+    
+    pthread_mutex_unlock(&overlay->lock);
+    
+    if (layer < 0) {
+        return layer;
+    }
+    
+    const char* root = (layer == OVERLAY_LAYER_UPPER) ? overlay->upper_root : overlay->lower->root;
+    snprintf(host_path, sizeof(host_path), "%s/%s", root, relative);
+    
+    // Kesilen üst katman dosyasının boyutu kullanımdan düşülür
+    struct stat st;
+    int truncating = layer == OVERLAY_LAYER_UPPER && (flags & O_TRUNC) && (flags & (O_WRONLY | O_RDWR)) &&
+                     stat(host_path, &st) == 0 && S_ISREG(st.st_mode);
+    
+    int fd = open(host_path, flags, mode);
+    if (fd < 0) {
+        return OVERLAY_ERROR_IO;
+    }
+    
+    if (truncating) {
+        overlay_charge(overlay, -(int64_t)st.st_size);
+    }
+    
+    return fd;
+}
+
+// Dosya bilgilerini al
+int overlay_stat(overlay_t* overlay, const char* path, struct stat* st) {
+    char host_path[OVERLAY_PATH_MAX * 2];
+    
+    if (!st) {
+        return OVERLAY_ERROR_INVALID;
+    }
+    
+    int layer = overlay_lookup(overlay, path, host_path, sizeof(host_path));
+    if (layer < 0) {
+        return layer;
+    }
+    
+    return stat(host_path, st) == 0 ? 0 : OVERLAY_ERROR_IO;
+}
+
+// Dosya sil; alt katmanda da varsa beyaz çıkış bırakılır
+int overlay_unlink(overlay_t* overlay, const char* path) {
+    char relative[OVERLAY_PATH_MAX];
+    char host_path[OVERLAY_PATH_MAX * 2];
+    int32_t lower_index, upper_index;
+    
+    if (!overlay || !path || overlay_normalize(path, relative, sizeof(relative)) != 0 || relative[0] == '\0') {
+        return OVERLAY_ERROR_INVALID;
+    }
+    
+    pthread_mutex_lock(&overlay->lock);
+    
+    int layer = overlay_resolve(overlay, relative, &lower_index, &upper_index);
+    if (layer < 0) {
+        pthread_mutex_unlock(&overlay->lock);
+        return layer;
+    }
+    
+    mode_t mode = (layer == OVERLAY_LAYER_UPPER) ? overlay->upper.entries[upper_index].mode
+                                                 : overlay->lower->table.entries[lower_index].mode;
+    if (S_ISDIR(mode)) {
+        pthread_mutex_unlock(&overlay->lock);
+        return OVERLAY_ERROR_INVALID;  // Dizinler bu yoldan silinmez
+    }
+    
+    if (layer == OVERLAY_LAYER_UPPER) {
+        struct stat st;
+        snprintf(host_path, sizeof(host_path), "%s/%s", overlay->upper_root, relative);
+        if (lstat(host_path, &st) != 0 || unlink(host_path) != 0) {
+            pthread_mutex_unlock(&overlay->lock);
+            return OVERLAY_ERROR_IO;
+        }
+        if (S_ISREG(st.st_mode)) {
+            overlay_charge(overlay, -(int64_t)st.st_size);
+        }
+    }
+    
+    // Alt katman kopyası görünür kalacaksa gizle
+    if (lower_index >= 0) {
+        if (overlay_make_parents(overlay, relative) != 0 ||
+            overlay_write_marker(overlay, relative, NULL) != 0) {
+            pthread_mutex_unlock(&overlay->lock);
+            return OVERLAY_ERROR_IO;
+        }
+        if (upper_index < 0) {
+            upper_index = overlay_table_add(&overlay->upper, relative, mode, OVERLAY_STATE_WHITEOUT);
+            if (upper_index < 0) {
+                pthread_mutex_unlock(&overlay->lock);
+                return OVERLAY_ERROR_NO_MEMORY;
+            }
+        }
+        overlay->upper.entries[upper_index].state = OVERLAY_STATE_WHITEOUT;
+        overlay->whiteouts++;
+    } else if (upper_index >= 0) {
+        overlay->upper.entries[upper_index].state = OVERLAY_STATE_WHITEOUT;
+    }
+    
+    pthread_mutex_unlock(&overlay->lock);
+    
+    return 0;
+}
+
+// Dizin oluştur; silinmiş bir alt katman dizininin yerine gelirse opak olur
+int overlay_mkdir(overlay_t* overlay, const char* path, mode_t mode) {
+    char relative[OVERLAY_PATH_MAX];
+    char host_path[OVERLAY_PATH_MAX * 2];
+    int32_t lower_index, upper_index;
+    
+    if (!overlay || !path || overlay_normalize(path, relative, sizeof(relative)) != 0 || relative[0] == '\0') {
+        return OVERLAY_ERROR_INVALID;
+    }
+    
+    pthread_mutex_lock(&overlay->lock);
+    
+    int layer = overlay_resolve(overlay, relative, &lower_index, &upper_index);
+    if (layer > 0) {
+        pthread_mutex_unlock(&overlay->lock);
+        return OVERLAY_ERROR_EXISTS;
+    }
+    
+    if (overlay_make_parents(overlay, relative) != 0) {
+        pthread_mutex_unlock(&overlay->lock);
+        return OVERLAY_ERROR_NOT_FOUND;
+    }
+    
+    snprintf(host_path, sizeof(host_path), "%s/%s", overlay->upper_root, relative);
+    if (mkdir(host_path, mode) != 0) {
+        pthread_mutex_unlock(&overlay->lock);
+        return OVERLAY_ERROR_IO;
+    }
+    
+    uint8_t state = OVERLAY_STATE_PRESENT;
+    if (upper_index >= 0 && overlay->upper.entries[upper_index].state == OVERLAY_STATE_WHITEOUT) {
+        // Eski beyaz çıkışı kaldır
+        if (overlay_whiteout_path(overlay, relative, host_path, sizeof(host_path)) == 0) {
+            unlink(host_path);
+        }
+        
+        // Alt katmanda aynı adlı dizin varsa içeriği görünmemeli
+        if (lower_index >= 0) {
+            overlay_write_marker(overlay, relative, OVERLAY_OPAQUE_MARKER);
+            state = OVERLAY_STATE_OPAQUE;
+        }
+    }
+    
+    if (upper_index >= 0) {
+        overlay->upper.entries[upper_index].state = state;
+        overlay->upper.entries[upper_index].mode = S_IFDIR | (mode & 07777);
+    } else if (overlay_table_add(&overlay->upper, relative, S_IFDIR | (mode & 07777), state) < 0) {
+        pthread_mutex_unlock(&overlay->lock);
+        return OVERLAY_ERROR_NO_MEMORY;
+    }
+    
+    pthread_mutex_unlock(&overlay->lock);
+    
+    return 0;
+}
+
+// Dizin içeriğini listele (üst katman girdileri alt katmandakileri gölgeler)
+int overlay_readdir(overlay_t* overlay, const char* path,
+                    int (*callback)(const char* name, mode_t mode, void* user_data), void* user_data) {
+    char relative[OVERLAY_PATH_MAX];
+    char host_path[OVERLAY_PATH_MAX * 2];
+    int32_t lower_index, upper_index;
+    
+    if (!overlay || !path || !callback || overlay_normalize(path, relative, sizeof(relative)) != 0) {
+        return OVERLAY_ERROR_INVALID;
+    }
+    
+    pthread_mutex_lock(&overlay->lock);
+    
+    int layer = overlay_resolve(overlay, relative, &lower_index, &upper_index);
+    if (layer < 0) {
+        pthread_mutex_unlock(&overlay->lock);
+        return layer;
+    }
+    
+    uint32_t prefix_length = (uint32_t)strlen(relative);
+    int stop = 0;
+    
+    // Üst katman: ana sistem dizininden oku, beyaz çıkış dosyalarını atla
+    if (upper_index >= 0 || prefix_length == 0) {
+        snprintf(host_path, sizeof(host_path), "%s/%s", overlay->upper_root, relative);
+        DIR* dir = opendir(host_path);
+        struct dirent* item;
+        while (dir && !stop && (item = readdir(dir)) != NULL) {
+            if (item->d_name[0] == '.' && (item->d_name[1] == '\0' ||
+                (item->d_name[1] == '.' && item->d_name[2] == '\0'))) {
+                continue;
+            }
+            if (strncmp(item->d_name, OVERLAY_WHITEOUT_PREFIX, strlen(OVERLAY_WHITEOUT_PREFIX)) == 0) {
+                continue;
+            }
+            
+            char child[OVERLAY_PATH_MAX * 2];
+            snprintf(child, sizeof(child), "%s%s%s", relative, prefix_length ? "/" : "", item->d_name);
+            int32_t index = overlay_table_find(&overlay->upper, child, (uint32_t)strlen(child));
+            mode_t mode = index >= 0 ? overlay->upper.entries[index].mode : 0;
+            stop = callback(item->d_name, mode, user_data) != 0;
+        }
+        if (dir) {
+            closedir(dir);
+        }
+    }
+    
+    // Alt katman: önceden kurulmuş çocuk listesini dolaş
+    if (lower_index >= 0 && !stop &&
+        !(upper_index >= 0 && overlay->upper.entries[upper_index].state == OVERLAY_STATE_OPAQUE)) {
+        const overlay_table_t* table = &overlay->lower->table;
+        for (int32_t i = table->entries[lower_index].first_child; i >= 0 && !stop; i = table->entries[i].next_sibling) {
+            const overlay_entry_t* entry = &table->entries[i];
+            
+            // Üst katmanda varsa ya da silinmişse atla
+            if (overlay_table_find(&overlay->upper, entry->path, (uint32_t)strlen(entry->path)) >= 0) {
+                continue;
+            }
+            
+            const char* name = strrchr(entry->path, '/');
+            stop = callback(name ? name + 1 : entry->path, entry->mode, user_data) != 0;
+        }
+    }
+    
+    pthread_mutex_unlock(&overlay->lock);
+    
+    return 0;
+}
+
+// Üst katman dosyasına yaz; dosyayı büyüten kısım önce kotadan ayrılır
+ssize_t overlay_write(overlay_t* overlay, int fd, const void* buffer, size_t size) {
+    struct stat st;
+    
+    if (!overlay || fd < 0 || (!buffer && size > 0)) {
+        return OVERLAY_ERROR_INVALID;
+    }
+    
+    if (fstat(fd, &st) != 0) {
+        return OVERLAY_ERROR_IO;
+    }
+    
+    // Yazmanın biteceği konum
+    int flags = fcntl(fd, F_GETFL);
+    off_t position = (flags & O_APPEND) ? st.st_size : lseek(fd, 0, SEEK_CUR);
+    if (flags < 0 || position < 0) {
+        return OVERLAY_ERROR_IO;
+    }
+    
+    int64_t growth = (int64_t)position + (int64_t)size - (int64_t)st.st_size;
+    if (growth < 0) {
+        growth = 0;
+    }
+    
+    if (growth > 0 && overlay_charge(overlay, growth) != 0) {
+        return OVERLAY_ERROR_NO_SPACE;
+    }
+    
+    ssize_t written = write(fd, buffer, size);
+    
+    // Kısmi ya da başarısız yazmada fazla ayrılan kısmı geri ver
+    int64_t actual = written > 0 ? (int64_t)position + written - (int64_t)st.st_size : 0;
+    if (actual < 0) {
+        actual = 0;
+    }
+    if (actual != growth) {
+        overlay_charge(overlay, actual - growth);
+    }
+    
+    return written < 0 ? OVERLAY_ERROR_IO : written;
+}
+
+// Üst katman dosyasının boyutunu değiştir
+int overlay_truncate(overlay_t* overlay, int fd, off_t length) {
+    struct stat st;
+    
+    if (!overlay || fd < 0 || length < 0) {
+        return OVERLAY_ERROR_INVALID;
+    }
+    
+    if (fstat(fd, &st) != 0) {
+        return OVERLAY_ERROR_IO;
+    }
+    
+    int64_t delta = (int64_t)length - (int64_t)st.st_size;
+    if (delta > 0 && overlay_charge(overlay, delta) != 0) {
+        return OVERLAY_ERROR_NO_SPACE;
+    }
+    
+    if (ftruncate(fd, length) != 0) {
+        if (delta > 0) {
+            overlay_charge(overlay, -delta);
+        }
+        return OVERLAY_ERROR_IO;
+    }
+    
+    if (delta < 0) {
+        overlay_charge(overlay, delta);
+    }
+    
+    return 0;
+}
+
+// Üst katman disk kotasını ayarla (mevcut kullanım kotayı aşsa bile kabul edilir;
+// yalnızca yeni büyümeler reddedilir)
+int overlay_set_quota(overlay_t* overlay, uint64_t quota_bytes) {
+    if (!overlay) {
+        return OVERLAY_ERROR_INVALID;
+    }
+    
+    __atomic_store_n(&overlay->quota_bytes, quota_bytes, __ATOMIC_RELAXED);
+    
+    return 0;
+}
+
+// İstatistikleri al
+int overlay_get_stats(overlay_t* overlay, overlay_stats_t* stats) {
+    if (!overlay || !stats) {
+        return OVERLAY_ERROR_INVALID;
+    }
+    
+    pthread_mutex_lock(&lower_lock);
+    stats->lower_entries = overlay->lower->table.count;
+    stats->lower_refs = overlay->lower->refs;
+    pthread_mutex_unlock(&lower_lock);
+    
+    pthread_mutex_lock(&overlay->lock);
+    stats->upper_entries = overlay->upper.count;
+    stats->copy_ups = overlay->copy_ups;
+    stats->copy_up_bytes = overlay->copy_up_bytes;
+    stats->whiteouts = overlay->whiteouts;
+    stats->upper_bytes = __atomic_load_n(&overlay->upper_bytes, __ATOMIC_RELAXED);
+    stats->quota_bytes = overlay->quota_bytes;
+    pthread_mutex_unlock(&overlay->lock);
+    
+    return 0;
+}
+
+// FNV-1a yol özeti
+static uint32_t overlay_hash(const char* path, uint32_t length) {
+    uint32_t hash = 2166136261u;
+    for (uint32_t i = 0; i < length; i++) {
+        hash ^= (uint8_t)path[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Karma tabloyu hazırla (kova sayısı ikinin kuvveti olmalı)
+static int overlay_table_init(overlay_table_t* table, uint32_t bucket_count) {
+    memset(table, 0, sizeof(overlay_table_t));
+    table->buckets = (int32_t*)malloc(sizeof(int32_t) * bucket_count);
+    if (!table->buckets) {
+        return OVERLAY_ERROR_NO_MEMORY;
+    }
+    memset(table->buckets, 0xFF, sizeof(int32_t) * bucket_count);
+    table->bucket_count = bucket_count;
+    return 0;
+}
+
+// Karma tabloyu serbest bırak
+static void overlay_table_free(overlay_table_t* table) {
+    for (uint32_t i = 0; i < table->count; i++) {
+        free(table->entries[i].path);
+    }
+    free(table->entries);
+    free(table->buckets);
+    memset(table, 0, sizeof(overlay_table_t));
+}
+
+// Yola göre girdi ara
+static int32_t overlay_table_find(const overlay_table_t* table, const char* path, uint32_t length) {
+    uint32_t hash = overlay_hash(path, length);
+    
+    for (int32_t i = table->buckets[hash & (table->bucket_count - 1)]; i >= 0; i = table->entries[i].next) {
+        const overlay_entry_t* entry = &table->entries[i];
+        if (entry->hash == hash && strncmp(entry->path, path, length) == 0 && entry->path[length] == '\0') {
+            return i;
+        }
+    }
+    
+    return -1;
+}
+
+// Tabloya girdi ekle; doluluk oranı 1'i geçince kovaları iki katına çıkar
+static int32_t overlay_table_add(overlay_table_t* table, const char* path, mode_t mode, uint8_t state) {
+    if (table->count == table->capacity) {
+        uint32_t capacity = table->capacity ? table->capacity * 2 : 64;
+        overlay_entry_t* entries = (overlay_entry_t*)realloc(table->entries, sizeof(overlay_entry_t) * capacity);
+        if (!entries) {
+            return -1;
+        }
+        table->entries = entries;
+        table->capacity = capacity;
+    }
+    
+    if (table->count >= table->bucket_count) {
+        uint32_t bucket_count = table->bucket_count * 2;
+        int32_t* buckets = (int32_t*)malloc(sizeof(int32_t) * bucket_count);
+        if (!buckets) {
+            return -1;
+        }
+        memset(buckets, 0xFF, sizeof(int32_t) * bucket_count);
+        for (uint32_t i = 0; i < table->count; i++) {
+            uint32_t bucket = table->entries[i].hash & (bucket_count - 1);
+            table->entries[i].next = buckets[bucket];
+            buckets[bucket] = (int32_t)i;
+        }
+        free(table->buckets);
+        table->buckets = buckets;
+        table->bucket_count = bucket_count;
+    }
+    
+    char* copy = strdup(path);
+    if (!copy) {
+        return -1;
+    }
+    
+    int32_t index = (int32_t)table->count++;
+    overlay_entry_t* entry = &table->entries[index];
+    entry->path = copy;
+    entry->hash = overlay_hash(path, (uint32_t)strlen(path));
+    entry->mode = mode;
+    entry->state = state;
+    entry->first_child = -1;
+    entry->next_sibling = -1;
+    
+    uint32_t bucket = entry->hash & (table->bucket_count - 1);
+    entry->next = table->buckets[bucket];
+    table->buckets[bucket] = index;
+    
+    return index;
+}
+
+// Yolu normalleştir: baştaki '/', "//" ve "." atılır; ".." ile kökten çıkış reddedilir
+static int overlay_normalize(const char* path, char* out, uint32_t size) {
+    uint32_t length = 0;
+    
+    while (*path) {
+        while (*path == '/') {
+            path++;
+        }
+        
+        const char* start = path;
+        while (*path && *path != '/') {
+            path++;
+        }
+        uint32_t part = (uint32_t)(path - start);
+        
+        if (part == 0 || (part == 1 && start[0] == '.')) {
+            continue;
+        }
+        if (part == 2 && start[0] == '.' && start[1] == '.') {
+            return OVERLAY_ERROR_INVALID;
+        }
+        if (length + part + 2 > size) {
+            return OVERLAY_ERROR_INVALID;
+        }
+        
+        if (length > 0) {
+            out[length++] = '/';
+        }
+        memcpy(out + length, start, part);
+        length += part;
+    }
+    
+    out[length] = '\0';
+    return 0;
+}
+
+// Alt katman dizinini özyinelemeli tara ve çocuk listelerini kur
+static int overlay_scan_lower(overlay_lower_t* lower, int32_t parent, const char* relative) {
+    char host_path[OVERLAY_PATH_MAX * 2];
+    char child[OVERLAY_PATH_MAX];
+    struct dirent* item;
+    struct stat st;
+    
+    snprintf(host_path, sizeof(host_path), "%s/%s", lower->root, relative);
+    DIR* dir = opendir(host_path);
+    if (!dir) {
+        return OVERLAY_ERROR_IO;
+    }
+    
+    while ((item = readdir(dir)) != NULL) {
+        if (item->d_name[0] == '.' && (item->d_name[1] == '\0' ||
+            (item->d_name[1] == '.' && item->d_name[2] == '\0'))) {
+            continue;
+        }
+        
+        if ((uint32_t)snprintf(child, sizeof(child), "%s%s%s", relative, relative[0] ? "/" : "",
+                               item->d_name) >= sizeof(child)) {
+            continue;  // Çok uzun yollar atlanır
+        }
+        
+        snprintf(host_path, sizeof(host_path), "%s/%s", lower->root, child);
+        if (lstat(host_path, &st) != 0) {
+            continue;
+        }
+        
+        int32_t index = overlay_table_add(&lower->table, child, st.st_mode, OVERLAY_STATE_PRESENT);
+        if (index < 0) {
+            closedir(dir);
+            return OVERLAY_ERROR_NO_MEMORY;
+        }
+        lower->table.entries[index].next_sibling = lower->table.entries[parent].first_child;
+        lower->table.entries[parent].first_child = index;
+        
+        if (S_ISDIR(st.st_mode) && overlay_scan_lower(lower, index, child) != 0) {
+            closedir(dir);
+            return OVERLAY_ERROR_NO_MEMORY;
+        }
+    }
+    
+    closedir(dir);
+    return 0;
+}
+
+// Üst katman dizinini tara; ".wh." dosyaları beyaz çıkış olarak kaydedilir
+static int overlay_scan_upper(overlay_t* overlay, const char* relative) {
+    char host_path[OVERLAY_PATH_MAX * 2];
+    char child[OVERLAY_PATH_MAX];
+    uint32_t prefix = (uint32_t)strlen(OVERLAY_WHITEOUT_PREFIX);
+    struct dirent* item;
+    struct stat st;
+    
+    snprintf(host_path, sizeof(host_path), "%s/%s", overlay->upper_root, relative);
+    DIR* dir = opendir(host_path);
+    if (!dir) {
+        return OVERLAY_ERROR_IO;
+    }
+    
+    while ((item = readdir(dir)) != NULL) {
+        const char* name = item->d_name;
+        uint8_t state = OVERLAY_STATE_PRESENT;
+        
+        if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'))) {
+            continue;
+        }
+        
+        if (strcmp(name, OVERLAY_OPAQUE_MARKER) == 0) {
+            int32_t index = overlay_table_find(&overlay->upper, relative, (uint32_t)strlen(relative));
+            if (index >= 0) {
+                overlay->upper.entries[index].state = OVERLAY_STATE_OPAQUE;
+            }
+            continue;
+        }
+        
+        if (strncmp(name, OVERLAY_WHITEOUT_PREFIX, prefix) == 0) {
+            name += prefix;
+            state = OVERLAY_STATE_WHITEOUT;
+        }
+        
+        if ((uint32_t)snprintf(child, sizeof(child), "%s%s%s", relative, relative[0] ? "/" : "",
+                               name) >= sizeof(child)) {
+            continue;
+        }
+        
+        snprintf(host_path, sizeof(host_path), "%s/%s%s%s", overlay->upper_root, relative,
+                 relative[0] ? "/" : "", item->d_name);
+        if (lstat(host_path, &st) != 0) {
+            continue;
+        }
+        
+        int32_t index = overlay_table_find(&overlay->upper, child, (uint32_t)strlen(child));
+        if (index < 0) {
+            index = overlay_table_add(&overlay->upper, child, st.st_mode, state);
+            if (index < 0) {
+                closedir(dir);
+                return OVERLAY_ERROR_NO_MEMORY;
+            }
+        } else if (state == OVERLAY_STATE_WHITEOUT) {
+            overlay->upper.entries[index].state = state;
+        }
+        
+        if (state == OVERLAY_STATE_PRESENT && S_ISREG(st.st_mode)) {
+            overlay->upper_bytes += (uint64_t)st.st_size;
+        }
+        
+        if (state == OVERLAY_STATE_PRESENT && S_ISDIR(st.st_mode) && overlay_scan_upper(overlay, child) != 0) {
+            closedir(dir);
+            return OVERLAY_ERROR_NO_MEMORY;
+        }
+    }
+    
+    closedir(dir);
+    return 0;
+}
+
+// Alt katmanı kayıttan al; yoksa tek seferlik tarayıp kaydet
+static overlay_lower_t* overlay_lower_acquire(const char* root) {
+    char resolved[OVERLAY_PATH_MAX];
+    
+    if (!realpath(root, resolved)) {
+        return NULL;
+    }
+    
+    pthread_mutex_lock(&lower_lock);
+    
+    for (overlay_lower_t* lower = lower_images; lower; lower = lower->next) {
+        if (strcmp(lower->root, resolved) == 0) {
+            lower->refs++;
+            pthread_mutex_unlock(&lower_lock);
+            return lower;
+        }
+    }
+    
+    overlay_lower_t* lower = (overlay_lower_t*)calloc(1, sizeof(overlay_lower_t));
+    if (!lower || overlay_table_init(&lower->table, 1024) != 0) {
+        free(lower);
+        pthread_mutex_unlock(&lower_lock);
+        return NULL;
+    }
+    strcpy(lower->root, resolved);
+    
+    // Kök girdisi (indeks 0)
+    struct stat st;
+    if (stat(resolved, &st) != 0 || !S_ISDIR(st.st_mode) ||
+        overlay_table_add(&lower->table, "", st.st_mode, OVERLAY_STATE_PRESENT) != 0 ||
+        overlay_scan_lower(lower, 0, "") != 0) {
+        overlay_table_free(&lower->table);
+        free(lower);
+        pthread_mutex_unlock(&lower_lock);
+        return NULL;
+    }
+    
+    lower->refs = 1;
+    lower->next = lower_images;
+    lower_images = lower;
+    
+    pthread_mutex_unlock(&lower_lock);
+    
+    return lower;
+}
+
+// Alt katman referansını bırak; son konteyner çıkınca dizin serbest kalır
+static void overlay_lower_release(overlay_lower_t* lower) {
+    pthread_mutex_lock(&lower_lock);
+    
+    if (--lower->refs == 0) {
+        overlay_lower_t** link = &lower_images;
+        while (*link && *link != lower) {
+            link = &(*link)->next;
+        }
+        if (*link) {
+            *link = lower->next;
+        }
+        overlay_table_free(&lower->table);
+        free(lower);
+    }
+    
+    pthread_mutex_unlock(&lower_lock);
+}
+
+// Yolu katmanlara göre çöz (kilit tutulurken çağrılır)
+static int overlay_resolve(overlay_t* overlay, const char* path, int32_t* lower_index, int32_t* upper_index) {
+    uint32_t length = (uint32_t)strlen(path);
+    int lower_visible = 1;
+    
+    *lower_index = -1;
+    *upper_index = -1;
+    
+    // Üst atalardan biri silinmiş ya da opaksa alt katman görünmez
+    for (uint32_t i = 0; i < length; i++) {
+        if (path[i] != '/') {
+            continue;
+        }
+        int32_t ancestor = overlay_table_find(&overlay->upper, path, i);
+        if (ancestor < 0) {
+            continue;
+        }
+        uint8_t state = overlay->upper.entries[ancestor].state;
+        if (state == OVERLAY_STATE_WHITEOUT) {
+            return OVERLAY_ERROR_NOT_FOUND;
+        }
+        if (state == OVERLAY_STATE_OPAQUE) {
+            lower_visible = 0;
+        }
+    }
+    
+    if (lower_visible) {
+        *lower_index = overlay_table_find(&overlay->lower->table, path, length);
+    }
+    
+    if (length > 0) {
+        *upper_index = overlay_table_find(&overlay->upper, path, length);
+    }
+    
+    if (*upper_index >= 0) {
+        if (overlay->upper.entries[*upper_index].state == OVERLAY_STATE_WHITEOUT) {
+            return OVERLAY_ERROR_NOT_FOUND;
+        }
+        return OVERLAY_LAYER_UPPER;
+    }
+    
+    if (length == 0) {
+        // Kök dizini her iki katmanda da vardır
+        *lower_index = 0;
+        return OVERLAY_LAYER_LOWER;
+    }
+    
+    return *lower_index >= 0 ? OVERLAY_LAYER_LOWER : OVERLAY_ERROR_NOT_FOUND;
+}
+
+// Üst katmanda üst dizinleri oluştur (alt katmandaki izinleri koruyarak)
+static int overlay_make_parents(overlay_t* overlay, const char* path) {
+    char host_path[OVERLAY_PATH_MAX * 2];
+    uint32_t length = (uint32_t)strlen(path);
+    
+    for (uint32_t i = 0; i < length; i++) {
+        if (path[i] != '/') {
+            continue;
+        }
+        
+        int32_t upper = overlay_table_find(&overlay->upper, path, i);
+        if (upper >= 0) {
+            if (overlay->upper.entries[upper].state == OVERLAY_STATE_WHITEOUT) {
+                return OVERLAY_ERROR_NOT_FOUND;
+            }
+            continue;
+        }
+        
+        int32_t lower = overlay_table_find(&overlay->lower->table, path, i);
+        if (lower < 0 || !S_ISDIR(overlay->lower->table.entries[lower].mode)) {
+            return OVERLAY_ERROR_NOT_FOUND;
+        }
+        
+        mode_t mode = overlay->lower->table.entries[lower].mode;
+        snprintf(host_path, sizeof(host_path), "%s/%.*s", overlay->upper_root, (int)i, path);
+        if (mkdir(host_path, mode & 07777) != 0 && errno != EEXIST) {
+            return OVERLAY_ERROR_IO;
+        }
+        
+        char parent[OVERLAY_PATH_MAX];
+        memcpy(parent, path, i);
+        parent[i] = '\0';
+        if (overlay_table_add(&overlay->upper, parent, mode, OVERLAY_STATE_PRESENT) < 0) {
+            return OVERLAY_ERROR_NO_MEMORY;
+        }
+    }
+    
+    return 0;
+}
+
+// Alt katman dosyasını üst katmana kopyala
+static int overlay_copy_up(overlay_t* overlay, const char* path, int32_t lower_index, int truncate) {
+    char source_path[OVERLAY_PATH_MAX * 2];
+    char target_path[OVERLAY_PATH_MAX * 2];
+    char temp_path[OVERLAY_PATH_MAX * 2 + 16];
+    mode_t mode = overlay->lower->table.entries[lower_index].mode;
+    uint64_t copied = 0;
+    
+    if (!S_ISREG(mode)) {
+        return OVERLAY_ERROR_INVALID;  // Yalnızca normal dosyalar kopyalanır
+    }
+    
+    int result = overlay_make_parents(overlay, path);
+    if (result != 0) {
+        return result;
+    }
+    
+    snprintf(source_path, sizeof(source_path), "%s/%s", overlay->lower->root, path);
+    snprintf(target_path, sizeof(target_path), "%s/%s", overlay->upper_root, path);
+    snprintf(temp_path, sizeof(temp_path), "%s.copyup", target_path);
+    
+    // Yarım kalmış kopya görünmesin diye geçici dosyaya yazıp yeniden adlandır
+    int target = open(temp_path, O_WRONLY | O_CREAT | O_TRUNC, mode & 07777);
+    if (target < 0) {
+        return OVERLAY_ERROR_IO;
+    }
+    
+    if (!truncate) {
+        struct stat st;
+        int source = open(source_path, O_RDONLY);
+        if (source < 0 || fstat(source, &st) != 0) {
+            if (source >= 0) {
+                close(source);
+            }
+            close(target);
+            unlink(temp_path);
+            return OVERLAY_ERROR_IO;
+        }
+        
+        // Kopyalanacak veri kotaya sığmalı
+        if (overlay_charge(overlay, st.st_size) != 0) {
+            close(source);
+            close(target);
+            unlink(temp_path);
+            return OVERLAY_ERROR_NO_SPACE;
+        }
+        
+        char* buffer = (char*)malloc(OVERLAY_COPY_CHUNK);
+        ssize_t count = 0;
+        while (buffer && (count = read(source, buffer, OVERLAY_COPY_CHUNK)) > 0) {
+            if (write(target, buffer, (size_t)count) != count) {
+                count = -1;
+                break;
+            }
+            copied += (uint64_t)count;
+        }
+        free(buffer);
+        close(source);
+        
+        if (!buffer || count < 0) {
+            overlay_charge(overlay, -(int64_t)st.st_size);
+            close(target);
+            unlink(temp_path);
+            return buffer ? OVERLAY_ERROR_IO : OVERLAY_ERROR_NO_MEMORY;
+        }
+        
+        // Okuma sırasında boyut değiştiyse düzelt
+        overlay_charge(overlay, (int64_t)copied - (int64_t)st.st_size);
+    }
+    
+    close(target);
+    
+    if (rename(temp_path, target_path) != 0) {
+        overlay_charge(overlay, -(int64_t)copied);
+        unlink(temp_path);
+        return OVERLAY_ERROR_IO;
+    }
+    
+    if (overlay_table_add(&overlay->upper, path, mode, OVERLAY_STATE_PRESENT) < 0) {
+        overlay_charge(overlay, -(int64_t)copied);
+        unlink(target_path);
+        return OVERLAY_ERROR_NO_MEMORY;
+    }
+    
+    overlay->copy_ups++;
+    overlay->copy_up_bytes += copied;
+    
+    return 0;
+}
+
+// Beyaz çıkış (marker NULL) ya da dizin içine opak işaret dosyası yaz
+static int overlay_write_marker(overlay_t* overlay, const char* path, const char* marker) {
+    char host_path[OVERLAY_PATH_MAX * 2];
+    
+    // Kesilen yol başka bir dosyayı işaretlememeli
+    if (marker) {
+        if ((uint32_t)snprintf(host_path, sizeof(host_path), "%s/%s/%s",
+                               overlay->upper_root, path, marker) >= sizeof(host_path)) {
+            return OVERLAY_ERROR_INVALID;
+        }
+    } else if (overlay_whiteout_path(overlay, path, host_path, sizeof(host_path)) != 0) {
+        return OVERLAY_ERROR_INVALID;
+    }
+    
+    int fd = open(host_path, O_WRONLY | O_CREAT | O_TRUNC, 0000);
+    if (fd < 0) {
+        return OVERLAY_ERROR_IO;
+    }
+    close(fd);
+    
+    return 0;
+}
+
+// Beyaz çıkış dosyasının yolunu oluştur ("dir/name" -> "<upper>/dir/.wh.name")
+static int overlay_whiteout_path(overlay_t* overlay, const char* path, char* out, uint32_t size) {
+    const char* name = strrchr(path, '/');
+    int length;
+    
+    if (name) {
+        length = snprintf(out, size, "%s/%.*s/" OVERLAY_WHITEOUT_PREFIX "%s",
+                          overlay->upper_root, (int)(name - path), path, name + 1);
+    } else {
+        length = snprintf(out, size, "%s/" OVERLAY_WHITEOUT_PREFIX "%s", overlay->upper_root, path);
+    }
+    
+    return ((uint32_t)length < size) ? 0 : OVERLAY_ERROR_INVALID;
+}
+
+// Üst katman kullanımını güncelle; artış kotayı aşarsa geri alınır
+static int overlay_charge(overlay_t* overlay, int64_t delta) {
+    uint64_t usage = __atomic_add_fetch(&overlay->upper_bytes, (uint64_t)delta, __ATOMIC_RELAXED);
+    uint64_t quota = __atomic_load_n(&overlay->quota_bytes, __ATOMIC_RELAXED);
+    
+    if (delta > 0 && quota && usage > quota) {
+        __atomic_sub_fetch(&overlay->upper_bytes, (uint64_t)delta, __ATOMIC_RELAXED);
+        return OVERLAY_ERROR_NO_SPACE;
+    }
+    
+    return 0;
+}
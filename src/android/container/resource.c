@@ -0,0 +1,253 @@
+#include "../../include/android/container_resource.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <pthread.h>
+
+// Konteyner kaynak grubu
+struct container_resource {
+    // Bellek (sayfa cinsinden, atomik)
+    uint64_t memory_pages;
+    uint64_t memory_peak_pages;
+    uint64_t memory_limit_pages;
+    uint64_t memory_failures;
+    
+    // CPU bant genişliği
+    pthread_mutex_t cpu_lock;
+    uint64_t cpu_quota_us;         // Dönem başına izin verilen süre (0 = sınırsız)
+    uint64_t cpu_period_us;
+    uint64_t period_start_us;      // Geçerli dönemin başlangıcı
+    uint64_t period_runtime_us;    // Geçerli dönemde kullanılan süre
+    uint8_t period_throttled;      // Geçerli dönem kısıtlandı mı
+    uint64_t cpu_time_us;
+    float cpu_percent;
+    uint64_t cpu_periods;
+    uint64_t cpu_throttled;
+    uint64_t cpu_throttled_us;     // Atomik
+    
+    // İşlemler (atomik)
+    uint32_t processes;
+    uint32_t process_limit;
+};
+
+// Yardımcı fonksiyonlar
+static uint64_t resource_now_us(clockid_t clock);
+static void resource_cpu_refill(container_resource_t* group, uint64_t now);
+
+// Kaynak grubu oluştur
+container_resource_t* resource_group_create(const container_limits_t* limits) {
+    container_resource_t* group = (container_resource_t*)calloc(1, sizeof(container_resource_t));
+    if (!group) {
+        return NULL;
+    }
+    
+    pthread_mutex_init(&group->cpu_lock, NULL);
+    group->cpu_period_us = RESOURCE_CPU_PERIOD_US;
+    group->period_start_us = resource_now_us(CLOCK_MONOTONIC);
+    
+    if (limits) {
+        resource_set_limits(group, limits);
+    }
+    
+    return group;
+}
+
+// Kaynak grubunu yok et
+void resource_group_destroy(container_resource_t* group) {
+    if (!group) {
+        return;
+    }
+    
+    pthread_mutex_destroy(&group->cpu_lock);
+    free(group);
+}
+
+// Sınırları ayarla; mevcut kullanım yeni sınırı aşıyorsa yalnızca yeni
+// ücretlendirmeler reddedilir
+int resource_set_limits(container_resource_t* group, const container_limits_t* limits) {
+    if (!group || !limits) {
+        return RESOURCE_ERROR_INVALID;
+    }
+    
+    __atomic_store_n(&group->memory_limit_pages,
+                     (uint64_t)limits->max_memory_mb * (1024 * 1024 / RESOURCE_PAGE_SIZE), __ATOMIC_RELAXED);
+    __atomic_store_n(&group->process_limit, limits->max_processes, __ATOMIC_RELAXED);
+    
+    pthread_mutex_lock(&group->cpu_lock);
+    group->cpu_quota_us = group->cpu_period_us * limits->max_cpu_percent / 100;
+    pthread_mutex_unlock(&group->cpu_lock);
+    
+    return 0;
+}
+
+// Sayfa ücretlendir; sınır aşılacaksa hiçbir sayfa ücretlendirilmez
+int resource_charge_pages(container_resource_t* group, uint64_t pages) {
+    if (!group) {
+        return RESOURCE_ERROR_INVALID;
+    }
+    
+    uint64_t limit = __atomic_load_n(&group->memory_limit_pages, __ATOMIC_RELAXED);
+    uint64_t current = __atomic_load_n(&group->memory_pages, __ATOMIC_RELAXED);
+    uint64_t next;
+    
+    do {
+        next = current + pages;
+        if (limit && next > limit) {
+            __atomic_add_fetch(&group->memory_failures, 1, __ATOMIC_RELAXED);
+            return RESOURCE_ERROR_LIMIT;
+        }
+    } while (!__atomic_compare_exchange_n(&group->memory_pages, &current, next, 1,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+    
+    // En yüksek kullanımı güncelle
+    uint64_t peak = __atomic_load_n(&group->memory_peak_pages, __ATOMIC_RELAXED);
+    while (next > peak &&
+           !__atomic_compare_exchange_n(&group->memory_peak_pages, &peak, next, 1,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+    
+    return 0;
+}
+
+// Sayfa ücretini geri al
+void resource_uncharge_pages(container_resource_t* group, uint64_t pages) {
+    if (group) {
+        __atomic_sub_fetch(&group->memory_pages, pages, __ATOMIC_RELAXED);
+    }
+}
+
+// Çalışma süresini ücretlendir; kota bittiyse çağıran iş parçacığı dönem
+// sonuna kadar uyur. Kısıtlandıysa 1 döner.
+int resource_cpu_charge(container_resource_t* group, uint64_t runtime_us) {
+    if (!group) {
+        return RESOURCE_ERROR_INVALID;
+    }
+    
+    pthread_mutex_lock(&group->cpu_lock);
+    
+    uint64_t now = resource_now_us(CLOCK_MONOTONIC);
+    resource_cpu_refill(group, now);
+    
+    group->cpu_time_us += runtime_us;
+    group->period_runtime_us += runtime_us;
+    
+    if (!group->cpu_quota_us || group->period_runtime_us < group->cpu_quota_us) {
+        pthread_mutex_unlock(&group->cpu_lock);
+        return 0;
+    }
+    
+    // Kota bitti: bu dönemin sonunu bekle
+    uint64_t wake = group->period_start_us + group->cpu_period_us;
+    if (!group->period_throttled) {
+        group->period_throttled = 1;
+        group->cpu_throttled++;
+    }
+    
+    pthread_mutex_unlock(&group->cpu_lock);
+    
+    struct timespec deadline;
+    deadline.tv_sec = (time_t)(wake / 1000000);
+    deadline.tv_nsec = (long)(wake % 1000000) * 1000;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR) {
+    }
+    
+    __atomic_add_fetch(&group->cpu_throttled_us, wake - now, __ATOMIC_RELAXED);
+    
+    return 1;
+}
+
+// İş parçacığının çalışma dilimini başlat
+void resource_cpu_slice_begin(resource_cpu_slice_t* slice) {
+    if (slice) {
+        slice->last_cpu_us = resource_now_us(CLOCK_THREAD_CPUTIME_ID);
+    }
+}
+
+// Güvenli noktada çağrılır: son kontrol noktasından beri harcanan iş
+// parçacığı CPU süresini ücretlendirir
+int resource_cpu_checkpoint(container_resource_t* group, resource_cpu_slice_t* slice) {
+    if (!group || !slice) {
+        return RESOURCE_ERROR_INVALID;
+    }
+    
+    uint64_t now = resource_now_us(CLOCK_THREAD_CPUTIME_ID);
+    uint64_t runtime = now - slice->last_cpu_us;
+    slice->last_cpu_us = now;
+    
+    return resource_cpu_charge(group, runtime);
+}
+
+// İşlem ücretlendir
+int resource_charge_process(container_resource_t* group) {
+    if (!group) {
+        return RESOURCE_ERROR_INVALID;
+    }
+    
+    uint32_t limit = __atomic_load_n(&group->process_limit, __ATOMIC_RELAXED);
+    uint32_t current = __atomic_load_n(&group->processes, __ATOMIC_RELAXED);
+    
+    do {
+        if (limit && current >= limit) {
+            return RESOURCE_ERROR_LIMIT;
+        }
+    } while (!__atomic_compare_exchange_n(&group->processes, &current, current + 1, 1,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+    
+    return 0;
+}
+
+// İşlem ücretini geri al
+void resource_uncharge_process(container_resource_t* group) {
+    if (group) {
+        __atomic_sub_fetch(&group->processes, 1, __ATOMIC_RELAXED);
+    }
+}
+
+// Kullanım bilgisini al
+int resource_get_usage(container_resource_t* group, container_resource_usage_t* usage) {
+    if (!group || !usage) {
+        return RESOURCE_ERROR_INVALID;
+    }
+    
+    usage->memory_bytes = __atomic_load_n(&group->memory_pages, __ATOMIC_RELAXED) * RESOURCE_PAGE_SIZE;
+    usage->memory_peak_bytes = __atomic_load_n(&group->memory_peak_pages, __ATOMIC_RELAXED) * RESOURCE_PAGE_SIZE;
+    usage->memory_failures = __atomic_load_n(&group->memory_failures, __ATOMIC_RELAXED);
+    usage->processes = __atomic_load_n(&group->processes, __ATOMIC_RELAXED);
+    usage->cpu_throttled_us = __atomic_load_n(&group->cpu_throttled_us, __ATOMIC_RELAXED);
+    
+    pthread_mutex_lock(&group->cpu_lock);
+    resource_cpu_refill(group, resource_now_us(CLOCK_MONOTONIC));
+    usage->cpu_time_us = group->cpu_time_us;
+    usage->cpu_percent = group->cpu_percent;
+    usage->cpu_periods = group->cpu_periods;
+    usage->cpu_throttled = group->cpu_throttled;
+    pthread_mutex_unlock(&group->cpu_lock);
+    
+    return 0;
+}
+
+// Saati mikrosaniye olarak oku
+static uint64_t resource_now_us(clockid_t clock) {
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+// Dönem bittiyse kotayı yenile (cpu_lock tutulurken çağrılır). Kontrol noktaları
+// arasında kotayı aşan süre borç olarak sonraki döneme devreder; böylece uzun
+// vadeli ortalama sınırın üstüne çıkmaz.
+static void resource_cpu_refill(container_resource_t* group, uint64_t now) {
+    if (now < group->period_start_us + group->cpu_period_us) {
+        return;
+    }
+    
+    uint64_t elapsed = (now - group->period_start_us) / group->cpu_period_us;
+    uint64_t allowance = group->cpu_quota_us ? group->cpu_quota_us * elapsed : group->period_runtime_us;
+    
+    group->cpu_percent = (float)group->period_runtime_us * 100.0f / (float)(group->cpu_period_us * elapsed);
+    group->period_runtime_us = group->period_runtime_us > allowance ? group->period_runtime_us - allowance : 0;
+    group->period_start_us += elapsed * group->cpu_period_us;
+    group->period_throttled = 0;
+    group->cpu_periods += elapsed;
+}
@@ -0,0 +1,1432 @@
+#include "../../include/android/apk_install.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/sendfile.h>
+
+#if defined(__i386__) || defined(__x86_64__)
+#define APK_INSTALL_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#define APK_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+// ZIP yapıları
+#define APK_ZIP_EOCD_SIGNATURE       0x06054b50
+#define APK_ZIP_CENTRAL_SIGNATURE    0x02014b50
+#define APK_ZIP_LOCAL_SIGNATURE      0x04034b50
+#define APK_ZIP_EOCD_SIZE            22
+#define APK_ZIP_CENTRAL_SIZE         46
+#define APK_ZIP_LOCAL_SIZE           30
+#define APK_ZIP_COMMENT_MAX          0xFFFF
+#define APK_ZIP_STORED               0
+#define APK_ZIP_DEFLATED             8
+
+// APK imza bloğu (merkezi dizinin hemen önünde)
+#define APK_SIG_BLOCK_MAGIC          "APK Sig Block 42"
+#define APK_SIG_V2_ID                0x7109871a
+#define APK_SIG_V3_ID                0xf05368c0
+
+#define APK_INFLATE_FAST_BITS        10      // Tek bakışta çözülen kod uzunluğu
+#define APK_INFLATE_MAX_SYMBOLS      288
+
+// İş türleri
+typedef enum {
+    APK_JOB_EXTRACT,                // Girdiyi hazırlık dizinine çıkar
+    APK_JOB_DIGEST                  // İmza özeti parçası
+} apk_job_kind_t;
+
+typedef struct {
+    apk_job_kind_t kind;
+    uint32_t method;
+    uint32_t crc;
+    uint64_t offset;                // Verinin APK içindeki ofseti
+    uint32_t compressed_size;
+    uint32_t size;
+    mode_t mode;
+    char* path;                     // Çıkarma hedefi (hazırlık dizininde)
+    const uint8_t* data;            // Özet parçası
+    uint8_t* digest;                // Parça özetinin yazılacağı yer
+} apk_job_t;
+
+// Kurulum bağlamı; iş parçacıkları yalnızca next ve status'u paylaşır
+typedef struct {
+    int fd;
+    const uint8_t* base;
+    size_t size;
+    apk_job_t* jobs;
+    uint32_t job_count;
+    uint32_t job_capacity;
+    uint32_t next;
+    int status;
+} apk_context_t;
+
+// Kanonik Huffman kodu
+typedef struct {
+    uint16_t fast[1 << APK_INFLATE_FAST_BITS];     // (sembol << 4) | uzunluk, 0: uzun kod
+    uint16_t count[16];
+    uint16_t symbol[APK_INFLATE_MAX_SYMBOLS];
+} apk_huffman_t;
+
+// Açma durumu
+typedef struct {
+    const uint8_t* in;
+    size_t in_size;
+    size_t in_pos;
+    uint64_t bits;
+    uint32_t bit_count;
+    uint8_t* out;
+    size_t out_size;
+    size_t out_pos;
+} apk_inflate_t;
+
+typedef struct {
+    uint32_t state[8];
+    uint64_t length;
+    uint8_t buffer[64];
+    uint32_t used;
+} apk_sha256_t;
+
+static const uint16_t apk_length_base[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const uint8_t apk_length_extra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const uint16_t apk_distance_base[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+static const uint8_t apk_distance_extra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+static const uint32_t apk_sha256_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+// Tablolar ilk kurulumda bir kez hazırlanır
+static pthread_once_t apk_tables_once = PTHREAD_ONCE_INIT;
+static uint32_t apk_crc_table[8][256];
+static apk_huffman_t apk_fixed_lengths;
+static apk_huffman_t apk_fixed_distances;
+
+// Yardımcı fonksiyonlar
+static void apk_init_tables(void);
+static int apk_plan(apk_context_t* context, const char* staging, const char* abi,
+                    uint8_t** digests, uint8_t* expected, apk_install_stats_t* stats);
+static int apk_plan_signature(apk_context_t* context, uint64_t central_offset, uint64_t central_size,
+                              uint64_t eocd_offset, uint8_t** digests, uint8_t* expected, apk_install_stats_t* stats);
+static int apk_classify(const char* name, uint32_t length, const char* abi, apk_install_stats_t* stats);
+static int apk_safe_name(const char* name, uint32_t length);
+static int apk_make_parents(char* path, size_t root_length, char* last);
+static apk_job_t* apk_add_job(apk_context_t* context);
+static int apk_compare_paths(const void* a, const void* b);
+static int apk_compare_jobs(const void* a, const void* b);
+static void* apk_worker(void* arg);
+static int apk_run_job(apk_context_t* context, apk_job_t* job);
+static int apk_extract(apk_context_t* context, apk_job_t* job);
+static int apk_commit(const char* staging, const char* target_dir);
+static int apk_remove_tree(const char* path);
+static int apk_inflate(const uint8_t* in, size_t in_size, uint8_t* out, size_t out_size);
+static int apk_inflate_block(apk_inflate_t* state, const apk_huffman_t* lengths, const apk_huffman_t* distances);
+static int apk_inflate_dynamic(apk_inflate_t* state, apk_huffman_t* lengths, apk_huffman_t* distances);
+static void apk_huffman_build(apk_huffman_t* code, const uint8_t* lengths, uint32_t count);
+static uint32_t apk_crc32(const uint8_t* data, size_t size);
+static void apk_sha256_init(apk_sha256_t* context);
+static void apk_sha256_update(apk_sha256_t* context, const uint8_t* data, size_t size);
+static void apk_sha256_final(apk_sha256_t* context, uint8_t digest[32]);
+static void apk_sha256_blocks_scalar(uint32_t state[8], const uint8_t* data, size_t count);
+static void apk_sha256_block(uint32_t state[8], const uint8_t* block);
+#ifdef APK_INSTALL_X86
+static void apk_sha256_blocks_shani(uint32_t state[8], const uint8_t* data, size_t count);
+#endif
+static double apk_now(void);
+
+// SHA-256 blok işleyici; SHA uzantısı varsa donanım sürümü seçilir
+static void (*apk_sha256_blocks)(uint32_t state[8], const uint8_t* data, size_t count) = apk_sha256_blocks_scalar;
+
+static inline uint16_t apk_u16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline uint32_t apk_u32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline uint64_t apk_u64(const uint8_t* p) {
+    return (uint64_t)apk_u32(p) | ((uint64_t)apk_u32(p + 4) << 32);
+}
+
+static inline void apk_put_u32(uint8_t* p, uint32_t value) {
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+}
+
+// APK'yı kur
+int apk_install(const char* apk_path, const char* target_dir, const char* abi, uint32_t workers, apk_install_stats_t* stats) {
+    apk_install_stats_t local_stats;
+    struct stat st;
+    
+    if (!apk_path || !target_dir || !target_dir[0]) {
+        return APK_INSTALL_ERROR_INVALID;
+    }
+    
+    if (!stats) {
+        stats = &local_stats;
+    }
+    memset(stats, 0, sizeof(*stats));
+    
+    pthread_once(&apk_tables_once, apk_init_tables);
+    double start = apk_now();
+    
+    apk_context_t context;
+    memset(&context, 0, sizeof(context));
+    
+    context.fd = open(apk_path, O_RDONLY | O_CLOEXEC);
+    if (context.fd < 0) {
+        return APK_INSTALL_ERROR_IO;
+    }
+    
+    if (fstat(context.fd, &st) != 0 || st.st_size < APK_ZIP_EOCD_SIZE || (uint64_t)st.st_size > SIZE_MAX) {
+        close(context.fd);
+        return APK_INSTALL_ERROR_FORMAT;
+    }
+    
+    // APK okunmaz, eşlenir: iş parçacıkları yalnızca dokundukları sayfaları getirir
+    context.size = (size_t)st.st_size;
+    void* base = mmap(NULL, context.size, PROT_READ, MAP_PRIVATE, context.fd, 0);
+    if (base == MAP_FAILED) {
+        close(context.fd);
+        return APK_INSTALL_ERROR_IO;
+    }
+    context.base = (const uint8_t*)base;
+    stats->apk_size = context.size;
+    
+    char staging[PATH_MAX];
+    if (snprintf(staging, sizeof(staging), "%s.%d.tmp", target_dir, (int)getpid()) >= (int)sizeof(staging)) {
+        munmap(base, context.size);
+        close(context.fd);
+        return APK_INSTALL_ERROR_INVALID;
+    }
+    
+    // Önceki yarım kurulumdan kalan hazırlık dizini temizlenir
+    apk_remove_tree(staging);
+    int status = mkdir(staging, 0755) == 0 ? 0 : APK_INSTALL_ERROR_IO;
+    
+    uint8_t* digests = NULL;
+    uint8_t expected[32];
+    
+    if (status == 0) {
+        status = apk_plan(&context, staging, abi ? abi : APK_INSTALL_DEFAULT_ABI, &digests, expected, stats);
+    }
+    
+    if (status == 0) {
+        if (workers == 0) {
+            long online = sysconf(_SC_NPROCESSORS_ONLN);
+            workers = online > 0 ? (uint32_t)online : 1;
+        }
+        if (workers > APK_INSTALL_MAX_WORKERS) {
+            workers = APK_INSTALL_MAX_WORKERS;
+        }
+        if (workers > context.job_count) {
+            workers = context.job_count ? context.job_count : 1;
+        }
+    
+        // Çağıran iş parçacığı da çalışır
+        pthread_t threads[APK_INSTALL_MAX_WORKERS];
+        uint32_t started = 0;
+        for (uint32_t i = 1; i < workers; i++) {
+            if (pthread_create(&threads[started], NULL, apk_worker, &context) != 0) {
+                break;
+            }
+            started++;
+        }
+    
+        apk_worker(&context);
+        for (uint32_t i = 0; i < started; i++) {
+            pthread_join(threads[i], NULL);
+        }
+    
+        stats->workers = started + 1;
+        status = context.status;
+    }
+    
+    // Üst özet: 0x5a, parça sayısı ve parça özetleri
+    if (status == 0 && digests) {
+        uint8_t prefix[5] = {0x5a, 0, 0, 0, 0};
+        apk_sha256_t sha;
+        apk_put_u32(prefix + 1, stats->digest_chunks);
+        apk_sha256_init(&sha);
+        apk_sha256_update(&sha, prefix, sizeof(prefix));
+        apk_sha256_update(&sha, digests, (size_t)stats->digest_chunks * 32);
+        apk_sha256_final(&sha, stats->digest);
+    
+        if (memcmp(stats->digest, expected, sizeof(expected)) != 0) {
+            status = APK_INSTALL_ERROR_SIGNATURE;
+        }
+    }
+    
+    for (uint32_t i = 0; i < context.job_count; i++) {
+        free(context.jobs[i].path);
+    }
+    free(context.jobs);
+    free(digests);
+    munmap(base, context.size);
+    close(context.fd);
+    
+    if (status == 0) {
+        status = apk_commit(staging, target_dir);
+    }
+    
+    if (status != 0) {
+        apk_remove_tree(staging);
+        return status;
+    }
+    
+    stats->elapsed_ms = (apk_now() - start) * 1000.0;
+    if (stats->elapsed_ms > 0) {
+        stats->mb_per_sec = ((double)stats->apk_size / (1024.0 * 1024.0)) / (stats->elapsed_ms / 1000.0);
+    }
+    
+    return 0;
+}
+
+// Tek seferlik SHA-256
+void apk_sha256(const void* data, size_t size, uint8_t digest[32]) {
+    apk_sha256_t sha;
+    
+    pthread_once(&apk_tables_once, apk_init_tables);
+    apk_sha256_init(&sha);
+    apk_sha256_update(&sha, (const uint8_t*)data, size);
+    apk_sha256_final(&sha, digest);
+}
+
+// Kurulu dizini sil
+int apk_install_remove(const char* target_dir) {
+    if (!target_dir || !target_dir[0]) {
+        return APK_INSTALL_ERROR_INVALID;
+    }
+    
+    return apk_remove_tree(target_dir) == 0 ? 0 : APK_INSTALL_ERROR_IO;
+}
+
+// CRC-32 (dilim başına 8 bayt) ve sabit Huffman tabloları
+static void apk_init_tables(void) {
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+        apk_crc_table[0][i] = crc;
+    }
+    
+    for (uint32_t i = 0; i < 256; i++) {
+        for (int slice = 1; slice < 8; slice++) {
+            uint32_t previous = apk_crc_table[slice - 1][i];
+            apk_crc_table[slice][i] = (previous >> 8) ^ apk_crc_table[0][previous & 0xFF];
+        }
+    }
+    
+    uint8_t lengths[APK_INFLATE_MAX_SYMBOLS];
+    uint32_t symbol = 0;
+    for (; symbol < 144; symbol++) {
+        lengths[symbol] = 8;
+    }
+    for (; symbol < 256; symbol++) {
+        lengths[symbol] = 9;
+    }
+    for (; symbol < 280; symbol++) {
+        lengths[symbol] = 7;
+    }
+    for (; symbol < APK_INFLATE_MAX_SYMBOLS; symbol++) {
+        lengths[symbol] = 8;
+    }
+    apk_huffman_build(&apk_fixed_lengths, lengths, APK_INFLATE_MAX_SYMBOLS);
+    
+    memset(lengths, 5, 30);
+    apk_huffman_build(&apk_fixed_distances, lengths, 30);
+    
+#ifdef APK_INSTALL_X86
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSE4_1) && (ecx & bit_SSSE3) &&
+        __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && (ebx & bit_SHA)) {
+        apk_sha256_blocks = apk_sha256_blocks_shani;
+    }
+#endif
+}
+
+// Merkezi dizini bir kez oku, çıkarılacak girdiler ve özet parçaları için iş
+// listesini hazırla. Dizinler de burada tek iş parçacığında oluşturulur.
+static int apk_plan(apk_context_t* context, const char* staging, const char* abi,
+                    uint8_t** digests, uint8_t* expected, apk_install_stats_t* stats) {
+    const uint8_t* base = context->base;
+    size_t size = context->size;
+    
+    // Merkezi dizin sonu kaydını dosyanın kuyruğunda ara
+    size_t tail = size < APK_ZIP_EOCD_SIZE + APK_ZIP_COMMENT_MAX ? size : APK_ZIP_EOCD_SIZE + APK_ZIP_COMMENT_MAX;
+    int64_t eocd = -1;
+    for (int64_t i = (int64_t)(size - APK_ZIP_EOCD_SIZE); i >= (int64_t)(size - tail); i--) {
+        if (apk_u32(base + i) == APK_ZIP_EOCD_SIGNATURE) {
+            eocd = i;
+            break;
+        }
+    }
+    
+    if (eocd < 0) {
+        return APK_INSTALL_ERROR_FORMAT;
+    }
+    
+    uint32_t entries = apk_u16(base + eocd + 10);
+    uint64_t central_size = apk_u32(base + eocd + 12);
+    uint64_t central_offset = apk_u32(base + eocd + 16);
+    
+    // ZIP64 APK'lar desteklenmez (4 GB sınırı)
+    if (central_offset + central_size > (uint64_t)eocd || entries == 0xFFFF) {
+        return APK_INSTALL_ERROR_FORMAT;
+    }
+    
+    stats->entries = entries;
+    
+    size_t root_length = strlen(staging);
+    char path[PATH_MAX];
+    char last_parent[PATH_MAX] = "";
+    memcpy(path, staging, root_length);
+    path[root_length] = '/';
+    
+    uint64_t position = central_offset;
+    uint64_t central_end = central_offset + central_size;
+    
+    for (uint32_t i = 0; i < entries; i++) {
+        if (position + APK_ZIP_CENTRAL_SIZE > central_end ||
+            apk_u32(base + position) != APK_ZIP_CENTRAL_SIGNATURE) {
+            return APK_INSTALL_ERROR_FORMAT;
+        }
+    
+        const uint8_t* entry = base + position;
+        uint32_t flags = apk_u16(entry + 8);
+        uint32_t method = apk_u16(entry + 10);
+        uint32_t crc = apk_u32(entry + 16);
+        uint32_t compressed_size = apk_u32(entry + 20);
+        uint32_t uncompressed_size = apk_u32(entry + 24);
+        uint32_t name_length = apk_u16(entry + 28);
+        uint32_t extra_length = apk_u16(entry + 30);
+        uint32_t comment_length = apk_u16(entry + 32);
+        uint32_t local_offset = apk_u32(entry + 42);
+        const char* name = (const char*)entry + APK_ZIP_CENTRAL_SIZE;
+    
+        if (position + APK_ZIP_CENTRAL_SIZE + name_length > central_end) {
+            return APK_INSTALL_ERROR_FORMAT;
+        }
+        position += APK_ZIP_CENTRAL_SIZE + name_length + extra_length + comment_length;
+    
+        int kind = apk_classify(name, name_length, abi, stats);
+        if (kind == 0) {
+            continue;
+        }
+    
+        // Şifreli girdiler ve bilinmeyen sıkıştırma yöntemleri kurulamaz
+        if ((flags & 1) || (method != APK_ZIP_STORED && method != APK_ZIP_DEFLATED) ||
+            (method == APK_ZIP_STORED && compressed_size != uncompressed_size) ||
+            !apk_safe_name(name, name_length) || root_length + 1 + name_length >= sizeof(path)) {
+            return APK_INSTALL_ERROR_FORMAT;
+        }
+    
+        if ((uint64_t)local_offset + APK_ZIP_LOCAL_SIZE > central_offset ||
+            apk_u32(base + local_offset) != APK_ZIP_LOCAL_SIGNATURE) {
+            return APK_INSTALL_ERROR_FORMAT;
+        }
+    
+        uint64_t data_offset = (uint64_t)local_offset + APK_ZIP_LOCAL_SIZE +
+                               apk_u16(base + local_offset + 26) + apk_u16(base + local_offset + 28);
+        if (data_offset + compressed_size > central_offset) {
+            return APK_INSTALL_ERROR_FORMAT;
+        }
+    
+        memcpy(path + root_length + 1, name, name_length);
+        path[root_length + 1 + name_length] = '\0';
+        if (apk_make_parents(path, root_length, last_parent) != 0) {
+            return APK_INSTALL_ERROR_IO;
+        }
+    
+        apk_job_t* job = apk_add_job(context);
+        char* job_path = job ? strdup(path) : NULL;
+        if (!job_path) {
+            return APK_INSTALL_ERROR_NO_MEMORY;
+        }
+    
+        job->kind = APK_JOB_EXTRACT;
+        job->method = method;
+        job->crc = crc;
+        job->offset = data_offset;
+        job->compressed_size = compressed_size;
+        job->size = uncompressed_size;
+        job->mode = kind == 2 ? 0755 : 0644;
+        job->path = job_path;
+    
+        stats->extracted++;
+        stats->bytes_written += uncompressed_size;
+        if (method == APK_ZIP_STORED) {
+            stats->stored++;
+        } else {
+            stats->inflated++;
+        }
+    }
+    
+    // Aynı adı taşıyan iki girdi aynı dosyaya yarışarak yazardı
+    qsort(context->jobs, context->job_count, sizeof(apk_job_t), apk_compare_paths);
+    for (uint32_t i = 1; i < context->job_count; i++) {
+        if (strcmp(context->jobs[i - 1].path, context->jobs[i].path) == 0) {
+            return APK_INSTALL_ERROR_FORMAT;
+        }
+    }
+    
+    // Büyük girdiler önce başlar: en uzun iş en sona kalmaz
+    qsort(context->jobs, context->job_count, sizeof(apk_job_t), apk_compare_jobs);
+    
+    return apk_plan_signature(context, central_offset, central_size, (uint64_t)eocd, digests, expected, stats);
+}
+
+// İmza bloğunu bul, SHA-256 parça özetini ve özetlenecek parçaları hazırla.
+// Özetlenen bölümler: girdi içerikleri, merkezi dizin ve merkezi dizin ofseti
+// imza bloğunu gösterecek şekilde düzeltilmiş dizin sonu kaydı.
+static int apk_plan_signature(apk_context_t* context, uint64_t central_offset, uint64_t central_size,
+                              uint64_t eocd_offset, uint8_t** digests, uint8_t* expected, apk_install_stats_t* stats) {
+    const uint8_t* base = context->base;
+    
+    *digests = NULL;
+    stats->signature = APK_SIGNATURE_NONE;
+    
+    if (central_offset < 32 || memcmp(base + central_offset - 16, APK_SIG_BLOCK_MAGIC, 16) != 0) {
+        return 0;
+    }
+    
+    uint64_t block_size = apk_u64(base + central_offset - 24);
+    if (block_size < 24 || block_size > central_offset - 8) {
+        return APK_INSTALL_ERROR_FORMAT;
+    }
+    
+    uint64_t block_offset = central_offset - block_size - 8;
+    if (apk_u64(base + block_offset) != block_size) {
+        return APK_INSTALL_ERROR_FORMAT;
+    }
+    
+    // Kimlik-değer çiftleri; v3 varsa o, yoksa v2 kullanılır
+    const uint8_t* scheme = NULL;
+    uint64_t scheme_size = 0;
+    uint64_t pair = block_offset + 8;
+    uint64_t pairs_end = central_offset - 24;
+    
+    while (pair + 12 <= pairs_end) {
+        uint64_t length = apk_u64(base + pair);
+        if (length < 4 || length > pairs_end - pair - 8) {
+            return APK_INSTALL_ERROR_FORMAT;
+        }
+    
+        uint32_t id = apk_u32(base + pair + 8);
+        if (id == APK_SIG_V3_ID || (id == APK_SIG_V2_ID && !scheme)) {
+            scheme = base + pair + 12;
+            scheme_size = length - 4;
+        }
+        pair += 8 + length;
+    }
+    
+    if (!scheme) {
+        return 0;
+    }
+    
+    // İlk imzalayanın imzalı verisindeki özet listesi (v2 ve v3'te aynı yerde):
+    // imzalayanlar[ imzalayan[ imzalı_veri[ özetler[ (algoritma, özet) ] ... ] ] ]
+    const uint8_t* cursor = scheme;
+    const uint8_t* end = scheme + scheme_size;
+    for (int level = 0; level < 4; level++) {
+        if (end - cursor < 4) {
+            return APK_INSTALL_ERROR_FORMAT;
+        }
+    
+        uint32_t length = apk_u32(cursor);
+        if (length > (uint64_t)(end - cursor - 4)) {
+            return APK_INSTALL_ERROR_FORMAT;
+        }
+        cursor += 4;
+        end = cursor + length;
+    }
+    
+    int found = 0;
+    while (end - cursor >= 4 && !found) {
+        uint32_t length = apk_u32(cursor);
+        if (length < 8 || length > (uint64_t)(end - cursor - 4)) {
+            return APK_INSTALL_ERROR_FORMAT;
+        }
+    
+        const uint8_t* record = cursor + 4;
+        uint32_t algorithm = apk_u32(record);
+        uint32_t digest_length = apk_u32(record + 4);
+        cursor += 4 + length;
+    
+        // RSA-PSS, RSA PKCS#1, ECDSA ve DSA ile SHA-256 parça özeti
+        if ((algorithm == 0x0101 || algorithm == 0x0103 || algorithm == 0x0201 || algorithm == 0x0301) &&
+            digest_length == 32 && digest_length <= length - 8) {
+            memcpy(expected, record + 8, 32);
+            found = 1;
+        }
+    }
+    
+    if (!found) {
+        stats->signature = APK_SIGNATURE_UNSUPPORTED;
+        return 0;
+    }
+    
+    // Bölümler 1 MB'lık parçalara bölünür; dizin sonu kaydının kopyası özet
+    // tamponunun arkasında tutulur
+    uint64_t eocd_size = context->size - eocd_offset;
+    uint64_t sections[3][2] = {
+        {0, block_offset},
+        {central_offset, central_size},
+        {0, eocd_size}
+    };
+    
+    uint32_t chunks = 0;
+    for (int i = 0; i < 3; i++) {
+        chunks += (uint32_t)((sections[i][1] + APK_INSTALL_CHUNK_SIZE - 1) / APK_INSTALL_CHUNK_SIZE);
+    }
+    
+    uint8_t* buffer = (uint8_t*)malloc((size_t)chunks * 32 + eocd_size);
+    if (!buffer) {
+        return APK_INSTALL_ERROR_NO_MEMORY;
+    }
+    
+    uint8_t* eocd = buffer + (size_t)chunks * 32;
+    memcpy(eocd, base + eocd_offset, eocd_size);
+    apk_put_u32(eocd + 16, (uint32_t)block_offset);
+    
+    uint32_t chunk = 0;
+    for (int i = 0; i < 3; i++) {
+        const uint8_t* section = i == 2 ? eocd : base + sections[i][0];
+        for (uint64_t offset = 0; offset < sections[i][1]; offset += APK_INSTALL_CHUNK_SIZE) {
+            apk_job_t* job = apk_add_job(context);
+            if (!job) {
+                free(buffer);
+                return APK_INSTALL_ERROR_NO_MEMORY;
+            }
+    
+            uint64_t remaining = sections[i][1] - offset;
+            job->kind = APK_JOB_DIGEST;
+            job->data = section + offset;
+            job->size = (uint32_t)(remaining < APK_INSTALL_CHUNK_SIZE ? remaining : APK_INSTALL_CHUNK_SIZE);
+            job->digest = buffer + (size_t)chunk * 32;
+            chunk++;
+        }
+    }
+    
+    stats->digest_chunks = chunks;
+    stats->signature = APK_SIGNATURE_DIGEST_MATCHED;
+    *digests = buffer;
+    return 0;
+}
+
+// Girdiyi sınıflandır: 0 atlanır, 1 DEX ya da kaynak, 2 yerel kütüphane
+static int apk_classify(const char* name, uint32_t length, const char* abi, apk_install_stats_t* stats) {
+    if (length == 0 || name[length - 1] == '/') {
+        return 0;
+    }
+    
+    // classes.dex, classes2.dex ...
+    if (length >= 11 && memcmp(name, "classes", 7) == 0 && memcmp(name + length - 4, ".dex", 4) == 0) {
+        uint32_t i = 7;
+        while (i < length - 4 && name[i] >= '0' && name[i] <= '9') {
+            i++;
+        }
+        if (i == length - 4) {
+            stats->dex_files++;
+            return 1;
+        }
+        return 0;
+    }
+    
+    if ((length == 19 && memcmp(name, "AndroidManifest.xml", 19) == 0) ||
+        (length == 14 && memcmp(name, "resources.arsc", 14) == 0) ||
+        (length > 4 && memcmp(name, "res/", 4) == 0) ||
+        (length > 7 && memcmp(name, "assets/", 7) == 0)) {
+        stats->resources++;
+        return 1;
+    }
+    
+    // Yalnızca bu cihazın ABI'si: lib/<abi>/<ad>
+    size_t abi_length = strlen(abi);
+    if (length > 5 + abi_length + 1 && memcmp(name, "lib/", 4) == 0 &&
+        memcmp(name + 4, abi, abi_length) == 0 && name[4 + abi_length] == '/' &&
+        !memchr(name + 5 + abi_length, '/', length - 5 - abi_length)) {
+        stats->native_libs++;
+        return 2;
+    }
+    
+    return 0;
+}
+
+// Hazırlık dizininin dışına çıkabilecek adları reddet
+static int apk_safe_name(const char* name, uint32_t length) {
+    if (name[0] == '/' || memchr(name, '\0', length) || memchr(name, '\\', length)) {
+        return 0;
+    }
+    
+    uint32_t start = 0;
+    for (uint32_t i = 0; i <= length; i++) {
+        if (i == length || name[i] == '/') {
+            uint32_t part = i - start;
+            if (part == 0 || (part == 1 && name[start] == '.') ||
+                (part == 2 && name[start] == '.' && name[start + 1] == '.')) {
+                return 0;
+            }
+            start = i + 1;
+        }
+    }
+    
+    return 1;
+}
+
+// Girdinin üst dizinlerini oluştur. Girdiler merkezi dizinde genellikle dizin
+// sırasıyla gelir; son oluşturulan dizin last'ta hatırlanır.
+static int apk_make_parents(char* path, size_t root_length, char* last) {
+    char* slash = strrchr(path + root_length + 1, '/');
+    if (!slash) {
+        return 0;
+    }
+    
+    *slash = '\0';
+    if (strcmp(path, last) == 0) {
+        *slash = '/';
+        return 0;
+    }
+    
+    for (char* p = path + root_length + 1; ; p++) {
+        if (*p == '/' || *p == '\0') {
+            char saved = *p;
+            *p = '\0';
+            if (mkdir(path, 0755) != 0 && errno != EEXIST) {
+                *p = saved;
+                *slash = '/';
+                return -1;
+            }
+            *p = saved;
+            if (saved == '\0') {
+                break;
+            }
+        }
+    }
+    
+    strcpy(last, path);
+    *slash = '/';
+    return 0;
+}
+
+static apk_job_t* apk_add_job(apk_context_t* context) {
+    if (context->job_count == context->job_capacity) {
+        uint32_t capacity = context->job_capacity ? context->job_capacity * 2 : 64;
+        apk_job_t* jobs = (apk_job_t*)realloc(context->jobs, capacity * sizeof(apk_job_t));
+        if (!jobs) {
+            return NULL;
+        }
+        context->jobs = jobs;
+        context->job_capacity = capacity;
+    }
+    
+    apk_job_t* job = &context->jobs[context->job_count++];
+    memset(job, 0, sizeof(*job));
+    return job;
+}
+
+static int apk_compare_paths(const void* a, const void* b) {
+    return strcmp(((const apk_job_t*)a)->path, ((const apk_job_t*)b)->path);
+}
+
+static int apk_compare_jobs(const void* a, const void* b) {
+    const apk_job_t* left = (const apk_job_t*)a;
+    const apk_job_t* right = (const apk_job_t*)b;
+    
+    if (left->compressed_size != right->compressed_size) {
+        return left->compressed_size > right->compressed_size ? -1 : 1;
+    }
+    return 0;
+}
+
+// İşleri sırayla al; ilk hata diğer iş parçacıklarını da durdurur
+static void* apk_worker(void* arg) {
+    apk_context_t* context = (apk_context_t*)arg;
+    
+    while (__atomic_load_n(&context->status, __ATOMIC_RELAXED) == 0) {
+        uint32_t index = __atomic_fetch_add(&context->next, 1, __ATOMIC_RELAXED);
+        if (index >= context->job_count) {
+            break;
+        }
+    
+        int status = apk_run_job(context, &context->jobs[index]);
+        if (status != 0) {
+            int expected = 0;
+            __atomic_compare_exchange_n(&context->status, &expected, status, 0,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+        }
+    }
+    
+    return NULL;
+}
+
+static int apk_run_job(apk_context_t* context, apk_job_t* job) {
+    if (job->kind == APK_JOB_EXTRACT) {
+        return apk_extract(context, job);
+    }
+    
+    // Parça özeti: 0xa5, parça uzunluğu, parça
+    uint8_t prefix[5] = {0xa5, 0, 0, 0, 0};
+    apk_sha256_t sha;
+    apk_put_u32(prefix + 1, job->size);
+    apk_sha256_init(&sha);
+    apk_sha256_update(&sha, prefix, sizeof(prefix));
+    apk_sha256_update(&sha, job->data, job->size);
+    apk_sha256_final(&sha, job->digest);
+    return 0;
+}
+
+// Girdiyi çıkar. STORED veri çekirdek içinde kopyalanır ve CRC-32'si eşlenmiş
+// APK'dan hesaplanır; DEFLATE veri hedef dosya eşlenip doğrudan içine açılır,
+// ara tampon kullanılmaz.
+static int apk_extract(apk_context_t* context, apk_job_t* job) {
+    int out = open(job->path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, job->mode);
+    if (out < 0) {
+        return APK_INSTALL_ERROR_IO;
+    }
+    
+    int status = 0;
+    
+    if (job->method == APK_ZIP_STORED) {
+        off_t offset = (off_t)job->offset;
+        size_t remaining = job->size;
+        while (remaining > 0 && status == 0) {
+            ssize_t copied = sendfile(out, context->fd, &offset, remaining);
+            if (copied > 0) {
+                remaining -= (size_t)copied;
+            } else if (copied < 0 && errno == EINTR) {
+                continue;
+            } else if (copied < 0 && (errno == EINVAL || errno == ENOSYS)) {
+                // sendfile desteklenmiyorsa eşlenmiş APK'dan yaz
+                const uint8_t* source = context->base + offset;
+                while (remaining > 0) {
+                    ssize_t written = write(out, source, remaining);
+                    if (written < 0 && errno == EINTR) {
+                        continue;
+                    }
+                    if (written <= 0) {
+                        status = APK_INSTALL_ERROR_IO;
+                        break;
+                    }
+                    source += written;
+                    remaining -= (size_t)written;
+                }
+            } else {
+                status = APK_INSTALL_ERROR_IO;
+            }
+        }
+        if (status == 0 && apk_crc32(context->base + job->offset, job->size) != job->crc) {
+            status = APK_INSTALL_ERROR_CORRUPT;
+        }
+    } else if (job->size > 0) {
+        if (ftruncate(out, (off_t)job->size) != 0) {
+            close(out);
+            return APK_INSTALL_ERROR_IO;
+        }
+    
+        void* target = mmap(NULL, job->size, PROT_READ | PROT_WRITE, MAP_SHARED, out, 0);
+        if (target == MAP_FAILED) {
+            close(out);
+            return APK_INSTALL_ERROR_IO;
+        }
+    
+        status = apk_inflate(context->base + job->offset, job->compressed_size, (uint8_t*)target, job->size);
+        if (status == 0 && apk_crc32((const uint8_t*)target, job->size) != job->crc) {
+            status = APK_INSTALL_ERROR_CORRUPT;
+        }
+        munmap(target, job->size);
+    } else if (job->crc != 0) {
+        status = APK_INSTALL_ERROR_CORRUPT;
+    }
+    
+    if (status == 0 && fsync(out) != 0) {
+        status = APK_INSTALL_ERROR_IO;
+    }
+    
+    close(out);
+    return status;
+}
+
+// Hazırlık dizinini hedefin yerine taşı. Hedef varsa önce kenara alınır; iki
+// ad değişikliği arasında hedef kısa süre yoktur, yarım içerik hiç görünmez.
+static int apk_commit(const char* staging, const char* target_dir) {
+    if (rename(staging, target_dir) == 0) {
+        return 0;
+    }
+    
+    if (errno != EEXIST && errno != ENOTEMPTY) {
+        return APK_INSTALL_ERROR_IO;
+    }
+    
+    char old[PATH_MAX];
+    if (snprintf(old, sizeof(old), "%s.%d.old", target_dir, (int)getpid()) >= (int)sizeof(old)) {
+        return APK_INSTALL_ERROR_INVALID;
+    }
+    
+    apk_remove_tree(old);
+    if (rename(target_dir, old) != 0) {
+        return APK_INSTALL_ERROR_IO;
+    }
+    
+    if (rename(staging, target_dir) != 0) {
+        rename(old, target_dir);
+        return APK_INSTALL_ERROR_IO;
+    }
+    
+    apk_remove_tree(old);
+    return 0;
+}
+
+// Dizini içeriğiyle sil (sembolik bağlantılar izlenmez)
+static int apk_remove_tree(const char* path) {
+    struct stat st;
+    
+    if (lstat(path, &st) != 0) {
+        return errno == ENOENT ? 0 : -1;
+    }
+    
+    if (!S_ISDIR(st.st_mode)) {
+        return unlink(path);
+    }
+    
+    DIR* dir = opendir(path);
+    if (!dir) {
+        return -1;
+    }
+    
+    int status = 0;
+    char child[PATH_MAX];
+    struct dirent* item;
+    while ((item = readdir(dir)) != NULL) {
+        if (strcmp(item->d_name, ".") == 0 || strcmp(item->d_name, "..") == 0) {
+            continue;
+        }
+        if (snprintf(child, sizeof(child), "%s/%s", path, item->d_name) >= (int)sizeof(child) ||
+            apk_remove_tree(child) != 0) {
+            status = -1;
+        }
+    }
+    closedir(dir);
+    
+    if (rmdir(path) != 0) {
+        status = -1;
+    }
+    
+    return status;
+}
+
+// Bit tamponunu doldur. Girişte 8 bayt varsa tek okumayla en az 56 bit
+// tamamlanır; sonda eksik baytlar sıfır sayılır, taşma çıkışta denetlenir.
+static inline void apk_inflate_refill(apk_inflate_t* state) {
+    if (state->in_pos + 8 <= state->in_size) {
+        uint64_t word;
+        memcpy(&word, state->in + state->in_pos, sizeof(word));
+        state->bits |= word << state->bit_count;
+        state->in_pos += (63 - state->bit_count) >> 3;
+        state->bit_count |= 56;
+        return;
+    }
+    
+    while (state->bit_count <= 56) {
+        uint64_t byte = state->in_pos < state->in_size ? state->in[state->in_pos] : 0;
+        state->bits |= byte << state->bit_count;
+        state->in_pos++;
+        state->bit_count += 8;
+    }
+}
+
+static inline uint32_t apk_inflate_bits(apk_inflate_t* state, uint32_t count) {
+    if (state->bit_count < count) {
+        apk_inflate_refill(state);
+    }
+    
+    uint32_t value = (uint32_t)(state->bits & ((1ull << count) - 1));
+    state->bits >>= count;
+    state->bit_count -= count;
+    return value;
+}
+
+// Sembol çöz: kısa kodlar tablodan, uzunlar kanonik sırayla bit bit
+static inline int apk_inflate_decode(apk_inflate_t* state, const apk_huffman_t* code) {
+    if (state->bit_count < 15) {
+        apk_inflate_refill(state);
+    }
+    
+    uint32_t entry = code->fast[state->bits & ((1u << APK_INFLATE_FAST_BITS) - 1)];
+    if (entry) {
+        state->bits >>= entry & 15;
+        state->bit_count -= entry & 15;
+        return (int)(entry >> 4);
+    }
+    
+    int value = 0;
+    int first = 0;
+    int index = 0;
+    for (int length = 1; length < 16; length++) {
+        value |= (int)(state->bits & 1);
+        state->bits >>= 1;
+        state->bit_count--;
+    
+        int count = code->count[length];
+        if (value - count < first) {
+            return code->symbol[index + (value - first)];
+        }
+        index += count;
+        first = (first + count) << 1;
+        value <<= 1;
+    }
+    
+    return -1;
+}
+
+// Kod uzunluklarından kanonik kodu kur. Eksik kodlar kabul edilir; kullanılmayan
+// bir kod çözülürse apk_inflate_decode -1 döner.
+static void apk_huffman_build(apk_huffman_t* code, const uint8_t* lengths, uint32_t count) {
+    uint16_t offsets[16];
+    
+    memset(code->count, 0, sizeof(code->count));
+    for (uint32_t i = 0; i < count; i++) {
+        code->count[lengths[i]]++;
+    }
+    code->count[0] = 0;
+    
+    offsets[1] = 0;
+    for (int length = 1; length < 15; length++) {
+        offsets[length + 1] = (uint16_t)(offsets[length] + code->count[length]);
+    }
+    
+    for (uint32_t i = 0; i < count; i++) {
+        if (lengths[i]) {
+            code->symbol[offsets[lengths[i]]++] = (uint16_t)i;
+        }
+    }
+    
+    // Akıştaki kodlar ters bit sırasındadır: her kısa kod, ters çevrilmiş
+    // değerinden başlayarak 1 << uzunluk adımla tabloya yayılır
+    memset(code->fast, 0, sizeof(code->fast));
+    uint32_t value = 0;
+    uint32_t index = 0;
+    for (uint32_t length = 1; length <= APK_INFLATE_FAST_BITS; length++) {
+        for (uint32_t i = 0; i < code->count[length]; i++, value++) {
+            uint32_t reversed = 0;
+            for (uint32_t bit = 0; bit < length; bit++) {
+                reversed |= ((value >> bit) & 1) << (length - 1 - bit);
+            }
+    
+            uint16_t entry = (uint16_t)((code->symbol[index++] << 4) | length);
+            for (uint32_t slot = reversed; slot < (1u << APK_INFLATE_FAST_BITS); slot += 1u << length) {
+                code->fast[slot] = entry;
+            }
+        }
+        value <<= 1;
+    }
+}
+
+// DEFLATE akışını çıkış boyutu bilinen tampona aç
+static int apk_inflate(const uint8_t* in, size_t in_size, uint8_t* out, size_t out_size) {
+    apk_inflate_t state;
+    apk_huffman_t lengths;
+    apk_huffman_t distances;
+    int last = 0;
+    
+    memset(&state, 0, sizeof(state));
+    state.in = in;
+    state.in_size = in_size;
+    state.out = out;
+    state.out_size = out_size;
+    
+    while (!last) {
+        int status;
+        last = (int)apk_inflate_bits(&state, 1);
+        uint32_t type = apk_inflate_bits(&state, 2);
+    
+        if (type == 0) {
+            // Bayt sınırına hizala; tampondaki tam baytlar girişe geri verilir
+            apk_inflate_bits(&state, state.bit_count & 7);
+            state.in_pos -= state.bit_count >> 3;
+            state.bits = 0;
+            state.bit_count = 0;
+    
+            if (state.in_pos + 4 > in_size) {
+                return APK_INSTALL_ERROR_CORRUPT;
+            }
+    
+            uint32_t length = apk_u16(in + state.in_pos);
+            uint32_t complement = apk_u16(in + state.in_pos + 2);
+            state.in_pos += 4;
+            if (length != (~complement & 0xFFFF) || length > in_size - state.in_pos ||
+                length > out_size - state.out_pos) {
+                return APK_INSTALL_ERROR_CORRUPT;
+            }
+    
+            memcpy(out + state.out_pos, in + state.in_pos, length);
+            state.in_pos += length;
+            state.out_pos += length;
+            status = 0;
+        } else if (type == 1) {
+            status = apk_inflate_block(&state, &apk_fixed_lengths, &apk_fixed_distances);
+        } else if (type == 2) {
+            status = apk_inflate_dynamic(&state, &lengths, &distances);
+            if (status == 0) {
+                status = apk_inflate_block(&state, &lengths, &distances);
+            }
+        } else {
+            status = APK_INSTALL_ERROR_CORRUPT;
+        }
+    
+        if (status != 0) {
+            return status;
+        }
+    }
+    
+    // Akış girişin sonunu aşmamalı ve çıkışı tam doldurmalı
+    if (state.in_pos - (state.bit_count >> 3) > in_size || state.out_pos != out_size) {
+        return APK_INSTALL_ERROR_CORRUPT;
+    }
+    
+    return 0;
+}
+
+static int apk_inflate_block(apk_inflate_t* state, const apk_huffman_t* lengths, const apk_huffman_t* distances) {
+    uint8_t* out = state->out;
+    size_t out_size = state->out_size;
+    
+    for (;;) {
+        int symbol = apk_inflate_decode(state, lengths);
+    
+        if (symbol < 256) {
+            if (symbol < 0 || state->out_pos >= out_size) {
+                return APK_INSTALL_ERROR_CORRUPT;
+            }
+            out[state->out_pos++] = (uint8_t)symbol;
+            continue;
+        }
+    
+        if (symbol == 256) {
+            return 0;
+        }
+    
+        symbol -= 257;
+        if (symbol >= 29) {
+            return APK_INSTALL_ERROR_CORRUPT;
+        }
+        uint32_t length = apk_length_base[symbol] + apk_inflate_bits(state, apk_length_extra[symbol]);
+    
+        symbol = apk_inflate_decode(state, distances);
+        if (symbol < 0 || symbol >= 30) {
+            return APK_INSTALL_ERROR_CORRUPT;
+        }
+        uint32_t distance = apk_distance_base[symbol] + apk_inflate_bits(state, apk_distance_extra[symbol]);
+    
+        if (distance > state->out_pos || length > out_size - state->out_pos) {
+            return APK_INSTALL_ERROR_CORRUPT;
+        }
+    
+        uint8_t* target = out + state->out_pos;
+        const uint8_t* source = target - distance;
+        state->out_pos += length;
+    
+        // Uzak eşleşmeler 8 baytlık adımlarla kopyalanır; taşan baytlar çıkışın
+        // içinde kalır ve sonraki sembollerle üzerine yazılır
+        if (distance >= 8 && state->out_pos + 8 <= out_size) {
+            uint8_t* end = target + length;
+            do {
+                memcpy(target, source, 8);
+                target += 8;
+                source += 8;
+            } while (target < end);
+        } else {
+            while (length--) {
+                *target++ = *source++;
+            }
+        }
+    }
+}
+
+// Dinamik blok başlığından uzunluk ve uzaklık kodlarını kur
+static int apk_inflate_dynamic(apk_inflate_t* state, apk_huffman_t* lengths, apk_huffman_t* distances) {
+    static const uint8_t order[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+    uint8_t code_lengths[APK_INFLATE_MAX_SYMBOLS + 32];
+    
+    uint32_t length_count = apk_inflate_bits(state, 5) + 257;
+    uint32_t distance_count = apk_inflate_bits(state, 5) + 1;
+    uint32_t code_count = apk_inflate_bits(state, 4) + 4;
+    if (length_count > 286 || distance_count > 30) {
+        return APK_INSTALL_ERROR_CORRUPT;
+    }
+    
+    memset(code_lengths, 0, sizeof(code_lengths));
+    for (uint32_t i = 0; i < code_count; i++) {
+        code_lengths[order[i]] = (uint8_t)apk_inflate_bits(state, 3);
+    }
+    apk_huffman_build(lengths, code_lengths, 19);
+    
+    uint32_t total = length_count + distance_count;
+    uint32_t index = 0;
+    while (index < total) {
+        int symbol = apk_inflate_decode(state, lengths);
+        if (symbol < 0) {
+            return APK_INSTALL_ERROR_CORRUPT;
+        }
+    
+        if (symbol < 16) {
+            code_lengths[index++] = (uint8_t)symbol;
+            continue;
+        }
+    
+        uint8_t value = 0;
+        uint32_t repeat;
+        if (symbol == 16) {
+            if (index == 0) {
+                return APK_INSTALL_ERROR_CORRUPT;
+            }
+            value = code_lengths[index - 1];
+            repeat = 3 + apk_inflate_bits(state, 2);
+        } else if (symbol == 17) {
+            repeat = 3 + apk_inflate_bits(state, 3);
+        } else {
+            repeat = 11 + apk_inflate_bits(state, 7);
+        }
+    
+        if (index + repeat > total) {
+            return APK_INSTALL_ERROR_CORRUPT;
+        }
+        memset(code_lengths + index, value, repeat);
+        index += repeat;
+    }
+    
+    // Blok sonu sembolü olmayan akış hiç bitmez
+    if (code_lengths[256] == 0) {
+        return APK_INSTALL_ERROR_CORRUPT;
+    }
+    
+    apk_huffman_build(lengths, code_lengths, length_count);
+    apk_huffman_build(distances, code_lengths + length_count, distance_count);
+    return 0;
+}
+
+static uint32_t apk_crc32(const uint8_t* data, size_t size) {
+    uint32_t crc = 0xFFFFFFFF;
+    
+    while (size >= 8) {
+        uint32_t low = apk_u32(data) ^ crc;
+        uint32_t high = apk_u32(data + 4);
+        crc = apk_crc_table[7][low & 0xFF] ^ apk_crc_table[6][(low >> 8) & 0xFF] ^
+              apk_crc_table[5][(low >> 16) & 0xFF] ^ apk_crc_table[4][low >> 24] ^
+              apk_crc_table[3][high & 0xFF] ^ apk_crc_table[2][(high >> 8) & 0xFF] ^
+              apk_crc_table[1][(high >> 16) & 0xFF] ^ apk_crc_table[0][high >> 24];
+        data += 8;
+        size -= 8;
+    }
+    
+    while (size--) {
+        crc = (crc >> 8) ^ apk_crc_table[0][(crc ^ *data++) & 0xFF];
+    }
+    
+    return crc ^ 0xFFFFFFFF;
+}
+
+static void apk_sha256_init(apk_sha256_t* context) {
+    static const uint32_t initial[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+    };
+    
+    memcpy(context->state, initial, sizeof(initial));
+    context->length = 0;
+    context->used = 0;
+}
+
+static void apk_sha256_update(apk_sha256_t* context, const uint8_t* data, size_t size) {
+    context->length += size;
+    
+    if (context->used) {
+        size_t take = 64 - context->used < size ? 64 - context->used : size;
+        memcpy(context->buffer + context->used, data, take);
+        context->used += (uint32_t)take;
+        data += take;
+        size -= take;
+        if (context->used < 64) {
+            return;
+        }
+        apk_sha256_blocks(context->state, context->buffer, 1);
+        context->used = 0;
+    }
+    
+    // Tam bloklar kopyalanmadan doğrudan girişten işlenir
+    if (size >= 64) {
+        apk_sha256_blocks(context->state, data, size / 64);
+        data += size & ~(size_t)63;
+        size &= 63;
+    }
+    
+    memcpy(context->buffer, data, size);
+    context->used = (uint32_t)size;
+}
+
+static void apk_sha256_final(apk_sha256_t* context, uint8_t digest[32]) {
+    uint64_t bits = context->length * 8;
+    
+    context->buffer[context->used++] = 0x80;
+    if (context->used > 56) {
+        memset(context->buffer + context->used, 0, 64 - context->used);
+        apk_sha256_blocks(context->state, context->buffer, 1);
+        context->used = 0;
+    }
+    memset(context->buffer + context->used, 0, 56 - context->used);
+    
+    for (int i = 0; i < 8; i++) {
+        context->buffer[63 - i] = (uint8_t)(bits >> (i * 8));
+    }
+    apk_sha256_blocks(context->state, context->buffer, 1);
+    
+    for (int i = 0; i < 8; i++) {
+        digest[i * 4] = (uint8_t)(context->state[i] >> 24);
+        digest[i * 4 + 1] = (uint8_t)(context->state[i] >> 16);
+        digest[i * 4 + 2] = (uint8_t)(context->state[i] >> 8);
+        digest[i * 4 + 3] = (uint8_t)context->state[i];
+    }
+}
+
+#define APK_ROTR(x, n)  (((x) >> (n)) | ((x) << (32 - (n))))
+#define APK_SHA256_ROUND(a, b, c, d, e, f, g, h, i) do { \
+        uint32_t t1 = (h) + (APK_ROTR(e, 6) ^ APK_ROTR(e, 11) ^ APK_ROTR(e, 25)) + \
+                      ((g) ^ ((e) & ((f) ^ (g)))) + apk_sha256_k[i] + w[i]; \
+        uint32_t t2 = (APK_ROTR(a, 2) ^ APK_ROTR(a, 13) ^ APK_ROTR(a, 22)) + \
+                      (((a) & (b)) | ((c) & ((a) | (b)))); \
+        (d) += t1; \
+        (h) = t1 + t2; \
+    } while (0)
+
+static void apk_sha256_blocks_scalar(uint32_t state[8], const uint8_t* data, size_t count) {
+    for (; count > 0; count--, data += 64) {
+        apk_sha256_block(state, data);
+    }
+}
+
+static void apk_sha256_block(uint32_t state[8], const uint8_t* block) {
+    uint32_t w[64];
+    
+    for (int i = 0; i < 16; i++) {
+        w[i] = ((uint32_t)block[i * 4] << 24) | ((uint32_t)block[i * 4 + 1] << 16) |
+               ((uint32_t)block[i * 4 + 2] << 8) | (uint32_t)block[i * 4 + 3];
+    }
+    for (int i = 16; i < 64; i++) {
+        uint32_t s0 = APK_ROTR(w[i - 15], 7) ^ APK_ROTR(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = APK_ROTR(w[i - 2], 17) ^ APK_ROTR(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+    
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+    
+    // Değişkenler kaydırılmaz, her turda adları döner; sekiz turda yerlerine gelirler
+    for (int i = 0; i < 64; i += 8) {
+        APK_SHA256_ROUND(a, b, c, d, e, f, g, h, i);
+        APK_SHA256_ROUND(h, a, b, c, d, e, f, g, i + 1);
+        APK_SHA256_ROUND(g, h, a, b, c, d, e, f, i + 2);
+        APK_SHA256_ROUND(f, g, h, a, b, c, d, e, i + 3);
+        APK_SHA256_ROUND(e, f, g, h, a, b, c, d, i + 4);
+        APK_SHA256_ROUND(d, e, f, g, h, a, b, c, i + 5);
+        APK_SHA256_ROUND(c, d, e, f, g, h, a, b, i + 6);
+        APK_SHA256_ROUND(b, c, d, e, f, g, h, a, i + 7);
+    }
+    
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+#ifdef APK_INSTALL_X86
+// SHA uzantısıyla SHA-256. Durum ABEF/CDGH düzeninde tutulur; her 4 turluk
+// grupta sonraki ileti sözcükleri msg1/msg2 ile hazırlanır.
+APK_TARGET("sha,sse4.1")
+static void apk_sha256_blocks_shani(uint32_t state[8], const uint8_t* data, size_t count) {
+    const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    
+    __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&state[0]), 0xB1);
+    __m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&state[4]), 0x1B);
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+    
+    for (; count > 0; count--, data += 64) {
+        __m128i abef = state0;
+        __m128i cdgh = state1;
+        __m128i message[4];
+    
+        for (int i = 0; i < 4; i++) {
+            message[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + i * 16)), mask);
+        }
+    
+        // Tam açılan döngüde ileti dizisi yazmaçlarda kalır
+#pragma GCC unroll 16
+        for (int group = 0; group < 16; group++) {
+            __m128i current = message[group & 3];
+            __m128i words = _mm_add_epi32(current, _mm_loadu_si128((const __m128i*)&apk_sha256_k[group * 4]));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, words);
+    
+            if (group >= 3 && group < 15) {
+                __m128i* next = &message[(group + 1) & 3];
+                *next = _mm_add_epi32(*next, _mm_alignr_epi8(current, message[(group - 1) & 3], 4));
+                *next = _mm_sha256msg2_epu32(*next, current);
+            }
+    
+            state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(words, 0x0E));
+    
+            if (group >= 1 && group < 13) {
+                message[(group - 1) & 3] = _mm_sha256msg1_epu32(message[(group - 1) & 3], current);
+            }
+        }
+    
+        state0 = _mm_add_epi32(state0, abef);
+        state1 = _mm_add_epi32(state1, cdgh);
+    }
+    
+    tmp = _mm_shuffle_epi32(state0, 0x1B);
+    state1 = _mm_shuffle_epi32(state1, 0xB1);
+    _mm_storeu_si128((__m128i*)&state[0], _mm_blend_epi16(tmp, state1, 0xF0));
+    _mm_storeu_si128((__m128i*)&state[4], _mm_alignr_epi8(state1, tmp, 8));
+}
+#endif
+
+static double apk_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
@@ -0,0 +1,1582 @@
+#include "../../include/android/app_backup.h"
+#include "../../include/android/apk_install.h"
+#include "../../include/android/package_db.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <sys/file.h>
+
+#define BACKUP_READ_SIZE             (1024 * 1024)   // Dosya okuma tamponu
+#define BACKUP_RESTORE_JOB           (1024 * 1024)   // Geri yükleme işinin ham boyutu
+#define BACKUP_CHUNK_RAW             0x80000000u     // Kayıt bayrağı: parça ham yazıldı
+#define BACKUP_MASK_SMALL            0xFFFE000000000000ull   // Ortalamaya kadar: 15 bit
+#define BACKUP_MASK_LARGE            0xFFE0000000000000ull   // Ortalamadan sonra: 11 bit
+#define BACKUP_DIGEST_SIZE           32
+#define BACKUP_KEY_SIZE              (BACKUP_DIGEST_SIZE * 2 + 1)
+
+// LZ4 blok biçimi
+#define BACKUP_LZ4_HASH_BITS         12
+#define BACKUP_LZ4_MIN_MATCH         4
+#define BACKUP_LZ4_LAST_LITERALS     5
+#define BACKUP_LZ4_MFLIMIT           12
+
+// Depodaki parça kaydı (chunks.db, anahtar: özetin onaltılık yazımı)
+typedef struct {
+    uint64_t offset;
+    uint32_t stored_size;
+    uint32_t raw_size;              // Üst bit: BACKUP_CHUNK_RAW
+} backup_record_t;
+
+// Manifest başlığı; ardından meta, girdiler ve tüm içeriğin SHA-256 özeti gelir
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t entry_count;
+    uint32_t meta_size;
+    uint64_t chunk_count;
+    uint64_t total_bytes;
+    char source_dir[PATH_MAX];
+} backup_header_t;
+
+// Manifest girdisi; ardından yol (NUL'suz) ve chunk_count adet özet gelir
+typedef struct {
+    uint64_t size;
+    uint64_t mtime_ns;
+    uint32_t mode;
+    uint32_t chunk_count;
+    uint32_t path_length;
+    uint32_t reserved;
+} backup_entry_header_t;
+
+// Yedeklenen girdi
+typedef struct {
+    char* path;                     // Kaynak dizine göre
+    uint64_t size;
+    uint64_t mtime_ns;
+    uint32_t mode;
+    uint32_t chunk_count;
+    uint8_t* digests;
+    uint8_t unchanged;
+} backup_entry_t;
+
+typedef struct {
+    uint8_t* data;
+    size_t size;
+    size_t capacity;
+} backup_buffer_t;
+
+// Parça deposu
+typedef struct {
+    package_db_t* db;
+    int pack_fd;
+    uint64_t pack_size;             // Ayrılmış alan dahil
+    package_index_t pending;        // Pakete yazılmakta olan parçaların anahtarları
+    pthread_mutex_t lock;
+} backup_store_t;
+
+typedef struct {
+    const char* source_dir;
+    backup_entry_t* entries;
+    uint32_t entry_count;
+    uint32_t entry_capacity;
+    backup_entry_t** order;         // Okunacak dosyalar, büyükten küçüğe
+    uint32_t order_count;
+    uint32_t next;
+    int status;
+    backup_store_t store;
+    app_backup_stats_t* stats;
+} backup_context_t;
+
+// Geri yükleme işi: bir dosyanın ardışık parçaları
+typedef struct {
+    uint32_t entry;
+    uint32_t first;                 // Genel parça sırası
+    uint32_t count;
+    uint64_t offset;                // Dosyadaki konum
+} restore_job_t;
+
+// Geri yüklenen girdi
+typedef struct {
+    backup_entry_header_t header;
+    const char* path;
+    const uint8_t* digests;
+    uint32_t first;
+    uint8_t restore;
+} restore_entry_t;
+
+typedef struct {
+    char root[PATH_MAX];
+    restore_entry_t* entries;
+    uint32_t entry_count;
+    backup_record_t* records;       // Genel parça sırasıyla
+    restore_job_t* jobs;
+    uint32_t job_count;
+    uint32_t next;
+    int status;
+    backup_store_t store;
+    app_backup_stats_t* stats;
+} restore_context_t;
+
+// Gear tablosu; kesim noktaları her çalıştırmada aynı olmalıdır
+static pthread_once_t backup_gear_once = PTHREAD_ONCE_INIT;
+static uint64_t backup_gear[256];
+
+// Yardımcı fonksiyonlar
+static void backup_init_gear(void);
+static uint32_t backup_cut(const uint8_t* data, uint32_t size);
+static uint32_t backup_lz4_compress(const uint8_t* in, uint32_t size, uint8_t* out, uint32_t capacity);
+static int backup_lz4_sequence(uint8_t* out, uint32_t capacity, uint32_t* op, const uint8_t* literals,
+                               uint32_t literal_length, uint32_t offset, uint32_t match_length);
+static int backup_lz4_decompress(const uint8_t* in, uint32_t size, uint8_t* out, uint32_t out_size);
+static int backup_open_store(backup_store_t* store, const char* backup_path, int create);
+static void backup_close_store(backup_store_t* store);
+static int backup_find_chunk(backup_store_t* store, const char* key, backup_record_t* record);
+static int backup_store_chunk(backup_context_t* context, const uint8_t* data, uint32_t size,
+                              uint8_t* digest, uint8_t* compressed);
+static int backup_scan(backup_context_t* context, char* path, size_t root_length);
+static backup_entry_t* backup_add_entry(backup_context_t* context, const char* path, const struct stat* st);
+static void backup_reuse_previous(backup_context_t* context, const char* backup_path);
+static void* backup_worker(void* arg);
+static int backup_file(backup_context_t* context, backup_entry_t* entry, uint8_t* buffer, uint8_t* compressed);
+static int backup_write_manifest(backup_context_t* context, const char* backup_path, const void* meta,
+                                 uint32_t meta_size, uint64_t* manifest_size);
+static int backup_read_manifest(const char* backup_path, uint8_t** data, size_t* size, backup_header_t* header);
+static int backup_next_entry(const uint8_t* data, size_t end, size_t* pos, backup_entry_header_t* entry,
+                             const char** path, const uint8_t** digests);
+static int backup_safe_path(const char* path, uint32_t length);
+static int backup_make_dirs(char* path);
+static int backup_append(backup_buffer_t* buffer, const void* data, size_t size);
+static int backup_write_all(int fd, const void* data, size_t size, uint64_t offset);
+static void backup_key(const uint8_t* digest, char* key);
+static void* restore_worker(void* arg);
+static int restore_job(restore_context_t* context, restore_job_t* job, uint8_t* in, uint8_t* out);
+static int restore_finish(restore_context_t* context);
+static uint32_t backup_workers(uint32_t workers, uint32_t jobs);
+static double backup_now(void);
+
+static inline uint64_t backup_mtime(const struct stat* st) {
+    return (uint64_t)st->st_mtim.tv_sec * 1000000000ull + (uint64_t)st->st_mtim.tv_nsec;
+}
+
+static inline uint32_t backup_read32(const uint8_t* p) {
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline uint64_t backup_read64(const uint8_t* p) {
+    uint64_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+// Dizini yedekle
+int app_backup_create(const char* source_dir, const char* backup_path, const void* meta, uint32_t meta_size,
+                      uint32_t workers, app_backup_stats_t* stats) {
+    app_backup_stats_t local_stats;
+    char path[PATH_MAX];
+    struct stat st;
+    
+    if (!source_dir || !source_dir[0] || !backup_path || !backup_path[0] ||
+        meta_size > APP_BACKUP_META_MAX || (meta_size && !meta)) {
+        return APP_BACKUP_ERROR_INVALID;
+    }
+    
+    if (!stats) {
+        stats = &local_stats;
+    }
+    memset(stats, 0, sizeof(*stats));
+    
+    size_t root_length = strlen(source_dir);
+    if (root_length >= sizeof(((backup_header_t*)0)->source_dir) || root_length >= sizeof(path)) {
+        return APP_BACKUP_ERROR_INVALID;
+    }
+    
+    if (stat(source_dir, &st) != 0 || !S_ISDIR(st.st_mode)) {
+        return APP_BACKUP_ERROR_IO;
+    }
+    
+    pthread_once(&backup_gear_once, backup_init_gear);
+    double start = backup_now();
+    
+    backup_context_t context;
+    memset(&context, 0, sizeof(context));
+    context.source_dir = source_dir;
+    context.stats = stats;
+    
+    int status = backup_open_store(&context.store, backup_path, 1);
+    if (status != 0) {
+        return status;
+    }
+    
+    memcpy(path, source_dir, root_length + 1);
+    status = backup_scan(&context, path, root_length);
+    
+    // Boyutu ve mtime'ı değişmeyen dosyalar önceki manifestten alınır
+    if (status == 0) {
+        backup_reuse_previous(&context, backup_path);
+    
+        context.order = (backup_entry_t**)malloc(((size_t)context.entry_count + 1) * sizeof(backup_entry_t*));
+        if (!context.order) {
+            status = APP_BACKUP_ERROR_NO_MEMORY;
+        }
+    }
+    
+    if (status == 0) {
+        for (uint32_t i = 0; i < context.entry_count; i++) {
+            backup_entry_t* entry = &context.entries[i];
+            if (S_ISREG(entry->mode) && !entry->unchanged) {
+                context.order[context.order_count++] = entry;
+            }
+        }
+    
+        // Büyük dosyalar önce: son biten iş parçacığı küçük bir dosyada kalır
+        for (uint32_t i = 1; i < context.order_count; i++) {
+            backup_entry_t* entry = context.order[i];
+            uint32_t j = i;
+            while (j > 0 && context.order[j - 1]->size < entry->size) {
+                context.order[j] = context.order[j - 1];
+                j--;
+            }
+            context.order[j] = entry;
+        }
+    
+        workers = backup_workers(workers, context.order_count);
+        pthread_t threads[APP_BACKUP_MAX_WORKERS];
+        uint32_t started = 0;
+        for (uint32_t i = 1; i < workers; i++) {
+            if (pthread_create(&threads[started], NULL, backup_worker, &context) != 0) {
+                break;
+            }
+            started++;
+        }
+    
+        backup_worker(&context);
+        for (uint32_t i = 0; i < started; i++) {
+            pthread_join(threads[i], NULL);
+        }
+    
+        stats->workers = started + 1;
+        status = context.status;
+    }
+    
+    // Önce parçalar diske, sonra indeks, en son manifest: manifest yalnızca
+    // kalıcı parçalara başvurur
+    uint64_t manifest_size = 0;
+    if (status == 0 && context.store.pack_fd >= 0 && fdatasync(context.store.pack_fd) != 0) {
+        status = APP_BACKUP_ERROR_IO;
+    }
+    if (status == 0 && package_db_sync(context.store.db) != 0) {
+        status = APP_BACKUP_ERROR_IO;
+    }
+    if (status == 0) {
+        status = backup_write_manifest(&context, backup_path, meta, meta_size, &manifest_size);
+    }
+    
+    backup_close_store(&context.store);
+    for (uint32_t i = 0; i < context.entry_count; i++) {
+        free(context.entries[i].path);
+        free(context.entries[i].digests);
+    }
+    free(context.entries);
+    free(context.order);
+    
+    if (status != 0) {
+        return status;
+    }
+    
+    stats->elapsed_ms = (backup_now() - start) * 1000.0;
+    if (stats->elapsed_ms > 0) {
+        stats->mb_per_sec = ((double)stats->total_bytes / (1024.0 * 1024.0)) / (stats->elapsed_ms / 1000.0);
+    }
+    stats->dedup_ratio = (double)stats->total_bytes / (double)(stats->stored_bytes + manifest_size);
+    
+    return 0;
+}
+
+// Yedeği geri yükle
+int app_backup_restore(const char* backup_path, const char* target_dir, uint32_t workers, app_backup_stats_t* stats) {
+    app_backup_stats_t local_stats;
+    backup_header_t header;
+    uint8_t* data = NULL;
+    size_t size = 0;
+    
+    if (!backup_path || !backup_path[0]) {
+        return APP_BACKUP_ERROR_INVALID;
+    }
+    
+    if (!stats) {
+        stats = &local_stats;
+    }
+    memset(stats, 0, sizeof(*stats));
+    
+    double start = backup_now();
+    int status = backup_read_manifest(backup_path, &data, &size, &header);
+    if (status != 0) {
+        return status;
+    }
+    
+    restore_context_t context;
+    memset(&context, 0, sizeof(context));
+    context.stats = stats;
+    context.store.pack_fd = -1;
+    
+    const char* root = target_dir && target_dir[0] ? target_dir : header.source_dir;
+    if (snprintf(context.root, sizeof(context.root), "%s", root) >= (int)sizeof(context.root)) {
+        free(data);
+        return APP_BACKUP_ERROR_INVALID;
+    }
+    
+    context.entries = (restore_entry_t*)calloc((size_t)header.entry_count + 1, sizeof(restore_entry_t));
+    context.records = (backup_record_t*)malloc(((size_t)header.chunk_count + 1) * sizeof(backup_record_t));
+    context.jobs = (restore_job_t*)malloc(((size_t)header.chunk_count + 1) * sizeof(restore_job_t));
+    if (!context.entries || !context.records || !context.jobs) {
+        status = APP_BACKUP_ERROR_NO_MEMORY;
+    }
+    
+    // Girdileri ayrıştır ve doğrula
+    size_t pos = sizeof(backup_header_t) + header.meta_size;
+    size_t end = size - BACKUP_DIGEST_SIZE;
+    uint64_t chunk_total = 0;
+    for (uint32_t i = 0; status == 0 && i < header.entry_count; i++) {
+        restore_entry_t* entry = &context.entries[i];
+        status = backup_next_entry(data, end, &pos, &entry->header, &entry->path, &entry->digests);
+        if (status == 0 && (!backup_safe_path(entry->path, entry->header.path_length) ||
+                            chunk_total + entry->header.chunk_count > header.chunk_count)) {
+            status = APP_BACKUP_ERROR_FORMAT;
+        }
+        entry->first = (uint32_t)chunk_total;
+        chunk_total += entry->header.chunk_count;
+    }
+    if (status == 0 && (pos != end || chunk_total != header.chunk_count)) {
+        status = APP_BACKUP_ERROR_FORMAT;
+    }
+    context.entry_count = header.entry_count;
+    
+    if (status == 0) {
+        status = backup_open_store(&context.store, backup_path, 0);
+    }
+    
+    char path[PATH_MAX];
+    if (status == 0) {
+        memcpy(path, context.root, strlen(context.root) + 1);
+        if (backup_make_dirs(path) != 0) {
+            status = APP_BACKUP_ERROR_IO;
+        }
+    }
+    
+    // Dizinler ve geçici dosyalar tek iş parçacığında hazırlanır; parçaların
+    // depo kayıtları da burada çözülür, işçiler depoyu kilitlemez
+    for (uint32_t i = 0; status == 0 && i < context.entry_count; i++) {
+        restore_entry_t* entry = &context.entries[i];
+        struct stat st;
+    
+        if (snprintf(path, sizeof(path), "%s/%.*s", context.root, (int)entry->header.path_length, entry->path) >= (int)sizeof(path)) {
+            status = APP_BACKUP_ERROR_INVALID;
+            break;
+        }
+    
+        if (S_ISDIR(entry->header.mode)) {
+            stats->directories++;
+            if (mkdir(path, 0700) != 0 && errno != EEXIST) {
+                status = APP_BACKUP_ERROR_IO;
+            }
+            continue;
+        }
+    
+        stats->files++;
+        stats->chunks += entry->header.chunk_count;
+        stats->total_bytes += entry->header.size;
+    
+        // Aynı boyut ve mtime: dosya yedekteki haliyle aynı sayılır
+        if (lstat(path, &st) == 0 && S_ISREG(st.st_mode) && (uint64_t)st.st_size == entry->header.size &&
+            backup_mtime(&st) == entry->header.mtime_ns) {
+            stats->unchanged_files++;
+            continue;
+        }
+    
+        uint64_t raw_total = 0;
+        for (uint32_t c = 0; c < entry->header.chunk_count; c++) {
+            char key[BACKUP_KEY_SIZE];
+            backup_key(entry->digests + (size_t)c * BACKUP_DIGEST_SIZE, key);
+            if (backup_find_chunk(&context.store, key, &context.records[entry->first + c]) != 0) {
+                status = APP_BACKUP_ERROR_CORRUPT;
+                break;
+            }
+            raw_total += context.records[entry->first + c].raw_size & ~BACKUP_CHUNK_RAW;
+        }
+        if (status == 0 && raw_total != entry->header.size) {
+            status = APP_BACKUP_ERROR_CORRUPT;
+        }
+        if (status != 0) {
+            break;
+        }
+    
+        size_t length = strlen(path);
+        if (length + sizeof(".kab.tmp") > sizeof(path)) {
+            status = APP_BACKUP_ERROR_INVALID;
+            break;
+        }
+        memcpy(path + length, ".kab.tmp", sizeof(".kab.tmp"));
+    
+        int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+        if (fd < 0) {
+            status = APP_BACKUP_ERROR_IO;
+            break;
+        }
+        if (ftruncate(fd, (off_t)entry->header.size) != 0) {
+            status = APP_BACKUP_ERROR_IO;
+        }
+        close(fd);
+        entry->restore = 1;
+    
+        // İşler en fazla BACKUP_RESTORE_JOB bayt; büyük dosyalar da paylaşılır
+        uint64_t offset = 0;
+        uint32_t c = 0;
+        while (status == 0 && c < entry->header.chunk_count) {
+            restore_job_t* job = &context.jobs[context.job_count++];
+            job->entry = i;
+            job->first = entry->first + c;
+            job->offset = offset;
+            job->count = 0;
+    
+            uint64_t job_size = 0;
+            while (c < entry->header.chunk_count) {
+                uint32_t raw = context.records[entry->first + c].raw_size & ~BACKUP_CHUNK_RAW;
+                if (job->count && job_size + raw > BACKUP_RESTORE_JOB) {
+                    break;
+                }
+                job_size += raw;
+                job->count++;
+                c++;
+            }
+            offset += job_size;
+        }
+    }
+    
+    if (status == 0) {
+        workers = backup_workers(workers, context.job_count);
+        pthread_t threads[APP_BACKUP_MAX_WORKERS];
+        uint32_t started = 0;
+        for (uint32_t i = 1; i < workers; i++) {
+            if (pthread_create(&threads[started], NULL, restore_worker, &context) != 0) {
+                break;
+            }
+            started++;
+        }
+    
+        restore_worker(&context);
+        for (uint32_t i = 0; i < started; i++) {
+            pthread_join(threads[i], NULL);
+        }
+    
+        stats->workers = started + 1;
+        status = context.status;
+    }
+    
+    // Başarıda geçici dosyalar yerlerine taşınır, başarısızlıkta silinir
+    context.status = status;
+    int finish = restore_finish(&context);
+    if (status == 0) {
+        status = finish;
+    }
+    
+    backup_close_store(&context.store);
+    free(context.entries);
+    free(context.records);
+    free(context.jobs);
+    free(data);
+    
+    if (status != 0) {
+        return status;
+    }
+    
+    stats->elapsed_ms = (backup_now() - start) * 1000.0;
+    if (stats->elapsed_ms > 0) {
+        stats->mb_per_sec = ((double)stats->total_bytes / (1024.0 * 1024.0)) / (stats->elapsed_ms / 1000.0);
+    }
+    
+    return 0;
+}
+
+// Manifestteki çağıran verisini oku
+int app_backup_read_meta(const char* backup_path, void* meta, uint32_t capacity, uint32_t* size) {
+    backup_header_t header;
+    uint8_t* data = NULL;
+    size_t data_size = 0;
+    
+    if (!backup_path || (capacity && !meta)) {
+        return APP_BACKUP_ERROR_INVALID;
+    }
+    
+    int status = backup_read_manifest(backup_path, &data, &data_size, &header);
+    if (status != 0) {
+        return status;
+    }
+    
+    if (header.meta_size > capacity) {
+        free(data);
+        return APP_BACKUP_ERROR_INVALID;
+    }
+    
+    memcpy(meta, data + sizeof(backup_header_t), header.meta_size);
+    if (size) {
+        *size = header.meta_size;
+    }
+    
+    free(data);
+    return 0;
+}
+
+// Gear tablosu: sabit tohumlu splitmix64
+static void backup_init_gear(void) {
+    uint64_t seed = 0x4B414C454D4F5331ull;
+    
+    for (uint32_t i = 0; i < 256; i++) {
+        uint64_t z = (seed += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        backup_gear[i] = z ^ (z >> 31);
+    }
+}
+
+// FastCDC kesim noktası. İlk APP_BACKUP_MIN_CHUNK bayt karmaya girmez;
+// ortalamaya kadar sıkı, sonrasında gevşek maske kullanılır, böylece parça
+// boyutları ortalama çevresinde toplanır.
+static uint32_t backup_cut(const uint8_t* data, uint32_t size) {
+    if (size <= APP_BACKUP_MIN_CHUNK) {
+        return size;
+    }
+    
+    uint32_t normal = size < APP_BACKUP_AVG_CHUNK ? size : APP_BACKUP_AVG_CHUNK;
+    uint32_t limit = size < APP_BACKUP_MAX_CHUNK ? size : APP_BACKUP_MAX_CHUNK;
+    uint64_t hash = 0;
+    uint32_t i = APP_BACKUP_MIN_CHUNK;
+    
+    for (; i < normal; i++) {
+        hash = (hash << 1) + backup_gear[data[i]];
+        if (!(hash & BACKUP_MASK_SMALL)) {
+            return i + 1;
+        }
+    }
+    
+    for (; i < limit; i++) {
+        hash = (hash << 1) + backup_gear[data[i]];
+        if (!(hash & BACKUP_MASK_LARGE)) {
+            return i + 1;
+        }
+    }
+    
+    return limit;
+}
+
+// LZ4 blok sıkıştırma (açgözlü, tek karma girdisi). Çıkış capacity'ye
+// sığmazsa 0 döner. Parçalar en fazla 64 KB olduğundan konumlar 16 bittir.
+static uint32_t backup_lz4_compress(const uint8_t* in, uint32_t size, uint8_t* out, uint32_t capacity) {
+    uint16_t table[1 << BACKUP_LZ4_HASH_BITS];
+    uint32_t anchor = 0;
+    uint32_t op = 0;
+    
+    if (size > APP_BACKUP_MAX_CHUNK) {
+        return 0;
+    }
+    
+    if (size > BACKUP_LZ4_MFLIMIT) {
+        uint32_t limit = size - BACKUP_LZ4_MFLIMIT;
+        uint32_t match_limit = size - BACKUP_LZ4_LAST_LITERALS;
+        uint32_t misses = 0;
+        uint32_t ip = 1;
+    
+        memset(table, 0, sizeof(table));
+        while (ip < limit) {
+            uint32_t sequence = backup_read32(in + ip);
+            uint32_t hash = (sequence * 2654435761u) >> (32 - BACKUP_LZ4_HASH_BITS);
+            uint32_t ref = table[hash];
+            table[hash] = (uint16_t)ip;
+    
+            // Eşleşme yoksa uzun literal dizilerinde adım büyür
+            if (backup_read32(in + ref) != sequence) {
+                ip += 1 + (misses++ >> 6);
+                continue;
+            }
+            misses = 0;
+    
+            while (ip > anchor && ref > 0 && in[ip - 1] == in[ref - 1]) {
+                ip--;
+                ref--;
+            }
+    
+            uint32_t length = BACKUP_LZ4_MIN_MATCH;
+            while (ip + length + 8 <= match_limit) {
+                uint64_t diff = backup_read64(in + ip + length) ^ backup_read64(in + ref + length);
+                if (diff) {
+                    length += (uint32_t)__builtin_ctzll(diff) >> 3;
+                    goto matched;
+                }
+                length += 8;
+            }
+            while (ip + length < match_limit && in[ip + length] == in[ref + length]) {
+                length++;
+            }
+    
+        matched:
+            if (backup_lz4_sequence(out, capacity, &op, in + anchor, ip - anchor, ip - ref, length) != 0) {
+                return 0;
+            }
+            ip += length;
+            anchor = ip;
+    
+            if (ip - 2 < limit) {
+                table[(backup_read32(in + ip - 2) * 2654435761u) >> (32 - BACKUP_LZ4_HASH_BITS)] = (uint16_t)(ip - 2);
+            }
+        }
+    }
+    
+    // Son literaller
+    if (backup_lz4_sequence(out, capacity, &op, in + anchor, size - anchor, 0, 0) != 0) {
+        return 0;
+    }
+    
+    return op;
+}
+
+// Tek dizi yaz: belirteç, literal uzunluğu, literaller, ofset, eşleşme uzunluğu
+static int backup_lz4_sequence(uint8_t* out, uint32_t capacity, uint32_t* op, const uint8_t* literals,
+                               uint32_t literal_length, uint32_t offset, uint32_t match_length) {
+    uint32_t match_code = match_length ? match_length - BACKUP_LZ4_MIN_MATCH : 0;
+    uint64_t needed = 1 + (uint64_t)literal_length / 255 + 1 + literal_length;
+    if (match_length) {
+        needed += 2 + match_code / 255 + 1;
+    }
+    if (needed > capacity - *op) {
+        return -1;
+    }
+    
+    uint8_t* p = out + *op;
+    uint8_t* token = p++;
+    *token = (uint8_t)((literal_length >= 15 ? 15 : literal_length) << 4);
+    if (literal_length >= 15) {
+        uint32_t rest = literal_length - 15;
+        for (; rest >= 255; rest -= 255) {
+            *p++ = 255;
+        }
+        *p++ = (uint8_t)rest;
+    }
+    memcpy(p, literals, literal_length);
+    p += literal_length;
+    
+    if (match_length) {
+        *p++ = (uint8_t)offset;
+        *p++ = (uint8_t)(offset >> 8);
+        *token |= (uint8_t)(match_code >= 15 ? 15 : match_code);
+        if (match_code >= 15) {
+            uint32_t rest = match_code - 15;
+            for (; rest >= 255; rest -= 255) {
+                *p++ = 255;
+            }
+            *p++ = (uint8_t)rest;
+        }
+    }
+    
+    *op = (uint32_t)(p - out);
+    return 0;
+}
+
+// LZ4 blok açma; tam olarak out_size bayt üretmelidir
+static int backup_lz4_decompress(const uint8_t* in, uint32_t size, uint8_t* out, uint32_t out_size) {
+    uint32_t ip = 0;
+    uint32_t op = 0;
+    
+    while (ip < size) {
+        uint32_t token = in[ip++];
+        uint32_t literal_length = token >> 4;
+        if (literal_length == 15) {
+            uint32_t byte;
+            do {
+                if (ip >= size) {
+                    return -1;
+                }
+                byte = in[ip++];
+                literal_length += byte;
+            } while (byte == 255);
+        }
+    
+        if (literal_length > size - ip || literal_length > out_size - op) {
+            return -1;
+        }
+        memcpy(out + op, in + ip, literal_length);
+        ip += literal_length;
+        op += literal_length;
+    
+        // Son dizide eşleşme yoktur
+        if (ip == size) {
+            break;
+        }
+    
+        if (size - ip < 2) {
+            return -1;
+        }
+        uint32_t offset = in[ip] | ((uint32_t)in[ip + 1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > op) {
+            return -1;
+        }
+    
+        uint32_t match_length = token & 15;
+        if (match_length == 15) {
+            uint32_t byte;
+            do {
+                if (ip >= size) {
+                    return -1;
+                }
+                byte = in[ip++];
+                match_length += byte;
+            } while (byte == 255);
+        }
+        match_length += BACKUP_LZ4_MIN_MATCH;
+        if (match_length > out_size - op) {
+            return -1;
+        }
+    
+        // Örtüşen kopya (offset < uzunluk) tekrarı bayt bayt yayar
+        uint8_t* dst = out + op;
+        const uint8_t* src = dst - offset;
+        if (offset >= match_length) {
+            memcpy(dst, src, match_length);
+        } else {
+            for (uint32_t i = 0; i < match_length; i++) {
+                dst[i] = src[i];
+            }
+        }
+        op += match_length;
+    }
+    
+    return op == out_size ? 0 : -1;
+}
+
+// Depoyu aç. Paket dosyası üzerinde özel kilit alınır: indeks kapanışta
+// eşitlendiğinden geri yükleme de depoyu tek başına kullanır.
+static int backup_open_store(backup_store_t* store, const char* backup_path, int create) {
+    char path[PATH_MAX];
+    
+    memset(store, 0, sizeof(*store));
+    store->pack_fd = -1;
+    
+    const char* slash = strrchr(backup_path, '/');
+    int dir_length = slash ? (int)(slash - backup_path) : 1;
+    const char* dir = slash ? backup_path : ".";
+    if (slash == backup_path) {
+        dir_length = 0;
+    }
+    
+    if (snprintf(path, sizeof(path), "%.*s/%s", dir_length, dir, APP_BACKUP_PACK_NAME) >= (int)sizeof(path)) {
+        return APP_BACKUP_ERROR_INVALID;
+    }
+    store->pack_fd = open(path, create ? (O_RDWR | O_CREAT | O_CLOEXEC) : (O_RDONLY | O_CLOEXEC), 0600);
+    if (store->pack_fd < 0) {
+        // Hiç parça yazılmamış depo: boş dosyalardan oluşan yedek yine açılır
+        if (create || errno != ENOENT) {
+            return APP_BACKUP_ERROR_IO;
+        }
+    } else {
+        if (flock(store->pack_fd, LOCK_EX) != 0) {
+            close(store->pack_fd);
+            store->pack_fd = -1;
+            return APP_BACKUP_ERROR_IO;
+        }
+    
+        off_t end = lseek(store->pack_fd, 0, SEEK_END);
+        if (end < 0) {
+            close(store->pack_fd);
+            store->pack_fd = -1;
+            return APP_BACKUP_ERROR_IO;
+        }
+        store->pack_size = (uint64_t)end;
+    }
+    
+    snprintf(path, sizeof(path), "%.*s/%s", dir_length, dir, APP_BACKUP_INDEX_NAME);
+    int status = package_db_open(path, sizeof(backup_record_t), &store->db) == 0 ? 0 : APP_BACKUP_ERROR_IO;
+    if (status == 0 && package_index_init(&store->pending, 1024) != 0) {
+        package_db_close(store->db);
+        store->db = NULL;
+        status = APP_BACKUP_ERROR_NO_MEMORY;
+    }
+    if (status != 0) {
+        if (store->pack_fd >= 0) {
+            close(store->pack_fd);
+            store->pack_fd = -1;
+        }
+        return status;
+    }
+    
+    pthread_mutex_init(&store->lock, NULL);
+    return 0;
+}
+
+static void backup_close_store(backup_store_t* store) {
+    if (store->db) {
+        package_db_close(store->db);
+        package_index_destroy(&store->pending);
+        pthread_mutex_destroy(&store->lock);
+        store->db = NULL;
+    }
+    
+    if (store->pack_fd >= 0) {
+        close(store->pack_fd);
+        store->pack_fd = -1;
+    }
+}
+
+// Parça kaydını bul. Paketin sonunu aşan kayıt (yarıda kalmış yedekten)
+// yok sayılır.
+static int backup_find_chunk(backup_store_t* store, const char* key, backup_record_t* record) {
+    const void* found = package_db_get(store->db, key, NULL);
+    if (!found) {
+        return -1;
+    }
+    
+    memcpy(record, found, sizeof(*record));
+    if (record->stored_size > APP_BACKUP_MAX_CHUNK || record->offset + record->stored_size > store->pack_size) {
+        return -1;
+    }
+    
+    return 0;
+}
+
+// Parçayı depoya ekle (yoksa). Sıkıştırma kilit dışında yapılır; kayıt
+// indekse ancak veri pakete yazıldıktan sonra girer.
+static int backup_store_chunk(backup_context_t* context, const uint8_t* data, uint32_t size,
+                              uint8_t* digest, uint8_t* compressed) {
+    backup_store_t* store = &context->store;
+    app_backup_stats_t* stats = context->stats;
+    backup_record_t record;
+    char key[BACKUP_KEY_SIZE];
+    
+    apk_sha256(data, size, digest);
+    backup_key(digest, key);
+    __atomic_fetch_add(&stats->chunks, 1, __ATOMIC_RELAXED);
+    
+    pthread_mutex_lock(&store->lock);
+    int exists = package_index_find(&store->pending, key) != NULL || backup_find_chunk(store, key, &record) == 0;
+    pthread_mutex_unlock(&store->lock);
+    if (exists) {
+        return 0;
+    }
+    
+    // Sıkışmayan parça ham yazılır
+    uint32_t stored_size = backup_lz4_compress(data, size, compressed, size - 1);
+    const uint8_t* stored = compressed;
+    record.raw_size = size;
+    if (stored_size == 0) {
+        stored = data;
+        stored_size = size;
+        record.raw_size |= BACKUP_CHUNK_RAW;
+    }
+    record.stored_size = stored_size;
+    
+    char* pending_key = strdup(key);
+    if (!pending_key) {
+        return APP_BACKUP_ERROR_NO_MEMORY;
+    }
+    
+    // Aynı parçayı başka bir iş parçacığı bu arada eklemiş olabilir
+    pthread_mutex_lock(&store->lock);
+    if (package_index_find(&store->pending, key) != NULL || backup_find_chunk(store, key, &record) == 0) {
+        pthread_mutex_unlock(&store->lock);
+        free(pending_key);
+        return 0;
+    }
+    if (package_index_insert(&store->pending, pending_key, pending_key) != 0) {
+        pthread_mutex_unlock(&store->lock);
+        free(pending_key);
+        return APP_BACKUP_ERROR_NO_MEMORY;
+    }
+    record.offset = store->pack_size;
+    store->pack_size += stored_size;
+    pthread_mutex_unlock(&store->lock);
+    
+    int status = backup_write_all(store->pack_fd, stored, stored_size, record.offset) == 0 ? 0 : APP_BACKUP_ERROR_IO;
+    
+    pthread_mutex_lock(&store->lock);
+    if (status == 0 && package_db_put(store->db, key, &record, 0) != 0) {
+        status = APP_BACKUP_ERROR_IO;
+    }
+    package_index_erase(&store->pending, pending_key);
+    pthread_mutex_unlock(&store->lock);
+    free(pending_key);
+    if (status != 0) {
+        return status;
+    }
+    
+    __atomic_fetch_add(&stats->new_chunks, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&stats->new_bytes, size, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&stats->stored_bytes, stored_size, __ATOMIC_RELAXED);
+    return 0;
+}
+
+// Dizini ön sırayla gez: dizin girdisi içeriğinden önce gelir
+static int backup_scan(backup_context_t* context, char* path, size_t root_length) {
+    DIR* dir = opendir(path);
+    if (!dir) {
+        return APP_BACKUP_ERROR_IO;
+    }
+    
+    size_t length = strlen(path);
+    int status = 0;
+    struct dirent* item;
+    while (status == 0 && (item = readdir(dir)) != NULL) {
+        struct stat st;
+    
+        if (strcmp(item->d_name, ".") == 0 || strcmp(item->d_name, "..") == 0) {
+            continue;
+        }
+    
+        if (snprintf(path + length, PATH_MAX - length, "/%s", item->d_name) >= (int)(PATH_MAX - length)) {
+            status = APP_BACKUP_ERROR_INVALID;
+            break;
+        }
+    
+        if (lstat(path, &st) != 0) {
+            status = APP_BACKUP_ERROR_IO;
+            break;
+        }
+    
+        if (!S_ISREG(st.st_mode) && !S_ISDIR(st.st_mode)) {
+            context->stats->skipped++;
+            continue;
+        }
+    
+        if (!backup_add_entry(context, path + root_length + 1, &st)) {
+            status = APP_BACKUP_ERROR_NO_MEMORY;
+            break;
+        }
+    
+        if (S_ISDIR(st.st_mode)) {
+            context->stats->directories++;
+            status = backup_scan(context, path, root_length);
+        } else {
+            context->stats->files++;
+        }
+    }
+    
+    path[length] = '\0';
+    closedir(dir);
+    return status;
+}
+
+static backup_entry_t* backup_add_entry(backup_context_t* context, const char* path, const struct stat* st) {
+    if (context->entry_count == context->entry_capacity) {
+        uint32_t capacity = context->entry_capacity ? context->entry_capacity * 2 : 64;
+        backup_entry_t* entries = (backup_entry_t*)realloc(context->entries, capacity * sizeof(backup_entry_t));
+        if (!entries) {
+            return NULL;
+        }
+        context->entries = entries;
+        context->entry_capacity = capacity;
+    }
+    
+    backup_entry_t* entry = &context->entries[context->entry_count];
+    memset(entry, 0, sizeof(*entry));
+    entry->path = strdup(path);
+    if (!entry->path) {
+        return NULL;
+    }
+    
+    entry->mode = (uint32_t)st->st_mode;
+    entry->mtime_ns = backup_mtime(st);
+    entry->size = S_ISREG(st->st_mode) ? (uint64_t)st->st_size : 0;
+    context->entry_count++;
+    return entry;
+}
+
+// Önceki manifestte boyutu ve mtime'ı aynı olan dosyaların özetleri alınır.
+// Parçalarından biri depoda yoksa dosya yeniden okunur. Manifest yoksa ya da
+// okunamazsa her dosya okunur.
+static void backup_reuse_previous(backup_context_t* context, const char* backup_path) {
+    backup_header_t header;
+    package_index_t index;
+    uint8_t* data = NULL;
+    size_t size = 0;
+    
+    if (backup_read_manifest(backup_path, &data, &size, &header) != 0) {
+        return;
+    }
+    
+    if (package_index_init(&index, context->entry_count * 2 + 16) != 0) {
+        free(data);
+        return;
+    }
+    for (uint32_t i = 0; i < context->entry_count; i++) {
+        if (S_ISREG(context->entries[i].mode)) {
+            package_index_insert(&index, context->entries[i].path, &context->entries[i]);
+        }
+    }
+    
+    size_t pos = sizeof(backup_header_t) + header.meta_size;
+    size_t end = size - BACKUP_DIGEST_SIZE;
+    for (uint32_t i = 0; i < header.entry_count; i++) {
+        backup_entry_header_t previous;
+        const char* path;
+        const uint8_t* digests;
+        char name[PATH_MAX];
+    
+        if (backup_next_entry(data, end, &pos, &previous, &path, &digests) != 0) {
+            break;
+        }
+        if (!S_ISREG(previous.mode) || previous.path_length >= sizeof(name)) {
+            continue;
+        }
+    
+        memcpy(name, path, previous.path_length);
+        name[previous.path_length] = '\0';
+        backup_entry_t* entry = (backup_entry_t*)package_index_find(&index, name);
+        if (!entry || entry->size != previous.size || entry->mtime_ns != previous.mtime_ns) {
+            continue;
+        }
+    
+        uint32_t c = 0;
+        for (; c < previous.chunk_count; c++) {
+            backup_record_t record;
+            char key[BACKUP_KEY_SIZE];
+            backup_key(digests + (size_t)c * BACKUP_DIGEST_SIZE, key);
+            if (backup_find_chunk(&context->store, key, &record) != 0) {
+                break;
+            }
+        }
+        if (c != previous.chunk_count) {
+            continue;
+        }
+    
+        size_t digest_size = (size_t)previous.chunk_count * BACKUP_DIGEST_SIZE;
+        entry->digests = (uint8_t*)malloc(digest_size + 1);
+        if (!entry->digests) {
+            continue;
+        }
+        memcpy(entry->digests, digests, digest_size);
+        entry->chunk_count = previous.chunk_count;
+        entry->unchanged = 1;
+        context->stats->unchanged_files++;
+        context->stats->chunks += previous.chunk_count;
+        context->stats->total_bytes += entry->size;
+    }
+    
+    package_index_destroy(&index);
+    free(data);
+}
+
+static void* backup_worker(void* arg) {
+    backup_context_t* context = (backup_context_t*)arg;
+    
+    uint8_t* buffer = (uint8_t*)malloc(BACKUP_READ_SIZE + APP_BACKUP_MAX_CHUNK);
+    uint8_t* compressed = (uint8_t*)malloc(APP_BACKUP_MAX_CHUNK);
+    if (!buffer || !compressed) {
+        int expected = 0;
+        __atomic_compare_exchange_n(&context->status, &expected, APP_BACKUP_ERROR_NO_MEMORY, 0,
+                                    __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    }
+    
+    while (__atomic_load_n(&context->status, __ATOMIC_RELAXED) == 0) {
+        uint32_t index = __atomic_fetch_add(&context->next, 1, __ATOMIC_RELAXED);
+        if (index >= context->order_count) {
+            break;
+        }
+    
+        int status = backup_file(context, context->order[index], buffer, compressed);
+        if (status != 0) {
+            int expected = 0;
+            __atomic_compare_exchange_n(&context->status, &expected, status, 0,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+        }
+    }
+    
+    free(buffer);
+    free(compressed);
+    return NULL;
+}
+
+// Dosyayı oku, parçala ve depola. Okuma sırasında boyut değişirse okunan
+// veri yedeklenir.
+static int backup_file(backup_context_t* context, backup_entry_t* entry, uint8_t* buffer, uint8_t* compressed) {
+    char path[PATH_MAX];
+    
+    if (snprintf(path, sizeof(path), "%s/%s", context->source_dir, entry->path) >= (int)sizeof(path)) {
+        return APP_BACKUP_ERROR_INVALID;
+    }
+    
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return APP_BACKUP_ERROR_IO;
+    }
+    
+    uint32_t capacity = (uint32_t)(entry->size / APP_BACKUP_AVG_CHUNK) + 16;
+    entry->digests = (uint8_t*)malloc((size_t)capacity * BACKUP_DIGEST_SIZE);
+    if (!entry->digests) {
+        close(fd);
+        return APP_BACKUP_ERROR_NO_MEMORY;
+    }
+    
+    size_t fill = 0;
+    size_t pos = 0;
+    uint64_t total = 0;
+    int eof = 0;
+    int status = 0;
+    
+    while (status == 0) {
+        // Tamponda en büyük parça kadar veri tutulur; kesim noktaları tampon
+        // sınırından etkilenmez
+        if (!eof && fill - pos < APP_BACKUP_MAX_CHUNK) {
+            memmove(buffer, buffer + pos, fill - pos);
+            fill -= pos;
+            pos = 0;
+            while (fill < BACKUP_READ_SIZE + APP_BACKUP_MAX_CHUNK) {
+                ssize_t got = read(fd, buffer + fill, BACKUP_READ_SIZE + APP_BACKUP_MAX_CHUNK - fill);
+                if (got < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (got < 0) {
+                    status = APP_BACKUP_ERROR_IO;
+                }
+                if (got <= 0) {
+                    eof = 1;
+                    break;
+                }
+                fill += (size_t)got;
+            }
+        }
+        if (status != 0 || pos == fill) {
+            break;
+        }
+    
+        if (entry->chunk_count == capacity) {
+            capacity *= 2;
+            uint8_t* digests = (uint8_t*)realloc(entry->digests, (size_t)capacity * BACKUP_DIGEST_SIZE);
+            if (!digests) {
+                status = APP_BACKUP_ERROR_NO_MEMORY;
+                break;
+            }
+            entry->digests = digests;
+        }
+    
+        size_t available = fill - pos;
+        uint32_t length = backup_cut(buffer + pos, available > APP_BACKUP_MAX_CHUNK ? APP_BACKUP_MAX_CHUNK : (uint32_t)available);
+        status = backup_store_chunk(context, buffer + pos, length,
+                                    entry->digests + (size_t)entry->chunk_count * BACKUP_DIGEST_SIZE, compressed);
+        entry->chunk_count++;
+        pos += length;
+        total += length;
+    }
+    
+    close(fd);
+    entry->size = total;
+    __atomic_fetch_add(&context->stats->total_bytes, total, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&context->stats->scanned_bytes, total, __ATOMIC_RELAXED);
+    return status;
+}
+
+// Manifesti geçici dosyaya yaz ve yerine taşı
+static int backup_write_manifest(backup_context_t* context, const char* backup_path, const void* meta,
+                                 uint32_t meta_size, uint64_t* manifest_size) {
+    backup_buffer_t buffer = { NULL, 0, 0 };
+    backup_header_t header;
+    char temp[PATH_MAX];
+    
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, APP_BACKUP_MAGIC, sizeof(header.magic));
+    header.version = APP_BACKUP_VERSION;
+    header.entry_count = context->entry_count;
+    header.meta_size = meta_size;
+    header.total_bytes = context->stats->total_bytes;
+    snprintf(header.source_dir, sizeof(header.source_dir), "%s", context->source_dir);
+    for (uint32_t i = 0; i < context->entry_count; i++) {
+        header.chunk_count += context->entries[i].chunk_count;
+    }
+    
+    int status = backup_append(&buffer, &header, sizeof(header));
+    if (status == 0 && meta_size) {
+        status = backup_append(&buffer, meta, meta_size);
+    }
+    
+    for (uint32_t i = 0; status == 0 && i < context->entry_count; i++) {
+        backup_entry_t* entry = &context->entries[i];
+        backup_entry_header_t item;
+    
+        memset(&item, 0, sizeof(item));
+        item.size = entry->size;
+        item.mtime_ns = entry->mtime_ns;
+        item.mode = entry->mode;
+        item.chunk_count = entry->chunk_count;
+        item.path_length = (uint32_t)strlen(entry->path);
+    
+        status = backup_append(&buffer, &item, sizeof(item));
+        if (status == 0) {
+            status = backup_append(&buffer, entry->path, item.path_length);
+        }
+        if (status == 0 && entry->chunk_count) {
+            status = backup_append(&buffer, entry->digests, (size_t)entry->chunk_count * BACKUP_DIGEST_SIZE);
+        }
+    }
+    
+    uint8_t digest[BACKUP_DIGEST_SIZE];
+    if (status == 0) {
+        apk_sha256(buffer.data, buffer.size, digest);
+        status = backup_append(&buffer, digest, sizeof(digest));
+    }
+    
+    if (status == 0 && snprintf(temp, sizeof(temp), "%s.tmp", backup_path) >= (int)sizeof(temp)) {
+        status = APP_BACKUP_ERROR_INVALID;
+    }
+    
+    if (status == 0) {
+        int fd = open(temp, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+        if (fd < 0) {
+            status = APP_BACKUP_ERROR_IO;
+        } else {
+            if (backup_write_all(fd, buffer.data, buffer.size, 0) != 0 || fsync(fd) != 0) {
+                status = APP_BACKUP_ERROR_IO;
+            }
+            close(fd);
+            if (status == 0 && rename(temp, backup_path) != 0) {
+                status = APP_BACKUP_ERROR_IO;
+            }
+            if (status != 0) {
+                unlink(temp);
+            }
+        }
+    }
+    
+    *manifest_size = buffer.size;
+    free(buffer.data);
+    return status;
+}
+
+// Manifesti belleğe oku; başlığı ve sondaki özeti doğrula
+static int backup_read_manifest(const char* backup_path, uint8_t** data, size_t* size, backup_header_t* header) {
+    struct stat st;
+    
+    int fd = open(backup_path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return APP_BACKUP_ERROR_IO;
+    }
+    
+    if (fstat(fd, &st) != 0 || (uint64_t)st.st_size < sizeof(backup_header_t) + BACKUP_DIGEST_SIZE ||
+        (uint64_t)st.st_size > SIZE_MAX) {
+        close(fd);
+        return APP_BACKUP_ERROR_FORMAT;
+    }
+    
+    size_t length = (size_t)st.st_size;
+    uint8_t* buffer = (uint8_t*)malloc(length);
+    if (!buffer) {
+        close(fd);
+        return APP_BACKUP_ERROR_NO_MEMORY;
+    }
+    
+    size_t done = 0;
+    while (done < length) {
+        ssize_t got = read(fd, buffer + done, length - done);
+        if (got < 0 && errno == EINTR) {
+            continue;
+        }
+        if (got <= 0) {
+            break;
+        }
+        done += (size_t)got;
+    }
+    close(fd);
+    
+    uint8_t digest[BACKUP_DIGEST_SIZE];
+    if (done == length) {
+        apk_sha256(buffer, length - BACKUP_DIGEST_SIZE, digest);
+        memcpy(header, buffer, sizeof(*header));
+    }
+    
+    if (done != length || memcmp(digest, buffer + length - BACKUP_DIGEST_SIZE, sizeof(digest)) != 0 ||
+        memcmp(header->magic, APP_BACKUP_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != APP_BACKUP_VERSION || header->meta_size > APP_BACKUP_META_MAX ||
+        sizeof(backup_header_t) + header->meta_size > length - BACKUP_DIGEST_SIZE ||
+        header->chunk_count > (length / BACKUP_DIGEST_SIZE) ||
+        memchr(header->source_dir, '\0', sizeof(header->source_dir)) == NULL) {
+        free(buffer);
+        return APP_BACKUP_ERROR_FORMAT;
+    }
+    
+    *data = buffer;
+    *size = length;
+    return 0;
+}
+
+static int backup_next_entry(const uint8_t* data, size_t end, size_t* pos, backup_entry_header_t* entry,
+                             const char** path, const uint8_t** digests) {
+    if (end - *pos < sizeof(*entry)) {
+        return APP_BACKUP_ERROR_FORMAT;
+    }
+    memcpy(entry, data + *pos, sizeof(*entry));
+    *pos += sizeof(*entry);
+    
+    uint64_t need = (uint64_t)entry->path_length + (uint64_t)entry->chunk_count * BACKUP_DIGEST_SIZE;
+    if (entry->path_length == 0 || need > end - *pos) {
+        return APP_BACKUP_ERROR_FORMAT;
+    }
+    
+    *path = (const char*)(data + *pos);
+    *digests = data + *pos + entry->path_length;
+    *pos += (size_t)need;
+    return 0;
+}
+
+// Göreli yol; mutlak yol, "." / ".." bileşeni ve NUL içeremez
+static int backup_safe_path(const char* path, uint32_t length) {
+    if (length == 0 || length >= PATH_MAX || path[0] == '/') {
+        return 0;
+    }
+    
+    uint32_t start = 0;
+    for (uint32_t i = 0; i <= length; i++) {
+        if (i < length && path[i] == '\0') {
+            return 0;
+        }
+        if (i == length || path[i] == '/') {
+            uint32_t part = i - start;
+            if (part == 0 || (part == 1 && path[start] == '.') ||
+                (part == 2 && path[start] == '.' && path[start + 1] == '.')) {
+                return 0;
+            }
+            start = i + 1;
+        }
+    }
+    
+    return 1;
+}
+
+// Üst dizinlerle birlikte oluştur
+static int backup_make_dirs(char* path) {
+    for (char* p = path + 1; *p; p++) {
+        if (*p != '/') {
+            continue;
+        }
+        *p = '\0';
+        int status = mkdir(path, 0755);
+        *p = '/';
+        if (status != 0 && errno != EEXIST) {
+            return -1;
+        }
+    }
+    
+    return mkdir(path, 0700) == 0 || errno == EEXIST ? 0 : -1;
+}
+
+static int backup_append(backup_buffer_t* buffer, const void* data, size_t size) {
+    if (buffer->size + size > buffer->capacity) {
+        size_t capacity = buffer->capacity ? buffer->capacity : 64 * 1024;
+        while (capacity < buffer->size + size) {
+            capacity *= 2;
+        }
+        uint8_t* grown = (uint8_t*)realloc(buffer->data, capacity);
+        if (!grown) {
+            return APP_BACKUP_ERROR_NO_MEMORY;
+        }
+        buffer->data = grown;
+        buffer->capacity = capacity;
+    }
+    
+    memcpy(buffer->data + buffer->size, data, size);
+    buffer->size += size;
+    return 0;
+}
+
+static int backup_write_all(int fd, const void* data, size_t size, uint64_t offset) {
+    const uint8_t* p = (const uint8_t*)data;
+    
+    while (size) {
+        ssize_t written = pwrite(fd, p, size, (off_t)offset);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            return -1;
+        }
+        p += written;
+        size -= (size_t)written;
+        offset += (uint64_t)written;
+    }
+    
+    return 0;
+}
+
+static void backup_key(const uint8_t* digest, char* key) {
+    static const char hex[] = "0123456789abcdef";
+    
+    for (uint32_t i = 0; i < BACKUP_DIGEST_SIZE; i++) {
+        key[i * 2] = hex[digest[i] >> 4];
+        key[i * 2 + 1] = hex[digest[i] & 15];
+    }
+    key[BACKUP_KEY_SIZE - 1] = '\0';
+}
+
+static void* restore_worker(void* arg) {
+    restore_context_t* context = (restore_context_t*)arg;
+    
+    uint8_t* in = (uint8_t*)malloc(APP_BACKUP_MAX_CHUNK);
+    uint8_t* out = (uint8_t*)malloc(BACKUP_RESTORE_JOB + APP_BACKUP_MAX_CHUNK);
+    if (!in || !out) {
+        int expected = 0;
+        __atomic_compare_exchange_n(&context->status, &expected, APP_BACKUP_ERROR_NO_MEMORY, 0,
+                                    __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    }
+    
+    while (__atomic_load_n(&context->status, __ATOMIC_RELAXED) == 0) {
+        uint32_t index = __atomic_fetch_add(&context->next, 1, __ATOMIC_RELAXED);
+        if (index >= context->job_count) {
+            break;
+        }
+    
+        int status = restore_job(context, &context->jobs[index], in, out);
+        if (status != 0) {
+            int expected = 0;
+            __atomic_compare_exchange_n(&context->status, &expected, status, 0,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+        }
+    }
+    
+    free(in);
+    free(out);
+    return NULL;
+}
+
+// Parçaları oku, aç, özetlerini doğrula ve dosyaya tek yazımla yaz
+static int restore_job(restore_context_t* context, restore_job_t* job, uint8_t* in, uint8_t* out) {
+    restore_entry_t* entry = &context->entries[job->entry];
+    char path[PATH_MAX];
+    uint32_t size = 0;
+    
+    for (uint32_t i = 0; i < job->count; i++) {
+        const backup_record_t* record = &context->records[job->first + i];
+        const uint8_t* digest = entry->digests + (size_t)(job->first + i - entry->first) * BACKUP_DIGEST_SIZE;
+        uint32_t raw_size = record->raw_size & ~BACKUP_CHUNK_RAW;
+        uint8_t check[BACKUP_DIGEST_SIZE];
+    
+        if (raw_size > APP_BACKUP_MAX_CHUNK || context->store.pack_fd < 0) {
+            return APP_BACKUP_ERROR_CORRUPT;
+        }
+    
+        uint8_t* target = out + size;
+        uint8_t* source = (record->raw_size & BACKUP_CHUNK_RAW) ? target : in;
+        ssize_t got = pread(context->store.pack_fd, source, record->stored_size, (off_t)record->offset);
+        if (got != (ssize_t)record->stored_size) {
+            return APP_BACKUP_ERROR_IO;
+        }
+    
+        if (record->raw_size & BACKUP_CHUNK_RAW) {
+            if (record->stored_size != raw_size) {
+                return APP_BACKUP_ERROR_CORRUPT;
+            }
+        } else if (backup_lz4_decompress(in, record->stored_size, target, raw_size) != 0) {
+            return APP_BACKUP_ERROR_CORRUPT;
+        }
+    
+        apk_sha256(target, raw_size, check);
+        if (memcmp(check, digest, sizeof(check)) != 0) {
+            return APP_BACKUP_ERROR_CORRUPT;
+        }
+        size += raw_size;
+    }
+    
+    if (snprintf(path, sizeof(path), "%s/%.*s.kab.tmp", context->root, (int)entry->header.path_length, entry->path) >= (int)sizeof(path)) {
+        return APP_BACKUP_ERROR_INVALID;
+    }
+    
+    int fd = open(path, O_WRONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return APP_BACKUP_ERROR_IO;
+    }
+    int status = backup_write_all(fd, out, size, job->offset) == 0 ? 0 : APP_BACKUP_ERROR_IO;
+    close(fd);
+    
+    __atomic_fetch_add(&context->stats->scanned_bytes, size, __ATOMIC_RELAXED);
+    return status;
+}
+
+// Geçici dosyaları yerlerine taşı, kip ve mtime'ları geri yaz. Dizinler en
+// son ve sondan başa işlenir; içlerine yapılan yazılar mtime'ı bozmaz.
+static int restore_finish(restore_context_t* context) {
+    char path[PATH_MAX];
+    char temp[PATH_MAX];
+    int status = 0;
+    
+    for (uint32_t i = 0; i < context->entry_count; i++) {
+        restore_entry_t* entry = &context->entries[i];
+        if (!entry->restore) {
+            continue;
+        }
+    
+        // Yollar hazırlıkta doğrulandı; yine de kesilmiş yol başka dosyaya dokunmamalı
+        if (snprintf(path, sizeof(path), "%s/%.*s", context->root, (int)entry->header.path_length, entry->path) >= (int)sizeof(path) ||
+            snprintf(temp, sizeof(temp), "%s.kab.tmp", path) >= (int)sizeof(temp)) {
+            status = APP_BACKUP_ERROR_INVALID;
+            continue;
+        }
+        if (context->status != 0) {
+            unlink(temp);
+            continue;
+        }
+    
+        struct timespec times[2] = {
+            { 0, UTIME_OMIT },
+            { (time_t)(entry->header.mtime_ns / 1000000000ull), (long)(entry->header.mtime_ns % 1000000000ull) }
+        };
+        if (chmod(temp, entry->header.mode & 07777) != 0 || utimensat(AT_FDCWD, temp, times, 0) != 0 ||
+            rename(temp, path) != 0) {
+            unlink(temp);
+            status = APP_BACKUP_ERROR_IO;
+        }
+    }
+    
+    for (uint32_t i = context->entry_count; i-- > 0;) {
+        restore_entry_t* entry = &context->entries[i];
+        if (context->status != 0 || !S_ISDIR(entry->header.mode)) {
+            continue;
+        }
+    
+        struct timespec times[2] = {
+            { 0, UTIME_OMIT },
+            { (time_t)(entry->header.mtime_ns / 1000000000ull), (long)(entry->header.mtime_ns % 1000000000ull) }
+        };
+        if (snprintf(path, sizeof(path), "%s/%.*s", context->root, (int)entry->header.path_length, entry->path) >= (int)sizeof(path)) {
+            continue;
+        }
+        chmod(path, entry->header.mode & 07777);
+        utimensat(AT_FDCWD, path, times, 0);
+    }
+    
+    return status;
+}
+
+// workers 0 ise çevrimiçi işlemci sayısı; iş sayısını aşmaz
+static uint32_t backup_workers(uint32_t workers, uint32_t jobs) {
+    if (workers == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        workers = online > 0 ? (uint32_t)online : 1;
+    }
+    if (workers > APP_BACKUP_MAX_WORKERS) {
+        workers = APP_BACKUP_MAX_WORKERS;
+    }
+    if (workers > jobs) {
+        workers = jobs ? jobs : 1;
+    }
+    
+    return workers;
+}
+
+static double backup_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
@@ -0,0 +1,878 @@
+#include "../../include/android/intent_router.h"
+#include "../../include/android/package_db.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#define INTENT_TYPE_NONE           0           // Türsüz filtre
+#define INTENT_TYPE_ANY            1           // "*"
+#define INTENT_TYPE_UNKNOWN        UINT32_MAX  // Hiçbir filtrede geçmeyen tür
+
+typedef struct intent_receiver intent_receiver_t;
+
+// Kuyruktaki teslim
+typedef struct {
+    intent_message_t* message;
+    const char* component;
+} intent_delivery_t;
+
+// Paket başına alıcı
+struct intent_receiver {
+    char* package;
+    char** components;                  // Filtrelerdeki bileşen adları (alıcıya ait)
+    uint32_t component_count;
+    uint32_t component_capacity;
+    
+    intent_delivery_t* queue;           // INTENT_QUEUE_DEPTH halkası, ilk intentte ayrılır
+    uint32_t head;
+    uint32_t count;
+    
+    uint8_t active;                     // Yayın alır mı?
+    uint8_t scheduled;                  // Çalışma kuyruğunda ya da bir işçide
+    uint8_t removed;                    // Kaldırıldı; işçi bırakınca serbest kalır
+    intent_receiver_t* next;            // Çalışma kuyruğu bağı
+};
+
+// Eylem kovasındaki derlenmiş filtre
+typedef struct {
+    uint64_t categories;
+    uint32_t type_major;
+    uint32_t type_minor;
+    intent_receiver_t* receiver;
+    const char* component;
+    uint8_t shared;                     // Kovada aynı alıcı/bileşen için başka filtre de var
+} intent_entry_t;
+
+typedef struct {
+    char* action;
+    intent_entry_t* entries;
+    uint32_t count;
+    uint32_t capacity;
+} intent_bucket_t;
+
+struct intent_router {
+    // İndeks; çözümleme okuyucu, kayıt yazıcı kilidi alır
+    pthread_rwlock_t index_lock;
+    package_index_t actions;            // Eylem -> kova
+    package_index_t types;              // MIME parçası -> kimlik
+    package_index_t categories;         // Kategori -> bit + 1
+    package_index_t receivers;          // Paket -> alıcı
+    intent_bucket_t** buckets;
+    uint32_t bucket_count;
+    uint32_t bucket_capacity;
+    intent_receiver_t** receiver_list;
+    uint32_t receiver_count;
+    uint32_t receiver_capacity;
+    char** type_names;
+    uint32_t type_count;
+    uint32_t type_capacity;
+    char* category_names[INTENT_CATEGORY_LIMIT];
+    uint32_t category_count;
+    uint32_t filter_count;
+    
+    // Kuyruklar
+    pthread_mutex_t lock;
+    pthread_cond_t work;
+    pthread_cond_t idle;
+    intent_receiver_t* run_head;
+    intent_receiver_t* run_tail;
+    uint64_t pending;                   // Kuyrukta bekleyen ve teslim edilmekte olan
+    uint8_t stopping;
+    
+    pthread_t threads[INTENT_MAX_WORKERS];
+    uint32_t workers;
+    intent_handler_t handler;
+    void* arg;
+    
+    uint64_t sent;
+    uint64_t broadcasts;
+    uint64_t delivered;
+    uint64_t dropped;
+};
+
+// Yardımcı fonksiyonlar
+static void* intent_worker(void* arg);
+static intent_receiver_t* intent_receiver_get(intent_router_t* router, const char* package, uint8_t create);
+static const char* intent_receiver_component(intent_receiver_t* receiver, const char* component);
+static void intent_receiver_free(intent_receiver_t* receiver);
+static int intent_enqueue(intent_router_t* router, intent_receiver_t* receiver, intent_message_t* message, const char* component);
+static intent_message_t* intent_message_create(const char* action, const char* type, uint64_t categories, void* extras);
+static void intent_message_release(intent_message_t* message);
+static int intent_parse_type(intent_router_t* router, const char* type, uint8_t create, uint32_t* major, uint32_t* minor);
+static uint32_t intent_type_id(intent_router_t* router, const char* part, size_t length, uint8_t create);
+static int intent_category_mask(intent_router_t* router, const char* const* categories, uint8_t create, uint64_t* mask);
+static int intent_entry_matches(const intent_entry_t* entry, uint64_t categories, uint32_t major, uint32_t minor);
+
+// Yönlendiriciyi oluştur ve işçileri başlat
+int intent_router_create(uint32_t workers, intent_handler_t handler, void* arg, intent_router_t** router_out) {
+    if (!handler || !router_out) {
+        return INTENT_ERROR_INVALID;
+    }
+    *router_out = NULL;
+    
+    if (workers == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        workers = cpus > 0 ? (uint32_t)cpus : 1;
+    }
+    if (workers > INTENT_MAX_WORKERS) {
+        workers = INTENT_MAX_WORKERS;
+    }
+    
+    intent_router_t* router = (intent_router_t*)calloc(1, sizeof(intent_router_t));
+    if (!router) {
+        return INTENT_ERROR_NO_MEMORY;
+    }
+    
+    if (package_index_init(&router->actions, 64) != 0 || package_index_init(&router->types, 64) != 0 ||
+        package_index_init(&router->categories, INTENT_CATEGORY_LIMIT) != 0 ||
+        package_index_init(&router->receivers, 64) != 0) {
+        package_index_destroy(&router->actions);
+        package_index_destroy(&router->types);
+        package_index_destroy(&router->categories);
+        package_index_destroy(&router->receivers);
+        free(router);
+        return INTENT_ERROR_NO_MEMORY;
+    }
+    
+    // 0 ve 1 türsüz filtre ve "*" için ayrılmıştır
+    router->type_count = 2;
+    router->handler = handler;
+    router->arg = arg;
+    pthread_rwlock_init(&router->index_lock, NULL);
+    pthread_mutex_init(&router->lock, NULL);
+    pthread_cond_init(&router->work, NULL);
+    pthread_cond_init(&router->idle, NULL);
+    
+    for (uint32_t i = 0; i < workers; i++) {
+        if (pthread_create(&router->threads[i], NULL, intent_worker, router) != 0) {
+            break;
+        }
+        router->workers++;
+    }
+    
+    if (router->workers == 0) {
+        intent_router_destroy(router);
+        return INTENT_ERROR_NO_MEMORY;
+    }
+    
+    *router_out = router;
+    return 0;
+}
+
+// Bekleyen intentleri teslim et, işçileri durdur ve belleği bırak
+void intent_router_destroy(intent_router_t* router) {
+    if (!router) {
+        return;
+    }
+    
+    pthread_mutex_lock(&router->lock);
+    router->stopping = 1;
+    pthread_cond_broadcast(&router->work);
+    pthread_mutex_unlock(&router->lock);
+    
+    for (uint32_t i = 0; i < router->workers; i++) {
+        pthread_join(router->threads[i], NULL);
+    }
+    
+    for (uint32_t i = 0; i < router->bucket_count; i++) {
+        free(router->buckets[i]->action);
+        free(router->buckets[i]->entries);
+        free(router->buckets[i]);
+    }
+    free(router->buckets);
+    
+    for (uint32_t i = 0; i < router->receiver_count; i++) {
+        intent_receiver_free(router->receiver_list[i]);
+    }
+    free(router->receiver_list);
+    
+    for (uint32_t i = 2; i < router->type_count; i++) {
+        free(router->type_names[i]);
+    }
+    free(router->type_names);
+    
+    for (uint32_t i = 0; i < router->category_count; i++) {
+        free(router->category_names[i]);
+    }
+    
+    package_index_destroy(&router->actions);
+    package_index_destroy(&router->types);
+    package_index_destroy(&router->categories);
+    package_index_destroy(&router->receivers);
+    pthread_rwlock_destroy(&router->index_lock);
+    pthread_mutex_destroy(&router->lock);
+    pthread_cond_destroy(&router->work);
+    pthread_cond_destroy(&router->idle);
+    free(router);
+}
+
+// Filtreyi derleyip eylem kovasına ekle
+int intent_router_add_filter(intent_router_t* router, const char* package, const char* component, const intent_filter_t* filter) {
+    if (!router || !package || !filter || !filter->action || strlen(filter->action) >= INTENT_ACTION_MAX) {
+        return INTENT_ERROR_INVALID;
+    }
+    
+    pthread_rwlock_wrlock(&router->index_lock);
+    
+    intent_entry_t entry;
+    memset(&entry, 0, sizeof(entry));
+    int status = intent_category_mask(router, filter->categories, 1, &entry.categories);
+    if (status == 0) {
+        status = intent_parse_type(router, filter->type, 1, &entry.type_major, &entry.type_minor);
+    }
+    
+    intent_receiver_t* receiver = status == 0 ? intent_receiver_get(router, package, 1) : NULL;
+    if (status == 0 && !receiver) {
+        status = INTENT_ERROR_NO_MEMORY;
+    }
+    
+    if (status == 0 && component) {
+        entry.component = intent_receiver_component(receiver, component);
+        if (!entry.component) {
+            status = INTENT_ERROR_NO_MEMORY;
+        }
+    }
+    
+    // Eylem kovası
+    intent_bucket_t* bucket = NULL;
+    if (status == 0) {
+        bucket = (intent_bucket_t*)package_index_find(&router->actions, filter->action);
+        if (!bucket) {
+            if (router->bucket_count == router->bucket_capacity) {
+                uint32_t capacity = router->bucket_capacity ? router->bucket_capacity * 2 : 16;
+                intent_bucket_t** buckets = (intent_bucket_t**)realloc(router->buckets, capacity * sizeof(intent_bucket_t*));
+                if (!buckets) {
+                    status = INTENT_ERROR_NO_MEMORY;
+                } else {
+                    router->buckets = buckets;
+                    router->bucket_capacity = capacity;
+                }
+            }
+    
+            if (status == 0) {
+                bucket = (intent_bucket_t*)calloc(1, sizeof(intent_bucket_t));
+                if (bucket) {
+                    bucket->action = strdup(filter->action);
+                }
+                if (!bucket || !bucket->action ||
+                    package_index_insert(&router->actions, bucket->action, bucket) != 0) {
+                    if (bucket) {
+                        free(bucket->action);
+                    }
+                    free(bucket);
+                    bucket = NULL;
+                    status = INTENT_ERROR_NO_MEMORY;
+                } else {
+                    router->buckets[router->bucket_count++] = bucket;
+                }
+            }
+        }
+    }
+    
+    if (status == 0 && bucket->count == bucket->capacity) {
+        uint32_t capacity = bucket->capacity ? bucket->capacity * 2 : 8;
+        intent_entry_t* entries = (intent_entry_t*)realloc(bucket->entries, capacity * sizeof(intent_entry_t));
+        if (!entries) {
+            status = INTENT_ERROR_NO_MEMORY;
+        } else {
+            bucket->entries = entries;
+            bucket->capacity = capacity;
+        }
+    }
+    
+    if (status == 0) {
+        entry.receiver = receiver;
+    
+        // Aynı alıcı/bileşen için ikinci filtre: yayında iki kez teslim edilmesin
+        for (uint32_t i = 0; i < bucket->count; i++) {
+            if (bucket->entries[i].receiver == receiver && bucket->entries[i].component == entry.component) {
+                bucket->entries[i].shared = 1;
+                entry.shared = 1;
+            }
+        }
+    
+        bucket->entries[bucket->count++] = entry;
+        router->filter_count++;
+    }
+    
+    pthread_rwlock_unlock(&router->index_lock);
+    return status;
+}
+
+// Paketin filtrelerini ve bekleyen intentlerini sil
+int intent_router_remove_package(intent_router_t* router, const char* package) {
+    if (!router || !package) {
+        return INTENT_ERROR_INVALID;
+    }
+    
+    pthread_rwlock_wrlock(&router->index_lock);
+    
+    intent_receiver_t* receiver = intent_receiver_get(router, package, 0);
+    if (!receiver) {
+        pthread_rwlock_unlock(&router->index_lock);
+        return INTENT_ERROR_NOT_FOUND;
+    }
+    
+    // Kovalardan çıkar (sıra korunur: eşleşmeler kayıt sırasıyla döner)
+    for (uint32_t i = 0; i < router->bucket_count; i++) {
+        intent_bucket_t* bucket = router->buckets[i];
+        uint32_t kept = 0;
+        for (uint32_t j = 0; j < bucket->count; j++) {
+            if (bucket->entries[j].receiver != receiver) {
+                bucket->entries[kept++] = bucket->entries[j];
+            }
+        }
+        router->filter_count -= bucket->count - kept;
+        bucket->count = kept;
+    }
+    
+    package_index_erase(&router->receivers, receiver->package);
+    for (uint32_t i = 0; i < router->receiver_count; i++) {
+        if (router->receiver_list[i] == receiver) {
+            router->receiver_list[i] = router->receiver_list[--router->receiver_count];
+            break;
+        }
+    }
+    
+    // Bekleyen intentleri bırak. Bir işçi alıcıyı tutuyorsa alıcıyı o bırakır.
+    pthread_mutex_lock(&router->lock);
+    while (receiver->count > 0) {
+        intent_message_release(receiver->queue[receiver->head].message);
+        receiver->head = (receiver->head + 1) % INTENT_QUEUE_DEPTH;
+        receiver->count--;
+        router->pending--;
+    }
+    if (router->pending == 0) {
+        pthread_cond_broadcast(&router->idle);
+    }
+    
+    uint8_t owned = receiver->scheduled;
+    receiver->removed = 1;
+    pthread_mutex_unlock(&router->lock);
+    
+    if (!owned) {
+        intent_receiver_free(receiver);
+    }
+    
+    pthread_rwlock_unlock(&router->index_lock);
+    return 0;
+}
+
+int intent_router_set_active(intent_router_t* router, const char* package, uint8_t active) {
+    if (!router || !package) {
+        return INTENT_ERROR_INVALID;
+    }
+    
+    pthread_rwlock_wrlock(&router->index_lock);
+    intent_receiver_t* receiver = intent_receiver_get(router, package, 1);
+    if (receiver) {
+        receiver->active = active ? 1 : 0;
+    }
+    pthread_rwlock_unlock(&router->index_lock);
+    
+    return receiver ? 0 : INTENT_ERROR_NO_MEMORY;
+}
+
+// Eşleşen alıcıları kayıt sırasıyla döndür
+int intent_router_resolve(intent_router_t* router, const char* action, const char* type,
+                          const char* const* categories, intent_match_t* matches, uint32_t max_matches, uint32_t* count) {
+    if (!router || !action || !count || (max_matches > 0 && !matches)) {
+        return INTENT_ERROR_INVALID;
+    }
+    *count = 0;
+    
+    pthread_rwlock_rdlock(&router->index_lock);
+    
+    uint64_t mask;
+    uint32_t major;
+    uint32_t minor;
+    intent_bucket_t* bucket = (intent_bucket_t*)package_index_find(&router->actions, action);
+    if (!bucket || intent_category_mask(router, categories, 0, &mask) != 0 ||
+        intent_parse_type(router, type, 0, &major, &minor) != 0) {
+        pthread_rwlock_unlock(&router->index_lock);
+        return 0;
+    }
+    
+    uint32_t found = 0;
+    for (uint32_t i = 0; i < bucket->count && found < max_matches; i++) {
+        const intent_entry_t* entry = &bucket->entries[i];
+        if (!intent_entry_matches(entry, mask, major, minor)) {
+            continue;
+        }
+    
+        // Aynı alıcı/bileşen başka bir filtreden zaten eklenmiş olabilir
+        uint8_t duplicate = 0;
+        for (uint32_t j = 0; entry->shared && j < found; j++) {
+            if (matches[j].package == entry->receiver->package && matches[j].component == entry->component) {
+                duplicate = 1;
+                break;
+            }
+        }
+    
+        if (!duplicate) {
+            matches[found].package = entry->receiver->package;
+            matches[found].component = entry->component;
+            found++;
+        }
+    }
+    
+    pthread_rwlock_unlock(&router->index_lock);
+    
+    *count = found;
+    return 0;
+}
+
+// Açık intent gönder
+int intent_router_send(intent_router_t* router, const char* package, const char* component,
+                       const char* action, const char* type, void* extras) {
+    if (!router || !package || !action || strlen(action) >= INTENT_ACTION_MAX ||
+        (type && strlen(type) >= INTENT_TYPE_MAX)) {
+        return INTENT_ERROR_INVALID;
+    }
+    
+    intent_message_t* message = intent_message_create(action, type, 0, extras);
+    if (!message) {
+        return INTENT_ERROR_NO_MEMORY;
+    }
+    
+    pthread_rwlock_rdlock(&router->index_lock);
+    
+    int status = INTENT_ERROR_NOT_FOUND;
+    intent_receiver_t* receiver = intent_receiver_get(router, package, 0);
+    if (receiver) {
+        // Bileşen adı alıcının kayıtlı adlarından biriyse paylaşılır,
+        // değilse intentin içine kopyalanır
+        const char* name = NULL;
+        for (uint32_t i = 0; component && i < receiver->component_count; i++) {
+            if (strcmp(receiver->components[i], component) == 0) {
+                name = receiver->components[i];
+                break;
+            }
+        }
+        if (component && !name) {
+            snprintf(message->component, sizeof(message->component), "%s", component);
+            name = message->component;
+        }
+    
+        pthread_mutex_lock(&router->lock);
+        status = intent_enqueue(router, receiver, message, name);
+        if (status == 0) {
+            router->sent++;
+        }
+        pthread_mutex_unlock(&router->lock);
+    }
+    
+    pthread_rwlock_unlock(&router->index_lock);
+    
+    intent_message_release(message);
+    return status;
+}
+
+// Yayın: eşleşmeler ayrı bir diziye alınmadan doğrudan kuyruklara eklenir
+int intent_router_broadcast(intent_router_t* router, const char* action, const char* type,
+                            const char* const* categories, void* extras, uint32_t* queued) {
+    if (!router || !action || strlen(action) >= INTENT_ACTION_MAX || (type && strlen(type) >= INTENT_TYPE_MAX)) {
+        return INTENT_ERROR_INVALID;
+    }
+    if (queued) {
+        *queued = 0;
+    }
+    
+    pthread_rwlock_rdlock(&router->index_lock);
+    
+    uint64_t mask;
+    uint32_t major;
+    uint32_t minor;
+    intent_bucket_t* bucket = (intent_bucket_t*)package_index_find(&router->actions, action);
+    if (!bucket || intent_category_mask(router, categories, 0, &mask) != 0 ||
+        intent_parse_type(router, type, 0, &major, &minor) != 0) {
+        pthread_rwlock_unlock(&router->index_lock);
+        return 0;
+    }
+    
+    intent_message_t* message = intent_message_create(action, type, mask, extras);
+    if (!message) {
+        pthread_rwlock_unlock(&router->index_lock);
+        return INTENT_ERROR_NO_MEMORY;
+    }
+    
+    uint32_t count = 0;
+    pthread_mutex_lock(&router->lock);
+    router->broadcasts++;
+    
+    for (uint32_t i = 0; i < bucket->count; i++) {
+        const intent_entry_t* entry = &bucket->entries[i];
+        intent_receiver_t* receiver = entry->receiver;
+        if (!receiver->active || !intent_entry_matches(entry, mask, major, minor)) {
+            continue;
+        }
+    
+        // Aynı alıcıya bu yayın zaten eklendiyse kuyruğun sonundadır
+        uint8_t duplicate = 0;
+        for (uint32_t j = receiver->count; entry->shared && j > 0; j--) {
+            const intent_delivery_t* delivery = &receiver->queue[(receiver->head + j - 1) % INTENT_QUEUE_DEPTH];
+            if (delivery->message != message) {
+                break;
+            }
+            if (delivery->component == entry->component) {
+                duplicate = 1;
+                break;
+            }
+        }
+    
+        if (!duplicate && intent_enqueue(router, receiver, message, entry->component) == 0) {
+            count++;
+        }
+    }
+    
+    pthread_mutex_unlock(&router->lock);
+    pthread_rwlock_unlock(&router->index_lock);
+    
+    intent_message_release(message);
+    if (queued) {
+        *queued = count;
+    }
+    return 0;
+}
+
+void intent_router_flush(intent_router_t* router) {
+    if (!router) {
+        return;
+    }
+    
+    pthread_mutex_lock(&router->lock);
+    while (router->pending > 0) {
+        pthread_cond_wait(&router->idle, &router->lock);
+    }
+    pthread_mutex_unlock(&router->lock);
+}
+
+int intent_router_get_stats(intent_router_t* router, intent_router_stats_t* stats) {
+    if (!router || !stats) {
+        return INTENT_ERROR_INVALID;
+    }
+    
+    pthread_rwlock_rdlock(&router->index_lock);
+    pthread_mutex_lock(&router->lock);
+    stats->sent = router->sent;
+    stats->broadcasts = router->broadcasts;
+    stats->delivered = router->delivered;
+    stats->dropped = router->dropped;
+    stats->filters = router->filter_count;
+    stats->receivers = router->receiver_count;
+    stats->workers = router->workers;
+    pthread_mutex_unlock(&router->lock);
+    pthread_rwlock_unlock(&router->index_lock);
+    
+    return 0;
+}
+
+// İşçi: çalışma kuyruğundan bir alıcı al, en fazla INTENT_BATCH intentini
+// kilitsiz teslim et. Alıcının kuyruğunda hâlâ intent varsa sona geri koy:
+// yoğun bir paket diğerlerini bekletmez.
+static void* intent_worker(void* arg) {
+    intent_router_t* router = (intent_router_t*)arg;
+    intent_delivery_t batch[INTENT_BATCH];
+    
+    pthread_mutex_lock(&router->lock);
+    for (;;) {
+        while (!router->run_head && !router->stopping) {
+            pthread_cond_wait(&router->work, &router->lock);
+        }
+        if (!router->run_head) {
+            break;
+        }
+    
+        intent_receiver_t* receiver = router->run_head;
+        router->run_head = receiver->next;
+        if (!router->run_head) {
+            router->run_tail = NULL;
+        }
+        receiver->next = NULL;
+    
+        uint32_t count = receiver->count < INTENT_BATCH ? receiver->count : INTENT_BATCH;
+        for (uint32_t i = 0; i < count; i++) {
+            batch[i] = receiver->queue[receiver->head];
+            receiver->head = (receiver->head + 1) % INTENT_QUEUE_DEPTH;
+        }
+        receiver->count -= count;
+        pthread_mutex_unlock(&router->lock);
+    
+        for (uint32_t i = 0; i < count; i++) {
+            router->handler(receiver->package, batch[i].component, batch[i].message, router->arg);
+            intent_message_release(batch[i].message);
+        }
+    
+        pthread_mutex_lock(&router->lock);
+        router->delivered += count;
+        router->pending -= count;
+    
+        if (receiver->removed) {
+            intent_receiver_free(receiver);
+        } else if (receiver->count > 0) {
+            if (router->run_tail) {
+                router->run_tail->next = receiver;
+            } else {
+                router->run_head = receiver;
+            }
+            router->run_tail = receiver;
+        } else {
+            receiver->scheduled = 0;
+        }
+    
+        if (router->pending == 0) {
+            pthread_cond_broadcast(&router->idle);
+        }
+    }
+    pthread_mutex_unlock(&router->lock);
+    
+    return NULL;
+}
+
+static intent_receiver_t* intent_receiver_get(intent_router_t* router, const char* package, uint8_t create) {
+    intent_receiver_t* receiver = (intent_receiver_t*)package_index_find(&router->receivers, package);
+    if (receiver || !create) {
+        return receiver;
+    }
+    
+    if (router->receiver_count == router->receiver_capacity) {
+        uint32_t capacity = router->receiver_capacity ? router->receiver_capacity * 2 : 64;
+        intent_receiver_t** list = (intent_receiver_t**)realloc(router->receiver_list, capacity * sizeof(intent_receiver_t*));
+        if (!list) {
+            return NULL;
+        }
+        router->receiver_list = list;
+        router->receiver_capacity = capacity;
+    }
+    
+    receiver = (intent_receiver_t*)calloc(1, sizeof(intent_receiver_t));
+    if (!receiver) {
+        return NULL;
+    }
+    
+    receiver->package = strdup(package);
+    if (!receiver->package || package_index_insert(&router->receivers, receiver->package, receiver) != 0) {
+        free(receiver->package);
+        free(receiver);
+        return NULL;
+    }
+    
+    router->receiver_list[router->receiver_count++] = receiver;
+    return receiver;
+}
+
+// Bileşen adını alıcıda tek kopya olarak tut; filtreler ve teslimler bu
+// işaretçiyi paylaşır
+static const char* intent_receiver_component(intent_receiver_t* receiver, const char* component) {
+    for (uint32_t i = 0; i < receiver->component_count; i++) {
+        if (strcmp(receiver->components[i], component) == 0) {
+            return receiver->components[i];
+        }
+    }
+    
+    if (receiver->component_count == receiver->component_capacity) {
+        uint32_t capacity = receiver->component_capacity ? receiver->component_capacity * 2 : 4;
+        char** components = (char**)realloc(receiver->components, capacity * sizeof(char*));
+        if (!components) {
+            return NULL;
+        }
+        receiver->components = components;
+        receiver->component_capacity = capacity;
+    }
+    
+    char* name = strdup(component);
+    if (name) {
+        receiver->components[receiver->component_count++] = name;
+    }
+    return name;
+}
+
+static void intent_receiver_free(intent_receiver_t* receiver) {
+    for (uint32_t i = 0; i < receiver->component_count; i++) {
+        free(receiver->components[i]);
+    }
+    
+    free(receiver->components);
+    free(receiver->queue);
+    free(receiver->package);
+    free(receiver);
+}
+
+// Alıcının kuyruğuna ekle; router->lock tutulurken çağrılır
+static int intent_enqueue(intent_router_t* router, intent_receiver_t* receiver, intent_message_t* message, const char* component) {
+    if (!receiver->queue) {
+        receiver->queue = (intent_delivery_t*)malloc(INTENT_QUEUE_DEPTH * sizeof(intent_delivery_t));
+        if (!receiver->queue) {
+            router->dropped++;
+            return INTENT_ERROR_NO_MEMORY;
+        }
+    }
+    
+    if (receiver->count == INTENT_QUEUE_DEPTH) {
+        router->dropped++;
+        return INTENT_ERROR_BUSY;
+    }
+    
+    intent_delivery_t* delivery = &receiver->queue[(receiver->head + receiver->count) % INTENT_QUEUE_DEPTH];
+    delivery->message = message;
+    delivery->component = component;
+    receiver->count++;
+    router->pending++;
+    __atomic_add_fetch(&message->refs, 1, __ATOMIC_RELAXED);
+    
+    if (!receiver->scheduled) {
+        receiver->scheduled = 1;
+        if (router->run_tail) {
+            router->run_tail->next = receiver;
+        } else {
+            router->run_head = receiver;
+        }
+        router->run_tail = receiver;
+        pthread_cond_signal(&router->work);
+    }
+    
+    return 0;
+}
+
+static intent_message_t* intent_message_create(const char* action, const char* type, uint64_t categories, void* extras) {
+    struct timespec ts;
+    intent_message_t* message = (intent_message_t*)malloc(sizeof(intent_message_t));
+    if (!message) {
+        return NULL;
+    }
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    snprintf(message->action, sizeof(message->action), "%s", action);
+    snprintf(message->type, sizeof(message->type), "%s", type ? type : "");
+    message->component[0] = '\0';
+    message->categories = categories;
+    message->extras = extras;
+    message->sent_ns = (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+    message->refs = 1;                  // Gönderenin referansı
+    return message;
+}
+
+static void intent_message_release(intent_message_t* message) {
+    if (__atomic_sub_fetch(&message->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+        free(message);
+    }
+}
+
+// "ana/alt" türünü kimliklere çevir. Filtre kaydında bilinmeyen parçalar
+// eklenir; çözümlemede bilinmeyen parça yalnızca "*" ile eşleşir.
+static int intent_parse_type(intent_router_t* router, const char* type, uint8_t create, uint32_t* major, uint32_t* minor) {
+    if (!type || !*type) {
+        *major = INTENT_TYPE_NONE;
+        *minor = INTENT_TYPE_NONE;
+        return 0;
+    }
+    
+    const char* slash = strchr(type, '/');
+    size_t major_length = slash ? (size_t)(slash - type) : strlen(type);
+    const char* subtype = slash ? slash + 1 : "*";
+    
+    if (major_length == 0 || !*subtype) {
+        return INTENT_ERROR_INVALID;
+    }
+    
+    *major = intent_type_id(router, type, major_length, create);
+    *minor = intent_type_id(router, subtype, strlen(subtype), create);
+    if (*major == 0 || *minor == 0) {
+        return INTENT_ERROR_NO_MEMORY;
+    }
+    
+    return 0;
+}
+
+static uint32_t intent_type_id(intent_router_t* router, const char* part, size_t length, uint8_t create) {
+    char name[INTENT_TYPE_MAX];
+    
+    if (length == 1 && part[0] == '*') {
+        return INTENT_TYPE_ANY;
+    }
+    if (length >= sizeof(name)) {
+        return create ? 0 : INTENT_TYPE_UNKNOWN;
+    }
+    
+    memcpy(name, part, length);
+    name[length] = '\0';
+    
+    uintptr_t id = (uintptr_t)package_index_find(&router->types, name);
+    if (id || !create) {
+        return id ? (uint32_t)id : INTENT_TYPE_UNKNOWN;
+    }
+    
+    if (router->type_count >= router->type_capacity) {
+        uint32_t capacity = router->type_capacity ? router->type_capacity * 2 : 32;
+        char** names = (char**)realloc(router->type_names, capacity * sizeof(char*));
+        if (!names) {
+            return 0;
+        }
+        router->type_names = names;
+        router->type_capacity = capacity;
+    }
+    
+    char* copy = strdup(name);
+    if (!copy || package_index_insert(&router->types, copy, (void*)(uintptr_t)router->type_count) != 0) {
+        free(copy);
+        return 0;
+    }
+    
+    router->type_names[router->type_count] = copy;
+    return router->type_count++;
+}
+
+// Kategorileri maskeye çevir. Çözümlemede bilinmeyen kategori hiçbir
+// filtrede bulunmadığından eşleşme olmaz (INTENT_ERROR_NOT_FOUND).
+static int intent_category_mask(intent_router_t* router, const char* const* categories, uint8_t create, uint64_t* mask) {
+    *mask = 0;
+    
+    for (uint32_t i = 0; categories && categories[i]; i++) {
+        uintptr_t bit = (uintptr_t)package_index_find(&router->categories, categories[i]);
+        if (!bit) {
+            if (!create) {
+                return INTENT_ERROR_NOT_FOUND;
+            }
+            if (router->category_count == INTENT_CATEGORY_LIMIT) {
+                return INTENT_ERROR_FULL;
+            }
+    
+            char* name = strdup(categories[i]);
+            if (!name) {
+                return INTENT_ERROR_NO_MEMORY;
+            }
+    
+            bit = router->category_count + 1;
+            if (package_index_insert(&router->categories, name, (void*)bit) != 0) {
+                free(name);
+                return INTENT_ERROR_NO_MEMORY;
+            }
+            router->category_names[router->category_count++] = name;
+        }
+    
+        *mask |= 1ull << (bit - 1);
+    }
+    
+    return 0;
+}
+
+// Intentin tüm kategorileri filtrede olmalı; türsüz filtre yalnızca türsüz
+// intentle, türlü filtre ana ve alt türü (ya da "*") tutan intentle eşleşir
+static int intent_entry_matches(const intent_entry_t* entry, uint64_t categories, uint32_t major, uint32_t minor) {
+    if (categories & ~entry->categories) {
+        return 0;
+    }
+    
+    if (entry->type_major == INTENT_TYPE_NONE) {
+        return major == INTENT_TYPE_NONE;
+    }
+    if (major == INTENT_TYPE_NONE) {
+        return 0;
+    }
+    
+    return (entry->type_major == INTENT_TYPE_ANY || entry->type_major == major) &&
+           (entry->type_minor == INTENT_TYPE_ANY || entry->type_minor == minor);
+}
@@ -1,12 +1,57 @@
 #include "../../include/android/android_manager.h"
+#include "../../include/android/zygote.h"
+#include "../../include/android/apk_install.h"
+#include "../../include/android/package_db.h"
+#include "../../include/android/intent_router.h"
+#include "../../include/android/binder.h"
+#include "../../include/android/usage_sampler.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 #include <time.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+// Intentler uygulamanın binder servisine (paket adıyla kayıtlı) bu kodla,
+// tek yönlü işlem olarak iletilir
+#define ANDROID_INTENT_TRANSACTION  0x494E5401
+
+// Paket veritabanındaki kayıt
+typedef struct {
+    android_app_info_t info;
+    uint32_t uid;
+} android_package_record_t;
+
+// Binder ile iletilen intent
+typedef struct {
+    char action[INTENT_ACTION_MAX];
+    char component[INTENT_ACTION_MAX];
+    char type[INTENT_TYPE_MAX];
+    uint64_t categories;
+    uint64_t extras;
+} android_intent_parcel_t;
 
 // Global uygulama yöneticisi
 static android_manager_t* android_manager = NULL;
 
+// Uygulama aramaları için karmalar; anahtarlar uygulama yapısının içindedir
+static package_index_t android_package_index;   // Paket adı -> uygulama
+static package_index_t android_path_index;      // APK yolu -> uygulama
+static package_index_t android_pid_index;       // PID -> uygulama
+static uint32_t android_next_uid = 10000;       // Android tarzı UID
+
+// Yardımcı fonksiyonlar
+static int android_extract_apk(const char* apk_path, android_app_info_t* info);
+static int android_install_dir(const char* package_name, char* buffer, size_t size);
+static android_app_t* android_add_app(const android_app_info_t* info, uint32_t uid, uint64_t apk_mtime);
+static void android_remove_app(android_app_t* app);
+static void android_set_app_info(android_app_t* app, const android_app_info_t* info, uint64_t apk_mtime);
+static void android_persist_app(android_app_t* app);
+static int android_load_package(const char* name, const void* record, uint64_t stamp, void* arg);
+static uint8_t android_apk_in_apps_dir(const char* apk_path);
+static uint64_t android_file_mtime(const struct stat* st);
+static void android_deliver_intent(const char* package, const char* component, const intent_message_t* intent, void* arg);
+
 // Uygulama yöneticisi başlatma
 int android_manager_initialize() {
     // Zaten başlatıldıysa
@@ -27,21 +72,46 @@ int android_manager_initialize() {
     strcpy(android_manager->apps_dir, "/var/lib/android/apps");
     strcpy(android_manager->data_dir, "/var/lib/android/data");
     
-    // Uygulama listesi için bellek ayır
-    android_manager->apps = (android_app_t**)malloc(sizeof(android_app_t*) * 32);  // Başlangıçta 32 uygulama için
-    if (!android_manager->apps) {
+    // Uygulama listesi için bellek ayır (gerektikçe büyür)
+    android_manager->app_capacity = 32;
+    android_manager->apps = (android_app_t**)calloc(android_manager->app_capacity, sizeof(android_app_t*));
+    if (!android_manager->apps ||
+        package_index_init(&android_package_index, android_manager->app_capacity) != 0 ||
+        package_index_init(&android_path_index, android_manager->app_capacity) != 0 ||
+        package_index_init(&android_pid_index, android_manager->app_capacity) != 0) {
+        package_index_destroy(&android_package_index);
+        package_index_destroy(&android_path_index);
+        package_index_destroy(&android_pid_index);
+        free(android_manager->apps);
         free(android_manager);
         android_manager = NULL;
         return -2;  // Bellek hatası
     }
-    
-    // Uygulama listesini temizle
-    memset(android_manager->apps, 0, sizeof(android_app_t*) * 32);
     android_manager->app_count = 0;
     
     // Başlatıldı olarak işaretle
     android_manager->initialized = 1;
     
+    // Intent teslim kuyrukları; filtreler uygulamalar eklenirken derlenir
+    if (intent_router_create(0, android_deliver_intent, NULL, &android_manager->intent_router) != 0) {
+        android_manager->intent_router = NULL;
+    }
+    
+    // Çalışan uygulamaların kullanım geçmişi arka planda örneklenir
+    if (usage_sampler_create(0, 0, &android_manager->usage_sampler) != 0) {
+        android_manager->usage_sampler = NULL;
+    }
+    
+    // Kurulu paketleri veritabanından yükle; açılamazsa yalnızca bellek içi
+    // liste kullanılır
+    char db_path[512];
+    package_db_t* db = NULL;
+    snprintf(db_path, sizeof(db_path), "%s/packages.db", android_manager->data_dir);
+    if (package_db_open(db_path, sizeof(android_package_record_t), &db) == 0) {
+        android_manager->package_db = db;
+        package_db_foreach(db, android_load_package, NULL);
+    }
+    
     // Uygulama listesini yenile
     android_manager_refresh_app_list();
     
@@ -59,70 +129,104 @@ int android_manager_refresh_app_list() {
         return -1;
     }
     
-    // Eski uygulama listesini temizle
-    for (uint32_t i = 0; i < android_manager->app_count; i++) {
-        if (android_manager->apps[i]) {
-            // Çalışan uygulamaları durdur
-            if (android_manager->apps[i]->state == ANDROID_APP_STATE_RUNNING || 
-                android_manager->apps[i]->state == ANDROID_APP_STATE_PAUSED) {
-                android_force_stop_app(android_manager->apps[i]);
-            }
-            
-            // Uygulama belleğini serbest bırak
-            free(android_manager->apps[i]);
-            android_manager->apps[i] = NULL;
+    // Dizin değişmediyse tarama gerekmez: APK eklemek, silmek ya da yerine
+    // taşımak dizinin mtime'ını değiştirir
+    struct stat st;
+    if (stat(android_manager->apps_dir, &st) != 0 || !S_ISDIR(st.st_mode)) {
+        return 0;  // Henüz uygulama dizini yok
+    }
+    
+    uint64_t dir_mtime = android_file_mtime(&st);
+    if (dir_mtime == android_manager->apps_dir_mtime) {
+        return 0;
+    }
+    
+    DIR* dir = opendir(android_manager->apps_dir);
+    if (!dir) {
+        return -2;
+    }
+    
+    uint32_t generation = ++android_manager->scan_generation;
+    uint8_t changed = 0;
+    char apk_path[256];
+    struct dirent* entry;
+    
+    while ((entry = readdir(dir)) != NULL) {
+        size_t length = strlen(entry->d_name);
+        if (length <= 4 || strcmp(entry->d_name + length - 4, ".apk") != 0) {
+            continue;
+        }
+    
+        if (snprintf(apk_path, sizeof(apk_path), "%s/%s", android_manager->apps_dir, entry->d_name) >= (int)sizeof(apk_path) ||
+            stat(apk_path, &st) != 0 || !S_ISREG(st.st_mode)) {
+            continue;
+        }
+    
+        // Değişmemiş APK yeniden ayrıştırılmaz
+        uint64_t apk_mtime = android_file_mtime(&st);
+        android_app_t* app = (android_app_t*)package_index_find(&android_path_index, apk_path);
+        if (app && app->apk_mtime == apk_mtime) {
+            app->scan_generation = generation;
+            continue;
+        }
+    
+        android_app_info_t* info = android_get_app_info(apk_path);
+        if (!info) {
+            continue;
+        }
+    
+        // Yeni ya da değişmiş APK. Bilgiler yerinde güncellenir; çalışan
+        // uygulama durdurulmaz, yeni bilgiler sonraki başlatmada kullanılır.
+        app = android_find_app_by_package(info->package_name);
+        if (app) {
+            android_set_app_info(app, info, apk_mtime);
+        } else {
+            app = android_add_app(info, android_next_uid, apk_mtime);
+        }
+    
+        if (app) {
+            app->scan_generation = generation;
+            android_persist_app(app);
+            changed = 1;
         }
+    
+        free(info);
     }
     
-    // Uygulama sayısını sıfırla
-    android_manager->app_count = 0;
+    closedir(dir);
     
-    // Uygulama dizinini tara ve APK'ları bul
-    // Gerçek bir uygulamada, burada dosya sistemi işlemleri yapılır
-    // ...
+    // APK'sı dizinden silinen uygulamaları kaldır. Çalışanlara dokunulmaz;
+    // durduklarında sonraki taramada kaldırılırlar.
+    uint8_t deferred = 0;
+    for (uint32_t i = android_manager->app_count; i-- > 0;) {
+        android_app_t* app = android_manager->apps[i];
+        if (app->scan_generation == generation || !android_apk_in_apps_dir(app->info.apk_path)) {
+            continue;
+        }
     
-    // Demo amaçlı, bazı örnek uygulamalar ekle
-    android_app_info_t apps[] = {
-        {
-            "com.example.calculator", "Hesap Makinesi", "1.0", 1, 21, 30,
-            "/var/lib/android/apps/calculator/icon.png", "/var/lib/android/data/com.example.calculator",
-            PERMISSION_INTERNET, 0, 1,
-            "/var/lib/android/apps/calculator.apk", 1024 * 1024, "abcdef123456"
-        },
-        {
-            "com.example.browser", "Web Tarayıcı", "2.1", 5, 21, 30,
-            "/var/lib/android/apps/browser/icon.png", "/var/lib/android/data/com.example.browser",
-            PERMISSION_INTERNET | PERMISSION_STORAGE, 0, 1,
-            "/var/lib/android/apps/browser.apk", 2 * 1024 * 1024, "123456abcdef"
-        },
-        {
-            "com.example.gallery", "Galeri", "1.5", 3, 21, 30,
-            "/var/lib/android/apps/gallery/icon.png", "/var/lib/android/data/com.example.gallery",
-            PERMISSION_STORAGE | PERMISSION_CAMERA, 0, 1,
-            "/var/lib/android/apps/gallery.apk", 1.5 * 1024 * 1024, "abcdef654321"
+        if (app->state == ANDROID_APP_STATE_RUNNING || app->state == ANDROID_APP_STATE_PAUSED) {
+            deferred = 1;
+            continue;
         }
-    };
-    
-    // Örnek uygulamaları ekle
-    for (uint32_t i = 0; i < sizeof(apps) / sizeof(android_app_info_t); i++) {
-        // Yeni uygulama için bellek ayır
-        android_app_t* app = (android_app_t*)malloc(sizeof(android_app_t));
-        if (!app) {
-            continue;  // Bellek hatası, sonrakine geç
+    
+        if (android_manager->package_db) {
+            package_db_delete(android_manager->package_db, app->info.package_name);
         }
-        
-        // Uygulama bilgilerini kopyala
-        memset(app, 0, sizeof(android_app_t));
-        app->info = apps[i];
-        app->state = ANDROID_APP_STATE_STOPPED;
-        app->container = NULL;
-        app->pid = 0;
-        app->uid = 10000 + i;  // Android tarzı UID
-        
-        // Uygulama listesine ekle
-        android_manager->apps[android_manager->app_count++] = app;
+        android_remove_app(app);
+        changed = 1;
     }
     
+    if (changed && android_manager->package_db) {
+        package_db_sync(android_manager->package_db);
+    }
+    
+    // Tarama sırasında yapılan değişiklik mtime'ı değiştirmeyebilir (zaman
+    // damgası çözünürlüğü); son bir saniyede değişmiş dizin önbelleğe alınmaz
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+    uint64_t now_ns = (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+    android_manager->apps_dir_mtime = (deferred || dir_mtime + 1000000000ull > now_ns) ? 0 : dir_mtime;
+    
     return 0;
 }
 
@@ -153,6 +257,27 @@ int android_manager_cleanup() {
         android_manager->apps = NULL;
     }
     
+    if (android_manager->usage_sampler) {
+        usage_sampler_destroy(android_manager->usage_sampler);
+        android_manager->usage_sampler = NULL;
+    }
+    
+    // Bekleyen intentler teslim edilir
+    if (android_manager->intent_router) {
+        intent_router_destroy(android_manager->intent_router);
+        android_manager->intent_router = NULL;
+    }
+    
+    // Veritabanını kapat (indeks yazılır)
+    if (android_manager->package_db) {
+        package_db_close(android_manager->package_db);
+        android_manager->package_db = NULL;
+    }
+    
+    package_index_destroy(&android_package_index);
+    package_index_destroy(&android_path_index);
+    package_index_destroy(&android_pid_index);
+    
     // Yönetici belleğini serbest bırak
     free(android_manager);
     android_manager = NULL;
@@ -190,28 +315,25 @@ int android_install_apk(const char* apk_path) {
     }
     
     // APK dosyasını çıkar ve kur
-    // Gerçek bir uygulamada, burada APK çıkarma ve kurma işlemleri yapılır
-    // ...
+    if (android_extract_apk(apk_path, info) != 0) {
+        free(info);
+        return -4;  // Çıkarma ya da imza doğrulama hatası
+    }
     
-    // Yeni uygulama için bellek ayır
-    android_app_t* app = (android_app_t*)malloc(sizeof(android_app_t));
+    // Uygulama listesine ekle
+    struct stat st;
+    android_app_t* app = android_add_app(info, android_next_uid, stat(apk_path, &st) == 0 ? android_file_mtime(&st) : 0);
+    free(info);
     if (!app) {
-        free(info);
         return -3;  // Bellek hatası
     }
     
-    // Uygulama bilgilerini ayarla
-    memset(app, 0, sizeof(android_app_t));
-    app->info = *info;
-    app->state = ANDROID_APP_STATE_STOPPED;
-    app->container = NULL;
-    app->pid = 0;
-    app->uid = 10000 + android_manager->app_count;  // Android tarzı UID
-    
-    // Uygulama listesine ekle
-    android_manager->apps[android_manager->app_count++] = app;
+    // Veritabanına yaz
+    android_persist_app(app);
+    if (android_manager->package_db) {
+        package_db_sync(android_manager->package_db);
+    }
     
-    free(info);
     return 0;
 }
 
@@ -226,39 +348,31 @@ int android_uninstall_app(const char* package_name) {
     }
     
     // Uygulamayı bul
-    int app_index = -1;
-    for (uint32_t i = 0; i < android_manager->app_count; i++) {
-        if (strcmp(android_manager->apps[i]->info.package_name, package_name) == 0) {
-            app_index = i;
-            break;
-        }
-    }
-    
-    if (app_index < 0) {
+    android_app_t* app = android_find_app_by_package(package_name);
+    if (!app) {
         return -2;  // Uygulama bulunamadı
     }
     
     // Çalışıyorsa önce sonlandır
-    if (android_manager->apps[app_index]->state == ANDROID_APP_STATE_RUNNING || 
-        android_manager->apps[app_index]->state == ANDROID_APP_STATE_PAUSED) {
-        android_force_stop_app(android_manager->apps[app_index]);
+    if (app->state == ANDROID_APP_STATE_RUNNING || 
+        app->state == ANDROID_APP_STATE_PAUSED) {
+        android_force_stop_app(app);
     }
     
     // Uygulama dosyalarını temizle
-    // Gerçek bir uygulamada, burada dosya silme işlemleri yapılır
-    // ...
-    
-    // Uygulama belleğini serbest bırak
-    free(android_manager->apps[app_index]);
+    char install_dir[512];
+    if (android_install_dir(package_name, install_dir, sizeof(install_dir)) == 0) {
+        apk_install_remove(install_dir);
+    }
     
-    // Listedeki boşluğu kapat
-    for (uint32_t i = app_index; i < android_manager->app_count - 1; i++) {
-        android_manager->apps[i] = android_manager->apps[i + 1];
+    // Veritabanından sil
+    if (android_manager->package_db) {
+        package_db_delete(android_manager->package_db, package_name);
+        package_db_sync(android_manager->package_db);
     }
     
-    // Son elemanı sıfırla ve sayacı azalt
-    android_manager->apps[android_manager->app_count - 1] = NULL;
-    android_manager->app_count--;
+    // Listeden çıkar ve belleği serbest bırak
+    android_remove_app(app);
     
     return 0;
 }
@@ -293,38 +407,239 @@ int android_update_app(const char* apk_path) {
         android_force_stop_app(existing_app);
     }
     
-    // APK dosyasını güncelle
-    // Gerçek bir uygulamada, burada APK güncelleme işlemleri yapılır
-    // ...
+    // APK dosyasını güncelle: yeni sürüm hazırlık dizinine çıkarılıp eskisinin
+    // yerine taşınır, hata olursa kurulu sürüm korunur
+    if (android_extract_apk(apk_path, info) != 0) {
+        free(info);
+        return -4;
+    }
     
     // Uygulama bilgilerini güncelle
-    existing_app->info = *info;
+    struct stat st;
+    android_set_app_info(existing_app, info, stat(apk_path, &st) == 0 ? android_file_mtime(&st) : 0);
     existing_app->state = ANDROID_APP_STATE_STOPPED;
-    
     free(info);
+    
+    // Veritabanına yaz
+    android_persist_app(existing_app);
+    if (android_manager->package_db) {
+        package_db_sync(android_manager->package_db);
+    }
+    
+    return 0;
+}
+
+// APK içeriğini uygulama dizinine çıkar. DEX, kaynaklar ve yerel kütüphaneler
+// paralel çıkarılır. İmza bloğundaki özetle eşleşen içerik özeti apk_digest'e
+// yazılır; imzalayan doğrulanmadığından imza alanına yazılmaz.
+static int android_extract_apk(const char* apk_path, android_app_info_t* info) {
+    char install_dir[512];
+    apk_install_stats_t stats;
+    
+    if (android_install_dir(info->package_name, install_dir, sizeof(install_dir)) != 0) {
+        return APK_INSTALL_ERROR_INVALID;
+    }
+    int result = apk_install(apk_path, install_dir, NULL, 0, &stats);
+    if (result != 0) {
+        printf("APK kurulamadı: %s (hata %d)\n", apk_path, result);
+        return result;
+    }
+    
+    info->apk_digest[0] = '\0';
+    if (stats.signature == APK_SIGNATURE_DIGEST_MATCHED) {
+        for (int i = 0; i < 32; i++) {
+            snprintf(info->apk_digest + i * 2, 3, "%02x", stats.digest[i]);
+        }
+    }
+    
+    return 0;
+}
+
+// Uygulamayı listeye ve karmalara ekle
+static android_app_t* android_add_app(const android_app_info_t* info, uint32_t uid, uint64_t apk_mtime) {
+    // Liste doluysa büyüt
+    if (android_manager->app_count == android_manager->app_capacity) {
+        uint32_t capacity = android_manager->app_capacity * 2;
+        android_app_t** apps = (android_app_t**)realloc(android_manager->apps, sizeof(android_app_t*) * capacity);
+        if (!apps) {
+            return NULL;
+        }
+        android_manager->apps = apps;
+        android_manager->app_capacity = capacity;
+    }
+    
+    android_app_t* app = (android_app_t*)calloc(1, sizeof(android_app_t));
+    if (!app) {
+        return NULL;
+    }
+    
+    app->info = *info;
+    app->state = ANDROID_APP_STATE_STOPPED;
+    app->container = NULL;
+    app->pid = 0;
+    app->uid = uid;
+    app->apk_mtime = apk_mtime;
+    
+    if (package_index_insert(&android_package_index, app->info.package_name, app) != 0) {
+        free(app);
+        return NULL;
+    }
+    package_index_insert(&android_path_index, app->info.apk_path, app);
+    
+    if (uid >= android_next_uid) {
+        android_next_uid = uid + 1;
+    }
+    
+    // Başlatıcı filtresi. Manifest ayrıştırılmadığından diğer filtreler
+    // android_register_intent_filter ile eklenir.
+    if (android_manager->intent_router) {
+        static const char* const launcher[] = { "android.intent.category.LAUNCHER", NULL };
+        intent_filter_t filter = { "android.intent.action.MAIN", NULL, launcher };
+        intent_router_add_filter(android_manager->intent_router, app->info.package_name, ".MainActivity", &filter);
+    }
+    
+    android_manager->apps[android_manager->app_count++] = app;
+    return app;
+}
+
+// Uygulamayı listeden ve karmalardan çıkar
+static void android_remove_app(android_app_t* app) {
+    package_index_erase(&android_package_index, app->info.package_name);
+    if (android_manager->intent_router) {
+        intent_router_remove_package(android_manager->intent_router, app->info.package_name);
+    }
+    
+    // Aynı yol ya da pid başka bir uygulamaya geçmiş olabilir
+    if (package_index_find(&android_path_index, app->info.apk_path) == app) {
+        package_index_erase(&android_path_index, app->info.apk_path);
+    }
+    if (app->pid > 0 && package_index_find_id(&android_pid_index, app->pid) == app) {
+        package_index_erase_id(&android_pid_index, app->pid);
+    }
+    
+    // Listedeki boşluğu kapat
+    for (uint32_t i = 0; i < android_manager->app_count; i++) {
+        if (android_manager->apps[i] == app) {
+            memmove(&android_manager->apps[i], &android_manager->apps[i + 1],
+                    sizeof(android_app_t*) * (android_manager->app_count - i - 1));
+            android_manager->apps[--android_manager->app_count] = NULL;
+            break;
+        }
+    }
+    
+    free(app);
+}
+
+// Uygulama bilgilerini yerinde değiştir; karma anahtarları yapının içinde
+// olduğundan yol karması yeniden kurulur
+static void android_set_app_info(android_app_t* app, const android_app_info_t* info, uint64_t apk_mtime) {
+    if (package_index_find(&android_path_index, app->info.apk_path) == app) {
+        package_index_erase(&android_path_index, app->info.apk_path);
+    }
+    
+    app->info = *info;
+    app->apk_mtime = apk_mtime;
+    
+    package_index_insert(&android_package_index, app->info.package_name, app);
+    package_index_insert(&android_path_index, app->info.apk_path, app);
+}
+
+// Uygulamayı veritabanına yaz (diske zorlama çağıranın işidir)
+static void android_persist_app(android_app_t* app) {
+    android_package_record_t record;
+    
+    if (!android_manager->package_db) {
+        return;
+    }
+    
+    memset(&record, 0, sizeof(record));
+    record.info = app->info;
+    record.uid = app->uid;
+    package_db_put(android_manager->package_db, app->info.package_name, &record, app->apk_mtime);
+}
+
+// Veritabanı kaydından durdurulmuş uygulama oluştur
+static int android_load_package(const char* name, const void* record, uint64_t stamp, void* arg) {
+    const android_package_record_t* package = (const android_package_record_t*)record;
+    (void)name;
+    (void)arg;
+    
+    android_add_app(&package->info, package->uid, stamp);
     return 0;
 }
 
+// Paketin kurulum dizini: "<apps_dir>/<paket>"
+static int android_install_dir(const char* package_name, char* buffer, size_t size) {
+    int length = snprintf(buffer, size, "%s/%s", android_manager->apps_dir, package_name);
+    
+    return (length < 0 || (size_t)length >= size) ? -1 : 0;
+}
+
+// APK doğrudan uygulama dizininde mi?
+static uint8_t android_apk_in_apps_dir(const char* apk_path) {
+    size_t length = strlen(android_manager->apps_dir);
+    
+    return strncmp(apk_path, android_manager->apps_dir, length) == 0 && apk_path[length] == '/' &&
+           strchr(apk_path + length + 1, '/') == NULL;
+}
+
+static uint64_t android_file_mtime(const struct stat* st) {
+    return (uint64_t)st->st_mtim.tv_sec * 1000000000ull + (uint64_t)st->st_mtim.tv_nsec;
+}
+
+// Intent teslimi (yönlendiricinin işçi iş parçacığında). Uygulamanın binder
+// servisi yoksa intent bırakılır.
+static void android_deliver_intent(const char* package, const char* component, const intent_message_t* intent, void* arg) {
+    android_intent_parcel_t parcel;
+    (void)arg;
+    
+    void* service = binder_get_service(package);
+    if (!service) {
+        return;
+    }
+    
+    memset(&parcel, 0, sizeof(parcel));
+    memcpy(parcel.action, intent->action, sizeof(parcel.action));
+    memcpy(parcel.type, intent->type, sizeof(parcel.type));
+    snprintf(parcel.component, sizeof(parcel.component), "%s", component ? component : "");
+    parcel.categories = intent->categories;
+    parcel.extras = (uint64_t)(uintptr_t)intent->extras;
+    
+    binder_transact(service, ANDROID_INTENT_TRANSACTION, &parcel, sizeof(parcel), NULL, 0, NULL, BINDER_FLAG_ONEWAY);
+}
+
 // APK bilgilerini al
 android_app_info_t* android_get_app_info(const char* apk_path) {
-    if (!apk_path) {
+    struct stat st;
+    
+    if (!apk_path || strlen(apk_path) >= sizeof(((android_app_info_t*)0)->apk_path) || stat(apk_path, &st) != 0) {
         return NULL;
     }
     
-    // APK içeriğini oku ve bilgileri çıkar
-    // Gerçek bir uygulamada, burada APK analizi yapılır
-    // ...
+    // Gerçek bir uygulamada paket adı ve sürüm manifestten okunur. Burada
+    // dosya adından türetilir: aynı APK her zaman aynı pakete çözülür.
+    const char* base = strrchr(apk_path, '/');
+    base = base ? base + 1 : apk_path;
+    size_t length = strlen(base);
+    if (length > 4 && strcmp(base + length - 4, ".apk") == 0) {
+        length -= 4;
+    }
+    if (length == 0 || length >= 128) {
+        return NULL;
+    }
     
-    // Demo amaçlı, örnek bilgiler döndür
     android_app_info_t* info = (android_app_info_t*)malloc(sizeof(android_app_info_t));
     if (!info) {
         return NULL;
     }
     
-    // Örnek bilgiler
     memset(info, 0, sizeof(android_app_info_t));
-    sprintf(info->package_name, "com.example.app%d", rand() % 100);
-    sprintf(info->app_name, "Örnek Uygulama %d", rand() % 100);
+    memcpy(info->app_name, base, length);
+    if (memchr(base, '.', length)) {
+        memcpy(info->package_name, base, length);
+    } else {
+        snprintf(info->package_name, sizeof(info->package_name), "com.example.%s", info->app_name);
+    }
     strcpy(info->version_name, "1.0");
     info->version_code = 1;
     info->min_sdk_version = 21;
@@ -335,8 +650,7 @@ android_app_info_t* android_get_app_info(const char* apk_path) {
     info->is_system_app = 0;
     info->is_debuggable = 1;
     strcpy(info->apk_path, apk_path);
-    info->apk_size = 1024 * 1024;  // 1MB
-    sprintf(info->apk_signature, "abcdef%d", rand() % 1000000);
+    info->apk_size = (uint64_t)st.st_size;
     
     return info;
 }
@@ -374,26 +688,45 @@ android_app_t* android_launch_app(const char* package_name) {
     // Başlatma durumuna geç
     app->state = ANDROID_APP_STATE_STARTING;
     
-    // Android Runtime hazır mı kontrol et
-    if (!android_manager->runtime) {
-        return NULL;  // Runtime hazır değil
+    // Kod kurulumda ayıklanan dizinden yüklenir. Taramayla bulunup henüz
+    // kurulmamış uygulamalar doğrudan APK'dan (sıkıştırılmamış DEX) yüklenir.
+    char install_dir[ZYGOTE_PATH_MAX];
+    struct stat st;
+    const char* code_path = app->info.apk_path;
+    if (android_install_dir(app->info.package_name, install_dir, sizeof(install_dir)) == 0 &&
+        stat(install_dir, &st) == 0 && S_ISDIR(st.st_mode)) {
+        code_path = install_dir;
     }
     
-    // Uygulama için konteyner oluştur
-    // Gerçek bir uygulamada, burada konteyner oluşturma ve başlatma işlemleri yapılır
-    // ...
+    // Uygulama süreci önceden başlatılmış ART'ı taşıyan zygote'tan fork edilir
+    pid_t pid = zygote_fork_app(app->info.package_name, code_path, app->uid);
+    if (pid <= 0) {
+        app->state = ANDROID_APP_STATE_STOPPED;
+        return NULL;  // Runtime hazır değil ya da süreç oluşturulamadı
+    }
     
     // İstatistikleri başlat
     app->start_time = time(NULL);
     app->last_active_time = app->start_time;
     app->memory_usage = 0;
     app->cpu_usage = 0.0f;
+    app->pid = (uint32_t)pid;
+    package_index_insert_id(&android_pid_index, app->pid, app);
+    if (android_manager->usage_sampler) {
+        usage_sampler_track(android_manager->usage_sampler, pid, app->info.package_name);
+    }
     
-    // Sahte PID ata (gerçek bir sistemde, işlem oluşturulur)
-    app->pid = 1000 + rand() % 9000;
+    // Başlangıçta yalnızca zygote'tan ayrışan sayfalar uygulamaya aittir
+    zygote_memory_t memory;
+    if (zygote_get_memory(pid, &memory) == 0) {
+        app->memory_usage = memory.private_kb * 1024;
+    }
     
-    // Çalışıyor durumuna geç
+    // Çalışıyor durumuna geç; yayınlar artık bu uygulamaya da gider
     app->state = ANDROID_APP_STATE_RUNNING;
+    if (android_manager->intent_router) {
+        intent_router_set_active(android_manager->intent_router, app->info.package_name, 1);
+    }
     
     return app;
 }
@@ -415,6 +748,15 @@ int android_stop_app(android_app_t* app) {
         // ...
     }
     
+    // Uygulama sürecini sonlandır (zygote çocuğu toplar)
+    if (app->pid > 0) {
+        zygote_kill_app((pid_t)app->pid);
+        package_index_erase_id(&android_pid_index, app->pid);
+        if (android_manager->usage_sampler) {
+            usage_sampler_untrack(android_manager->usage_sampler, (pid_t)app->pid);
+        }
+    }
+    
     // İstatistikleri temizle
     app->pid = 0;
     app->memory_usage = 0;
@@ -422,6 +764,9 @@ int android_stop_app(android_app_t* app) {
     
     // Durduruldu durumuna geç
     app->state = ANDROID_APP_STATE_STOPPED;
+    if (android_manager && android_manager->intent_router) {
+        intent_router_set_active(android_manager->intent_router, app->info.package_name, 0);
+    }
     
     return 0;
 }
@@ -495,6 +840,14 @@ int android_force_stop_app(android_app_t* app) {
         // ...
     }
     
+    if (app->pid > 0) {
+        zygote_kill_app((pid_t)app->pid);
+        package_index_erase_id(&android_pid_index, app->pid);
+        if (android_manager->usage_sampler) {
+            usage_sampler_untrack(android_manager->usage_sampler, (pid_t)app->pid);
+        }
+    }
+    
     // İstatistikleri temizle
     app->pid = 0;
     app->memory_usage = 0;
@@ -502,6 +855,9 @@ int android_force_stop_app(android_app_t* app) {
     
     // Durduruldu durumuna geç
     app->state = ANDROID_APP_STATE_STOPPED;
+    if (android_manager && android_manager->intent_router) {
+        intent_router_set_active(android_manager->intent_router, app->info.package_name, 0);
+    }
     
     return 0;
 }
@@ -597,14 +953,7 @@ android_app_t* android_find_app_by_package(const char* package_name) {
         return NULL;
     }
     
-    // Uygulamayı bul
-    for (uint32_t i = 0; i < android_manager->app_count; i++) {
-        if (strcmp(android_manager->apps[i]->info.package_name, package_name) == 0) {
-            return android_manager->apps[i];
-        }
-    }
-    
-    return NULL;
+    return (android_app_t*)package_index_find(&android_package_index, package_name);
 }
 
 // PID ile uygulama bul
@@ -613,14 +962,7 @@ android_app_t* android_find_app_by_pid(uint32_t pid) {
         return NULL;
     }
     
-    // Uygulamayı bul
-    for (uint32_t i = 0; i < android_manager->app_count; i++) {
-        if (android_manager->apps[i]->pid == pid) {
-            return android_manager->apps[i];
-        }
-    }
-    
-    return NULL;
+    return (android_app_t*)package_index_find_id(&android_pid_index, pid);
 }
 
 // İzin kontrolü
@@ -667,26 +1009,37 @@ int android_send_intent(const char* action, const char* target_package, const ch
         return -1;
     }
     
-    // Hedef paket belirtildiyse, uygulamayı bul
-    android_app_t* target_app = NULL;
-    if (target_package) {
-        target_app = android_find_app_by_package(target_package);
-        if (!target_app) {
-            return -2;  // Hedef uygulama bulunamadı
+    // Hedef belirtilmediyse filtrelerden ilk eşleşen bileşen seçilir
+    intent_match_t match;
+    if (!target_package) {
+        uint32_t count = 0;
+        if (!android_manager->intent_router ||
+            intent_router_resolve(android_manager->intent_router, action, NULL, NULL, &match, 1, &count) != 0 || count == 0) {
+            return -2;  // Eşleşen uygulama yok
         }
-        
-        // Uygulama çalışmıyorsa başlat
-        if (target_app->state == ANDROID_APP_STATE_STOPPED) {
-            target_app = android_launch_app(target_package);
-            if (!target_app) {
-                return -3;  // Uygulama başlatılamadı
-            }
+        target_package = match.package;
+        target_component = match.component;
+    }
+    
+    // Hedef uygulamayı bul
+    android_app_t* target_app = android_find_app_by_package(target_package);
+    if (!target_app) {
+        return -2;  // Hedef uygulama bulunamadı
+    }
+    
+    // Uygulama çalışmıyorsa başlat
+    if (target_app->state == ANDROID_APP_STATE_STOPPED) {
+        target_app = android_launch_app(target_package);
+        if (!target_app) {
+            return -3;  // Uygulama başlatılamadı
         }
     }
     
-    // Intent işlemini gerçekleştir
-    // Gerçek bir uygulamada, burada intent işleme kodları olur
-    // ...
+    // Uygulamanın kuyruğuna ekle; teslim zaman uyumsuzdur
+    if (!android_manager->intent_router ||
+        intent_router_send(android_manager->intent_router, target_package, target_component, action, NULL, extras) != 0) {
+        return -4;  // Kuyruk dolu ya da yönlendirici yok
+    }
     
     return 0;
 }
@@ -701,16 +1054,41 @@ int android_broadcast_intent(const char* action, void* extras) {
         return -1;
     }
     
-    // Tüm uygulamalara yayın yap
-    for (uint32_t i = 0; i < android_manager->app_count; i++) {
-        // Sadece çalışan uygulamalara gönder
-        if (android_manager->apps[i]->state == ANDROID_APP_STATE_RUNNING || 
-            android_manager->apps[i]->state == ANDROID_APP_STATE_PAUSED) {
-            // Intent işlemini gerçekleştir
-            // Gerçek bir uygulamada, burada broadcast intent işleme kodları olur
-            // ...
-        }
+    // Eşleşen filtreler indeksten bulunur; yalnızca çalışan (ya da
+    // duraklatılmış) uygulamaların kuyruklarına eklenir
+    if (!android_manager->intent_router ||
+        intent_router_broadcast(android_manager->intent_router, action, NULL, NULL, extras, NULL) != 0) {
+        return -2;
+    }
+    
+    return 0;
+} 
+
+// Kurulu uygulama için intent filtresi kaydet
+int android_register_intent_filter(const char* package_name, const char* component, const char* action,
+                                   const char* type, const char* const* categories) {
+    if (!android_manager || !android_manager->initialized || !android_manager->intent_router) {
+        return -1;
+    }
+    
+    if (!package_name || !action) {
+        return -1;
+    }
+    
+    if (!android_find_app_by_package(package_name)) {
+        return -2;  // Uygulama bulunamadı
+    }
+    
+    intent_filter_t filter = { action, type, categories };
+    if (intent_router_add_filter(android_manager->intent_router, package_name, component, &filter) != 0) {
+        return -3;
+    }
+    
+    // Filtre çalışan bir uygulamaya eklendiyse yayın almaya başlar
+    android_app_t* app = android_find_app_by_package(package_name);
+    if (app->state == ANDROID_APP_STATE_RUNNING || app->state == ANDROID_APP_STATE_PAUSED) {
+        intent_router_set_active(android_manager->intent_router, package_name, 1);
     }
     
     return 0;
-} 
\ No newline at end of file
+}
@@ -0,0 +1,972 @@
+#include "../../include/android/package_db.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define PACKAGE_DB_INDEX_MAGIC     "KPDI"
+#define PACKAGE_DB_HEADER_SIZE     16
+#define PACKAGE_DB_MAP_MIN         (64 * 1024)     // İlk eşleme boyutu
+#define PACKAGE_DB_COMPACT_MIN     (64 * 1024)     // Bu boyutun altında sıkıştırılmaz
+
+// Kayıt türleri
+#define PACKAGE_DB_PUT             1
+#define PACKAGE_DB_DELETE          2
+
+// Günlük başlığı
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t record_size;
+    uint32_t generation;           // Her sıkıştırmada değişir; eski indeksi geçersiz kılar
+} package_db_header_t;
+
+// Kayıt başlığı; ardından ad (NUL ile) ve PUT için veri gelir, ikisi de 8'e hizalı
+typedef struct {
+    uint32_t crc;                  // Başlığın geri kalanı, ad ve veri
+    uint8_t type;
+    uint8_t name_length;
+    uint16_t reserved;
+    uint64_t stamp;
+} package_db_record_t;
+
+// İndeks dosyası başlığı; ardından capacity adet yuva gelir
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t record_size;
+    uint32_t generation;
+    uint32_t capacity;
+    uint32_t count;
+    uint64_t log_size;             // İndeksin kapsadığı günlük öneki
+    uint64_t live_bytes;
+    uint32_t crc;                  // Yuvaların CRC-32'si
+    uint32_t reserved;
+} package_db_index_header_t;
+
+// Karma yuvası; offset 0 boş yuvadır (0 ofsetinde günlük başlığı vardır)
+typedef struct {
+    uint32_t hash;
+    uint32_t offset;
+} package_db_slot_t;
+
+struct package_db {
+    int fd;
+    char* path;
+    uint32_t record_size;
+    uint32_t generation;
+    uint8_t* base;                 // Günlük eşlemesi
+    size_t mapped;
+    uint64_t size;                 // Günlüğün mantıksal boyutu
+    uint64_t synced_size;          // Diske zorlanmış boyut
+    uint64_t indexed_size;         // Son yazılan indeksin kapsadığı boyut
+    uint64_t live_bytes;           // Canlı kayıtların toplam boyutu
+    package_db_slot_t* slots;
+    uint32_t capacity;
+    uint32_t count;
+    uint8_t* scratch;              // Kayıt oluşturma tamponu
+};
+
+// Bellek içi karma yuvası; değeri NULL olan yuva boştur
+struct package_index_slot {
+    uint32_t hash;
+    uint32_t id;
+    const char* key;               // NULL: sayısal anahtar
+    void* value;
+};
+
+static uint32_t package_crc_table[256];
+static uint8_t package_crc_ready = 0;
+static uint32_t package_generation_serial = 0;
+
+// Yardımcı fonksiyonlar
+static void package_db_free(package_db_t* db);
+static int package_db_map(package_db_t* db, uint64_t size);
+static int package_db_load_index(package_db_t* db, uint64_t* replay_from);
+static int package_db_write_index(package_db_t* db);
+static int package_db_replay(package_db_t* db, uint64_t offset);
+static int package_db_append(package_db_t* db, uint8_t type, const char* name, size_t name_length,
+                             const void* record, uint64_t stamp, uint64_t* offset);
+static int package_db_compact(package_db_t* db);
+static uint32_t package_db_record_length(const package_db_t* db, const package_db_record_t* record);
+static package_db_slot_t* package_db_lookup(package_db_t* db, const char* name, size_t length, uint32_t hash);
+static int package_db_set(package_db_t* db, const char* name, size_t length, uint32_t offset);
+static void package_db_unset(package_db_t* db, package_db_slot_t* slot);
+static int package_db_grow(package_db_t* db);
+static uint32_t package_db_new_generation(void);
+static int package_db_write_all(int fd, const void* data, size_t size, uint64_t offset);
+static uint32_t package_hash(const char* key, size_t length);
+static uint32_t package_hash_id(uint32_t id);
+static uint32_t package_crc32(uint32_t crc, const void* data, size_t size);
+static struct package_index_slot* package_index_probe(const package_index_t* index, const char* key, uint32_t id, uint32_t hash);
+static int package_index_store(package_index_t* index, const char* key, uint32_t id, uint32_t hash, void* value);
+static void package_index_remove_slot(package_index_t* index, struct package_index_slot* slot);
+
+static inline uint32_t package_align8(uint32_t value) {
+    return (value + 7) & ~7u;
+}
+
+// Veritabanını aç; dosya yoksa oluşturulur
+int package_db_open(const char* path, uint32_t record_size, package_db_t** db_out) {
+    struct stat st;
+    
+    if (!path || !db_out || record_size == 0) {
+        return PACKAGE_DB_ERROR_INVALID;
+    }
+    *db_out = NULL;
+    
+    package_db_t* db = (package_db_t*)calloc(1, sizeof(package_db_t));
+    if (!db) {
+        return PACKAGE_DB_ERROR_NO_MEMORY;
+    }
+    
+    db->fd = -1;
+    db->record_size = record_size;
+    db->path = strdup(path);
+    db->scratch = (uint8_t*)malloc(sizeof(package_db_record_t) + package_align8(PACKAGE_DB_NAME_MAX + 1) +
+                                   package_align8(record_size));
+    if (!db->path || !db->scratch) {
+        package_db_free(db);
+        return PACKAGE_DB_ERROR_NO_MEMORY;
+    }
+    
+    db->fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (db->fd < 0 || fstat(db->fd, &st) != 0) {
+        package_db_free(db);
+        return PACKAGE_DB_ERROR_IO;
+    }
+    
+    if (st.st_size == 0) {
+        // Yeni günlük
+        package_db_header_t header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, PACKAGE_DB_MAGIC, 4);
+        header.version = PACKAGE_DB_VERSION;
+        header.record_size = record_size;
+        header.generation = package_db_new_generation();
+        if (package_db_write_all(db->fd, &header, sizeof(header), 0) != 0 || fsync(db->fd) != 0) {
+            package_db_close(db);
+            return PACKAGE_DB_ERROR_IO;
+        }
+        st.st_size = sizeof(header);
+    }
+    
+    int status = package_db_map(db, (uint64_t)st.st_size);
+    if (status != 0) {
+        package_db_free(db);
+        return status;
+    }
+    db->size = (uint64_t)st.st_size;
+    
+    const package_db_header_t* header = (const package_db_header_t*)db->base;
+    if (db->size < PACKAGE_DB_HEADER_SIZE || memcmp(header->magic, PACKAGE_DB_MAGIC, 4) != 0 ||
+        header->version != PACKAGE_DB_VERSION || header->record_size != record_size) {
+        package_db_free(db);
+        return PACKAGE_DB_ERROR_FORMAT;
+    }
+    db->generation = header->generation;
+    
+    // İndeks günlüğün bir önekini kapsar; geri kalanı oynatılır
+    uint64_t replay_from = PACKAGE_DB_HEADER_SIZE;
+    if (package_db_load_index(db, &replay_from) != 0) {
+        free(db->slots);
+        db->slots = NULL;
+        db->capacity = 0;
+        db->count = 0;
+        db->live_bytes = 0;
+        replay_from = PACKAGE_DB_HEADER_SIZE;
+    }
+    
+    if (!db->slots) {
+        db->capacity = 64;
+        db->slots = (package_db_slot_t*)calloc(db->capacity, sizeof(package_db_slot_t));
+        if (!db->slots) {
+            package_db_close(db);
+            return PACKAGE_DB_ERROR_NO_MEMORY;
+        }
+    }
+    
+    db->indexed_size = replay_from;
+    status = package_db_replay(db, replay_from);
+    if (status != 0) {
+        package_db_free(db);
+        return status;
+    }
+    
+    db->synced_size = db->size;
+    *db_out = db;
+    return 0;
+}
+
+// Veritabanını kapat; değiştiyse indeks yazılır
+void package_db_close(package_db_t* db) {
+    if (!db) {
+        return;
+    }
+    
+    package_db_sync(db);
+    package_db_free(db);
+}
+
+// Eşlemeyi ve belleği bırak. Açılışı tamamlanmamış veritabanı da buradan
+// bırakılır; yarım tabloyla eşitleme günlüğü boşaltırdı.
+static void package_db_free(package_db_t* db) {
+    if (db->base) {
+        munmap(db->base, db->mapped);
+    }
+    if (db->fd >= 0) {
+        close(db->fd);
+    }
+    
+    free(db->slots);
+    free(db->scratch);
+    free(db->path);
+    free(db);
+}
+
+// Paket kaydını ekle ya da güncelle
+int package_db_put(package_db_t* db, const char* name, const void* record, uint64_t stamp) {
+    if (!db || !name || !record) {
+        return PACKAGE_DB_ERROR_INVALID;
+    }
+    
+    size_t length = strlen(name);
+    if (length == 0 || length > PACKAGE_DB_NAME_MAX) {
+        return PACKAGE_DB_ERROR_INVALID;
+    }
+    
+    uint64_t offset;
+    int status = package_db_append(db, PACKAGE_DB_PUT, name, length, record, stamp, &offset);
+    if (status != 0) {
+        return status;
+    }
+    
+    return package_db_set(db, name, length, (uint32_t)offset);
+}
+
+// Paket kaydını sil (silme kaydı eklenir)
+int package_db_delete(package_db_t* db, const char* name) {
+    if (!db || !name) {
+        return PACKAGE_DB_ERROR_INVALID;
+    }
+    
+    size_t length = strlen(name);
+    package_db_slot_t* slot = length <= PACKAGE_DB_NAME_MAX ?
+                              package_db_lookup(db, name, length, package_hash(name, length)) : NULL;
+    if (!slot) {
+        return PACKAGE_DB_ERROR_NOT_FOUND;
+    }
+    
+    uint64_t offset;
+    int status = package_db_append(db, PACKAGE_DB_DELETE, name, length, NULL, 0, &offset);
+    if (status != 0) {
+        return status;
+    }
+    
+    // Eski kayıt yeniden eşlemeden sonra da aynı ofsettedir
+    slot = package_db_lookup(db, name, length, package_hash(name, length));
+    db->live_bytes -= package_db_record_length(db, (const package_db_record_t*)(db->base + slot->offset));
+    package_db_unset(db, slot);
+    return 0;
+}
+
+// Paket kaydını bul
+const void* package_db_get(package_db_t* db, const char* name, uint64_t* stamp) {
+    if (!db || !name) {
+        return NULL;
+    }
+    
+    size_t length = strlen(name);
+    if (length > PACKAGE_DB_NAME_MAX) {
+        return NULL;
+    }
+    
+    package_db_slot_t* slot = package_db_lookup(db, name, length, package_hash(name, length));
+    if (!slot) {
+        return NULL;
+    }
+    
+    const package_db_record_t* record = (const package_db_record_t*)(db->base + slot->offset);
+    if (stamp) {
+        *stamp = record->stamp;
+    }
+    return (const uint8_t*)record + sizeof(package_db_record_t) + package_align8(record->name_length + 1);
+}
+
+// Tüm kayıtları gez (sıra tanımsız)
+int package_db_foreach(package_db_t* db, package_db_visit_t visit, void* arg) {
+    if (!db || !visit) {
+        return PACKAGE_DB_ERROR_INVALID;
+    }
+    
+    for (uint32_t i = 0; i < db->capacity; i++) {
+        if (!db->slots[i].offset) {
+            continue;
+        }
+    
+        const package_db_record_t* record = (const package_db_record_t*)(db->base + db->slots[i].offset);
+        const char* name = (const char*)(record + 1);
+        const void* data = (const uint8_t*)name + package_align8(record->name_length + 1);
+        int result = visit(name, data, record->stamp, arg);
+        if (result != 0) {
+            return result;
+        }
+    }
+    
+    return 0;
+}
+
+uint32_t package_db_count(package_db_t* db) {
+    return db ? db->count : 0;
+}
+
+// Günlüğü diske zorla, ölü kayıtlar çoğaldıysa sıkıştır, indeksi yaz
+int package_db_sync(package_db_t* db) {
+    if (!db) {
+        return PACKAGE_DB_ERROR_INVALID;
+    }
+    
+    if (db->size > PACKAGE_DB_COMPACT_MIN && db->live_bytes * 2 < db->size - PACKAGE_DB_HEADER_SIZE) {
+        int status = package_db_compact(db);
+        if (status != 0) {
+            return status;
+        }
+    }
+    
+    if (db->synced_size != db->size) {
+        if (fdatasync(db->fd) != 0) {
+            return PACKAGE_DB_ERROR_IO;
+        }
+        db->synced_size = db->size;
+    }
+    
+    if (db->indexed_size != db->size) {
+        int status = package_db_write_index(db);
+        if (status != 0) {
+            return status;
+        }
+        db->indexed_size = db->size;
+    }
+    
+    return 0;
+}
+
+// Günlüğü eşle. Eşleme dosyadan büyük tutulur: kayıt eklemek çoğu zaman
+// yeniden eşleme gerektirmez, dosya sonunun ötesine hiç erişilmez.
+static int package_db_map(package_db_t* db, uint64_t size) {
+    if (db->base && size <= db->mapped) {
+        return 0;
+    }
+    
+    size_t mapped = db->mapped ? db->mapped : PACKAGE_DB_MAP_MIN;
+    while (mapped < size) {
+        mapped *= 2;
+    }
+    
+    void* base = mmap(NULL, mapped, PROT_READ, MAP_SHARED, db->fd, 0);
+    if (base == MAP_FAILED) {
+        return PACKAGE_DB_ERROR_IO;
+    }
+    
+    if (db->base) {
+        munmap(db->base, db->mapped);
+    }
+    db->base = (uint8_t*)base;
+    db->mapped = mapped;
+    return 0;
+}
+
+// İndeks dosyasını oku. Başka nesilden, bozuk ya da günlükten uzun indeks
+// reddedilir ve günlük baştan oynatılır.
+static int package_db_load_index(package_db_t* db, uint64_t* replay_from) {
+    package_db_index_header_t header;
+    char index_path[4096];
+    
+    if (snprintf(index_path, sizeof(index_path), "%s.idx", db->path) >= (int)sizeof(index_path)) {
+        return -1;
+    }
+    
+    int fd = open(index_path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+    
+    if (pread(fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header) ||
+        memcmp(header.magic, PACKAGE_DB_INDEX_MAGIC, 4) != 0 || header.version != PACKAGE_DB_VERSION ||
+        header.record_size != db->record_size || header.generation != db->generation ||
+        header.capacity < 64 || (header.capacity & (header.capacity - 1)) != 0 ||
+        header.count >= header.capacity || header.log_size < PACKAGE_DB_HEADER_SIZE ||
+        header.log_size > db->size) {
+        close(fd);
+        return -1;
+    }
+    
+    size_t bytes = (size_t)header.capacity * sizeof(package_db_slot_t);
+    db->slots = (package_db_slot_t*)malloc(bytes);
+    if (!db->slots || pread(fd, db->slots, bytes, sizeof(header)) != (ssize_t)bytes ||
+        package_crc32(0, db->slots, bytes) != header.crc) {
+        close(fd);
+        return -1;
+    }
+    close(fd);
+    
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < header.capacity; i++) {
+        if (!db->slots[i].offset) {
+            continue;
+        }
+        if (db->slots[i].offset < PACKAGE_DB_HEADER_SIZE ||
+            db->slots[i].offset + sizeof(package_db_record_t) > header.log_size) {
+            return -1;
+        }
+        count++;
+    }
+    
+    if (count != header.count) {
+        return -1;
+    }
+    
+    db->capacity = header.capacity;
+    db->count = header.count;
+    db->live_bytes = header.live_bytes;
+    *replay_from = header.log_size;
+    return 0;
+}
+
+// İndeksi geçici dosyaya yazıp yerine taşı. İndeks her zaman günlükten yeniden
+// kurulabildiği için diske zorlanmaz; yarım yazılmışsa CRC'si tutmaz.
+static int package_db_write_index(package_db_t* db) {
+    package_db_index_header_t header;
+    char index_path[4096];
+    char temp_path[4096];
+    
+    if (snprintf(index_path, sizeof(index_path), "%s.idx", db->path) >= (int)sizeof(index_path) ||
+        snprintf(temp_path, sizeof(temp_path), "%s.idx.%d.tmp", db->path, (int)getpid()) >= (int)sizeof(temp_path)) {
+        return PACKAGE_DB_ERROR_INVALID;
+    }
+    
+    size_t bytes = (size_t)db->capacity * sizeof(package_db_slot_t);
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, PACKAGE_DB_INDEX_MAGIC, 4);
+    header.version = PACKAGE_DB_VERSION;
+    header.record_size = db->record_size;
+    header.generation = db->generation;
+    header.capacity = db->capacity;
+    header.count = db->count;
+    header.log_size = db->size;
+    header.live_bytes = db->live_bytes;
+    header.crc = package_crc32(0, db->slots, bytes);
+    
+    int fd = open(temp_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return PACKAGE_DB_ERROR_IO;
+    }
+    
+    int status = package_db_write_all(fd, &header, sizeof(header), 0) == 0 &&
+                 package_db_write_all(fd, db->slots, bytes, sizeof(header)) == 0 ? 0 : PACKAGE_DB_ERROR_IO;
+    close(fd);
+    
+    if (status == 0 && rename(temp_path, index_path) != 0) {
+        status = PACKAGE_DB_ERROR_IO;
+    }
+    if (status != 0) {
+        unlink(temp_path);
+    }
+    
+    return status;
+}
+
+// Günlüğü offset'ten sonuna oynat. Yarım ya da bozuk ilk kayıtta durulur ve
+// günlük oradan kesilir: yalnızca sona ekleme yapıldığı için bu, çökme anında
+// yazılmakta olan kayıttır.
+static int package_db_replay(package_db_t* db, uint64_t offset) {
+    while (offset + sizeof(package_db_record_t) <= db->size) {
+        const package_db_record_t* record = (const package_db_record_t*)(db->base + offset);
+        uint32_t length = package_db_record_length(db, record);
+    
+        if (length == 0 || offset + length > db->size || record->name_length == 0 ||
+            package_crc32(0, (const uint8_t*)record + 4, length - 4) != record->crc) {
+            break;
+        }
+    
+        const char* name = (const char*)(record + 1);
+        if (record->type == PACKAGE_DB_PUT) {
+            int status = package_db_set(db, name, record->name_length, (uint32_t)offset);
+            if (status != 0) {
+                return status;
+            }
+        } else {
+            package_db_slot_t* slot = package_db_lookup(db, name, record->name_length,
+                                                        package_hash(name, record->name_length));
+            if (slot) {
+                db->live_bytes -= package_db_record_length(db, (const package_db_record_t*)(db->base + slot->offset));
+                package_db_unset(db, slot);
+            }
+        }
+    
+        offset += length;
+    }
+    
+    if (offset != db->size) {
+        if (ftruncate(db->fd, (off_t)offset) != 0) {
+            return PACKAGE_DB_ERROR_IO;
+        }
+        db->size = offset;
+    }
+    
+    return 0;
+}
+
+// Kaydı günlüğün sonuna ekle
+static int package_db_append(package_db_t* db, uint8_t type, const char* name, size_t name_length,
+                             const void* data, uint64_t stamp, uint64_t* offset) {
+    uint32_t name_bytes = package_align8((uint32_t)name_length + 1);
+    uint32_t length = (uint32_t)sizeof(package_db_record_t) + name_bytes +
+                      (type == PACKAGE_DB_PUT ? package_align8(db->record_size) : 0);
+    
+    if (db->size + length > UINT32_MAX) {
+        return PACKAGE_DB_ERROR_NO_MEMORY;
+    }
+    
+    uint8_t* buffer = db->scratch;
+    memset(buffer, 0, length);
+    
+    package_db_record_t* record = (package_db_record_t*)buffer;
+    record->type = type;
+    record->name_length = (uint8_t)name_length;
+    record->stamp = stamp;
+    memcpy(buffer + sizeof(package_db_record_t), name, name_length);
+    if (type == PACKAGE_DB_PUT) {
+        memcpy(buffer + sizeof(package_db_record_t) + name_bytes, data, db->record_size);
+    }
+    record->crc = package_crc32(0, buffer + 4, length - 4);
+    
+    if (package_db_write_all(db->fd, buffer, length, db->size) != 0) {
+        return PACKAGE_DB_ERROR_IO;
+    }
+    
+    int status = package_db_map(db, db->size + length);
+    if (status != 0) {
+        return status;
+    }
+    
+    *offset = db->size;
+    db->size += length;
+    return 0;
+}
+
+// Canlı kayıtları yeni nesil bir günlüğe kopyala ve eskisinin yerine taşı
+static int package_db_compact(package_db_t* db) {
+    char temp_path[4096];
+    
+    if (snprintf(temp_path, sizeof(temp_path), "%s.%d.tmp", db->path, (int)getpid()) >= (int)sizeof(temp_path)) {
+        return PACKAGE_DB_ERROR_INVALID;
+    }
+    
+    int fd = open(temp_path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return PACKAGE_DB_ERROR_IO;
+    }
+    
+    package_db_header_t header;
+    memcpy(&header, db->base, sizeof(header));
+    header.generation = package_db_new_generation();
+    
+    size_t capacity = (size_t)db->live_bytes + PACKAGE_DB_HEADER_SIZE;
+    uint8_t* buffer = (uint8_t*)malloc(capacity);
+    uint32_t* offsets = (uint32_t*)malloc(db->capacity * sizeof(uint32_t));
+    if (!buffer || !offsets) {
+        free(buffer);
+        free(offsets);
+        close(fd);
+        unlink(temp_path);
+        return PACKAGE_DB_ERROR_NO_MEMORY;
+    }
+    
+    // Yeni ofsetler ayrı tutulur: yazma başarısız olursa tablo bozulmaz
+    memcpy(buffer, &header, sizeof(header));
+    size_t size = PACKAGE_DB_HEADER_SIZE;
+    for (uint32_t i = 0; i < db->capacity; i++) {
+        offsets[i] = 0;
+        if (!db->slots[i].offset) {
+            continue;
+        }
+        const package_db_record_t* record = (const package_db_record_t*)(db->base + db->slots[i].offset);
+        uint32_t length = package_db_record_length(db, record);
+        memcpy(buffer + size, record, length);
+        offsets[i] = (uint32_t)size;
+        size += length;
+    }
+    
+    int status = package_db_write_all(fd, buffer, size, 0) == 0 && fsync(fd) == 0 &&
+                 rename(temp_path, db->path) == 0 ? 0 : PACKAGE_DB_ERROR_IO;
+    free(buffer);
+    
+    if (status != 0) {
+        free(offsets);
+        close(fd);
+        unlink(temp_path);
+        return status;
+    }
+    
+    for (uint32_t i = 0; i < db->capacity; i++) {
+        db->slots[i].offset = offsets[i];
+    }
+    free(offsets);
+    
+    munmap(db->base, db->mapped);
+    db->base = NULL;
+    db->mapped = 0;
+    close(db->fd);
+    db->fd = fd;
+    db->generation = header.generation;
+    db->size = size;
+    db->synced_size = size;
+    db->indexed_size = 0;
+    
+    return package_db_map(db, size);
+}
+
+// Kaydın günlükteki boyutu; geçersiz tür için 0
+static uint32_t package_db_record_length(const package_db_t* db, const package_db_record_t* record) {
+    uint32_t length = (uint32_t)sizeof(package_db_record_t) + package_align8(record->name_length + 1u);
+    
+    if (record->type == PACKAGE_DB_PUT) {
+        return length + package_align8(db->record_size);
+    }
+    return record->type == PACKAGE_DB_DELETE ? length : 0;
+}
+
+static package_db_slot_t* package_db_lookup(package_db_t* db, const char* name, size_t length, uint32_t hash) {
+    uint32_t mask = db->capacity - 1;
+    
+    for (uint32_t i = hash & mask; db->slots[i].offset; i = (i + 1) & mask) {
+        if (db->slots[i].hash != hash) {
+            continue;
+        }
+        const package_db_record_t* record = (const package_db_record_t*)(db->base + db->slots[i].offset);
+        if (record->name_length == length && memcmp(record + 1, name, length) == 0) {
+            return &db->slots[i];
+        }
+    }
+    
+    return NULL;
+}
+
+// Adı yeni kayda yönlendir; önceki kayıt ölü sayılır
+static int package_db_set(package_db_t* db, const char* name, size_t length, uint32_t offset) {
+    uint32_t hash = package_hash(name, length);
+    uint32_t added = package_db_record_length(db, (const package_db_record_t*)(db->base + offset));
+    
+    package_db_slot_t* slot = package_db_lookup(db, name, length, hash);
+    if (slot) {
+        db->live_bytes -= package_db_record_length(db, (const package_db_record_t*)(db->base + slot->offset));
+        db->live_bytes += added;
+        slot->offset = offset;
+        return 0;
+    }
+    
+    if ((db->count + 1) * 4 > db->capacity * 3 && package_db_grow(db) != 0) {
+        return PACKAGE_DB_ERROR_NO_MEMORY;
+    }
+    
+    uint32_t mask = db->capacity - 1;
+    uint32_t i = hash & mask;
+    while (db->slots[i].offset) {
+        i = (i + 1) & mask;
+    }
+    
+    db->slots[i].hash = hash;
+    db->slots[i].offset = offset;
+    db->count++;
+    db->live_bytes += added;
+    return 0;
+}
+
+// Doğrusal yoklamada silme: arkadaki yuvalar geri kaydırılır, mezar taşı kalmaz
+static void package_db_unset(package_db_t* db, package_db_slot_t* slot) {
+    uint32_t mask = db->capacity - 1;
+    uint32_t hole = (uint32_t)(slot - db->slots);
+    
+    for (uint32_t i = (hole + 1) & mask; db->slots[i].offset; i = (i + 1) & mask) {
+        uint32_t home = db->slots[i].hash & mask;
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            db->slots[hole] = db->slots[i];
+            hole = i;
+        }
+    }
+    
+    db->slots[hole].hash = 0;
+    db->slots[hole].offset = 0;
+    db->count--;
+}
+
+static int package_db_grow(package_db_t* db) {
+    uint32_t capacity = db->capacity * 2;
+    package_db_slot_t* slots = (package_db_slot_t*)calloc(capacity, sizeof(package_db_slot_t));
+    if (!slots) {
+        return -1;
+    }
+    
+    for (uint32_t i = 0; i < db->capacity; i++) {
+        if (!db->slots[i].offset) {
+            continue;
+        }
+        uint32_t j = db->slots[i].hash & (capacity - 1);
+        while (slots[j].offset) {
+            j = (j + 1) & (capacity - 1);
+        }
+        slots[j] = db->slots[i];
+    }
+    
+    free(db->slots);
+    db->slots = slots;
+    db->capacity = capacity;
+    return 0;
+}
+
+static uint32_t package_db_new_generation(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint32_t)ts.tv_nsec ^ ((uint32_t)ts.tv_sec << 7) ^ ((uint32_t)getpid() << 16) ^
+           ++package_generation_serial;
+}
+
+static int package_db_write_all(int fd, const void* data, size_t size, uint64_t offset) {
+    const uint8_t* cursor = (const uint8_t*)data;
+    
+    while (size > 0) {
+        ssize_t written = pwrite(fd, cursor, size, (off_t)offset);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            return -1;
+        }
+        cursor += written;
+        offset += (uint64_t)written;
+        size -= (size_t)written;
+    }
+    
+    return 0;
+}
+
+// FNV-1a
+static uint32_t package_hash(const char* key, size_t length) {
+    uint32_t hash = 2166136261u;
+    
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (uint8_t)key[i];
+        hash *= 16777619u;
+    }
+    
+    return hash;
+}
+
+// Ardışık pid'ler yuvalara dağılsın diye karıştırılır
+static uint32_t package_hash_id(uint32_t id) {
+    id ^= id >> 16;
+    id *= 0x7feb352d;
+    id ^= id >> 15;
+    id *= 0x846ca68b;
+    id ^= id >> 16;
+    return id;
+}
+
+static uint32_t package_crc32(uint32_t crc, const void* data, size_t size) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    
+    if (!package_crc_ready) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t value = i;
+            for (int bit = 0; bit < 8; bit++) {
+                value = (value >> 1) ^ (0xEDB88320 & (0 - (value & 1)));
+            }
+            package_crc_table[i] = value;
+        }
+        package_crc_ready = 1;
+    }
+    
+    crc = ~crc;
+    while (size--) {
+        crc = (crc >> 8) ^ package_crc_table[(crc ^ *bytes++) & 0xFF];
+    }
+    return ~crc;
+}
+
+// Bellek içi karma
+int package_index_init(package_index_t* index, uint32_t capacity) {
+    if (!index) {
+        return PACKAGE_DB_ERROR_INVALID;
+    }
+    
+    uint32_t size = 16;
+    while (size < capacity * 2) {
+        size *= 2;
+    }
+    
+    index->slots = (struct package_index_slot*)calloc(size, sizeof(struct package_index_slot));
+    if (!index->slots) {
+        return PACKAGE_DB_ERROR_NO_MEMORY;
+    }
+    
+    index->capacity = size;
+    index->count = 0;
+    return 0;
+}
+
+void package_index_destroy(package_index_t* index) {
+    if (!index) {
+        return;
+    }
+    
+    free(index->slots);
+    index->slots = NULL;
+    index->capacity = 0;
+    index->count = 0;
+}
+
+int package_index_insert(package_index_t* index, const char* key, void* value) {
+    if (!index || !index->slots || !key || !value) {
+        return PACKAGE_DB_ERROR_INVALID;
+    }
+    
+    return package_index_store(index, key, 0, package_hash(key, strlen(key)), value);
+}
+
+void* package_index_find(const package_index_t* index, const char* key) {
+    if (!index || !index->slots || !key) {
+        return NULL;
+    }
+    
+    struct package_index_slot* slot = package_index_probe(index, key, 0, package_hash(key, strlen(key)));
+    return slot ? slot->value : NULL;
+}
+
+int package_index_erase(package_index_t* index, const char* key) {
+    if (!index || !index->slots || !key) {
+        return PACKAGE_DB_ERROR_INVALID;
+    }
+    
+    struct package_index_slot* slot = package_index_probe(index, key, 0, package_hash(key, strlen(key)));
+    if (!slot) {
+        return PACKAGE_DB_ERROR_NOT_FOUND;
+    }
+    
+    package_index_remove_slot(index, slot);
+    return 0;
+}
+
+int package_index_insert_id(package_index_t* index, uint32_t id, void* value) {
+    if (!index || !index->slots || !value) {
+        return PACKAGE_DB_ERROR_INVALID;
+    }
+    
+    return package_index_store(index, NULL, id, package_hash_id(id), value);
+}
+
+void* package_index_find_id(const package_index_t* index, uint32_t id) {
+    if (!index || !index->slots) {
+        return NULL;
+    }
+    
+    struct package_index_slot* slot = package_index_probe(index, NULL, id, package_hash_id(id));
+    return slot ? slot->value : NULL;
+}
+
+int package_index_erase_id(package_index_t* index, uint32_t id) {
+    if (!index || !index->slots) {
+        return PACKAGE_DB_ERROR_INVALID;
+    }
+    
+    struct package_index_slot* slot = package_index_probe(index, NULL, id, package_hash_id(id));
+    if (!slot) {
+        return PACKAGE_DB_ERROR_NOT_FOUND;
+    }
+    
+    package_index_remove_slot(index, slot);
+    return 0;
+}
+
+static struct package_index_slot* package_index_probe(const package_index_t* index, const char* key, uint32_t id, uint32_t hash) {
+    uint32_t mask = index->capacity - 1;
+    
+    for (uint32_t i = hash & mask; index->slots[i].value; i = (i + 1) & mask) {
+        struct package_index_slot* slot = &index->slots[i];
+        if (slot->hash != hash) {
+            continue;
+        }
+        if (key ? (slot->key && strcmp(slot->key, key) == 0) : (!slot->key && slot->id == id)) {
+            return slot;
+        }
+    }
+    
+    return NULL;
+}
+
+// Anahtar varsa değeri değiştir, yoksa ekle (doluluk %50'yi geçince büyüt)
+static int package_index_store(package_index_t* index, const char* key, uint32_t id, uint32_t hash, void* value) {
+    struct package_index_slot* slot = package_index_probe(index, key, id, hash);
+    if (slot) {
+        slot->key = key;
+        slot->value = value;
+        return 0;
+    }
+    
+    if ((index->count + 1) * 2 > index->capacity) {
+        uint32_t capacity = index->capacity * 2;
+        struct package_index_slot* slots = (struct package_index_slot*)calloc(capacity, sizeof(struct package_index_slot));
+        if (!slots) {
+            return PACKAGE_DB_ERROR_NO_MEMORY;
+        }
+    
+        for (uint32_t i = 0; i < index->capacity; i++) {
+            if (!index->slots[i].value) {
+                continue;
+            }
+            uint32_t j = index->slots[i].hash & (capacity - 1);
+            while (slots[j].value) {
+                j = (j + 1) & (capacity - 1);
+            }
+            slots[j] = index->slots[i];
+        }
+    
+        free(index->slots);
+        index->slots = slots;
+        index->capacity = capacity;
+    }
+    
+    uint32_t mask = index->capacity - 1;
+    uint32_t i = hash & mask;
+    while (index->slots[i].value) {
+        i = (i + 1) & mask;
+    }
+    
+    index->slots[i].hash = hash;
+    index->slots[i].id = id;
+    index->slots[i].key = key;
+    index->slots[i].value = value;
+    index->count++;
+    return 0;
+}
+
+static void package_index_remove_slot(package_index_t* index, struct package_index_slot* slot) {
+    uint32_t mask = index->capacity - 1;
+    uint32_t hole = (uint32_t)(slot - index->slots);
+    
+    for (uint32_t i = (hole + 1) & mask; index->slots[i].value; i = (i + 1) & mask) {
+        uint32_t home = index->slots[i].hash & mask;
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            index->slots[hole] = index->slots[i];
+            hole = i;
+        }
+    }
+    
+    memset(&index->slots[hole], 0, sizeof(index->slots[hole]));
+    index->count--;
+}
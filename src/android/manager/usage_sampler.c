@@ -0,0 +1,816 @@
+#include "../../include/android/usage_sampler.h"
+#include "../../include/android/package_db.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <pthread.h>
+
+#define USAGE_READ_MAX               512     // /proc dosyası okuma tamponu
+#define USAGE_PSS_ROUNDS             10      // smaps_rollup her bu kadar turda bir okunur
+
+// Kayıt durumları
+#define USAGE_SLOT_FREE              0
+#define USAGE_SLOT_ACTIVE            1       // Örnekleniyor
+#define USAGE_SLOT_EXITED            2       // Süreç çıktı; geçmiş okunabilir, dosyalar kapalı
+#define USAGE_SLOT_REMOVED           3       // İzleme bırakıldı; dosyaları tur kapatır
+
+// Halka tampon
+typedef struct {
+    usage_sample_t* samples;
+    uint32_t capacity;
+    uint32_t head;                  // Sonraki yazma konumu
+    uint32_t count;
+} usage_ring_t;
+
+// Üst katman için toplam
+typedef struct {
+    uint64_t cpu;
+    uint64_t wakeups;
+    uint64_t rss;
+    uint64_t read;
+    uint64_t write;
+    uint32_t count;
+} usage_accumulator_t;
+
+// Ham sayaçlar
+typedef struct {
+    uint64_t cpu_ticks;             // Tüm iş parçacıkları, çıkmış olanlar dahil (utime + stime)
+    uint64_t slices;                // Canlı iş parçacıklarının zaman dilimi toplamı
+    uint64_t rss_pages;             // statm yerleşik
+    uint64_t pss_kb;                // Pss; ara turlarda yerleşik farkıyla tahmin
+    uint64_t pss_base_kb;           // Son ölçülen Pss
+    uint64_t pss_base_pages;        // O ölçümdeki yerleşik sayfa
+    uint64_t read_bytes;
+    uint64_t write_bytes;
+    uint64_t time_ns;
+} usage_counters_t;
+
+typedef struct {
+    pid_t pid;
+    uint8_t state;
+    char name[USAGE_SAMPLER_NAME_MAX];
+    int stat_fd;
+    int statm_fd;
+    int io_fd;                      // Erişim yoksa -1; G/Ç sıfır görünür
+    int rollup_fd;                  // smaps_rollup yoksa -1; özel sayfalar kullanılır
+    DIR* tasks;                     // /proc/<pid>/task, her turda baştan okunur
+    uint32_t pss_age;               // Son Pss ölçümünden bu yana tur
+    usage_counters_t last;
+    usage_accumulator_t accumulators[USAGE_TIER_COUNT - 1];
+    usage_ring_t rings[USAGE_TIER_COUNT];
+} usage_slot_t;
+
+struct usage_sampler {
+    usage_slot_t* slots;
+    uint32_t max_apps;
+    usage_sample_t* storage;        // Tüm halkalar için tek ayırma
+    package_index_t pids;           // pid -> kayıt
+    uint32_t interval_ms;
+    uint32_t page_kb;
+    uint64_t tick_ns;               // Bir saat tıkı (sysconf(_SC_CLK_TCK))
+    uint64_t start_ns;
+    uint32_t* round_slots;          // Tur içi geçici liste
+    usage_counters_t* round_counters;
+    uint8_t* round_ok;
+    usage_sampler_stats_t stats;
+    uint8_t running;
+    pthread_t thread;
+    pthread_mutex_t lock;           // Kayıtlar, halkalar, istatistikler
+    pthread_mutex_t round_lock;     // Aynı anda tek tur
+    pthread_cond_t wake;
+};
+
+static const uint32_t usage_tier_samples[USAGE_TIER_COUNT] = {
+    USAGE_TIER0_SAMPLES, USAGE_TIER1_SAMPLES, USAGE_TIER2_SAMPLES
+};
+static const uint32_t usage_tier_factor[USAGE_TIER_COUNT] = {
+    1, USAGE_TIER1_FACTOR, USAGE_TIER2_FACTOR
+};
+
+// Yardımcı fonksiyonlar
+static void* usage_thread(void* arg);
+static void usage_round(usage_sampler_t* sampler);
+static int usage_open(usage_slot_t* slot, pid_t pid);
+static void usage_close(usage_slot_t* slot);
+static int usage_read(usage_sampler_t* sampler, usage_slot_t* slot, usage_counters_t* counters);
+static int usage_read_file(int fd, char* buffer, size_t size);
+static uint64_t usage_field(const char* text, const char* key);
+static uint64_t usage_slices(DIR* tasks);
+static void usage_record(usage_sampler_t* sampler, usage_slot_t* slot, const usage_counters_t* now);
+static void usage_push(usage_ring_t* ring, const usage_sample_t* sample);
+static const usage_sample_t* usage_last(const usage_ring_t* ring);
+static usage_slot_t* usage_find(usage_sampler_t* sampler, pid_t pid);
+static uint64_t usage_now_ns(clockid_t clock);
+
+// Örnekleyiciyi oluştur ve iş parçacığını başlat
+int usage_sampler_create(uint32_t interval_ms, uint32_t max_apps, usage_sampler_t** sampler_out) {
+    if (!sampler_out) {
+        return USAGE_ERROR_INVALID;
+    }
+    
+    usage_sampler_t* sampler = (usage_sampler_t*)calloc(1, sizeof(usage_sampler_t));
+    if (!sampler) {
+        return USAGE_ERROR_NO_MEMORY;
+    }
+    
+    sampler->interval_ms = interval_ms ? interval_ms : USAGE_SAMPLER_DEFAULT_INTERVAL_MS;
+    sampler->max_apps = max_apps ? max_apps : USAGE_SAMPLER_DEFAULT_MAX_APPS;
+    sampler->stats.interval_ms = sampler->interval_ms;
+    long page = sysconf(_SC_PAGESIZE);
+    sampler->page_kb = page > 0 ? (uint32_t)(page / 1024) : 4;
+    long ticks = sysconf(_SC_CLK_TCK);
+    sampler->tick_ns = 1000000000ull / (uint64_t)(ticks > 0 ? ticks : 100);
+    
+    uint32_t per_slot = USAGE_TIER0_SAMPLES + USAGE_TIER1_SAMPLES + USAGE_TIER2_SAMPLES;
+    sampler->slots = (usage_slot_t*)calloc(sampler->max_apps, sizeof(usage_slot_t));
+    sampler->storage = (usage_sample_t*)calloc((size_t)sampler->max_apps * per_slot, sizeof(usage_sample_t));
+    sampler->round_slots = (uint32_t*)malloc(sampler->max_apps * sizeof(uint32_t));
+    sampler->round_counters = (usage_counters_t*)malloc(sampler->max_apps * sizeof(usage_counters_t));
+    sampler->round_ok = (uint8_t*)malloc(sampler->max_apps);
+    if (!sampler->slots || !sampler->storage || !sampler->round_slots || !sampler->round_counters ||
+        !sampler->round_ok || package_index_init(&sampler->pids, sampler->max_apps * 2) != 0) {
+        free(sampler->slots);
+        free(sampler->storage);
+        free(sampler->round_slots);
+        free(sampler->round_counters);
+        free(sampler->round_ok);
+        free(sampler);
+        return USAGE_ERROR_NO_MEMORY;
+    }
+    
+    // Halkalar ortak alandan dilimlenir
+    usage_sample_t* storage = sampler->storage;
+    for (uint32_t i = 0; i < sampler->max_apps; i++) {
+        sampler->slots[i].stat_fd = -1;
+        sampler->slots[i].statm_fd = -1;
+        sampler->slots[i].io_fd = -1;
+        sampler->slots[i].rollup_fd = -1;
+        for (uint32_t tier = 0; tier < USAGE_TIER_COUNT; tier++) {
+            sampler->slots[i].rings[tier].samples = storage;
+            sampler->slots[i].rings[tier].capacity = usage_tier_samples[tier];
+            storage += usage_tier_samples[tier];
+        }
+    }
+    
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&sampler->wake, &attr);
+    pthread_condattr_destroy(&attr);
+    pthread_mutex_init(&sampler->lock, NULL);
+    pthread_mutex_init(&sampler->round_lock, NULL);
+    
+    sampler->start_ns = usage_now_ns(CLOCK_MONOTONIC);
+    sampler->running = 1;
+    if (pthread_create(&sampler->thread, NULL, usage_thread, sampler) != 0) {
+        sampler->running = 0;
+        usage_sampler_destroy(sampler);
+        return USAGE_ERROR_NO_MEMORY;
+    }
+    
+    *sampler_out = sampler;
+    return 0;
+}
+
+// Örnekleyiciyi durdur ve kaynakları bırak
+void usage_sampler_destroy(usage_sampler_t* sampler) {
+    if (!sampler) {
+        return;
+    }
+    
+    pthread_mutex_lock(&sampler->lock);
+    uint8_t running = sampler->running;
+    sampler->running = 0;
+    pthread_cond_signal(&sampler->wake);
+    pthread_mutex_unlock(&sampler->lock);
+    
+    if (running) {
+        pthread_join(sampler->thread, NULL);
+    }
+    
+    for (uint32_t i = 0; i < sampler->max_apps; i++) {
+        usage_close(&sampler->slots[i]);
+    }
+    
+    package_index_destroy(&sampler->pids);
+    pthread_cond_destroy(&sampler->wake);
+    pthread_mutex_destroy(&sampler->lock);
+    pthread_mutex_destroy(&sampler->round_lock);
+    free(sampler->slots);
+    free(sampler->storage);
+    free(sampler->round_slots);
+    free(sampler->round_counters);
+    free(sampler->round_ok);
+    free(sampler);
+}
+
+// Süreci izlemeye al. Dosyalar burada açılır ve ilk sayaçlar okunur; ilk
+// örnek sonraki turda oluşur.
+int usage_sampler_track(usage_sampler_t* sampler, pid_t pid, const char* name) {
+    usage_slot_t opened;
+    
+    if (!sampler || pid <= 0) {
+        return USAGE_ERROR_INVALID;
+    }
+    
+    memset(&opened, 0, sizeof(opened));
+    if (usage_open(&opened, pid) != 0 || usage_read(sampler, &opened, &opened.last) != 0) {
+        usage_close(&opened);
+        return USAGE_ERROR_PROCESS;
+    }
+    
+    pthread_mutex_lock(&sampler->lock);
+    
+    // Aynı pid çıkmış bir kayıtta kaldıysa (pid yeniden kullanıldı) o kayıt
+    // yeni süreç için sıfırlanır
+    usage_slot_t* slot = usage_find(sampler, pid);
+    if (slot && slot->state == USAGE_SLOT_ACTIVE) {
+        pthread_mutex_unlock(&sampler->lock);
+        usage_close(&opened);
+        return 0;
+    }
+    
+    // Boş kayıt yoksa çıkmış süreçlerin en eskisinin yeri alınır
+    if (!slot) {
+        usage_slot_t* exited = NULL;
+        for (uint32_t i = 0; i < sampler->max_apps; i++) {
+            usage_slot_t* candidate = &sampler->slots[i];
+            if (candidate->state == USAGE_SLOT_FREE) {
+                slot = candidate;
+                break;
+            }
+            if (candidate->state == USAGE_SLOT_EXITED &&
+                (!exited || candidate->last.time_ns < exited->last.time_ns)) {
+                exited = candidate;
+            }
+        }
+        if (!slot && exited) {
+            package_index_erase_id(&sampler->pids, (uint32_t)exited->pid);
+            slot = exited;
+        }
+        if (!slot) {
+            pthread_mutex_unlock(&sampler->lock);
+            usage_close(&opened);
+            return USAGE_ERROR_FULL;
+        }
+        if (package_index_insert_id(&sampler->pids, (uint32_t)pid, slot) != 0) {
+            slot->state = USAGE_SLOT_FREE;
+            pthread_mutex_unlock(&sampler->lock);
+            usage_close(&opened);
+            return USAGE_ERROR_NO_MEMORY;
+        }
+    }
+    
+    slot->pid = pid;
+    slot->stat_fd = opened.stat_fd;
+    slot->statm_fd = opened.statm_fd;
+    slot->io_fd = opened.io_fd;
+    slot->rollup_fd = opened.rollup_fd;
+    slot->tasks = opened.tasks;
+    slot->pss_age = opened.pss_age;
+    slot->last = opened.last;
+    memset(slot->accumulators, 0, sizeof(slot->accumulators));
+    for (uint32_t tier = 0; tier < USAGE_TIER_COUNT; tier++) {
+        slot->rings[tier].head = 0;
+        slot->rings[tier].count = 0;
+    }
+    snprintf(slot->name, sizeof(slot->name), "%s", name ? name : "");
+    slot->state = USAGE_SLOT_ACTIVE;
+    sampler->stats.tracked++;
+    
+    pthread_mutex_unlock(&sampler->lock);
+    return 0;
+}
+
+// İzlemeyi bırak. Tur o sırada kaydın dosyalarını okuyor olabileceğinden
+// etkin kaydın dosyaları bir sonraki turda kapatılır.
+int usage_sampler_untrack(usage_sampler_t* sampler, pid_t pid) {
+    if (!sampler || pid <= 0) {
+        return USAGE_ERROR_INVALID;
+    }
+    
+    pthread_mutex_lock(&sampler->lock);
+    usage_slot_t* slot = usage_find(sampler, pid);
+    if (!slot) {
+        pthread_mutex_unlock(&sampler->lock);
+        return USAGE_ERROR_NOT_FOUND;
+    }
+    
+    package_index_erase_id(&sampler->pids, (uint32_t)pid);
+    if (slot->state == USAGE_SLOT_ACTIVE) {
+        slot->state = USAGE_SLOT_REMOVED;
+        sampler->stats.tracked--;
+    } else {
+        slot->state = USAGE_SLOT_FREE;
+    }
+    pthread_mutex_unlock(&sampler->lock);
+    
+    return 0;
+}
+
+// Son örnek
+int usage_sampler_latest(usage_sampler_t* sampler, pid_t pid, usage_sample_t* sample) {
+    if (!sampler || !sample) {
+        return USAGE_ERROR_INVALID;
+    }
+    
+    pthread_mutex_lock(&sampler->lock);
+    usage_slot_t* slot = usage_find(sampler, pid);
+    const usage_sample_t* last = slot ? usage_last(&slot->rings[0]) : NULL;
+    if (last) {
+        *sample = *last;
+    }
+    pthread_mutex_unlock(&sampler->lock);
+    
+    return last ? 0 : USAGE_ERROR_NOT_FOUND;
+}
+
+// Katmandaki örnekler, eskiden yeniye. max_samples'tan fazlaysa en yeniler.
+int usage_sampler_series(usage_sampler_t* sampler, pid_t pid, uint32_t tier, usage_sample_t* samples,
+                         uint32_t max_samples, uint32_t* count) {
+    if (!sampler || tier >= USAGE_TIER_COUNT || (max_samples && !samples) || !count) {
+        return USAGE_ERROR_INVALID;
+    }
+    
+    pthread_mutex_lock(&sampler->lock);
+    usage_slot_t* slot = usage_find(sampler, pid);
+    if (!slot) {
+        pthread_mutex_unlock(&sampler->lock);
+        *count = 0;
+        return USAGE_ERROR_NOT_FOUND;
+    }
+    
+    const usage_ring_t* ring = &slot->rings[tier];
+    uint32_t n = ring->count < max_samples ? ring->count : max_samples;
+    uint32_t index = (ring->head + ring->capacity - n) % ring->capacity;
+    for (uint32_t i = 0; i < n; i++) {
+        samples[i] = ring->samples[index];
+        index = index + 1 == ring->capacity ? 0 : index + 1;
+    }
+    *count = n;
+    pthread_mutex_unlock(&sampler->lock);
+    
+    return 0;
+}
+
+// Katmandaki örneklerin izlenen süreçler üzerinden toplamı, eskiden yeniye.
+// Süreçler aynı turlarda örneklendiği için en yeniden geriye hizalanır; üst
+// katmanlarda süreçlerin ortalama pencereleri izleme başlangıcına göre en
+// fazla bir katman örneği kayıktır.
+int usage_sampler_history(usage_sampler_t* sampler, uint32_t tier, usage_sample_t* samples,
+                          uint32_t max_samples, uint32_t* count) {
+    if (!sampler || tier >= USAGE_TIER_COUNT || (max_samples && !samples) || !count) {
+        return USAGE_ERROR_INVALID;
+    }
+    
+    uint32_t n = 0;
+    if (max_samples) {
+        memset(samples, 0, (size_t)max_samples * sizeof(usage_sample_t));
+    }
+    
+    pthread_mutex_lock(&sampler->lock);
+    for (uint32_t i = 0; i < sampler->max_apps; i++) {
+        usage_slot_t* slot = &sampler->slots[i];
+        if (slot->state != USAGE_SLOT_ACTIVE) {
+            continue;
+        }
+    
+        const usage_ring_t* ring = &slot->rings[tier];
+        uint32_t used = ring->count < max_samples ? ring->count : max_samples;
+        uint32_t index = ring->head;
+        for (uint32_t k = 0; k < used; k++) {
+            index = index ? index - 1 : ring->capacity - 1;
+            const usage_sample_t* from = &ring->samples[index];
+            usage_sample_t* to = &samples[max_samples - 1 - k];
+            uint32_t cpu = (uint32_t)to->cpu_permille + from->cpu_permille;
+            uint32_t wakeups = (uint32_t)to->wakeups + from->wakeups;
+            to->cpu_permille = (uint16_t)(cpu > UINT16_MAX ? UINT16_MAX : cpu);
+            to->wakeups = (uint16_t)(wakeups > UINT16_MAX ? UINT16_MAX : wakeups);
+            to->rss_kb += from->rss_kb;
+            to->read_kbps += from->read_kbps;
+            to->write_kbps += from->write_kbps;
+            if (from->time > to->time) {
+                to->time = from->time;
+            }
+        }
+        if (used > n) {
+            n = used;
+        }
+    }
+    pthread_mutex_unlock(&sampler->lock);
+    
+    // Dolu kısmı başa taşı
+    if (n < max_samples) {
+        memmove(samples, samples + (max_samples - n), (size_t)n * sizeof(usage_sample_t));
+    }
+    *count = n;
+    return 0;
+}
+
+// İzlenen süreçlerin son örneklerinin toplamı
+int usage_sampler_totals(usage_sampler_t* sampler, usage_totals_t* totals) {
+    if (!sampler || !totals) {
+        return USAGE_ERROR_INVALID;
+    }
+    
+    memset(totals, 0, sizeof(*totals));
+    uint64_t cpu_permille = 0;
+    
+    pthread_mutex_lock(&sampler->lock);
+    for (uint32_t i = 0; i < sampler->max_apps; i++) {
+        usage_slot_t* slot = &sampler->slots[i];
+        const usage_sample_t* last = slot->state == USAGE_SLOT_ACTIVE ? usage_last(&slot->rings[0]) : NULL;
+        if (!last) {
+            continue;
+        }
+    
+        totals->apps++;
+        cpu_permille += last->cpu_permille;
+        totals->rss_kb += last->rss_kb;
+        totals->read_kbps += last->read_kbps;
+        totals->write_kbps += last->write_kbps;
+        totals->wakeups += last->wakeups;
+        if (last->time > totals->time) {
+            totals->time = last->time;
+        }
+    }
+    pthread_mutex_unlock(&sampler->lock);
+    
+    totals->cpu_percent = (float)cpu_permille / 10.0f;
+    return 0;
+}
+
+int usage_sampler_get_stats(usage_sampler_t* sampler, usage_sampler_stats_t* stats) {
+    if (!sampler || !stats) {
+        return USAGE_ERROR_INVALID;
+    }
+    
+    pthread_mutex_lock(&sampler->lock);
+    *stats = sampler->stats;
+    pthread_mutex_unlock(&sampler->lock);
+    
+    uint64_t elapsed = usage_now_ns(CLOCK_MONOTONIC) - sampler->start_ns;
+    stats->overhead_percent = elapsed ? (double)stats->cpu_ns * 100.0 / (double)elapsed : 0.0;
+    return 0;
+}
+
+int usage_sampler_sample_now(usage_sampler_t* sampler) {
+    if (!sampler) {
+        return USAGE_ERROR_INVALID;
+    }
+    
+    usage_round(sampler);
+    return 0;
+}
+
+// Örnekleme döngüsü. Turlar sabit bir takvime göre çalışır; bir turun
+// süresi sonraki turları kaydırmaz.
+static void* usage_thread(void* arg) {
+    usage_sampler_t* sampler = (usage_sampler_t*)arg;
+    uint64_t interval_ns = (uint64_t)sampler->interval_ms * 1000000ull;
+    uint64_t next = sampler->start_ns + interval_ns;
+    
+    pthread_mutex_lock(&sampler->lock);
+    while (sampler->running) {
+        struct timespec deadline = {
+            (time_t)(next / 1000000000ull), (long)(next % 1000000000ull)
+        };
+        if (pthread_cond_timedwait(&sampler->wake, &sampler->lock, &deadline) != ETIMEDOUT) {
+            continue;
+        }
+    
+        pthread_mutex_unlock(&sampler->lock);
+        usage_round(sampler);
+    
+        // Askıya alma gibi uzun bir aradan sonra kaçırılan turlar telafi edilmez
+        uint64_t now = usage_now_ns(CLOCK_MONOTONIC);
+        next += interval_ns;
+        if (next <= now) {
+            next = now + interval_ns;
+        }
+        pthread_mutex_lock(&sampler->lock);
+    }
+    pthread_mutex_unlock(&sampler->lock);
+    
+    return NULL;
+}
+
+// Tek tur: kilit altında etkin kayıtların listesini al, /proc dosyalarını
+// kilitsiz oku, sonuçları kilit altında halkalara yaz
+static void usage_round(usage_sampler_t* sampler) {
+    pthread_mutex_lock(&sampler->round_lock);
+    uint64_t cpu_start = usage_now_ns(CLOCK_THREAD_CPUTIME_ID);
+    uint32_t count = 0;
+    
+    pthread_mutex_lock(&sampler->lock);
+    for (uint32_t i = 0; i < sampler->max_apps; i++) {
+        usage_slot_t* slot = &sampler->slots[i];
+        if (slot->state == USAGE_SLOT_REMOVED) {
+            usage_close(slot);
+            slot->state = USAGE_SLOT_FREE;
+        } else if (slot->state == USAGE_SLOT_ACTIVE) {
+            sampler->round_slots[count++] = i;
+        }
+    }
+    pthread_mutex_unlock(&sampler->lock);
+    
+    // Kayıtların dosyalarını yalnızca tur kapatır; kilitsiz okuma güvenlidir
+    for (uint32_t i = 0; i < count; i++) {
+        usage_slot_t* slot = &sampler->slots[sampler->round_slots[i]];
+        sampler->round_ok[i] = usage_read(sampler, slot, &sampler->round_counters[i]) == 0;
+    }
+    
+    uint64_t exited = 0;
+    pthread_mutex_lock(&sampler->lock);
+    for (uint32_t i = 0; i < count; i++) {
+        usage_slot_t* slot = &sampler->slots[sampler->round_slots[i]];
+        if (slot->state != USAGE_SLOT_ACTIVE) {
+            continue;
+        }
+    
+        if (!sampler->round_ok[i]) {
+            usage_close(slot);
+            slot->state = USAGE_SLOT_EXITED;
+            sampler->stats.tracked--;
+            exited++;
+            continue;
+        }
+    
+        usage_record(sampler, slot, &sampler->round_counters[i]);
+    }
+    
+    sampler->stats.rounds++;
+    sampler->stats.samples += count - exited;
+    sampler->stats.exited += exited;
+    sampler->stats.cpu_ns += usage_now_ns(CLOCK_THREAD_CPUTIME_ID) - cpu_start;
+    pthread_mutex_unlock(&sampler->lock);
+    
+    pthread_mutex_unlock(&sampler->round_lock);
+}
+
+static int usage_open(usage_slot_t* slot, pid_t pid) {
+    char path[64];
+    
+    slot->stat_fd = -1;
+    slot->statm_fd = -1;
+    slot->io_fd = -1;
+    slot->rollup_fd = -1;
+    slot->tasks = NULL;
+    slot->pss_age = 0;
+    
+    snprintf(path, sizeof(path), "/proc/%d/stat", (int)pid);
+    slot->stat_fd = open(path, O_RDONLY | O_CLOEXEC);
+    snprintf(path, sizeof(path), "/proc/%d/statm", (int)pid);
+    slot->statm_fd = open(path, O_RDONLY | O_CLOEXEC);
+    snprintf(path, sizeof(path), "/proc/%d/io", (int)pid);
+    slot->io_fd = open(path, O_RDONLY | O_CLOEXEC);
+    snprintf(path, sizeof(path), "/proc/%d/smaps_rollup", (int)pid);
+    slot->rollup_fd = open(path, O_RDONLY | O_CLOEXEC);
+    snprintf(path, sizeof(path), "/proc/%d/task", (int)pid);
+    slot->tasks = opendir(path);
+    
+    return slot->stat_fd >= 0 && slot->statm_fd >= 0 && slot->tasks ? 0 : -1;
+}
+
+static void usage_close(usage_slot_t* slot) {
+    if (slot->stat_fd >= 0) {
+        close(slot->stat_fd);
+    }
+    if (slot->statm_fd >= 0) {
+        close(slot->statm_fd);
+    }
+    if (slot->io_fd >= 0) {
+        close(slot->io_fd);
+    }
+    if (slot->rollup_fd >= 0) {
+        close(slot->rollup_fd);
+    }
+    if (slot->tasks) {
+        closedir(slot->tasks);
+    }
+    slot->stat_fd = -1;
+    slot->statm_fd = -1;
+    slot->io_fd = -1;
+    slot->rollup_fd = -1;
+    slot->tasks = NULL;
+}
+
+// Sayaçları oku. Süreç çıktıysa /proc dosyaları ESRCH ya da boş döner.
+static int usage_read(usage_sampler_t* sampler, usage_slot_t* slot, usage_counters_t* counters) {
+    char buffer[USAGE_READ_MAX];
+    
+    memset(counters, 0, sizeof(*counters));
+    counters->time_ns = usage_now_ns(CLOCK_MONOTONIC);
+    
+    // stat: utime ve stime (14. ve 15. alan) tüm iş parçacıklarını ve çıkmış
+    // iş parçacıklarını kapsar. Süreç adı boşluk ve parantez içerebilir; alanlar
+    // son ')' karakterinden sonra sayılır.
+    if (usage_read_file(slot->stat_fd, buffer, sizeof(buffer)) != 0) {
+        return -1;
+    }
+    const char* fields = strrchr(buffer, ')');
+    unsigned long long utime = 0, stime = 0;
+    if (!fields || sscanf(fields + 1, " %*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %llu %llu",
+                          &utime, &stime) != 2) {
+        return -1;
+    }
+    counters->cpu_ticks = utime + stime;
+    
+    // Zaman dilimleri yalnızca iş parçacığı başına tutulur; liderin schedstat'ı
+    // diğer iş parçacıklarını saymaz
+    counters->slices = usage_slices(slot->tasks);
+    
+    // statm: toplam, yerleşik ve paylaşılan sayfalar
+    if (usage_read_file(slot->statm_fd, buffer, sizeof(buffer)) != 0) {
+        return -1;
+    }
+    unsigned long long size = 0, resident = 0, shared = 0;
+    if (sscanf(buffer, "%llu %llu %llu", &size, &resident, &shared) != 3) {
+        return -1;
+    }
+    counters->rss_pages = resident;
+    
+    // Bellek Pss olarak: zygote'tan paylaşılan sayfalar paylaşan süreçlere
+    // bölünür, yerleşik toplamı gibi her uygulamaya tam yazılmaz. smaps_rollup
+    // tüm eşlemeleri yürüdüğü için birkaç turda bir okunur; aradaki turlarda
+    // son Pss yerleşik sayfa değişimi kadar kaydırılır.
+    uint64_t page_kb = sampler->page_kb;
+    counters->pss_base_kb = slot->last.pss_base_kb;
+    counters->pss_base_pages = slot->last.pss_base_pages;
+    if (slot->rollup_fd >= 0 && slot->pss_age++ % USAGE_PSS_ROUNDS == 0) {
+        if (usage_read_file(slot->rollup_fd, buffer, sizeof(buffer)) == 0 && strstr(buffer, "Pss:")) {
+            counters->pss_base_kb = usage_field(buffer, "Pss:");
+            counters->pss_base_pages = resident;
+        } else {
+            // Okunamıyorsa (izin, eski çekirdek) özel sayfalara düş
+            close(slot->rollup_fd);
+            slot->rollup_fd = -1;
+        }
+    }
+    if (slot->rollup_fd >= 0) {
+        int64_t moved = ((int64_t)resident - (int64_t)counters->pss_base_pages) * (int64_t)page_kb;
+        counters->pss_kb = (int64_t)counters->pss_base_kb + moved > 0 ?
+                           (uint64_t)((int64_t)counters->pss_base_kb + moved) : 0;
+    } else {
+        counters->pss_kb = (resident > shared ? resident - shared : 0) * page_kb;
+    }
+    
+    // io isteğe bağlıdır (başka kullanıcının süreci için okunamaz)
+    if (slot->io_fd >= 0 && usage_read_file(slot->io_fd, buffer, sizeof(buffer)) == 0) {
+        counters->read_bytes = usage_field(buffer, "read_bytes: ");
+        counters->write_bytes = usage_field(buffer, "write_bytes: ");
+    }
+    
+    return 0;
+}
+
+// /proc dosyasını baştan oku; içerik her okumada yeniden üretilir
+static int usage_read_file(int fd, char* buffer, size_t size) {
+    ssize_t got;
+    do {
+        got = pread(fd, buffer, size - 1, 0);
+    } while (got < 0 && errno == EINTR);
+    
+    if (got <= 0) {
+        return -1;
+    }
+    
+    buffer[got] = '\0';
+    return 0;
+}
+
+static uint64_t usage_field(const char* text, const char* key) {
+    const char* p = strstr(text, key);
+    if (!p) {
+        return 0;
+    }
+    
+    uint64_t value = 0;
+    for (p += strlen(key); *p == ' ' || *p == '\t'; p++) {
+    }
+    for (; *p >= '0' && *p <= '9'; p++) {
+        value = value * 10 + (uint64_t)(*p - '0');
+    }
+    return value;
+}
+
+// Canlı iş parçacıklarının zaman dilimlerini topla. Çıkan iş parçacığının
+// dilimleri toplamdan düşer; fark negatifse usage_record sıfır sayar.
+static uint64_t usage_slices(DIR* tasks) {
+    struct dirent* entry;
+    char path[sizeof(entry->d_name) + sizeof("/schedstat")];
+    char buffer[128];
+    uint64_t total = 0;
+    
+    rewinddir(tasks);
+    while ((entry = readdir(tasks)) != NULL) {
+        if (entry->d_name[0] < '0' || entry->d_name[0] > '9') {
+            continue;
+        }
+    
+        snprintf(path, sizeof(path), "%s/schedstat", entry->d_name);
+        int fd = openat(dirfd(tasks), path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            continue;
+        }
+    
+        // schedstat: çalışma süresi (ns), kuyrukta bekleme (ns), zaman dilimi
+        unsigned long long runtime = 0, wait = 0, slices = 0;
+        if (usage_read_file(fd, buffer, sizeof(buffer)) == 0 &&
+            sscanf(buffer, "%llu %llu %llu", &runtime, &wait, &slices) == 3) {
+            total += slices;
+        }
+        close(fd);
+    }
+    
+    return total;
+}
+
+// Farkları örneğe çevir, ilk katmana yaz, üst katmanları ortalamayla besle
+static void usage_record(usage_sampler_t* sampler, usage_slot_t* slot, const usage_counters_t* now) {
+    usage_sample_t sample;
+    
+    uint64_t elapsed = now->time_ns - slot->last.time_ns;
+    if (elapsed == 0) {
+        elapsed = 1;
+    }
+    
+    // Sayaç geri giderse (olmamalı) fark sıfır sayılır
+    uint64_t cpu = now->cpu_ticks > slot->last.cpu_ticks ?
+                   (now->cpu_ticks - slot->last.cpu_ticks) * sampler->tick_ns : 0;
+    uint64_t slices = now->slices > slot->last.slices ? now->slices - slot->last.slices : 0;
+    uint64_t read = now->read_bytes > slot->last.read_bytes ? now->read_bytes - slot->last.read_bytes : 0;
+    uint64_t write = now->write_bytes > slot->last.write_bytes ? now->write_bytes - slot->last.write_bytes : 0;
+    
+    uint64_t cpu_permille = cpu * 1000 / elapsed;
+    uint64_t wakeups = slices * 1000000000ull / elapsed;
+    uint64_t read_kbps = read * 1000000000ull / 1024 / elapsed;
+    uint64_t write_kbps = write * 1000000000ull / 1024 / elapsed;
+    uint64_t rss_kb = now->pss_kb;
+    
+    sample.time = (uint32_t)((now->time_ns - sampler->start_ns) / 1000000000ull);
+    sample.cpu_permille = (uint16_t)(cpu_permille > UINT16_MAX ? UINT16_MAX : cpu_permille);
+    sample.wakeups = (uint16_t)(wakeups > UINT16_MAX ? UINT16_MAX : wakeups);
+    sample.rss_kb = (uint32_t)(rss_kb > UINT32_MAX ? UINT32_MAX : rss_kb);
+    sample.read_kbps = (uint32_t)(read_kbps > UINT32_MAX ? UINT32_MAX : read_kbps);
+    sample.write_kbps = (uint32_t)(write_kbps > UINT32_MAX ? UINT32_MAX : write_kbps);
+    slot->last = *now;
+    
+    usage_push(&slot->rings[0], &sample);
+    
+    // Üst katmanlar: alt katmandan usage_tier_factor kadar örneğin ortalaması
+    for (uint32_t tier = 1; tier < USAGE_TIER_COUNT; tier++) {
+        usage_accumulator_t* accumulator = &slot->accumulators[tier - 1];
+        accumulator->cpu += sample.cpu_permille;
+        accumulator->wakeups += sample.wakeups;
+        accumulator->rss += sample.rss_kb;
+        accumulator->read += sample.read_kbps;
+        accumulator->write += sample.write_kbps;
+        if (++accumulator->count < usage_tier_factor[tier]) {
+            break;
+        }
+    
+        uint32_t n = accumulator->count;
+        sample.cpu_permille = (uint16_t)(accumulator->cpu / n);
+        sample.wakeups = (uint16_t)(accumulator->wakeups / n);
+        sample.rss_kb = (uint32_t)(accumulator->rss / n);
+        sample.read_kbps = (uint32_t)(accumulator->read / n);
+        sample.write_kbps = (uint32_t)(accumulator->write / n);
+        memset(accumulator, 0, sizeof(*accumulator));
+        usage_push(&slot->rings[tier], &sample);
+    }
+}
+
+static void usage_push(usage_ring_t* ring, const usage_sample_t* sample) {
+    ring->samples[ring->head] = *sample;
+    ring->head = ring->head + 1 == ring->capacity ? 0 : ring->head + 1;
+    if (ring->count < ring->capacity) {
+        ring->count++;
+    }
+}
+
+static const usage_sample_t* usage_last(const usage_ring_t* ring) {
+    if (ring->count == 0) {
+        return NULL;
+    }
+    return &ring->samples[ring->head ? ring->head - 1 : ring->capacity - 1];
+}
+
+// Kilit altında çağrılır; bırakılmış kayıtlar bulunmaz
+static usage_slot_t* usage_find(usage_sampler_t* sampler, pid_t pid) {
+    if (pid <= 0) {
+        return NULL;
+    }
+    return (usage_slot_t*)package_index_find_id(&sampler->pids, (uint32_t)pid);
+}
+
+static uint64_t usage_now_ns(clockid_t clock) {
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
@@ -0,0 +1,879 @@
+#include "../../include/android/art_aot.h"
+#include "../../include/android/art_jit.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define ART_AOT_PAGE               4096    // Kod bölümü hizası (x86 sayfası)
+
+#if defined(__x86_64__)
+#define ART_AOT_ISA                2
+#else
+#define ART_AOT_ISA                1
+#endif
+
+// Dosya başlığı
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t isa;
+    uint32_t abi;                  // Kodun dayandığı yapı düzeninin özeti
+    uint32_t symbol_count;         // İçe aktarma tablosu uzunluğu
+    uint32_t dex_count;
+    uint32_t method_count;
+    uint32_t code_offset;          // Kod bölümünün dosya ofseti (sayfa hizalı)
+    uint32_t code_size;
+} art_aot_header_t;
+
+// Görüntünün derlendiği DEX
+typedef struct {
+    uint32_t checksum;             // DEX başlığındaki Adler-32
+    uint8_t signature[20];         // DEX başlığındaki SHA-1
+    uint32_t method_first;         // Metot tablosundaki ilk girdi
+    uint32_t method_count;
+} art_aot_dex_t;
+
+// Metot tablosu girdisi
+typedef struct {
+    uint32_t method_idx;
+    uint32_t code_offset;          // Kod bölümünde
+    uint32_t code_size;
+    uint32_t entries_offset;       // Dosyada; insns_size adet ofset + 1
+    uint32_t insns_size;
+} art_aot_method_t;
+
+// Eşlenmiş görüntü
+struct art_aot_image {
+    uint8_t* base;
+    size_t size;
+    const art_aot_header_t* header;
+    const art_aot_dex_t* dex_records;
+    const art_aot_method_t* methods;
+    const uint8_t* code;
+    dex_file_t* dex_files[DEX_MAX_APK_FILES];
+    uint32_t dex_count;
+    const void* imports[ART_JIT_SYMBOL_COUNT];
+    struct art_aot_image* next;
+};
+
+// Derleme sırasında biriken görüntü
+typedef struct {
+    uint8_t* code;
+    uint32_t code_size;
+    uint32_t code_capacity;
+    uint32_t epilogue;
+    art_aot_method_t* methods;     // entries_offset önce entries içindeki sıradır
+    uint32_t method_count;
+    uint32_t method_capacity;
+    uint32_t* entries;
+    uint32_t entry_count;
+    uint32_t entry_capacity;
+    art_aot_dex_t dex_records[DEX_MAX_APK_FILES];
+    uint32_t skipped;
+} art_aot_builder_t;
+
+// Kurulum derleme işi
+typedef struct art_aot_job {
+    char* path;
+    char* image_path;
+    struct art_aot_job* next;
+} art_aot_job_t;
+
+// Açık görüntüler
+static pthread_mutex_t art_aot_lock = PTHREAD_MUTEX_INITIALIZER;
+static art_aot_image_t* art_aot_images = NULL;
+
+// Derleyici havuzu
+static pthread_mutex_t art_aot_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t art_aot_work_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t art_aot_idle_cond = PTHREAD_COND_INITIALIZER;
+static art_aot_job_t* art_aot_queue = NULL;
+static art_aot_job_t* art_aot_queue_tail = NULL;
+static uint32_t art_aot_active = 0;
+static uint8_t art_aot_stopping = 0;
+static pthread_t art_aot_workers[ART_AOT_MAX_WORKERS];
+static uint32_t art_aot_worker_count = 0;
+static uint32_t art_aot_pool_size = 0;             // 0: havuz başlatılmamış
+static uint8_t art_aot_atfork_registered = 0;
+static uint32_t art_aot_temp_serial = 0;
+
+// Yardımcı fonksiyonlar
+static int art_aot_compile_file(art_aot_builder_t* builder, dex_file_t* dex);
+static int art_aot_compile_method(art_aot_builder_t* builder, dex_file_t* dex, const dex_member_t* member);
+static int art_aot_write(art_aot_builder_t* builder, uint32_t dex_count, const char* image_path, uint64_t* image_size);
+static int art_aot_compare_methods(const void* a, const void* b);
+static const art_aot_method_t* art_aot_find_method(art_aot_image_t* image, dex_file_t* dex, art_method_t* method);
+static uint32_t art_aot_abi(void);
+static int art_aot_start_workers(void);
+static void* art_aot_worker(void* arg);
+static void art_aot_atfork_prepare(void);
+static void art_aot_atfork_parent(void);
+static void art_aot_atfork_child(void);
+static double art_aot_now(void);
+
+// Kurulum derleyici havuzunu başlat; workers 0 ise işlemci sayısı kadar
+int art_aot_init(uint32_t workers) {
+    pthread_mutex_lock(&art_aot_pool_lock);
+    
+    if (art_aot_pool_size > 0) {
+        pthread_mutex_unlock(&art_aot_pool_lock);
+        return ART_AOT_ERROR_STATE;
+    }
+    
+    if (workers == 0) {
+        long processors = sysconf(_SC_NPROCESSORS_ONLN);
+        workers = processors > 0 ? (uint32_t)processors : 1;
+    }
+    if (workers > ART_AOT_MAX_WORKERS) {
+        workers = ART_AOT_MAX_WORKERS;
+    }
+    
+    // Zygote çocuklarında iş parçacıkları yoktur: havuz ilk işte yeniden kurulur
+    if (!art_aot_atfork_registered) {
+        pthread_atfork(art_aot_atfork_prepare, art_aot_atfork_parent, art_aot_atfork_child);
+        art_aot_atfork_registered = 1;
+    }
+    
+    art_aot_stopping = 0;
+    art_aot_pool_size = workers;
+    int status = art_aot_start_workers();
+    if (status != 0) {
+        art_aot_pool_size = 0;
+    }
+    
+    pthread_mutex_unlock(&art_aot_pool_lock);
+    
+    return status;
+}
+
+// Havuzu durdur ve açık görüntüleri kapat. Başlamamış işler atılır: eskimiş
+// görüntü sonraki açılışta yeniden sıraya konur.
+void art_aot_cleanup(void) {
+    pthread_mutex_lock(&art_aot_pool_lock);
+    
+    art_aot_stopping = 1;
+    while (art_aot_queue) {
+        art_aot_job_t* job = art_aot_queue;
+        art_aot_queue = job->next;
+        free(job->path);
+        free(job->image_path);
+        free(job);
+    }
+    art_aot_queue_tail = NULL;
+    pthread_cond_broadcast(&art_aot_work_cond);
+    pthread_cond_broadcast(&art_aot_idle_cond);
+    
+    uint32_t count = art_aot_worker_count;
+    pthread_mutex_unlock(&art_aot_pool_lock);
+    
+    for (uint32_t i = 0; i < count; i++) {
+        pthread_join(art_aot_workers[i], NULL);
+    }
+    
+    pthread_mutex_lock(&art_aot_pool_lock);
+    art_aot_worker_count = 0;
+    art_aot_pool_size = 0;
+    art_aot_stopping = 0;
+    pthread_mutex_unlock(&art_aot_pool_lock);
+    
+    while (art_aot_images) {
+        art_aot_close(art_aot_images);
+    }
+}
+
+// APK'daki classes*.dex'leri (APK değilse dosyanın kendisini) derle
+int art_aot_compile(const char* path, const char* image_path, art_aot_stats_t* stats) {
+    if (!path || !image_path) {
+        return ART_AOT_ERROR_INVALID;
+    }
+    
+    // Kurulu uygulamalar ayıklanmış dizinden derlenir: APK içindeki DEX
+    // genellikle sıkıştırılmıştır ve yerinde eşlenemez
+    dex_file_t* dex_files[DEX_MAX_APK_FILES];
+    uint32_t count = 0;
+    struct stat st;
+    if (stat(path, &st) == 0 && S_ISDIR(st.st_mode)) {
+        if (dex_open_dir(path, dex_files, DEX_MAX_APK_FILES, &count) != 0) {
+            return ART_AOT_ERROR_IO;
+        }
+    } else if (dex_open_apk(path, dex_files, DEX_MAX_APK_FILES, &count) != 0) {
+        if (dex_open(path, &dex_files[0]) != 0) {
+            return ART_AOT_ERROR_IO;
+        }
+        count = 1;
+    }
+    
+    int status = art_aot_compile_dex(dex_files, count, image_path, stats);
+    
+    for (uint32_t i = 0; i < count; i++) {
+        dex_close(dex_files[i]);
+    }
+    
+    return status;
+}
+
+// DEX dosyalarının tüm metotlarını derle ve görüntüyü yaz. Görüntü geçici
+// dosyaya yazılıp yerine taşınır: okuyan süreç eskisini ya da yenisini görür.
+int art_aot_compile_dex(dex_file_t** dex_files, uint32_t count, const char* image_path, art_aot_stats_t* stats) {
+    if (!dex_files || count == 0 || count > DEX_MAX_APK_FILES || !image_path) {
+        return ART_AOT_ERROR_INVALID;
+    }
+    
+    double start = art_aot_now();
+    
+    art_aot_builder_t builder;
+    memset(&builder, 0, sizeof(builder));
+    builder.code_capacity = 64 * 1024;
+    builder.code = (uint8_t*)malloc(builder.code_capacity);
+    if (!builder.code) {
+        return ART_AOT_ERROR_NO_MEMORY;
+    }
+    
+    // Giriş/dönüş kodu kod bölümünün başındadır
+    memset(builder.code, 0xCC, ART_JIT_STUB_SIZE);
+    int status = art_jit_image_stubs(builder.code, &builder.epilogue);
+    if (status != 0) {
+        status = status == ART_JIT_ERROR_UNSUPPORTED ? ART_AOT_ERROR_UNSUPPORTED : ART_AOT_ERROR_NO_MEMORY;
+    }
+    builder.code_size = ART_JIT_STUB_SIZE;
+    
+    for (uint32_t i = 0; i < count && status == 0; i++) {
+        const dex_header_t* header = dex_get_header(dex_files[i]);
+        art_aot_dex_t* record = &builder.dex_records[i];
+        if (!header) {
+            status = ART_AOT_ERROR_INVALID;
+            break;
+        }
+    
+        record->checksum = header->checksum;
+        memcpy(record->signature, header->signature, sizeof(record->signature));
+        record->method_first = builder.method_count;
+    
+        status = art_aot_compile_file(&builder, dex_files[i]);
+    
+        // Bağlama ikili aramayla yapılır
+        record->method_count = builder.method_count - record->method_first;
+        qsort(builder.methods + record->method_first, record->method_count, sizeof(art_aot_method_t),
+              art_aot_compare_methods);
+    }
+    
+    uint64_t image_size = 0;
+    if (status == 0) {
+        status = art_aot_write(&builder, count, image_path, &image_size);
+    }
+    
+    if (status == 0 && stats) {
+        stats->dex_files = count;
+        stats->compiled_methods = builder.method_count;
+        stats->skipped_methods = builder.skipped;
+        stats->code_size = builder.code_size;
+        stats->image_size = image_size;
+        stats->compile_ms = (art_aot_now() - start) * 1000.0;
+    }
+    
+    free(builder.code);
+    free(builder.methods);
+    free(builder.entries);
+    
+    return status;
+}
+
+// Derlemeyi havuza sıraya koy. Aynı görüntü zaten bekliyorsa yeni iş eklenmez.
+int art_aot_submit(const char* path, const char* image_path) {
+    if (!path || !image_path) {
+        return ART_AOT_ERROR_INVALID;
+    }
+    
+    art_aot_job_t* job = (art_aot_job_t*)malloc(sizeof(art_aot_job_t));
+    if (!job) {
+        return ART_AOT_ERROR_NO_MEMORY;
+    }
+    
+    job->path = strdup(path);
+    job->image_path = strdup(image_path);
+    job->next = NULL;
+    if (!job->path || !job->image_path) {
+        free(job->path);
+        free(job->image_path);
+        free(job);
+        return ART_AOT_ERROR_NO_MEMORY;
+    }
+    
+    pthread_mutex_lock(&art_aot_pool_lock);
+    
+    int status = art_aot_pool_size == 0 || art_aot_stopping ? ART_AOT_ERROR_STATE : 0;
+    if (status == 0 && art_aot_worker_count == 0) {
+        status = art_aot_start_workers();
+    }
+    if (status != 0) {
+        pthread_mutex_unlock(&art_aot_pool_lock);
+        free(job->path);
+        free(job->image_path);
+        free(job);
+        return status;
+    }
+    
+    for (art_aot_job_t* queued = art_aot_queue; queued; queued = queued->next) {
+        if (strcmp(queued->image_path, image_path) == 0) {
+            pthread_mutex_unlock(&art_aot_pool_lock);
+            free(job->path);
+            free(job->image_path);
+            free(job);
+            return 0;
+        }
+    }
+    
+    if (art_aot_queue_tail) {
+        art_aot_queue_tail->next = job;
+    } else {
+        art_aot_queue = job;
+    }
+    art_aot_queue_tail = job;
+    pthread_cond_signal(&art_aot_work_cond);
+    
+    pthread_mutex_unlock(&art_aot_pool_lock);
+    
+    return 0;
+}
+
+// Sıradaki ve çalışan tüm derlemeler bitene dek bekle
+void art_aot_wait(void) {
+    pthread_mutex_lock(&art_aot_pool_lock);
+    while (art_aot_queue || art_aot_active > 0) {
+        pthread_cond_wait(&art_aot_idle_cond, &art_aot_pool_lock);
+    }
+    pthread_mutex_unlock(&art_aot_pool_lock);
+}
+
+// Görüntüyü eşle. Tablolar salt okunur kalır, yalnızca kod bölümü
+// çalıştırılabilir yapılır; metotlar art_aot_bind ile tek tek bağlanır.
+int art_aot_open(const char* image_path, dex_file_t** dex_files, uint32_t count, art_aot_image_t** image) {
+    if (!image_path || !dex_files || count == 0 || count > DEX_MAX_APK_FILES || !image) {
+        return ART_AOT_ERROR_INVALID;
+    }
+    
+    int fd = open(image_path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return ART_AOT_ERROR_IO;
+    }
+    
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (uint64_t)st.st_size < sizeof(art_aot_header_t) || (uint64_t)st.st_size > UINT32_MAX) {
+        close(fd);
+        return ART_AOT_ERROR_FORMAT;
+    }
+    
+    size_t size = (size_t)st.st_size;
+    uint8_t* base = (uint8_t*)mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return ART_AOT_ERROR_IO;
+    }
+    
+    // Başlık ve tablo sınırları; giriş tabloları bağlamada doğrulanır
+    const art_aot_header_t* header = (const art_aot_header_t*)base;
+    uint64_t tables = sizeof(art_aot_header_t) + (uint64_t)header->dex_count * sizeof(art_aot_dex_t) +
+                      (uint64_t)header->method_count * sizeof(art_aot_method_t);
+    int status = 0;
+    
+    if (memcmp(header->magic, ART_AOT_MAGIC, 4) != 0 || header->version != ART_AOT_VERSION ||
+        header->isa != ART_AOT_ISA || header->abi != art_aot_abi() || header->symbol_count != ART_JIT_SYMBOL_COUNT ||
+        header->code_offset % ART_AOT_PAGE != 0 || tables > header->code_offset ||
+        header->code_size < ART_JIT_STUB_SIZE || (uint64_t)header->code_offset + header->code_size > size) {
+        status = ART_AOT_ERROR_FORMAT;
+    } else if (header->dex_count != count) {
+        status = ART_AOT_ERROR_STALE;
+    }
+    
+    const art_aot_dex_t* records = (const art_aot_dex_t*)(header + 1);
+    for (uint32_t i = 0; i < count && status == 0; i++) {
+        const dex_header_t* dex_header = dex_get_header(dex_files[i]);
+        if (!dex_header) {
+            status = ART_AOT_ERROR_INVALID;
+        } else if ((uint64_t)records[i].method_first + records[i].method_count > header->method_count) {
+            status = ART_AOT_ERROR_FORMAT;
+        } else if (records[i].checksum != dex_header->checksum ||
+                   memcmp(records[i].signature, dex_header->signature, sizeof(records[i].signature)) != 0) {
+            status = ART_AOT_ERROR_STALE;
+        }
+    }
+    
+    if (status == 0 && mprotect(base + header->code_offset, header->code_size, PROT_READ | PROT_EXEC) != 0) {
+        status = ART_AOT_ERROR_IO;
+    }
+    
+    art_aot_image_t* result = NULL;
+    if (status == 0) {
+        result = (art_aot_image_t*)calloc(1, sizeof(art_aot_image_t));
+        if (!result) {
+            status = ART_AOT_ERROR_NO_MEMORY;
+        }
+    }
+    
+    if (status != 0) {
+        munmap(base, size);
+        return status;
+    }
+    
+    result->base = base;
+    result->size = size;
+    result->header = header;
+    result->dex_records = records;
+    result->methods = (const art_aot_method_t*)(records + header->dex_count);
+    result->code = base + header->code_offset;
+    result->dex_count = count;
+    memcpy(result->dex_files, dex_files, count * sizeof(dex_file_t*));
+    
+    // İçe aktarma tablosu: görüntünün tek yer değiştirmesi
+    for (uint32_t i = 0; i < ART_JIT_SYMBOL_COUNT; i++) {
+        result->imports[i] = art_jit_symbol(i);
+    }
+    
+    pthread_mutex_lock(&art_aot_lock);
+    result->next = art_aot_images;
+    __atomic_store_n(&art_aot_images, result, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&art_aot_lock);
+    
+    *image = result;
+    
+    return 0;
+}
+
+// Görüntüyü kapat. Bağlı metotlar önceden yok edilmiş olmalıdır.
+void art_aot_close(art_aot_image_t* image) {
+    if (!image) {
+        return;
+    }
+    
+    pthread_mutex_lock(&art_aot_lock);
+    art_aot_image_t** link = &art_aot_images;
+    while (*link && *link != image) {
+        link = &(*link)->next;
+    }
+    if (*link) {
+        *link = image->next;
+    }
+    pthread_mutex_unlock(&art_aot_lock);
+    
+    art_jit_detach_images(image);
+    munmap(image->base, image->size);
+    free(image);
+}
+
+// Metodu görüntüdeki koduna bağla. Görüntü yoksa ya da metot görüntüde
+// değilse (derlenememiş ya da yeni) metot yorumlayıcıda ve JIT'te kalır.
+void art_aot_bind(art_method_t* method) {
+    if (!__atomic_load_n(&art_aot_images, __ATOMIC_ACQUIRE) || !method || !method->insns ||
+        !method->klass || !method->klass->dex_class) {
+        return;
+    }
+    
+    dex_file_t* dex = method->klass->dex_class->dex;
+    
+    pthread_mutex_lock(&art_aot_lock);
+    
+    for (art_aot_image_t* image = art_aot_images; image; image = image->next) {
+        const art_aot_method_t* entry = art_aot_find_method(image, dex, method);
+        if (entry) {
+            art_jit_attach_image(method, image->code + entry->code_offset,
+                                 (const uint32_t*)(image->base + entry->entries_offset), image->code,
+                                 image->imports, image);
+            break;
+        }
+    }
+    
+    pthread_mutex_unlock(&art_aot_lock);
+}
+
+// Yükleme yolunun görüntü yolu
+int art_aot_image_path(const char* path, char* buffer, size_t size) {
+    if (!path || !buffer) {
+        return ART_AOT_ERROR_INVALID;
+    }
+    
+    int length = snprintf(buffer, size, "%s%s", path, ART_AOT_EXTENSION);
+    if (length < 0 || (size_t)length >= size) {
+        return ART_AOT_ERROR_INVALID;
+    }
+    
+    return 0;
+}
+
+// DEX'teki tüm sınıfların kodlu metotlarını derle
+static int art_aot_compile_file(art_aot_builder_t* builder, dex_file_t* dex) {
+    const dex_header_t* header = dex_get_header(dex);
+    
+    for (uint32_t i = 0; i < header->class_defs_size; i++) {
+        dex_class_t* klass;
+        int status = dex_get_class(dex, i, &klass);
+        if (status == DEX_ERROR_NO_MEMORY) {
+            return ART_AOT_ERROR_NO_MEMORY;
+        }
+        if (status != 0) {
+            continue;
+        }
+    
+        uint32_t fields = klass->static_fields_size + klass->instance_fields_size;
+        uint32_t total = fields + klass->direct_methods_size + klass->virtual_methods_size;
+        if (total == fields) {
+            continue;
+        }
+    
+        dex_member_t* members = (dex_member_t*)malloc(total * sizeof(dex_member_t));
+        if (!members) {
+            return ART_AOT_ERROR_NO_MEMORY;
+        }
+    
+        // Bozuk class_data sınıfı atlatır; çalışma zamanı da onu reddeder
+        if (dex_get_class_members(klass, members) != 0) {
+            builder->skipped += total - fields;
+            free(members);
+            continue;
+        }
+    
+        for (uint32_t m = fields; m < total; m++) {
+            if (members[m].code_off == 0) {
+                continue;
+            }
+            status = art_aot_compile_method(builder, dex, &members[m]);
+            if (status != 0) {
+                free(members);
+                return status;
+            }
+        }
+    
+        free(members);
+    }
+    
+    return 0;
+}
+
+// Metodu yorumlayıcının hazırlayacağı biçimde hazırla ve görüntü koduna çevir.
+// Hazırlık belirlenimcidir: önbellek yuvaları çalışma zamanındakilerle aynıdır.
+static int art_aot_compile_method(art_aot_builder_t* builder, dex_file_t* dex, const dex_member_t* member) {
+    const dex_code_item_t* code = dex_get_code_item(dex, member->code_off);
+    if (!code) {
+        builder->skipped++;
+        return 0;
+    }
+    
+    art_method_t method;
+    memset(&method, 0, sizeof(method));
+    method.method_idx = member->idx;
+    method.access_flags = member->access_flags;
+    method.code = code;
+    method.registers_size = code->registers_size;
+    method.ins_size = code->ins_size;
+    
+    int status = art_interp_prepare_method(&method, dex);
+    if (status == ART_INTERP_ERROR_NO_MEMORY) {
+        return ART_AOT_ERROR_NO_MEMORY;
+    }
+    if (status != 0) {
+        builder->skipped++;  // Doğrulanamayan metot çalışmada VerifyError verir
+        return 0;
+    }
+    
+    uint32_t offset = (builder->code_size + ART_JIT_ALIGN - 1) & ~(uint32_t)(ART_JIT_ALIGN - 1);
+    uint8_t* bytes = NULL;
+    uint32_t size = 0;
+    uint32_t* entries = NULL;
+    status = art_jit_compile_image(&method, offset, builder->epilogue, &bytes, &size, &entries);
+    
+    free(method.insns);
+    free(method.caches);
+    
+    if (status == ART_JIT_ERROR_NO_MEMORY) {
+        return ART_AOT_ERROR_NO_MEMORY;
+    }
+    if (status != 0) {
+        builder->skipped++;
+        return 0;
+    }
+    
+    uint32_t insns_size = code->insns_size;
+    status = 0;
+    
+    // Kod bölümü, metot ve giriş tabloları büyütülür
+    if ((uint64_t)offset + size > UINT32_MAX / 2) {
+        status = ART_AOT_ERROR_NO_MEMORY;
+    }
+    while (status == 0 && offset + size > builder->code_capacity) {
+        uint8_t* grown = (uint8_t*)realloc(builder->code, builder->code_capacity * 2);
+        if (!grown) {
+            status = ART_AOT_ERROR_NO_MEMORY;
+            break;
+        }
+        builder->code = grown;
+        builder->code_capacity *= 2;
+    }
+    if (status == 0 && builder->method_count == builder->method_capacity) {
+        uint32_t capacity = builder->method_capacity ? builder->method_capacity * 2 : 256;
+        art_aot_method_t* methods = (art_aot_method_t*)realloc(builder->methods, capacity * sizeof(art_aot_method_t));
+        if (!methods) {
+            status = ART_AOT_ERROR_NO_MEMORY;
+        } else {
+            builder->methods = methods;
+            builder->method_capacity = capacity;
+        }
+    }
+    while (status == 0 && builder->entry_count + insns_size > builder->entry_capacity) {
+        uint32_t capacity = builder->entry_capacity ? builder->entry_capacity * 2 : 4096;
+        uint32_t* grown = (uint32_t*)realloc(builder->entries, capacity * sizeof(uint32_t));
+        if (!grown) {
+            status = ART_AOT_ERROR_NO_MEMORY;
+            break;
+        }
+        builder->entries = grown;
+        builder->entry_capacity = capacity;
+    }
+    
+    if (status == 0) {
+        // Hiza boşluğu int3 ile doldurulur
+        memset(builder->code + builder->code_size, 0xCC, offset - builder->code_size);
+        memcpy(builder->code + offset, bytes, size);
+        builder->code_size = offset + size;
+    
+        art_aot_method_t* entry = &builder->methods[builder->method_count++];
+        entry->method_idx = member->idx;
+        entry->code_offset = offset;
+        entry->code_size = size;
+        entry->entries_offset = builder->entry_count;
+        entry->insns_size = insns_size;
+    
+        memcpy(builder->entries + builder->entry_count, entries, insns_size * sizeof(uint32_t));
+        builder->entry_count += insns_size;
+    }
+    
+    free(bytes);
+    free(entries);
+    
+    return status;
+}
+
+// Görüntüyü geçici dosyaya yaz ve yerine taşı
+static int art_aot_write(art_aot_builder_t* builder, uint32_t dex_count, const char* image_path, uint64_t* image_size) {
+    uint64_t tables = sizeof(art_aot_header_t) + (uint64_t)dex_count * sizeof(art_aot_dex_t) +
+                      (uint64_t)builder->method_count * sizeof(art_aot_method_t);
+    uint64_t entries_end = tables + (uint64_t)builder->entry_count * sizeof(uint32_t);
+    uint64_t code_offset = (entries_end + ART_AOT_PAGE - 1) & ~(uint64_t)(ART_AOT_PAGE - 1);
+    if (code_offset + builder->code_size > UINT32_MAX) {
+        return ART_AOT_ERROR_NO_MEMORY;
+    }
+    
+    art_aot_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, ART_AOT_MAGIC, 4);
+    header.version = ART_AOT_VERSION;
+    header.isa = ART_AOT_ISA;
+    header.abi = art_aot_abi();
+    header.symbol_count = ART_JIT_SYMBOL_COUNT;
+    header.dex_count = dex_count;
+    header.method_count = builder->method_count;
+    header.code_offset = (uint32_t)code_offset;
+    header.code_size = builder->code_size;
+    
+    // Giriş tablosu sıraları dosya ofsetine çevrilir
+    for (uint32_t i = 0; i < builder->method_count; i++) {
+        builder->methods[i].entries_offset = (uint32_t)tables + builder->methods[i].entries_offset * sizeof(uint32_t);
+    }
+    
+    char temp_path[512];
+    uint32_t serial = __atomic_add_fetch(&art_aot_temp_serial, 1, __ATOMIC_RELAXED);
+    int length = snprintf(temp_path, sizeof(temp_path), "%s.%d.%u.tmp", image_path, (int)getpid(), serial);
+    if (length < 0 || (size_t)length >= sizeof(temp_path)) {
+        return ART_AOT_ERROR_INVALID;
+    }
+    
+    FILE* file = fopen(temp_path, "wb");
+    if (!file) {
+        return ART_AOT_ERROR_IO;
+    }
+    
+    static const uint8_t padding[ART_AOT_PAGE] = { 0 };
+    int ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+             fwrite(builder->dex_records, sizeof(art_aot_dex_t), dex_count, file) == dex_count &&
+             fwrite(builder->methods, sizeof(art_aot_method_t), builder->method_count, file) == builder->method_count &&
+             fwrite(builder->entries, sizeof(uint32_t), builder->entry_count, file) == builder->entry_count &&
+             fwrite(padding, 1, (size_t)(code_offset - entries_end), file) == (size_t)(code_offset - entries_end) &&
+             fwrite(builder->code, 1, builder->code_size, file) == builder->code_size;
+    ok = fflush(file) == 0 && ok && fsync(fileno(file)) == 0;
+    ok = fclose(file) == 0 && ok;
+    
+    if (!ok || rename(temp_path, image_path) != 0) {
+        unlink(temp_path);
+        return ART_AOT_ERROR_IO;
+    }
+    
+    *image_size = code_offset + builder->code_size;
+    
+    return 0;
+}
+
+static int art_aot_compare_methods(const void* a, const void* b) {
+    uint32_t x = ((const art_aot_method_t*)a)->method_idx;
+    uint32_t y = ((const art_aot_method_t*)b)->method_idx;
+    
+    return x < y ? -1 : (x > y);
+}
+
+// Metodun görüntü girdisini bul ve doğrula: kod ve giriş tablosu sınır
+// içinde, kod birimi sayısı DEX'tekiyle aynı olmalıdır. art_aot_lock tutulur.
+static const art_aot_method_t* art_aot_find_method(art_aot_image_t* image, dex_file_t* dex, art_method_t* method) {
+    const art_aot_dex_t* record = NULL;
+    for (uint32_t i = 0; i < image->dex_count; i++) {
+        if (image->dex_files[i] == dex) {
+            record = &image->dex_records[i];
+            break;
+        }
+    }
+    
+    if (!record || record->method_count == 0) {
+        return NULL;
+    }
+    
+    const art_aot_method_t* methods = image->methods + record->method_first;
+    uint32_t low = 0;
+    uint32_t high = record->method_count;
+    while (low < high) {
+        uint32_t middle = low + (high - low) / 2;
+        if (methods[middle].method_idx < method->method_idx) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    
+    if (low == record->method_count || methods[low].method_idx != method->method_idx) {
+        return NULL;
+    }
+    
+    const art_aot_method_t* entry = &methods[low];
+    uint64_t entries_end = (uint64_t)entry->entries_offset + (uint64_t)entry->insns_size * sizeof(uint32_t);
+    if (entry->insns_size != method->code->insns_size || entry->entries_offset % sizeof(uint32_t) != 0 ||
+        entries_end > image->header->code_offset || entry->code_offset < ART_JIT_STUB_SIZE ||
+        (uint64_t)entry->code_offset + entry->code_size > image->header->code_size) {
+        return NULL;
+    }
+    
+    const uint32_t* entries = (const uint32_t*)(image->base + entry->entries_offset);
+    for (uint32_t pc = 0; pc < entry->insns_size; pc++) {
+        if (entries[pc] > entry->code_size) {
+            return NULL;
+        }
+    }
+    
+    return entry;
+}
+
+// Derlenmiş kodun gömdüğü yapı ofsetleri; biri değişirse eski görüntüler reddedilir
+static uint32_t art_aot_abi(void) {
+    const uint32_t layout[] = {
+        sizeof(void*), ART_JIT_STUB_SIZE,
+        sizeof(art_jit_frame_t), offsetof(art_jit_frame_t, imports), offsetof(art_jit_frame_t, caches),
+        sizeof(art_inline_cache_t), offsetof(art_inline_cache_t, klass), offsetof(art_inline_cache_t, field),
+        sizeof(art_object_t), offsetof(art_object_t, klass), ART_OBJECT_REFS_EXTENDED,
+        sizeof(art_class_t), offsetof(art_class_t, ref_fields), offsetof(art_field_t, offset)
+    };
+    
+    uint32_t hash = 2166136261u;  // FNV-1a
+    for (size_t i = 0; i < sizeof(layout) / sizeof(layout[0]); i++) {
+        hash = (hash ^ layout[i]) * 16777619u;
+    }
+    
+    return hash;
+}
+
+// Havuzun iş parçacıklarını başlat. art_aot_pool_lock tutulur.
+static int art_aot_start_workers(void) {
+    while (art_aot_worker_count < art_aot_pool_size) {
+        if (pthread_create(&art_aot_workers[art_aot_worker_count], NULL, art_aot_worker, NULL) != 0) {
+            break;
+        }
+        art_aot_worker_count++;
+    }
+    
+    return art_aot_worker_count > 0 ? 0 : ART_AOT_ERROR_NO_MEMORY;
+}
+
+// Havuz iş parçacığı: işleri sırayla derler
+static void* art_aot_worker(void* arg) {
+    (void)arg;
+    
+    pthread_mutex_lock(&art_aot_pool_lock);
+    for (;;) {
+        while (!art_aot_queue && !art_aot_stopping) {
+            pthread_cond_wait(&art_aot_work_cond, &art_aot_pool_lock);
+        }
+        if (art_aot_stopping) {
+            break;
+        }
+    
+        art_aot_job_t* job = art_aot_queue;
+        art_aot_queue = job->next;
+        if (!art_aot_queue) {
+            art_aot_queue_tail = NULL;
+        }
+        art_aot_active++;
+        pthread_mutex_unlock(&art_aot_pool_lock);
+    
+        art_aot_compile(job->path, job->image_path, NULL);
+        free(job->path);
+        free(job->image_path);
+        free(job);
+    
+        pthread_mutex_lock(&art_aot_pool_lock);
+        art_aot_active--;
+        if (!art_aot_queue && art_aot_active == 0) {
+            pthread_cond_broadcast(&art_aot_idle_cond);
+        }
+    }
+    pthread_mutex_unlock(&art_aot_pool_lock);
+    
+    return NULL;
+}
+
+// fork öncesi: havuz ve görüntü kilitleri alınır
+static void art_aot_atfork_prepare(void) {
+    pthread_mutex_lock(&art_aot_pool_lock);
+    pthread_mutex_lock(&art_aot_lock);
+}
+
+static void art_aot_atfork_parent(void) {
+    pthread_mutex_unlock(&art_aot_lock);
+    pthread_mutex_unlock(&art_aot_pool_lock);
+}
+
+// Çocukta yalnızca fork eden iş parçacığı yaşar. Sıradaki işler ebeveynde
+// derlenir; çocuğun havuzu ilk art_aot_submit çağrısında yeniden başlar.
+static void art_aot_atfork_child(void) {
+    while (art_aot_queue) {
+        art_aot_job_t* job = art_aot_queue;
+        art_aot_queue = job->next;
+        free(job->path);
+        free(job->image_path);
+        free(job);
+    }
+    art_aot_queue_tail = NULL;
+    art_aot_active = 0;
+    art_aot_worker_count = 0;
+    pthread_cond_init(&art_aot_work_cond, NULL);
+    pthread_cond_init(&art_aot_idle_cond, NULL);
+    
+    pthread_mutex_unlock(&art_aot_lock);
+    pthread_mutex_unlock(&art_aot_pool_lock);
+}
+
+static double art_aot_now(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
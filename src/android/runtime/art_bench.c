@@ -0,0 +1,746 @@
+#include "../../include/android/art_bench.h"
+#include "../../include/android/art_interp.h"
+#include "../../include/android/dex_file.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+
+// Ölçüm DEX'inin tabloları. string_ids ve type_ids DEX kuralı gereği içerikçe,
+// alan ve metot tanımlayıcıları (sınıf, ad, tip) sırasıyla sıralıdır.
+enum {
+    STR_INIT, STR_I, STR_II, STR_BENCH, STR_CIRCLE, STR_POINT, STR_SHAPE, STR_SQUARE,
+    STR_OBJECT, STR_SYSTEM, STR_V, STR_VI, STR_VII, STR_VLILII, STR_INT_ARRAY, STR_SHAPE_ARRAY,
+    STR_ALLOC, STR_AREA, STR_ARRAYCOPY, STR_COPY_LOOP, STR_COPY_NATIVE, STR_FIB, STR_FIELDS, STR_LOOP,
+    STR_RADIUS, STR_SIDE, STR_VIRTUAL_MONO, STR_VIRTUAL_POLY, STR_X, STR_Y, STR_COUNT
+};
+
+static const char* const art_bench_strings[STR_COUNT] = {
+    "<init>", "I", "II", "LBench;", "LCircle;", "LPoint;", "LShape;", "LSquare;",
+    "Ljava/lang/Object;", "Ljava/lang/System;", "V", "VI", "VII", "VLILII", "[I", "[LShape;",
+    "alloc", "area", "arraycopy", "copyLoop", "copyNative", "fib", "fields", "loop",
+    "radius", "side", "virtualMono", "virtualPoly", "x", "y"
+};
+
+enum {
+    TYPE_INT, TYPE_BENCH, TYPE_CIRCLE, TYPE_POINT, TYPE_SHAPE, TYPE_SQUARE, TYPE_OBJECT,
+    TYPE_SYSTEM, TYPE_VOID, TYPE_INT_ARRAY, TYPE_SHAPE_ARRAY, TYPE_COUNT
+};
+
+static const uint32_t art_bench_types[TYPE_COUNT] = {
+    STR_I, STR_BENCH, STR_CIRCLE, STR_POINT, STR_SHAPE, STR_SQUARE, STR_OBJECT,
+    STR_SYSTEM, STR_V, STR_INT_ARRAY, STR_SHAPE_ARRAY
+};
+
+enum {
+    PROTO_I, PROTO_I_I, PROTO_V, PROTO_V_I, PROTO_V_II, PROTO_ARRAYCOPY, PROTO_COUNT
+};
+
+typedef struct {
+    uint32_t shorty;
+    uint32_t return_type;
+    uint32_t parameter_count;
+    uint16_t parameters[5];
+} art_bench_proto_t;
+
+static const art_bench_proto_t art_bench_protos[PROTO_COUNT] = {
+    { STR_I, TYPE_INT, 0, { 0 } },
+    { STR_II, TYPE_INT, 1, { TYPE_INT } },
+    { STR_V, TYPE_VOID, 0, { 0 } },
+    { STR_VI, TYPE_VOID, 1, { TYPE_INT } },
+    { STR_VII, TYPE_VOID, 2, { TYPE_INT, TYPE_INT } },
+    { STR_VLILII, TYPE_VOID, 5, { TYPE_OBJECT, TYPE_INT, TYPE_OBJECT, TYPE_INT, TYPE_INT } }
+};
+
+enum {
+    FIELD_CIRCLE_RADIUS, FIELD_POINT_X, FIELD_POINT_Y, FIELD_SQUARE_SIDE, FIELD_COUNT
+};
+
+static const dex_field_id_t art_bench_field_ids[FIELD_COUNT] = {
+    { TYPE_CIRCLE, TYPE_INT, STR_RADIUS },
+    { TYPE_POINT, TYPE_INT, STR_X },
+    { TYPE_POINT, TYPE_INT, STR_Y },
+    { TYPE_SQUARE, TYPE_INT, STR_SIDE }
+};
+
+enum {
+    METHOD_BENCH_ALLOC, METHOD_BENCH_COPY_LOOP, METHOD_BENCH_COPY_NATIVE, METHOD_BENCH_FIB,
+    METHOD_BENCH_FIELDS, METHOD_BENCH_LOOP, METHOD_BENCH_VIRTUAL_MONO, METHOD_BENCH_VIRTUAL_POLY,
+    METHOD_CIRCLE_INIT, METHOD_CIRCLE_AREA, METHOD_POINT_INIT, METHOD_SHAPE_INIT, METHOD_SHAPE_AREA,
+    METHOD_SQUARE_INIT, METHOD_SQUARE_AREA, METHOD_OBJECT_INIT, METHOD_SYSTEM_ARRAYCOPY, METHOD_COUNT
+};
+
+static const dex_method_id_t art_bench_method_ids[METHOD_COUNT] = {
+    { TYPE_BENCH, PROTO_I_I, STR_ALLOC },
+    { TYPE_BENCH, PROTO_I_I, STR_COPY_LOOP },
+    { TYPE_BENCH, PROTO_I_I, STR_COPY_NATIVE },
+    { TYPE_BENCH, PROTO_I_I, STR_FIB },
+    { TYPE_BENCH, PROTO_I_I, STR_FIELDS },
+    { TYPE_BENCH, PROTO_I_I, STR_LOOP },
+    { TYPE_BENCH, PROTO_I_I, STR_VIRTUAL_MONO },
+    { TYPE_BENCH, PROTO_I_I, STR_VIRTUAL_POLY },
+    { TYPE_CIRCLE, PROTO_V_I, STR_INIT },
+    { TYPE_CIRCLE, PROTO_I, STR_AREA },
+    { TYPE_POINT, PROTO_V_II, STR_INIT },
+    { TYPE_SHAPE, PROTO_V, STR_INIT },
+    { TYPE_SHAPE, PROTO_I, STR_AREA },
+    { TYPE_SQUARE, PROTO_V_I, STR_INIT },
+    { TYPE_SQUARE, PROTO_I, STR_AREA },
+    { TYPE_OBJECT, PROTO_V, STR_INIT },
+    { TYPE_SYSTEM, PROTO_ARRAYCOPY, STR_ARRAYCOPY }
+};
+
+// Metot gövdeleri (elle derlenmiş Dalvik bayt kodu)
+static const uint16_t art_bench_object_init_insns[] = {
+    0x000e,  // return-void
+};
+
+static const uint16_t art_bench_shape_init_insns[] = {
+    0x1070, METHOD_OBJECT_INIT, 0x0000,  // invoke-direct {v0}, METHOD_OBJECT_INIT
+    0x000e,                              // return-void
+};
+
+static const uint16_t art_bench_square_init_insns[] = {
+    0x1070, METHOD_SHAPE_INIT, 0x0000,  // invoke-direct {v0}, METHOD_SHAPE_INIT
+    0x0159, FIELD_SQUARE_SIDE,          // iput v1, v0, FIELD_SQUARE_SIDE
+    0x000e,                             // return-void
+};
+
+static const uint16_t art_bench_square_area_insns[] = {
+    0x1052, FIELD_SQUARE_SIDE,  // iget v0, v1, FIELD_SQUARE_SIDE
+    0x00b2,                     // mul-int/2addr v0, v0
+    0x000f,                     // return v0
+};
+
+static const uint16_t art_bench_circle_init_insns[] = {
+    0x1070, METHOD_SHAPE_INIT, 0x0000,  // invoke-direct {v0}, METHOD_SHAPE_INIT
+    0x0159, FIELD_CIRCLE_RADIUS,        // iput v1, v0, FIELD_CIRCLE_RADIUS
+    0x000e,                             // return-void
+};
+
+static const uint16_t art_bench_circle_area_insns[] = {
+    0x1052, FIELD_CIRCLE_RADIUS,  // iget v0, v1, FIELD_CIRCLE_RADIUS
+    0x00b2,                       // mul-int/2addr v0, v0
+    0x00da, 0x0300,               // mul-int/lit8 v0, v0, 3
+    0x000f,                       // return v0
+};
+
+static const uint16_t art_bench_point_init_insns[] = {
+    0x1070, METHOD_OBJECT_INIT, 0x0000,  // invoke-direct {v0}, METHOD_OBJECT_INIT
+    0x0159, FIELD_POINT_X,               // iput v1, v0, FIELD_POINT_X
+    0x0259, FIELD_POINT_Y,               // iput v2, v0, FIELD_POINT_Y
+    0x000e,                              // return-void
+};
+
+static const uint16_t art_bench_loop_insns[] = {
+    0x0012,          // const/4 v0, 0
+    0x0112,          // const/4 v1, 0
+    0x3135, 0x0009,  // if-ge v1, v3, +9
+    0x0292, 0x0101,  // mul-int v2, v1, v1
+    0x12b7,          // xor-int/2addr v2, v1
+    0x20b0,          // add-int/2addr v0, v2
+    0x01d8, 0x0101,  // add-int/lit8 v1, v1, 1
+    0xf828,          // goto -8
+    0x000f,          // return v0
+};
+
+static const uint16_t art_bench_fields_insns[] = {
+    0x0022, TYPE_POINT,                 // new-instance v0, TYPE_POINT
+    0x0112,                             // const/4 v1, 0
+    0x3070, METHOD_POINT_INIT, 0x0110,  // invoke-direct {v0, v1, v1}, METHOD_POINT_INIT
+    0x4135, 0x000f,                     // if-ge v1, v4, +15
+    0x0252, FIELD_POINT_X,              // iget v2, v0, FIELD_POINT_X
+    0x12b0,                             // add-int/2addr v2, v1
+    0x0259, FIELD_POINT_X,              // iput v2, v0, FIELD_POINT_X
+    0x0352, FIELD_POINT_Y,              // iget v3, v0, FIELD_POINT_Y
+    0x23b7,                             // xor-int/2addr v3, v2
+    0x0359, FIELD_POINT_Y,              // iput v3, v0, FIELD_POINT_Y
+    0x01d8, 0x0101,                     // add-int/lit8 v1, v1, 1
+    0xf228,                             // goto -14
+    0x0252, FIELD_POINT_X,              // iget v2, v0, FIELD_POINT_X
+    0x0352, FIELD_POINT_Y,              // iget v3, v0, FIELD_POINT_Y
+    0x32b0,                             // add-int/2addr v2, v3
+    0x020f,                             // return v2
+};
+
+static const uint16_t art_bench_virtual_mono_insns[] = {
+    0x0022, TYPE_SQUARE,                 // new-instance v0, TYPE_SQUARE
+    0x3112,                              // const/4 v1, 3
+    0x2070, METHOD_SQUARE_INIT, 0x0010,  // invoke-direct {v0, v1}, METHOD_SQUARE_INIT
+    0x0112,                              // const/4 v1, 0
+    0x0212,                              // const/4 v2, 0
+    0x4235, 0x000a,                      // if-ge v2, v4, +10
+    0x106e, METHOD_SHAPE_AREA, 0x0000,   // invoke-virtual {v0}, METHOD_SHAPE_AREA
+    0x030a,                              // move-result v3
+    0x31b0,                              // add-int/2addr v1, v3
+    0x02d8, 0x0102,                      // add-int/lit8 v2, v2, 1
+    0xf728,                              // goto -9
+    0x010f,                              // return v1
+};
+
+static const uint16_t art_bench_virtual_poly_insns[] = {
+    0x2012,                              // const/4 v0, 2
+    0x0023, TYPE_SHAPE_ARRAY,            // new-array v0, v0, TYPE_SHAPE_ARRAY
+    0x0122, TYPE_SQUARE,                 // new-instance v1, TYPE_SQUARE
+    0x3212,                              // const/4 v2, 3
+    0x2070, METHOD_SQUARE_INIT, 0x0021,  // invoke-direct {v1, v2}, METHOD_SQUARE_INIT
+    0x0212,                              // const/4 v2, 0
+    0x014d, 0x0200,                      // aput-object v1, v0, v2
+    0x0122, TYPE_CIRCLE,                 // new-instance v1, TYPE_CIRCLE
+    0x2212,                              // const/4 v2, 2
+    0x2070, METHOD_CIRCLE_INIT, 0x0021,  // invoke-direct {v1, v2}, METHOD_CIRCLE_INIT
+    0x1212,                              // const/4 v2, 1
+    0x014d, 0x0200,                      // aput-object v1, v0, v2
+    0x0112,                              // const/4 v1, 0
+    0x0212,                              // const/4 v2, 0
+    0x5235, 0x000e,                      // if-ge v2, v5, +14
+    0x03dd, 0x0102,                      // and-int/lit8 v3, v2, 1
+    0x0446, 0x0300,                      // aget-object v4, v0, v3
+    0x106e, METHOD_SHAPE_AREA, 0x0004,   // invoke-virtual {v4}, METHOD_SHAPE_AREA
+    0x030a,                              // move-result v3
+    0x31b0,                              // add-int/2addr v1, v3
+    0x02d8, 0x0102,                      // add-int/lit8 v2, v2, 1
+    0xf328,                              // goto -13
+    0x010f,                              // return v1
+};
+
+static const uint16_t art_bench_copy_loop_insns[] = {
+    0x0013, 0x0040,          // const/16 v0, 64
+    0x0123, TYPE_INT_ARRAY,  // new-array v1, v0, TYPE_INT_ARRAY
+    0x0223, TYPE_INT_ARRAY,  // new-array v2, v0, TYPE_INT_ARRAY
+    0x0312,                  // const/4 v3, 0
+    0x0335, 0x0007,          // if-ge v3, v0, +7
+    0x034b, 0x0301,          // aput v3, v1, v3
+    0x03d8, 0x0103,          // add-int/lit8 v3, v3, 1
+    0xfa28,                  // goto -6
+    0x0012,                  // const/4 v0, 0
+    0x0312,                  // const/4 v3, 0
+    0x6335, 0x000d,          // if-ge v3, v6, +13
+    0x04dd, 0x3f03,          // and-int/lit8 v4, v3, 63
+    0x0544, 0x0401,          // aget v5, v1, v4
+    0x35b0,                  // add-int/2addr v5, v3
+    0x054b, 0x0402,          // aput v5, v2, v4
+    0x50b0,                  // add-int/2addr v0, v5
+    0x03d8, 0x0103,          // add-int/lit8 v3, v3, 1
+    0xf428,                  // goto -12
+    0x000f,                  // return v0
+};
+
+static const uint16_t art_bench_copy_native_insns[] = {
+    0x0013, 0x0040,                           // const/16 v0, 64
+    0x0123, TYPE_INT_ARRAY,                   // new-array v1, v0, TYPE_INT_ARRAY
+    0x0223, TYPE_INT_ARRAY,                   // new-array v2, v0, TYPE_INT_ARRAY
+    0x0312,                                   // const/4 v3, 0
+    0x0335, 0x0007,                           // if-ge v3, v0, +7
+    0x034b, 0x0301,                           // aput v3, v1, v3
+    0x03d8, 0x0103,                           // add-int/lit8 v3, v3, 1
+    0xfa28,                                   // goto -6
+    0x0412,                                   // const/4 v4, 0
+    0x0312,                                   // const/4 v3, 0
+    0x0512,                                   // const/4 v5, 0
+    0x7335, 0x000d,                           // if-ge v3, v7, +13
+    0x5071, METHOD_SYSTEM_ARRAYCOPY, 0x5251,  // invoke-static {v1, v5, v2, v5, v0}, METHOD_SYSTEM_ARRAYCOPY
+    0x06dd, 0x3f03,                           // and-int/lit8 v6, v3, 63
+    0x0644, 0x0602,                           // aget v6, v2, v6
+    0x64b0,                                   // add-int/2addr v4, v6
+    0x03d8, 0x0103,                           // add-int/lit8 v3, v3, 1
+    0xf428,                                   // goto -12
+    0x040f,                                   // return v4
+};
+
+static const uint16_t art_bench_fib_insns[] = {
+    0x2012,                            // const/4 v0, 2
+    0x0235, 0x0003,                    // if-ge v2, v0, +3
+    0x020f,                            // return v2
+    0x00d8, 0xff02,                    // add-int/lit8 v0, v2, -1
+    0x1071, METHOD_BENCH_FIB, 0x0000,  // invoke-static {v0}, METHOD_BENCH_FIB
+    0x000a,                            // move-result v0
+    0x01d8, 0xfe02,                    // add-int/lit8 v1, v2, -2
+    0x1071, METHOD_BENCH_FIB, 0x0001,  // invoke-static {v1}, METHOD_BENCH_FIB
+    0x010a,                            // move-result v1
+    0x10b0,                            // add-int/2addr v0, v1
+    0x000f,                            // return v0
+};
+
+static const uint16_t art_bench_alloc_insns[] = {
+    0x0012,                             // const/4 v0, 0
+    0x0112,                             // const/4 v1, 0
+    0x4135, 0x000d,                     // if-ge v1, v4, +13
+    0x0222, TYPE_POINT,                 // new-instance v2, TYPE_POINT
+    0x3070, METHOD_POINT_INIT, 0x0112,  // invoke-direct {v2, v1, v1}, METHOD_POINT_INIT
+    0x2352, FIELD_POINT_X,              // iget v3, v2, FIELD_POINT_X
+    0x30b0,                             // add-int/2addr v0, v3
+    0x01d8, 0x0101,                     // add-int/lit8 v1, v1, 1
+    0xf428,                             // goto -12
+    0x000f,                             // return v0
+};
+
+// Gövde tanımı: yazmaç, parametre ve çıkış yazmacı sayıları
+typedef struct {
+    uint16_t registers_size;
+    uint16_t ins_size;
+    uint16_t outs_size;
+    const uint16_t* insns;
+    uint32_t insns_size;
+} art_bench_code_t;
+
+#define ART_BENCH_CODE(registers, ins, outs, name) \
+    { registers, ins, outs, art_bench_##name##_insns, sizeof(art_bench_##name##_insns) / sizeof(uint16_t) }
+
+static const art_bench_code_t art_bench_object_init = ART_BENCH_CODE(1, 1, 0, object_init);
+static const art_bench_code_t art_bench_shape_init = ART_BENCH_CODE(1, 1, 1, shape_init);
+static const art_bench_code_t art_bench_square_init = ART_BENCH_CODE(2, 2, 1, square_init);
+static const art_bench_code_t art_bench_square_area = ART_BENCH_CODE(2, 1, 0, square_area);
+static const art_bench_code_t art_bench_circle_init = ART_BENCH_CODE(2, 2, 1, circle_init);
+static const art_bench_code_t art_bench_circle_area = ART_BENCH_CODE(2, 1, 0, circle_area);
+static const art_bench_code_t art_bench_point_init = ART_BENCH_CODE(3, 3, 1, point_init);
+static const art_bench_code_t art_bench_loop = ART_BENCH_CODE(4, 1, 0, loop);
+static const art_bench_code_t art_bench_fields = ART_BENCH_CODE(5, 1, 3, fields);
+static const art_bench_code_t art_bench_virtual_mono = ART_BENCH_CODE(5, 1, 2, virtual_mono);
+static const art_bench_code_t art_bench_virtual_poly = ART_BENCH_CODE(6, 1, 2, virtual_poly);
+static const art_bench_code_t art_bench_copy_loop = ART_BENCH_CODE(7, 1, 0, copy_loop);
+static const art_bench_code_t art_bench_copy_native = ART_BENCH_CODE(8, 1, 5, copy_native);
+static const art_bench_code_t art_bench_fib = ART_BENCH_CODE(3, 1, 1, fib);
+static const art_bench_code_t art_bench_alloc = ART_BENCH_CODE(5, 1, 3, alloc);
+
+// class_data girdisi; listeler dizine göre sıralıdır
+typedef struct {
+    uint32_t idx;
+    uint32_t access_flags;
+    const art_bench_code_t* code;
+} art_bench_member_t;
+
+typedef struct {
+    uint32_t type;
+    uint32_t superclass;
+    uint32_t access_flags;
+    uint32_t counts[4];             // Statik alan, örnek alanı, doğrudan ve sanal metot
+    art_bench_member_t members[8];
+} art_bench_class_t;
+
+#define ACC_PUBLIC_STATIC          (DEX_ACC_PUBLIC | DEX_ACC_STATIC)
+#define ACC_CONSTRUCTOR            (DEX_ACC_PUBLIC | DEX_ACC_CONSTRUCTOR)
+
+// Üst sınıflar önce gelir
+static const art_bench_class_t art_bench_classes[] = {
+    { TYPE_OBJECT, DEX_NO_INDEX, DEX_ACC_PUBLIC, { 0, 0, 1, 0 }, {
+        { METHOD_OBJECT_INIT, ACC_CONSTRUCTOR, &art_bench_object_init } } },
+    { TYPE_SYSTEM, TYPE_OBJECT, DEX_ACC_PUBLIC | DEX_ACC_FINAL, { 0, 0, 1, 0 }, {
+        { METHOD_SYSTEM_ARRAYCOPY, ACC_PUBLIC_STATIC | DEX_ACC_NATIVE, NULL } } },
+    { TYPE_SHAPE, TYPE_OBJECT, DEX_ACC_PUBLIC | DEX_ACC_ABSTRACT, { 0, 0, 1, 1 }, {
+        { METHOD_SHAPE_INIT, ACC_CONSTRUCTOR, &art_bench_shape_init },
+        { METHOD_SHAPE_AREA, DEX_ACC_PUBLIC | DEX_ACC_ABSTRACT, NULL } } },
+    { TYPE_SQUARE, TYPE_SHAPE, DEX_ACC_PUBLIC, { 0, 1, 1, 1 }, {
+        { FIELD_SQUARE_SIDE, DEX_ACC_PRIVATE, NULL },
+        { METHOD_SQUARE_INIT, ACC_CONSTRUCTOR, &art_bench_square_init },
+        { METHOD_SQUARE_AREA, DEX_ACC_PUBLIC, &art_bench_square_area } } },
+    { TYPE_CIRCLE, TYPE_SHAPE, DEX_ACC_PUBLIC, { 0, 1, 1, 1 }, {
+        { FIELD_CIRCLE_RADIUS, DEX_ACC_PRIVATE, NULL },
+        { METHOD_CIRCLE_INIT, ACC_CONSTRUCTOR, &art_bench_circle_init },
+        { METHOD_CIRCLE_AREA, DEX_ACC_PUBLIC, &art_bench_circle_area } } },
+    { TYPE_POINT, TYPE_OBJECT, DEX_ACC_PUBLIC | DEX_ACC_FINAL, { 0, 2, 1, 0 }, {
+        { FIELD_POINT_X, DEX_ACC_PUBLIC, NULL },
+        { FIELD_POINT_Y, DEX_ACC_PUBLIC, NULL },
+        { METHOD_POINT_INIT, ACC_CONSTRUCTOR, &art_bench_point_init } } },
+    { TYPE_BENCH, TYPE_OBJECT, DEX_ACC_PUBLIC | DEX_ACC_FINAL, { 0, 0, 8, 0 }, {
+        { METHOD_BENCH_ALLOC, ACC_PUBLIC_STATIC, &art_bench_alloc },
+        { METHOD_BENCH_COPY_LOOP, ACC_PUBLIC_STATIC, &art_bench_copy_loop },
+        { METHOD_BENCH_COPY_NATIVE, ACC_PUBLIC_STATIC, &art_bench_copy_native },
+        { METHOD_BENCH_FIB, ACC_PUBLIC_STATIC, &art_bench_fib },
+        { METHOD_BENCH_FIELDS, ACC_PUBLIC_STATIC, &art_bench_fields },
+        { METHOD_BENCH_LOOP, ACC_PUBLIC_STATIC, &art_bench_loop },
+        { METHOD_BENCH_VIRTUAL_MONO, ACC_PUBLIC_STATIC, &art_bench_virtual_mono },
+        { METHOD_BENCH_VIRTUAL_POLY, ACC_PUBLIC_STATIC, &art_bench_virtual_poly } } }
+};
+
+#define ART_BENCH_CLASS_COUNT      (sizeof(art_bench_classes) / sizeof(art_bench_classes[0]))
+#define ART_BENCH_DEX_CAPACITY     8192
+
+// İş yükleri: metot, işlem birimi, parametre başına işlem ve beklenen sonuç
+typedef struct {
+    const char* name;
+    const char* method;
+    const char* unit;
+    uint32_t ops_per_unit;          // n başına işlem (fib'de kullanılmaz)
+    uint32_t (*expected)(uint32_t n);
+} art_bench_workload_t;
+
+// Yazma imleci
+typedef struct {
+    uint8_t* data;
+    uint32_t size;
+    int overflow;
+} art_bench_writer_t;
+
+static dex_file_t* art_bench_dex = NULL;
+
+// Yardımcı fonksiyonlar
+static int art_bench_build_dex(dex_file_t** dex);
+static uint32_t art_bench_put(art_bench_writer_t* writer, const void* data, uint32_t size);
+static void art_bench_put_u32(art_bench_writer_t* writer, uint32_t value);
+static void art_bench_put_uleb128(art_bench_writer_t* writer, uint32_t value);
+static void art_bench_align(art_bench_writer_t* writer);
+static double art_bench_now(void);
+static uint32_t art_bench_fib_calls(uint32_t n);
+static uint32_t art_bench_expect_loop(uint32_t n);
+static uint32_t art_bench_expect_fields(uint32_t n);
+static uint32_t art_bench_expect_virtual_mono(uint32_t n);
+static uint32_t art_bench_expect_virtual_poly(uint32_t n);
+static uint32_t art_bench_expect_copy_loop(uint32_t n);
+static uint32_t art_bench_expect_copy_native(uint32_t n);
+static uint32_t art_bench_expect_fib(uint32_t n);
+static uint32_t art_bench_expect_alloc(uint32_t n);
+
+static const art_bench_workload_t art_bench_workloads[ART_BENCH_WORKLOADS] = {
+    { "loop",             "loop",        "iterasyon", 1,  art_bench_expect_loop },
+    { "fields",           "fields",      "erişim",    4,  art_bench_expect_fields },
+    { "virtual-mono",     "virtualMono", "çağrı",     1,  art_bench_expect_virtual_mono },
+    { "virtual-poly",     "virtualPoly", "çağrı",     1,  art_bench_expect_virtual_poly },
+    { "array-copy",       "copyLoop",    "eleman",    1,  art_bench_expect_copy_loop },
+    { "arraycopy-native", "copyNative",  "eleman",    64, art_bench_expect_copy_native },
+    { "fib",              "fib",         "çağrı",     0,  art_bench_expect_fib },
+    { "alloc",            "alloc",       "nesne",     1,  art_bench_expect_alloc }
+};
+
+// İş yüklerini çalıştır
+int art_bench_run(double min_seconds, art_bench_result_t* results, uint32_t max_results, uint32_t* count) {
+    if (!results || !count || min_seconds <= 0) {
+        return ART_BENCH_ERROR_INVALID;
+    }
+    
+    if (!art_bench_dex && art_bench_build_dex(&art_bench_dex) != 0) {
+        return ART_BENCH_ERROR_DEX;
+    }
+    
+    dex_class_t* dex_class;
+    art_class_t* klass;
+    if (dex_find_class(art_bench_dex, "LBench;", &dex_class) != 0) {
+        return ART_BENCH_ERROR_DEX;
+    }
+    
+    int status = art_interp_get_class(dex_class, &klass);
+    if (status == ART_INTERP_ERROR_STATE) {
+        return ART_BENCH_ERROR_STATE;
+    }
+    if (status != 0) {
+        return ART_BENCH_ERROR_DEX;
+    }
+    
+    *count = 0;
+    for (uint32_t i = 0; i < ART_BENCH_WORKLOADS && *count < max_results; i++) {
+        const art_bench_workload_t* workload = &art_bench_workloads[i];
+        art_bench_result_t* result = &results[(*count)++];
+        art_method_t* method;
+        
+        memset(result, 0, sizeof(art_bench_result_t));
+        result->name = workload->name;
+        result->unit = workload->unit;
+        
+        if (art_interp_find_method(klass, workload->method, "(I)I", &method) != 0) {
+            continue;
+        }
+        
+        // fib'de n özyineleme derinliğidir: her adım işi yaklaşık 1.6 katına çıkarır
+        int is_fib = workload->ops_per_unit == 0;
+        uint32_t n = is_fib ? 10 : 1024;
+        
+        for (;;) {
+            art_value_t argument;
+            art_value_t value;
+            argument.i = (int32_t)n;
+            
+            double start = art_bench_now();
+            status = art_interp_invoke(method, &argument, 1, &value);
+            double elapsed = art_bench_now() - start;
+            
+            if (status != 0) {
+                break;
+            }
+            
+            result->ops = is_fib ? art_bench_fib_calls(n) : (uint64_t)n * workload->ops_per_unit;
+            result->seconds = elapsed;
+            result->ops_per_second = elapsed > 0 ? result->ops / elapsed : 0;
+            result->verified = (uint32_t)value.i == workload->expected(n);
+            
+            if (elapsed >= min_seconds || !result->verified || (is_fib ? n >= 40 : n >= (1u << 30))) {
+                break;
+            }
+            
+            // Süre hedefinin biraz üstüne çıkacak kadar büyüt
+            if (is_fib) {
+                n++;
+            } else {
+                double scale = elapsed > 0 ? min_seconds * 1.2 / elapsed : 16;
+                n = scale > 16 ? n * 16 : (uint32_t)(n * (scale > 2 ? scale : 2));
+            }
+        }
+    }
+    
+    return 0;
+}
+
+// Sonuçları yazdır
+void art_bench_print(const art_bench_result_t* results, uint32_t count) {
+    if (!results) {
+        return;
+    }
+    
+    printf("%-18s %14s %10s %16s  %s\n", "iş yükü", "işlem", "süre (s)", "işlem/s", "doğrulama");
+    for (uint32_t i = 0; i < count; i++) {
+        const art_bench_result_t* result = &results[i];
+        printf("%-18s %14llu %10.3f %16.0f  %s (%s)\n", result->name, (unsigned long long)result->ops,
+               result->seconds, result->ops_per_second, result->verified ? "tamam" : "HATALI", result->unit);
+    }
+}
+
+// Ölçüm DEX'ini al
+int art_bench_get_dex(dex_file_t** dex) {
+    if (!dex) {
+        return ART_BENCH_ERROR_INVALID;
+    }
+    
+    if (!art_bench_dex && art_bench_build_dex(&art_bench_dex) != 0) {
+        return ART_BENCH_ERROR_DEX;
+    }
+    
+    *dex = art_bench_dex;
+    
+    return 0;
+}
+
+// DEX'i bellekte kur: başlık, tanımlayıcı tabloları, ardından veri bölümü
+// (dizgiler, tip listeleri, kod ve class_data)
+static int art_bench_build_dex(dex_file_t** dex) {
+    uint8_t* buffer = (uint8_t*)calloc(1, ART_BENCH_DEX_CAPACITY);
+    if (!buffer) {
+        return -1;
+    }
+    
+    art_bench_writer_t writer = { buffer, DEX_HEADER_SIZE, 0 };
+    dex_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, "dex\n035", 8);
+    header.header_size = DEX_HEADER_SIZE;
+    header.endian_tag = DEX_ENDIAN_CONSTANT;
+    
+    header.string_ids_size = STR_COUNT;
+    header.string_ids_off = writer.size;
+    writer.size += STR_COUNT * 4;
+    
+    header.type_ids_size = TYPE_COUNT;
+    header.type_ids_off = art_bench_put(&writer, art_bench_types, sizeof(art_bench_types));
+    
+    header.proto_ids_size = PROTO_COUNT;
+    header.proto_ids_off = writer.size;
+    writer.size += PROTO_COUNT * 12;
+    
+    header.field_ids_size = FIELD_COUNT;
+    header.field_ids_off = art_bench_put(&writer, art_bench_field_ids, sizeof(art_bench_field_ids));
+    
+    header.method_ids_size = METHOD_COUNT;
+    header.method_ids_off = art_bench_put(&writer, art_bench_method_ids, sizeof(art_bench_method_ids));
+    
+    header.class_defs_size = ART_BENCH_CLASS_COUNT;
+    header.class_defs_off = writer.size;
+    writer.size += ART_BENCH_CLASS_COUNT * 32;
+    
+    header.data_off = writer.size;
+    
+    // Dizgiler: UTF-16 uzunluğu ve MUTF-8 içerik (hepsi ASCII)
+    for (uint32_t i = 0; i < STR_COUNT; i++) {
+        uint32_t length = (uint32_t)strlen(art_bench_strings[i]);
+        uint32_t offset = writer.size;
+        art_bench_put_uleb128(&writer, length);
+        art_bench_put(&writer, art_bench_strings[i], length + 1);
+        memcpy(buffer + header.string_ids_off + i * 4, &offset, 4);
+    }
+    
+    // Prototipler ve parametre listeleri
+    for (uint32_t i = 0; i < PROTO_COUNT; i++) {
+        const art_bench_proto_t* proto = &art_bench_protos[i];
+        uint32_t entry[3] = { proto->shorty, proto->return_type, 0 };
+        
+        if (proto->parameter_count > 0) {
+            art_bench_align(&writer);
+            entry[2] = writer.size;
+            art_bench_put_u32(&writer, proto->parameter_count);
+            art_bench_put(&writer, proto->parameters, proto->parameter_count * sizeof(uint16_t));
+        }
+        memcpy(buffer + header.proto_ids_off + i * 12, entry, sizeof(entry));
+    }
+    
+    // Sınıflar: gövdeler ve class_data
+    for (uint32_t i = 0; i < ART_BENCH_CLASS_COUNT; i++) {
+        const art_bench_class_t* klass = &art_bench_classes[i];
+        uint32_t member_count = klass->counts[0] + klass->counts[1] + klass->counts[2] + klass->counts[3];
+        uint32_t code_offsets[8] = { 0 };
+        
+        for (uint32_t m = 0; m < member_count; m++) {
+            const art_bench_code_t* code = klass->members[m].code;
+            if (!code) {
+                continue;
+            }
+            
+            uint16_t code_header[4] = { code->registers_size, code->ins_size, code->outs_size, 0 };
+            art_bench_align(&writer);
+            code_offsets[m] = writer.size;
+            art_bench_put(&writer, code_header, sizeof(code_header));
+            art_bench_put_u32(&writer, 0);
+            art_bench_put_u32(&writer, code->insns_size);
+            art_bench_put(&writer, code->insns, code->insns_size * sizeof(uint16_t));
+        }
+        
+        uint32_t class_data_off = writer.size;
+        for (int list = 0; list < 4; list++) {
+            art_bench_put_uleb128(&writer, klass->counts[list]);
+        }
+        
+        uint32_t m = 0;
+        for (int list = 0; list < 4; list++) {
+            uint32_t previous = 0;
+            for (uint32_t k = 0; k < klass->counts[list]; k++, m++) {
+                art_bench_put_uleb128(&writer, klass->members[m].idx - previous);
+                art_bench_put_uleb128(&writer, klass->members[m].access_flags);
+                if (list >= 2) {
+                    art_bench_put_uleb128(&writer, code_offsets[m]);
+                }
+                previous = klass->members[m].idx;
+            }
+        }
+        
+        uint32_t class_def[8] = {
+            klass->type, klass->access_flags, klass->superclass, 0,
+            DEX_NO_INDEX, 0, class_data_off, 0
+        };
+        memcpy(buffer + header.class_defs_off + i * 32, class_def, sizeof(class_def));
+    }
+    
+    art_bench_align(&writer);
+    header.data_size = writer.size - header.data_off;
+    header.file_size = writer.size;
+    memcpy(buffer, &header, sizeof(header));
+    
+    // Adler-32 (imza alanı boş kalır)
+    uint32_t a = 1;
+    uint32_t b = 0;
+    for (uint32_t i = 12; i < writer.size; i++) {
+        a = (a + buffer[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    uint32_t checksum = (b << 16) | a;
+    memcpy(buffer + 8, &checksum, 4);
+    
+    int result = writer.overflow ? -1 : dex_open_memory(buffer, writer.size, dex);
+    free(buffer);
+    
+    return result;
+}
+
+// Veriyi ekle; yazıldığı ofseti döndür
+static uint32_t art_bench_put(art_bench_writer_t* writer, const void* data, uint32_t size) {
+    uint32_t offset = writer->size;
+    
+    if (writer->size + size > ART_BENCH_DEX_CAPACITY) {
+        writer->overflow = 1;
+        return offset;
+    }
+    
+    memcpy(writer->data + writer->size, data, size);
+    writer->size += size;
+    
+    return offset;
+}
+
+static void art_bench_put_u32(art_bench_writer_t* writer, uint32_t value) {
+    art_bench_put(writer, &value, sizeof(value));
+}
+
+static void art_bench_put_uleb128(art_bench_writer_t* writer, uint32_t value) {
+    do {
+        uint8_t byte = value & 0x7F;
+        value >>= 7;
+        if (value) {
+            byte |= 0x80;
+        }
+        art_bench_put(writer, &byte, 1);
+    } while (value);
+}
+
+// 4 bayt hizala (tip listeleri ve kod gövdeleri)
+static void art_bench_align(art_bench_writer_t* writer) {
+    static const uint8_t zeros[4] = { 0 };
+    art_bench_put(writer, zeros, (4 - (writer->size & 3)) & 3);
+}
+
+static double art_bench_now(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+// fib(n) özyinelemesindeki çağrı sayısı: 2 * fib(n + 1) - 1
+static uint32_t art_bench_fib_calls(uint32_t n) {
+    return 2 * art_bench_expect_fib(n + 1) - 1;
+}
+
+// Beklenen sonuçlar (Java int aritmetiği: 32 bit sarmalı)
+static uint32_t art_bench_expect_loop(uint32_t n) {
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        sum += (i * i) ^ i;
+    }
+    return sum;
+}
+
+static uint32_t art_bench_expect_fields(uint32_t n) {
+    uint32_t x = 0;
+    uint32_t y = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        x += i;
+        y ^= x;
+    }
+    return x + y;
+}
+
+static uint32_t art_bench_expect_virtual_mono(uint32_t n) {
+    return 9 * n;
+}
+
+static uint32_t art_bench_expect_virtual_poly(uint32_t n) {
+    return 9 * ((n + 1) / 2) + 12 * (n / 2);
+}
+
+static uint32_t art_bench_expect_copy_loop(uint32_t n) {
+    uint32_t sum = 0;
+    for (uint32_t k = 0; k < n; k++) {
+        sum += (k & 63) + k;
+    }
+    return sum;
+}
+
+static uint32_t art_bench_expect_copy_native(uint32_t n) {
+    uint32_t sum = 0;
+    for (uint32_t k = 0; k < n; k++) {
+        sum += k & 63;
+    }
+    return sum;
+}
+
+static uint32_t art_bench_expect_fib(uint32_t n) {
+    uint32_t a = 0;
+    uint32_t b = 1;
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t next = a + b;
+        a = b;
+        b = next;
+    }
+    return a;
+}
+
+static uint32_t art_bench_expect_alloc(uint32_t n) {
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        sum += i;
+    }
+    return sum;
+}
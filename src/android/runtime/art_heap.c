@@ -0,0 +1,1881 @@
+#include "../../include/android/art_heap.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+// Nesne bayrakları
+#define ART_OBJECT_FORWARDED       0x01    // Taşındı; klass yeni adresi tutar
+#define ART_OBJECT_REMEMBERED      0x02    // Eski nesne genç nesneye referans tutuyor
+#define ART_OBJECT_FREE            0x04    // Eski nesilde boş blok
+
+#define ART_HEAP_ALIGN             16
+#define ART_HEAP_MIN_BLOCK         32      // Boş blok başlığı + liste bağlantıları
+#define ART_HEAP_SMALL_CLASSES     128     // 2 KB altı: 16 baytlık tam sınıflar
+#define ART_HEAP_LARGE_BINS        20      // 2 KB ve üstü: 2'nin kuvveti aralıkları
+#define ART_HEAP_SIZE_CLASSES      (ART_HEAP_SMALL_CLASSES + ART_HEAP_LARGE_BINS)
+#define ART_HEAP_BIN_SCAN          8       // Aynı aralıkta denenecek en fazla blok
+#define ART_HEAP_MAX_CHUNK         (1u << 30)
+#define ART_HEAP_SATB_BUFFER       256     // İş parçacığı başına bariyer tamponu
+#define ART_HEAP_MARK_BATCH        512     // Güvenli nokta yoklamaları arası işaretlenen nesne
+#define ART_HEAP_SWEEP_STEP        (256 * 1024)  // Kilit bırakılmadan süpürülen bayt
+#define ART_HEAP_PAUSE_HISTORY     1024
+#define ART_HEAP_PLAB_SIZE         (64 * 1024)  // Taşıma tamponu; kilit her nesne için alınmaz
+#define ART_HEAP_NURSERY_MIN       (1024 * 1024)
+#define ART_HEAP_CARD_SHIFT        9       // 512 baytlık kartlar
+#define ART_HEAP_CARD_REFS         64      // Bu sayıdan fazla yuvası olan nesnelerde kart izlenir
+#define ART_HEAP_PAUSE_TARGET_NS   1500000ull   // Küçük toplama duraklama hedefi
+#define ART_HEAP_CPU_CHECK         4096    // CPU ücretlendirmesi arası güvenli nokta (2'nin kuvveti)
+
+#define ART_HEAP_PAGES(bytes)      (((bytes) + RESOURCE_PAGE_SIZE - 1) / RESOURCE_PAGE_SIZE)
+
+// Eski nesil toplama aşamaları
+#define ART_GC_PHASE_IDLE          0
+#define ART_GC_PHASE_MARKING       1
+#define ART_GC_PHASE_SWEEPING      2
+
+// Derlenmiş kodun ve güvenli noktaların yokladığı istek bitleri
+#define ART_HEAP_POLL_SUSPEND      0x01    // Dünyayı durdurma
+#define ART_HEAP_POLL_FREEZE       0x02    // Konteyner dondurma
+
+// Eski nesilde boş blok
+typedef struct art_free_chunk {
+    art_object_t header;
+    struct art_free_chunk* prev;
+    struct art_free_chunk* next;
+} art_free_chunk_t;
+
+// Büyüyebilen nesne yığıtı (işaretleme, gri nesneler, hatırlanan küme, SATB kuyruğu)
+typedef struct {
+    art_object_t** items;
+    uint32_t count;
+    uint32_t capacity;
+} art_object_stack_t;
+
+// İş parçacığı durumu
+typedef struct art_heap_thread {
+    uint8_t* tlab_pos;             // TLAB içindeki sonraki boş adres
+    uint8_t* tlab_end;
+    art_object_t* satb[ART_HEAP_SATB_BUFFER];
+    uint32_t satb_count;
+    uint64_t allocated;
+    art_heap_frame_t* frames;      // İş parçacığının kök çerçeveleri
+    container_freezer_t* freezer;  // Kayıtlı olduğu konteyner dondurucusu
+    container_resource_t* resources;  // Bağlamada başka iş parçacığı yazar (atomik)
+    resource_cpu_slice_t cpu_slice;  // last_cpu_us = 0: dilim henüz başlamadı
+    uint32_t safepoints;           // Yalnızca sahibi sayar
+    uint8_t blocked;               // Bloklayan çağrıda (lock altında)
+    struct art_heap_thread* next;
+} art_heap_thread_t;
+
+typedef struct {
+    art_gc_mode_t mode;
+    uint8_t* base;
+    size_t size;
+    uint8_t* nursery_start;
+    uint8_t* nursery_end;
+    uint8_t* nursery_top;          // Sonraki TLAB (atomik)
+    uint8_t* nursery_limit;        // Duraklama hedefine göre ayarlanan kullanılabilir sınır
+    uint8_t* old_start;
+    uint8_t* old_end;
+    uint8_t* cards;                // Büyük referans dizilerinde kirli yuva kartları
+    
+    // Dünyayı durdurma
+    pthread_mutex_t lock;
+    pthread_cond_t parked_cond;    // Durdurma isteğini yapan bekler
+    pthread_cond_t resume_cond;    // Durdurulan iş parçacıkları bekler
+    int suspend;                   // Durdurma isteği (atomik)
+    int poll;                      // ART_HEAP_POLL_* (atomik)
+    uint32_t threads;              // Bağlı iş parçacığı sayısı
+    uint32_t stopped;              // Güvenli noktada ya da bloklu olanlar
+    art_heap_thread_t* thread_list;
+    art_object_t*** roots;
+    uint32_t root_count;
+    uint32_t root_capacity;
+    
+    // Konteyner bağlantısı; iş parçacıkları kayıtlarını okuma kilidi altında
+    // değiştirir, bağlama ve çözme yazma kilidiyle tüm listeyi günceller
+    pthread_rwlock_t bind_lock;
+    container_freezer_t* freezer;
+    container_checkpoint_t* checkpoint;
+    
+    // Sayfa ücreti: kullanım bayt olarak izlenir, sayfa sınırı geçildikçe
+    // ücretlendirilir. resources bu kilitle de korunur.
+    pthread_mutex_t charge_lock;
+    container_resource_t* resources;
+    uint64_t charged_bytes;
+    uint64_t promoted_blocks;      // Küçük toplamada eski nesle eklenen bloklar
+    uint64_t sweep_dead;           // Bu süpürmede ölen bloklar
+    
+    // Eski nesil boş listeleri
+    pthread_mutex_t old_lock;
+    art_free_chunk_t* free_lists[ART_HEAP_SIZE_CLASSES];
+    uint64_t free_bitmap[(ART_HEAP_SIZE_CLASSES + 63) / 64];
+    uint64_t old_free;
+    
+    // İşaretleme ve süpürme
+    int phase;                     // ART_GC_PHASE_* (atomik)
+    uint8_t epoch;                 // Bu dönemde işaretli nesnelerin mark değeri
+    art_object_stack_t mark_stack;
+    art_object_stack_t gray;       // Küçük toplamada taranacak taşınmış nesneler
+    uint8_t* plab_pos;             // Küçük toplamada taşıma tamponu
+    uint8_t* plab_end;
+    pthread_mutex_t satb_lock;
+    art_object_stack_t satb_queue;
+    pthread_mutex_t remember_lock;
+    art_object_stack_t remembered;
+    uint8_t* sweep_cursor;
+    uint8_t* sweep_run;            // Birleştirilmekte olan ölü/boş blok dizisi
+    uint64_t sweep_free;           // Bu süpürmede listelere dönen bayt
+    uint64_t sweep_small;          // Bunun büyük nesne sınırından küçük parçalardaki kısmı
+    
+    // Arka plan toplayıcı
+    pthread_t collector;
+    pid_t collector_pid;           // Toplayıcıyı başlatan süreç (fork sonrası yeniden başlatılır)
+    uint8_t collector_running;
+    uint8_t shutdown;
+    uint8_t cycle_requested;
+    uint8_t cycle_active;          // Toplayıcı bir döngünün içinde
+    uint64_t cycles_done;
+    pthread_mutex_t cycle_lock;    // Bir döngü boyunca tutulur
+    pthread_cond_t collector_cond;
+    pthread_cond_t cycle_cond;
+    
+    // İstatistikler
+    uint64_t start_ns;
+    uint64_t pause_start_ns;
+    uint64_t pause_total_ns;
+    uint64_t pause_max_ns;
+    uint32_t pause_history[ART_HEAP_PAUSE_HISTORY];  // Mikrosaniye
+    uint32_t pause_count;
+    uint32_t minor_count;
+    uint32_t major_count;
+    uint64_t promoted_bytes;
+    uint64_t freed_bytes;
+    uint64_t detached_allocated;
+    float fragmentation;
+} art_heap_t;
+
+static art_heap_t* art_heap = NULL;
+static __thread art_heap_thread_t* art_heap_self = NULL;
+static uint8_t art_heap_atfork_registered = 0;
+
+// Yardımcı fonksiyonlar
+static uint64_t art_heap_now_ns(void);
+static int art_heap_is_young(art_heap_t* heap, const void* address);
+static void art_heap_stack_push(art_object_stack_t* stack, art_object_t* object);
+static int art_heap_stop_world(art_heap_t* heap);
+static void art_heap_resume_world(art_heap_t* heap);
+static void art_heap_park(art_heap_t* heap);
+static void art_heap_poll(art_heap_t* heap);
+static void art_heap_freeze_notify(void* context, int state);
+static void art_heap_cpu_checkpoint(art_heap_t* heap, art_heap_thread_t* self);
+static int art_heap_charge(art_heap_t* heap, uint64_t bytes);
+static void art_heap_uncharge(art_heap_t* heap, uint64_t bytes);
+static void art_heap_wait_resume(art_heap_t* heap);
+static uint32_t art_heap_size_class(uint32_t size);
+static void art_heap_free_insert(art_heap_t* heap, uint8_t* start, size_t size);
+static void art_heap_free_unlink(art_heap_t* heap, art_free_chunk_t* chunk);
+static art_object_t* art_heap_old_alloc(art_heap_t* heap, uint32_t size);
+static int art_heap_refill(art_heap_t* heap, art_heap_thread_t* self);
+static art_object_t* art_heap_alloc_large(art_heap_t* heap, art_heap_thread_t* self, uint32_t size);
+static art_object_t* art_heap_evacuate(art_heap_t* heap, art_object_t* object);
+static art_object_t* art_heap_promote_alloc(art_heap_t* heap, uint32_t size);
+static void art_heap_plab_retire(art_heap_t* heap);
+static int art_heap_minor_locked(art_heap_t* heap);
+static void art_heap_full_locked(art_heap_t* heap);
+static void art_heap_mark_push(art_heap_t* heap, art_object_t* object, int through_young);
+static void art_heap_mark_roots(art_heap_t* heap, int through_young);
+static void art_heap_evacuate_roots(art_heap_t* heap);
+static uint32_t art_heap_mark_drain(art_heap_t* heap, uint32_t budget, int through_young);
+static void art_heap_mark_satb(art_heap_t* heap, int all_threads);
+static void art_heap_satb_flush(art_heap_t* heap, art_heap_thread_t* thread);
+static int art_heap_sweep_step(art_heap_t* heap, size_t budget);
+static void art_heap_sweep_flush(art_heap_t* heap, uint8_t* end);
+static void art_heap_sweep_finish(art_heap_t* heap);
+static void art_heap_request_cycle(art_heap_t* heap);
+static void art_heap_next_epoch(art_heap_t* heap);
+static void art_heap_concurrent_cycle(art_heap_t* heap);
+static void* art_heap_collector_main(void* argument);
+static void art_heap_atfork_prepare(void);
+static void art_heap_atfork_parent(void);
+static void art_heap_atfork_child(void);
+
+// Yığını oluştur: 1/8'i genç nesil (en fazla ART_HEAP_NURSERY_MAX), kalanı eski nesil
+int art_heap_create(size_t heap_size, art_gc_mode_t mode) {
+    if (art_heap) {
+        return ART_HEAP_ERROR_STATE;
+    }
+    
+    if (heap_size < 16 * ART_HEAP_TLAB_SIZE) {
+        return ART_HEAP_ERROR_INVALID;
+    }
+    
+    art_heap_t* heap = (art_heap_t*)calloc(1, sizeof(art_heap_t));
+    if (!heap) {
+        return ART_HEAP_ERROR_NO_MEMORY;
+    }
+    
+    heap_size &= ~((size_t)ART_HEAP_TLAB_SIZE - 1);
+    size_t nursery_size = heap_size / 8;
+    if (nursery_size > ART_HEAP_NURSERY_MAX) {
+        nursery_size = ART_HEAP_NURSERY_MAX;
+    }
+    nursery_size &= ~((size_t)ART_HEAP_TLAB_SIZE - 1);
+    
+    // Sayfalar ilk dokunuşta ayrılır; ayrılmış ama kullanılmamış yığın bellek tutmaz
+    heap->base = (uint8_t*)mmap(NULL, heap_size, PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (heap->base == MAP_FAILED) {
+        free(heap);
+        return ART_HEAP_ERROR_NO_MEMORY;
+    }
+    
+    heap->mode = mode;
+    heap->size = heap_size;
+    heap->nursery_start = heap->base;
+    heap->nursery_end = heap->base + nursery_size;
+    heap->nursery_top = heap->nursery_start;
+    heap->nursery_limit = heap->nursery_end;
+    heap->old_start = heap->nursery_end;
+    heap->old_end = heap->base + heap_size;
+    heap->phase = ART_GC_PHASE_IDLE;
+    heap->epoch = 1;
+    heap->start_ns = art_heap_now_ns();
+    
+    pthread_mutex_init(&heap->lock, NULL);
+    pthread_rwlock_init(&heap->bind_lock, NULL);
+    pthread_mutex_init(&heap->charge_lock, NULL);
+    pthread_cond_init(&heap->parked_cond, NULL);
+    pthread_cond_init(&heap->resume_cond, NULL);
+    pthread_mutex_init(&heap->old_lock, NULL);
+    pthread_mutex_init(&heap->satb_lock, NULL);
+    pthread_mutex_init(&heap->remember_lock, NULL);
+    pthread_mutex_init(&heap->cycle_lock, NULL);
+    pthread_cond_init(&heap->collector_cond, NULL);
+    pthread_cond_init(&heap->cycle_cond, NULL);
+    
+    heap->cards = (uint8_t*)calloc(((size_t)(heap->old_end - heap->old_start) >> ART_HEAP_CARD_SHIFT) + 1, 1);
+    if (!heap->cards) {
+        munmap(heap->base, heap_size);
+        free(heap);
+        return ART_HEAP_ERROR_NO_MEMORY;
+    }
+    
+    art_heap_free_insert(heap, heap->old_start, (size_t)(heap->old_end - heap->old_start));
+    
+    // Zygote fork'unda kilitler tutarlı kalmalı ve toplayıcı çocukta yeniden başlamalı
+    if (!art_heap_atfork_registered) {
+        pthread_atfork(art_heap_atfork_prepare, art_heap_atfork_parent, art_heap_atfork_child);
+        art_heap_atfork_registered = 1;
+    }
+    
+    art_heap = heap;
+    
+    return 0;
+}
+
+// Yığını yok et; bağlı iş parçacıkları önce ayrılmalıdır
+void art_heap_destroy(void) {
+    art_heap_t* heap = art_heap;
+    if (!heap) {
+        return;
+    }
+    
+    pthread_mutex_lock(&heap->lock);
+    heap->shutdown = 1;
+    pthread_cond_broadcast(&heap->collector_cond);
+    pthread_mutex_unlock(&heap->lock);
+    
+    if (heap->collector_running && heap->collector_pid == getpid()) {
+        pthread_join(heap->collector, NULL);
+    }
+    
+    art_heap = NULL;
+    
+    while (heap->thread_list) {
+        art_heap_thread_t* next = heap->thread_list->next;
+        free(heap->thread_list);
+        heap->thread_list = next;
+    }
+    art_heap_self = NULL;
+    
+    munmap(heap->base, heap->size);
+    free(heap->cards);
+    free(heap->roots);
+    free(heap->mark_stack.items);
+    free(heap->gray.items);
+    free(heap->satb_queue.items);
+    free(heap->remembered.items);
+    
+    pthread_cond_destroy(&heap->cycle_cond);
+    pthread_cond_destroy(&heap->collector_cond);
+    pthread_mutex_destroy(&heap->cycle_lock);
+    pthread_mutex_destroy(&heap->remember_lock);
+    pthread_mutex_destroy(&heap->satb_lock);
+    pthread_mutex_destroy(&heap->old_lock);
+    pthread_cond_destroy(&heap->resume_cond);
+    pthread_cond_destroy(&heap->parked_cond);
+    pthread_rwlock_destroy(&heap->bind_lock);
+    pthread_mutex_destroy(&heap->charge_lock);
+    pthread_mutex_destroy(&heap->lock);
+    free(heap);
+}
+
+// Çağıran iş parçacığını yığına bağla
+int art_heap_attach_thread(void) {
+    art_heap_t* heap = art_heap;
+    if (!heap) {
+        return ART_HEAP_ERROR_STATE;
+    }
+    
+    if (art_heap_self) {
+        return 0;
+    }
+    
+    art_heap_thread_t* thread = (art_heap_thread_t*)calloc(1, sizeof(art_heap_thread_t));
+    if (!thread) {
+        return ART_HEAP_ERROR_NO_MEMORY;
+    }
+    
+    pthread_rwlock_rdlock(&heap->bind_lock);
+    
+    // Donmuş konteynere yeni iş parçacığı girmez; yığına kaydolmadan önce
+    // beklenir ki toplayıcı onu beklemesin
+    if (heap->freezer) {
+        freezer_thread_enter(heap->freezer);
+        thread->freezer = heap->freezer;
+        thread->resources = heap->resources;
+        resource_cpu_slice_begin(&thread->cpu_slice);
+    }
+    
+    pthread_mutex_lock(&heap->lock);
+    while (heap->suspend) {
+        pthread_cond_wait(&heap->resume_cond, &heap->lock);
+    }
+    thread->next = heap->thread_list;
+    heap->thread_list = thread;
+    heap->threads++;
+    pthread_mutex_unlock(&heap->lock);
+    
+    pthread_rwlock_unlock(&heap->bind_lock);
+    
+    art_heap_self = thread;
+    
+    return 0;
+}
+
+// İş parçacığı kaydını kaldır
+void art_heap_detach_thread(void) {
+    art_heap_t* heap = art_heap;
+    art_heap_thread_t* thread = art_heap_self;
+    if (!heap || !thread) {
+        return;
+    }
+    
+    art_heap_satb_flush(heap, thread);
+    
+    pthread_rwlock_rdlock(&heap->bind_lock);
+    pthread_mutex_lock(&heap->lock);
+    art_heap_wait_resume(heap);
+    
+    art_heap_thread_t** link = &heap->thread_list;
+    while (*link && *link != thread) {
+        link = &(*link)->next;
+    }
+    if (*link) {
+        *link = thread->next;
+    }
+    heap->threads--;
+    heap->detached_allocated += thread->allocated;
+    pthread_mutex_unlock(&heap->lock);
+    
+    freezer_thread_exit(thread->freezer);
+    pthread_rwlock_unlock(&heap->bind_lock);
+    
+    art_heap_self = NULL;
+    free(thread);
+}
+
+// Güvenli nokta: hızlı yol bir atomik okuma ve konteynerde bir sayaç azaltma
+void art_heap_safepoint(void) {
+    art_heap_t* heap = art_heap;
+    art_heap_thread_t* self = art_heap_self;
+    if (!heap || !self) {
+        return;
+    }
+    
+    if (__atomic_load_n(&heap->poll, __ATOMIC_ACQUIRE)) {
+        art_heap_poll(heap);
+    }
+    
+    // İş parçacığı saatini okumak sistem çağrısıdır: seyrek ücretlendir
+    if (__atomic_load_n(&self->resources, __ATOMIC_RELAXED) &&
+        (++self->safepoints & (ART_HEAP_CPU_CHECK - 1)) == 0) {
+        art_heap_cpu_checkpoint(heap, self);
+    }
+}
+
+// İstek bitlerinin adresi; yığın yoksa hep sıfır okunan bir yer
+const int* art_heap_suspend_flag(void) {
+    static const int never = 0;
+    art_heap_t* heap = art_heap;
+    
+    return heap ? &heap->poll : &never;
+}
+
+// Bloklayan çağrıya gir: iş parçacığı bu sürede durmuş sayılır, nesneye dokunmaz
+void art_heap_thread_block(void) {
+    art_heap_t* heap = art_heap;
+    art_heap_thread_t* self = art_heap_self;
+    if (!heap || !self) {
+        return;
+    }
+    
+    pthread_rwlock_rdlock(&heap->bind_lock);
+    
+    pthread_mutex_lock(&heap->lock);
+    heap->stopped++;
+    self->blocked = 1;
+    if (heap->suspend) {
+        pthread_cond_signal(&heap->parked_cond);
+    }
+    pthread_mutex_unlock(&heap->lock);
+    
+    freezer_thread_block(self->freezer);
+    
+    pthread_rwlock_unlock(&heap->bind_lock);
+}
+
+// Bloklayan çağrıdan çık: konteyner donmuşsa çözülmesini, toplama sürüyorsa
+// bitmesini bekle
+void art_heap_thread_unblock(void) {
+    art_heap_t* heap = art_heap;
+    art_heap_thread_t* self = art_heap_self;
+    if (!heap || !self) {
+        return;
+    }
+    
+    pthread_rwlock_rdlock(&heap->bind_lock);
+    
+    freezer_thread_unblock(self->freezer);
+    
+    pthread_mutex_lock(&heap->lock);
+    while (heap->suspend) {
+        pthread_cond_wait(&heap->resume_cond, &heap->lock);
+    }
+    heap->stopped--;
+    self->blocked = 0;
+    pthread_mutex_unlock(&heap->lock);
+    
+    pthread_rwlock_unlock(&heap->bind_lock);
+}
+
+// Nesne ayır. Hızlı yol TLAB içinde işaretçi kaydırma; bellek önceden sıfırlanmıştır.
+art_object_t* art_heap_alloc(void* klass, uint32_t ref_count, uint32_t data_size) {
+    art_heap_t* heap = art_heap;
+    art_heap_thread_t* self = art_heap_self;
+    
+    if (!heap || !self) {
+        return NULL;
+    }
+    
+    // Geniş sayı için ilk yuva ayrılır
+    uint32_t extended = ref_count >= ART_OBJECT_REFS_EXTENDED;
+    uint64_t raw = sizeof(art_object_t) + ((uint64_t)ref_count + extended) * sizeof(art_object_t*) + data_size;
+    if (raw > ART_HEAP_MAX_CHUNK) {
+        return NULL;
+    }
+    
+    uint32_t size = (uint32_t)((raw + ART_HEAP_ALIGN - 1) & ~(uint64_t)(ART_HEAP_ALIGN - 1));
+    if (size < ART_HEAP_MIN_BLOCK) {
+        size = ART_HEAP_MIN_BLOCK;
+    }
+    
+    art_object_t* object;
+    
+    if (size > ART_HEAP_LARGE_OBJECT) {
+        object = art_heap_alloc_large(heap, self, size);
+        if (!object) {
+            return NULL;
+        }
+    } else {
+        if (self->tlab_pos + size > self->tlab_end && art_heap_refill(heap, self) != 0) {
+            return NULL;
+        }
+        
+        object = (art_object_t*)self->tlab_pos;
+        self->tlab_pos += size;
+        object->size = size;
+        object->flags = 0;
+        object->mark = 0;
+    }
+    
+    if (extended) {
+        object->ref_count = ART_OBJECT_REFS_EXTENDED;
+        *(uint32_t*)(object + 1) = ref_count;
+    } else {
+        object->ref_count = (uint16_t)ref_count;
+    }
+    object->klass = klass;
+    self->allocated += object->size;
+    
+    return object;
+}
+
+// Referans yazma bariyeri
+void art_heap_write_ref(art_object_t* object, uint32_t index, art_object_t* value) {
+    art_heap_t* heap = art_heap;
+    art_object_t** slot = &ART_OBJECT_REFS(object)[index];
+    
+    if (!heap) {
+        *slot = value;
+        return;
+    }
+    
+    // Başlangıç görüntüsü: işaretleme sürerken üzerine yazılan değer kaybolmamalı
+    if (__atomic_load_n(&heap->phase, __ATOMIC_RELAXED) == ART_GC_PHASE_MARKING) {
+        art_object_t* old = *slot;
+        if (old) {
+            art_heap_thread_t* self = art_heap_self;
+            if (self) {
+                self->satb[self->satb_count++] = old;
+                if (self->satb_count == ART_HEAP_SATB_BUFFER) {
+                    art_heap_satb_flush(heap, self);
+                }
+            } else {
+                pthread_mutex_lock(&heap->satb_lock);
+                art_heap_stack_push(&heap->satb_queue, old);
+                pthread_mutex_unlock(&heap->satb_lock);
+            }
+        }
+    }
+    
+    // Eski -> genç referansı: nesne bir sonraki küçük toplamada kök olarak taranır;
+    // büyük dizilerde yalnızca yazılan yuvanın kartı
+    if (value && art_heap_is_young(heap, value) && !art_heap_is_young(heap, object)) {
+        if (ART_OBJECT_REF_COUNT(object) > ART_HEAP_CARD_REFS) {
+            heap->cards[((uint8_t*)slot - heap->old_start) >> ART_HEAP_CARD_SHIFT] = 1;
+        }
+    }
+    
+    if (value && !(object->flags & ART_OBJECT_REMEMBERED) &&
+        art_heap_is_young(heap, value) && !art_heap_is_young(heap, object)) {
+        pthread_mutex_lock(&heap->remember_lock);
+        if (!(object->flags & ART_OBJECT_REMEMBERED)) {
+            object->flags |= ART_OBJECT_REMEMBERED;
+            art_heap_stack_push(&heap->remembered, object);
+        }
+        pthread_mutex_unlock(&heap->remember_lock);
+    }
+    
+    __atomic_store_n(slot, value, __ATOMIC_RELEASE);
+}
+
+// Kök yuvası ekle
+int art_heap_add_root(art_object_t** slot) {
+    art_heap_t* heap = art_heap;
+    if (!heap || !slot) {
+        return ART_HEAP_ERROR_INVALID;
+    }
+    
+    // Bağlı iş parçacığının yuvası beklemeden önce eklenir: içinde nesne varsa
+    // bekleme sırasındaki toplama onu da günceller. Bu iş parçacığı durmadan
+    // toplama başlayamaz; bağlı olmayanlar ise toplamanın bitmesini bekler.
+    pthread_mutex_lock(&heap->lock);
+    if (!art_heap_self) {
+        art_heap_wait_resume(heap);
+    }
+    
+    if (heap->root_count == heap->root_capacity) {
+        uint32_t capacity = heap->root_capacity ? heap->root_capacity * 2 : 256;
+        art_object_t*** roots = (art_object_t***)realloc(heap->roots, capacity * sizeof(art_object_t**));
+        if (!roots) {
+            pthread_mutex_unlock(&heap->lock);
+            return ART_HEAP_ERROR_NO_MEMORY;
+        }
+        heap->roots = roots;
+        heap->root_capacity = capacity;
+    }
+    
+    heap->roots[heap->root_count++] = slot;
+    art_heap_wait_resume(heap);
+    pthread_mutex_unlock(&heap->lock);
+    
+    return 0;
+}
+
+// Kök yuvasını kaldır
+int art_heap_remove_root(art_object_t** slot) {
+    art_heap_t* heap = art_heap;
+    if (!heap || !slot) {
+        return ART_HEAP_ERROR_INVALID;
+    }
+    
+    pthread_mutex_lock(&heap->lock);
+    art_heap_wait_resume(heap);
+    
+    // Kökler çoğunlukla ters sırada kaldırılır: sondan ara
+    for (uint32_t i = heap->root_count; i > 0; i--) {
+        if (heap->roots[i - 1] == slot) {
+            heap->roots[i - 1] = heap->roots[--heap->root_count];
+            pthread_mutex_unlock(&heap->lock);
+            return 0;
+        }
+    }
+    
+    pthread_mutex_unlock(&heap->lock);
+    
+    return ART_HEAP_ERROR_INVALID;
+}
+
+// Çerçeveyi iş parçacığının kök listesine ekle
+void art_heap_push_frame(art_heap_frame_t* frame) {
+    art_heap_thread_t* thread = art_heap_self;
+    if (!thread || !frame) {
+        return;
+    }
+    
+    frame->prev = thread->frames;
+    thread->frames = frame;
+}
+
+// En üstteki çerçeveyi çıkar
+void art_heap_pop_frame(art_heap_frame_t* frame) {
+    art_heap_thread_t* thread = art_heap_self;
+    if (!thread || !frame || thread->frames != frame) {
+        return;
+    }
+    
+    thread->frames = frame->prev;
+}
+
+// Toplama iste
+int art_heap_collect(int full) {
+    art_heap_t* heap = art_heap;
+    int result = 0;
+    
+    if (!heap) {
+        return ART_HEAP_ERROR_STATE;
+    }
+    
+    if (full && heap->mode == ART_GC_CONCURRENT) {
+        // İstekten sonra başlayan tam bir döngünün bitmesini bekle
+        art_heap_thread_block();
+        
+        pthread_mutex_lock(&heap->lock);
+        uint64_t target = heap->cycles_done + 1;
+        if (heap->cycle_active || heap->cycle_requested) {
+            target++;
+        }
+        pthread_mutex_unlock(&heap->lock);
+        
+        art_heap_request_cycle(heap);
+        
+        pthread_mutex_lock(&heap->lock);
+        while (heap->cycles_done < target && !heap->shutdown) {
+            pthread_cond_wait(&heap->cycle_cond, &heap->lock);
+        }
+        pthread_mutex_unlock(&heap->lock);
+        
+        art_heap_thread_unblock();
+        
+        return 0;
+    }
+    
+    if (art_heap_stop_world(heap) != 0) {
+        return 0;  // Başka bir iş parçacığı topladı
+    }
+    
+    if (full) {
+        art_heap_full_locked(heap);
+    }
+    result = art_heap_minor_locked(heap);
+    
+    art_heap_resume_world(heap);
+    
+    return result;
+}
+
+// İstatistikleri al
+int art_heap_get_stats(art_heap_stats_t* stats) {
+    art_heap_t* heap = art_heap;
+    uint32_t history[ART_HEAP_PAUSE_HISTORY];
+    
+    if (!heap || !stats) {
+        return ART_HEAP_ERROR_INVALID;
+    }
+    
+    memset(stats, 0, sizeof(art_heap_stats_t));
+    
+    pthread_mutex_lock(&heap->lock);
+    
+    uint8_t* top = __atomic_load_n(&heap->nursery_top, __ATOMIC_RELAXED);
+    stats->heap_size = heap->size;
+    stats->nursery_size = (uint64_t)(heap->nursery_limit - heap->nursery_start);
+    stats->nursery_used = (uint64_t)((top < heap->nursery_limit ? top : heap->nursery_limit) - heap->nursery_start);
+    stats->old_size = (uint64_t)(heap->old_end - heap->old_start);
+    stats->old_used = stats->old_size - __atomic_load_n(&heap->old_free, __ATOMIC_RELAXED);
+    stats->total_allocated = heap->detached_allocated;
+    for (art_heap_thread_t* thread = heap->thread_list; thread; thread = thread->next) {
+        stats->total_allocated += thread->allocated;
+    }
+    stats->promoted_bytes = heap->promoted_bytes;
+    stats->freed_bytes = heap->freed_bytes;
+    stats->minor_count = heap->minor_count;
+    stats->major_count = heap->major_count;
+    stats->pause_count = heap->pause_count;
+    stats->pause_max_ms = heap->pause_max_ns / 1e6f;
+    stats->fragmentation = heap->fragmentation;
+    
+    if (heap->pause_count > 0) {
+        stats->pause_avg_ms = (float)(heap->pause_total_ns / heap->pause_count) / 1e6f;
+    }
+    
+    uint64_t elapsed = art_heap_now_ns() - heap->start_ns;
+    if (elapsed > 0) {
+        stats->gc_time_percent = (float)(heap->pause_total_ns * 100.0 / elapsed);
+    }
+    
+    uint32_t count = heap->pause_count < ART_HEAP_PAUSE_HISTORY ? heap->pause_count : ART_HEAP_PAUSE_HISTORY;
+    memcpy(history, heap->pause_history, count * sizeof(uint32_t));
+    
+    pthread_mutex_unlock(&heap->lock);
+    
+    // Son duraklamalar üzerinden 95. yüzdelik (ekleme sıralaması, en fazla 1024 girdi)
+    for (uint32_t i = 1; i < count; i++) {
+        uint32_t value = history[i];
+        uint32_t j = i;
+        while (j > 0 && history[j - 1] > value) {
+            history[j] = history[j - 1];
+            j--;
+        }
+        history[j] = value;
+    }
+    
+    if (count > 0) {
+        stats->pause_p95_ms = history[(count * 95 + 99) / 100 - 1] / 1000.0f;
+    }
+    
+    return 0;
+}
+
+// Yığını konteynere bağla. Bağlı iş parçacıkları kendi adlarına kaydedilir;
+// bloklu olanlar dondurucu için de durmuş sayılır.
+int art_heap_bind_container(container_freezer_t* freezer, container_resource_t* resources,
+                            container_checkpoint_t* checkpoint) {
+    art_heap_t* heap = art_heap;
+    int result = 0;
+    
+    if (!heap) {
+        return ART_HEAP_ERROR_STATE;
+    }
+    
+    if (!freezer || freezer_get_state(freezer) != FREEZER_THAWED) {
+        return ART_HEAP_ERROR_INVALID;
+    }
+    
+    // Yazma kilidi beklenirken toplayıcı bu iş parçacığını beklememeli
+    art_heap_thread_block();
+    pthread_rwlock_wrlock(&heap->bind_lock);
+    
+    if (heap->freezer) {
+        result = ART_HEAP_ERROR_STATE;
+    } else if (checkpoint && checkpoint_add_region(checkpoint, heap->base, heap->size) != 0) {
+        result = ART_HEAP_ERROR_NO_MEMORY;
+    } else {
+        pthread_mutex_lock(&heap->lock);
+        for (art_heap_thread_t* thread = heap->thread_list; thread; thread = thread->next) {
+            freezer_thread_enter(freezer);
+            if (thread->blocked) {
+                freezer_thread_block(freezer);
+            }
+            thread->freezer = freezer;
+            thread->cpu_slice.last_cpu_us = 0;
+            __atomic_store_n(&thread->resources, resources, __ATOMIC_RELAXED);
+        }
+        
+        // Bağlanmadan önce kullanılan yığın da ücretlendirilir; sınırın
+        // üstündeyse ücretlenemeyen kısım toplamalarda geri alınmaz
+        uint8_t* top = __atomic_load_n(&heap->nursery_top, __ATOMIC_RELAXED);
+        uint64_t used = (uint64_t)((top < heap->nursery_limit ? top : heap->nursery_limit) - heap->nursery_start) +
+                        (uint64_t)(heap->old_end - heap->old_start) - __atomic_load_n(&heap->old_free, __ATOMIC_RELAXED);
+        pthread_mutex_unlock(&heap->lock);
+        
+        pthread_mutex_lock(&heap->charge_lock);
+        heap->resources = resources;
+        heap->charged_bytes = 0;
+        pthread_mutex_unlock(&heap->charge_lock);
+        art_heap_charge(heap, used);
+        
+        heap->freezer = freezer;
+        heap->checkpoint = checkpoint;
+        freezer_set_notify(freezer, art_heap_freeze_notify, heap);
+    }
+    
+    pthread_rwlock_unlock(&heap->bind_lock);
+    art_heap_thread_unblock();
+    
+    return result;
+}
+
+// Konteyner bağlantısını kaldır; iş parçacığı kayıtları onlar adına geri alınır
+void art_heap_unbind_container(container_freezer_t* freezer) {
+    art_heap_t* heap = art_heap;
+    if (!heap || !freezer) {
+        return;
+    }
+    
+    // Çözülmeyi bekleyenler okuma kilidini tutar: yazma kilidinden önce çöz
+    art_heap_thread_block();
+    pthread_rwlock_rdlock(&heap->bind_lock);
+    int bound = heap->freezer == freezer;
+    if (bound) {
+        freezer_thaw(freezer);
+    }
+    pthread_rwlock_unlock(&heap->bind_lock);
+    
+    if (bound) {
+        pthread_rwlock_wrlock(&heap->bind_lock);
+        
+        if (heap->freezer == freezer) {
+            freezer_set_notify(freezer, NULL, NULL);
+            __atomic_and_fetch(&heap->poll, ~ART_HEAP_POLL_FREEZE, __ATOMIC_RELEASE);
+            
+            pthread_mutex_lock(&heap->lock);
+            for (art_heap_thread_t* thread = heap->thread_list; thread; thread = thread->next) {
+                if (thread->freezer) {
+                    if (thread->blocked) {
+                        freezer_thread_unblock(thread->freezer);
+                    }
+                    freezer_thread_exit(thread->freezer);
+                    thread->freezer = NULL;
+                }
+                __atomic_store_n(&thread->resources, NULL, __ATOMIC_RELAXED);
+            }
+            pthread_mutex_unlock(&heap->lock);
+            
+            pthread_mutex_lock(&heap->charge_lock);
+            if (heap->resources) {
+                resource_uncharge_pages(heap->resources, ART_HEAP_PAGES(heap->charged_bytes));
+            }
+            heap->resources = NULL;
+            heap->charged_bytes = 0;
+            pthread_mutex_unlock(&heap->charge_lock);
+            
+            if (heap->checkpoint) {
+                checkpoint_remove_region(heap->checkpoint, heap->base);
+            }
+            heap->freezer = NULL;
+            heap->checkpoint = NULL;
+        }
+        
+        pthread_rwlock_unlock(&heap->bind_lock);
+    }
+    
+    art_heap_thread_unblock();
+}
+
+static uint64_t art_heap_now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+static int art_heap_is_young(art_heap_t* heap, const void* address) {
+    return (const uint8_t*)address >= heap->nursery_start && (const uint8_t*)address < heap->nursery_end;
+}
+
+// Boyut sınıfı: 2 KB altı 16 baytlık adımlar, üstü 2'nin kuvveti aralıkları
+static uint32_t art_heap_size_class(uint32_t size) {
+    if (size < ART_HEAP_SMALL_CLASSES * ART_HEAP_ALIGN) {
+        return size / ART_HEAP_ALIGN;
+    }
+    
+    uint32_t bin = (uint32_t)(31 - __builtin_clz(size)) - 11;
+    if (bin >= ART_HEAP_LARGE_BINS) {
+        bin = ART_HEAP_LARGE_BINS - 1;
+    }
+    
+    return ART_HEAP_SMALL_CLASSES + bin;
+}
+
+// Toplayıcı iç yığıtları büyüyemezse yığın tutarsız kalır; devam edilemez
+static void art_heap_stack_push(art_object_stack_t* stack, art_object_t* object) {
+    if (stack->count == stack->capacity) {
+        uint32_t capacity = stack->capacity ? stack->capacity * 2 : 4096;
+        art_object_t** items = (art_object_t**)realloc(stack->items, capacity * sizeof(art_object_t*));
+        if (!items) {
+            fprintf(stderr, "ART: çöp toplayıcı yığıtı için bellek yetersiz\n");
+            abort();
+        }
+        stack->items = items;
+        stack->capacity = capacity;
+    }
+    
+    stack->items[stack->count++] = object;
+}
+
+// Tüm bağlı iş parçacıklarını güvenli noktada durdur. Başka bir iş parçacığı
+// zaten topluyorsa onun bitmesini bekler ve 1 döner (dünya durdurulmamıştır).
+static int art_heap_stop_world(art_heap_t* heap) {
+    uint64_t start = art_heap_now_ns();
+    art_heap_thread_t* self = art_heap_self;
+    
+    pthread_mutex_lock(&heap->lock);
+    
+    if (heap->suspend) {
+        if (self) {
+            heap->stopped++;
+            pthread_cond_signal(&heap->parked_cond);
+        }
+        while (heap->suspend) {
+            pthread_cond_wait(&heap->resume_cond, &heap->lock);
+        }
+        if (self) {
+            heap->stopped--;
+        }
+        pthread_mutex_unlock(&heap->lock);
+        return 1;
+    }
+    
+    __atomic_store_n(&heap->suspend, 1, __ATOMIC_RELEASE);
+    __atomic_or_fetch(&heap->poll, ART_HEAP_POLL_SUSPEND, __ATOMIC_RELEASE);
+    if (self) {
+        heap->stopped++;
+    }
+    
+    while (heap->stopped < heap->threads) {
+        pthread_cond_wait(&heap->parked_cond, &heap->lock);
+    }
+    
+    pthread_mutex_unlock(&heap->lock);
+    
+    heap->pause_start_ns = start;
+    
+    return 0;
+}
+
+// Dünyayı yeniden başlat ve duraklamayı kaydet
+static void art_heap_resume_world(art_heap_t* heap) {
+    uint64_t pause = art_heap_now_ns() - heap->pause_start_ns;
+    
+    pthread_mutex_lock(&heap->lock);
+    
+    heap->pause_history[heap->pause_count % ART_HEAP_PAUSE_HISTORY] = (uint32_t)(pause / 1000);
+    heap->pause_count++;
+    heap->pause_total_ns += pause;
+    if (pause > heap->pause_max_ns) {
+        heap->pause_max_ns = pause;
+    }
+    
+    if (art_heap_self) {
+        heap->stopped--;
+    }
+    __atomic_store_n(&heap->suspend, 0, __ATOMIC_RELEASE);
+    __atomic_and_fetch(&heap->poll, ~ART_HEAP_POLL_SUSPEND, __ATOMIC_RELEASE);
+    pthread_cond_broadcast(&heap->resume_cond);
+    
+    pthread_mutex_unlock(&heap->lock);
+}
+
+// Güvenli noktada dur ve toplamanın bitmesini bekle
+static void art_heap_park(art_heap_t* heap) {
+    pthread_mutex_lock(&heap->lock);
+    art_heap_wait_resume(heap);
+    pthread_mutex_unlock(&heap->lock);
+}
+
+// Güvenli noktanın yavaş yolu: toplama için dur, konteyner donuyorsa bloklu
+// duruma geçip çözülmeyi bekle
+static void art_heap_poll(art_heap_t* heap) {
+    int poll = __atomic_load_n(&heap->poll, __ATOMIC_ACQUIRE);
+    
+    if (poll & ART_HEAP_POLL_SUSPEND) {
+        art_heap_park(heap);
+    }
+    
+    if (poll & ART_HEAP_POLL_FREEZE) {
+        art_heap_thread_block();
+        art_heap_thread_unblock();
+    }
+}
+
+// Dondurucu bildirimi (dondurucu kilidi altında): istek bitini güncelle
+static void art_heap_freeze_notify(void* context, int state) {
+    art_heap_t* heap = (art_heap_t*)context;
+    
+    if (state == FREEZER_THAWED) {
+        __atomic_and_fetch(&heap->poll, ~ART_HEAP_POLL_FREEZE, __ATOMIC_RELEASE);
+    } else {
+        __atomic_or_fetch(&heap->poll, ART_HEAP_POLL_FREEZE, __ATOMIC_RELEASE);
+    }
+}
+
+// İş parçacığının CPU süresini ücretlendir. Kota bittiyse dönem sonuna kadar
+// uyunur; bu sürede toplayıcı ve dondurucu için bloklu sayılır.
+static void art_heap_cpu_checkpoint(art_heap_t* heap, art_heap_thread_t* self) {
+    art_heap_thread_block();
+    pthread_rwlock_rdlock(&heap->bind_lock);
+    
+    if (self->resources) {
+        if (self->cpu_slice.last_cpu_us == 0) {
+            resource_cpu_slice_begin(&self->cpu_slice);
+        } else {
+            resource_cpu_checkpoint(self->resources, &self->cpu_slice);
+        }
+    }
+    
+    pthread_rwlock_unlock(&heap->bind_lock);
+    art_heap_thread_unblock();
+}
+
+// Kullanımı konteynere ücretlendir; sınır aşılırsa hiçbir şey değişmez
+static int art_heap_charge(art_heap_t* heap, uint64_t bytes) {
+    int result = 0;
+    
+    pthread_mutex_lock(&heap->charge_lock);
+    
+    if (heap->resources) {
+        uint64_t pages = ART_HEAP_PAGES(heap->charged_bytes + bytes) - ART_HEAP_PAGES(heap->charged_bytes);
+        if (pages && resource_charge_pages(heap->resources, pages) != 0) {
+            result = ART_HEAP_ERROR_NO_MEMORY;
+        } else {
+            heap->charged_bytes += bytes;
+        }
+    }
+    
+    pthread_mutex_unlock(&heap->charge_lock);
+    
+    return result;
+}
+
+// Ücreti geri al. Ücretlendirilenden fazlası (ör. taşımada ücretlenemeyen
+// bloklar) geri alınmaz.
+static void art_heap_uncharge(art_heap_t* heap, uint64_t bytes) {
+    pthread_mutex_lock(&heap->charge_lock);
+    
+    if (heap->resources) {
+        if (bytes > heap->charged_bytes) {
+            bytes = heap->charged_bytes;
+        }
+        uint64_t pages = ART_HEAP_PAGES(heap->charged_bytes) - ART_HEAP_PAGES(heap->charged_bytes - bytes);
+        heap->charged_bytes -= bytes;
+        resource_uncharge_pages(heap->resources, pages);
+    }
+    
+    pthread_mutex_unlock(&heap->charge_lock);
+}
+
+// Toplama sürüyorsa bitmesini bekle (heap->lock tutulur). Bağlı iş parçacığı
+// beklerken durmuş sayılır; yoksa durdurma isteği onu sonsuza dek bekler.
+static void art_heap_wait_resume(art_heap_t* heap) {
+    if (!heap->suspend) {
+        return;
+    }
+    
+    if (art_heap_self) {
+        heap->stopped++;
+        pthread_cond_signal(&heap->parked_cond);
+    }
+    
+    while (heap->suspend) {
+        pthread_cond_wait(&heap->resume_cond, &heap->lock);
+    }
+    
+    if (art_heap_self) {
+        heap->stopped--;
+    }
+}
+
+// Boş bloğu boyut sınıfı listesine ekle (old_lock tutulur)
+static void art_heap_free_insert(art_heap_t* heap, uint8_t* start, size_t size) {
+    while (size >= ART_HEAP_MIN_BLOCK) {
+        uint32_t piece = size > ART_HEAP_MAX_CHUNK ? ART_HEAP_MAX_CHUNK : (uint32_t)size;
+        art_free_chunk_t* chunk = (art_free_chunk_t*)start;
+        uint32_t index = art_heap_size_class(piece);
+        
+        chunk->header.size = piece;
+        chunk->header.ref_count = 0;
+        chunk->header.flags = ART_OBJECT_FREE;
+        chunk->header.mark = 0;
+        chunk->header.klass = NULL;
+        chunk->prev = NULL;
+        chunk->next = heap->free_lists[index];
+        if (chunk->next) {
+            chunk->next->prev = chunk;
+        }
+        heap->free_lists[index] = chunk;
+        heap->free_bitmap[index / 64] |= 1ull << (index % 64);
+        heap->old_free += piece;
+        
+        start += piece;
+        size -= piece;
+    }
+}
+
+// Boş bloğu listesinden çıkar (old_lock tutulur)
+static void art_heap_free_unlink(art_heap_t* heap, art_free_chunk_t* chunk) {
+    uint32_t index = art_heap_size_class(chunk->header.size);
+    
+    if (chunk->prev) {
+        chunk->prev->next = chunk->next;
+    } else {
+        heap->free_lists[index] = chunk->next;
+        if (!chunk->next) {
+            heap->free_bitmap[index / 64] &= ~(1ull << (index % 64));
+        }
+    }
+    if (chunk->next) {
+        chunk->next->prev = chunk->prev;
+    }
+    
+    heap->old_free -= chunk->header.size;
+}
+
+// Eski nesilden blok ayır. Başlık kilit altında yazılır ve nesne bu dönem için
+// işaretli doğar; eş zamanlı süpürme onu ölü sanmaz.
+static art_object_t* art_heap_old_alloc(art_heap_t* heap, uint32_t size) {
+    art_free_chunk_t* chunk = NULL;
+    uint32_t index = art_heap_size_class(size);
+    
+    pthread_mutex_lock(&heap->old_lock);
+    
+    // Büyük aralıkta bloklar farklı boyutta: önce aynı aralıkta sınırlı ilk uyan
+    uint32_t first = index;
+    if (index >= ART_HEAP_SMALL_CLASSES) {
+        art_free_chunk_t* candidate = heap->free_lists[index];
+        for (uint32_t i = 0; candidate && i < ART_HEAP_BIN_SCAN; i++, candidate = candidate->next) {
+            if (candidate->header.size >= size) {
+                chunk = candidate;
+                break;
+            }
+        }
+        first = index + 1;
+    }
+    
+    // Sonraki dolu sınıfın ilk bloğu her zaman yeter
+    for (uint32_t word = first / 64; !chunk && word < (ART_HEAP_SIZE_CLASSES + 63) / 64; word++) {
+        uint64_t bits = heap->free_bitmap[word];
+        if (word == first / 64) {
+            bits &= ~0ull << (first % 64);
+        }
+        if (bits) {
+            chunk = heap->free_lists[word * 64 + (uint32_t)__builtin_ctzll(bits)];
+        }
+    }
+    
+    if (!chunk) {
+        pthread_mutex_unlock(&heap->old_lock);
+        return NULL;
+    }
+    
+    art_heap_free_unlink(heap, chunk);
+    
+    uint32_t block = chunk->header.size;
+    if (block - size >= ART_HEAP_MIN_BLOCK) {
+        art_heap_free_insert(heap, (uint8_t*)chunk + size, block - size);
+        block = size;
+    }
+    
+    art_object_t* object = (art_object_t*)chunk;
+    object->size = block;
+    object->ref_count = 0;
+    object->flags = 0;
+    object->mark = heap->epoch;
+    object->klass = NULL;
+    
+    pthread_mutex_unlock(&heap->old_lock);
+    
+    return object;
+}
+
+// Yeni TLAB al; genç nesil doluysa küçük toplama yap
+static int art_heap_refill(art_heap_t* heap, art_heap_thread_t* self) {
+    for (int attempt = 0; attempt < 4; attempt++) {
+        art_heap_safepoint();
+        
+        // TLAB almadan önce ücretlendirilir; konteyner sınırındaysa genç nesil
+        // doluymuş gibi toplanır. Toplama güvenli noktada olduğundan dağıtılan
+        // her TLAB o anda ücretlidir.
+        int charged = art_heap_charge(heap, ART_HEAP_TLAB_SIZE) == 0;
+        if (charged) {
+            uint8_t* tlab = __atomic_fetch_add(&heap->nursery_top, ART_HEAP_TLAB_SIZE, __ATOMIC_ACQ_REL);
+            if (tlab + ART_HEAP_TLAB_SIZE <= __atomic_load_n(&heap->nursery_limit, __ATOMIC_RELAXED)) {
+                // Sıfırlama duraklamada değil, TLAB alınırken yapılır
+                memset(tlab, 0, ART_HEAP_TLAB_SIZE);
+                self->tlab_pos = tlab;
+                self->tlab_end = tlab + ART_HEAP_TLAB_SIZE;
+                return 0;
+            }
+            art_heap_uncharge(heap, ART_HEAP_TLAB_SIZE);
+        }
+        
+        if (art_heap_stop_world(heap) == 0) {
+            // Sınırı eski nesildeki çöp dolduruyorsa genç nesli boşaltmak yetmez
+            if (!charged && attempt > 0) {
+                art_heap_full_locked(heap);
+            }
+            int result = art_heap_minor_locked(heap);
+            art_heap_resume_world(heap);
+            if (result != 0) {
+                return result;
+            }
+        }
+    }
+    
+    return ART_HEAP_ERROR_NO_MEMORY;
+}
+
+// Büyük nesneyi doğrudan eski nesle ayır
+static art_object_t* art_heap_alloc_large(art_heap_t* heap, art_heap_thread_t* self, uint32_t size) {
+    (void)self;
+    
+    art_heap_safepoint();
+    
+    art_object_t* object = art_heap_old_alloc(heap, size);
+    for (int attempt = 0; ; attempt++) {
+        if (object && art_heap_charge(heap, object->size) == 0) {
+            break;
+        }
+        
+        // Konteyner sınırı: blok boş listeye döner
+        if (object) {
+            pthread_mutex_lock(&heap->old_lock);
+            art_heap_free_insert(heap, (uint8_t*)object, object->size);
+            pthread_mutex_unlock(&heap->old_lock);
+        }
+        
+        if (attempt > 0) {
+            return NULL;
+        }
+        
+        // Eski nesil dolu: eş zamanlı döngü yetişmedi, tek duraklamada topla
+        if (art_heap_stop_world(heap) == 0) {
+            art_heap_full_locked(heap);
+            art_heap_resume_world(heap);
+        }
+        object = art_heap_old_alloc(heap, size);
+    }
+    
+    memset(object + 1, 0, object->size - sizeof(art_object_t));
+    
+    uint64_t old_size = (uint64_t)(heap->old_end - heap->old_start);
+    if ((old_size - __atomic_load_n(&heap->old_free, __ATOMIC_RELAXED)) * 100 > old_size * ART_HEAP_OLD_TRIGGER) {
+        art_heap_request_cycle(heap);
+    }
+    
+    return object;
+}
+
+// Genç nesneyi eski nesle taşı (dünya durdurulmuş)
+static art_object_t* art_heap_evacuate(art_heap_t* heap, art_object_t* object) {
+    if (object->flags & ART_OBJECT_FORWARDED) {
+        return (art_object_t*)object->klass;
+    }
+    
+    art_object_t* copy = art_heap_promote_alloc(heap, object->size);
+    if (!copy) {
+        // Toplama öncesi yer ayrıldığı için yalnızca aşırı parçalanmada olur
+        fprintf(stderr, "ART: eski nesle taşıma başarısız (%u bayt)\n", object->size);
+        abort();
+    }
+    
+    uint32_t block = copy->size;
+    uint8_t mark = copy->mark;
+    memcpy(copy, object, object->size);
+    copy->size = block;
+    copy->flags = 0;
+    copy->mark = mark;
+    
+    object->flags |= ART_OBJECT_FORWARDED;
+    object->klass = copy;
+    heap->promoted_bytes += object->size;
+    heap->promoted_blocks += block;
+    
+    art_heap_stack_push(&heap->gray, copy);
+    
+    return copy;
+}
+
+// Taşınan nesneye eski nesilde yer ayır: küçük nesneler taşıma tamponundan
+// işaretçi kaydırarak, tampon alınamazsa tek tek boş listelerden
+static art_object_t* art_heap_promote_alloc(art_heap_t* heap, uint32_t size) {
+    if (size > ART_HEAP_PLAB_SIZE / 4) {
+        return art_heap_old_alloc(heap, size);
+    }
+    
+    if (heap->plab_pos + size > heap->plab_end) {
+        art_heap_plab_retire(heap);
+        
+        art_object_t* plab = art_heap_old_alloc(heap, ART_HEAP_PLAB_SIZE);
+        if (!plab) {
+            return art_heap_old_alloc(heap, size);
+        }
+        heap->plab_pos = (uint8_t*)plab;
+        heap->plab_end = (uint8_t*)plab + plab->size;
+    }
+    
+    art_object_t* object = (art_object_t*)heap->plab_pos;
+    
+    // Eski nesil boşluksuz döşenmeli: blok olamayacak kalan artık nesneye eklenir
+    uint32_t remaining = (uint32_t)(heap->plab_end - heap->plab_pos) - size;
+    if (remaining < ART_HEAP_MIN_BLOCK) {
+        size += remaining;
+    }
+    
+    heap->plab_pos += size;
+    object->size = size;
+    object->flags = 0;
+    object->mark = heap->epoch;
+    
+    return object;
+}
+
+// Tamponun kullanılmayan kısmını boş listelere geri ver
+static void art_heap_plab_retire(art_heap_t* heap) {
+    if (heap->plab_pos < heap->plab_end) {
+        pthread_mutex_lock(&heap->old_lock);
+        art_heap_free_insert(heap, heap->plab_pos, (size_t)(heap->plab_end - heap->plab_pos));
+        pthread_mutex_unlock(&heap->old_lock);
+    }
+    
+    heap->plab_pos = NULL;
+    heap->plab_end = NULL;
+}
+
+// Küçük toplama: köklerden ve hatırlanan kümeden ulaşılan genç nesneleri eski
+// nesle taşı, genç nesli boşalt. Süre yalnızca canlı genç nesnelerle orantılıdır.
+static int art_heap_minor_locked(art_heap_t* heap) {
+    uint8_t* top = heap->nursery_top < heap->nursery_limit ? heap->nursery_top : heap->nursery_limit;
+    uint64_t used = (uint64_t)(top - heap->nursery_start);
+    
+    // En kötü durumda tüm genç nesil yaşar; eski nesilde yer yoksa önce onu topla
+    if (heap->old_free < used + used / 8) {
+        art_heap_full_locked(heap);
+        if (heap->old_free < used + used / 8) {
+            return ART_HEAP_ERROR_NO_MEMORY;
+        }
+    }
+    
+    heap->gray.count = 0;
+    heap->promoted_blocks = 0;
+    
+    art_heap_evacuate_roots(heap);
+    
+    for (uint32_t i = 0; i < heap->remembered.count; i++) {
+        art_object_t* object = heap->remembered.items[i];
+        object->flags &= ~ART_OBJECT_REMEMBERED;
+        
+        uint32_t ref_count = ART_OBJECT_REF_COUNT(object);
+        if (ref_count <= ART_HEAP_CARD_REFS) {
+            art_heap_stack_push(&heap->gray, object);
+            continue;
+        }
+        
+        // Büyük dizi: yalnızca kirli kartlardaki yuvalar
+        art_object_t** refs = ART_OBJECT_REFS(object);
+        uint8_t* first = (uint8_t*)refs;
+        uint8_t* last = (uint8_t*)(refs + ref_count);
+        size_t card = (size_t)(first - heap->old_start) >> ART_HEAP_CARD_SHIFT;
+        size_t end = (size_t)(last - 1 - heap->old_start) >> ART_HEAP_CARD_SHIFT;
+        
+        for (; card <= end; card++) {
+            if (!heap->cards[card]) {
+                continue;
+            }
+            
+            uint8_t* from = heap->old_start + (card << ART_HEAP_CARD_SHIFT);
+            uint8_t* to = from + (1u << ART_HEAP_CARD_SHIFT);
+            art_object_t** slot = (art_object_t**)(from > first ? from : first);
+            art_object_t** stop = (art_object_t**)(to < last ? to : last);
+            for (; slot < stop; slot++) {
+                if (*slot && art_heap_is_young(heap, *slot)) {
+                    *slot = art_heap_evacuate(heap, *slot);
+                }
+            }
+        }
+    }
+    
+    // Kartlar komşu nesnelerle paylaşılabilir: hepsi tarandıktan sonra temizle
+    for (uint32_t i = 0; i < heap->remembered.count; i++) {
+        art_object_t* object = heap->remembered.items[i];
+        if (ART_OBJECT_REF_COUNT(object) > ART_HEAP_CARD_REFS) {
+            size_t first = (size_t)((uint8_t*)ART_OBJECT_REFS(object) - heap->old_start) >> ART_HEAP_CARD_SHIFT;
+            size_t last = (size_t)((uint8_t*)(ART_OBJECT_REFS(object) + ART_OBJECT_REF_COUNT(object)) - 1 - heap->old_start) >> ART_HEAP_CARD_SHIFT;
+            memset(heap->cards + first, 0, last - first + 1);
+        }
+    }
+    heap->remembered.count = 0;
+    
+    while (heap->gray.count > 0) {
+        art_object_t* object = heap->gray.items[--heap->gray.count];
+        art_object_t** refs = ART_OBJECT_REFS(object);
+        uint32_t ref_count = ART_OBJECT_REF_COUNT(object);
+        for (uint32_t i = 0; i < ref_count; i++) {
+            if (refs[i] && art_heap_is_young(heap, refs[i])) {
+                refs[i] = art_heap_evacuate(heap, refs[i]);
+            }
+        }
+    }
+    
+    art_heap_plab_retire(heap);
+    
+    // Tüm TLAB'lar geçersiz; genç nesil baştan dağıtılır
+    for (art_heap_thread_t* thread = heap->thread_list; thread; thread = thread->next) {
+        thread->tlab_pos = NULL;
+        thread->tlab_end = NULL;
+    }
+    __atomic_store_n(&heap->nursery_top, heap->nursery_start, __ATOMIC_RELEASE);
+    heap->minor_count++;
+    
+    // Genç nesil boşaldı; hayatta kalanlar eski nesildeki bloklarıyla ücretli kalır
+    if (used > heap->promoted_blocks) {
+        art_heap_uncharge(heap, used - heap->promoted_blocks);
+    } else {
+        art_heap_charge(heap, heap->promoted_blocks - used);
+    }
+    
+    // Duraklama hayatta kalanlarla, hayatta kalanlar genç nesil boyutuyla orantılı:
+    // genç nesli duraklama hedefine doğru büyüt ya da küçült
+    uint64_t elapsed = art_heap_now_ns() - heap->pause_start_ns;
+    uint64_t current = (uint64_t)(heap->nursery_limit - heap->nursery_start);
+    if (used >= current / 2 && elapsed > 0) {
+        uint64_t ideal = current * ART_HEAP_PAUSE_TARGET_NS / elapsed;
+        uint64_t limit = (current + ideal) / 2;
+        uint64_t maximum = (uint64_t)(heap->nursery_end - heap->nursery_start);
+        if (limit < ART_HEAP_NURSERY_MIN) {
+            limit = ART_HEAP_NURSERY_MIN;
+        }
+        if (limit > maximum) {
+            limit = maximum;
+        }
+        limit &= ~(uint64_t)(ART_HEAP_TLAB_SIZE - 1);
+        __atomic_store_n(&heap->nursery_limit, heap->nursery_start + limit, __ATOMIC_RELAXED);
+    }
+    
+    uint64_t old_size = (uint64_t)(heap->old_end - heap->old_start);
+    if ((old_size - heap->old_free) * 100 > old_size * ART_HEAP_OLD_TRIGGER) {
+        if (heap->mode == ART_GC_CONCURRENT) {
+            if (!heap->cycle_active) {
+                art_heap_request_cycle(heap);
+            }
+        } else if (heap->phase == ART_GC_PHASE_IDLE) {
+            art_heap_full_locked(heap);
+        }
+    }
+    
+    return 0;
+}
+
+// Eski nesli tek duraklamada topla (dünya durdurulmuş). Eş zamanlı döngü
+// sürüyorsa kaldığı yerden tamamlanır.
+static void art_heap_full_locked(art_heap_t* heap) {
+    if (heap->phase == ART_GC_PHASE_IDLE) {
+        // Genç nesneler de izlenir: eski nesnelere tek yol onlar olabilir
+        art_heap_next_epoch(heap);
+        heap->mark_stack.count = 0;
+        __atomic_store_n(&heap->phase, ART_GC_PHASE_MARKING, __ATOMIC_RELEASE);
+        art_heap_mark_roots(heap, 1);
+        art_heap_mark_drain(heap, UINT32_MAX, 1);
+    }
+    
+    if (heap->phase == ART_GC_PHASE_MARKING) {
+        art_heap_mark_satb(heap, 1);
+        art_heap_mark_drain(heap, UINT32_MAX, 0);
+        
+        // Ölü nesneler hatırlanan kümeden süpürmeden önce çıkarılmalı
+        uint32_t kept = 0;
+        for (uint32_t i = 0; i < heap->remembered.count; i++) {
+            art_object_t* object = heap->remembered.items[i];
+            if (object->mark == heap->epoch) {
+                heap->remembered.items[kept++] = object;
+            }
+        }
+        heap->remembered.count = kept;
+        
+        heap->sweep_cursor = heap->old_start;
+        heap->sweep_run = NULL;
+        heap->sweep_free = 0;
+        heap->sweep_small = 0;
+        __atomic_store_n(&heap->phase, ART_GC_PHASE_SWEEPING, __ATOMIC_RELEASE);
+    }
+    
+    pthread_mutex_lock(&heap->old_lock);
+    while (!art_heap_sweep_step(heap, SIZE_MAX)) {
+    }
+    pthread_mutex_unlock(&heap->old_lock);
+    
+    art_heap_sweep_finish(heap);
+}
+
+// Nesneyi işaretle ve taranmak üzere yığıta koy
+static void art_heap_mark_push(art_heap_t* heap, art_object_t* object, int through_young) {
+    if (!object || object->mark == heap->epoch) {
+        return;
+    }
+    
+    // Eş zamanlı işaretlemede genç nesneler görüntüden sonra doğmuştur: canlı sayılır
+    if (!through_young && art_heap_is_young(heap, object)) {
+        return;
+    }
+    
+    object->mark = heap->epoch;
+    art_heap_stack_push(&heap->mark_stack, object);
+}
+
+// Kayıtlı kökleri ve iş parçacığı çerçevelerini griye boya (dünya durmuşken)
+static void art_heap_mark_roots(art_heap_t* heap, int through_young) {
+    for (uint32_t i = 0; i < heap->root_count; i++) {
+        art_heap_mark_push(heap, *heap->roots[i], through_young);
+    }
+    
+    for (art_heap_thread_t* thread = heap->thread_list; thread; thread = thread->next) {
+        for (art_heap_frame_t* frame = thread->frames; frame; frame = frame->prev) {
+            for (uint32_t i = 0; i < frame->count; i++) {
+                art_heap_mark_push(heap, frame->slots[i], through_young);
+            }
+        }
+    }
+}
+
+// Köklerin gösterdiği genç nesneleri taşı ve yuvaları güncelle
+static void art_heap_evacuate_roots(art_heap_t* heap) {
+    for (uint32_t i = 0; i < heap->root_count; i++) {
+        art_object_t** slot = heap->roots[i];
+        if (*slot && art_heap_is_young(heap, *slot)) {
+            *slot = art_heap_evacuate(heap, *slot);
+        }
+    }
+    
+    for (art_heap_thread_t* thread = heap->thread_list; thread; thread = thread->next) {
+        for (art_heap_frame_t* frame = thread->frames; frame; frame = frame->prev) {
+            for (uint32_t i = 0; i < frame->count; i++) {
+                art_object_t* object = frame->slots[i];
+                if (object && art_heap_is_young(heap, object)) {
+                    frame->slots[i] = art_heap_evacuate(heap, object);
+                }
+            }
+        }
+    }
+}
+
+// İşaret yığıtını en fazla budget nesne için işle; kalan nesne sayısını döndür
+static uint32_t art_heap_mark_drain(art_heap_t* heap, uint32_t budget, int through_young) {
+    while (heap->mark_stack.count > 0 && budget-- > 0) {
+        art_object_t* object = heap->mark_stack.items[--heap->mark_stack.count];
+        art_object_t** refs = ART_OBJECT_REFS(object);
+        uint32_t ref_count = ART_OBJECT_REF_COUNT(object);
+        
+        for (uint32_t i = 0; i < ref_count; i++) {
+            art_heap_mark_push(heap, __atomic_load_n(&refs[i], __ATOMIC_ACQUIRE), through_young);
+        }
+    }
+    
+    return heap->mark_stack.count;
+}
+
+// Bariyer kayıtlarını işaret yığıtına aktar; all_threads yalnızca dünya durmuşken
+static void art_heap_mark_satb(art_heap_t* heap, int all_threads) {
+    if (all_threads) {
+        for (art_heap_thread_t* thread = heap->thread_list; thread; thread = thread->next) {
+            for (uint32_t i = 0; i < thread->satb_count; i++) {
+                art_heap_mark_push(heap, thread->satb[i], 0);
+            }
+            thread->satb_count = 0;
+        }
+    }
+    
+    pthread_mutex_lock(&heap->satb_lock);
+    for (uint32_t i = 0; i < heap->satb_queue.count; i++) {
+        art_heap_mark_push(heap, heap->satb_queue.items[i], 0);
+    }
+    heap->satb_queue.count = 0;
+    pthread_mutex_unlock(&heap->satb_lock);
+}
+
+// İş parçacığı tamponunu ortak kuyruğa boşalt
+static void art_heap_satb_flush(art_heap_t* heap, art_heap_thread_t* thread) {
+    if (thread->satb_count == 0) {
+        return;
+    }
+    
+    pthread_mutex_lock(&heap->satb_lock);
+    for (uint32_t i = 0; i < thread->satb_count; i++) {
+        art_heap_stack_push(&heap->satb_queue, thread->satb[i]);
+    }
+    pthread_mutex_unlock(&heap->satb_lock);
+    
+    thread->satb_count = 0;
+}
+
+// Eski nesli adres sırasıyla süpür: ölü nesneler ve komşu boş bloklar
+// birleştirilip boş listelere eklenir (old_lock tutulur). Bitince 1 döner.
+static int art_heap_sweep_step(art_heap_t* heap, size_t budget) {
+    uint8_t* cursor = heap->sweep_cursor;
+    uint8_t* limit = (size_t)(heap->old_end - cursor) > budget ? cursor + budget : heap->old_end;
+    
+    while (cursor < limit) {
+        art_object_t* block = (art_object_t*)cursor;
+        uint32_t size = block->size;
+        
+        if (block->flags & ART_OBJECT_FREE) {
+            art_heap_free_unlink(heap, (art_free_chunk_t*)block);
+            if (!heap->sweep_run) {
+                heap->sweep_run = cursor;
+            }
+        } else if (block->mark != heap->epoch) {
+            heap->freed_bytes += size;
+            heap->sweep_dead += size;
+            if (!heap->sweep_run) {
+                heap->sweep_run = cursor;
+            }
+        } else if (heap->sweep_run) {
+            art_heap_sweep_flush(heap, cursor);
+        }
+        
+        cursor += size;
+    }
+    
+    heap->sweep_cursor = cursor;
+    
+    if (cursor < heap->old_end) {
+        return 0;
+    }
+    
+    if (heap->sweep_run) {
+        art_heap_sweep_flush(heap, cursor);
+    }
+    
+    return 1;
+}
+
+// Birleştirilen diziyi boş listelere ekle ve parçalanma sayaçlarını güncelle
+static void art_heap_sweep_flush(art_heap_t* heap, uint8_t* end) {
+    size_t size = (size_t)(end - heap->sweep_run);
+    
+    art_heap_free_insert(heap, heap->sweep_run, size);
+    heap->sweep_run = NULL;
+    
+    heap->sweep_free += size;
+    if (size < ART_HEAP_LARGE_OBJECT) {
+        heap->sweep_small += size;
+    }
+}
+
+// Döngüyü kapat ve parçalanmayı hesapla: taşımayan eski nesilde en büyük
+// blok hep küçük kalır, bu yüzden yalnız küçük ayırmalara yarayan boş alanın
+// oranı raporlanır
+static void art_heap_sweep_finish(art_heap_t* heap) {
+    pthread_mutex_lock(&heap->old_lock);
+    
+    heap->fragmentation = heap->sweep_free > 0 ? (float)heap->sweep_small / (float)heap->sweep_free : 0.0f;
+    heap->major_count++;
+    uint64_t dead = heap->sweep_dead;
+    heap->sweep_dead = 0;
+    __atomic_store_n(&heap->phase, ART_GC_PHASE_IDLE, __ATOMIC_RELEASE);
+    
+    pthread_mutex_unlock(&heap->old_lock);
+    
+    art_heap_uncharge(heap, dead);
+}
+
+// Arka plan toplayıcıdan döngü iste; gerekirse toplayıcıyı başlat
+static void art_heap_request_cycle(art_heap_t* heap) {
+    if (heap->mode != ART_GC_CONCURRENT) {
+        return;
+    }
+    
+    pthread_mutex_lock(&heap->lock);
+    
+    if (!heap->shutdown) {
+        if (!heap->collector_running || heap->collector_pid != getpid()) {
+            if (pthread_create(&heap->collector, NULL, art_heap_collector_main, heap) == 0) {
+                heap->collector_running = 1;
+                heap->collector_pid = getpid();
+            }
+        }
+        
+        heap->cycle_requested = 1;
+        pthread_cond_signal(&heap->collector_cond);
+    }
+    
+    pthread_mutex_unlock(&heap->lock);
+}
+
+// Eş zamanlı eski nesil döngüsü: kısa başlangıç işaretlemesi, eş zamanlı
+// işaretleme, kısa yeniden işaretleme, eş zamanlı süpürme
+static void art_heap_concurrent_cycle(art_heap_t* heap) {
+    pthread_mutex_lock(&heap->cycle_lock);
+    heap->cycle_active = 1;
+    art_heap_attach_thread();
+    
+    // 1. Başlangıç işaretlemesi: genç nesli boşalt, kökleri griye boya
+    while (art_heap_stop_world(heap) != 0) {
+    }
+    if (heap->phase == ART_GC_PHASE_IDLE && art_heap_minor_locked(heap) == 0 &&
+        heap->phase == ART_GC_PHASE_IDLE) {
+        art_heap_next_epoch(heap);
+        heap->mark_stack.count = 0;
+        __atomic_store_n(&heap->phase, ART_GC_PHASE_MARKING, __ATOMIC_RELEASE);
+        art_heap_mark_roots(heap, 0);
+    }
+    art_heap_resume_world(heap);
+    
+    // 2. Eş zamanlı işaretleme
+    while (__atomic_load_n(&heap->phase, __ATOMIC_ACQUIRE) == ART_GC_PHASE_MARKING) {
+        art_heap_mark_satb(heap, 0);
+        if (art_heap_mark_drain(heap, ART_HEAP_MARK_BATCH, 0) == 0 && heap->satb_queue.count == 0) {
+            break;
+        }
+        art_heap_safepoint();
+    }
+    
+    // 3. Yeniden işaretleme: yalnızca iş parçacığı tamponlarında kalanlar
+    while (art_heap_stop_world(heap) != 0) {
+    }
+    if (heap->phase == ART_GC_PHASE_MARKING) {
+        art_heap_mark_satb(heap, 1);
+        art_heap_mark_drain(heap, UINT32_MAX, 0);
+        heap->sweep_cursor = heap->old_start;
+        heap->sweep_run = NULL;
+        heap->sweep_free = 0;
+        heap->sweep_small = 0;
+        __atomic_store_n(&heap->phase, ART_GC_PHASE_SWEEPING, __ATOMIC_RELEASE);
+    }
+    art_heap_resume_world(heap);
+    
+    // 4. Eş zamanlı süpürme; ayırmalar adımlar arasında kilidi alabilir
+    while (__atomic_load_n(&heap->phase, __ATOMIC_ACQUIRE) == ART_GC_PHASE_SWEEPING) {
+        pthread_mutex_lock(&heap->old_lock);
+        int done = art_heap_sweep_step(heap, ART_HEAP_SWEEP_STEP);
+        pthread_mutex_unlock(&heap->old_lock);
+        
+        if (done) {
+            art_heap_sweep_finish(heap);
+            break;
+        }
+        art_heap_safepoint();
+    }
+    
+    art_heap_detach_thread();
+    heap->cycle_active = 0;
+    pthread_mutex_unlock(&heap->cycle_lock);
+}
+
+// Yeni işaretleme dönemi. 0 atlanır: sıfırlanmış genç nesneler işaretli görünmemeli.
+static void art_heap_next_epoch(art_heap_t* heap) {
+    heap->epoch++;
+    if (heap->epoch == 0) {
+        heap->epoch = 1;
+    }
+}
+
+// Arka plan toplayıcı iş parçacığı
+static void* art_heap_collector_main(void* argument) {
+    art_heap_t* heap = (art_heap_t*)argument;
+    
+    for (;;) {
+        pthread_mutex_lock(&heap->lock);
+        while (!heap->cycle_requested && !heap->shutdown) {
+            pthread_cond_wait(&heap->collector_cond, &heap->lock);
+        }
+        if (heap->shutdown) {
+            pthread_cond_broadcast(&heap->cycle_cond);
+            pthread_mutex_unlock(&heap->lock);
+            break;
+        }
+        heap->cycle_requested = 0;
+        pthread_mutex_unlock(&heap->lock);
+        
+        art_heap_concurrent_cycle(heap);
+        
+        pthread_mutex_lock(&heap->lock);
+        heap->cycles_done++;
+        pthread_cond_broadcast(&heap->cycle_cond);
+        pthread_mutex_unlock(&heap->lock);
+    }
+    
+    return NULL;
+}
+
+// fork öncesi: süren döngünün bitmesini bekle ve tüm kilitleri al
+static void art_heap_atfork_prepare(void) {
+    art_heap_t* heap = art_heap;
+    if (!heap) {
+        return;
+    }
+    
+    art_heap_thread_block();
+    pthread_mutex_lock(&heap->cycle_lock);
+    pthread_mutex_lock(&heap->lock);
+    pthread_mutex_lock(&heap->old_lock);
+    pthread_mutex_lock(&heap->satb_lock);
+    pthread_mutex_lock(&heap->remember_lock);
+}
+
+static void art_heap_atfork_parent(void) {
+    art_heap_t* heap = art_heap;
+    if (!heap) {
+        return;
+    }
+    
+    pthread_mutex_unlock(&heap->remember_lock);
+    pthread_mutex_unlock(&heap->satb_lock);
+    pthread_mutex_unlock(&heap->old_lock);
+    pthread_mutex_unlock(&heap->lock);
+    pthread_mutex_unlock(&heap->cycle_lock);
+    art_heap_thread_unblock();
+}
+
+// Çocukta yalnızca fork eden iş parçacığı yaşar; toplayıcı ilk istekte yeniden başlar
+static void art_heap_atfork_child(void) {
+    art_heap_t* heap = art_heap;
+    if (!heap) {
+        return;
+    }
+    
+    art_heap_thread_t** link = &heap->thread_list;
+    while (*link) {
+        art_heap_thread_t* thread = *link;
+        if (thread == art_heap_self) {
+            link = &thread->next;
+        } else {
+            *link = thread->next;
+            heap->detached_allocated += thread->allocated;
+            free(thread);
+        }
+    }
+    
+    // Konteyner bağlantısı ebeveynde kalır
+    heap->freezer = NULL;
+    heap->checkpoint = NULL;
+    heap->poll &= ~ART_HEAP_POLL_FREEZE;
+    heap->resources = NULL;
+    heap->charged_bytes = 0;
+    if (art_heap_self) {
+        art_heap_self->freezer = NULL;
+        art_heap_self->resources = NULL;
+    }
+    pthread_rwlock_init(&heap->bind_lock, NULL);
+    pthread_mutex_init(&heap->charge_lock, NULL);
+    
+    heap->threads = art_heap_self ? 1 : 0;
+    heap->stopped = heap->threads;
+    heap->collector_running = 0;
+    heap->cycle_requested = 0;
+    pthread_cond_init(&heap->parked_cond, NULL);
+    pthread_cond_init(&heap->resume_cond, NULL);
+    pthread_cond_init(&heap->collector_cond, NULL);
+    pthread_cond_init(&heap->cycle_cond, NULL);
+    
+    pthread_mutex_unlock(&heap->remember_lock);
+    pthread_mutex_unlock(&heap->satb_lock);
+    pthread_mutex_unlock(&heap->old_lock);
+    pthread_mutex_unlock(&heap->lock);
+    pthread_mutex_unlock(&heap->cycle_lock);
+    art_heap_thread_unblock();
+}
@@ -0,0 +1,2917 @@
+#include "../../include/android/art_interp.h"
+#include "../../include/android/art_jit.h"
+#include "../../include/android/art_aot.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+
+// DEX başına çözüm tabloları (dizinle doğrudan erişim)
+typedef struct art_dex_cache {
+    dex_file_t* dex;
+    art_class_t** types;
+    art_method_t** methods;
+    art_field_t** fields;
+    struct art_dex_cache* next;
+} art_dex_cache_t;
+
+// Yerel metot kaydı
+typedef struct art_native_entry {
+    char* descriptor;
+    char* name;
+    char* signature;
+    art_native_method_t function;
+    struct art_native_entry* next;
+} art_native_entry_t;
+
+// İş parçacığı durumu. Yazmaç yığını sabit boyutludur, işaretçiler değişmez.
+typedef struct {
+    uint32_t* vregs;
+    art_object_t** refs;           // refs[0]: son dönen nesne
+    art_heap_frame_t roots;        // refs[0..count) kök; count yığının tepesidir
+    uint32_t depth;
+    uint32_t monitors;             // Tutulan monitör girişleri
+    art_value_t result;            // Son dönen ilkel değer
+    char exception[256];
+} art_interp_thread_t;
+
+// Çağrı türleri
+enum {
+    ART_INVOKE_VIRTUAL,
+    ART_INVOKE_SUPER,
+    ART_INVOKE_DIRECT,
+    ART_INVOKE_STATIC,
+    ART_INVOKE_INTERFACE
+};
+
+// Komut biçimleri (Dalvik biçim adlarıyla)
+enum {
+    FMT_NONE, FMT_10X, FMT_12X, FMT_11N, FMT_11X, FMT_10T, FMT_20T, FMT_22X,
+    FMT_21T, FMT_21S, FMT_21H, FMT_21C, FMT_23X, FMT_22B, FMT_22T, FMT_22S,
+    FMT_22C, FMT_32X, FMT_30T, FMT_31T, FMT_31I, FMT_31C, FMT_35C, FMT_3RC,
+    FMT_51L, FMT_45CC, FMT_4RCC
+};
+
+// Önbellek yuvası gerektiren dizin türleri
+enum {
+    INDEX_NONE, INDEX_TYPE, INDEX_FIELD, INDEX_METHOD
+};
+
+static const uint8_t art_interp_formats[256] = {
+    [0x00] = FMT_10X, [0x01] = FMT_12X, [0x02] = FMT_22X, [0x03] = FMT_32X,
+    [0x04] = FMT_12X, [0x05] = FMT_22X, [0x06] = FMT_32X,
+    [0x07] = FMT_12X, [0x08] = FMT_22X, [0x09] = FMT_32X,
+    [0x0a ... 0x0d] = FMT_11X, [0x0e] = FMT_10X, [0x0f ... 0x11] = FMT_11X,
+    [0x12] = FMT_11N, [0x13] = FMT_21S, [0x14] = FMT_31I, [0x15] = FMT_21H,
+    [0x16] = FMT_21S, [0x17] = FMT_31I, [0x18] = FMT_51L, [0x19] = FMT_21H,
+    [0x1a] = FMT_21C, [0x1b] = FMT_31C, [0x1c] = FMT_21C,
+    [0x1d ... 0x1e] = FMT_11X, [0x1f] = FMT_21C, [0x20] = FMT_22C, [0x21] = FMT_12X,
+    [0x22] = FMT_21C, [0x23] = FMT_22C, [0x24] = FMT_35C, [0x25] = FMT_3RC,
+    [0x26] = FMT_31T, [0x27] = FMT_11X, [0x28] = FMT_10T, [0x29] = FMT_20T,
+    [0x2a] = FMT_30T, [0x2b ... 0x2c] = FMT_31T, [0x2d ... 0x31] = FMT_23X,
+    [0x32 ... 0x37] = FMT_22T, [0x38 ... 0x3d] = FMT_21T,
+    [0x44 ... 0x51] = FMT_23X, [0x52 ... 0x5f] = FMT_22C, [0x60 ... 0x6d] = FMT_21C,
+    [0x6e ... 0x72] = FMT_35C, [0x74 ... 0x78] = FMT_3RC,
+    [0x7b ... 0x8f] = FMT_12X, [0x90 ... 0xaf] = FMT_23X, [0xb0 ... 0xcf] = FMT_12X,
+    [0xd0 ... 0xd7] = FMT_22S, [0xd8 ... 0xe2] = FMT_22B,
+    [0xfa] = FMT_45CC, [0xfb] = FMT_4RCC, [0xfc] = FMT_35C, [0xfd] = FMT_3RC,
+    [0xfe ... 0xff] = FMT_21C
+};
+
+static art_interp_resolver_t art_interp_resolver = NULL;
+static pthread_mutex_t art_interp_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t art_interp_init_cond = PTHREAD_COND_INITIALIZER;
+static pthread_mutex_t art_interp_monitor;
+static art_dex_cache_t* art_interp_caches = NULL;
+static art_native_entry_t* art_interp_natives = NULL;
+static art_class_t* art_interp_classes = NULL;        // Kurulan tüm sınıflar
+static uint32_t art_interp_link_depth = 0;
+static art_interp_stats_t art_interp_stats;
+static int art_interp_ready = 0;
+static __thread art_interp_thread_t* art_interp_self = NULL;
+
+// Yardımcı fonksiyonlar
+static void art_interp_lock_enter(void);
+static int art_interp_builtin_arraycopy(art_method_t* method, art_value_t* args, art_value_t* result);
+static int art_interp_builtin_nano_time(art_method_t* method, art_value_t* args, art_value_t* result);
+static int art_interp_builtin_current_millis(art_method_t* method, art_value_t* args, art_value_t* result);
+static art_class_t* art_interp_link(dex_class_t* dex_class);
+static art_class_t* art_interp_lookup_class(dex_file_t* context, const char* descriptor);
+static art_class_t* art_interp_array_class(dex_file_t* context, const char* descriptor);
+static art_dex_cache_t* art_interp_dex_cache(dex_file_t* dex);
+static int art_interp_build_signature(dex_file_t* dex, uint32_t proto_idx, char* buffer, size_t size);
+static uint16_t art_interp_shorty_words(const char* shorty, int is_static);
+static art_native_method_t art_interp_find_native(const char* descriptor, const char* name, const char* signature);
+static art_method_t* art_interp_find_declared(art_class_t* klass, const char* name, const char* signature);
+static art_method_t* art_interp_find_virtual(art_class_t* klass, const char* name, const char* signature);
+static int art_interp_is_assignable(art_class_t* from, art_class_t* to);
+static art_class_t* art_interp_resolve_type(art_interp_thread_t* thread, art_class_t* referrer, uint32_t type_idx);
+static art_field_t* art_interp_resolve_field(art_interp_thread_t* thread, art_class_t* referrer, uint32_t field_idx, int is_static);
+static art_method_t* art_interp_resolve_method(art_interp_thread_t* thread, art_class_t* referrer, uint32_t method_idx);
+static int art_interp_initialize_class(art_interp_thread_t* thread, art_class_t* klass);
+static int art_interp_prepare(art_method_t* method, dex_file_t* dex);
+static uint32_t art_interp_payload_size(const uint16_t* insns, uint32_t remaining);
+static int art_interp_check_instruction(art_method_t* method, const dex_header_t* header, const uint16_t* insns, uint32_t pc,
+                                        uint32_t size, const uint8_t* marks);
+static int art_interp_index_kind(uint8_t opcode);
+static art_object_t* art_interp_new_array(art_interp_thread_t* thread, art_class_t* klass, int32_t length);
+static int art_interp_throw(art_interp_thread_t* thread, const char* descriptor, const char* format, ...);
+static int art_interp_invoke_insn(art_interp_thread_t* thread, art_method_t* method, const uint16_t* pc, uint32_t* fp, art_object_t** rp, int kind, int range);
+static int art_interp_call_native(art_interp_thread_t* thread, art_method_t* target, uint32_t base);
+static int art_interp_reserve_frame(art_interp_thread_t* thread, art_method_t* target, uint32_t* base);
+static int art_interp_enter(art_interp_thread_t* thread, art_method_t* target, uint32_t base);
+static int art_interp_execute(art_interp_thread_t* thread, art_method_t* method, uint32_t base);
+
+// Yorumlayıcıyı başlat; resolver sınıf yükleyiciye köprüdür
+int art_interp_init(art_interp_resolver_t resolver) {
+    if (art_interp_ready) {
+        return 0;
+    }
+    
+    // Monitörler tek, yeniden girilebilir bir kilitle korunur
+    pthread_mutexattr_t attributes;
+    pthread_mutexattr_init(&attributes);
+    pthread_mutexattr_settype(&attributes, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&art_interp_monitor, &attributes);
+    pthread_mutexattr_destroy(&attributes);
+    
+    art_interp_resolver = resolver;
+    memset(&art_interp_stats, 0, sizeof(art_interp_stats));
+    art_interp_ready = 1;
+    
+    // Çekirdek kütüphanenin yorumlayıcıda gerçeklenen yerel metotları
+    art_interp_register_native("Ljava/lang/System;", "arraycopy", "(Ljava/lang/Object;ILjava/lang/Object;II)V",
+                               art_interp_builtin_arraycopy);
+    art_interp_register_native("Ljava/lang/System;", "nanoTime", "()J", art_interp_builtin_nano_time);
+    art_interp_register_native("Ljava/lang/System;", "currentTimeMillis", "()J", art_interp_builtin_current_millis);
+    
+    return 0;
+}
+
+// Çalışma zamanı sınıflarını ve tabloları serbest bırak
+void art_interp_cleanup(void) {
+    if (!art_interp_ready) {
+        return;
+    }
+    
+    // Derlenmiş kod metotları gösterir
+    art_jit_flush();
+    
+    // Sınıfların alanları, metotları ve statik kökleri
+    while (art_interp_classes) {
+        art_class_t* klass = art_interp_classes;
+        art_interp_classes = klass->next;
+        
+        for (uint32_t m = 0; m < klass->method_count; m++) {
+            free((void*)klass->methods[m].signature);
+            free(klass->methods[m].insns);
+            free(klass->methods[m].caches);
+        }
+        for (uint32_t f = 0; f < klass->field_count; f++) {
+            art_field_t* field = &klass->fields[f];
+            if (field->is_static && field->is_ref) {
+                art_heap_remove_root(&klass->statics[field->offset].l);
+            }
+        }
+        
+        if (klass->dex_class) {
+            klass->dex_class->runtime = NULL;
+        } else {
+            free((void*)klass->descriptor);
+        }
+        
+        free(klass->interfaces);
+        free(klass->fields);
+        free(klass->methods);
+        free(klass->vtable);
+        free(klass->statics);
+        free(klass);
+    }
+    
+    while (art_interp_caches) {
+        art_dex_cache_t* cache = art_interp_caches;
+        art_interp_caches = cache->next;
+        free(cache->types);
+        free(cache->methods);
+        free(cache->fields);
+        free(cache);
+    }
+    
+    while (art_interp_natives) {
+        art_native_entry_t* entry = art_interp_natives;
+        art_interp_natives = entry->next;
+        free(entry->descriptor);
+        free(entry->name);
+        free(entry->signature);
+        free(entry);
+    }
+    
+    pthread_mutex_destroy(&art_interp_monitor);
+    art_interp_resolver = NULL;
+    art_interp_ready = 0;
+}
+
+// İş parçacığına yazmaç yığını ver ve yığını çöp toplayıcıya kök olarak bildir
+int art_interp_attach_thread(void) {
+    if (!art_interp_ready) {
+        return ART_INTERP_ERROR_STATE;
+    }
+    
+    if (art_interp_self) {
+        return 0;
+    }
+    
+    if (art_heap_attach_thread() != 0) {
+        return ART_INTERP_ERROR_STATE;
+    }
+    
+    art_interp_thread_t* thread = (art_interp_thread_t*)calloc(1, sizeof(art_interp_thread_t));
+    if (!thread) {
+        return ART_INTERP_ERROR_NO_MEMORY;
+    }
+    
+    // Büyük calloc anonim eşlemedir: sayfalar ilk kullanımda gelir
+    thread->vregs = (uint32_t*)calloc(ART_INTERP_STACK_SLOTS, sizeof(uint32_t));
+    thread->refs = (art_object_t**)calloc(ART_INTERP_STACK_SLOTS, sizeof(art_object_t*));
+    if (!thread->vregs || !thread->refs) {
+        free(thread->vregs);
+        free(thread->refs);
+        free(thread);
+        return ART_INTERP_ERROR_NO_MEMORY;
+    }
+    
+    thread->roots.slots = thread->refs;
+    thread->roots.count = 1;
+    art_heap_push_frame(&thread->roots);
+    art_interp_self = thread;
+    
+    return 0;
+}
+
+// İş parçacığını ayır
+void art_interp_detach_thread(void) {
+    art_interp_thread_t* thread = art_interp_self;
+    if (!thread) {
+        return;
+    }
+    
+    while (thread->monitors > 0) {
+        pthread_mutex_unlock(&art_interp_monitor);
+        thread->monitors--;
+    }
+    
+    art_heap_pop_frame(&thread->roots);
+    art_interp_self = NULL;
+    
+    free(thread->vregs);
+    free(thread->refs);
+    free(thread);
+}
+
+// Yerel metot kaydet
+int art_interp_register_native(const char* descriptor, const char* name, const char* signature,
+                               art_native_method_t function) {
+    if (!art_interp_ready) {
+        return ART_INTERP_ERROR_STATE;
+    }
+    
+    if (!descriptor || !name || !signature || !function) {
+        return ART_INTERP_ERROR_INVALID;
+    }
+    
+    art_native_entry_t* entry = (art_native_entry_t*)calloc(1, sizeof(art_native_entry_t));
+    if (!entry) {
+        return ART_INTERP_ERROR_NO_MEMORY;
+    }
+    
+    entry->descriptor = strdup(descriptor);
+    entry->name = strdup(name);
+    entry->signature = strdup(signature);
+    entry->function = function;
+    
+    if (!entry->descriptor || !entry->name || !entry->signature) {
+        free(entry->descriptor);
+        free(entry->name);
+        free(entry->signature);
+        free(entry);
+        return ART_INTERP_ERROR_NO_MEMORY;
+    }
+    
+    art_interp_lock_enter();
+    entry->next = art_interp_natives;
+    art_interp_natives = entry;
+    pthread_mutex_unlock(&art_interp_lock);
+    
+    return 0;
+}
+
+// DEX sınıfının çalışma zamanı sınıfını al (gerekirse kur)
+int art_interp_get_class(dex_class_t* dex_class, art_class_t** klass) {
+    if (!art_interp_ready) {
+        return ART_INTERP_ERROR_STATE;
+    }
+    
+    if (!dex_class || !klass) {
+        return ART_INTERP_ERROR_INVALID;
+    }
+    
+    art_class_t* result = (art_class_t*)__atomic_load_n(&dex_class->runtime, __ATOMIC_ACQUIRE);
+    if (!result) {
+        art_interp_lock_enter();
+        result = art_interp_link(dex_class);
+        pthread_mutex_unlock(&art_interp_lock);
+    }
+    
+    if (!result) {
+        return ART_INTERP_ERROR_NOT_FOUND;
+    }
+    
+    *klass = result;
+    
+    return 0;
+}
+
+// Tanımlayıcıyla sınıf bul ("Lpaket/Sinif;" ya da "[I")
+int art_interp_find_class(const char* descriptor, art_class_t** klass) {
+    if (!art_interp_ready) {
+        return ART_INTERP_ERROR_STATE;
+    }
+    
+    if (!descriptor || !klass) {
+        return ART_INTERP_ERROR_INVALID;
+    }
+    
+    art_interp_lock_enter();
+    art_class_t* result = art_interp_lookup_class(NULL, descriptor);
+    pthread_mutex_unlock(&art_interp_lock);
+    
+    if (!result) {
+        return ART_INTERP_ERROR_NOT_FOUND;
+    }
+    
+    *klass = result;
+    
+    return 0;
+}
+
+// Sınıfta ve üst sınıflarında ad ve imzayla metot bul
+int art_interp_find_method(art_class_t* klass, const char* name, const char* signature, art_method_t** method) {
+    if (!klass || !name || !signature || !method) {
+        return ART_INTERP_ERROR_INVALID;
+    }
+    
+    for (art_class_t* current = klass; current; current = current->superclass) {
+        art_method_t* result = art_interp_find_declared(current, name, signature);
+        if (result) {
+            *method = result;
+            return 0;
+        }
+    }
+    
+    return ART_INTERP_ERROR_NOT_FOUND;
+}
+
+// Nesne ayır; sınıf gerekirse başlatılır
+int art_interp_alloc_object(art_class_t* klass, art_object_t** object) {
+    art_interp_thread_t* thread = art_interp_self;
+    if (!thread) {
+        return ART_INTERP_ERROR_STATE;
+    }
+    
+    if (!klass || !object || klass->component_size || klass->descriptor[0] == '[' ||
+        (klass->access_flags & (DEX_ACC_ABSTRACT | DEX_ACC_INTERFACE))) {
+        return ART_INTERP_ERROR_INVALID;
+    }
+    
+    if (art_interp_initialize_class(thread, klass) != 0) {
+        return ART_INTERP_ERROR_EXCEPTION;
+    }
+    
+    art_object_t* result = art_heap_alloc(klass, klass->ref_fields, klass->data_size);
+    if (!result) {
+        return ART_INTERP_ERROR_NO_MEMORY;
+    }
+    
+    *object = result;
+    
+    return 0;
+}
+
+// Metodu yerel koddan çağır
+int art_interp_invoke(art_method_t* method, const art_value_t* args, uint32_t arg_count, art_value_t* result) {
+    art_interp_thread_t* thread = art_interp_self;
+    if (!thread) {
+        return ART_INTERP_ERROR_STATE;
+    }
+    
+    if (!method || (arg_count > 0 && !args)) {
+        return ART_INTERP_ERROR_INVALID;
+    }
+    
+    int is_static = (method->access_flags & DEX_ACC_STATIC) != 0;
+    uint32_t expected = (uint32_t)strlen(method->shorty) - 1 + (is_static ? 0 : 1);
+    if (arg_count != expected || (!is_static && !args[0].l)) {
+        return ART_INTERP_ERROR_INVALID;
+    }
+    
+    if (thread->depth == 0) {
+        thread->exception[0] = '\0';
+    }
+    
+    // Parametreler çerçevenin son yazmaçlarına yerleşir
+    uint32_t base;
+    if (art_interp_reserve_frame(thread, method, &base) != 0) {
+        return ART_INTERP_ERROR_EXCEPTION;
+    }
+    
+    uint32_t* fp = thread->vregs + base;
+    art_object_t** rp = thread->refs + base;
+    uint32_t reg = method->registers_size - method->ins_size;
+    uint32_t index = 0;
+    
+    if (!is_static) {
+        rp[reg] = args[index++].l;
+        fp[reg++] = 1;
+    }
+    for (const char* type = method->shorty + 1; *type; type++, index++) {
+        if (*type == 'L') {
+            rp[reg] = args[index].l;
+            fp[reg++] = args[index].l != NULL;
+        } else if (*type == 'J' || *type == 'D') {
+            uint64_t wide = (uint64_t)args[index].j;
+            fp[reg++] = (uint32_t)wide;
+            fp[reg++] = (uint32_t)(wide >> 32);
+        } else {
+            fp[reg++] = (uint32_t)args[index].i;
+        }
+    }
+    
+    // Sınıf başlatma nesneleri taşıyabilir; o sırada parametreler kök olmalı
+    uint32_t saved_count = thread->roots.count;
+    thread->roots.count = base + method->registers_size + 1;
+    art_heap_safepoint();
+    int status = is_static ? art_interp_initialize_class(thread, method->klass) : 0;
+    thread->roots.count = saved_count;
+    
+    if (status == 0) {
+        status = art_interp_enter(thread, method, base);
+    }
+    
+    if (status == 0 && result) {
+        if (method->shorty[0] == 'L') {
+            result->l = thread->refs[0];
+        } else {
+            *result = thread->result;
+        }
+    }
+    
+    // Yakalanmamış istisna çerçeveleri atladı: tutulan monitörleri bırak
+    if (thread->depth == 0) {
+        while (thread->monitors > 0) {
+            pthread_mutex_unlock(&art_interp_monitor);
+            thread->monitors--;
+        }
+    }
+    
+    return status;
+}
+
+// Yerel metottan istisna fırlat
+int art_interp_throw_new(const char* descriptor, const char* message) {
+    art_interp_thread_t* thread = art_interp_self;
+    if (!thread || !descriptor) {
+        return ART_INTERP_ERROR_INVALID;
+    }
+    
+    return art_interp_throw(thread, descriptor, "%s", message ? message : "");
+}
+
+// Son istisna
+const char* art_interp_get_exception(void) {
+    art_interp_thread_t* thread = art_interp_self;
+    
+    return thread && thread->exception[0] ? thread->exception : NULL;
+}
+
+// İstisnayı temizle
+void art_interp_clear_exception(void) {
+    if (art_interp_self) {
+        art_interp_self->exception[0] = '\0';
+    }
+}
+
+// İstatistikleri al
+int art_interp_get_stats(art_interp_stats_t* stats) {
+    if (!stats) {
+        return ART_INTERP_ERROR_INVALID;
+    }
+    
+    art_interp_lock_enter();
+    *stats = art_interp_stats;
+    stats->cache_misses = __atomic_load_n(&art_interp_stats.cache_misses, __ATOMIC_RELAXED);
+    stats->exceptions = __atomic_load_n(&art_interp_stats.exceptions, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&art_interp_lock);
+    
+    return 0;
+}
+
+// Paylaşılmayan metodun kodunu yorumlayıcı biçimine hazırla (önceden
+// derleyicinin geçici metotları). Yalnızca code ve registers_size kullanılır,
+// dizinler dex'e göre doğrulanır. Kilit alınmaz: derleyici iş parçacıkları
+// fork anında kilit tutmamalıdır.
+int art_interp_prepare_method(art_method_t* method, dex_file_t* dex) {
+    if (!method || !method->code || !dex) {
+        return ART_INTERP_ERROR_INVALID;
+    }
+    
+    return method->insns ? 0 : art_interp_prepare(method, dex);
+}
+
+// Derlenmiş koddan new-instance: sınıf çözülüp başlatılır, yuvaya yazılır
+int art_interp_jit_new_instance(art_jit_frame_t* frame, uint32_t pc) {
+    art_interp_thread_t* thread = (art_interp_thread_t*)frame->thread;
+    art_method_t* method = frame->method;
+    const uint16_t* insn = method->insns + pc;
+    art_inline_cache_t* cache = &method->caches[insn[1]];
+    uint32_t aa = insn[0] >> 8;
+    
+    art_class_t* klass = __atomic_load_n(&cache->klass, __ATOMIC_ACQUIRE);
+    if (!klass) {
+        if (!(klass = art_interp_resolve_type(thread, method->klass, cache->index))) {
+            return ART_INTERP_ERROR_EXCEPTION;
+        }
+        if (klass->descriptor[0] == '[' || (klass->access_flags & (DEX_ACC_ABSTRACT | DEX_ACC_INTERFACE))) {
+            return art_interp_throw(thread, "Ljava/lang/InstantiationError;", "%s", klass->descriptor);
+        }
+        int status = art_interp_initialize_class(thread, klass);
+        if (status != 0) {
+            return status;
+        }
+        __atomic_store_n(&cache->klass, klass, __ATOMIC_RELEASE);
+    }
+    
+    art_object_t* object = art_heap_alloc(klass, klass->ref_fields, klass->data_size);
+    if (!object) {
+        return art_interp_throw(thread, "Ljava/lang/OutOfMemoryError;", "%s", klass->descriptor);
+    }
+    frame->refs[aa] = object;
+    frame->vregs[aa] = 1;
+    
+    return 0;
+}
+
+// Derlenmiş koddan invoke-*: çağrı yorumlayıcının yolundan geçer
+int art_interp_jit_invoke(art_jit_frame_t* frame, uint32_t pc) {
+    const uint16_t* insn = frame->method->insns + pc;
+    uint8_t opcode = insn[0] & 0xFF;
+    int range = opcode >= 0x74;
+    
+    // Çağrı türleri komut sırasıyla aynıdır: virtual, super, direct, static, interface
+    return art_interp_invoke_insn((art_interp_thread_t*)frame->thread, frame->method, insn, frame->vregs, frame->refs,
+                                  opcode - (range ? 0x74 : 0x6e), range);
+}
+
+// Çözüm kilidini al. Sahibi toplama için durmayı bekliyor olabilir: beklerken
+// iş parçacığı durmuş sayılır.
+static void art_interp_lock_enter(void) {
+    if (pthread_mutex_trylock(&art_interp_lock) == 0) {
+        return;
+    }
+    
+    art_heap_thread_block();
+    pthread_mutex_lock(&art_interp_lock);
+    art_heap_thread_unblock();
+}
+
+// Çalışma zamanı sınıfını kur: üst sınıf ve arayüzler, alan yerleşimi, metotlar,
+// vtable ve statik alanlar. art_interp_lock tutulur.
+static art_class_t* art_interp_link(dex_class_t* dex_class) {
+    if (dex_class->runtime) {
+        return (art_class_t*)dex_class->runtime;
+    }
+    
+    // Döngüsel hiyerarşi bozuk DEX demektir
+    if (art_interp_link_depth > 64) {
+        return NULL;
+    }
+    
+    dex_file_t* dex = dex_class->dex;
+    art_class_t* superclass = NULL;
+    
+    art_interp_link_depth++;
+    if (dex_class->superclass_descriptor) {
+        superclass = dex_class->superclass ? art_interp_link(dex_class->superclass)
+                                           : art_interp_lookup_class(dex, dex_class->superclass_descriptor);
+    }
+    art_interp_link_depth--;
+    
+    if (dex_class->superclass_descriptor && (!superclass || superclass->descriptor[0] == '[')) {
+        return NULL;
+    }
+    
+    art_dex_cache_t* cache = art_interp_dex_cache(dex);
+    art_class_t* klass = (art_class_t*)calloc(1, sizeof(art_class_t));
+    uint32_t field_total = dex_class->static_fields_size + dex_class->instance_fields_size;
+    uint32_t method_total = dex_class->direct_methods_size + dex_class->virtual_methods_size;
+    dex_member_t* members = (dex_member_t*)malloc((field_total + method_total + 1) * sizeof(dex_member_t));
+    
+    if (!cache || !klass || !members) {
+        free(klass);
+        free(members);
+        return NULL;
+    }
+    
+    klass->dex_class = dex_class;
+    klass->descriptor = dex_class->descriptor;
+    klass->superclass = superclass;
+    klass->access_flags = dex_class->access_flags;
+    klass->dex_cache = cache;
+    klass->fields = (art_field_t*)calloc(field_total + 1, sizeof(art_field_t));
+    klass->methods = (art_method_t*)calloc(method_total + 1, sizeof(art_method_t));
+    klass->interfaces = (art_class_t**)calloc(dex_class->interfaces_size + 1, sizeof(art_class_t*));
+    
+    if (!klass->fields || !klass->methods || !klass->interfaces ||
+        dex_get_class_members(dex_class, members) != 0) {
+        goto fail;
+    }
+    
+    art_interp_link_depth++;
+    for (uint32_t i = 0; i < dex_class->interfaces_size; i++) {
+        const char* descriptor = dex_get_type_descriptor(dex, dex_class->interfaces[i]);
+        art_class_t* interface = descriptor ? art_interp_lookup_class(dex, descriptor) : NULL;
+        if (!interface) {
+            art_interp_link_depth--;
+            goto fail;
+        }
+        klass->interfaces[klass->interface_count++] = interface;
+    }
+    art_interp_link_depth--;
+    
+    // Alanlar: referanslar yuvalara, ilkeller büyükten küçüğe hizalı yerleşir
+    klass->ref_fields = superclass ? superclass->ref_fields : 0;
+    klass->data_size = superclass ? superclass->data_size : 0;
+    
+    for (uint32_t i = 0; i < field_total; i++) {
+        const dex_field_id_t* id = dex_get_field_id(dex, members[i].idx);
+        art_field_t* field = &klass->fields[i];
+        
+        if (!id || !(field->name = dex_get_string(dex, id->name_idx)) ||
+            !(field->type = dex_get_type_descriptor(dex, id->type_idx))) {
+            goto fail;
+        }
+        
+        field->klass = klass;
+        field->is_static = i < dex_class->static_fields_size;
+        field->is_ref = field->type[0] == 'L' || field->type[0] == '[';
+        switch (field->type[0]) {
+            case 'Z': case 'B': field->size = 1; break;
+            case 'C': case 'S': field->size = 2; break;
+            case 'J': case 'D': field->size = 8; break;
+            default:            field->size = 4; break;
+        }
+        
+        if (field->is_static) {
+            field->offset = klass->static_count++;
+        } else if (field->is_ref) {
+            if (klass->ref_fields == ART_CLASS_MAX_REF_FIELDS) {
+                goto fail;
+            }
+            field->offset = klass->ref_fields++;
+        }
+    }
+    
+    for (uint8_t size = 8; size > 0; size >>= 1) {
+        for (uint32_t i = dex_class->static_fields_size; i < field_total; i++) {
+            art_field_t* field = &klass->fields[i];
+            if (!field->is_ref && field->size == size) {
+                klass->data_size = (klass->data_size + size - 1) & ~(uint32_t)(size - 1);
+                field->offset = klass->data_size;
+                klass->data_size += size;
+            }
+        }
+    }
+    klass->field_count = field_total;
+    
+    // Metotlar
+    for (uint32_t i = 0; i < method_total; i++) {
+        const dex_member_t* member = &members[field_total + i];
+        const dex_method_id_t* id = dex_get_method_id(dex, member->idx);
+        const dex_proto_id_t* proto = id ? dex_get_proto_id(dex, id->proto_idx) : NULL;
+        art_method_t* method = &klass->methods[i];
+        char signature[512];
+        
+        if (!proto || !(method->name = dex_get_string(dex, id->name_idx)) ||
+            !(method->shorty = dex_get_string(dex, proto->shorty_idx)) ||
+            art_interp_build_signature(dex, id->proto_idx, signature, sizeof(signature)) != 0 ||
+            !(method->signature = strdup(signature))) {
+            goto fail;
+        }
+        klass->method_count = i + 1;
+        
+        method->klass = klass;
+        method->access_flags = member->access_flags;
+        method->method_idx = member->idx;
+        method->vtable_index = DEX_NO_INDEX;
+        
+        uint16_t words = art_interp_shorty_words(method->shorty, (member->access_flags & DEX_ACC_STATIC) != 0);
+        if (member->code_off) {
+            method->code = dex_get_code_item(dex, member->code_off);
+            if (!method->code || method->code->ins_size != words) {
+                goto fail;
+            }
+            method->registers_size = method->code->registers_size;
+            method->ins_size = method->code->ins_size;
+        } else {
+            method->registers_size = words;
+            method->ins_size = words;
+        }
+        
+        if (member->access_flags & DEX_ACC_NATIVE) {
+            method->native = art_interp_find_native(klass->descriptor, method->name, method->signature);
+        }
+    }
+    
+    // vtable: üst sınıfın tablosu, üzerine yazılanlar yerinde, yeniler sonda
+    klass->vtable = (art_method_t**)malloc(((superclass ? superclass->vtable_size : 0) +
+                                            dex_class->virtual_methods_size + 1) * sizeof(art_method_t*));
+    if (!klass->vtable) {
+        goto fail;
+    }
+    if (superclass) {
+        memcpy(klass->vtable, superclass->vtable, superclass->vtable_size * sizeof(art_method_t*));
+        klass->vtable_size = superclass->vtable_size;
+    }
+    
+    for (uint32_t i = dex_class->direct_methods_size; i < method_total; i++) {
+        art_method_t* method = &klass->methods[i];
+        uint32_t slot = klass->vtable_size;
+        
+        for (uint32_t v = 0; v < klass->vtable_size; v++) {
+            if (strcmp(klass->vtable[v]->name, method->name) == 0 &&
+                strcmp(klass->vtable[v]->signature, method->signature) == 0) {
+                slot = v;
+                break;
+            }
+        }
+        
+        method->vtable_index = slot;
+        klass->vtable[slot] = method;
+        if (slot == klass->vtable_size) {
+            klass->vtable_size++;
+        }
+    }
+    
+    // Statik referans alanları kök olarak kaydedilir
+    klass->statics = (art_value_t*)calloc(klass->static_count + 1, sizeof(art_value_t));
+    if (!klass->statics) {
+        goto fail;
+    }
+    for (uint32_t i = 0; i < dex_class->static_fields_size; i++) {
+        if (klass->fields[i].is_ref) {
+            art_heap_add_root(&klass->statics[klass->fields[i].offset].l);
+        }
+    }
+    
+    free(members);
+    
+    klass->state = ART_CLASS_LINKED;
+    klass->next = art_interp_classes;
+    art_interp_classes = klass;
+    art_interp_stats.linked_classes++;
+    __atomic_store_n(&dex_class->runtime, klass, __ATOMIC_RELEASE);
+    
+    return klass;
+    
+fail:
+    for (uint32_t i = 0; i < klass->method_count; i++) {
+        free((void*)klass->methods[i].signature);
+    }
+    free(klass->interfaces);
+    free(klass->fields);
+    free(klass->methods);
+    free(klass->vtable);
+    free(klass);
+    free(members);
+    
+    return NULL;
+}
+
+// Sınıfı tanımlayıcıyla bul: önce yükleyici (üst yükleyici önce), sonra
+// başvuran DEX. art_interp_lock tutulur.
+static art_class_t* art_interp_lookup_class(dex_file_t* context, const char* descriptor) {
+    if (descriptor[0] == '[') {
+        return art_interp_array_class(context, descriptor);
+    }
+    
+    if (descriptor[0] != 'L') {
+        return NULL;  // İlkel tiplerin sınıfı yok
+    }
+    
+    dex_class_t* dex_class = NULL;
+    if ((!art_interp_resolver || art_interp_resolver(descriptor, &dex_class) != 0) &&
+        (!context || dex_find_class(context, descriptor, &dex_class) != 0)) {
+        return NULL;
+    }
+    
+    return art_interp_link(dex_class);
+}
+
+// Dizi sınıfını bul ya da oluştur
+static art_class_t* art_interp_array_class(dex_file_t* context, const char* descriptor) {
+    for (art_class_t* klass = art_interp_classes; klass; klass = klass->next) {
+        if (!klass->dex_class && strcmp(klass->descriptor, descriptor) == 0) {
+            return klass;
+        }
+    }
+    
+    const char* component_descriptor = descriptor + 1;
+    art_class_t* component = NULL;
+    uint8_t size = 0;
+    
+    switch (component_descriptor[0]) {
+        case 'Z': case 'B': size = 1; break;
+        case 'C': case 'S': size = 2; break;
+        case 'I': case 'F': size = 4; break;
+        case 'J': case 'D': size = 8; break;
+        case 'L': case '[':
+            component = art_interp_lookup_class(context, component_descriptor);
+            if (!component) {
+                return NULL;
+            }
+            break;
+        default:
+            return NULL;
+    }
+    
+    if (size && component_descriptor[1] != '\0') {
+        return NULL;
+    }
+    
+    art_class_t* klass = (art_class_t*)calloc(1, sizeof(art_class_t));
+    if (!klass || !(klass->descriptor = strdup(descriptor))) {
+        free(klass);
+        return NULL;
+    }
+    
+    // Diziler Object'in sanal metotlarını devralır
+    klass->superclass = art_interp_lookup_class(context, "Ljava/lang/Object;");
+    klass->component = component;
+    klass->component_size = size;
+    klass->access_flags = DEX_ACC_PUBLIC | DEX_ACC_FINAL | DEX_ACC_ABSTRACT;
+    klass->state = ART_CLASS_INITIALIZED;
+    
+    if (klass->superclass && klass->superclass->vtable_size > 0) {
+        klass->vtable = (art_method_t**)malloc(klass->superclass->vtable_size * sizeof(art_method_t*));
+        if (!klass->vtable) {
+            free((void*)klass->descriptor);
+            free(klass);
+            return NULL;
+        }
+        memcpy(klass->vtable, klass->superclass->vtable, klass->superclass->vtable_size * sizeof(art_method_t*));
+        klass->vtable_size = klass->superclass->vtable_size;
+    }
+    
+    klass->next = art_interp_classes;
+    art_interp_classes = klass;
+    
+    return klass;
+}
+
+// DEX'in çözüm tablolarını bul ya da oluştur (art_interp_lock tutulur)
+static art_dex_cache_t* art_interp_dex_cache(dex_file_t* dex) {
+    for (art_dex_cache_t* cache = art_interp_caches; cache; cache = cache->next) {
+        if (cache->dex == dex) {
+            return cache;
+        }
+    }
+    
+    const dex_header_t* header = dex_get_header(dex);
+    art_dex_cache_t* cache = (art_dex_cache_t*)calloc(1, sizeof(art_dex_cache_t));
+    if (!cache) {
+        return NULL;
+    }
+    
+    cache->dex = dex;
+    cache->types = (art_class_t**)calloc(header->type_ids_size + 1, sizeof(art_class_t*));
+    cache->methods = (art_method_t**)calloc(header->method_ids_size + 1, sizeof(art_method_t*));
+    cache->fields = (art_field_t**)calloc(header->field_ids_size + 1, sizeof(art_field_t*));
+    
+    if (!cache->types || !cache->methods || !cache->fields) {
+        free(cache->types);
+        free(cache->methods);
+        free(cache->fields);
+        free(cache);
+        return NULL;
+    }
+    
+    cache->next = art_interp_caches;
+    art_interp_caches = cache;
+    
+    return cache;
+}
+
+// Prototipten "(IJ)V" biçiminde imza üret
+static int art_interp_build_signature(dex_file_t* dex, uint32_t proto_idx, char* buffer, size_t size) {
+    const dex_proto_id_t* proto = dex_get_proto_id(dex, proto_idx);
+    if (!proto) {
+        return -1;
+    }
+    
+    uint32_t count = 0;
+    const uint16_t* parameters = dex_get_type_list(dex, proto->parameters_off, &count);
+    const char* return_type = dex_get_type_descriptor(dex, proto->return_type_idx);
+    if (!return_type || (proto->parameters_off && !parameters)) {
+        return -1;
+    }
+    
+    size_t length = 0;
+    buffer[length++] = '(';
+    
+    for (uint32_t i = 0; i <= count; i++) {
+        const char* type = i < count ? dex_get_type_descriptor(dex, parameters[i]) : return_type;
+        if (!type) {
+            return -1;
+        }
+        
+        if (i == count) {
+            buffer[length++] = ')';
+        }
+        
+        size_t type_length = strlen(type);
+        if (length + type_length + 2 > size) {
+            return -1;
+        }
+        memcpy(buffer + length, type, type_length);
+        length += type_length;
+    }
+    
+    buffer[length] = '\0';
+    
+    return 0;
+}
+
+// Parametre yazmacı sayısı (alıcı dahil; J ve D iki yazmaç)
+static uint16_t art_interp_shorty_words(const char* shorty, int is_static) {
+    uint16_t words = is_static ? 0 : 1;
+    
+    for (const char* type = shorty + 1; *type; type++) {
+        words += (*type == 'J' || *type == 'D') ? 2 : 1;
+    }
+    
+    return words;
+}
+
+// Kayıtlı yerel metodu bul (art_interp_lock tutulur)
+static art_native_method_t art_interp_find_native(const char* descriptor, const char* name, const char* signature) {
+    for (art_native_entry_t* entry = art_interp_natives; entry; entry = entry->next) {
+        if (strcmp(entry->descriptor, descriptor) == 0 && strcmp(entry->name, name) == 0 &&
+            strcmp(entry->signature, signature) == 0) {
+            return entry->function;
+        }
+    }
+    
+    return NULL;
+}
+
+// Yalnızca bu sınıfta tanımlı metotlarda ara
+static art_method_t* art_interp_find_declared(art_class_t* klass, const char* name, const char* signature) {
+    for (uint32_t i = 0; i < klass->method_count; i++) {
+        art_method_t* method = &klass->methods[i];
+        if (strcmp(method->name, name) == 0 && strcmp(method->signature, signature) == 0) {
+            return method;
+        }
+    }
+    
+    return NULL;
+}
+
+// Sınıfın vtable'ında ad ve imzayla ara (arayüz çağrıları)
+static art_method_t* art_interp_find_virtual(art_class_t* klass, const char* name, const char* signature) {
+    for (uint32_t i = 0; i < klass->vtable_size; i++) {
+        art_method_t* method = klass->vtable[i];
+        if (strcmp(method->name, name) == 0 && strcmp(method->signature, signature) == 0) {
+            return method;
+        }
+    }
+    
+    return NULL;
+}
+
+// from türündeki bir nesne to türüne atanabilir mi?
+static int art_interp_is_assignable(art_class_t* from, art_class_t* to) {
+    if (from == to) {
+        return 1;
+    }
+    
+    if (!from || !to) {
+        return 0;
+    }
+    
+    if (!to->superclass && strcmp(to->descriptor, "Ljava/lang/Object;") == 0) {
+        return 1;
+    }
+    
+    if (to->descriptor[0] == '[') {
+        if (from->descriptor[0] != '[') {
+            return 0;
+        }
+        if (to->component_size || from->component_size) {
+            return strcmp(from->descriptor, to->descriptor) == 0;
+        }
+        return art_interp_is_assignable(from->component, to->component);
+    }
+    
+    if (to->access_flags & DEX_ACC_INTERFACE) {
+        for (art_class_t* current = from; current; current = current->superclass) {
+            for (uint32_t i = 0; i < current->interface_count; i++) {
+                if (art_interp_is_assignable(current->interfaces[i], to)) {
+                    return 1;
+                }
+            }
+        }
+        return 0;
+    }
+    
+    for (art_class_t* current = from->superclass; current; current = current->superclass) {
+        if (current == to) {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+// type_idx'i başvuran sınıfın DEX'i bağlamında çöz
+static art_class_t* art_interp_resolve_type(art_interp_thread_t* thread, art_class_t* referrer, uint32_t type_idx) {
+    art_dex_cache_t* cache = (art_dex_cache_t*)referrer->dex_cache;
+    art_class_t* klass = __atomic_load_n(&cache->types[type_idx], __ATOMIC_ACQUIRE);
+    if (klass) {
+        return klass;
+    }
+    
+    const char* descriptor = dex_get_type_descriptor(cache->dex, type_idx);
+    if (!descriptor) {
+        art_interp_throw(thread, "Ljava/lang/VerifyError;", "type@%u", type_idx);
+        return NULL;
+    }
+    
+    art_interp_lock_enter();
+    klass = art_interp_lookup_class(cache->dex, descriptor);
+    pthread_mutex_unlock(&art_interp_lock);
+    
+    if (!klass) {
+        art_interp_throw(thread, "Ljava/lang/NoClassDefFoundError;", "%s", descriptor);
+        return NULL;
+    }
+    
+    __atomic_store_n(&cache->types[type_idx], klass, __ATOMIC_RELEASE);
+    
+    return klass;
+}
+
+// field_idx'i çöz: tanımlayan sınıf ve üst sınıflarında ad ve tiple ara
+static art_field_t* art_interp_resolve_field(art_interp_thread_t* thread, art_class_t* referrer, uint32_t field_idx, int is_static) {
+    art_dex_cache_t* cache = (art_dex_cache_t*)referrer->dex_cache;
+    art_field_t* field = __atomic_load_n(&cache->fields[field_idx], __ATOMIC_ACQUIRE);
+    
+    if (!field) {
+        const dex_field_id_t* id = dex_get_field_id(cache->dex, field_idx);
+        const char* name = id ? dex_get_string(cache->dex, id->name_idx) : NULL;
+        const char* type = id ? dex_get_type_descriptor(cache->dex, id->type_idx) : NULL;
+        if (!name || !type) {
+            art_interp_throw(thread, "Ljava/lang/VerifyError;", "field@%u", field_idx);
+            return NULL;
+        }
+        
+        art_class_t* klass = art_interp_resolve_type(thread, referrer, id->class_idx);
+        if (!klass) {
+            return NULL;
+        }
+        
+        for (art_class_t* current = klass; current && !field; current = current->superclass) {
+            for (uint32_t i = 0; i < current->field_count; i++) {
+                art_field_t* candidate = &current->fields[i];
+                if (strcmp(candidate->name, name) == 0 && strcmp(candidate->type, type) == 0) {
+                    field = candidate;
+                    break;
+                }
+            }
+        }
+        
+        if (!field) {
+            art_interp_throw(thread, "Ljava/lang/NoSuchFieldError;", "%s.%s", klass->descriptor, name);
+            return NULL;
+        }
+        
+        __atomic_store_n(&cache->fields[field_idx], field, __ATOMIC_RELEASE);
+    }
+    
+    if (field->is_static != is_static) {
+        art_interp_throw(thread, "Ljava/lang/IncompatibleClassChangeError;", "%s", field->name);
+        return NULL;
+    }
+    
+    return field;
+}
+
+// method_idx'i çöz: sınıf zinciri, bulunamazsa arayüzler
+static art_method_t* art_interp_resolve_method(art_interp_thread_t* thread, art_class_t* referrer, uint32_t method_idx) {
+    art_dex_cache_t* cache = (art_dex_cache_t*)referrer->dex_cache;
+    art_method_t* method = __atomic_load_n(&cache->methods[method_idx], __ATOMIC_ACQUIRE);
+    if (method) {
+        return method;
+    }
+    
+    const dex_method_id_t* id = dex_get_method_id(cache->dex, method_idx);
+    const char* name = id ? dex_get_string(cache->dex, id->name_idx) : NULL;
+    char signature[512];
+    
+    if (!name || art_interp_build_signature(cache->dex, id->proto_idx, signature, sizeof(signature)) != 0) {
+        art_interp_throw(thread, "Ljava/lang/VerifyError;", "method@%u", method_idx);
+        return NULL;
+    }
+    
+    art_class_t* klass = art_interp_resolve_type(thread, referrer, id->class_idx);
+    if (!klass) {
+        return NULL;
+    }
+    
+    if (art_interp_find_method(klass, name, signature, &method) != 0) {
+        // Soyut sınıflar ve arayüzler üst arayüzlerin metotlarını çağırabilir
+        for (art_class_t* current = klass; current && !method; current = current->superclass) {
+            for (uint32_t i = 0; i < current->interface_count && !method; i++) {
+                art_interp_find_method(current->interfaces[i], name, signature, &method);
+            }
+        }
+    }
+    
+    if (!method) {
+        art_interp_throw(thread, "Ljava/lang/NoSuchMethodError;", "%s.%s%s", klass->descriptor, name, signature);
+        return NULL;
+    }
+    
+    __atomic_store_n(&cache->methods[method_idx], method, __ATOMIC_RELEASE);
+    
+    return method;
+}
+
+// Sınıfı başlat: önce üst sınıf, sonra <clinit>. Başka iş parçacığı
+// başlatıyorsa beklenir; aynı iş parçacığının iç içe istekleri geçer.
+static int art_interp_initialize_class(art_interp_thread_t* thread, art_class_t* klass) {
+    if (__atomic_load_n(&klass->state, __ATOMIC_ACQUIRE) == ART_CLASS_INITIALIZED) {
+        return 0;
+    }
+    
+    art_interp_lock_enter();
+    for (;;) {
+        if (klass->state == ART_CLASS_INITIALIZED ||
+            (klass->state == ART_CLASS_INITIALIZING && klass->init_thread == thread)) {
+            pthread_mutex_unlock(&art_interp_lock);
+            return 0;
+        }
+        
+        if (klass->state == ART_CLASS_ERROR) {
+            pthread_mutex_unlock(&art_interp_lock);
+            return art_interp_throw(thread, "Ljava/lang/NoClassDefFoundError;", "%s", klass->descriptor);
+        }
+        
+        if (klass->state == ART_CLASS_LINKED) {
+            break;
+        }
+        
+        art_heap_thread_block();
+        pthread_cond_wait(&art_interp_init_cond, &art_interp_lock);
+        art_heap_thread_unblock();
+    }
+    
+    klass->state = ART_CLASS_INITIALIZING;
+    klass->init_thread = thread;
+    pthread_mutex_unlock(&art_interp_lock);
+    
+    int status = klass->superclass ? art_interp_initialize_class(thread, klass->superclass) : 0;
+    if (status == 0) {
+        art_method_t* initializer = art_interp_find_declared(klass, "<clinit>", "()V");
+        uint32_t base;
+        if (initializer && initializer->code) {
+            status = art_interp_reserve_frame(thread, initializer, &base);
+            if (status == 0) {
+                status = art_interp_enter(thread, initializer, base);
+            }
+        }
+    }
+    
+    art_interp_lock_enter();
+    klass->init_thread = NULL;
+    __atomic_store_n(&klass->state, status == 0 ? ART_CLASS_INITIALIZED : ART_CLASS_ERROR, __ATOMIC_RELEASE);
+    pthread_cond_broadcast(&art_interp_init_cond);
+    pthread_mutex_unlock(&art_interp_lock);
+    
+    return status;
+}
+
+// Komut biçimlerinin kod birimi genişliği
+static const uint8_t art_interp_widths[] = {
+    [FMT_NONE] = 0, [FMT_10X] = 1, [FMT_12X] = 1, [FMT_11N] = 1, [FMT_11X] = 1, [FMT_10T] = 1,
+    [FMT_20T] = 2, [FMT_22X] = 2, [FMT_21T] = 2, [FMT_21S] = 2, [FMT_21H] = 2, [FMT_21C] = 2,
+    [FMT_23X] = 2, [FMT_22B] = 2, [FMT_22T] = 2, [FMT_22S] = 2, [FMT_22C] = 2,
+    [FMT_32X] = 3, [FMT_30T] = 3, [FMT_31T] = 3, [FMT_31I] = 3, [FMT_31C] = 3,
+    [FMT_35C] = 3, [FMT_3RC] = 3, [FMT_51L] = 5, [FMT_45CC] = 4, [FMT_4RCC] = 4
+};
+
+// Metodu ilk çalışmadan önce hazırla: komut sınırlarını, yazmaçları, dal ve
+// tablo hedeflerini, dizinleri doğrula; dizin işlenenlerini önbellek yuvasına
+// çevir. Kopyanın sonundaki geçersiz komut, sondan taşan akışı yakalar.
+// art_interp_lock tutulur.
+static int art_interp_prepare(art_method_t* method, dex_file_t* dex) {
+    const dex_code_item_t* code = method->code;
+    const dex_header_t* header = dex_get_header(dex);
+    uint32_t size = code->insns_size;
+    
+    if (size == 0 || code->ins_size > code->registers_size) {
+        return ART_INTERP_ERROR_INVALID;
+    }
+    
+    // İstisnalar nesne değil metin olarak taşınır: try/catch, move-exception,
+    // const-string ve const-class çalıştırılamaz. Metot çalışmanın ortasında
+    // değil, hazırlanırken (VerifyError) reddedilir.
+    if (code->tries_size != 0) {
+        return ART_INTERP_ERROR_UNSUPPORTED;
+    }
+    
+    uint16_t* insns = (uint16_t*)malloc((size + 1) * sizeof(uint16_t));
+    uint8_t* marks = (uint8_t*)calloc(size, 1);  // 1: komut başı, 2: tablo başı
+    if (!insns || !marks) {
+        free(insns);
+        free(marks);
+        return ART_INTERP_ERROR_NO_MEMORY;
+    }
+    
+    memcpy(insns, code->insns, size * sizeof(uint16_t));
+    insns[size] = 0x0073;
+    
+    // 1. geçiş: komut sınırları
+    int status = ART_INTERP_ERROR_INVALID;
+    uint32_t cache_count = 0;
+    for (uint32_t pc = 0; pc < size; ) {
+        uint8_t opcode = insns[pc] & 0xFF;
+        
+        if (opcode == 0x00 && (insns[pc] >> 8) != 0) {
+            uint32_t payload = art_interp_payload_size(insns + pc, size - pc);
+            if (payload == 0) {
+                goto invalid;
+            }
+            marks[pc] = 2;
+            pc += payload;
+            continue;
+        }
+        
+        uint8_t width = art_interp_widths[art_interp_formats[opcode]];
+        if (width == 0 || pc + width > size) {
+            goto invalid;
+        }
+        
+        if (opcode == 0x0d || (opcode >= 0x1a && opcode <= 0x1c)) {
+            status = ART_INTERP_ERROR_UNSUPPORTED;
+            goto invalid;
+        }
+        
+        marks[pc] = 1;
+        if (art_interp_index_kind(opcode) != INDEX_NONE) {
+            cache_count++;
+        }
+        pc += width;
+    }
+    
+    if (cache_count > 0xFFFF) {
+        goto invalid;
+    }
+    
+    // 2. geçiş: işlenenler
+    for (uint32_t pc = 0; pc < size; pc++) {
+        if (marks[pc] == 1 && art_interp_check_instruction(method, header, insns, pc, size, marks) != 0) {
+            goto invalid;
+        }
+    }
+    
+    art_inline_cache_t* caches = (art_inline_cache_t*)calloc(cache_count + 1, sizeof(art_inline_cache_t));
+    if (!caches) {
+        free(insns);
+        free(marks);
+        return ART_INTERP_ERROR_NO_MEMORY;
+    }
+    
+    // 3. geçiş: dizinleri yuvalara çevir
+    uint32_t slot = 0;
+    for (uint32_t pc = 0; pc < size; pc++) {
+        if (marks[pc] == 1 && art_interp_index_kind(insns[pc] & 0xFF) != INDEX_NONE) {
+            caches[slot].index = insns[pc + 1];
+            insns[pc + 1] = (uint16_t)slot++;
+        }
+    }
+    
+    free(marks);
+    
+    method->caches = caches;
+    method->cache_count = cache_count;
+    __atomic_store_n(&method->insns, insns, __ATOMIC_RELEASE);
+    
+    // Önceden derlenmiş kod varsa metot ilk çağrıdan itibaren onu kullanır.
+    // Sınıfsız geçici metotlar (art_interp_prepare_method) sayılmaz.
+    if (method->klass) {
+        art_interp_stats.prepared_methods++;
+        art_interp_stats.cache_slots += cache_count;
+        art_aot_bind(method);
+    }
+    
+    return 0;
+    
+invalid:
+    free(insns);
+    free(marks);
+    
+    return status;
+}
+
+// Veri tablosunun kod birimi uzunluğu; bozuksa 0
+static uint32_t art_interp_payload_size(const uint16_t* insns, uint32_t remaining) {
+    uint64_t size;
+    
+    if (remaining < 2) {
+        return 0;
+    }
+    
+    switch (insns[0]) {
+        case 0x0100:  // packed-switch: boyut, ilk anahtar, hedefler
+            size = 4 + (uint64_t)insns[1] * 2;
+            break;
+        case 0x0200:  // sparse-switch: boyut, anahtarlar, hedefler
+            size = 2 + (uint64_t)insns[1] * 4;
+            break;
+        case 0x0300:  // fill-array-data: eleman boyutu, sayı, veri
+            if (remaining < 4) {
+                return 0;
+            }
+            size = 4 + ((uint64_t)insns[1] * (insns[2] | ((uint32_t)insns[3] << 16)) + 1) / 2;
+            break;
+        default:
+            return 0;
+    }
+    
+    return size <= remaining ? (uint32_t)size : 0;
+}
+
+// Komutun ya da veri tablosunun kod birimi uzunluğu; bozuksa 0
+uint32_t art_interp_insn_width(const uint16_t* insns, uint32_t remaining) {
+    if ((insns[0] & 0xFF) == 0x00 && (insns[0] >> 8) != 0) {
+        return art_interp_payload_size(insns, remaining);
+    }
+    
+    return art_interp_widths[art_interp_formats[insns[0] & 0xFF]];
+}
+
+// Dal hedefi bir komut başı mı?
+#define ART_INTERP_TARGET_OK(target) \
+    ((target) >= 0 && (target) < (int64_t)size && marks[(target)] == 1)
+
+// Tek komutun işlenenlerini doğrula
+static int art_interp_check_instruction(art_method_t* method, const dex_header_t* header, const uint16_t* insns, uint32_t pc,
+                                        uint32_t size, const uint8_t* marks) {
+    const uint16_t* insn = insns + pc;
+    uint8_t opcode = insn[0] & 0xFF;
+    uint32_t registers = method->registers_size;
+    uint32_t a = insn[0] >> 8;
+    uint32_t nibble_a = a & 0x0F;
+    uint32_t nibble_b = insn[0] >> 12;
+    int64_t target;
+    
+    switch (art_interp_formats[opcode]) {
+        case FMT_10X:
+            break;
+        case FMT_12X:
+        case FMT_22S:
+        case FMT_22C:
+            if (nibble_a >= registers || nibble_b >= registers) {
+                return -1;
+            }
+            break;
+        case FMT_11N:
+            if (nibble_a >= registers) {
+                return -1;
+            }
+            break;
+        case FMT_11X:
+        case FMT_21S:
+        case FMT_21H:
+        case FMT_21C:
+        case FMT_31I:
+        case FMT_31C:
+        case FMT_51L:
+            if (a >= registers) {
+                return -1;
+            }
+            break;
+        case FMT_10T:
+            target = (int64_t)pc + (int8_t)a;
+            if (!ART_INTERP_TARGET_OK(target)) {
+                return -1;
+            }
+            break;
+        case FMT_20T:
+            target = (int64_t)pc + (int16_t)insn[1];
+            if (!ART_INTERP_TARGET_OK(target)) {
+                return -1;
+            }
+            break;
+        case FMT_30T:
+            target = (int64_t)pc + (int32_t)(insn[1] | ((uint32_t)insn[2] << 16));
+            if (!ART_INTERP_TARGET_OK(target)) {
+                return -1;
+            }
+            break;
+        case FMT_22X:
+            if (a >= registers || insn[1] >= registers) {
+                return -1;
+            }
+            break;
+        case FMT_32X:
+            if (insn[1] >= registers || insn[2] >= registers) {
+                return -1;
+            }
+            break;
+        case FMT_21T:
+            target = (int64_t)pc + (int16_t)insn[1];
+            if (a >= registers || !ART_INTERP_TARGET_OK(target)) {
+                return -1;
+            }
+            break;
+        case FMT_22T:
+            target = (int64_t)pc + (int16_t)insn[1];
+            if (nibble_a >= registers || nibble_b >= registers || !ART_INTERP_TARGET_OK(target)) {
+                return -1;
+            }
+            break;
+        case FMT_23X:
+            if (a >= registers || (insn[1] & 0xFF) >= registers || (insn[1] >> 8) >= registers) {
+                return -1;
+            }
+            break;
+        case FMT_22B:
+            if (a >= registers || (insn[1] & 0xFF) >= registers) {
+                return -1;
+            }
+            break;
+        case FMT_31T: {
+            // Tablo, komuta göreli ve doğru türde olmalı
+            static const uint16_t idents[] = { 0x0300, 0x0100, 0x0200 };
+            uint16_t ident = idents[opcode == 0x26 ? 0 : opcode - 0x2a];
+            target = (int64_t)pc + (int32_t)(insn[1] | ((uint32_t)insn[2] << 16));
+            if (a >= registers || target < 0 || target >= (int64_t)size ||
+                marks[target] != 2 || insns[target] != ident) {
+                return -1;
+            }
+            
+            const uint16_t* payload = insns + target;
+            const uint16_t* targets = NULL;
+            if (ident == 0x0100) {
+                targets = payload + 4;
+            } else if (ident == 0x0200) {
+                targets = payload + 2 + payload[1] * 2;
+            }
+            for (uint32_t i = 0; targets && i < payload[1]; i++) {
+                int64_t case_target = (int64_t)pc + (int32_t)(targets[i * 2] | ((uint32_t)targets[i * 2 + 1] << 16));
+                if (!ART_INTERP_TARGET_OK(case_target)) {
+                    return -1;
+                }
+            }
+            if (ident == 0x0300 && payload[1] != 1 && payload[1] != 2 && payload[1] != 4 && payload[1] != 8) {
+                return -1;
+            }
+            break;
+        }
+        case FMT_35C:
+            if (nibble_b > 5) {
+                return -1;
+            }
+            for (uint32_t i = 0; i < nibble_b; i++) {
+                uint32_t reg = i < 4 ? (insn[2] >> (i * 4)) & 0x0F : nibble_a;
+                if (reg >= registers) {
+                    return -1;
+                }
+            }
+            break;
+        case FMT_3RC:
+            if ((uint32_t)insn[2] + a > registers) {
+                return -1;
+            }
+            break;
+        case FMT_45CC:
+        case FMT_4RCC:
+            break;  // Çalışırken desteklenmiyor hatası verir
+        default:
+            return -1;
+    }
+    
+    // Dizin, DEX tablolarının içinde olmalı
+    switch (art_interp_index_kind(opcode)) {
+        case INDEX_TYPE:
+            return insn[1] < header->type_ids_size ? 0 : -1;
+        case INDEX_FIELD:
+            return insn[1] < header->field_ids_size ? 0 : -1;
+        case INDEX_METHOD:
+            return insn[1] < header->method_ids_size ? 0 : -1;
+        default:
+            return 0;
+    }
+}
+
+#undef ART_INTERP_TARGET_OK
+
+// Komutun önbellek yuvası gerektiren dizin türü
+static int art_interp_index_kind(uint8_t opcode) {
+    if (opcode == 0x1f || opcode == 0x20 || (opcode >= 0x22 && opcode <= 0x25)) {
+        return INDEX_TYPE;
+    }
+    if (opcode >= 0x52 && opcode <= 0x6d) {
+        return INDEX_FIELD;
+    }
+    if ((opcode >= 0x6e && opcode <= 0x72) || (opcode >= 0x74 && opcode <= 0x78)) {
+        return INDEX_METHOD;
+    }
+    
+    return INDEX_NONE;
+}
+
+// Kayan nokta yazmaçları bit düzeyinde saklanır
+static inline float art_interp_get_float(uint32_t bits) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static inline uint32_t art_interp_float_bits(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static inline double art_interp_get_double(uint64_t bits) {
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static inline uint64_t art_interp_double_bits(double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+// Java dönüşümleri: NaN sıfır olur, taşanlar doyurulur
+static inline int32_t art_interp_to_int(double value) {
+    if (value != value) {
+        return 0;
+    }
+    if (value >= 2147483647.0) {
+        return INT32_MAX;
+    }
+    if (value <= -2147483648.0) {
+        return INT32_MIN;
+    }
+    return (int32_t)value;
+}
+
+static inline int64_t art_interp_to_long(double value) {
+    if (value != value) {
+        return 0;
+    }
+    if (value >= 9223372036854775807.0) {
+        return INT64_MAX;
+    }
+    if (value <= -9223372036854775808.0) {
+        return INT64_MIN;
+    }
+    return (int64_t)value;
+}
+
+// Sıfıra bölme kontrolü çağıranda; MIN / -1 taşması Java'daki gibi sarılır
+static inline uint32_t art_interp_div_int(uint32_t x, uint32_t y, int remainder) {
+    if ((int32_t)y == -1) {
+        return remainder ? 0 : 0u - x;
+    }
+    return (uint32_t)(remainder ? (int32_t)x % (int32_t)y : (int32_t)x / (int32_t)y);
+}
+
+static inline uint64_t art_interp_div_long(uint64_t x, uint64_t y, int remainder) {
+    if ((int64_t)y == -1) {
+        return remainder ? 0 : 0u - x;
+    }
+    return (uint64_t)(remainder ? (int64_t)x % (int64_t)y : (int64_t)x / (int64_t)y);
+}
+
+// Karşılaştırma: NaN, cmpl'de -1, cmpg'de 1 verir
+static inline uint32_t art_interp_compare(double x, double y, int nan_result) {
+    if (x > y) {
+        return 1;
+    }
+    if (x == y) {
+        return 0;
+    }
+    return x < y ? (uint32_t)-1 : (uint32_t)nan_result;
+}
+
+// Alan komutunun yuvasını çöz ve komutun beklediği türle karşılaştır
+static art_field_t* art_interp_field_slot(art_interp_thread_t* thread, art_method_t* method, uint16_t slot,
+                                          uint8_t opcode, int is_static) {
+    // Komut grubundaki sıra: tam sayı, geniş, nesne, boolean, byte, char, short
+    static const uint8_t sizes[] = { 4, 8, 0, 1, 1, 2, 2 };
+    uint8_t kind = (uint8_t)((opcode - 0x52) % 7);
+    
+    art_field_t* field = art_interp_resolve_field(thread, method->klass, method->caches[slot].index, is_static);
+    if (!field) {
+        return NULL;
+    }
+    
+    if (field->is_ref != (kind == 2) || (!field->is_ref && field->size != sizes[kind])) {
+        art_interp_throw(thread, "Ljava/lang/VerifyError;", "%s: alan tipi %s", field->name, field->type);
+        return NULL;
+    }
+    
+    return field;
+}
+
+// Yazmaç erişimi: nesne yazmaçlarında fp yalnızca boş olmama bilgisidir
+#define INST_A          ((inst >> 8) & 0x0F)
+#define INST_B          (inst >> 12)
+#define INST_AA         (inst >> 8)
+#define DISPATCH()      do { inst = *pc; goto *handlers[inst & 0xFF]; } while (0)
+#define NEXT(width)     do { pc += (width); DISPATCH(); } while (0)
+#define BRANCH(offset)  do { int32_t branch = (offset); pc += branch; \
+                             if (branch <= 0) { art_heap_safepoint(); if (art_jit_threshold || method->jit_code) goto backedge; } \
+                             DISPATCH(); } while (0)
+#define SET_INT(r, v)   do { fp[r] = (uint32_t)(v); rp[r] = NULL; } while (0)
+#define GET_WIDE(r)     ((uint64_t)fp[r] | ((uint64_t)fp[(r) + 1] << 32))
+#define SET_WIDE(r, v)  do { uint64_t wide = (v); fp[r] = (uint32_t)wide; fp[(r) + 1] = (uint32_t)(wide >> 32); \
+                             rp[r] = NULL; rp[(r) + 1] = NULL; } while (0)
+#define SET_REF(r, o)   do { art_object_t* ref = (o); rp[r] = ref; fp[r] = ref != NULL; } while (0)
+#define THROW(...)      do { status = art_interp_throw(thread, __VA_ARGS__); goto exception; } while (0)
+#define CHECK_STATUS(s) do { status = (s); if (status != 0) goto exception; } while (0)
+
+// İkili işlem biçimleri: dest, x ve y tanımlanır, gövde sonucu yazar
+#define FORM_23X(body)        { uint32_t dest = INST_AA, x = fp[pc[1] & 0xFF], y = fp[pc[1] >> 8]; body; NEXT(2); }
+#define FORM_2ADDR(body)      { uint32_t dest = INST_A, x = fp[INST_A], y = fp[INST_B]; body; NEXT(1); }
+#define FORM_LIT16(body)      { uint32_t dest = INST_A, x = fp[INST_B], y = (uint32_t)(int32_t)(int16_t)pc[1]; body; NEXT(2); }
+#define FORM_LIT8(body)       { uint32_t dest = INST_AA, x = fp[pc[1] & 0xFF], y = (uint32_t)(int32_t)(int8_t)(pc[1] >> 8); body; NEXT(2); }
+#define FORM_WIDE_23X(body)   { uint32_t dest = INST_AA; uint64_t x = GET_WIDE(pc[1] & 0xFF), y = GET_WIDE(pc[1] >> 8); body; NEXT(2); }
+#define FORM_WIDE_2ADDR(body) { uint32_t dest = INST_A; uint64_t x = GET_WIDE(INST_A), y = GET_WIDE(INST_B); body; NEXT(1); }
+#define INT_DIV(remainder)    if ((int32_t)y == 0) THROW("Ljava/lang/ArithmeticException;", "divide by zero"); \
+                              SET_INT(dest, art_interp_div_int(x, y, remainder))
+#define LONG_DIV(remainder)   if ((int64_t)y == 0) THROW("Ljava/lang/ArithmeticException;", "divide by zero"); \
+                              SET_WIDE(dest, art_interp_div_long(x, y, remainder))
+#define FLOAT_OP(expr)        { float fx = art_interp_get_float(x), fy = art_interp_get_float(y); (void)fy; \
+                                SET_INT(dest, art_interp_float_bits(expr)); }
+#define DOUBLE_OP(expr)       { double dx = art_interp_get_double(x), dy = art_interp_get_double(y); (void)dy; \
+                                SET_WIDE(dest, art_interp_double_bits(expr)); }
+
+// Dizi erişimi: nesne, tip ve sınır kontrolü; element_size 0 referans dizisidir
+#define ARRAY_CHECK(element_size) \
+    array = rp[pc[1] & 0xFF]; \
+    index = fp[pc[1] >> 8]; \
+    if (!array) THROW("Ljava/lang/NullPointerException;", "dizi boş"); \
+    klass = (art_class_t*)array->klass; \
+    if (klass->descriptor[0] != '[' || klass->component_size != (element_size)) \
+        THROW("Ljava/lang/ArrayStoreException;", "%s", klass->descriptor); \
+    if (index >= (uint32_t)ART_ARRAY_LENGTH(array)) \
+        THROW("Ljava/lang/ArrayIndexOutOfBoundsException;", "length=%d; index=%d", ART_ARRAY_LENGTH(array), (int32_t)index)
+
+#define ARRAY_GET(type, element_size) \
+    { ARRAY_CHECK(element_size); type value; memcpy(&value, ART_ARRAY_DATA(array) + (size_t)index * sizeof(type), sizeof(type)); \
+      SET_INT(INST_AA, (int32_t)value); NEXT(2); }
+#define ARRAY_PUT(type, element_size) \
+    { ARRAY_CHECK(element_size); type value = (type)fp[INST_AA]; memcpy(ART_ARRAY_DATA(array) + (size_t)index * sizeof(type), &value, sizeof(type)); \
+      NEXT(2); }
+
+// Örnek alanı: önbellekteki sınıf alıcıyla aynıysa doğrudan erişilir
+#define INSTANCE_FIELD() \
+    object = rp[INST_B]; \
+    field = caches[pc[1]].field; \
+    if (!object || !field || caches[pc[1]].klass != object->klass) { \
+        if (!field && !(field = caches[pc[1]].field = art_interp_field_slot(thread, method, pc[1], inst & 0xFF, 0))) goto exception_pending; \
+        if (!object) THROW("Ljava/lang/NullPointerException;", "%s", field->name); \
+        if (!art_interp_is_assignable((art_class_t*)object->klass, field->klass)) \
+            THROW("Ljava/lang/IncompatibleClassChangeError;", "%s", field->name); \
+        caches[pc[1]].klass = (art_class_t*)object->klass; \
+    }
+
+#define IGET(type) \
+    { INSTANCE_FIELD(); type value; memcpy(&value, ART_OBJECT_DATA(object) + field->offset, sizeof(type)); \
+      SET_INT(INST_A, (int32_t)value); NEXT(2); }
+#define IPUT(type) \
+    { INSTANCE_FIELD(); type value = (type)fp[INST_A]; memcpy(ART_OBJECT_DATA(object) + field->offset, &value, sizeof(type)); \
+      NEXT(2); }
+
+// Statik alan: yuvanın sınıfı, sınıf başlatıldıktan sonra yazılır
+#define STATIC_FIELD() \
+    if (__atomic_load_n(&caches[pc[1]].klass, __ATOMIC_ACQUIRE)) { \
+        field = caches[pc[1]].field; \
+    } else { \
+        if (!(field = art_interp_field_slot(thread, method, pc[1], inst & 0xFF, 1))) goto exception_pending; \
+        CHECK_STATUS(art_interp_initialize_class(thread, field->klass)); \
+        caches[pc[1]].field = field; \
+        __atomic_store_n(&caches[pc[1]].klass, field->klass, __ATOMIC_RELEASE); \
+    } \
+    slot = &field->klass->statics[field->offset]
+
+// Tip önbelleği
+#define RESOLVE_TYPE(result) \
+    if (!(result = caches[pc[1]].klass)) { \
+        if (!(result = art_interp_resolve_type(thread, method->klass, caches[pc[1]].index))) goto exception_pending; \
+        caches[pc[1]].klass = result; \
+    }
+
+// Metodun hazırlanmış kodunu çalıştır. Çerçeve yazmaçları sabit adreste olduğu
+// için toplama sonrası yalnızca yerel nesne değişkenleri yeniden okunur.
+static int art_interp_execute(art_interp_thread_t* thread, art_method_t* method, uint32_t base) {
+    static const void* const handlers[256] = {
+        [0x00] = &&op_nop,
+        [0x01] = &&op_move, [0x02] = &&op_move_from16, [0x03] = &&op_move_16,
+        [0x04] = &&op_move_wide, [0x05] = &&op_move_wide_from16, [0x06] = &&op_move_wide_16,
+        [0x07] = &&op_move, [0x08] = &&op_move_from16, [0x09] = &&op_move_16,
+        [0x0a] = &&op_move_result, [0x0b] = &&op_move_result_wide, [0x0c] = &&op_move_result_object,
+        [0x0d] = &&op_unsupported,
+        [0x0e] = &&op_return_void, [0x0f] = &&op_return, [0x10] = &&op_return_wide, [0x11] = &&op_return_object,
+        [0x12] = &&op_const_4, [0x13] = &&op_const_16, [0x14] = &&op_const, [0x15] = &&op_const_high16,
+        [0x16] = &&op_const_wide_16, [0x17] = &&op_const_wide_32, [0x18] = &&op_const_wide,
+        [0x19] = &&op_const_wide_high16,
+        [0x1a ... 0x1c] = &&op_unsupported,
+        [0x1d] = &&op_monitor_enter, [0x1e] = &&op_monitor_exit,
+        [0x1f] = &&op_check_cast, [0x20] = &&op_instance_of, [0x21] = &&op_array_length,
+        [0x22] = &&op_new_instance, [0x23] = &&op_new_array,
+        [0x24] = &&op_filled_new_array, [0x25] = &&op_filled_new_array,
+        [0x26] = &&op_fill_array_data, [0x27] = &&op_throw,
+        [0x28] = &&op_goto, [0x29] = &&op_goto_16, [0x2a] = &&op_goto_32,
+        [0x2b] = &&op_packed_switch, [0x2c] = &&op_sparse_switch,
+        [0x2d] = &&op_cmpl_float, [0x2e] = &&op_cmpg_float, [0x2f] = &&op_cmpl_double,
+        [0x30] = &&op_cmpg_double, [0x31] = &&op_cmp_long,
+        [0x32] = &&op_if_eq, [0x33] = &&op_if_ne, [0x34] = &&op_if_lt,
+        [0x35] = &&op_if_ge, [0x36] = &&op_if_gt, [0x37] = &&op_if_le,
+        [0x38] = &&op_if_eqz, [0x39] = &&op_if_nez, [0x3a] = &&op_if_ltz,
+        [0x3b] = &&op_if_gez, [0x3c] = &&op_if_gtz, [0x3d] = &&op_if_lez,
+        [0x3e ... 0x43] = &&op_invalid,
+        [0x44] = &&op_aget, [0x45] = &&op_aget_wide, [0x46] = &&op_aget_object,
+        [0x47] = &&op_aget_boolean, [0x48] = &&op_aget_byte, [0x49] = &&op_aget_char, [0x4a] = &&op_aget_short,
+        [0x4b] = &&op_aput, [0x4c] = &&op_aput_wide, [0x4d] = &&op_aput_object,
+        [0x4e] = &&op_aput_boolean, [0x4f] = &&op_aput_byte, [0x50] = &&op_aput_char, [0x51] = &&op_aput_short,
+        [0x52] = &&op_iget, [0x53] = &&op_iget_wide, [0x54] = &&op_iget_object,
+        [0x55] = &&op_iget_boolean, [0x56] = &&op_iget_byte, [0x57] = &&op_iget_char, [0x58] = &&op_iget_short,
+        [0x59] = &&op_iput, [0x5a] = &&op_iput_wide, [0x5b] = &&op_iput_object,
+        [0x5c] = &&op_iput_boolean, [0x5d] = &&op_iput_byte, [0x5e] = &&op_iput_char, [0x5f] = &&op_iput_short,
+        [0x60] = &&op_sget, [0x61] = &&op_sget_wide, [0x62] = &&op_sget_object,
+        [0x63] = &&op_sget_boolean, [0x64] = &&op_sget_byte, [0x65] = &&op_sget_char, [0x66] = &&op_sget_short,
+        [0x67] = &&op_sput, [0x68] = &&op_sput_wide, [0x69] = &&op_sput_object,
+        [0x6a] = &&op_sput_boolean, [0x6b] = &&op_sput_byte, [0x6c] = &&op_sput_char, [0x6d] = &&op_sput_short,
+        [0x6e] = &&op_invoke_virtual, [0x6f] = &&op_invoke_super, [0x70] = &&op_invoke_direct,
+        [0x71] = &&op_invoke_static, [0x72] = &&op_invoke_interface, [0x73] = &&op_invalid,
+        [0x74] = &&op_invoke_virtual_range, [0x75] = &&op_invoke_super_range, [0x76] = &&op_invoke_direct_range,
+        [0x77] = &&op_invoke_static_range, [0x78] = &&op_invoke_interface_range,
+        [0x79 ... 0x7a] = &&op_invalid,
+        [0x7b] = &&op_neg_int, [0x7c] = &&op_not_int, [0x7d] = &&op_neg_long, [0x7e] = &&op_not_long,
+        [0x7f] = &&op_neg_float, [0x80] = &&op_neg_double,
+        [0x81] = &&op_int_to_long, [0x82] = &&op_int_to_float, [0x83] = &&op_int_to_double,
+        [0x84] = &&op_long_to_int, [0x85] = &&op_long_to_float, [0x86] = &&op_long_to_double,
+        [0x87] = &&op_float_to_int, [0x88] = &&op_float_to_long, [0x89] = &&op_float_to_double,
+        [0x8a] = &&op_double_to_int, [0x8b] = &&op_double_to_long, [0x8c] = &&op_double_to_float,
+        [0x8d] = &&op_int_to_byte, [0x8e] = &&op_int_to_char, [0x8f] = &&op_int_to_short,
+        [0x90] = &&op_add_int, [0x91] = &&op_sub_int, [0x92] = &&op_mul_int, [0x93] = &&op_div_int,
+        [0x94] = &&op_rem_int, [0x95] = &&op_and_int, [0x96] = &&op_or_int, [0x97] = &&op_xor_int,
+        [0x98] = &&op_shl_int, [0x99] = &&op_shr_int, [0x9a] = &&op_ushr_int,
+        [0x9b] = &&op_add_long, [0x9c] = &&op_sub_long, [0x9d] = &&op_mul_long, [0x9e] = &&op_div_long,
+        [0x9f] = &&op_rem_long, [0xa0] = &&op_and_long, [0xa1] = &&op_or_long, [0xa2] = &&op_xor_long,
+        [0xa3] = &&op_shl_long, [0xa4] = &&op_shr_long, [0xa5] = &&op_ushr_long,
+        [0xa6] = &&op_add_float, [0xa7] = &&op_sub_float, [0xa8] = &&op_mul_float,
+        [0xa9] = &&op_div_float, [0xaa] = &&op_rem_float,
+        [0xab] = &&op_add_double, [0xac] = &&op_sub_double, [0xad] = &&op_mul_double,
+        [0xae] = &&op_div_double, [0xaf] = &&op_rem_double,
+        [0xb0] = &&op_add_int_2addr, [0xb1] = &&op_sub_int_2addr, [0xb2] = &&op_mul_int_2addr,
+        [0xb3] = &&op_div_int_2addr, [0xb4] = &&op_rem_int_2addr, [0xb5] = &&op_and_int_2addr,
+        [0xb6] = &&op_or_int_2addr, [0xb7] = &&op_xor_int_2addr, [0xb8] = &&op_shl_int_2addr,
+        [0xb9] = &&op_shr_int_2addr, [0xba] = &&op_ushr_int_2addr,
+        [0xbb] = &&op_add_long_2addr, [0xbc] = &&op_sub_long_2addr, [0xbd] = &&op_mul_long_2addr,
+        [0xbe] = &&op_div_long_2addr, [0xbf] = &&op_rem_long_2addr, [0xc0] = &&op_and_long_2addr,
+        [0xc1] = &&op_or_long_2addr, [0xc2] = &&op_xor_long_2addr, [0xc3] = &&op_shl_long_2addr,
+        [0xc4] = &&op_shr_long_2addr, [0xc5] = &&op_ushr_long_2addr,
+        [0xc6] = &&op_add_float_2addr, [0xc7] = &&op_sub_float_2addr, [0xc8] = &&op_mul_float_2addr,
+        [0xc9] = &&op_div_float_2addr, [0xca] = &&op_rem_float_2addr,
+        [0xcb] = &&op_add_double_2addr, [0xcc] = &&op_sub_double_2addr, [0xcd] = &&op_mul_double_2addr,
+        [0xce] = &&op_div_double_2addr, [0xcf] = &&op_rem_double_2addr,
+        [0xd0] = &&op_add_int_lit16, [0xd1] = &&op_rsub_int, [0xd2] = &&op_mul_int_lit16,
+        [0xd3] = &&op_div_int_lit16, [0xd4] = &&op_rem_int_lit16, [0xd5] = &&op_and_int_lit16,
+        [0xd6] = &&op_or_int_lit16, [0xd7] = &&op_xor_int_lit16,
+        [0xd8] = &&op_add_int_lit8, [0xd9] = &&op_rsub_int_lit8, [0xda] = &&op_mul_int_lit8,
+        [0xdb] = &&op_div_int_lit8, [0xdc] = &&op_rem_int_lit8, [0xdd] = &&op_and_int_lit8,
+        [0xde] = &&op_or_int_lit8, [0xdf] = &&op_xor_int_lit8, [0xe0] = &&op_shl_int_lit8,
+        [0xe1] = &&op_shr_int_lit8, [0xe2] = &&op_ushr_int_lit8,
+        [0xe3 ... 0xf9] = &&op_invalid,
+        [0xfa ... 0xff] = &&op_unsupported
+    };
+    
+    const uint16_t* pc = method->insns;
+    uint32_t* fp = thread->vregs + base;
+    art_object_t** rp = thread->refs + base;
+    art_inline_cache_t* caches = method->caches;
+    uint16_t inst;
+    int status = 0;
+    
+    art_object_t* object;
+    art_object_t* array;
+    art_class_t* klass;
+    art_field_t* field;
+    art_value_t* slot;
+    uint32_t index;
+    
+    // Derlenmiş kod varsa metot ondan başlar
+    if (method->jit_code) {
+        goto jit_enter;
+    }
+    
+    DISPATCH();
+    
+backedge:
+    // Döngüsü ısınan metodu derle ve döngünün ortasında derlenmiş koda geç (OSR)
+    if (!method->jit_code && ++method->backedge_count + method->invoke_count >= art_jit_threshold) {
+        art_jit_compile(method);
+    }
+    if (!method->jit_code) {
+        DISPATCH();
+    }
+    
+jit_enter: {
+    // Derlenmiş kod çerçeveyi yerinde çalıştırır; yorumlayıcı döndüğü pc'den sürer
+    art_jit_frame_t frame = { fp, rp, thread, method, &thread->result, &thread->refs[0], NULL, NULL, NULL };
+    int resume = art_jit_run(&frame, (uint32_t)(pc - method->insns));
+    if (resume == ART_JIT_RETURNED) {
+        return 0;
+    }
+    if (resume < 0) {
+        status = resume;
+        goto exception;
+    }
+    pc = method->insns + resume;
+    art_heap_safepoint();
+    DISPATCH();
+}
+    
+op_nop:
+    // Veri tablosuna akış bozuk koddur (hazırlama tabloları atlar)
+    if (inst != 0) {
+        goto op_invalid;
+    }
+    NEXT(1);
+    
+op_move:
+    fp[INST_A] = fp[INST_B];
+    rp[INST_A] = rp[INST_B];
+    NEXT(1);
+    
+op_move_from16:
+    fp[INST_AA] = fp[pc[1]];
+    rp[INST_AA] = rp[pc[1]];
+    NEXT(2);
+    
+op_move_16:
+    fp[pc[1]] = fp[pc[2]];
+    rp[pc[1]] = rp[pc[2]];
+    NEXT(3);
+    
+op_move_wide:
+    SET_WIDE(INST_A, GET_WIDE(INST_B));
+    NEXT(1);
+    
+op_move_wide_from16:
+    SET_WIDE(INST_AA, GET_WIDE(pc[1]));
+    NEXT(2);
+    
+op_move_wide_16:
+    SET_WIDE(pc[1], GET_WIDE(pc[2]));
+    NEXT(3);
+    
+op_move_result:
+    SET_INT(INST_AA, thread->result.i);
+    NEXT(1);
+    
+op_move_result_wide:
+    SET_WIDE(INST_AA, (uint64_t)thread->result.j);
+    NEXT(1);
+    
+op_move_result_object:
+    SET_REF(INST_AA, thread->refs[0]);
+    thread->refs[0] = NULL;
+    NEXT(1);
+    
+op_return_void:
+    return 0;
+    
+op_return:
+    thread->result.i = (int32_t)fp[INST_AA];
+    return 0;
+    
+op_return_wide:
+    thread->result.j = (int64_t)GET_WIDE(INST_AA);
+    return 0;
+    
+op_return_object:
+    thread->refs[0] = rp[INST_AA];
+    return 0;
+    
+op_const_4:
+    SET_INT(INST_A, (int32_t)(int16_t)inst >> 12);
+    NEXT(1);
+    
+op_const_16:
+    SET_INT(INST_AA, (int32_t)(int16_t)pc[1]);
+    NEXT(2);
+    
+op_const:
+    SET_INT(INST_AA, pc[1] | ((uint32_t)pc[2] << 16));
+    NEXT(3);
+    
+op_const_high16:
+    SET_INT(INST_AA, (uint32_t)pc[1] << 16);
+    NEXT(2);
+    
+op_const_wide_16:
+    SET_WIDE(INST_AA, (uint64_t)(int64_t)(int16_t)pc[1]);
+    NEXT(2);
+    
+op_const_wide_32:
+    SET_WIDE(INST_AA, (uint64_t)(int64_t)(int32_t)(pc[1] | ((uint32_t)pc[2] << 16)));
+    NEXT(3);
+    
+op_const_wide:
+    SET_WIDE(INST_AA, pc[1] | ((uint64_t)pc[2] << 16) | ((uint64_t)pc[3] << 32) | ((uint64_t)pc[4] << 48));
+    NEXT(5);
+    
+op_const_wide_high16:
+    SET_WIDE(INST_AA, (uint64_t)pc[1] << 48);
+    NEXT(2);
+    
+op_monitor_enter:
+    if (!rp[INST_AA]) {
+        THROW("Ljava/lang/NullPointerException;", "monitor-enter");
+    }
+    if (pthread_mutex_trylock(&art_interp_monitor) != 0) {
+        art_heap_thread_block();
+        pthread_mutex_lock(&art_interp_monitor);
+        art_heap_thread_unblock();
+    }
+    thread->monitors++;
+    NEXT(1);
+    
+op_monitor_exit:
+    if (!rp[INST_AA]) {
+        THROW("Ljava/lang/NullPointerException;", "monitor-exit");
+    }
+    if (thread->monitors == 0) {
+        THROW("Ljava/lang/IllegalMonitorStateException;", "monitor-exit");
+    }
+    thread->monitors--;
+    pthread_mutex_unlock(&art_interp_monitor);
+    NEXT(1);
+    
+op_check_cast:
+    object = rp[INST_AA];
+    if (object) {
+        RESOLVE_TYPE(klass);
+        if (!art_interp_is_assignable((art_class_t*)object->klass, klass)) {
+            THROW("Ljava/lang/ClassCastException;", "%s -> %s", ((art_class_t*)object->klass)->descriptor, klass->descriptor);
+        }
+    }
+    NEXT(2);
+    
+op_instance_of:
+    object = rp[INST_B];
+    if (object) {
+        RESOLVE_TYPE(klass);
+        SET_INT(INST_A, art_interp_is_assignable((art_class_t*)object->klass, klass));
+    } else {
+        SET_INT(INST_A, 0);
+    }
+    NEXT(2);
+    
+op_array_length:
+    object = rp[INST_B];
+    if (!object) {
+        THROW("Ljava/lang/NullPointerException;", "array-length");
+    }
+    if (((art_class_t*)object->klass)->descriptor[0] != '[') {
+        THROW("Ljava/lang/VerifyError;", "array-length");
+    }
+    SET_INT(INST_A, ART_ARRAY_LENGTH(object));
+    NEXT(1);
+    
+op_new_instance:
+    // Yuvanın sınıfı, sınıf başlatıldıktan sonra yazılır
+    klass = __atomic_load_n(&caches[pc[1]].klass, __ATOMIC_ACQUIRE);
+    if (!klass) {
+        if (!(klass = art_interp_resolve_type(thread, method->klass, caches[pc[1]].index))) {
+            goto exception_pending;
+        }
+        if (klass->descriptor[0] == '[' || (klass->access_flags & (DEX_ACC_ABSTRACT | DEX_ACC_INTERFACE))) {
+            THROW("Ljava/lang/InstantiationError;", "%s", klass->descriptor);
+        }
+        CHECK_STATUS(art_interp_initialize_class(thread, klass));
+        __atomic_store_n(&caches[pc[1]].klass, klass, __ATOMIC_RELEASE);
+    }
+    object = art_heap_alloc(klass, klass->ref_fields, klass->data_size);
+    if (!object) {
+        THROW("Ljava/lang/OutOfMemoryError;", "%s", klass->descriptor);
+    }
+    SET_REF(INST_AA, object);
+    NEXT(2);
+    
+op_new_array:
+    RESOLVE_TYPE(klass);
+    if (klass->descriptor[0] != '[') {
+        THROW("Ljava/lang/VerifyError;", "new-array %s", klass->descriptor);
+    }
+    object = art_interp_new_array(thread, klass, (int32_t)fp[INST_B]);
+    if (!object) {
+        goto exception_pending;
+    }
+    SET_REF(INST_A, object);
+    NEXT(2);
+    
+op_filled_new_array: {
+    // Yalnızca int ve referans dizileri (Dalvik'teki gibi)
+    int range = (inst & 0xFF) == 0x25;
+    uint32_t count = range ? INST_AA : INST_B;
+    
+    RESOLVE_TYPE(klass);
+    if (klass->descriptor[0] != '[' || (klass->component_size && klass->descriptor[1] != 'I')) {
+        THROW("Ljava/lang/InternalError;", "filled-new-array %s", klass->descriptor);
+    }
+    
+    array = art_interp_new_array(thread, klass, (int32_t)count);
+    if (!array) {
+        goto exception_pending;
+    }
+    
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t reg = range ? pc[2] + i : (i < 4 ? (pc[2] >> (i * 4)) & 0x0F : INST_A);
+        if (klass->component_size) {
+            memcpy(ART_ARRAY_DATA(array) + i * sizeof(uint32_t), &fp[reg], sizeof(uint32_t));
+        } else {
+            object = rp[reg];
+            if (object && !art_interp_is_assignable((art_class_t*)object->klass, klass->component)) {
+                THROW("Ljava/lang/ArrayStoreException;", "%s", ((art_class_t*)object->klass)->descriptor);
+            }
+            art_heap_write_ref(array, i, object);
+        }
+    }
+    
+    thread->refs[0] = array;
+    NEXT(3);
+}
+    
+op_fill_array_data: {
+    const uint16_t* payload = pc + (int32_t)(pc[1] | ((uint32_t)pc[2] << 16));
+    uint32_t count = payload[2] | ((uint32_t)payload[3] << 16);
+    
+    array = rp[INST_AA];
+    if (!array) {
+        THROW("Ljava/lang/NullPointerException;", "fill-array-data");
+    }
+    klass = (art_class_t*)array->klass;
+    if (klass->descriptor[0] != '[' || klass->component_size != payload[1]) {
+        THROW("Ljava/lang/VerifyError;", "fill-array-data %s", klass->descriptor);
+    }
+    if (count > (uint32_t)ART_ARRAY_LENGTH(array)) {
+        THROW("Ljava/lang/ArrayIndexOutOfBoundsException;", "length=%d; count=%u", ART_ARRAY_LENGTH(array), count);
+    }
+    memcpy(ART_ARRAY_DATA(array), payload + 4, (size_t)count * payload[1]);
+    NEXT(3);
+}
+    
+op_throw:
+    // İstisna nesnesi yakalanmaz; sınıfı yerel çağırana iletilir
+    object = rp[INST_AA];
+    if (!object) {
+        THROW("Ljava/lang/NullPointerException;", "throw");
+    }
+    THROW(((art_class_t*)object->klass)->descriptor, NULL);
+    
+op_goto:
+    BRANCH((int8_t)INST_AA);
+    
+op_goto_16:
+    BRANCH((int16_t)pc[1]);
+    
+op_goto_32:
+    BRANCH((int32_t)(pc[1] | ((uint32_t)pc[2] << 16)));
+    
+op_packed_switch: {
+    const uint16_t* payload = pc + (int32_t)(pc[1] | ((uint32_t)pc[2] << 16));
+    int32_t first = (int32_t)(payload[2] | ((uint32_t)payload[3] << 16));
+    int64_t key = (int64_t)(int32_t)fp[INST_AA] - first;
+    
+    if (key >= 0 && key < payload[1]) {
+        const uint16_t* target = payload + 4 + key * 2;
+        BRANCH((int32_t)(target[0] | ((uint32_t)target[1] << 16)));
+    }
+    NEXT(3);
+}
+    
+op_sparse_switch: {
+    const uint16_t* payload = pc + (int32_t)(pc[1] | ((uint32_t)pc[2] << 16));
+    const uint16_t* keys = payload + 2;
+    int32_t value = (int32_t)fp[INST_AA];
+    uint32_t low = 0;
+    uint32_t high = payload[1];
+    
+    // Anahtarlar sıralıdır
+    while (low < high) {
+        uint32_t middle = (low + high) / 2;
+        int32_t key = (int32_t)(keys[middle * 2] | ((uint32_t)keys[middle * 2 + 1] << 16));
+        if (key == value) {
+            const uint16_t* target = keys + payload[1] * 2 + middle * 2;
+            BRANCH((int32_t)(target[0] | ((uint32_t)target[1] << 16)));
+        }
+        if (key < value) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    NEXT(3);
+}
+    
+op_cmpl_float:
+    FORM_23X(SET_INT(dest, art_interp_compare(art_interp_get_float(x), art_interp_get_float(y), -1)))
+op_cmpg_float:
+    FORM_23X(SET_INT(dest, art_interp_compare(art_interp_get_float(x), art_interp_get_float(y), 1)))
+op_cmpl_double:
+    FORM_WIDE_23X(SET_INT(dest, art_interp_compare(art_interp_get_double(x), art_interp_get_double(y), -1)))
+op_cmpg_double:
+    FORM_WIDE_23X(SET_INT(dest, art_interp_compare(art_interp_get_double(x), art_interp_get_double(y), 1)))
+op_cmp_long:
+    FORM_WIDE_23X(SET_INT(dest, (int64_t)x > (int64_t)y ? 1 : ((int64_t)x == (int64_t)y ? 0 : -1)))
+    
+    // Nesne yazmaçları hem boşluk bitiyle hem işaretçiyle karşılaştırılır
+op_if_eq:
+    if (fp[INST_A] == fp[INST_B] && rp[INST_A] == rp[INST_B]) BRANCH((int16_t)pc[1]);
+    NEXT(2);
+op_if_ne:
+    if (fp[INST_A] != fp[INST_B] || rp[INST_A] != rp[INST_B]) BRANCH((int16_t)pc[1]);
+    NEXT(2);
+op_if_lt:
+    if ((int32_t)fp[INST_A] < (int32_t)fp[INST_B]) BRANCH((int16_t)pc[1]);
+    NEXT(2);
+op_if_ge:
+    if ((int32_t)fp[INST_A] >= (int32_t)fp[INST_B]) BRANCH((int16_t)pc[1]);
+    NEXT(2);
+op_if_gt:
+    if ((int32_t)fp[INST_A] > (int32_t)fp[INST_B]) BRANCH((int16_t)pc[1]);
+    NEXT(2);
+op_if_le:
+    if ((int32_t)fp[INST_A] <= (int32_t)fp[INST_B]) BRANCH((int16_t)pc[1]);
+    NEXT(2);
+op_if_eqz:
+    if (fp[INST_AA] == 0) BRANCH((int16_t)pc[1]);
+    NEXT(2);
+op_if_nez:
+    if (fp[INST_AA] != 0) BRANCH((int16_t)pc[1]);
+    NEXT(2);
+op_if_ltz:
+    if ((int32_t)fp[INST_AA] < 0) BRANCH((int16_t)pc[1]);
+    NEXT(2);
+op_if_gez:
+    if ((int32_t)fp[INST_AA] >= 0) BRANCH((int16_t)pc[1]);
+    NEXT(2);
+op_if_gtz:
+    if ((int32_t)fp[INST_AA] > 0) BRANCH((int16_t)pc[1]);
+    NEXT(2);
+op_if_lez:
+    if ((int32_t)fp[INST_AA] <= 0) BRANCH((int16_t)pc[1]);
+    NEXT(2);
+    
+op_aget:
+    ARRAY_GET(int32_t, 4)
+op_aget_boolean:
+    ARRAY_GET(uint8_t, 1)
+op_aget_byte:
+    ARRAY_GET(int8_t, 1)
+op_aget_char:
+    ARRAY_GET(uint16_t, 2)
+op_aget_short:
+    ARRAY_GET(int16_t, 2)
+op_aget_wide: {
+    ARRAY_CHECK(8);
+    uint64_t value;
+    memcpy(&value, ART_ARRAY_DATA(array) + (size_t)index * 8, 8);
+    SET_WIDE(INST_AA, value);
+    NEXT(2);
+}
+op_aget_object:
+    ARRAY_CHECK(0);
+    SET_REF(INST_AA, ART_OBJECT_REFS(array)[index]);
+    NEXT(2);
+    
+op_aput:
+    ARRAY_PUT(int32_t, 4)
+op_aput_boolean:
+    ARRAY_PUT(uint8_t, 1)
+op_aput_byte:
+    ARRAY_PUT(int8_t, 1)
+op_aput_char:
+    ARRAY_PUT(uint16_t, 2)
+op_aput_short:
+    ARRAY_PUT(int16_t, 2)
+op_aput_wide: {
+    ARRAY_CHECK(8);
+    uint64_t value = GET_WIDE(INST_AA);
+    memcpy(ART_ARRAY_DATA(array) + (size_t)index * 8, &value, 8);
+    NEXT(2);
+}
+op_aput_object:
+    ARRAY_CHECK(0);
+    object = rp[INST_AA];
+    if (object && !art_interp_is_assignable((art_class_t*)object->klass, klass->component)) {
+        THROW("Ljava/lang/ArrayStoreException;", "%s -> %s", ((art_class_t*)object->klass)->descriptor, klass->descriptor);
+    }
+    art_heap_write_ref(array, index, object);
+    NEXT(2);
+    
+op_iget:
+    IGET(int32_t)
+op_iget_boolean:
+    IGET(uint8_t)
+op_iget_byte:
+    IGET(int8_t)
+op_iget_char:
+    IGET(uint16_t)
+op_iget_short:
+    IGET(int16_t)
+op_iget_wide: {
+    INSTANCE_FIELD();
+    uint64_t value;
+    memcpy(&value, ART_OBJECT_DATA(object) + field->offset, 8);
+    SET_WIDE(INST_A, value);
+    NEXT(2);
+}
+op_iget_object:
+    INSTANCE_FIELD();
+    SET_REF(INST_A, ART_OBJECT_REFS(object)[field->offset]);
+    NEXT(2);
+    
+op_iput:
+    IPUT(int32_t)
+op_iput_boolean:
+    IPUT(uint8_t)
+op_iput_byte:
+    IPUT(int8_t)
+op_iput_char:
+    IPUT(uint16_t)
+op_iput_short:
+    IPUT(int16_t)
+op_iput_wide: {
+    INSTANCE_FIELD();
+    uint64_t value = GET_WIDE(INST_A);
+    memcpy(ART_OBJECT_DATA(object) + field->offset, &value, 8);
+    NEXT(2);
+}
+op_iput_object:
+    INSTANCE_FIELD();
+    art_heap_write_ref(object, field->offset, rp[INST_A]);
+    NEXT(2);
+    
+op_sget:
+op_sget_boolean:
+op_sget_byte:
+op_sget_char:
+op_sget_short:
+    STATIC_FIELD();
+    SET_INT(INST_AA, slot->i);
+    NEXT(2);
+op_sget_wide:
+    STATIC_FIELD();
+    SET_WIDE(INST_AA, (uint64_t)slot->j);
+    NEXT(2);
+op_sget_object:
+    STATIC_FIELD();
+    SET_REF(INST_AA, slot->l);
+    NEXT(2);
+    
+op_sput:
+    STATIC_FIELD();
+    slot->i = (int32_t)fp[INST_AA];
+    NEXT(2);
+op_sput_boolean:
+    STATIC_FIELD();
+    slot->i = (uint8_t)fp[INST_AA];
+    NEXT(2);
+op_sput_byte:
+    STATIC_FIELD();
+    slot->i = (int8_t)fp[INST_AA];
+    NEXT(2);
+op_sput_char:
+    STATIC_FIELD();
+    slot->i = (uint16_t)fp[INST_AA];
+    NEXT(2);
+op_sput_short:
+    STATIC_FIELD();
+    slot->i = (int16_t)fp[INST_AA];
+    NEXT(2);
+op_sput_wide:
+    STATIC_FIELD();
+    slot->j = (int64_t)GET_WIDE(INST_AA);
+    NEXT(2);
+op_sput_object:
+    STATIC_FIELD();
+    slot->l = rp[INST_AA];
+    NEXT(2);
+    
+op_invoke_virtual:
+    CHECK_STATUS(art_interp_invoke_insn(thread, method, pc, fp, rp, ART_INVOKE_VIRTUAL, 0));
+    NEXT(3);
+op_invoke_super:
+    CHECK_STATUS(art_interp_invoke_insn(thread, method, pc, fp, rp, ART_INVOKE_SUPER, 0));
+    NEXT(3);
+op_invoke_direct:
+    CHECK_STATUS(art_interp_invoke_insn(thread, method, pc, fp, rp, ART_INVOKE_DIRECT, 0));
+    NEXT(3);
+op_invoke_static:
+    CHECK_STATUS(art_interp_invoke_insn(thread, method, pc, fp, rp, ART_INVOKE_STATIC, 0));
+    NEXT(3);
+op_invoke_interface:
+    CHECK_STATUS(art_interp_invoke_insn(thread, method, pc, fp, rp, ART_INVOKE_INTERFACE, 0));
+    NEXT(3);
+op_invoke_virtual_range:
+    CHECK_STATUS(art_interp_invoke_insn(thread, method, pc, fp, rp, ART_INVOKE_VIRTUAL, 1));
+    NEXT(3);
+op_invoke_super_range:
+    CHECK_STATUS(art_interp_invoke_insn(thread, method, pc, fp, rp, ART_INVOKE_SUPER, 1));
+    NEXT(3);
+op_invoke_direct_range:
+    CHECK_STATUS(art_interp_invoke_insn(thread, method, pc, fp, rp, ART_INVOKE_DIRECT, 1));
+    NEXT(3);
+op_invoke_static_range:
+    CHECK_STATUS(art_interp_invoke_insn(thread, method, pc, fp, rp, ART_INVOKE_STATIC, 1));
+    NEXT(3);
+op_invoke_interface_range:
+    CHECK_STATUS(art_interp_invoke_insn(thread, method, pc, fp, rp, ART_INVOKE_INTERFACE, 1));
+    NEXT(3);
+    
+op_neg_int:
+    SET_INT(INST_A, 0u - fp[INST_B]);
+    NEXT(1);
+op_not_int:
+    SET_INT(INST_A, ~fp[INST_B]);
+    NEXT(1);
+op_neg_long:
+    SET_WIDE(INST_A, 0u - GET_WIDE(INST_B));
+    NEXT(1);
+op_not_long:
+    SET_WIDE(INST_A, ~GET_WIDE(INST_B));
+    NEXT(1);
+op_neg_float:
+    SET_INT(INST_A, fp[INST_B] ^ 0x80000000u);
+    NEXT(1);
+op_neg_double:
+    SET_WIDE(INST_A, GET_WIDE(INST_B) ^ 0x8000000000000000ull);
+    NEXT(1);
+op_int_to_long:
+    SET_WIDE(INST_A, (uint64_t)(int64_t)(int32_t)fp[INST_B]);
+    NEXT(1);
+op_int_to_float:
+    SET_INT(INST_A, art_interp_float_bits((float)(int32_t)fp[INST_B]));
+    NEXT(1);
+op_int_to_double:
+    SET_WIDE(INST_A, art_interp_double_bits((double)(int32_t)fp[INST_B]));
+    NEXT(1);
+op_long_to_int:
+    SET_INT(INST_A, fp[INST_B]);
+    NEXT(1);
+op_long_to_float:
+    SET_INT(INST_A, art_interp_float_bits((float)(int64_t)GET_WIDE(INST_B)));
+    NEXT(1);
+op_long_to_double:
+    SET_WIDE(INST_A, art_interp_double_bits((double)(int64_t)GET_WIDE(INST_B)));
+    NEXT(1);
+op_float_to_int:
+    SET_INT(INST_A, art_interp_to_int(art_interp_get_float(fp[INST_B])));
+    NEXT(1);
+op_float_to_long:
+    SET_WIDE(INST_A, (uint64_t)art_interp_to_long(art_interp_get_float(fp[INST_B])));
+    NEXT(1);
+op_float_to_double:
+    SET_WIDE(INST_A, art_interp_double_bits((double)art_interp_get_float(fp[INST_B])));
+    NEXT(1);
+op_double_to_int:
+    SET_INT(INST_A, art_interp_to_int(art_interp_get_double(GET_WIDE(INST_B))));
+    NEXT(1);
+op_double_to_long:
+    SET_WIDE(INST_A, (uint64_t)art_interp_to_long(art_interp_get_double(GET_WIDE(INST_B))));
+    NEXT(1);
+op_double_to_float:
+    SET_INT(INST_A, art_interp_float_bits((float)art_interp_get_double(GET_WIDE(INST_B))));
+    NEXT(1);
+op_int_to_byte:
+    SET_INT(INST_A, (int32_t)(int8_t)fp[INST_B]);
+    NEXT(1);
+op_int_to_char:
+    SET_INT(INST_A, (uint16_t)fp[INST_B]);
+    NEXT(1);
+op_int_to_short:
+    SET_INT(INST_A, (int32_t)(int16_t)fp[INST_B]);
+    NEXT(1);
+    
+op_add_int:        FORM_23X(SET_INT(dest, x + y))
+op_sub_int:        FORM_23X(SET_INT(dest, x - y))
+op_mul_int:        FORM_23X(SET_INT(dest, x * y))
+op_div_int:        FORM_23X(INT_DIV(0))
+op_rem_int:        FORM_23X(INT_DIV(1))
+op_and_int:        FORM_23X(SET_INT(dest, x & y))
+op_or_int:         FORM_23X(SET_INT(dest, x | y))
+op_xor_int:        FORM_23X(SET_INT(dest, x ^ y))
+op_shl_int:        FORM_23X(SET_INT(dest, x << (y & 31)))
+op_shr_int:        FORM_23X(SET_INT(dest, (int32_t)x >> (y & 31)))
+op_ushr_int:       FORM_23X(SET_INT(dest, x >> (y & 31)))
+op_add_long:       FORM_WIDE_23X(SET_WIDE(dest, x + y))
+op_sub_long:       FORM_WIDE_23X(SET_WIDE(dest, x - y))
+op_mul_long:       FORM_WIDE_23X(SET_WIDE(dest, x * y))
+op_div_long:       FORM_WIDE_23X(LONG_DIV(0))
+op_rem_long:       FORM_WIDE_23X(LONG_DIV(1))
+op_and_long:       FORM_WIDE_23X(SET_WIDE(dest, x & y))
+op_or_long:        FORM_WIDE_23X(SET_WIDE(dest, x | y))
+op_xor_long:       FORM_WIDE_23X(SET_WIDE(dest, x ^ y))
+    // Kaydırma miktarı tek yazmaçtır: y'nin alt yarısı
+op_shl_long:       FORM_WIDE_23X(SET_WIDE(dest, x << (y & 63)))
+op_shr_long:       FORM_WIDE_23X(SET_WIDE(dest, (int64_t)x >> (y & 63)))
+op_ushr_long:      FORM_WIDE_23X(SET_WIDE(dest, x >> (y & 63)))
+op_add_float:      FORM_23X(FLOAT_OP(fx + fy))
+op_sub_float:      FORM_23X(FLOAT_OP(fx - fy))
+op_mul_float:      FORM_23X(FLOAT_OP(fx * fy))
+op_div_float:      FORM_23X(FLOAT_OP(fx / fy))
+op_rem_float:      FORM_23X(FLOAT_OP(fmodf(fx, fy)))
+op_add_double:     FORM_WIDE_23X(DOUBLE_OP(dx + dy))
+op_sub_double:     FORM_WIDE_23X(DOUBLE_OP(dx - dy))
+op_mul_double:     FORM_WIDE_23X(DOUBLE_OP(dx * dy))
+op_div_double:     FORM_WIDE_23X(DOUBLE_OP(dx / dy))
+op_rem_double:     FORM_WIDE_23X(DOUBLE_OP(fmod(dx, dy)))
+    
+op_add_int_2addr:    FORM_2ADDR(SET_INT(dest, x + y))
+op_sub_int_2addr:    FORM_2ADDR(SET_INT(dest, x - y))
+op_mul_int_2addr:    FORM_2ADDR(SET_INT(dest, x * y))
+op_div_int_2addr:    FORM_2ADDR(INT_DIV(0))
+op_rem_int_2addr:    FORM_2ADDR(INT_DIV(1))
+op_and_int_2addr:    FORM_2ADDR(SET_INT(dest, x & y))
+op_or_int_2addr:     FORM_2ADDR(SET_INT(dest, x | y))
+op_xor_int_2addr:    FORM_2ADDR(SET_INT(dest, x ^ y))
+op_shl_int_2addr:    FORM_2ADDR(SET_INT(dest, x << (y & 31)))
+op_shr_int_2addr:    FORM_2ADDR(SET_INT(dest, (int32_t)x >> (y & 31)))
+op_ushr_int_2addr:   FORM_2ADDR(SET_INT(dest, x >> (y & 31)))
+op_add_long_2addr:   FORM_WIDE_2ADDR(SET_WIDE(dest, x + y))
+op_sub_long_2addr:   FORM_WIDE_2ADDR(SET_WIDE(dest, x - y))
+op_mul_long_2addr:   FORM_WIDE_2ADDR(SET_WIDE(dest, x * y))
+op_div_long_2addr:   FORM_WIDE_2ADDR(LONG_DIV(0))
+op_rem_long_2addr:   FORM_WIDE_2ADDR(LONG_DIV(1))
+op_and_long_2addr:   FORM_WIDE_2ADDR(SET_WIDE(dest, x & y))
+op_or_long_2addr:    FORM_WIDE_2ADDR(SET_WIDE(dest, x | y))
+op_xor_long_2addr:   FORM_WIDE_2ADDR(SET_WIDE(dest, x ^ y))
+op_shl_long_2addr:   FORM_WIDE_2ADDR(SET_WIDE(dest, x << (y & 63)))
+op_shr_long_2addr:   FORM_WIDE_2ADDR(SET_WIDE(dest, (int64_t)x >> (y & 63)))
+op_ushr_long_2addr:  FORM_WIDE_2ADDR(SET_WIDE(dest, x >> (y & 63)))
+op_add_float_2addr:  FORM_2ADDR(FLOAT_OP(fx + fy))
+op_sub_float_2addr:  FORM_2ADDR(FLOAT_OP(fx - fy))
+op_mul_float_2addr:  FORM_2ADDR(FLOAT_OP(fx * fy))
+op_div_float_2addr:  FORM_2ADDR(FLOAT_OP(fx / fy))
+op_rem_float_2addr:  FORM_2ADDR(FLOAT_OP(fmodf(fx, fy)))
+op_add_double_2addr: FORM_WIDE_2ADDR(DOUBLE_OP(dx + dy))
+op_sub_double_2addr: FORM_WIDE_2ADDR(DOUBLE_OP(dx - dy))
+op_mul_double_2addr: FORM_WIDE_2ADDR(DOUBLE_OP(dx * dy))
+op_div_double_2addr: FORM_WIDE_2ADDR(DOUBLE_OP(dx / dy))
+op_rem_double_2addr: FORM_WIDE_2ADDR(DOUBLE_OP(fmod(dx, dy)))
+    
+op_add_int_lit16:  FORM_LIT16(SET_INT(dest, x + y))
+op_rsub_int:       FORM_LIT16(SET_INT(dest, y - x))
+op_mul_int_lit16:  FORM_LIT16(SET_INT(dest, x * y))
+op_div_int_lit16:  FORM_LIT16(INT_DIV(0))
+op_rem_int_lit16:  FORM_LIT16(INT_DIV(1))
+op_and_int_lit16:  FORM_LIT16(SET_INT(dest, x & y))
+op_or_int_lit16:   FORM_LIT16(SET_INT(dest, x | y))
+op_xor_int_lit16:  FORM_LIT16(SET_INT(dest, x ^ y))
+op_add_int_lit8:   FORM_LIT8(SET_INT(dest, x + y))
+op_rsub_int_lit8:  FORM_LIT8(SET_INT(dest, y - x))
+op_mul_int_lit8:   FORM_LIT8(SET_INT(dest, x * y))
+op_div_int_lit8:   FORM_LIT8(INT_DIV(0))
+op_rem_int_lit8:   FORM_LIT8(INT_DIV(1))
+op_and_int_lit8:   FORM_LIT8(SET_INT(dest, x & y))
+op_or_int_lit8:    FORM_LIT8(SET_INT(dest, x | y))
+op_xor_int_lit8:   FORM_LIT8(SET_INT(dest, x ^ y))
+op_shl_int_lit8:   FORM_LIT8(SET_INT(dest, x << (y & 31)))
+op_shr_int_lit8:   FORM_LIT8(SET_INT(dest, (int32_t)x >> (y & 31)))
+op_ushr_int_lit8:  FORM_LIT8(SET_INT(dest, x >> (y & 31)))
+    
+op_unsupported:
+    art_interp_throw(thread, "Ljava/lang/UnsupportedOperationException;", "opcode 0x%02x", inst & 0xFF);
+    return ART_INTERP_ERROR_UNSUPPORTED;
+    
+op_invalid:
+    THROW("Ljava/lang/VerifyError;", "%s: pc %u", method->name, (uint32_t)(pc - method->insns));
+    
+exception_pending:
+    status = ART_INTERP_ERROR_EXCEPTION;
+exception:
+    // try bloklu metotlar hazırlanmaz: istisna yerel çağırana kadar çerçeveleri atlar
+    return status;
+}
+
+#undef INST_A
+#undef INST_B
+#undef INST_AA
+#undef DISPATCH
+#undef NEXT
+#undef BRANCH
+#undef SET_INT
+#undef GET_WIDE
+#undef SET_WIDE
+#undef SET_REF
+#undef THROW
+#undef CHECK_STATUS
+#undef FORM_23X
+#undef FORM_2ADDR
+#undef FORM_LIT16
+#undef FORM_LIT8
+#undef FORM_WIDE_23X
+#undef FORM_WIDE_2ADDR
+#undef INT_DIV
+#undef LONG_DIV
+#undef FLOAT_OP
+#undef DOUBLE_OP
+#undef ARRAY_CHECK
+#undef ARRAY_GET
+#undef ARRAY_PUT
+#undef INSTANCE_FIELD
+#undef IGET
+#undef IPUT
+#undef STATIC_FIELD
+#undef RESOLVE_TYPE
+
+// invoke-* komutu: hedefi önbellekten ya da çözerek bul, parametreleri yeni
+// çerçevenin son yazmaçlarına kopyala. Sanal çağrı önbelleği, alıcı sınıfının
+// vtable'ında önbellekteki metot aynı yuvadaysa isabet sayılır.
+static int art_interp_invoke_insn(art_interp_thread_t* thread, art_method_t* method, const uint16_t* pc,
+                                  uint32_t* fp, art_object_t** rp, int kind, int range) {
+    art_inline_cache_t* cache = &method->caches[pc[1]];
+    uint32_t count = range ? (uint32_t)(pc[0] >> 8) : (uint32_t)(pc[0] >> 12);
+    uint32_t registers[5];
+    art_method_t* target;
+    
+    if (!range) {
+        for (uint32_t i = 0; i < count; i++) {
+            registers[i] = i < 4 ? (pc[2] >> (i * 4)) & 0x0F : (pc[0] >> 8) & 0x0F;
+        }
+    }
+    
+    art_object_t* receiver = NULL;
+    if (kind != ART_INVOKE_STATIC) {
+        receiver = count > 0 ? rp[range ? pc[2] : registers[0]] : NULL;
+        if (!receiver) {
+            art_method_t* resolved = count > 0 ? art_interp_resolve_method(thread, method->klass, cache->index) : NULL;
+            return art_interp_throw(thread, "Ljava/lang/NullPointerException;", "%s",
+                                    resolved ? resolved->name : "invoke");
+        }
+    }
+    
+    if (kind == ART_INVOKE_VIRTUAL || kind == ART_INVOKE_INTERFACE) {
+        art_class_t* receiver_class = (art_class_t*)receiver->klass;
+        target = cache->method;
+        
+        if (!target || target->vtable_index >= receiver_class->vtable_size ||
+            receiver_class->vtable[target->vtable_index] != target) {
+            art_method_t* resolved = art_interp_resolve_method(thread, method->klass, cache->index);
+            if (!resolved) {
+                return ART_INTERP_ERROR_EXCEPTION;
+            }
+            
+            if ((resolved->access_flags & DEX_ACC_STATIC) || resolved->vtable_index == DEX_NO_INDEX ||
+                count != resolved->ins_size || !art_interp_is_assignable(receiver_class, resolved->klass)) {
+                return art_interp_throw(thread, "Ljava/lang/IncompatibleClassChangeError;", "%s.%s",
+                                        resolved->klass->descriptor, resolved->name);
+            }
+            
+            if (kind == ART_INVOKE_VIRTUAL && !(resolved->klass->access_flags & DEX_ACC_INTERFACE) &&
+                resolved->vtable_index < receiver_class->vtable_size) {
+                target = receiver_class->vtable[resolved->vtable_index];
+            } else {
+                target = art_interp_find_virtual(receiver_class, resolved->name, resolved->signature);
+            }
+            
+            if (!target || (target->access_flags & DEX_ACC_ABSTRACT)) {
+                return art_interp_throw(thread, "Ljava/lang/AbstractMethodError;", "%s.%s",
+                                        receiver_class->descriptor, resolved->name);
+            }
+            
+            if (cache->method) {
+                cache->misses++;
+                __atomic_add_fetch(&art_interp_stats.cache_misses, 1, __ATOMIC_RELAXED);
+            }
+            cache->klass = receiver_class;
+            cache->method = target;
+        }
+    } else if (kind == ART_INVOKE_STATIC) {
+        // Yuvanın sınıfı, sınıf başlatıldıktan sonra yazılır
+        if (__atomic_load_n(&cache->klass, __ATOMIC_ACQUIRE)) {
+            target = cache->method;
+        } else {
+            target = art_interp_resolve_method(thread, method->klass, cache->index);
+            if (!target) {
+                return ART_INTERP_ERROR_EXCEPTION;
+            }
+            if (!(target->access_flags & DEX_ACC_STATIC) || count != target->ins_size) {
+                return art_interp_throw(thread, "Ljava/lang/IncompatibleClassChangeError;", "%s.%s",
+                                        target->klass->descriptor, target->name);
+            }
+            
+            int status = art_interp_initialize_class(thread, target->klass);
+            if (status != 0) {
+                return status;
+            }
+            
+            cache->method = target;
+            __atomic_store_n(&cache->klass, target->klass, __ATOMIC_RELEASE);
+        }
+    } else {
+        target = __atomic_load_n(&cache->method, __ATOMIC_ACQUIRE);
+        if (!target) {
+            target = art_interp_resolve_method(thread, method->klass, cache->index);
+            if (!target) {
+                return ART_INTERP_ERROR_EXCEPTION;
+            }
+            if ((target->access_flags & DEX_ACC_STATIC) || count != target->ins_size) {
+                return art_interp_throw(thread, "Ljava/lang/IncompatibleClassChangeError;", "%s.%s",
+                                        target->klass->descriptor, target->name);
+            }
+            
+            // invoke-super: çağıran sınıfın üst sınıfındaki uygulama
+            art_class_t* superclass = method->klass->superclass;
+            if (kind == ART_INVOKE_SUPER && target->vtable_index != DEX_NO_INDEX) {
+                if (!superclass || target->vtable_index >= superclass->vtable_size) {
+                    return art_interp_throw(thread, "Ljava/lang/NoSuchMethodError;", "super.%s", target->name);
+                }
+                target = superclass->vtable[target->vtable_index];
+            }
+            
+            __atomic_store_n(&cache->method, target, __ATOMIC_RELEASE);
+        }
+    }
+    
+    uint32_t base;
+    if (art_interp_reserve_frame(thread, target, &base) != 0) {
+        return ART_INTERP_ERROR_EXCEPTION;
+    }
+    
+    uint32_t* callee_fp = thread->vregs + base + (target->registers_size - target->ins_size);
+    art_object_t** callee_rp = thread->refs + base + (target->registers_size - target->ins_size);
+    
+    if (range) {
+        memcpy(callee_fp, fp + pc[2], count * sizeof(uint32_t));
+        memcpy(callee_rp, rp + pc[2], count * sizeof(art_object_t*));
+    } else {
+        for (uint32_t i = 0; i < count; i++) {
+            callee_fp[i] = fp[registers[i]];
+            callee_rp[i] = rp[registers[i]];
+        }
+    }
+    
+    return art_interp_enter(thread, target, base);
+}
+
+// Yerel metodu çerçevedeki parametrelerle çağır
+static int art_interp_call_native(art_interp_thread_t* thread, art_method_t* target, uint32_t base) {
+    art_value_t args[ART_INTERP_MAX_ARGS + 1];
+    art_value_t result;
+    const uint32_t* fp = thread->vregs + base;
+    art_object_t** rp = thread->refs + base;
+    uint32_t reg = 0;
+    uint32_t index = 0;
+    
+    if (!(target->access_flags & DEX_ACC_STATIC)) {
+        args[index++].l = rp[reg++];
+    }
+    
+    for (const char* type = target->shorty + 1; *type; type++, index++) {
+        if (*type == 'L') {
+            args[index].l = rp[reg++];
+        } else if (*type == 'J' || *type == 'D') {
+            args[index].j = (int64_t)((uint64_t)fp[reg] | ((uint64_t)fp[reg + 1] << 32));
+            reg += 2;
+        } else {
+            args[index].j = 0;
+            args[index].i = (int32_t)fp[reg++];
+        }
+    }
+    
+    memset(&result, 0, sizeof(result));
+    if (target->native(target, args, &result) != 0) {
+        if (!thread->exception[0]) {
+            art_interp_throw(thread, "Ljava/lang/RuntimeException;", "%s", target->name);
+        }
+        return ART_INTERP_ERROR_EXCEPTION;
+    }
+    
+    if (target->shorty[0] == 'L') {
+        thread->refs[0] = result.l;
+    } else {
+        thread->result = result;
+    }
+    
+    return 0;
+}
+
+// Yığının tepesinde hedef için sıfırlanmış bir pencere ayır
+static int art_interp_reserve_frame(art_interp_thread_t* thread, art_method_t* target, uint32_t* base) {
+    uint32_t top = thread->roots.count;
+    uint32_t window = (uint32_t)target->registers_size + 1;
+    
+    if (top + window > ART_INTERP_STACK_SLOTS || thread->depth >= ART_INTERP_MAX_DEPTH) {
+        return art_interp_throw(thread, "Ljava/lang/StackOverflowError;", "%s", target->name);
+    }
+    
+    memset(thread->vregs + top, 0, window * sizeof(uint32_t));
+    memset(thread->refs + top, 0, window * sizeof(art_object_t*));
+    *base = top;
+    
+    return 0;
+}
+
+// Ayrılmış pencerede hedefi çalıştır: pencere kök sayılır, dönüşte bırakılır
+static int art_interp_enter(art_interp_thread_t* thread, art_method_t* target, uint32_t base) {
+    uint32_t saved_count = thread->roots.count;
+    int status = 0;
+    
+    thread->roots.count = base + target->registers_size + 1;
+    thread->depth++;
+    target->invoke_count++;
+    
+    if (target->native) {
+        status = art_interp_call_native(thread, target, base);
+    } else if (!target->code) {
+        status = art_interp_throw(thread, (target->access_flags & DEX_ACC_NATIVE) ? "Ljava/lang/UnsatisfiedLinkError;"
+                                                                                 : "Ljava/lang/AbstractMethodError;",
+                                  "%s.%s%s", target->klass->descriptor, target->name, target->signature);
+    } else {
+        if (!__atomic_load_n(&target->insns, __ATOMIC_ACQUIRE)) {
+            art_interp_lock_enter();
+            status = target->insns ? 0 : art_interp_prepare(target, target->klass->dex_class->dex);
+            pthread_mutex_unlock(&art_interp_lock);
+            
+            if (status != 0) {
+                status = art_interp_throw(thread, status == ART_INTERP_ERROR_NO_MEMORY ? "Ljava/lang/OutOfMemoryError;"
+                                                                                       : "Ljava/lang/VerifyError;",
+                                          "%s.%s%s", target->klass->descriptor, target->name, target->signature);
+            }
+        }
+        
+        // Sıcak metot çağrıdan önce derlenir
+        if (status == 0 && art_jit_threshold && !target->jit_code &&
+            target->invoke_count + target->backedge_count >= art_jit_threshold) {
+            art_jit_compile(target);
+        }
+        
+        if (status == 0) {
+            art_heap_safepoint();
+            status = art_interp_execute(thread, target, base);
+        }
+    }
+    
+    thread->depth--;
+    thread->roots.count = saved_count;
+    
+    return status;
+}
+
+// İstisnayı "Ltanımlayıcı;: ileti" biçiminde kaydet
+static int art_interp_throw(art_interp_thread_t* thread, const char* descriptor, const char* format, ...) {
+    char message[192] = "";
+    
+    if (format) {
+        va_list args;
+        va_start(args, format);
+        vsnprintf(message, sizeof(message), format, args);
+        va_end(args);
+    }
+    
+    snprintf(thread->exception, sizeof(thread->exception), message[0] ? "%s: %s" : "%s", descriptor, message);
+    __atomic_add_fetch(&art_interp_stats.exceptions, 1, __ATOMIC_RELAXED);
+    
+    return ART_INTERP_ERROR_EXCEPTION;
+}
+
+// Dizi ayır. Referans dizilerinin elemanları nesnenin referans yuvalarıdır;
+// uzunluk yalnızca yığının en büyük blok boyutuyla sınırlıdır.
+static art_object_t* art_interp_new_array(art_interp_thread_t* thread, art_class_t* klass, int32_t length) {
+    art_object_t* array;
+    
+    if (length < 0) {
+        art_interp_throw(thread, "Ljava/lang/NegativeArraySizeException;", "%d", length);
+        return NULL;
+    }
+    
+    if (klass->component_size == 0) {
+        array = art_heap_alloc(klass, (uint32_t)length, 8);
+    } else {
+        uint64_t data_size = 8 + (uint64_t)length * klass->component_size;
+        array = data_size <= UINT32_MAX ? art_heap_alloc(klass, 0, (uint32_t)data_size) : NULL;
+    }
+    
+    if (!array) {
+        art_interp_throw(thread, "Ljava/lang/OutOfMemoryError;", "%s[%d]", klass->descriptor, length);
+        return NULL;
+    }
+    
+    ART_ARRAY_LENGTH(array) = length;
+    
+    return array;
+}
+
+// System.arraycopy(Object src, int srcPos, Object dst, int dstPos, int length)
+static int art_interp_builtin_arraycopy(art_method_t* method, art_value_t* args, art_value_t* result) {
+    art_object_t* source = args[0].l;
+    art_object_t* destination = args[2].l;
+    int32_t source_pos = args[1].i;
+    int32_t destination_pos = args[3].i;
+    int32_t length = args[4].i;
+    
+    (void)method;
+    (void)result;
+    
+    if (!source || !destination) {
+        return art_interp_throw_new("Ljava/lang/NullPointerException;", "arraycopy");
+    }
+    
+    art_class_t* source_class = (art_class_t*)source->klass;
+    art_class_t* destination_class = (art_class_t*)destination->klass;
+    if (source_class->descriptor[0] != '[' || destination_class->descriptor[0] != '[' ||
+        source_class->component_size != destination_class->component_size ||
+        (source_class->component_size && strcmp(source_class->descriptor, destination_class->descriptor) != 0)) {
+        return art_interp_throw_new("Ljava/lang/ArrayStoreException;", "arraycopy");
+    }
+    
+    if (source_pos < 0 || destination_pos < 0 || length < 0 ||
+        (int64_t)source_pos + length > ART_ARRAY_LENGTH(source) ||
+        (int64_t)destination_pos + length > ART_ARRAY_LENGTH(destination)) {
+        return art_interp_throw_new("Ljava/lang/ArrayIndexOutOfBoundsException;", "arraycopy");
+    }
+    
+    uint8_t size = source_class->component_size;
+    if (size) {
+        memmove(ART_ARRAY_DATA(destination) + (size_t)destination_pos * size,
+                ART_ARRAY_DATA(source) + (size_t)source_pos * size, (size_t)length * size);
+        return 0;
+    }
+    
+    // Referanslar bariyerden geçer; çakışan aralıkta geriye doğru kopyalanır
+    int check = !art_interp_is_assignable(source_class->component, destination_class->component);
+    int backward = source == destination && source_pos < destination_pos;
+    
+    for (int32_t i = 0; i < length; i++) {
+        int32_t offset = backward ? length - 1 - i : i;
+        art_object_t* value = ART_OBJECT_REFS(source)[source_pos + offset];
+        
+        if (check && value && !art_interp_is_assignable((art_class_t*)value->klass, destination_class->component)) {
+            return art_interp_throw_new("Ljava/lang/ArrayStoreException;", "arraycopy");
+        }
+        art_heap_write_ref(destination, (uint32_t)(destination_pos + offset), value);
+    }
+    
+    return 0;
+}
+
+// System.nanoTime()
+static int art_interp_builtin_nano_time(art_method_t* method, art_value_t* args, art_value_t* result) {
+    struct timespec now;
+    
+    (void)method;
+    (void)args;
+    
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    result->j = (int64_t)now.tv_sec * 1000000000LL + now.tv_nsec;
+    
+    return 0;
+}
+
+// System.currentTimeMillis()
+static int art_interp_builtin_current_millis(art_method_t* method, art_value_t* args, art_value_t* result) {
+    struct timespec now;
+    
+    (void)method;
+    (void)args;
+    
+    clock_gettime(CLOCK_REALTIME, &now);
+    result->j = (int64_t)now.tv_sec * 1000LL + now.tv_nsec / 1000000;
+    
+    return 0;
+}
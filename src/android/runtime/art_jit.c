@@ -0,0 +1,1712 @@
+#include "../../include/android/art_jit.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC             0x0001U
+#endif
+
+// Derlenmiş metot. Çıkarılan kod yayından kalkar ama bloğu ve tanımlayıcısı,
+// çıkarma anında derlenmiş kodda olan her iş parçacığı oradan tamamen çıkana
+// kadar bekletilir.
+typedef struct art_jit_code {
+    art_method_t* method;
+    uint32_t offset;               // Önbellekteki blok
+    uint32_t size;
+    const uint8_t* code;           // Metodun kodu (önbellekte ya da görüntüde)
+    const uint8_t* trampoline;     // Giriş kodu (önbelleğin ya da görüntünün başı)
+    const void* const* imports;
+    const void* owner;             // Görüntü kodunda görüntü, JIT'te NULL
+    uint32_t* entries;             // dex pc -> kod ofseti + 1 (0: giriş noktası değil)
+    uint64_t last_use;             // LRU saati (yarışlı, yaklaşık)
+    uint32_t* waits;               // Bekletilen kod: iş parçacığı başına exits + 1 (0: beklenmez)
+    uint32_t wait_count;
+    struct art_jit_code* next;
+} art_jit_code_t;
+
+// İş parçacığı başına giriş kaydı. depth'i yalnızca sahibi yazar; en dıştaki
+// giriş tam bariyerle yayınlanır, iç içe girişler bariyersizdir.
+typedef struct art_jit_thread {
+    uint32_t index;
+    uint32_t depth;                // İç içe derlenmiş kod girişleri
+    uint32_t exits;                // En dıştaki çıkış sayısı
+    uint8_t used;                  // İş parçacığı yaşıyor
+    struct art_jit_thread* next;
+} art_jit_thread_t;
+
+// Boş blok (ofsete göre sıralı)
+typedef struct art_jit_block {
+    uint32_t offset;
+    uint32_t size;
+    struct art_jit_block* next;
+} art_jit_block_t;
+
+// Yamalar: dal hedefi dex pc'si, çıkış taslağı ya da ortak dönüş
+enum {
+    ART_JIT_PATCH_BRANCH,
+    ART_JIT_PATCH_EXIT,
+    ART_JIT_PATCH_EPILOGUE
+};
+
+typedef struct {
+    uint32_t position;             // rel32 alanının ofseti
+    uint32_t target;               // dex pc (dal, çıkış)
+    uint8_t kind;
+} art_jit_patch_t;
+
+// Derleme durumu
+typedef struct {
+    art_method_t* method;
+    uint8_t* code;
+    uint32_t size;
+    uint32_t capacity;
+    int failed;
+    uint32_t* entries;
+    uint32_t* stubs;               // dex pc -> çıkış taslağı ofseti + 1
+    art_jit_patch_t* patches;
+    uint32_t patch_count;
+    uint32_t patch_capacity;
+    uint8_t image;                 // Konumdan bağımsız görüntü kodu
+} art_jit_compiler_t;
+
+// x86 yazmaçları ve koşul kodları. Kod yalnızca ilk sekiz yazmacı kullanır;
+// böylece 32 bitlik şablonlar x86-64'te de aynı kodlanır.
+enum { EAX = 0, ECX = 1, EDX = 2, EBX = 3, ESI = 6, EDI = 7 };
+enum { CC_B = 0x2, CC_AE = 0x3, CC_E = 0x4, CC_NE = 0x5, CC_L = 0xC, CC_GE = 0xD, CC_LE = 0xE, CC_G = 0xF };
+
+// Derlenmiş kodda: EBX çerçeve, ESI ilkel yazmaçlar, EDI nesne yazmaçları
+#define FRAME           EBX
+#define VREGS           ESI
+#define REFS            EDI
+
+#define PTR_SIZE        ((int32_t)sizeof(void*))
+#define PTR_WIDE        (sizeof(void*) == 8)
+#define VREG(r)         ((int32_t)(r) * 4)
+#define VREF(r)         ((int32_t)(r) * PTR_SIZE)
+#define HEADER          ((int32_t)sizeof(art_object_t))
+
+// Çağrılar henüz yorumlayıcı yardımcısından geçer (doğrudan çağrı yok); komutlarının
+// dörtte birinden fazlası invoke olan metotta derleme kazandırmaz, yorumlanır.
+#define ART_JIT_INVOKE_SHARE    4
+
+typedef int (*art_jit_entry_t)(art_jit_frame_t* frame, const void* target);
+
+uint32_t art_jit_threshold = 0;
+
+static pthread_mutex_t art_jit_lock = PTHREAD_MUTEX_INITIALIZER;
+static uint8_t* art_jit_cache = NULL;             // Yürütülen görünüm (okuma + çalıştırma)
+static uint8_t* art_jit_cache_writable = NULL;    // Aynı sayfaların yazılan görünümü
+static uint32_t art_jit_cache_size = 0;
+static uint32_t art_jit_epilogue = 0;              // Ortak dönüş kodunun ofseti
+static art_jit_block_t* art_jit_free_blocks = NULL;
+static art_jit_code_t* art_jit_codes = NULL;       // Önbellekteki metotlar
+static art_jit_code_t* art_jit_retired = NULL;     // Çıkarılıp bekletilen kod
+static art_jit_code_t* art_jit_images = NULL;      // Görüntülerden bağlanan kod
+static uint32_t art_jit_retired_bytes = 0;
+static art_jit_thread_t* art_jit_threads = NULL;
+static uint32_t art_jit_thread_count = 0;
+static pthread_key_t art_jit_thread_key;
+static pthread_once_t art_jit_thread_once = PTHREAD_ONCE_INIT;
+static __thread art_jit_thread_t* art_jit_self = NULL;
+
+// JIT kodunda yardımcılar anlık değer olarak gömülür, görüntüler bu tabloyu alır
+static const void* const art_jit_symbols[ART_JIT_SYMBOL_COUNT] = {
+    (const void*)art_interp_jit_invoke,
+    (const void*)art_interp_jit_new_instance,
+    (const void*)art_heap_alloc
+};
+static uint64_t art_jit_clock = 0;
+static art_jit_stats_t art_jit_stats;
+
+// Yardımcı fonksiyonlar
+static int art_jit_invoke_heavy(const art_method_t* method);
+static int art_jit_emit_method(art_jit_compiler_t* compiler);
+static void art_jit_emit_instruction(art_jit_compiler_t* compiler, const uint16_t* insn, uint32_t pc);
+static int art_jit_emit_int_op(art_jit_compiler_t* compiler, uint8_t op, uint32_t dest, uint32_t x, uint32_t y, uint32_t pc);
+static int art_jit_emit_int_literal(art_jit_compiler_t* compiler, uint8_t op, uint32_t dest, uint32_t x, int32_t literal, uint32_t pc);
+static void art_jit_emit_branch(art_jit_compiler_t* compiler, int cc, uint32_t pc, uint32_t target);
+static void art_jit_emit_array_check(art_jit_compiler_t* compiler, uint32_t array, uint32_t index, uint8_t element_size, uint32_t pc);
+static int art_jit_emit_field_check(art_jit_compiler_t* compiler, uint32_t object, uint16_t slot, uint32_t pc,
+                                    int is_ref, int32_t* displacement);
+static void art_jit_emit_set_ref_flag(art_jit_compiler_t* compiler, uint32_t dest, int reg);
+static void art_jit_emit_exit(art_jit_compiler_t* compiler, uint32_t pc);
+static void art_jit_emit_jcc(art_jit_compiler_t* compiler, int cc, uint8_t kind, uint32_t target);
+static uint32_t art_jit_emit_local_jcc(art_jit_compiler_t* compiler, int cc);
+static void art_jit_bind_local(art_jit_compiler_t* compiler, uint32_t position);
+static void art_jit_emit_call(art_jit_compiler_t* compiler, uint32_t symbol, const uintptr_t* args, uint32_t count);
+static void art_jit_emit_stubs(art_jit_compiler_t* compiler);
+static void art_jit_emit_entry(art_jit_compiler_t* stub, uint32_t* epilogue);
+static void art_jit_link(art_jit_compiler_t* compiler, uint32_t code_offset, uint32_t epilogue);
+static void art_jit_free_compiler(art_jit_compiler_t* compiler);
+static void art_jit_byte(art_jit_compiler_t* compiler, uint8_t value);
+static void art_jit_u32(art_jit_compiler_t* compiler, uint32_t value);
+static void art_jit_mem(art_jit_compiler_t* compiler, int wide, uint32_t opcode, int reg, int base, int32_t disp);
+static void art_jit_mem_index(art_jit_compiler_t* compiler, int wide, uint32_t opcode, int reg, int base, int index,
+                              int scale, int32_t disp);
+static void art_jit_mov_imm_ptr(art_jit_compiler_t* compiler, int reg, const void* value);
+static void art_jit_add_patch(art_jit_compiler_t* compiler, uint8_t kind, uint32_t target);
+static int art_jit_allocate(uint32_t size, uint32_t* offset);
+static void art_jit_release(uint32_t offset, uint32_t size);
+static int art_jit_evict_one(void);
+static int art_jit_reclaim(void);
+static void art_jit_unlink(art_jit_code_t* code);
+static art_jit_thread_t* art_jit_register(void);
+static void art_jit_thread_exit(void* slot);
+static void art_jit_create_key(void);
+
+// JIT'i başlat: kod önbelleğini ayır ve giriş/dönüş kodunu yaz
+int art_jit_init(size_t code_cache_size, uint32_t threshold) {
+#if !defined(__i386__) && !defined(__x86_64__)
+    (void)code_cache_size;
+    (void)threshold;
+    return ART_JIT_ERROR_UNSUPPORTED;
+#else
+    if (art_jit_cache) {
+        return ART_JIT_ERROR_STATE;
+    }
+    
+    if (code_cache_size < ART_JIT_MIN_CACHE || code_cache_size > UINT32_MAX || threshold == 0) {
+        return ART_JIT_ERROR_INVALID;
+    }
+    
+    // Önbellek hiçbir adreste aynı anda yazılabilir ve çalıştırılabilir değildir:
+    // aynı bellek dosyası bir kez yazmaya, bir kez çalıştırmaya eşlenir. Koruma
+    // değiştirmeye gerek kalmaz, başka metotları çalıştıran iş parçacıkları
+    // derleme sırasında durmaz.
+    int fd = (int)syscall(SYS_memfd_create, "art-jit", MFD_CLOEXEC);
+    if (fd < 0) {
+        return ART_JIT_ERROR_UNSUPPORTED;
+    }
+    
+    uint8_t* cache = MAP_FAILED;
+    uint8_t* writable = MAP_FAILED;
+    if (ftruncate(fd, (off_t)code_cache_size) == 0) {
+        cache = (uint8_t*)mmap(NULL, code_cache_size, PROT_READ | PROT_EXEC, MAP_SHARED, fd, 0);
+        writable = (uint8_t*)mmap(NULL, code_cache_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    
+    art_jit_block_t* block = (art_jit_block_t*)malloc(sizeof(art_jit_block_t));
+    if (cache == MAP_FAILED || writable == MAP_FAILED || !block) {
+        if (cache != MAP_FAILED) {
+            munmap(cache, code_cache_size);
+        }
+        if (writable != MAP_FAILED) {
+            munmap(writable, code_cache_size);
+        }
+        free(block);
+        return ART_JIT_ERROR_NO_MEMORY;
+    }
+    
+    // Giriş/dönüş kodu önbelleğin başındadır
+    art_jit_compiler_t stub;
+    memset(&stub, 0, sizeof(stub));
+    stub.code = writable;
+    stub.capacity = ART_JIT_STUB_SIZE;
+    art_jit_emit_entry(&stub, &art_jit_epilogue);
+    
+    block->offset = ART_JIT_STUB_SIZE;
+    block->size = (uint32_t)code_cache_size - ART_JIT_STUB_SIZE;
+    block->next = NULL;
+    
+    memset(&art_jit_stats, 0, sizeof(art_jit_stats));
+    art_jit_stats.cache_size = code_cache_size;
+    art_jit_free_blocks = block;
+    art_jit_cache_size = (uint32_t)code_cache_size;
+    art_jit_cache = cache;
+    art_jit_cache_writable = writable;
+    art_jit_threshold = threshold;
+    
+    return 0;
+#endif
+}
+
+// JIT'i kapat. Derlenmiş kod çalışmıyor olmalıdır.
+void art_jit_cleanup(void) {
+    if (!art_jit_cache) {
+        return;
+    }
+    
+    art_jit_threshold = 0;
+    art_jit_flush();
+    
+    pthread_mutex_lock(&art_jit_lock);
+    
+    // Çalışırken kalan kodların metotları artık yok sayılır
+    while (art_jit_codes) {
+        art_jit_code_t* code = art_jit_codes;
+        art_jit_codes = code->next;
+        free(code->entries);
+        free(code);
+    }
+    while (art_jit_retired) {
+        art_jit_code_t* code = art_jit_retired;
+        art_jit_retired = code->next;
+        free(code->entries);
+        free(code->waits);
+        free(code);
+    }
+    art_jit_retired_bytes = 0;
+    
+    // Görüntü kodu önbellekte değildir; sahibi art_jit_detach_images ile bırakır
+    // Kayıtlar iş parçacıklarının yerel işaretçilerinden erişilir: yalnızca
+    // boşta olanlar bırakılır, yaşayanlar yeniden başlatmada kullanılır
+    art_jit_thread_t** link = &art_jit_threads;
+    while (*link) {
+        art_jit_thread_t* slot = *link;
+        if (!slot->used) {
+            *link = slot->next;
+            free(slot);
+        } else {
+            link = &slot->next;
+        }
+    }
+    while (art_jit_free_blocks) {
+        art_jit_block_t* block = art_jit_free_blocks;
+        art_jit_free_blocks = block->next;
+        free(block);
+    }
+    
+    munmap(art_jit_cache, art_jit_cache_size);
+    munmap(art_jit_cache_writable, art_jit_cache_size);
+    art_jit_cache = NULL;
+    art_jit_cache_writable = NULL;
+    art_jit_cache_size = 0;
+    
+    pthread_mutex_unlock(&art_jit_lock);
+}
+
+// Tüm derlenmiş kodu yayından kaldır; kullanımda olmayan bloklar hemen boşalır
+void art_jit_flush(void) {
+    if (!art_jit_cache) {
+        return;
+    }
+    
+    pthread_mutex_lock(&art_jit_lock);
+    while (art_jit_evict_one() == 0) {
+    }
+    art_jit_reclaim();
+    pthread_mutex_unlock(&art_jit_lock);
+}
+
+// Metodu derle ve yayınla
+int art_jit_compile(art_method_t* method) {
+    if (!art_jit_cache) {
+        return ART_JIT_ERROR_STATE;
+    }
+    
+    if (!method) {
+        return ART_JIT_ERROR_INVALID;
+    }
+    
+    if (method->native || !method->code || !__atomic_load_n(&method->insns, __ATOMIC_ACQUIRE)) {
+        return ART_JIT_ERROR_UNSUPPORTED;
+    }
+    
+    pthread_mutex_lock(&art_jit_lock);
+    
+    if (method->jit_code) {
+        pthread_mutex_unlock(&art_jit_lock);
+        return 0;
+    }
+    
+    art_jit_stats.misses++;
+    
+    // Sayaçlar sıfırlanır: tarama ancak her eşik dolduğunda bir kez tekrarlanır
+    if (art_jit_invoke_heavy(method)) {
+        art_jit_stats.invoke_heavy++;
+        method->invoke_count = 0;
+        method->backedge_count = 0;
+        pthread_mutex_unlock(&art_jit_lock);
+        return ART_JIT_ERROR_UNSUPPORTED;
+    }
+    
+    art_jit_compiler_t compiler;
+    memset(&compiler, 0, sizeof(compiler));
+    compiler.method = method;
+    
+    uint32_t offset = 0;
+    uint32_t size = 0;
+    int status = art_jit_emit_method(&compiler);
+    if (status == 0) {
+        size = (compiler.size + ART_JIT_ALIGN - 1) & ~(uint32_t)(ART_JIT_ALIGN - 1);
+        status = art_jit_allocate(size, &offset);
+    }
+    
+    art_jit_code_t* code = NULL;
+    if (status == 0) {
+        code = (art_jit_code_t*)malloc(sizeof(art_jit_code_t));
+        if (!code) {
+            art_jit_release(offset, size);
+            status = ART_JIT_ERROR_NO_MEMORY;
+        }
+    }
+    
+    if (status != 0) {
+        // Yer açılamadı: metot yeniden ısınınca tekrar denenir
+        art_jit_stats.failed++;
+        method->invoke_count = 0;
+        method->backedge_count = 0;
+        art_jit_free_compiler(&compiler);
+        pthread_mutex_unlock(&art_jit_lock);
+        return status;
+    }
+    
+    art_jit_link(&compiler, offset, art_jit_epilogue);
+    memcpy(art_jit_cache_writable + offset, compiler.code, compiler.size);
+    
+    memset(code, 0, sizeof(*code));
+    code->method = method;
+    code->offset = offset;
+    code->size = size;
+    code->code = art_jit_cache + offset;
+    code->trampoline = art_jit_cache;
+    code->imports = art_jit_symbols;
+    code->entries = compiler.entries;
+    code->last_use = art_jit_clock;
+    code->next = art_jit_codes;
+    art_jit_codes = code;
+    
+    art_jit_stats.compiled_methods++;
+    art_jit_stats.compilations++;
+    art_jit_stats.cache_used += size;
+    
+    compiler.entries = NULL;
+    art_jit_free_compiler(&compiler);
+    
+    __atomic_store_n(&method->jit_code, code, __ATOMIC_RELEASE);
+    
+    pthread_mutex_unlock(&art_jit_lock);
+    
+    return 0;
+}
+
+// Çerçeveyi derlenmiş kodda sürdür. En dıştaki girişte derinlik tam bariyerle
+// yazılır, yayın ondan sonra okunur: çıkarma önce yayını kaldırıp sonra
+// derinliklere baktığı için ikisinden biri mutlaka diğerini görür.
+int art_jit_run(art_jit_frame_t* frame, uint32_t pc) {
+    art_method_t* method = frame->method;
+    if (!__atomic_load_n(&method->jit_code, __ATOMIC_RELAXED)) {
+        return (int)pc;
+    }
+    
+    art_jit_thread_t* self = art_jit_self;
+    if (!self) {
+        self = art_jit_register();
+        if (!self) {
+            return (int)pc;
+        }
+    }
+    
+    uint32_t depth = self->depth;
+    if (depth == 0) {
+        __atomic_exchange_n(&self->depth, 1, __ATOMIC_SEQ_CST);
+    } else {
+        __atomic_store_n(&self->depth, depth + 1, __ATOMIC_RELAXED);
+    }
+    
+    int resume = (int)pc;
+    art_jit_code_t* code = (art_jit_code_t*)__atomic_load_n(&method->jit_code, __ATOMIC_SEQ_CST);
+    if (code && code->entries[pc]) {
+        uint64_t now = __atomic_load_n(&art_jit_clock, __ATOMIC_RELAXED) + 1;
+        __atomic_store_n(&art_jit_clock, now, __ATOMIC_RELAXED);
+        code->last_use = now;
+    
+        // Sayaçlar yarışlıdır (yaklaşık); kilitli artırma her girişte pahalıdır
+        art_jit_stats.hits++;
+        if (pc != 0) {
+            art_jit_stats.osr_entries++;
+        }
+    
+        frame->suspend = art_heap_suspend_flag();
+        frame->imports = code->imports;
+        frame->caches = method->caches;
+    
+        art_jit_entry_t entry = (art_jit_entry_t)(void*)code->trampoline;
+        resume = entry(frame, code->code + code->entries[pc] - 1);
+    
+        if (resume >= 0 && resume != ART_JIT_RETURNED) {
+            art_jit_stats.bailouts++;
+        }
+    }
+    
+    if (depth == 0) {
+        __atomic_store_n(&self->exits, self->exits + 1, __ATOMIC_RELEASE);
+        __atomic_store_n(&self->depth, 0, __ATOMIC_RELEASE);
+    } else {
+        __atomic_store_n(&self->depth, depth, __ATOMIC_RELAXED);
+    }
+    
+    return resume;
+}
+
+// JIT istatistiklerini al
+int art_jit_get_stats(art_jit_stats_t* stats) {
+    if (!stats) {
+        return ART_JIT_ERROR_INVALID;
+    }
+    
+    if (!art_jit_cache) {
+        return ART_JIT_ERROR_STATE;
+    }
+    
+    pthread_mutex_lock(&art_jit_lock);
+    *stats = art_jit_stats;
+    pthread_mutex_unlock(&art_jit_lock);
+    
+    uint64_t lookups = stats->hits + stats->misses;
+    stats->hit_rate = lookups ? (float)((double)stats->hits * 100.0 / (double)lookups) : 0.0f;
+    
+    return 0;
+}
+
+// Görüntünün giriş/dönüş kodunu tampona yaz (ART_JIT_STUB_SIZE bayt)
+int art_jit_image_stubs(uint8_t* buffer, uint32_t* epilogue) {
+#if !defined(__i386__) && !defined(__x86_64__)
+    (void)buffer;
+    (void)epilogue;
+    return ART_JIT_ERROR_UNSUPPORTED;
+#else
+    if (!buffer || !epilogue) {
+        return ART_JIT_ERROR_INVALID;
+    }
+    
+    art_jit_compiler_t stub;
+    memset(&stub, 0, sizeof(stub));
+    stub.code = buffer;
+    stub.capacity = ART_JIT_STUB_SIZE;
+    art_jit_emit_entry(&stub, epilogue);
+    
+    return stub.failed ? ART_JIT_ERROR_NO_MEMORY : 0;
+#endif
+}
+
+// Metodu görüntü için derle: kod yalnızca çerçeveye ve içe aktarma tablosuna
+// dayanır, code_offset'e yerleşecek şekilde bağlanır. code ve entries çağıranındır.
+int art_jit_compile_image(art_method_t* method, uint32_t code_offset, uint32_t epilogue,
+                          uint8_t** code, uint32_t* size, uint32_t** entries) {
+#if !defined(__i386__) && !defined(__x86_64__)
+    (void)method;
+    (void)code_offset;
+    (void)epilogue;
+    (void)code;
+    (void)size;
+    (void)entries;
+    return ART_JIT_ERROR_UNSUPPORTED;
+#else
+    if (!method || !code || !size || !entries) {
+        return ART_JIT_ERROR_INVALID;
+    }
+    
+    if (method->native || !method->code || !method->insns || art_jit_invoke_heavy(method)) {
+        return ART_JIT_ERROR_UNSUPPORTED;
+    }
+    
+    art_jit_compiler_t compiler;
+    memset(&compiler, 0, sizeof(compiler));
+    compiler.method = method;
+    compiler.image = 1;
+    
+    int status = art_jit_emit_method(&compiler);
+    if (status != 0) {
+        art_jit_free_compiler(&compiler);
+        return status;
+    }
+    
+    art_jit_link(&compiler, code_offset, epilogue);
+    
+    *code = compiler.code;
+    *size = compiler.size;
+    *entries = compiler.entries;
+    compiler.code = NULL;
+    compiler.entries = NULL;
+    art_jit_free_compiler(&compiler);
+    
+    return 0;
+#endif
+}
+
+// Görüntü kodunun içe aktardığı yardımcının adresi
+const void* art_jit_symbol(uint32_t symbol) {
+    return symbol < ART_JIT_SYMBOL_COUNT ? art_jit_symbols[symbol] : NULL;
+}
+
+// Eşlenmiş görüntüdeki kodu metoda bağla. Metot zaten derlenmişse dokunulmaz.
+// Kod JIT önbelleğinde değildir: çıkarılmaz, sahibi ayrılınca bırakılır.
+int art_jit_attach_image(art_method_t* method, const uint8_t* code, const uint32_t* entries,
+                         const uint8_t* trampoline, const void* const* imports, const void* owner) {
+    if (!method || !code || !entries || !trampoline || !imports || !owner) {
+        return ART_JIT_ERROR_INVALID;
+    }
+    
+    art_jit_code_t* image = (art_jit_code_t*)malloc(sizeof(art_jit_code_t));
+    if (!image) {
+        return ART_JIT_ERROR_NO_MEMORY;
+    }
+    
+    memset(image, 0, sizeof(*image));
+    image->method = method;
+    image->code = code;
+    image->trampoline = trampoline;
+    image->imports = imports;
+    image->owner = owner;
+    image->entries = (uint32_t*)entries;
+    
+    pthread_mutex_lock(&art_jit_lock);
+    
+    if (method->jit_code) {
+        pthread_mutex_unlock(&art_jit_lock);
+        free(image);
+        return 0;
+    }
+    
+    image->next = art_jit_images;
+    art_jit_images = image;
+    __atomic_store_n(&method->jit_code, image, __ATOMIC_RELEASE);
+    
+    pthread_mutex_unlock(&art_jit_lock);
+    
+    return 0;
+}
+
+// Görüntünün bağlantı kayıtlarını bırak. Metotlar görüntüyle birlikte yok
+// edilmiş olmalıdır (görüntü yalnızca kendi DEX'lerinin metotlarına bağlanır).
+void art_jit_detach_images(const void* owner) {
+    pthread_mutex_lock(&art_jit_lock);
+    
+    art_jit_code_t** link = &art_jit_images;
+    while (*link) {
+        art_jit_code_t* code = *link;
+        if (code->owner == owner) {
+            *link = code->next;
+            free(code);
+        } else {
+            link = &code->next;
+        }
+    }
+    
+    pthread_mutex_unlock(&art_jit_lock);
+}
+
+// Çağrı yoğun metot mu? Yük tabloları (payload) komut sayılmaz.
+static int art_jit_invoke_heavy(const art_method_t* method) {
+    uint32_t size = method->code->insns_size;
+    uint32_t insns = 0;
+    uint32_t invokes = 0;
+    
+    for (uint32_t pc = 0; pc < size; ) {
+        const uint16_t* insn = method->insns + pc;
+        uint32_t width = art_interp_insn_width(insn, size - pc);
+        if (width == 0) {
+            break;
+        }
+        
+        uint8_t op = insn[0] & 0xFF;
+        if (op != 0x00 || (insn[0] >> 8) == 0) {
+            insns++;
+            if ((op >= 0x6e && op <= 0x72) || (op >= 0x74 && op <= 0x78)) {
+                invokes++;
+            }
+        }
+        pc += width;
+    }
+    
+    return (uint64_t)invokes * ART_JIT_INVOKE_SHARE > insns;
+}
+
+// Metodu komut komut çevir. Her komut başı giriş noktası olarak kaydedilir;
+// veri tabloları atlanır. art_jit_lock tutulur.
+static int art_jit_emit_method(art_jit_compiler_t* compiler) {
+    art_method_t* method = compiler->method;
+    uint32_t size = method->code->insns_size;
+    
+    compiler->capacity = 64 + size * 32;
+    compiler->code = (uint8_t*)malloc(compiler->capacity);
+    compiler->entries = (uint32_t*)calloc(size, sizeof(uint32_t));
+    compiler->stubs = (uint32_t*)calloc(size + 1, sizeof(uint32_t));
+    if (!compiler->code || !compiler->entries || !compiler->stubs) {
+        return ART_JIT_ERROR_NO_MEMORY;
+    }
+    
+    for (uint32_t pc = 0; pc < size; ) {
+        const uint16_t* insn = method->insns + pc;
+        uint32_t width = art_interp_insn_width(insn, size - pc);
+        if (width == 0) {
+            return ART_JIT_ERROR_UNSUPPORTED;
+        }
+    
+        if ((insn[0] & 0xFF) != 0x00 || (insn[0] >> 8) == 0) {
+            compiler->entries[pc] = compiler->size + 1;
+            art_jit_emit_instruction(compiler, insn, pc);
+        }
+        pc += width;
+    }
+    
+    // Doğrulanmış kod sondan taşmaz; yine de sondaki geçersiz komuta çıkılır
+    art_jit_emit_exit(compiler, size);
+    art_jit_emit_stubs(compiler);
+    
+    if (compiler->failed) {
+        return ART_JIT_ERROR_NO_MEMORY;
+    }
+    
+    // Dallar ve taslaklar kod içi göreli adreslerdir
+    for (uint32_t i = 0; i < compiler->patch_count; i++) {
+        art_jit_patch_t* patch = &compiler->patches[i];
+        uint32_t target;
+    
+        if (patch->kind == ART_JIT_PATCH_BRANCH) {
+            target = compiler->entries[patch->target] - 1;
+        } else if (patch->kind == ART_JIT_PATCH_EXIT) {
+            target = compiler->stubs[patch->target] - 1;
+        } else {
+            continue;
+        }
+    
+        int32_t relative = (int32_t)(target - (patch->position + 4));
+        memcpy(compiler->code + patch->position, &relative, 4);
+    }
+    
+    return 0;
+}
+
+// Tek komutun şablonu. Desteklenmeyen komutlar yorumlayıcıya çıkar.
+static void art_jit_emit_instruction(art_jit_compiler_t* compiler, const uint16_t* insn, uint32_t pc) {
+    uint16_t inst = insn[0];
+    uint8_t opcode = inst & 0xFF;
+    uint32_t a = (inst >> 8) & 0x0F;
+    uint32_t b = inst >> 12;
+    uint32_t aa = inst >> 8;
+    int32_t displacement;
+    
+    switch (opcode) {
+        case 0x00:  // nop
+            return;
+    
+        case 0x01: case 0x07:  // move, move-object
+            art_jit_mem(compiler, 0, 0x8B, EAX, VREGS, VREG(b));
+            art_jit_mem(compiler, 0, 0x89, EAX, VREGS, VREG(a));
+            art_jit_mem(compiler, PTR_WIDE, 0x8B, EAX, REFS, VREF(b));
+            art_jit_mem(compiler, PTR_WIDE, 0x89, EAX, REFS, VREF(a));
+            return;
+    
+        case 0x02: case 0x08:  // move/from16
+            art_jit_mem(compiler, 0, 0x8B, EAX, VREGS, VREG(insn[1]));
+            art_jit_mem(compiler, 0, 0x89, EAX, VREGS, VREG(aa));
+            art_jit_mem(compiler, PTR_WIDE, 0x8B, EAX, REFS, VREF(insn[1]));
+            art_jit_mem(compiler, PTR_WIDE, 0x89, EAX, REFS, VREF(aa));
+            return;
+    
+        case 0x03: case 0x09:  // move/16
+            art_jit_mem(compiler, 0, 0x8B, EAX, VREGS, VREG(insn[2]));
+            art_jit_mem(compiler, 0, 0x89, EAX, VREGS, VREG(insn[1]));
+            art_jit_mem(compiler, PTR_WIDE, 0x8B, EAX, REFS, VREF(insn[2]));
+            art_jit_mem(compiler, PTR_WIDE, 0x89, EAX, REFS, VREF(insn[1]));
+            return;
+    
+        case 0x04: case 0x05: case 0x06: {  // move-wide
+            uint32_t dest = opcode == 0x04 ? a : (opcode == 0x05 ? aa : insn[1]);
+            uint32_t source = opcode == 0x04 ? b : (opcode == 0x05 ? insn[1] : insn[2]);
+            art_jit_mem(compiler, 0, 0x8B, EAX, VREGS, VREG(source));
+            art_jit_mem(compiler, 0, 0x8B, EDX, VREGS, VREG(source + 1));
+            art_jit_mem(compiler, 0, 0x89, EAX, VREGS, VREG(dest));
+            art_jit_mem(compiler, 0, 0x89, EDX, VREGS, VREG(dest + 1));
+            art_jit_mem(compiler, PTR_WIDE, 0xC7, 0, REFS, VREF(dest));
+            art_jit_u32(compiler, 0);
+            art_jit_mem(compiler, PTR_WIDE, 0xC7, 0, REFS, VREF(dest + 1));
+            art_jit_u32(compiler, 0);
+            return;
+        }
+    
+        case 0x0a:  // move-result
+            art_jit_mem(compiler, PTR_WIDE, 0x8B, EAX, FRAME, offsetof(art_jit_frame_t, result));
+            art_jit_mem(compiler, 0, 0x8B, EAX, EAX, 0);
+            break;
+    
+        case 0x0b:  // move-result-wide
+            art_jit_mem(compiler, PTR_WIDE, 0x8B, ECX, FRAME, offsetof(art_jit_frame_t, result));
+            art_jit_mem(compiler, 0, 0x8B, EAX, ECX, 0);
+            art_jit_mem(compiler, 0, 0x8B, EDX, ECX, 4);
+            art_jit_mem(compiler, 0, 0x89, EAX, VREGS, VREG(aa));
+            art_jit_mem(compiler, 0, 0x89, EDX, VREGS, VREG(aa + 1));
+            art_jit_mem(compiler, PTR_WIDE, 0xC7, 0, REFS, VREF(aa));
+            art_jit_u32(compiler, 0);
+            art_jit_mem(compiler, PTR_WIDE, 0xC7, 0, REFS, VREF(aa + 1));
+            art_jit_u32(compiler, 0);
+            return;
+    
+        case 0x0c:  // move-result-object
+            art_jit_mem(compiler, PTR_WIDE, 0x8B, EAX, FRAME, offsetof(art_jit_frame_t, returned));
+            art_jit_mem(compiler, PTR_WIDE, 0x8B, ECX, EAX, 0);
+            art_jit_mem(compiler, PTR_WIDE, 0xC7, 0, EAX, 0);
+            art_jit_u32(compiler, 0);
+            art_jit_mem(compiler, PTR_WIDE, 0x89, ECX, REFS, VREF(aa));
+            art_jit_emit_set_ref_flag(compiler, aa, ECX);
+            return;
+    
+        case 0x0e:  // return-void
+            art_jit_byte(compiler, 0xB8);                       // mov eax, ART_JIT_RETURNED
+            art_jit_u32(compiler, ART_JIT_RETURNED);
+            art_jit_emit_jcc(compiler, -1, ART_JIT_PATCH_EPILOGUE, 0);
+            return;
+    
+        case 0x0f: case 0x10:  // return, return-wide
+            art_jit_mem(compiler, PTR_WIDE, 0x8B, ECX, FRAME, offsetof(art_jit_frame_t, result));
+            art_jit_mem(compiler, 0, 0x8B, EAX, VREGS, VREG(aa));
+            art_jit_mem(compiler, 0, 0x89, EAX, ECX, 0);
+            if (opcode == 0x10) {
+                art_jit_mem(compiler, 0, 0x8B, EAX, VREGS, VREG(aa + 1));
+                art_jit_mem(compiler, 0, 0x89, EAX, ECX, 4);
+            }
+            art_jit_byte(compiler, 0xB8);
+            art_jit_u32(compiler, ART_JIT_RETURNED);
+            art_jit_emit_jcc(compiler, -1, ART_JIT_PATCH_EPILOGUE, 0);
+            return;
+    
+        case 0x11:  // return-object
+            art_jit_mem(compiler, PTR_WIDE, 0x8B, ECX, FRAME, offsetof(art_jit_frame_t, returned));
+            art_jit_mem(compiler, PTR_WIDE, 0x8B, EAX, REFS, VREF(aa));
+            art_jit_mem(compiler, PTR_WIDE, 0x89, EAX, ECX, 0);
+            art_jit_byte(compiler, 0xB8);
+            art_jit_u32(compiler, ART_JIT_RETURNED);
+            art_jit_emit_jcc(compiler, -1, ART_JIT_PATCH_EPILOGUE, 0);
+            return;
+    
+        case 0x12:  // const/4
+            art_jit_mem(compiler, 0, 0xC7, 0, VREGS, VREG(a));
+            art_jit_u32(compiler, (uint32_t)((int32_t)(int16_t)inst >> 12));
+            art_jit_mem(compiler, PTR_WIDE, 0xC7, 0, REFS, VREF(a));
+            art_jit_u32(compiler, 0);
+            return;
+    
+        case 0x13: case 0x14: case 0x15: {  // const/16, const, const/high16
+            uint32_t value = opcode == 0x13 ? (uint32_t)(int32_t)(int16_t)insn[1]
+                           : opcode == 0x14 ? (uint32_t)insn[1] | ((uint32_t)insn[2] << 16)
+                           : (uint32_t)insn[1] << 16;
+            art_jit_mem(compiler, 0, 0xC7, 0, VREGS, VREG(aa));
+            art_jit_u32(compiler, value);
+            art_jit_mem(compiler, PTR_WIDE, 0xC7, 0, REFS, VREF(aa));
+            art_jit_u32(compiler, 0);
+            return;
+        }
+    
+        case 0x16: case 0x17: case 0x18: case 0x19: {  // const-wide*
+            uint64_t value;
+            if (opcode == 0x16) {
+                value = (uint64_t)(int64_t)(int16_t)insn[1];
+            } else if (opcode == 0x17) {
+                value = (uint64_t)(int64_t)(int32_t)((uint32_t)insn[1] | ((uint32_t)insn[2] << 16));
+            } else if (opcode == 0x18) {
+                value = (uint64_t)insn[1] | ((uint64_t)insn[2] << 16) | ((uint64_t)insn[3] << 32) | ((uint64_t)insn[4] << 48);
+            } else {
+                value = (uint64_t)insn[1] << 48;
+            }
+            art_jit_mem(compiler, 0, 0xC7, 0, VREGS, VREG(aa));
+            art_jit_u32(compiler, (uint32_t)value);
+            art_jit_mem(compiler, 0, 0xC7, 0, VREGS, VREG(aa + 1));
+            art_jit_u32(compiler, (uint32_t)(value >> 32));
+            art_jit_mem(compiler, PTR_WIDE, 0xC7, 0, REFS, VREF(aa));
+            art_jit_u32(compiler, 0);
+            art_jit_mem(compiler, PTR_WIDE, 0xC7, 0, REFS, VREF(aa + 1));
+            art_jit_u32(compiler, 0);
+            return;
+        }
+    
+        case 0x28:  // goto
+            art_jit_emit_branch(compiler, -1, pc, pc + (int8_t)aa);
+            return;
+        case 0x29:  // goto/16
+            art_jit_emit_branch(compiler, -1, pc, pc + (int16_t)insn[1]);
+            return;
+        case 0x2a:  // goto/32
+            art_jit_emit_branch(compiler, -1, pc, pc + (int32_t)((uint32_t)insn[1] | ((uint32_t)insn[2] << 16)));
+            return;
+    
+        case 0x32: {  // if-eq: nesne yazmaçlarında işaretçiler de eşit olmalı
+            uint32_t target = pc + (int16_t)insn[1];
+            art_jit_mem(compiler, 0, 0x8B, EAX, VREGS, VREG(a));
+            art_jit_mem(compiler, 0, 0x3B, EAX, VREGS, VREG(b));
+            uint32_t differ = art_jit_emit_local_jcc(compiler, CC_NE);
+            art_jit_mem(compiler, PTR_WIDE, 0x8B, EAX, REFS, VREF(a));
+            art_jit_mem(compiler, PTR_WIDE, 0x3B, EAX, REFS, VREF(b));
+            art_jit_emit_branch(compiler, CC_E, pc, target);
+            art_jit_bind_local(compiler, differ);
+            return;
+        }
+    
+        case 0x33: {  // if-ne
+            uint32_t target = pc + (int16_t)insn[1];
+            art_jit_mem(compiler, 0, 0x8B, EAX, VREGS, VREG(a));
+            art_jit_mem(compiler, 0, 0x3B, EAX, VREGS, VREG(b));
+            art_jit_emit_branch(compiler, CC_NE, pc, target);
+            art_jit_mem(compiler, PTR_WIDE, 0x8B, EAX, REFS, VREF(a));
+            art_jit_mem(compiler, PTR_WIDE, 0x3B, EAX, REFS, VREF(b));
+            art_jit_emit_branch(compiler, CC_NE, pc, target);
+            return;
+        }
+    
+        case 0x34: case 0x35: case 0x36: case 0x37: {  // if-lt, if-ge, if-gt, if-le
+            static const int conditions[] = { CC_L, CC_GE, CC_G, CC_LE };
+            art_jit_mem(compiler, 0, 0x8B, EAX, VREGS, VREG(a));
+            art_jit_mem(compiler, 0, 0x3B, EAX, VREGS, VREG(b));
+            art_jit_emit_branch(compiler, conditions[opcode - 0x34], pc, pc + (int16_t)insn[1]);
+            return;
+        }
+    
+        case 0x38: case 0x39: case 0x3a: case 0x3b: case 0x3c: case 0x3d: {  // if-*z
+            static const int conditions[] = { CC_E, CC_NE, CC_L, CC_GE, CC_G, CC_LE };
+            art_jit_mem(compiler, 0, 0x8B, EAX, VREGS, VREG(aa));
+            art_jit_byte(compiler, 0x85);                       // test eax, eax
+            art_jit_byte(compiler, 0xC0);
+            art_jit_emit_branch(compiler, conditions[opcode - 0x38], pc, pc + (int16_t)insn[1]);
+            return;
+        }
+    
+        case 0x44: case 0x47: case 0x48: case 0x49: case 0x4a: {  // aget (ilkel, 32 bit ve altı)
+            static const uint8_t sizes[] = { 4, 0, 0, 1, 1, 2, 2 };
+            static const uint32_t loads[] = { 0x8B, 0, 0, 0x0FB6, 0x0FBE, 0x0FB7, 0x0FBF };
+            uint8_t kind = opcode - 0x44;
+            art_jit_emit_array_check(compiler, insn[1] & 0xFF, insn[1] >> 8, sizes[kind], pc);
+            art_jit_mem_index(compiler, 0, loads[kind], ECX, EAX, EDX, sizes[kind], HEADER + 8);
+            art_jit_mem(compiler, 0, 0x89, ECX, VREGS, VREG(aa));
+            art_jit_mem(compiler, PTR_WIDE, 0xC7, 0, REFS, VREF(aa));
+            art_jit_u32(compiler, 0);
+            return;
+        }
+    
+        case 0x46:  // aget-object: elemanlar referans yuvalarıdır, uzunluk ref_count'tur (geniş diziler yorumlayıcıda)
+            art_jit_emit_array_check(compiler, insn[1] & 0xFF, insn[1] >> 8, 0, pc);
+            art_jit_mem_index(compiler, PTR_WIDE, 0x8B, ECX, EAX, EDX, PTR_SIZE, HEADER);
+            art_jit_mem(compiler, PTR_WIDE, 0x89, ECX, REFS, VREF(aa));
+            art_jit_emit_set_ref_flag(compiler, aa, ECX);
+            return;
+    
+        case 0x4b: case 0x4e: case 0x4f: case 0x50: case 0x51: {  // aput (ilkel)
+            static const uint8_t sizes[] = { 4, 0, 0, 1, 1, 2, 2 };
+            static const uint32_t stores[] = { 0x89, 0, 0, 0x88, 0x88, 0x6689, 0x6689 };
+            uint8_t kind = opcode - 0x4b;
+            art_jit_emit_array_check(compiler, insn[1] & 0xFF, insn[1] >> 8, sizes[kind], pc);
+            art_jit_mem(compiler, 0, 0x8B, ECX, VREGS, VREG(aa));
+            art_jit_mem_index(compiler, 0, stores[kind], ECX, EAX, EDX, sizes[kind], HEADER + 8);
+            return;
+        }
+    
+        case 0x52: case 0x55: case 0x56: case 0x57: case 0x58: {  // iget (ilkel, 32 bit ve altı)
+            static const uint32_t loads[] = { 0x8B, 0, 0, 0x0FB6, 0x0FBE, 0x0FB7, 0x0FBF };
+            if (art_jit_emit_field_check(compiler, b, insn[1], pc, 0, &displacement) != 0) {
+                return;
+            }
+            art_jit_mem(compiler, 0, loads[opcode - 0x52], ECX, EAX, displacement);
+            art_jit_mem(compiler, 0, 0x89, ECX, VREGS, VREG(a));
+            art_jit_mem(compiler, PTR_WIDE, 0xC7, 0, REFS, VREF(a));
+            art_jit_u32(compiler, 0);
+            return;
+        }
+    
+        case 0x54:  // iget-object
+            if (art_jit_emit_field_check(compiler, b, insn[1], pc, 1, &displacement) != 0) {
+                return;
+            }
+            art_jit_mem(compiler, PTR_WIDE, 0x8B, ECX, EAX, displacement);
+            art_jit_mem(compiler, PTR_WIDE, 0x89, ECX, REFS, VREF(a));
+            art_jit_emit_set_ref_flag(compiler, a, ECX);
+            return;
+    
+        case 0x59: case 0x5c: case 0x5d: case 0x5e: case 0x5f: {  // iput (ilkel, 32 bit ve altı)
+            static const uint32_t stores[] = { 0x89, 0, 0, 0x88, 0x88, 0x6689, 0x6689 };
+            if (art_jit_emit_field_check(compiler, b, insn[1], pc, 0, &displacement) != 0) {
+                return;
+            }
+            art_jit_mem(compiler, 0, 0x8B, ECX, VREGS, VREG(a));
+            art_jit_mem(compiler, 0, stores[opcode - 0x59], ECX, EAX, displacement);
+            return;
+        }
+    
+        case 0x22: {  // new-instance: sınıfı başlatılmış yuvada doğrudan ayrılır
+            art_class_t* klass = compiler->image ? NULL : __atomic_load_n(&compiler->method->caches[insn[1]].klass,
+                                                                          __ATOMIC_ACQUIRE);
+            if (!klass) {
+                // Sınıfı yardımcı çözer ve başlatır; hata istisnadır
+                uintptr_t args[] = { 0, pc };
+                art_jit_emit_call(compiler, ART_JIT_SYMBOL_NEW_INSTANCE, args, 2);
+                art_jit_byte(compiler, 0x85);                   // test eax, eax
+                art_jit_byte(compiler, 0xC0);
+                art_jit_emit_jcc(compiler, CC_NE, ART_JIT_PATCH_EPILOGUE, 0);
+                return;
+            }
+            uintptr_t args[] = { (uintptr_t)klass, klass->ref_fields, klass->data_size };
+            art_jit_emit_call(compiler, ART_JIT_SYMBOL_ALLOC, args, 3);
+            if (PTR_WIDE) {
+                art_jit_byte(compiler, 0x48);
+            }
+            art_jit_byte(compiler, 0x85);                       // test eax, eax
+            art_jit_byte(compiler, 0xC0);
+            art_jit_emit_jcc(compiler, CC_E, ART_JIT_PATCH_EXIT, pc);
+            art_jit_mem(compiler, PTR_WIDE, 0x89, EAX, REFS, VREF(aa));
+            art_jit_mem(compiler, 0, 0xC7, 0, VREGS, VREG(aa));
+            art_jit_u32(compiler, 1);
+            return;
+        }
+    
+        case 0x6e: case 0x6f: case 0x70: case 0x71: case 0x72:  // invoke-*
+        case 0x74: case 0x75: case 0x76: case 0x77: case 0x78: {  // invoke-*/range
+            uintptr_t args[] = { 0, pc };
+            art_jit_emit_call(compiler, ART_JIT_SYMBOL_INVOKE, args, 2);
+            art_jit_byte(compiler, 0x85);                       // test eax, eax
+            art_jit_byte(compiler, 0xC0);
+            art_jit_emit_jcc(compiler, CC_NE, ART_JIT_PATCH_EPILOGUE, 0);
+            return;
+        }
+    
+        case 0x7b: case 0x7c:  // neg-int, not-int
+            art_jit_mem(compiler, 0, 0x8B, EAX, VREGS, VREG(b));
+            art_jit_byte(compiler, 0xF7);
+            art_jit_byte(compiler, opcode == 0x7b ? 0xD8 : 0xD0);
+            break;
+    
+        case 0x84:  // long-to-int
+            art_jit_mem(compiler, 0, 0x8B, EAX, VREGS, VREG(b));
+            break;
+    
+        case 0x8d: case 0x8e: case 0x8f:  // int-to-byte, int-to-char, int-to-short
+            art_jit_mem(compiler, 0, 0x8B, EAX, VREGS, VREG(b));
+            art_jit_byte(compiler, 0x0F);
+            art_jit_byte(compiler, opcode == 0x8d ? 0xBE : (opcode == 0x8e ? 0xB7 : 0xBF));
+            art_jit_byte(compiler, 0xC0);
+            break;
+    
+        case 0x9b: case 0x9c: case 0xa0: case 0xa1: case 0xa2:      // add/sub/and/or/xor-long
+        case 0xbb: case 0xbc: case 0xc0: case 0xc1: case 0xc2: {    // .../2addr
+            static const uint8_t low[] = { 0x03, 0x2B, 0, 0, 0, 0x23, 0x0B, 0x33 };
+            static const uint8_t high[] = { 0x13, 0x1B, 0, 0, 0, 0x23, 0x0B, 0x33 };
+            int two_address = opcode >= 0xbb;
+            uint8_t op = opcode - (two_address ? 0xbb : 0x9b);
+            uint32_t dest = two_address ? a : aa;
+            uint32_t x = two_address ? a : (uint32_t)(insn[1] & 0xFF);
+            uint32_t y = two_address ? b : (uint32_t)(insn[1] >> 8);
+            art_jit_mem(compiler, 0, 0x8B, EAX, VREGS, VREG(x));
+            art_jit_mem(compiler, 0, 0x8B, EDX, VREGS, VREG(x + 1));
+            art_jit_mem(compiler, 0, low[op], EAX, VREGS, VREG(y));
+            art_jit_mem(compiler, 0, high[op], EDX, VREGS, VREG(y + 1));
+            art_jit_mem(compiler, 0, 0x89, EAX, VREGS, VREG(dest));
+            art_jit_mem(compiler, 0, 0x89, EDX, VREGS, VREG(dest + 1));
+            art_jit_mem(compiler, PTR_WIDE, 0xC7, 0, REFS, VREF(dest));
+            art_jit_u32(compiler, 0);
+            art_jit_mem(compiler, PTR_WIDE, 0xC7, 0, REFS, VREF(dest + 1));
+            art_jit_u32(compiler, 0);
+            return;
+        }
+    
+        default:
+            if (opcode >= 0x90 && opcode <= 0x9a) {
+                if (art_jit_emit_int_op(compiler, opcode - 0x90, aa, insn[1] & 0xFF, insn[1] >> 8, pc) == 0) {
+                    return;
+                }
+            } else if (opcode >= 0xb0 && opcode <= 0xba) {
+                if (art_jit_emit_int_op(compiler, opcode - 0xb0, a, a, b, pc) == 0) {
+                    return;
+                }
+            } else if (opcode >= 0xd0 && opcode <= 0xd7) {
+                if (art_jit_emit_int_literal(compiler, opcode - 0xd0, a, b, (int16_t)insn[1], pc) == 0) {
+                    return;
+                }
+            } else if (opcode >= 0xd8 && opcode <= 0xe2) {
+                if (art_jit_emit_int_literal(compiler, opcode - 0xd8, aa, insn[1] & 0xFF, (int8_t)(insn[1] >> 8), pc) == 0) {
+                    return;
+                }
+            }
+    
+            // Dönüşler, ayırma, istisna ve kayan nokta komutları yorumlayıcıda çalışır
+            art_jit_emit_exit(compiler, pc);
+            return;
+    }
+    
+    // Tek sözcüklü sonuç EAX'ta: hedef A (12x) ya da AA (11x)
+    uint32_t dest = (opcode == 0x0a) ? aa : a;
+    art_jit_mem(compiler, 0, 0x89, EAX, VREGS, VREG(dest));
+    art_jit_mem(compiler, PTR_WIDE, 0xC7, 0, REFS, VREF(dest));
+    art_jit_u32(compiler, 0);
+}
+
+// Tam sayı işlemi (23x, 2addr): ekle, çıkar, çarp, böl, kalan, ve, veya, xor, kaydırmalar
+static int art_jit_emit_int_op(art_jit_compiler_t* compiler, uint8_t op, uint32_t dest, uint32_t x, uint32_t y, uint32_t pc) {
+    static const uint32_t opcodes[] = { 0x03, 0x2B, 0x0FAF, 0, 0, 0x23, 0x0B, 0x33 };
+    static const uint8_t shifts[] = { 0xE0, 0xF8, 0xE8 };  // shl, sar, shr
+    
+    art_jit_mem(compiler, 0, 0x8B, EAX, VREGS, VREG(x));
+    
+    if (op >= 8) {
+        // x86 kaydırma sayısını 31 ile maskeler; Java ile aynı
+        art_jit_mem(compiler, 0, 0x8B, ECX, VREGS, VREG(y));
+        art_jit_byte(compiler, 0xD3);
+        art_jit_byte(compiler, shifts[op - 8]);
+    } else if (opcodes[op]) {
+        art_jit_mem(compiler, 0, opcodes[op], EAX, VREGS, VREG(y));
+    } else {
+        // Sıfıra bölme istisnası ve INT_MIN / -1 taşması yorumlayıcıya kalır
+        art_jit_mem(compiler, 0, 0x8B, ECX, VREGS, VREG(y));
+        art_jit_byte(compiler, 0x85);                           // test ecx, ecx
+        art_jit_byte(compiler, 0xC9);
+        art_jit_emit_jcc(compiler, CC_E, ART_JIT_PATCH_EXIT, pc);
+        art_jit_byte(compiler, 0x83);                           // cmp ecx, -1
+        art_jit_byte(compiler, 0xF9);
+        art_jit_byte(compiler, 0xFF);
+        art_jit_emit_jcc(compiler, CC_E, ART_JIT_PATCH_EXIT, pc);
+        art_jit_byte(compiler, 0x99);                           // cdq
+        art_jit_byte(compiler, 0xF7);                           // idiv ecx
+        art_jit_byte(compiler, 0xF9);
+        if (op == 4) {
+            art_jit_byte(compiler, 0x89);                       // mov eax, edx
+            art_jit_byte(compiler, 0xD0);
+        }
+    }
+    
+    art_jit_mem(compiler, 0, 0x89, EAX, VREGS, VREG(dest));
+    art_jit_mem(compiler, PTR_WIDE, 0xC7, 0, REFS, VREF(dest));
+    art_jit_u32(compiler, 0);
+    
+    return 0;
+}
+
+// Sabitli tam sayı işlemi (lit16, lit8). Sıfıra ya da -1'e bölme şablonsuzdur.
+static int art_jit_emit_int_literal(art_jit_compiler_t* compiler, uint8_t op, uint32_t dest, uint32_t x, int32_t literal, uint32_t pc) {
+    static const uint8_t immediates[] = { 0xC0, 0, 0, 0, 0, 0xE0, 0xC8, 0xF0, 0xE0, 0xF8, 0xE8 };
+    
+    (void)pc;
+    
+    if ((op == 3 || op == 4) && (literal == 0 || literal == -1)) {
+        return -1;
+    }
+    
+    art_jit_mem(compiler, 0, 0x8B, EAX, VREGS, VREG(x));
+    
+    switch (op) {
+        case 1:  // rsub: literal - x
+            art_jit_byte(compiler, 0xB9);                       // mov ecx, literal
+            art_jit_u32(compiler, (uint32_t)literal);
+            art_jit_byte(compiler, 0x29);                       // sub ecx, eax
+            art_jit_byte(compiler, 0xC1);
+            art_jit_byte(compiler, 0x89);                       // mov eax, ecx
+            art_jit_byte(compiler, 0xC8);
+            break;
+        case 2:  // imul eax, eax, literal
+            art_jit_byte(compiler, 0x69);
+            art_jit_byte(compiler, 0xC0);
+            art_jit_u32(compiler, (uint32_t)literal);
+            break;
+        case 3:
+        case 4:
+            art_jit_byte(compiler, 0xB9);                       // mov ecx, literal
+            art_jit_u32(compiler, (uint32_t)literal);
+            art_jit_byte(compiler, 0x99);                       // cdq
+            art_jit_byte(compiler, 0xF7);                       // idiv ecx
+            art_jit_byte(compiler, 0xF9);
+            if (op == 4) {
+                art_jit_byte(compiler, 0x89);                   // mov eax, edx
+                art_jit_byte(compiler, 0xD0);
+            }
+            break;
+        case 8:
+        case 9:
+        case 10:  // shl, shr, ushr eax, literal & 31
+            art_jit_byte(compiler, 0xC1);
+            art_jit_byte(compiler, immediates[op]);
+            art_jit_byte(compiler, (uint8_t)(literal & 31));
+            break;
+        default:  // add, and, or, xor eax, literal
+            art_jit_byte(compiler, 0x81);
+            art_jit_byte(compiler, immediates[op]);
+            art_jit_u32(compiler, (uint32_t)literal);
+            break;
+    }
+    
+    art_jit_mem(compiler, 0, 0x89, EAX, VREGS, VREG(dest));
+    art_jit_mem(compiler, PTR_WIDE, 0xC7, 0, REFS, VREF(dest));
+    art_jit_u32(compiler, 0);
+    
+    return 0;
+}
+
+// Dal: cc < 0 koşulsuz. Geri dallar güvenli nokta yoklar; durdurma istenmişse
+// yorumlayıcıya dal hedefinde çıkılır.
+static void art_jit_emit_branch(art_jit_compiler_t* compiler, int cc, uint32_t pc, uint32_t target) {
+    if (target > pc) {
+        art_jit_emit_jcc(compiler, cc, ART_JIT_PATCH_BRANCH, target);
+        return;
+    }
+    
+    uint32_t skip = cc >= 0 ? art_jit_emit_local_jcc(compiler, cc ^ 1) : 0;
+    
+    art_jit_mem(compiler, PTR_WIDE, 0x8B, EAX, FRAME, offsetof(art_jit_frame_t, suspend));
+    art_jit_mem(compiler, 0, 0x83, 7, EAX, 0);                  // cmp dword [eax], 0
+    art_jit_byte(compiler, 0x00);
+    art_jit_emit_jcc(compiler, CC_NE, ART_JIT_PATCH_EXIT, target);
+    art_jit_emit_jcc(compiler, -1, ART_JIT_PATCH_BRANCH, target);
+    
+    if (cc >= 0) {
+        art_jit_bind_local(compiler, skip);
+    }
+}
+
+// Dizi koruması: EAX dizi, EDX dizin olur. Yalnızca dizi sınıflarının eleman
+// boyutu sıfırdan farklıdır; referans dizilerinde tanımlayıcıya da bakılır.
+static void art_jit_emit_array_check(art_jit_compiler_t* compiler, uint32_t array, uint32_t index, uint8_t element_size, uint32_t pc) {
+    art_jit_mem(compiler, PTR_WIDE, 0x8B, EAX, REFS, VREF(array));
+    if (PTR_WIDE) {
+        art_jit_byte(compiler, 0x48);
+    }
+    art_jit_byte(compiler, 0x85);                               // test eax, eax
+    art_jit_byte(compiler, 0xC0);
+    art_jit_emit_jcc(compiler, CC_E, ART_JIT_PATCH_EXIT, pc);
+    
+    art_jit_mem(compiler, PTR_WIDE, 0x8B, ECX, EAX, offsetof(art_object_t, klass));
+    art_jit_mem(compiler, 0, 0x80, 7, ECX, offsetof(art_class_t, component_size));
+    art_jit_byte(compiler, element_size);
+    art_jit_emit_jcc(compiler, CC_NE, ART_JIT_PATCH_EXIT, pc);
+    
+    if (element_size == 0) {
+        art_jit_mem(compiler, PTR_WIDE, 0x8B, ECX, ECX, offsetof(art_class_t, descriptor));
+        art_jit_mem(compiler, 0, 0x80, 7, ECX, 0);              // cmp byte [ecx], '['
+        art_jit_byte(compiler, '[');
+        art_jit_emit_jcc(compiler, CC_NE, ART_JIT_PATCH_EXIT, pc);
+        art_jit_mem(compiler, 0, 0x0FB7, ECX, EAX, offsetof(art_object_t, ref_count));
+        art_jit_byte(compiler, 0x81);                           // cmp ecx, ART_OBJECT_REFS_EXTENDED
+        art_jit_byte(compiler, 0xF9);
+        art_jit_u32(compiler, ART_OBJECT_REFS_EXTENDED);
+        art_jit_emit_jcc(compiler, CC_E, ART_JIT_PATCH_EXIT, pc);
+        art_jit_mem(compiler, 0, 0x8B, EDX, VREGS, VREG(index));
+        art_jit_byte(compiler, 0x39);                           // cmp edx, ecx
+        art_jit_byte(compiler, 0xCA);
+    } else {
+        art_jit_mem(compiler, 0, 0x8B, EDX, VREGS, VREG(index));
+        art_jit_mem(compiler, 0, 0x3B, EDX, EAX, HEADER);       // cmp edx, [eax + uzunluk]
+    }
+    art_jit_emit_jcc(compiler, CC_AE, ART_JIT_PATCH_EXIT, pc);
+}
+
+// Örnek alanı koruması: alıcı boş değil ve sınıfı önbellekteki sınıf. EAX'e
+// nesne yüklenir; alanın adresi [EAX + displacement] olur. JIT sınıfı ve alan
+// ofsetini gömer; görüntü kodu ikisini de çalışırken yuvadan okur (boş yuva
+// hiçbir sınıfa eşit değildir, yorumlayıcı yuvayı doldurunca kod hızlanır).
+static int art_jit_emit_field_check(art_jit_compiler_t* compiler, uint32_t object, uint16_t slot, uint32_t pc,
+                                    int is_ref, int32_t* displacement) {
+    art_class_t* klass = NULL;
+    art_field_t* resolved = NULL;
+    
+    if (!compiler->image) {
+        art_inline_cache_t* cache = &compiler->method->caches[slot];
+        klass = __atomic_load_n(&cache->klass, __ATOMIC_ACQUIRE);
+        resolved = cache->field;
+        if (!klass || !resolved || resolved->is_static) {
+            art_jit_emit_exit(compiler, pc);
+            return -1;
+        }
+    }
+    
+    art_jit_mem(compiler, PTR_WIDE, 0x8B, EAX, REFS, VREF(object));
+    if (PTR_WIDE) {
+        art_jit_byte(compiler, 0x48);
+    }
+    art_jit_byte(compiler, 0x85);                               // test eax, eax
+    art_jit_byte(compiler, 0xC0);
+    art_jit_emit_jcc(compiler, CC_E, ART_JIT_PATCH_EXIT, pc);
+    
+    if (!compiler->image) {
+        art_jit_mov_imm_ptr(compiler, ECX, klass);
+        art_jit_mem(compiler, PTR_WIDE, 0x39, ECX, EAX, offsetof(art_object_t, klass));
+        art_jit_emit_jcc(compiler, CC_NE, ART_JIT_PATCH_EXIT, pc);
+        
+        *displacement = is_ref ? HEADER + (int32_t)resolved->offset * PTR_SIZE
+                               : HEADER + (int32_t)klass->ref_fields * PTR_SIZE + (int32_t)resolved->offset;
+        return 0;
+    }
+    
+    int32_t entry = (int32_t)(slot * sizeof(art_inline_cache_t));
+    art_jit_mem(compiler, PTR_WIDE, 0x8B, ECX, FRAME, offsetof(art_jit_frame_t, caches));
+    art_jit_mem(compiler, PTR_WIDE, 0x8B, EDX, ECX, entry + (int32_t)offsetof(art_inline_cache_t, klass));
+    art_jit_mem(compiler, PTR_WIDE, 0x39, EDX, EAX, offsetof(art_object_t, klass));
+    art_jit_emit_jcc(compiler, CC_NE, ART_JIT_PATCH_EXIT, pc);
+    art_jit_mem(compiler, PTR_WIDE, 0x8B, ECX, ECX, entry + (int32_t)offsetof(art_inline_cache_t, field));
+    art_jit_mem(compiler, 0, 0x8B, ECX, ECX, offsetof(art_field_t, offset));
+    
+    if (is_ref) {
+        art_jit_mem_index(compiler, PTR_WIDE, 0x8D, EAX, EAX, ECX, PTR_SIZE, 0);       // lea eax, [eax + ecx * P]
+    } else {
+        art_jit_mem(compiler, 0, 0x0FB7, EDX, EDX, offsetof(art_class_t, ref_fields)); // movzx edx, ref_fields
+        art_jit_mem_index(compiler, PTR_WIDE, 0x8D, EAX, EAX, EDX, PTR_SIZE, 0);       // lea eax, [eax + edx * P]
+        if (PTR_WIDE) {
+            art_jit_byte(compiler, 0x48);
+        }
+        art_jit_byte(compiler, 0x01);                           // add eax, ecx
+        art_jit_byte(compiler, 0xC8);
+    }
+    
+    *displacement = HEADER;
+    
+    return 0;
+}
+
+// Nesne yazmacının ilkel eşi: boş değilse 1
+static void art_jit_emit_set_ref_flag(art_jit_compiler_t* compiler, uint32_t dest, int reg) {
+    if (PTR_WIDE) {
+        art_jit_byte(compiler, 0x48);
+    }
+    art_jit_byte(compiler, 0x85);                               // test reg, reg
+    art_jit_byte(compiler, (uint8_t)(0xC0 | (reg << 3) | reg));
+    art_jit_byte(compiler, 0x0F);                               // setne al
+    art_jit_byte(compiler, 0x95);
+    art_jit_byte(compiler, 0xC0);
+    art_jit_byte(compiler, 0x0F);                               // movzx eax, al
+    art_jit_byte(compiler, 0xB6);
+    art_jit_byte(compiler, 0xC0);
+    art_jit_mem(compiler, 0, 0x89, EAX, VREGS, VREG(dest));
+}
+
+// Yorumlayıcıya pc'de dön
+static void art_jit_emit_exit(art_jit_compiler_t* compiler, uint32_t pc) {
+    art_jit_byte(compiler, 0xB8);                               // mov eax, pc
+    art_jit_u32(compiler, pc);
+    art_jit_emit_jcc(compiler, -1, ART_JIT_PATCH_EPILOGUE, 0);
+}
+
+// Yamalı rel32 atlama (cc < 0 koşulsuz)
+static void art_jit_emit_jcc(art_jit_compiler_t* compiler, int cc, uint8_t kind, uint32_t target) {
+    if (cc < 0) {
+        art_jit_byte(compiler, 0xE9);
+    } else {
+        art_jit_byte(compiler, 0x0F);
+        art_jit_byte(compiler, (uint8_t)(0x80 | cc));
+    }
+    art_jit_add_patch(compiler, kind, target);
+    art_jit_u32(compiler, 0);
+}
+
+// Komut içi ileri atlama; hedef art_jit_bind_local ile bağlanır
+static uint32_t art_jit_emit_local_jcc(art_jit_compiler_t* compiler, int cc) {
+    art_jit_byte(compiler, 0x0F);
+    art_jit_byte(compiler, (uint8_t)(0x80 | cc));
+    uint32_t position = compiler->size;
+    art_jit_u32(compiler, 0);
+    
+    return position;
+}
+
+static void art_jit_bind_local(art_jit_compiler_t* compiler, uint32_t position) {
+    if (compiler->failed) {
+        return;
+    }
+    
+    int32_t relative = (int32_t)(compiler->size - (position + 4));
+    memcpy(compiler->code + position, &relative, 4);
+}
+
+// Yardımcıyı sabit parametrelerle çağır; 0 değerli ilk parametre çerçevedir
+// (yorumlayıcı yardımcıları). JIT kodu adresi gömer, görüntü kodu çerçevenin
+// içe aktarma tablosundan okur. Taban yazmaçları dönüşte yeniden yüklenir:
+// x86-64'te ESI/EDI çağrıda korunmaz.
+static void art_jit_emit_call(art_jit_compiler_t* compiler, uint32_t symbol, const uintptr_t* args, uint32_t count) {
+#if defined(__x86_64__)
+    static const uint8_t registers[] = { 7, 6, 2 };            // rdi, rsi, rdx
+    
+    for (uint32_t i = 0; i < count; i++) {
+        if (i == 0 && args[0] == 0) {
+            art_jit_byte(compiler, 0x48);                       // mov rdi, rbx
+            art_jit_byte(compiler, 0x89);
+            art_jit_byte(compiler, 0xDF);
+        } else {
+            art_jit_mov_imm_ptr(compiler, registers[i], (const void*)args[i]);
+        }
+    }
+#else
+    // Giriş üç yazmaç itti: yığın 16 bayt hizalı kalsın
+    uint8_t padding = (uint8_t)(16 - (count * 4) % 16) % 16;
+    art_jit_byte(compiler, 0x83);                               // sub esp, padding
+    art_jit_byte(compiler, 0xEC);
+    art_jit_byte(compiler, padding);
+    for (uint32_t i = count; i-- > 0; ) {
+        if (i == 0 && args[0] == 0) {
+            art_jit_byte(compiler, 0x53);                       // push ebx
+        } else {
+            art_jit_byte(compiler, 0x68);                       // push imm32
+            art_jit_u32(compiler, (uint32_t)args[i]);
+        }
+    }
+#endif
+    if (compiler->image) {
+        art_jit_mem(compiler, PTR_WIDE, 0x8B, EAX, FRAME, offsetof(art_jit_frame_t, imports));
+        art_jit_mem(compiler, 0, 0xFF, 2, EAX, (int32_t)(symbol * PTR_SIZE));   // call [eax + symbol * P]
+    } else {
+        art_jit_mov_imm_ptr(compiler, EAX, art_jit_symbols[symbol]);
+        art_jit_byte(compiler, 0xFF);                           // call eax
+        art_jit_byte(compiler, 0xD0);
+    }
+#if !defined(__x86_64__)
+    art_jit_byte(compiler, 0x83);                               // add esp, padding + parametreler
+    art_jit_byte(compiler, 0xC4);
+    art_jit_byte(compiler, (uint8_t)(padding + count * 4));
+#endif
+    art_jit_mem(compiler, PTR_WIDE, 0x8B, VREGS, FRAME, offsetof(art_jit_frame_t, vregs));
+    art_jit_mem(compiler, PTR_WIDE, 0x8B, REFS, FRAME, offsetof(art_jit_frame_t, refs));
+}
+
+// Korumaların çıkış taslakları: pc başına bir tane, gövdenin sonunda
+static void art_jit_emit_stubs(art_jit_compiler_t* compiler) {
+    uint32_t count = compiler->patch_count;
+    
+    for (uint32_t i = 0; i < count && !compiler->failed; i++) {
+        art_jit_patch_t patch = compiler->patches[i];
+        if (patch.kind == ART_JIT_PATCH_EXIT && !compiler->stubs[patch.target]) {
+            compiler->stubs[patch.target] = compiler->size + 1;
+            art_jit_emit_exit(compiler, patch.target);
+        }
+    }
+}
+
+// Giriş: çerçeve ve hedef adresi alır, taban yazmaçlarını yükleyip hedefe atlar.
+// Dönüş: EAX yorumlayıcının devam edeceği pc ya da hata kodudur.
+static void art_jit_emit_entry(art_jit_compiler_t* stub, uint32_t* epilogue) {
+    art_jit_byte(stub, 0x53);                                   // push ebx
+    art_jit_byte(stub, 0x56);                                   // push esi
+    art_jit_byte(stub, 0x57);                                   // push edi
+#if defined(__x86_64__)
+    art_jit_byte(stub, 0x48);                                   // mov rbx, rdi
+    art_jit_byte(stub, 0x89);
+    art_jit_byte(stub, 0xFB);
+    art_jit_byte(stub, 0x48);                                   // mov rax, rsi
+    art_jit_byte(stub, 0x89);
+    art_jit_byte(stub, 0xF0);
+#else
+    art_jit_byte(stub, 0x8B);                                   // mov ebx, [esp + 16]
+    art_jit_byte(stub, 0x5C);
+    art_jit_byte(stub, 0x24);
+    art_jit_byte(stub, 0x10);
+    art_jit_byte(stub, 0x8B);                                   // mov eax, [esp + 20]
+    art_jit_byte(stub, 0x44);
+    art_jit_byte(stub, 0x24);
+    art_jit_byte(stub, 0x14);
+#endif
+    art_jit_mem(stub, PTR_WIDE, 0x8B, VREGS, FRAME, offsetof(art_jit_frame_t, vregs));
+    art_jit_mem(stub, PTR_WIDE, 0x8B, REFS, FRAME, offsetof(art_jit_frame_t, refs));
+    art_jit_byte(stub, 0xFF);                                   // jmp eax
+    art_jit_byte(stub, 0xE0);
+    
+    *epilogue = stub->size;
+    art_jit_byte(stub, 0x5F);                                   // pop edi
+    art_jit_byte(stub, 0x5E);                                   // pop esi
+    art_jit_byte(stub, 0x5B);                                   // pop ebx
+    art_jit_byte(stub, 0xC3);                                   // ret
+}
+
+// Ortak dönüşe atlamaları kodun yerleşeceği ofsete göre bağla. Önbellek ve
+// görüntü kod bölümü aynı düzendedir: dönüş kodu bölümün başındadır.
+static void art_jit_link(art_jit_compiler_t* compiler, uint32_t code_offset, uint32_t epilogue) {
+    for (uint32_t i = 0; i < compiler->patch_count; i++) {
+        art_jit_patch_t* patch = &compiler->patches[i];
+        if (patch->kind == ART_JIT_PATCH_EPILOGUE) {
+            int32_t relative = (int32_t)(epilogue - (code_offset + patch->position + 4));
+            memcpy(compiler->code + patch->position, &relative, 4);
+        }
+    }
+}
+
+static void art_jit_free_compiler(art_jit_compiler_t* compiler) {
+    free(compiler->code);
+    free(compiler->entries);
+    free(compiler->stubs);
+    free(compiler->patches);
+}
+
+static void art_jit_byte(art_jit_compiler_t* compiler, uint8_t value) {
+    if (compiler->size == compiler->capacity) {
+        // Giriş kodu önbelleğe doğrudan yazılır, büyütülmez
+        uint8_t* code = compiler->method ? (uint8_t*)realloc(compiler->code, compiler->capacity * 2) : NULL;
+        if (!code) {
+            compiler->failed = 1;
+            return;
+        }
+        compiler->code = code;
+        compiler->capacity *= 2;
+    }
+    
+    compiler->code[compiler->size++] = value;
+}
+
+static void art_jit_u32(art_jit_compiler_t* compiler, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        art_jit_byte(compiler, (uint8_t)(value >> (i * 8)));
+    }
+}
+
+// [base + disp] işlenenli komut. opcode 0x0F ya da 0x66 önekli iki bayt olabilir;
+// wide x86-64'te REX.W ekler.
+static void art_jit_mem(art_jit_compiler_t* compiler, int wide, uint32_t opcode, int reg, int base, int32_t disp) {
+    if (wide) {
+        art_jit_byte(compiler, 0x48);
+    }
+    if (opcode > 0xFF) {
+        art_jit_byte(compiler, (uint8_t)(opcode >> 8));
+    }
+    art_jit_byte(compiler, (uint8_t)opcode);
+    
+    if (disp >= -128 && disp <= 127) {
+        art_jit_byte(compiler, (uint8_t)(0x40 | (reg << 3) | base));
+        art_jit_byte(compiler, (uint8_t)disp);
+    } else {
+        art_jit_byte(compiler, (uint8_t)(0x80 | (reg << 3) | base));
+        art_jit_u32(compiler, (uint32_t)disp);
+    }
+}
+
+// [base + index * scale + disp] işlenenli komut
+static void art_jit_mem_index(art_jit_compiler_t* compiler, int wide, uint32_t opcode, int reg, int base, int index,
+                              int scale, int32_t disp) {
+    uint8_t shift = scale == 8 ? 3 : (scale == 4 ? 2 : (scale == 2 ? 1 : 0));
+    
+    if (wide) {
+        art_jit_byte(compiler, 0x48);
+    }
+    if (opcode > 0xFF) {
+        art_jit_byte(compiler, (uint8_t)(opcode >> 8));
+    }
+    art_jit_byte(compiler, (uint8_t)opcode);
+    art_jit_byte(compiler, (uint8_t)(0x80 | (reg << 3) | 4));
+    art_jit_byte(compiler, (uint8_t)((shift << 6) | (index << 3) | base));
+    art_jit_u32(compiler, (uint32_t)disp);
+}
+
+// İşaretçi sabitini yazmaca yükle
+static void art_jit_mov_imm_ptr(art_jit_compiler_t* compiler, int reg, const void* value) {
+    uintptr_t bits = (uintptr_t)value;
+    
+    if (PTR_WIDE) {
+        art_jit_byte(compiler, 0x48);
+    }
+    art_jit_byte(compiler, (uint8_t)(0xB8 | reg));
+    for (size_t i = 0; i < sizeof(void*); i++) {
+        art_jit_byte(compiler, (uint8_t)(bits >> (i * 8)));
+    }
+}
+
+static void art_jit_add_patch(art_jit_compiler_t* compiler, uint8_t kind, uint32_t target) {
+    if (compiler->patch_count == compiler->patch_capacity) {
+        uint32_t capacity = compiler->patch_capacity ? compiler->patch_capacity * 2 : 32;
+        art_jit_patch_t* patches = (art_jit_patch_t*)realloc(compiler->patches, capacity * sizeof(art_jit_patch_t));
+        if (!patches) {
+            compiler->failed = 1;
+            return;
+        }
+        compiler->patches = patches;
+        compiler->patch_capacity = capacity;
+    }
+    
+    art_jit_patch_t* patch = &compiler->patches[compiler->patch_count++];
+    patch->position = compiler->size;
+    patch->target = target;
+    patch->kind = kind;
+}
+
+// Önbellekte blok ayır (ilk uyan); yer yoksa LRU metotları çıkar
+static int art_jit_allocate(uint32_t size, uint32_t* offset) {
+    int status = ART_JIT_ERROR_NO_MEMORY;
+    
+    for (;;) {
+        art_jit_block_t** link = &art_jit_free_blocks;
+        while (*link && (*link)->size < size) {
+            link = &(*link)->next;
+        }
+    
+        if (*link) {
+            art_jit_block_t* block = *link;
+            *offset = block->offset;
+            block->offset += size;
+            block->size -= size;
+            if (block->size == 0) {
+                *link = block->next;
+                free(block);
+            }
+            status = 0;
+            break;
+        }
+    
+        // Bekleyen kod yeterliyse daha fazlası çıkarılmaz; çağıran derleme
+        // metot yeniden ısınınca tekrarlanır
+        if (art_jit_reclaim() > 0) {
+            continue;
+        }
+        if (art_jit_retired_bytes >= size || art_jit_evict_one() != 0) {
+            break;
+        }
+    }
+    
+    return status;
+}
+
+// Bloğu boş listeye geri koy, komşularıyla birleştir
+static void art_jit_release(uint32_t offset, uint32_t size) {
+    art_jit_block_t* previous = NULL;
+    art_jit_block_t* next = art_jit_free_blocks;
+    while (next && next->offset < offset) {
+        previous = next;
+        next = next->next;
+    }
+    
+    if (previous && previous->offset + previous->size == offset) {
+        previous->size += size;
+        if (next && previous->offset + previous->size == next->offset) {
+            previous->size += next->size;
+            previous->next = next->next;
+            free(next);
+        }
+        return;
+    }
+    
+    if (next && offset + size == next->offset) {
+        next->offset = offset;
+        next->size += size;
+        return;
+    }
+    
+    art_jit_block_t* block = (art_jit_block_t*)malloc(sizeof(art_jit_block_t));
+    if (!block) {
+        return;  // Alan kaybolur; önbellek yine tutarlıdır
+    }
+    
+    block->offset = offset;
+    block->size = size;
+    block->next = next;
+    if (previous) {
+        previous->next = block;
+    } else {
+        art_jit_free_blocks = block;
+    }
+}
+
+// En uzun süre kullanılmamış metodu yayından kaldır ve bekletmeye al. O anda
+// derlenmiş kodda olan iş parçacıklarının çıkış sayıları kaydedilir. Çıkarılacak
+// metot yoksa -1 döner.
+static int art_jit_evict_one(void) {
+    art_jit_code_t* victim = NULL;
+    for (art_jit_code_t* code = art_jit_codes; code; code = code->next) {
+        if (!victim || code->last_use < victim->last_use) {
+            victim = code;
+        }
+    }
+    
+    if (!victim) {
+        return -1;
+    }
+    
+    __atomic_store_n(&victim->method->jit_code, NULL, __ATOMIC_SEQ_CST);
+    
+    // Kayıt listesi yalnızca kilit altında büyür; yeni iş parçacıkları yayını boş görür
+    uint32_t* waits = (uint32_t*)calloc(art_jit_thread_count ? art_jit_thread_count : 1, sizeof(uint32_t));
+    if (!waits) {
+        __atomic_store_n(&victim->method->jit_code, victim, __ATOMIC_RELEASE);
+        return -1;
+    }
+    for (art_jit_thread_t* slot = art_jit_threads; slot; slot = slot->next) {
+        if (__atomic_load_n(&slot->depth, __ATOMIC_SEQ_CST) != 0) {
+            waits[slot->index] = __atomic_load_n(&slot->exits, __ATOMIC_ACQUIRE) + 1;
+        }
+    }
+    
+    art_jit_unlink(victim);
+    victim->waits = waits;
+    victim->wait_count = art_jit_thread_count;
+    victim->next = art_jit_retired;
+    art_jit_retired = victim;
+    art_jit_retired_bytes += victim->size;
+    art_jit_stats.compiled_methods--;
+    art_jit_stats.evictions++;
+    
+    return 0;
+}
+
+// Beklettiği iş parçacıklarının hepsi derlenmiş koddan çıkmış kodları boşalt.
+// Boşaltılan kod sayısını döner.
+static int art_jit_reclaim(void) {
+    int reclaimed = 0;
+    art_jit_code_t** link = &art_jit_retired;
+    while (*link) {
+        art_jit_code_t* code = *link;
+    
+        int quiet = 1;
+        for (art_jit_thread_t* slot = art_jit_threads; slot && quiet; slot = slot->next) {
+            if (slot->index < code->wait_count && code->waits[slot->index] != 0 &&
+                __atomic_load_n(&slot->exits, __ATOMIC_ACQUIRE) + 1 == code->waits[slot->index]) {
+                quiet = 0;
+            }
+        }
+    
+        if (!quiet) {
+            link = &code->next;
+            continue;
+        }
+    
+        *link = code->next;
+        art_jit_release(code->offset, code->size);
+        art_jit_retired_bytes -= code->size;
+        art_jit_stats.cache_used -= code->size;
+        free(code->entries);
+        free(code->waits);
+        free(code);
+        reclaimed++;
+    }
+    
+    return reclaimed;
+}
+
+static void art_jit_unlink(art_jit_code_t* code) {
+    art_jit_code_t** link = &art_jit_codes;
+    while (*link && *link != code) {
+        link = &(*link)->next;
+    }
+    if (*link) {
+        *link = code->next;
+    }
+}
+
+// Çağıran iş parçacığını kaydet; ölmüş iş parçacıklarının kayıtları yeniden
+// kullanılır. Görüntü kodu JIT başlatılmadan da çalıştığı için kayıt süreç
+// boyunca yaşar.
+static art_jit_thread_t* art_jit_register(void) {
+    pthread_once(&art_jit_thread_once, art_jit_create_key);
+    pthread_mutex_lock(&art_jit_lock);
+    
+    art_jit_thread_t* slot = art_jit_threads;
+    while (slot && slot->used) {
+        slot = slot->next;
+    }
+    if (!slot) {
+        slot = (art_jit_thread_t*)calloc(1, sizeof(art_jit_thread_t));
+        if (slot) {
+            slot->index = art_jit_thread_count++;
+            slot->next = art_jit_threads;
+            art_jit_threads = slot;
+        }
+    }
+    if (slot) {
+        slot->used = 1;
+        pthread_setspecific(art_jit_thread_key, slot);
+        art_jit_self = slot;
+    }
+    
+    pthread_mutex_unlock(&art_jit_lock);
+    
+    return slot;
+}
+
+// İş parçacığı sonlandı: derinliği sıfırdır, kayıt yeniden kullanılabilir
+static void art_jit_thread_exit(void* slot) {
+    pthread_mutex_lock(&art_jit_lock);
+    ((art_jit_thread_t*)slot)->used = 0;
+    pthread_mutex_unlock(&art_jit_lock);
+}
+
+static void art_jit_create_key(void) {
+    pthread_key_create(&art_jit_thread_key, art_jit_thread_exit);
+}
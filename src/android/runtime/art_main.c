@@ -1,9 +1,18 @@
 #include "../../include/android/android.h"
 #include "../../include/android/android_runtime.h"
+#include "../../include/android/zygote.h"
+#include "../../include/android/dex_file.h"
+#include "../../include/android/art_heap.h"
+#include "../../include/android/art_interp.h"
+#include "../../include/android/art_jit.h"
+#include "../../include/android/art_aot.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 #include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
 
 // Runtime yapılandırması
 static art_config_t art_config;
@@ -20,6 +29,47 @@ static art_stats_t art_stats = {0};
 // Global ART durumu
 static art_runtime_t art_runtime;
 
+// Zygote'ta önceden yüklenen çekirdek sınıf yolu ve sınıflar
+#define ART_BOOT_CLASSPATH "/system/framework/framework.dex"
+
+static const char* art_preload_classes[] = {
+    "java.lang.Object", "java.lang.String", "java.lang.Class", "java.lang.Thread",
+    "java.lang.StringBuilder", "java.util.ArrayList", "java.util.HashMap",
+    "android.content.Context", "android.app.Application", "android.app.Activity",
+    "android.os.Bundle", "android.os.Handler", "android.os.Looper",
+    "android.view.View", "android.view.ViewGroup", "android.widget.TextView",
+    "android.widget.Button", "android.widget.ImageView", "android.graphics.Bitmap"
+};
+
+static void* art_boot_class_loader = NULL;
+static void* art_preloaded[sizeof(art_preload_classes) / sizeof(art_preload_classes[0])];
+
+// Sınıf yükleyici: eşlenmiş DEX dosyaları ve üst yükleyici (önce üst aranır)
+typedef struct art_class_loader {
+    struct art_class_loader* parent;
+    dex_file_t* dex_files[DEX_MAX_APK_FILES];
+    uint32_t dex_count;
+    art_aot_image_t* image;         // Eşlenmiş AOT görüntüsü (yoksa NULL)
+} art_class_loader_t;
+
+// Uygulamanın kendi sınıf yükleyicisi (üst yükleyici: çekirdek sınıf yolu)
+static art_class_loader_t* art_app_class_loader = NULL;
+
+// Sınıf bağlama kilidi (üst sınıf zinciri)
+static pthread_mutex_t art_class_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Yardımcı fonksiyonlar
+static int art_find_class(art_class_loader_t* loader, const char* descriptor, dex_class_t** klass);
+static int art_link_class(art_class_loader_t* loader, dex_class_t* klass, uint32_t depth);
+static void art_open_image(art_class_loader_t* loader, const char* path);
+static int art_resolve_class(const char* descriptor, dex_class_t** klass);
+static void* art_new_handle(art_object_t* object);
+static int art_build_args(art_method_t* method, void* receiver, void** args, int arg_count, art_value_t* values);
+
+// Dosyanın ilerisinde tanımlı sınıf yükleme fonksiyonları
+int art_unload_dex(void* class_loader);
+int art_load_class(void* class_loader, const char* class_name, void** class_handle);
+
 // JNI fonksiyon tablosu
 static struct {
     // String işlemleri
@@ -155,7 +205,18 @@ int art_initialize(const android_config_t* android_config) {
         return -3;
     }
     
-    // 5. Dalvik köprüsünü başlat (eski uygulamalar için)
+    // 5. Yorumlayıcıyı başlat (sınıflar uygulama ve önyükleme yükleyicilerinden çözülür)
+    if (art_interp_init(art_resolve_class) != 0) {
+        art_cleanup_garbage_collector();
+        art_cleanup_jit_compiler();
+        art_cleanup_memory_manager();
+        if (aot_enabled) {
+            art_cleanup_aot_compiler();
+        }
+        return -3;
+    }
+    
+    // 6. Dalvik köprüsünü başlat (eski uygulamalar için)
     if (art_init_dalvik_bridge() != 0) {
         // Dalvik köprüsü başlatılamazsa uyarı ver ama devam et
         printf("Uyarı: Dalvik köprüsü başlatılamadı, eski uygulamalar çalışmayabilir\n");
@@ -174,7 +235,61 @@ int art_initialize(const android_config_t* android_config) {
 }
 
 /**
- * DEX dosyası yükle
+ * Zygote önyüklemesi: ART'ı başlat ve ortak sınıfları yükle. Burada ayrılan
+ * her şey fork edilen uygulamalarla yazılana kadar paylaşılır.
+ */
+int art_zygote_preload(void* user_data) {
+    if (art_initialize((const android_config_t*)user_data) != 0) {
+        return -1;
+    }
+    
+    if (!art_boot_class_loader && art_load_dex(ART_BOOT_CLASSPATH, &art_boot_class_loader) != 0) {
+        return -2;
+    }
+    
+    // Yüklenemeyen sınıflar uygulama tarafından ilk kullanımda yüklenir
+    for (uint32_t i = 0; i < sizeof(art_preload_classes) / sizeof(art_preload_classes[0]); i++) {
+        if (!art_preloaded[i]) {
+            art_load_class(art_boot_class_loader, art_preload_classes[i], &art_preloaded[i]);
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * Zygote'tan fork edilen uygulama sürecinin ana fonksiyonu
+ */
+int art_zygote_app_main(const zygote_request_t* request, void* user_data) {
+    if (!request) {
+        return 1;
+    }
+    
+    // Uygulamanın kendi kodunu yükle; çekirdek sınıflar zaten hazır
+    if (request->apk_path[0] && art_load_apk(request->apk_path) != 0) {
+        return 2;
+    }
+    
+    jni_attach_thread();
+    
+    // Başlatma isteğinden kodun (ve görüntünün) yüklenmesine kadar geçen süre;
+    // ilk kare buradan sonra ActivityThread'in çizimiyle gelir
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    uint64_t now_us = (uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_nsec / 1000;
+    printf("%s hazır: %.1f ms\n", request->package_name, (double)(now_us - request->request_us) / 1000.0);
+    
+    // Gerçek bir uygulamada, burada ActivityThread ana döngüsü çalışır
+    for (;;) {
+        pause();
+    }
+    
+    return 0;
+}
+
+/**
+ * DEX dosyası yükle. Dosya yalnızca eşlenir ve başlığı doğrulanır; sınıflar
+ * art_load_class ile istendikçe çözülür.
  */
 int art_load_dex(const char* dex_path, void** class_loader) {
     if (!art_initialized) {
@@ -185,18 +300,27 @@ int art_load_dex(const char* dex_path, void** class_loader) {
         return -2;
     }
     
-    // DEX dosyasını yükle
-    // Gerçek bir uygulamada, burada DEX dosyası yüklenir
-    // ...
+    art_class_loader_t* loader = (art_class_loader_t*)calloc(1, sizeof(art_class_loader_t));
+    if (!loader) {
+        return -3;
+    }
+    
+    if (dex_open(dex_path, &loader->dex_files[0]) != 0) {
+        free(loader);
+        return -3;
+    }
     
-    // Örnek olarak, sahte bir class loader döndür
-    *class_loader = malloc(100);
+    loader->dex_count = 1;
+    loader->parent = (art_class_loader_t*)art_boot_class_loader;
+    art_open_image(loader, dex_path);
+    *class_loader = loader;
     
     return 0;
 }
 
 /**
- * APK dosyası yükle
+ * APK dosyası ya da kurulum dizini yükle. Kurulu uygulamalar için yol,
+ * classes*.dex dosyalarının ayıklandığı kurulum dizinidir.
  */
 int art_load_apk(const char* apk_path) {
     if (!art_initialized) {
@@ -207,15 +331,42 @@ int art_load_apk(const char* apk_path) {
         return -2;  // Geçersiz yol
     }
     
-    // APK dosyasını aç ve içindeki DEX'i çıkar
-    // Gerçek bir uygulamada, burada APK'dan DEX dosyası çıkarılır
-    // ...
+    if (art_app_class_loader) {
+        return 0;  // Süreç başına tek uygulama
+    }
+    
+    art_class_loader_t* loader = (art_class_loader_t*)calloc(1, sizeof(art_class_loader_t));
+    if (!loader) {
+        return -3;
+    }
     
-    // Varsayılan olarak, çıkarılan DEX'i yükle
+    // classes.dex, classes2.dex, ... kurulum dizininden ya da APK içinden
+    // yerinde eşlenir
     char dex_path[256];
-    snprintf(dex_path, sizeof(dex_path), "%s.dex", apk_path);
+    struct stat st;
+    snprintf(dex_path, sizeof(dex_path), "%s", apk_path);
+    if (stat(apk_path, &st) == 0 && S_ISDIR(st.st_mode)) {
+        if (dex_open_dir(apk_path, loader->dex_files, DEX_MAX_APK_FILES, &loader->dex_count) != 0) {
+            free(loader);
+            return -3;
+        }
+    } else if (dex_open_apk(apk_path, loader->dex_files, DEX_MAX_APK_FILES, &loader->dex_count) != 0) {
+        // Kurulumda ayıklanmış DEX'e geri dön
+        snprintf(dex_path, sizeof(dex_path), "%s.dex", apk_path);
+        
+        if (dex_open(dex_path, &loader->dex_files[0]) != 0) {
+            free(loader);
+            return -3;
+        }
+        loader->dex_count = 1;
+    }
+    
+    // Kurulumda derlenmiş görüntü varsa metotlar ısınmadan derlenmiş koda geçer
+    loader->parent = (art_class_loader_t*)art_boot_class_loader;
+    art_open_image(loader, dex_path);
+    art_app_class_loader = loader;
     
-    return art_load_dex(dex_path, NULL);
+    return 0;
 }
 
 /**
@@ -231,16 +382,122 @@ int art_invoke_method(void* class_handle, const char* method_name, const char* s
         return -2;
     }
     
+    art_class_t* klass = NULL;
+    art_method_t* method = NULL;
+    if (art_interp_get_class((dex_class_t*)class_handle, &klass) != 0 ||
+        art_interp_find_method(klass, method_name, signature, &method) != 0) {
+        return -3;
+    }
+    
+    art_value_t values[ART_INTERP_MAX_ARGS];
+    int count = art_build_args(method, receiver, args, arg_count, values);
+    if (count < 0) {
+        return -2;
+    }
+    
     // İstatistik güncelle
     art_stats.method_calls++;
     
-    // Metodu çağır
-    // Gerçek bir uygulamada, burada metot çağrısı yapılır
-    // ...
+    art_value_t value = {0};
+    int status = art_interp_invoke(method, values, (uint32_t)count, &value);
+    if (status != 0) {
+        if (status == ART_INTERP_ERROR_EXCEPTION) {
+            art_stats.exceptions_thrown++;
+        }
+        return -4;
+    }
+    
+    // Nesne sonucu yeni tutamaçla, ilkel sonuç art_value_t boyutunda alana yazılır
+    if (result) {
+        if (method->shorty[0] == 'L') {
+            *result = value.l ? art_new_handle(value.l) : NULL;
+            if (value.l && !*result) {
+                return -5;
+            }
+        } else if (method->shorty[0] != 'V') {
+            memcpy(result, &value, sizeof(value));
+        }
+    }
     
     return 0;
 }
 
+// Sınıf tanımlayıcısını uygulama, yoksa önyükleme yükleyicisinde çöz.
+// Yorumlayıcı kilidi tutulurken çağrılır; kilit sırası yorumlayıcı -> sınıf.
+static int art_resolve_class(const char* descriptor, dex_class_t** klass) {
+    pthread_mutex_lock(&art_class_lock);
+    
+    art_class_loader_t* loader = art_app_class_loader;
+    int result = art_find_class(loader, descriptor, klass);
+    if (result != 0) {
+        loader = (art_class_loader_t*)art_boot_class_loader;
+        result = art_find_class(loader, descriptor, klass);
+    }
+    if (result == 0) {
+        result = art_link_class(loader, *klass, 0);
+    }
+    
+    pthread_mutex_unlock(&art_class_lock);
+    
+    return result;
+}
+
+// Dış tutamaç: köke kaydedilmiş bir yuva, nesne taşınınca güncellenir
+static void* art_new_handle(art_object_t* object) {
+    art_object_t** handle = malloc(sizeof(*handle));
+    if (!handle) {
+        return NULL;
+    }
+    
+    *handle = object;
+    if (art_heap_add_root(handle) != 0) {
+        free(handle);
+        return NULL;
+    }
+    
+    return handle;
+}
+
+// Parametreleri shorty'ye göre oku: nesneler tutamaç, ilkeller değere işaretçidir
+static int art_build_args(art_method_t* method, void* receiver, void** args, int arg_count, art_value_t* values) {
+    const char* shorty = method->shorty + 1;
+    if (arg_count < 0 || (size_t)arg_count != strlen(shorty) || (arg_count > 0 && !args)) {
+        return -1;
+    }
+    
+    int count = 0;
+    if (!(method->access_flags & DEX_ACC_STATIC)) {
+        if (!receiver) {
+            return -1;
+        }
+        values[count++].l = *(art_object_t**)receiver;
+    }
+    
+    for (int i = 0; i < arg_count; i++) {
+        art_value_t* value = &values[count++];
+        if (shorty[i] == 'L') {
+            value->l = args[i] ? *(art_object_t**)args[i] : NULL;
+            continue;
+        }
+        if (!args[i]) {
+            return -1;
+        }
+        switch (shorty[i]) {
+            case 'Z': value->i = *(uint8_t*)args[i]; break;
+            case 'B': value->i = *(int8_t*)args[i]; break;
+            case 'C': value->i = *(uint16_t*)args[i]; break;
+            case 'S': value->i = *(int16_t*)args[i]; break;
+            case 'I': value->i = *(int32_t*)args[i]; break;
+            case 'J': value->j = *(int64_t*)args[i]; break;
+            case 'F': value->f = *(float*)args[i]; break;
+            case 'D': value->d = *(double*)args[i]; break;
+            default: return -1;
+        }
+    }
+    
+    return count;
+}
+
 /**
  * ART temizleme
  */
@@ -252,28 +509,42 @@ int art_cleanup() {
     
     // Alt sistemleri ters sırada temizle
     
-    // 1. Dalvik köprüsünü temizle
+    // 0. Yorumlayıcı sınıflarını bırak (DEX dosyaları kapanmadan önce)
+    art_interp_cleanup();
+    
+    // 1. Sınıf yükleyicileri kapat
+    if (art_app_class_loader) {
+        art_unload_dex(art_app_class_loader);
+        art_app_class_loader = NULL;
+    }
+    if (art_boot_class_loader) {
+        art_unload_dex(art_boot_class_loader);
+        art_boot_class_loader = NULL;
+        memset(art_preloaded, 0, sizeof(art_preloaded));
+    }
+    
+    // 2. Dalvik köprüsünü temizle
     if (dalvik_bridge_enabled) {
         art_cleanup_dalvik_bridge();
         dalvik_bridge_enabled = 0;
     }
     
-    // 2. Çöp toplayıcıyı temizle
+    // 3. Çöp toplayıcıyı temizle
     art_cleanup_garbage_collector();
     
-    // 3. AOT derleyiciyi temizle
+    // 4. AOT derleyiciyi temizle
     if (aot_enabled) {
         art_cleanup_aot_compiler();
         aot_enabled = 0;
     }
     
-    // 4. JIT derleyiciyi temizle
+    // 5. JIT derleyiciyi temizle
     if (jit_enabled) {
         art_cleanup_jit_compiler();
         jit_enabled = 0;
     }
     
-    // 5. Bellek yöneticisini temizle
+    // 6. Bellek yöneticisini temizle
     art_cleanup_memory_manager();
     
     // Başlatılmadı olarak işaretle
@@ -301,6 +572,17 @@ int jni_attach_thread() {
         return -1;
     }
     
+    // Nesne ayıracak thread'i yığına kaydet
+    if (art_heap_attach_thread() != 0) {
+        return -2;
+    }
+    
+    // Yorumlayıcı yazmaç yığını
+    if (art_interp_attach_thread() != 0) {
+        art_heap_detach_thread();
+        return -2;
+    }
+    
     // Aktif thread sayısını artır
     art_runtime.active_threads++;
     
@@ -315,6 +597,9 @@ int jni_detach_thread() {
         return -1;
     }
     
+    art_interp_detach_thread();
+    art_heap_detach_thread();
+    
     // Aktif thread sayısını azalt
     if (art_runtime.active_threads > 0) {
         art_runtime.active_threads--;
@@ -324,17 +609,19 @@ int jni_detach_thread() {
 }
 
 /**
- * DEX dosyasını optimize et
+ * DEX (ya da APK) dosyasını önceden derle: output_dex AOT görüntüsüdür
  */
 int dex_optimize(const char* input_dex, const char* output_dex) {
     if (!input_dex || !output_dex) {
         return -1;
     }
     
-    // Gerçek bir uygulamada, burada DEX optimizasyonu yapılır
-    // ...
+    int status = art_aot_compile(input_dex, output_dex, NULL);
+    if (status == ART_AOT_ERROR_IO) {
+        return -2;
+    }
     
-    return 0;
+    return status == 0 ? 0 : -3;
 }
 
 /**
@@ -345,11 +632,16 @@ int dex_verify(const char* dex_path) {
         return -1;
     }
     
-    // Gerçek bir uygulamada, burada DEX doğrulaması yapılır
-    // DEX başlığı kontrolü, sınıf doğrulaması, vb.
-    // ...
+    // Başlık ve bölüm sınırları açılışta, sağlama burada doğrulanır
+    dex_file_t* dex = NULL;
+    if (dex_open(dex_path, &dex) != 0) {
+        return -2;
+    }
     
-    return 0;
+    int result = dex_verify_checksum(dex) == 0 ? 0 : -3;
+    dex_close(dex);
+    
+    return result;
 }
 
 /**
@@ -371,10 +663,63 @@ int convert_dalvik_to_art(const char* odex_path, const char* dex_path) {
         return -1;
     }
     
-    // Gerçek bir uygulamada, burada ODEX -> DEX dönüşümü yapılır
-    // ...
+    // ODEX başlığı: "dey\n036\0", gömülü DEX'in ofseti ve uzunluğu; Dalvik'in
+    // eklediği bağımlılık ve optimizasyon tabloları DEX'ten sonradır
+    FILE* input = fopen(odex_path, "rb");
+    if (!input) {
+        return -2;
+    }
     
-    return 0;
+    uint8_t header[16];
+    uint8_t* data = NULL;
+    uint32_t dex_offset = 0;
+    uint32_t dex_length = 0;
+    int result = 0;
+    
+    if (fread(header, 1, sizeof(header), input) != sizeof(header) || memcmp(header, "dey\n", 4) != 0) {
+        result = -3;
+    } else {
+        memcpy(&dex_offset, header + 8, 4);
+        memcpy(&dex_length, header + 12, 4);
+        data = dex_length >= DEX_HEADER_SIZE ? (uint8_t*)malloc(dex_length) : NULL;
+        if (!data) {
+            result = -3;
+        } else if (fseek(input, (long)dex_offset, SEEK_SET) != 0 || fread(data, 1, dex_length, input) != dex_length) {
+            result = -3;
+        }
+    }
+    fclose(input);
+    
+    // Gömülü DEX doğrulanır, yazılır ve doğrudan ART görüntüsüne derlenir
+    dex_file_t* dex = NULL;
+    if (result == 0 && dex_open_memory(data, dex_length, &dex) != 0) {
+        result = -3;
+    }
+    if (result == 0) {
+        FILE* output = fopen(dex_path, "wb");
+        if (!output) {
+            result = -2;
+        } else {
+            int written = fwrite(data, 1, dex_length, output) == dex_length;
+            if (fclose(output) != 0 || !written) {
+                remove(dex_path);
+                result = -2;
+            }
+        }
+    }
+    
+    char image_path[272];
+    if (result == 0 && art_aot_image_path(dex_path, image_path, sizeof(image_path)) == 0 &&
+        art_aot_compile_dex(&dex, 1, image_path, NULL) != 0) {
+        printf("Uyarı: %s önceden derlenemedi, yorumlayıcıda çalışacak\n", dex_path);
+    }
+    
+    if (dex) {
+        dex_close(dex);
+    }
+    free(data);
+    
+    return result;
 }
 
 // Bellek yöneticisini başlat
@@ -397,54 +742,50 @@ int art_cleanup_memory_manager() {
 
 // JIT derleyiciyi başlat
 int art_init_jit_compiler(size_t code_cache_size, uint32_t threshold) {
-    // JIT derleyiciyi başlat
-    // Gerçek bir uygulamada, burada JIT derleyici başlatılır
-    // ...
+    // Kod önbelleği ayrılır; metotlar eşiği aşınca yorumlayıcıdan derlenir
+    if (art_jit_init(code_cache_size, threshold) != 0) {
+        return -1;
+    }
     
     return 0;
 }
 
 // JIT derleyiciyi temizle
 int art_cleanup_jit_compiler() {
-    // JIT derleyiciyi temizle
-    // Gerçek bir uygulamada, burada JIT derleyici temizlenir
-    // ...
+    art_jit_cleanup();
     
     return 0;
 }
 
-// AOT derleyiciyi başlat
+// AOT derleyiciyi başlat: kurulum derlemeleri arka plan havuzunda çalışır
 int art_init_aot_compiler() {
-    // AOT derleyiciyi başlat
-    // Gerçek bir uygulamada, burada AOT derleyici başlatılır
-    // ...
+    if (art_aot_init(0) != 0) {
+        return -1;
+    }
     
     return 0;
 }
 
 // AOT derleyiciyi temizle
 int art_cleanup_aot_compiler() {
-    // AOT derleyiciyi temizle
-    // Gerçek bir uygulamada, burada AOT derleyici temizlenir
-    // ...
+    art_aot_cleanup();
     
     return 0;
 }
 
 // Çöp toplayıcıyı başlat
 int art_init_garbage_collector(art_gc_mode_t mode) {
-    // Çöp toplayıcıyı başlat
-    // Gerçek bir uygulamada, burada çöp toplayıcı başlatılır
-    // ...
+    // Genç nesil TLAB'larla, eski nesil eşzamanlı işaretleme ile toplanır
+    if (art_heap_create(art_config.heap_size, mode) != 0) {
+        return -1;
+    }
     
     return 0;
 }
 
 // Çöp toplayıcıyı temizle
 int art_cleanup_garbage_collector() {
-    // Çöp toplayıcıyı temizle
-    // Gerçek bir uygulamada, burada çöp toplayıcı temizlenir
-    // ...
+    art_heap_destroy();
     
     return 0;
 }
@@ -477,12 +818,13 @@ int art_unload_dex(void* class_loader) {
         return -2;
     }
     
-    // Class loader'ı temizle
-    // Gerçek bir uygulamada, burada class loader temizlenir
-    // ...
-    
-    // Örnek olarak, bellekten serbest bırak
-    free(class_loader);
+    // Eşlemeler ve çözülmüş sınıflar DEX ile birlikte serbest bırakılır
+    art_class_loader_t* loader = (art_class_loader_t*)class_loader;
+    for (uint32_t i = 0; i < loader->dex_count; i++) {
+        dex_close(loader->dex_files[i]);
+    }
+    art_aot_close(loader->image);
+    free(loader);
     
     return 0;
 }
@@ -497,16 +839,104 @@ int art_load_class(void* class_loader, const char* class_name, void** class_hand
         return -2;
     }
     
-    // Sınıfı yükle
-    // Gerçek bir uygulamada, burada sınıf yüklenir
-    // ...
+    // "java.lang.Object" -> "Ljava/lang/Object;" (dizi ve tanımlayıcılar olduğu gibi)
+    char descriptor[512];
+    size_t length = strlen(class_name);
+    if (class_name[0] == '[' || (class_name[0] == 'L' && class_name[length - 1] == ';')) {
+        if (length >= sizeof(descriptor)) {
+            return -2;
+        }
+        memcpy(descriptor, class_name, length + 1);
+    } else {
+        if (length + 3 > sizeof(descriptor)) {
+            return -2;
+        }
+        descriptor[0] = 'L';
+        for (size_t i = 0; i < length; i++) {
+            descriptor[i + 1] = class_name[i] == '.' ? '/' : class_name[i];
+        }
+        descriptor[length + 1] = ';';
+        descriptor[length + 2] = '\0';
+    }
     
-    // Örnek olarak, sahte bir sınıf işaretçisi döndür
-    *class_handle = malloc(100);
+    pthread_mutex_lock(&art_class_lock);
+    
+    dex_class_t* klass = NULL;
+    int result = art_find_class((art_class_loader_t*)class_loader, descriptor, &klass);
+    if (result == 0) {
+        result = art_link_class((art_class_loader_t*)class_loader, klass, 0);
+    }
+    
+    pthread_mutex_unlock(&art_class_lock);
+    
+    if (result != 0) {
+        return -3;  // Sınıf bulunamadı veya üst sınıfı çözülemedi
+    }
+    
+    *class_handle = klass;
     
     return 0;
 }
 
+// Üst yükleyiciye önce sor, sonra kendi DEX dosyalarında ara
+static int art_find_class(art_class_loader_t* loader, const char* descriptor, dex_class_t** klass) {
+    if (!loader) {
+        return -1;
+    }
+    
+    if (art_find_class(loader->parent, descriptor, klass) == 0) {
+        return 0;
+    }
+    
+    for (uint32_t i = 0; i < loader->dex_count; i++) {
+        if (dex_find_class(loader->dex_files[i], descriptor, klass) == 0) {
+            return 0;
+        }
+    }
+    
+    return -1;
+}
+
+// Üst sınıf zincirini bağla; yalnızca ilk yüklemede çalışır
+static int art_link_class(art_class_loader_t* loader, dex_class_t* klass, uint32_t depth) {
+    if (klass->linked) {
+        return 0;
+    }
+    
+    // Döngüsel veya aşırı derin hiyerarşi bozuk DEX demektir
+    if (depth > 64) {
+        return -1;
+    }
+    
+    if (klass->superclass_descriptor) {
+        dex_class_t* superclass = NULL;
+        if (art_find_class(loader, klass->superclass_descriptor, &superclass) != 0 ||
+            art_link_class(loader, superclass, depth + 1) != 0) {
+            return -1;
+        }
+        klass->superclass = superclass;
+    }
+    
+    klass->linked = 1;
+    art_runtime.loaded_classes++;
+    
+    return 0;
+}
+
+// Yükleyicinin DEX'leri için "<yol>.oat" görüntüsünü eşle. Görüntü yoksa ya da
+// DEX değişmişse arka planda yeniden derlenir; bu açılış yorumlayıcı ve JIT'le sürer.
+static void art_open_image(art_class_loader_t* loader, const char* path) {
+    char image_path[272];
+    if (art_aot_image_path(path, image_path, sizeof(image_path)) != 0) {
+        return;
+    }
+    
+    int status = art_aot_open(image_path, loader->dex_files, loader->dex_count, &loader->image);
+    if (status != 0 && status != ART_AOT_ERROR_NO_MEMORY && aot_enabled) {
+        art_aot_submit(path, image_path);
+    }
+}
+
 // Alanı oku
 int art_get_field(void* class_handle, void* receiver, const char* field_name, const char* signature, void** value) {
     if (!art_initialized) {
@@ -551,15 +981,50 @@ int art_create_object(void* class_handle, void** args, int arg_count, void** obj
         return -2;
     }
     
+    art_class_t* klass = NULL;
+    art_object_t* instance = NULL;
+    if (art_interp_get_class((dex_class_t*)class_handle, &klass) != 0) {
+        return -3;
+    }
+    if (art_interp_alloc_object(klass, &instance) != 0) {
+        return -5;
+    }
+    
+    // Yapıcı çalışırken taşınabilir; önce tutamaca al
+    void* handle = art_new_handle(instance);
+    if (!handle) {
+        return -5;
+    }
+    
+    // Parametre sayısı tutan ilk yapıcıyı seç
+    art_method_t* constructor = NULL;
+    for (uint32_t i = 0; i < klass->method_count; i++) {
+        art_method_t* method = &klass->methods[i];
+        if (strcmp(method->name, "<init>") == 0 && strlen(method->shorty) == (size_t)arg_count + 1) {
+            constructor = method;
+            break;
+        }
+    }
+    
+    if (constructor) {
+        art_value_t values[ART_INTERP_MAX_ARGS];
+        int count = art_build_args(constructor, handle, args, arg_count, values);
+        art_value_t unused;
+        if (count < 0 || art_interp_invoke(constructor, values, (uint32_t)count, &unused) != 0) {
+            art_heap_remove_root(handle);
+            free(handle);
+            return count < 0 ? -2 : -4;
+        }
+    } else if (arg_count > 0) {
+        art_heap_remove_root(handle);
+        free(handle);
+        return -3;
+    }
+    
     // İstatistik güncelle
     art_stats.objects_created++;
     
-    // Yeni nesne oluştur
-    // Gerçek bir uygulamada, burada nesne oluşturulur
-    // ...
-    
-    // Örnek olarak, sahte bir nesne işaretçisi döndür
-    *object = malloc(100);
+    *object = handle;
     
     return 0;
 }
@@ -574,11 +1039,10 @@ int art_release_object(void* object) {
         return -2;
     }
     
-    // Nesneyi temizle
-    // Gerçek bir uygulamada, burada nesne temizlenir
-    // ...
-    
-    // Örnek olarak, bellekten serbest bırak
+    // Tutamacı kökten çıkar; nesne bir sonraki toplamada serbest kalır
+    if (art_heap_remove_root((art_object_t**)object) != 0) {
+        return -3;
+    }
     free(object);
     
     return 0;
@@ -630,9 +1094,10 @@ int art_force_gc() {
         return -1;
     }
     
-    // Çöp toplayıcıyı çalıştır
-    // Gerçek bir uygulamada, burada çöp toplayıcı çalıştırılır
-    // ...
+    // Tam toplama: genç nesil ve eski nesil döngüsü
+    if (art_heap_collect(1) != 0) {
+        return -2;
+    }
     
     // İstatistik güncelle
     art_stats.gc_count++;
@@ -675,9 +1140,18 @@ art_stats_t art_get_stats() {
         // Toplam çalışma süresini güncelle
         art_stats.uptime_seconds = (uint32_t)(time(NULL) - art_stats.start_time);
         
-        // Bellek kullanımını güncelle (örnek değerler)
-        art_stats.heap_usage = art_config.heap_size / 2;  // %50 kullanım varsayalım
-        art_stats.code_cache_usage = art_config.jit_code_cache_size / 3;  // %33 kullanım varsayalım
+        // Yığın kullanımını güncelle
+        art_heap_stats_t heap_stats;
+        if (art_heap_get_stats(&heap_stats) == 0) {
+            art_stats.heap_usage = heap_stats.nursery_used + heap_stats.old_used;
+            art_stats.gc_count = heap_stats.minor_count + heap_stats.major_count;
+        }
+        
+        // Kod önbelleği kullanımı
+        art_jit_stats_t jit_stats;
+        if (art_jit_get_stats(&jit_stats) == 0) {
+            art_stats.code_cache_usage = jit_stats.cache_used;
+        }
     }
     
     return art_stats;
@@ -690,14 +1164,18 @@ art_performance_t art_get_performance() {
     if (art_initialized) {
         // JIT durumu
         perf.jit_enabled = jit_enabled;
-        perf.jit_compilation_rate = 0.75f;  // Örnek değer (%75)
-        
-        // GC durumu
-        perf.gc_time_percent = 0.05f;  // Örnek değer (%5)
-        perf.gc_pause_avg_ms = 15.0f;  // Örnek değer (15ms)
+        art_jit_stats_t jit_stats;
+        if (art_jit_get_stats(&jit_stats) == 0) {
+            perf.jit_compilation_rate = jit_stats.hit_rate / 100.0f;  // Derlenmiş koda giriş oranı
+        }
         
-        // Bellek durumu
-        perf.heap_fragmentation = 0.1f;  // Örnek değer (%10)
+        // GC ve bellek durumu
+        art_heap_stats_t heap_stats;
+        if (art_heap_get_stats(&heap_stats) == 0) {
+            perf.gc_time_percent = heap_stats.gc_time_percent / 100.0f;
+            perf.gc_pause_avg_ms = heap_stats.pause_avg_ms;
+            perf.heap_fragmentation = heap_stats.fragmentation;
+        }
         
         // Dalvik köprüsü durumu
         perf.dalvik_bridge_enabled = dalvik_bridge_enabled;
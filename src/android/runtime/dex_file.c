@@ -0,0 +1,880 @@
+#include "../../include/android/dex_file.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// Dosya içi tablo girdileri (DEX biçimi, little-endian)
+typedef struct {
+    uint32_t class_idx;
+    uint32_t access_flags;
+    uint32_t superclass_idx;
+    uint32_t interfaces_off;
+    uint32_t source_file_idx;
+    uint32_t annotations_off;
+    uint32_t class_data_off;
+    uint32_t static_values_off;
+} dex_class_def_t;
+
+struct dex_file {
+    void* map;                     // mmap başlangıcı (sayfa hizalı)
+    size_t map_size;
+    const uint8_t* base;           // DEX başlangıcı (APK içinde kayık olabilir)
+    uint32_t size;                 // header->file_size
+    const dex_header_t* header;
+    const uint32_t* string_ids;    // string_data_off dizisi
+    const uint32_t* type_ids;      // descriptor_idx dizisi
+    const dex_class_def_t* class_defs;
+    
+    pthread_mutex_t lock;          // Tembel dizin ve sınıf tablosu için
+    int32_t* class_buckets;        // type_idx -> class_def karma dizini
+    int32_t* class_next;
+    uint32_t bucket_mask;
+    dex_class_t** classes;         // class_def_idx -> çözülmüş sınıf
+    uint32_t resolved;
+};
+
+// ZIP yapıları (yalnızca DEX girdilerini bulmak için gerekenler)
+#define ZIP_EOCD_SIGNATURE         0x06054b50
+#define ZIP_CENTRAL_SIGNATURE      0x02014b50
+#define ZIP_LOCAL_SIGNATURE        0x04034b50
+#define ZIP_EOCD_SIZE              22
+#define ZIP_CENTRAL_SIZE           46
+#define ZIP_LOCAL_SIZE             30
+#define ZIP_COMMENT_MAX            0xFFFF
+#define ZIP_METHOD_STORED          0
+
+// Yardımcı fonksiyonlar
+static int dex_map(int fd, off_t offset, size_t length, dex_file_t** dex);
+static int dex_validate(dex_file_t* dex, size_t length);
+static int dex_check_section(const dex_header_t* header, uint32_t offset, uint32_t count, uint32_t item_size);
+static uint32_t dex_read_uleb128(const uint8_t** data, const uint8_t* end);
+static int64_t dex_find_string(dex_file_t* dex, const char* value);
+static int64_t dex_find_type(dex_file_t* dex, uint32_t string_idx);
+static int dex_build_class_index(dex_file_t* dex);
+static dex_class_t* dex_resolve_class(dex_file_t* dex, uint32_t class_def_idx);
+static uint32_t dex_read_u16(const uint8_t* data);
+static uint32_t dex_read_u32(const uint8_t* data);
+static int dex_apk_entry_number(const char* name, uint32_t length);
+
+// DEX dosyasını eşle
+int dex_open(const char* path, dex_file_t** dex) {
+    struct stat st;
+    
+    if (!path || !dex) {
+        return DEX_ERROR_INVALID;
+    }
+    
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return DEX_ERROR_IO;
+    }
+    
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return DEX_ERROR_IO;
+    }
+    
+    int result = dex_map(fd, 0, (size_t)st.st_size, dex);
+    close(fd);
+    
+    return result;
+}
+
+// Bellekteki DEX görüntüsünü kopyala (üretilmiş kod ve testler için). Kopya
+// anonim eşlemeye alınıp salt okunur yapılır; kapatma yolu dosyayla aynıdır.
+int dex_open_memory(const void* data, size_t size, dex_file_t** dex) {
+    if (!data || !dex) {
+        return DEX_ERROR_INVALID;
+    }
+    
+    if (size < DEX_HEADER_SIZE) {
+        return DEX_ERROR_FORMAT;
+    }
+    
+    dex_file_t* file = (dex_file_t*)calloc(1, sizeof(dex_file_t));
+    if (!file) {
+        return DEX_ERROR_NO_MEMORY;
+    }
+    
+    file->map_size = size;
+    file->map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (file->map == MAP_FAILED) {
+        free(file);
+        return DEX_ERROR_NO_MEMORY;
+    }
+    
+    memcpy(file->map, data, size);
+    mprotect(file->map, size, PROT_READ);
+    
+    file->base = (const uint8_t*)file->map;
+    file->header = (const dex_header_t*)file->base;
+    
+    int result = dex_validate(file, size);
+    if (result != 0) {
+        munmap(file->map, file->map_size);
+        free(file);
+        return result;
+    }
+    
+    pthread_mutex_init(&file->lock, NULL);
+    *dex = file;
+    
+    return 0;
+}
+
+// APK içindeki sıkıştırılmamış classes*.dex girdilerini yerinde eşle. Girdiler
+// classes.dex, classes2.dex, ... sırasıyla döner; ilk boşlukta durulur.
+int dex_open_apk(const char* apk_path, dex_file_t** dex_files, uint32_t max_files, uint32_t* count) {
+    uint8_t tail[ZIP_EOCD_SIZE + ZIP_COMMENT_MAX];
+    uint8_t local[ZIP_LOCAL_SIZE];
+    struct stat st;
+    int result = 0;
+    
+    if (!apk_path || !dex_files || !count || max_files == 0) {
+        return DEX_ERROR_INVALID;
+    }
+    
+    *count = 0;
+    if (max_files > DEX_MAX_APK_FILES) {
+        max_files = DEX_MAX_APK_FILES;
+    }
+    
+    int fd = open(apk_path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return DEX_ERROR_IO;
+    }
+    
+    if (fstat(fd, &st) != 0 || st.st_size < ZIP_EOCD_SIZE) {
+        close(fd);
+        return DEX_ERROR_FORMAT;
+    }
+    
+    // Merkezi dizin sonu kaydını dosyanın kuyruğunda ara
+    size_t tail_size = (size_t)st.st_size < sizeof(tail) ? (size_t)st.st_size : sizeof(tail);
+    off_t tail_offset = st.st_size - (off_t)tail_size;
+    if (pread(fd, tail, tail_size, tail_offset) != (ssize_t)tail_size) {
+        close(fd);
+        return DEX_ERROR_IO;
+    }
+    
+    int64_t eocd = -1;
+    for (int64_t i = (int64_t)tail_size - ZIP_EOCD_SIZE; i >= 0; i--) {
+        if (dex_read_u32(tail + i) == ZIP_EOCD_SIGNATURE) {
+            eocd = i;
+            break;
+        }
+    }
+    
+    if (eocd < 0) {
+        close(fd);
+        return DEX_ERROR_FORMAT;
+    }
+    
+    uint32_t entries = dex_read_u16(tail + eocd + 10);
+    uint32_t central_size = dex_read_u32(tail + eocd + 12);
+    uint32_t central_offset = dex_read_u32(tail + eocd + 16);
+    
+    if ((uint64_t)central_offset + central_size > (uint64_t)st.st_size) {
+        close(fd);
+        return DEX_ERROR_FORMAT;
+    }
+    
+    uint8_t* central = (uint8_t*)malloc(central_size ? central_size : 1);
+    if (!central) {
+        close(fd);
+        return DEX_ERROR_NO_MEMORY;
+    }
+    
+    if (pread(fd, central, central_size, central_offset) != (ssize_t)central_size) {
+        free(central);
+        close(fd);
+        return DEX_ERROR_IO;
+    }
+    
+    dex_file_t* found[DEX_MAX_APK_FILES] = {0};
+    uint32_t position = 0;
+    
+    for (uint32_t i = 0; i < entries && result == 0; i++) {
+        if (position + ZIP_CENTRAL_SIZE > central_size ||
+            dex_read_u32(central + position) != ZIP_CENTRAL_SIGNATURE) {
+            result = DEX_ERROR_FORMAT;
+            break;
+        }
+        
+        const uint8_t* entry = central + position;
+        uint32_t method = dex_read_u16(entry + 10);
+        uint32_t compressed_size = dex_read_u32(entry + 20);
+        uint32_t name_length = dex_read_u16(entry + 28);
+        uint32_t extra_length = dex_read_u16(entry + 30);
+        uint32_t comment_length = dex_read_u16(entry + 32);
+        uint32_t local_offset = dex_read_u32(entry + 42);
+        
+        if (position + ZIP_CENTRAL_SIZE + name_length > central_size) {
+            result = DEX_ERROR_FORMAT;
+            break;
+        }
+        
+        int number = dex_apk_entry_number((const char*)entry + ZIP_CENTRAL_SIZE, name_length);
+        position += ZIP_CENTRAL_SIZE + name_length + extra_length + comment_length;
+        
+        if (number <= 0 || (uint32_t)number > max_files) {
+            continue;
+        }
+        
+        // Sıkıştırılmış DEX yerinde eşlenemez; paket yöneticisi bunları
+        // kurulumda ayıklamalıdır
+        if (method != ZIP_METHOD_STORED) {
+            result = DEX_ERROR_FORMAT;
+            break;
+        }
+        
+        if (pread(fd, local, sizeof(local), local_offset) != (ssize_t)sizeof(local) ||
+            dex_read_u32(local) != ZIP_LOCAL_SIGNATURE) {
+            result = DEX_ERROR_FORMAT;
+            break;
+        }
+        
+        uint64_t data_offset = (uint64_t)local_offset + ZIP_LOCAL_SIZE +
+                               dex_read_u16(local + 26) + dex_read_u16(local + 28);
+        if (data_offset + compressed_size > (uint64_t)st.st_size || found[number - 1]) {
+            result = DEX_ERROR_FORMAT;
+            break;
+        }
+        
+        result = dex_map(fd, (off_t)data_offset, compressed_size, &found[number - 1]);
+    }
+    
+    free(central);
+    close(fd);
+    
+    // Sırayı bozmadan topla, ilk eksik numarada dur
+    uint32_t total = 0;
+    for (uint32_t i = 0; i < max_files; i++) {
+        if (result == 0 && found[i] && total == i) {
+            dex_files[total++] = found[i];
+        } else if (found[i]) {
+            dex_close(found[i]);
+        }
+    }
+    
+    if (result == 0 && total == 0) {
+        result = DEX_ERROR_NOT_FOUND;
+    }
+    
+    *count = total;
+    
+    return result;
+}
+
+// Kurulum dizinine ayıklanmış classes.dex, classes2.dex, ... dosyalarını eşle;
+// ilk eksik numarada durulur
+int dex_open_dir(const char* dir, dex_file_t** dex_files, uint32_t max_files, uint32_t* count) {
+    char path[512];
+    int result = 0;
+    
+    if (!dir || !dex_files || !count || max_files == 0) {
+        return DEX_ERROR_INVALID;
+    }
+    
+    *count = 0;
+    if (max_files > DEX_MAX_APK_FILES) {
+        max_files = DEX_MAX_APK_FILES;
+    }
+    
+    for (uint32_t i = 0; i < max_files; i++) {
+        int length = (i == 0) ? snprintf(path, sizeof(path), "%s/classes.dex", dir) :
+                                snprintf(path, sizeof(path), "%s/classes%u.dex", dir, i + 1);
+        if (length < 0 || (size_t)length >= sizeof(path)) {
+            result = DEX_ERROR_INVALID;
+            break;
+        }
+        
+        if (access(path, F_OK) != 0) {
+            break;
+        }
+        
+        result = dex_open(path, &dex_files[*count]);
+        if (result != 0) {
+            break;
+        }
+        (*count)++;
+    }
+    
+    if (result != 0) {
+        while (*count > 0) {
+            dex_close(dex_files[--(*count)]);
+        }
+        return result;
+    }
+    
+    return (*count == 0) ? DEX_ERROR_NOT_FOUND : 0;
+}
+
+// DEX dosyasını kapat
+void dex_close(dex_file_t* dex) {
+    if (!dex) {
+        return;
+    }
+    
+    if (dex->classes) {
+        for (uint32_t i = 0; i < dex->header->class_defs_size; i++) {
+            free(dex->classes[i]);
+        }
+        free(dex->classes);
+    }
+    
+    free(dex->class_buckets);
+    free(dex->class_next);
+    pthread_mutex_destroy(&dex->lock);
+    munmap(dex->map, dex->map_size);
+    free(dex);
+}
+
+// Tanımlayıcıya ("Lpaket/Sinif;") göre sınıfı bul ve gerekirse çöz
+int dex_find_class(dex_file_t* dex, const char* descriptor, dex_class_t** klass) {
+    if (!dex || !descriptor || !klass) {
+        return DEX_ERROR_INVALID;
+    }
+    
+    // Dizgi ve tip tabloları sıralı: ikili arama yalnızca log(n) sayfaya dokunur
+    int64_t string_idx = dex_find_string(dex, descriptor);
+    if (string_idx < 0) {
+        return DEX_ERROR_NOT_FOUND;
+    }
+    
+    int64_t type_idx = dex_find_type(dex, (uint32_t)string_idx);
+    if (type_idx < 0) {
+        return DEX_ERROR_NOT_FOUND;
+    }
+    
+    pthread_mutex_lock(&dex->lock);
+    
+    if (!dex->class_buckets && dex_build_class_index(dex) != 0) {
+        pthread_mutex_unlock(&dex->lock);
+        return DEX_ERROR_NO_MEMORY;
+    }
+    
+    uint32_t bucket = ((uint32_t)type_idx * 2654435761u) & dex->bucket_mask;
+    int32_t index = dex->class_buckets[bucket];
+    while (index >= 0 && dex->class_defs[index].class_idx != (uint32_t)type_idx) {
+        index = dex->class_next[index];
+    }
+    
+    if (index < 0) {
+        pthread_mutex_unlock(&dex->lock);
+        return DEX_ERROR_NOT_FOUND;  // Tip başka bir DEX'te tanımlı
+    }
+    
+    dex_class_t* result = dex->classes[index];
+    if (!result) {
+        result = dex_resolve_class(dex, (uint32_t)index);
+        if (!result) {
+            pthread_mutex_unlock(&dex->lock);
+            return DEX_ERROR_NO_MEMORY;
+        }
+        dex->classes[index] = result;
+        dex->resolved++;
+    }
+    
+    pthread_mutex_unlock(&dex->lock);
+    
+    *klass = result;
+    
+    return 0;
+}
+
+// class_defs sırasına göre sınıfı al ve gerekirse çöz
+int dex_get_class(dex_file_t* dex, uint32_t class_def_idx, dex_class_t** klass) {
+    if (!dex || !klass) {
+        return DEX_ERROR_INVALID;
+    }
+    
+    if (class_def_idx >= dex->header->class_defs_size) {
+        return DEX_ERROR_NOT_FOUND;
+    }
+    
+    pthread_mutex_lock(&dex->lock);
+    
+    if (!dex->class_buckets && dex_build_class_index(dex) != 0) {
+        pthread_mutex_unlock(&dex->lock);
+        return DEX_ERROR_NO_MEMORY;
+    }
+    
+    dex_class_t* result = dex->classes[class_def_idx];
+    if (!result) {
+        result = dex_resolve_class(dex, class_def_idx);
+        if (!result) {
+            pthread_mutex_unlock(&dex->lock);
+            return DEX_ERROR_NO_MEMORY;
+        }
+        dex->classes[class_def_idx] = result;
+        dex->resolved++;
+    }
+    
+    pthread_mutex_unlock(&dex->lock);
+    
+    *klass = result;
+    
+    return 0;
+}
+
+// Dizgi tablosundan MUTF-8 dizgiyi al
+const char* dex_get_string(dex_file_t* dex, uint32_t string_idx) {
+    if (!dex || string_idx >= dex->header->string_ids_size) {
+        return NULL;
+    }
+    
+    uint32_t offset = dex->string_ids[string_idx];
+    if (offset >= dex->size) {
+        return NULL;
+    }
+    
+    const uint8_t* data = dex->base + offset;
+    const uint8_t* end = dex->base + dex->size;
+    
+    // UTF-16 uzunluğunu atla; dizgi dosya içinde sonlanmalı
+    dex_read_uleb128(&data, end);
+    if (data >= end || !memchr(data, 0, (size_t)(end - data))) {
+        return NULL;
+    }
+    
+    return (const char*)data;
+}
+
+// Tip tanımlayıcısını al
+const char* dex_get_type_descriptor(dex_file_t* dex, uint32_t type_idx) {
+    if (!dex || type_idx >= dex->header->type_ids_size) {
+        return NULL;
+    }
+    
+    return dex_get_string(dex, dex->type_ids[type_idx]);
+}
+
+// Başlığı al
+const dex_header_t* dex_get_header(dex_file_t* dex) {
+    return dex ? dex->header : NULL;
+}
+
+// İstatistikleri al
+int dex_get_stats(dex_file_t* dex, dex_stats_t* stats) {
+    if (!dex || !stats) {
+        return DEX_ERROR_INVALID;
+    }
+    
+    pthread_mutex_lock(&dex->lock);
+    stats->string_count = dex->header->string_ids_size;
+    stats->type_count = dex->header->type_ids_size;
+    stats->class_count = dex->header->class_defs_size;
+    stats->resolved_classes = dex->resolved;
+    stats->class_index_built = dex->class_buckets != NULL;
+    stats->mapped_bytes = dex->map_size;
+    pthread_mutex_unlock(&dex->lock);
+    
+    return 0;
+}
+
+// Alan tanımlayıcısı
+const dex_field_id_t* dex_get_field_id(dex_file_t* dex, uint32_t field_idx) {
+    if (!dex || field_idx >= dex->header->field_ids_size) {
+        return NULL;
+    }
+    
+    return (const dex_field_id_t*)(dex->base + dex->header->field_ids_off) + field_idx;
+}
+
+// Metot tanımlayıcısı
+const dex_method_id_t* dex_get_method_id(dex_file_t* dex, uint32_t method_idx) {
+    if (!dex || method_idx >= dex->header->method_ids_size) {
+        return NULL;
+    }
+    
+    return (const dex_method_id_t*)(dex->base + dex->header->method_ids_off) + method_idx;
+}
+
+// Prototip tanımlayıcısı
+const dex_proto_id_t* dex_get_proto_id(dex_file_t* dex, uint32_t proto_idx) {
+    if (!dex || proto_idx >= dex->header->proto_ids_size) {
+        return NULL;
+    }
+    
+    return (const dex_proto_id_t*)(dex->base + dex->header->proto_ids_off) + proto_idx;
+}
+
+// type_list: uint32 boyut ve ardından uint16 type_idx dizisi
+const uint16_t* dex_get_type_list(dex_file_t* dex, uint32_t offset, uint32_t* count) {
+    if (!dex || !count) {
+        return NULL;
+    }
+    
+    *count = 0;
+    if (offset == 0) {
+        return NULL;
+    }
+    
+    if ((offset & 3) != 0 || (uint64_t)offset + 4 > dex->size) {
+        return NULL;
+    }
+    
+    uint32_t size = dex_read_u32(dex->base + offset);
+    if ((uint64_t)offset + 4 + (uint64_t)size * 2 > dex->size) {
+        return NULL;
+    }
+    
+    *count = size;
+    
+    return (const uint16_t*)(dex->base + offset + 4);
+}
+
+// Metot gövdesi; kod dosya içinde kalmalı
+const dex_code_item_t* dex_get_code_item(dex_file_t* dex, uint32_t code_off) {
+    if (!dex || code_off == 0 || (code_off & 3) != 0 ||
+        (uint64_t)code_off + sizeof(dex_code_item_t) > dex->size) {
+        return NULL;
+    }
+    
+    const dex_code_item_t* code = (const dex_code_item_t*)(dex->base + code_off);
+    if ((uint64_t)code_off + sizeof(dex_code_item_t) + (uint64_t)code->insns_size * 2 > dex->size ||
+        code->ins_size > code->registers_size) {
+        return NULL;
+    }
+    
+    return code;
+}
+
+// class_data içindeki dört listeyi aç
+int dex_get_class_members(const dex_class_t* klass, dex_member_t* members) {
+    if (!klass || !members) {
+        return DEX_ERROR_INVALID;
+    }
+    
+    uint32_t counts[4] = {
+        klass->static_fields_size, klass->instance_fields_size,
+        klass->direct_methods_size, klass->virtual_methods_size
+    };
+    
+    if (!klass->class_data) {
+        return counts[0] + counts[1] + counts[2] + counts[3] == 0 ? 0 : DEX_ERROR_FORMAT;
+    }
+    
+    const uint8_t* data = klass->class_data;
+    const uint8_t* end = klass->dex->base + klass->dex->size;
+    
+    for (int list = 0; list < 4; list++) {
+        // Her liste kendi içinde sıra farkıyla kodlanır
+        uint32_t idx = 0;
+        
+        for (uint32_t i = 0; i < counts[list]; i++) {
+            if (data >= end) {
+                return DEX_ERROR_FORMAT;
+            }
+            
+            idx += dex_read_uleb128(&data, end);
+            members->idx = idx;
+            members->access_flags = dex_read_uleb128(&data, end);
+            members->code_off = list >= 2 ? dex_read_uleb128(&data, end) : 0;
+            members++;
+        }
+    }
+    
+    return 0;
+}
+
+// Adler-32 sağlamasını doğrula (imza alanından sonrası)
+int dex_verify_checksum(dex_file_t* dex) {
+    if (!dex) {
+        return DEX_ERROR_INVALID;
+    }
+    
+    uint32_t a = 1;
+    uint32_t b = 0;
+    const uint8_t* data = dex->base + 12;
+    uint32_t remaining = dex->size - 12;
+    
+    while (remaining > 0) {
+        // 5552: taşma olmadan biriktirilebilecek en fazla bayt
+        uint32_t block = remaining < 5552 ? remaining : 5552;
+        remaining -= block;
+        while (block--) {
+            a += *data++;
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+    }
+    
+    return ((b << 16) | a) == dex->header->checksum ? 0 : DEX_ERROR_FORMAT;
+}
+
+// Dosyanın [offset, offset + length) aralığını salt okunur eşle ve başlığı doğrula
+static int dex_map(int fd, off_t offset, size_t length, dex_file_t** dex) {
+    long page_size = sysconf(_SC_PAGESIZE);
+    off_t aligned = offset & ~((off_t)page_size - 1);
+    size_t delta = (size_t)(offset - aligned);
+    
+    if (length < DEX_HEADER_SIZE) {
+        return DEX_ERROR_FORMAT;
+    }
+    
+    dex_file_t* file = (dex_file_t*)calloc(1, sizeof(dex_file_t));
+    if (!file) {
+        return DEX_ERROR_NO_MEMORY;
+    }
+    
+    file->map_size = length + delta;
+    file->map = mmap(NULL, file->map_size, PROT_READ, MAP_PRIVATE, fd, aligned);
+    if (file->map == MAP_FAILED) {
+        free(file);
+        return DEX_ERROR_IO;
+    }
+    
+    // Erişim rastgele: önden okuma, hiç dokunulmayan sınıfları da belleğe çeker
+    madvise(file->map, file->map_size, MADV_RANDOM);
+    
+    file->base = (const uint8_t*)file->map + delta;
+    file->header = (const dex_header_t*)file->base;
+    
+    int result = dex_validate(file, length);
+    if (result != 0) {
+        munmap(file->map, file->map_size);
+        free(file);
+        return result;
+    }
+    
+    pthread_mutex_init(&file->lock, NULL);
+    *dex = file;
+    
+    return 0;
+}
+
+// Başlığı ve bölüm sınırlarını doğrula; bölümlerin içeriğine dokunulmaz
+static int dex_validate(dex_file_t* dex, size_t length) {
+    const dex_header_t* header = dex->header;
+    
+    if (memcmp(header->magic, DEX_MAGIC, 4) != 0 ||
+        header->magic[4] < '0' || header->magic[4] > '9' ||
+        header->magic[5] < '0' || header->magic[5] > '9' ||
+        header->magic[6] < '0' || header->magic[6] > '9' ||
+        header->magic[7] != 0) {
+        return DEX_ERROR_FORMAT;
+    }
+    
+    if (header->endian_tag != DEX_ENDIAN_CONSTANT ||
+        header->header_size != DEX_HEADER_SIZE ||
+        header->file_size < DEX_HEADER_SIZE ||
+        header->file_size > length) {
+        return DEX_ERROR_FORMAT;
+    }
+    
+    if (dex_check_section(header, header->string_ids_off, header->string_ids_size, 4) != 0 ||
+        dex_check_section(header, header->type_ids_off, header->type_ids_size, 4) != 0 ||
+        dex_check_section(header, header->proto_ids_off, header->proto_ids_size, 12) != 0 ||
+        dex_check_section(header, header->field_ids_off, header->field_ids_size, 8) != 0 ||
+        dex_check_section(header, header->method_ids_off, header->method_ids_size, 8) != 0 ||
+        dex_check_section(header, header->class_defs_off, header->class_defs_size, 32) != 0 ||
+        dex_check_section(header, header->data_off, header->data_size, 1) != 0 ||
+        header->type_ids_size > 0xFFFF) {
+        return DEX_ERROR_FORMAT;
+    }
+    
+    dex->size = header->file_size;
+    dex->string_ids = (const uint32_t*)(dex->base + header->string_ids_off);
+    dex->type_ids = (const uint32_t*)(dex->base + header->type_ids_off);
+    dex->class_defs = (const dex_class_def_t*)(dex->base + header->class_defs_off);
+    
+    return 0;
+}
+
+// Bölüm dosya sınırları içinde ve hizalı mı?
+static int dex_check_section(const dex_header_t* header, uint32_t offset, uint32_t count, uint32_t item_size) {
+    if (count == 0) {
+        return 0;
+    }
+    
+    if (offset < DEX_HEADER_SIZE || (item_size >= 4 && (offset & 3) != 0)) {
+        return -1;
+    }
+    
+    if ((uint64_t)offset + (uint64_t)count * item_size > header->file_size) {
+        return -1;
+    }
+    
+    return 0;
+}
+
+// İşaretsiz LEB128 oku
+static uint32_t dex_read_uleb128(const uint8_t** data, const uint8_t* end) {
+    const uint8_t* p = *data;
+    uint32_t value = 0;
+    
+    for (int shift = 0; shift < 35 && p < end; shift += 7) {
+        uint8_t byte = *p++;
+        value |= (uint32_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            *data = p;
+            return value;
+        }
+    }
+    
+    *data = end;  // Bozuk kodlama
+    
+    return 0;
+}
+
+// string_ids içerikçe sıralı; ikili arama. Bayt karşılaştırması, vekil çift
+// içermeyen MUTF-8 dizgilerinde UTF-16 sırasıyla aynıdır.
+static int64_t dex_find_string(dex_file_t* dex, const char* value) {
+    uint32_t low = 0;
+    uint32_t high = dex->header->string_ids_size;
+    
+    while (low < high) {
+        uint32_t middle = low + (high - low) / 2;
+        const char* string = dex_get_string(dex, middle);
+        if (!string) {
+            return -1;
+        }
+        
+        int compare = strcmp(string, value);
+        if (compare == 0) {
+            return middle;
+        }
+        
+        if (compare < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    
+    return -1;
+}
+
+// type_ids descriptor_idx'e göre sıralı; ikili arama
+static int64_t dex_find_type(dex_file_t* dex, uint32_t string_idx) {
+    uint32_t low = 0;
+    uint32_t high = dex->header->type_ids_size;
+    
+    while (low < high) {
+        uint32_t middle = low + (high - low) / 2;
+        uint32_t descriptor_idx = dex->type_ids[middle];
+        
+        if (descriptor_idx == string_idx) {
+            return middle;
+        }
+        
+        if (descriptor_idx < string_idx) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    
+    return -1;
+}
+
+// class_defs sıralı değil (üst sınıflar önce gelir): type_idx üzerinden karma
+// dizini ilk sınıf aramasında kur. Yalnızca class_defs tablosu okunur.
+static int dex_build_class_index(dex_file_t* dex) {
+    uint32_t count = dex->header->class_defs_size;
+    uint32_t bucket_count = 16;
+    
+    while (bucket_count < count * 2) {
+        bucket_count <<= 1;
+    }
+    
+    int32_t* buckets = (int32_t*)malloc(bucket_count * sizeof(int32_t));
+    int32_t* next = (int32_t*)malloc((count ? count : 1) * sizeof(int32_t));
+    dex_class_t** classes = (dex_class_t**)calloc(count ? count : 1, sizeof(dex_class_t*));
+    
+    if (!buckets || !next || !classes) {
+        free(buckets);
+        free(next);
+        free(classes);
+        return DEX_ERROR_NO_MEMORY;
+    }
+    
+    memset(buckets, 0xFF, bucket_count * sizeof(int32_t));
+    
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t bucket = (dex->class_defs[i].class_idx * 2654435761u) & (bucket_count - 1);
+        next[i] = buckets[bucket];
+        buckets[bucket] = (int32_t)i;
+    }
+    
+    dex->class_next = next;
+    dex->classes = classes;
+    dex->bucket_mask = bucket_count - 1;
+    dex->class_buckets = buckets;
+    
+    return 0;
+}
+
+// Tek bir class_def girdisini ve class_data başlığını çöz
+static dex_class_t* dex_resolve_class(dex_file_t* dex, uint32_t class_def_idx) {
+    const dex_class_def_t* def = &dex->class_defs[class_def_idx];
+    
+    dex_class_t* klass = (dex_class_t*)calloc(1, sizeof(dex_class_t));
+    if (!klass) {
+        return NULL;
+    }
+    
+    klass->dex = dex;
+    klass->class_def_idx = class_def_idx;
+    klass->type_idx = def->class_idx;
+    klass->descriptor = dex_get_type_descriptor(dex, def->class_idx);
+    klass->access_flags = def->access_flags;
+    
+    if (def->superclass_idx != DEX_NO_INDEX) {
+        klass->superclass_descriptor = dex_get_type_descriptor(dex, def->superclass_idx);
+    }
+    
+    klass->interfaces = dex_get_type_list(dex, def->interfaces_off, &klass->interfaces_size);
+    
+    // Arayüz ve işaretçi sınıfların class_data'sı olmayabilir
+    if (def->class_data_off != 0 && def->class_data_off < dex->size) {
+        const uint8_t* data = dex->base + def->class_data_off;
+        const uint8_t* end = dex->base + dex->size;
+        
+        klass->static_fields_size = dex_read_uleb128(&data, end);
+        klass->instance_fields_size = dex_read_uleb128(&data, end);
+        klass->direct_methods_size = dex_read_uleb128(&data, end);
+        klass->virtual_methods_size = dex_read_uleb128(&data, end);
+        klass->class_data = data < end ? data : NULL;
+    }
+    
+    return klass;
+}
+
+static uint32_t dex_read_u16(const uint8_t* data) {
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8);
+}
+
+static uint32_t dex_read_u32(const uint8_t* data) {
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) |
+           ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+// "classes.dex" -> 1, "classesN.dex" -> N, diğerleri -> 0
+static int dex_apk_entry_number(const char* name, uint32_t length) {
+    if (length < 11 || memcmp(name, "classes", 7) != 0 || memcmp(name + length - 4, ".dex", 4) != 0) {
+        return 0;
+    }
+    
+    if (length == 11) {
+        return 1;
+    }
+    
+    int number = 0;
+    for (uint32_t i = 7; i < length - 4; i++) {
+        if (name[i] < '0' || name[i] > '9' || number > 1000) {
+            return 0;
+        }
+        number = number * 10 + (name[i] - '0');
+    }
+    
+    return number >= 2 ? number : 0;
+}
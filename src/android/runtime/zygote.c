@@ -0,0 +1,420 @@
+#include "../../include/android/zygote.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <time.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <sys/prctl.h>
+
+// Sistem sürecinden zygote'a giden komutlar
+#define ZYGOTE_COMMAND_FORK        1
+#define ZYGOTE_COMMAND_KILL        2
+
+typedef struct {
+    uint32_t command;
+    int32_t pid;                   // KILL: sonlandırılacak süreç
+    zygote_request_t request;      // FORK: başlatma isteği
+} zygote_message_t;
+
+// Zygote'tan dönen yanıt
+typedef struct {
+    int32_t pid;                   // Yeni uygulama süreci, 0 ya da hata kodu
+    uint64_t preload_us;           // Yalnızca hazır mesajında dolu
+} zygote_reply_t;
+
+// Zygote durumu (sistem sürecinde)
+static pid_t zygote_pid = 0;
+static int zygote_socket = -1;
+static pthread_mutex_t zygote_lock = PTHREAD_MUTEX_INITIALIZER;
+static zygote_stats_t zygote_stats = {0};
+
+// Yardımcı fonksiyonlar
+static void zygote_main(int control, zygote_preload_t preload, zygote_app_main_t app_main, void* user_data);
+static int zygote_transact(const zygote_message_t* message, zygote_reply_t* reply);
+static int zygote_receive(int socket, zygote_reply_t* reply, int timeout_ms);
+static void zygote_abort(void);
+static uint64_t zygote_now_us(void);
+
+// Zygote sürecini başlat ve önyüklemenin bitmesini bekle
+int zygote_start(zygote_preload_t preload, zygote_app_main_t app_main, void* user_data) {
+    int sockets[2];
+    zygote_reply_t reply;
+    
+    if (!app_main) {
+        return ZYGOTE_ERROR_INVALID;
+    }
+    
+    pthread_mutex_lock(&zygote_lock);
+    
+    if (zygote_pid > 0) {
+        pthread_mutex_unlock(&zygote_lock);
+        return 0;  // Zaten çalışıyor
+    }
+    
+    // Mesaj sınırlarını koruyan yerel soket çifti
+    if (socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, sockets) != 0) {
+        pthread_mutex_unlock(&zygote_lock);
+        return ZYGOTE_ERROR_FORK;
+    }
+    
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(sockets[0]);
+        close(sockets[1]);
+        pthread_mutex_unlock(&zygote_lock);
+        return ZYGOTE_ERROR_FORK;
+    }
+    
+    if (pid == 0) {
+        close(sockets[0]);
+        zygote_main(sockets[1], preload, app_main, user_data);
+        _exit(0);
+    }
+    
+    close(sockets[1]);
+    
+    // Hazır mesajını bekle
+    if (zygote_receive(sockets[0], &reply, ZYGOTE_PRELOAD_TIMEOUT_MS) != 0 || reply.pid != 0) {
+        close(sockets[0]);
+        kill(pid, SIGKILL);
+        waitpid(pid, NULL, 0);
+        pthread_mutex_unlock(&zygote_lock);
+        return ZYGOTE_ERROR_PRELOAD;
+    }
+    
+    zygote_pid = pid;
+    zygote_socket = sockets[0];
+    memset(&zygote_stats, 0, sizeof(zygote_stats));
+    zygote_stats.pid = pid;
+    zygote_stats.preload_us = reply.preload_us;
+    
+    pthread_mutex_unlock(&zygote_lock);
+    
+    return 0;
+}
+
+// Zygote'u durdur; uygulama süreçleri ebeveyn ölüm sinyaliyle birlikte sonlanır
+int zygote_stop(void) {
+    pthread_mutex_lock(&zygote_lock);
+    
+    if (zygote_pid <= 0) {
+        pthread_mutex_unlock(&zygote_lock);
+        return 0;
+    }
+    
+    // Soketin kapanması zygote ana döngüsünü bitirir
+    close(zygote_socket);
+    waitpid(zygote_pid, NULL, 0);
+    
+    zygote_socket = -1;
+    zygote_pid = 0;
+    
+    pthread_mutex_unlock(&zygote_lock);
+    
+    return 0;
+}
+
+// Zygote çalışıyor mu
+int zygote_is_running(void) {
+    pthread_mutex_lock(&zygote_lock);
+    int running = zygote_pid > 0;
+    pthread_mutex_unlock(&zygote_lock);
+    
+    return running;
+}
+
+// Zygote'tan yeni uygulama süreci iste
+pid_t zygote_fork_app(const char* package_name, const char* apk_path, uint32_t uid) {
+    zygote_message_t message;
+    zygote_reply_t reply;
+    
+    if (!package_name || strlen(package_name) >= ZYGOTE_PACKAGE_MAX ||
+        (apk_path && strlen(apk_path) >= ZYGOTE_PATH_MAX)) {
+        return ZYGOTE_ERROR_INVALID;
+    }
+    
+    memset(&message, 0, sizeof(message));
+    message.command = ZYGOTE_COMMAND_FORK;
+    strcpy(message.request.package_name, package_name);
+    if (apk_path) {
+        strcpy(message.request.apk_path, apk_path);
+    }
+    message.request.uid = uid;
+    message.request.request_us = zygote_now_us();
+    
+    pthread_mutex_lock(&zygote_lock);
+    
+    uint64_t started = zygote_now_us();
+    int result = zygote_transact(&message, &reply);
+    
+    if (result == 0 && reply.pid > 0) {
+        zygote_stats.forks++;
+        zygote_stats.last_fork_us = zygote_now_us() - started;
+    }
+    
+    pthread_mutex_unlock(&zygote_lock);
+    
+    if (result != 0) {
+        return result;
+    }
+    
+    return reply.pid > 0 ? (pid_t)reply.pid : ZYGOTE_ERROR_FORK;
+}
+
+// Uygulama sürecini sonlandır. Sinyali süreçlerin ebeveyni olan zygote
+// gönderir: yalnızca kendi türettiği ve henüz toplamadığı süreçleri
+// öldürür, böylece yeniden kullanılmış bir pid'e dokunulmaz
+int zygote_kill_app(pid_t pid) {
+    zygote_message_t message;
+    zygote_reply_t reply;
+    
+    if (pid <= 0) {
+        return ZYGOTE_ERROR_INVALID;
+    }
+    
+    memset(&message, 0, sizeof(message));
+    message.command = ZYGOTE_COMMAND_KILL;
+    message.pid = pid;
+    
+    pthread_mutex_lock(&zygote_lock);
+    int result = zygote_transact(&message, &reply);
+    pthread_mutex_unlock(&zygote_lock);
+    
+    return result != 0 ? result : reply.pid;
+}
+
+// Süreç bellek dağılımını /proc/<pid>/smaps_rollup üzerinden oku
+int zygote_get_memory(pid_t pid, zygote_memory_t* memory) {
+    char path[64];
+    char line[256];
+    uint64_t value;
+    
+    if (pid <= 0 || !memory) {
+        return ZYGOTE_ERROR_INVALID;
+    }
+    
+    snprintf(path, sizeof(path), "/proc/%d/smaps_rollup", (int)pid);
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        return ZYGOTE_ERROR_INVALID;
+    }
+    
+    memset(memory, 0, sizeof(zygote_memory_t));
+    
+    while (fgets(line, sizeof(line), file)) {
+        if (sscanf(line, "Rss: %" SCNu64 " kB", &value) == 1) {
+            memory->rss_kb = value;
+        } else if (sscanf(line, "Pss: %" SCNu64 " kB", &value) == 1) {
+            memory->pss_kb = value;
+        } else if (sscanf(line, "Shared_Clean: %" SCNu64 " kB", &value) == 1 ||
+                   sscanf(line, "Shared_Dirty: %" SCNu64 " kB", &value) == 1) {
+            memory->shared_kb += value;
+        } else if (sscanf(line, "Private_Clean: %" SCNu64 " kB", &value) == 1 ||
+                   sscanf(line, "Private_Dirty: %" SCNu64 " kB", &value) == 1) {
+            memory->private_kb += value;
+        }
+    }
+    
+    fclose(file);
+    
+    return 0;
+}
+
+// İstatistikleri al
+int zygote_get_stats(zygote_stats_t* stats) {
+    if (!stats) {
+        return ZYGOTE_ERROR_INVALID;
+    }
+    
+    pthread_mutex_lock(&zygote_lock);
+    *stats = zygote_stats;
+    pthread_mutex_unlock(&zygote_lock);
+    
+    return 0;
+}
+
+// Zygote ana döngüsü: önyükle, sonra istek başına fork et
+static void zygote_main(int control, zygote_preload_t preload, zygote_app_main_t app_main, void* user_data) {
+    zygote_message_t message;
+    zygote_reply_t reply;
+    pid_t* apps = NULL;            // Türetilmiş, henüz toplanmamış süreçler
+    uint32_t app_count = 0;
+    uint32_t app_capacity = 0;
+    pid_t exited;
+    
+    // Sistem süreci ölürse soket kapanır ve döngü biter
+    prctl(PR_SET_NAME, "zygote", 0, 0, 0);
+    
+    // ART'ı başlat ve ortak sınıfları yükle; bu sayfalar uygulamalarla paylaşılır
+    uint64_t started = zygote_now_us();
+    memset(&reply, 0, sizeof(reply));
+    reply.pid = (preload && preload(user_data) != 0) ? ZYGOTE_ERROR_PRELOAD : 0;
+    reply.preload_us = zygote_now_us() - started;
+    
+    if (send(control, &reply, sizeof(reply), MSG_NOSIGNAL) != (ssize_t)sizeof(reply) || reply.pid != 0) {
+        return;
+    }
+    
+    struct pollfd poll_fd;
+    poll_fd.fd = control;
+    poll_fd.events = POLLIN;
+    
+    for (;;) {
+        // Sonlanan uygulama süreçlerini topla; pid bundan sonra yeniden kullanılabilir
+        while ((exited = waitpid(-1, NULL, WNOHANG)) > 0) {
+            for (uint32_t i = 0; i < app_count; i++) {
+                if (apps[i] == exited) {
+                    apps[i] = apps[--app_count];
+                    break;
+                }
+            }
+        }
+        
+        int ready = poll(&poll_fd, 1, 100);
+        if (ready < 0 && errno != EINTR) {
+            break;
+        }
+        if (ready <= 0) {
+            continue;
+        }
+        
+        ssize_t received = recv(control, &message, sizeof(message), 0);
+        if (received == 0) {
+            break;  // Sistem süreci soketi kapattı
+        }
+        if (received != (ssize_t)sizeof(message)) {
+            continue;
+        }
+        
+        memset(&reply, 0, sizeof(reply));
+        
+        if (message.command == ZYGOTE_COMMAND_KILL) {
+            // Toplanmamış çocuk pid'i başka sürece geçmiş olamaz
+            reply.pid = ZYGOTE_ERROR_NOT_FOUND;
+            for (uint32_t i = 0; i < app_count; i++) {
+                if (apps[i] == message.pid) {
+                    reply.pid = kill(message.pid, SIGKILL) == 0 ? 0 : ZYGOTE_ERROR_NOT_FOUND;
+                    break;
+                }
+            }
+            send(control, &reply, sizeof(reply), MSG_NOSIGNAL);
+            continue;
+        }
+        
+        if (message.command != ZYGOTE_COMMAND_FORK) {
+            reply.pid = ZYGOTE_ERROR_INVALID;
+            send(control, &reply, sizeof(reply), MSG_NOSIGNAL);
+            continue;
+        }
+        
+        zygote_request_t* request = &message.request;
+        request->package_name[ZYGOTE_PACKAGE_MAX - 1] = '\0';
+        request->apk_path[ZYGOTE_PATH_MAX - 1] = '\0';
+        
+        // Tablo fork'tan önce büyütülür; kayıt edilemeyen süreç başlatılmaz
+        if (app_count == app_capacity) {
+            uint32_t capacity = app_capacity ? app_capacity * 2 : 64;
+            pid_t* grown = (pid_t*)realloc(apps, sizeof(pid_t) * capacity);
+            if (!grown) {
+                reply.pid = ZYGOTE_ERROR_FORK;
+                send(control, &reply, sizeof(reply), MSG_NOSIGNAL);
+                continue;
+            }
+            apps = grown;
+            app_capacity = capacity;
+        }
+        
+        pid_t pid = fork();
+        if (pid == 0) {
+            // Uygulama süreci: kontrol soketini bırak, zygote ölürse birlikte öl
+            close(control);
+            prctl(PR_SET_PDEATHSIG, SIGKILL, 0, 0, 0);
+            prctl(PR_SET_NAME, request->package_name, 0, 0, 0);
+            _exit(app_main(request, user_data));
+        }
+        
+        if (pid > 0) {
+            apps[app_count++] = pid;
+        }
+        reply.pid = pid > 0 ? pid : ZYGOTE_ERROR_FORK;
+        send(control, &reply, sizeof(reply), MSG_NOSIGNAL);
+    }
+    
+    free(apps);
+    close(control);
+}
+
+// Zygote'a komut gönder ve yanıtı bekle (zygote_lock tutulurken). Yanıt
+// gelmezse istek/yanıt sırası artık güvenilmez; zygote sonlandırılır
+static int zygote_transact(const zygote_message_t* message, zygote_reply_t* reply) {
+    if (zygote_pid <= 0) {
+        return ZYGOTE_ERROR_NOT_RUNNING;
+    }
+    
+    if (send(zygote_socket, message, sizeof(zygote_message_t), MSG_NOSIGNAL) != (ssize_t)sizeof(zygote_message_t)) {
+        zygote_abort();
+        return ZYGOTE_ERROR_NOT_RUNNING;
+    }
+    
+    int result = zygote_receive(zygote_socket, reply, ZYGOTE_REPLY_TIMEOUT_MS);
+    if (result != 0) {
+        zygote_abort();
+    }
+    
+    return result;
+}
+
+// Süre sınırıyla tek yanıt oku
+static int zygote_receive(int socket, zygote_reply_t* reply, int timeout_ms) {
+    struct pollfd poll_fd;
+    uint64_t deadline = zygote_now_us() + (uint64_t)timeout_ms * 1000;
+    
+    poll_fd.fd = socket;
+    poll_fd.events = POLLIN;
+    
+    for (;;) {
+        uint64_t now = zygote_now_us();
+        if (now >= deadline) {
+            return ZYGOTE_ERROR_TIMEOUT;
+        }
+        
+        int ready = poll(&poll_fd, 1, (int)((deadline - now + 999) / 1000));
+        if (ready < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ready < 0) {
+            return ZYGOTE_ERROR_NOT_RUNNING;
+        }
+        if (ready == 0) {
+            return ZYGOTE_ERROR_TIMEOUT;
+        }
+        
+        return recv(socket, reply, sizeof(zygote_reply_t), 0) == (ssize_t)sizeof(zygote_reply_t) ?
+               0 : ZYGOTE_ERROR_NOT_RUNNING;
+    }
+}
+
+// Yanıt vermeyen ya da ölmüş zygote'u kaldır (zygote_lock tutulurken);
+// uygulama süreçleri ebeveyn ölüm sinyaliyle birlikte sonlanır
+static void zygote_abort(void) {
+    kill(zygote_pid, SIGKILL);
+    waitpid(zygote_pid, NULL, 0);
+    close(zygote_socket);
+    
+    zygote_socket = -1;
+    zygote_pid = 0;
+}
+
+// Monoton saat (mikrosaniye)
+static uint64_t zygote_now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
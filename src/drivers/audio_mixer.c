@@ -0,0 +1,810 @@
+#include "../include/audio_mixer.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+
+#if defined(__i386__) || defined(__x86_64__)
+#define AUDIO_MIXER_X86 1
+#include <cpuid.h>
+#include <xmmintrin.h>
+#define AUDIO_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+// Çok fazlı (polyphase) yeniden örnekleyici: 64 faz x 16 katsayı
+#define AUDIO_RESAMPLER_TAPS        16
+#define AUDIO_RESAMPLER_PHASE_BITS  6
+#define AUDIO_RESAMPLER_PHASES      (1 << AUDIO_RESAMPLER_PHASE_BITS)
+#define AUDIO_RESAMPLER_WORK        (AUDIO_RESAMPLER_TAPS + 2 * AUDIO_MIXER_PERIOD_FRAMES)
+#define AUDIO_RING_MASK             (AUDIO_STREAM_RING_FRAMES - 1)
+#define AUDIO_CACHE_LINE            64
+
+// Akış durumları
+#define AUDIO_STREAM_FREE           0
+#define AUDIO_STREAM_ACTIVE         1
+#define AUDIO_STREAM_CLOSING        2
+
+// Ses akışı. Üretici ve karıştırıcının yazdığı alanlar ayrı önbellek satırlarında.
+struct audio_stream {
+    // Üretici tarafı
+    volatile uint32_t write_pos __attribute__((aligned(AUDIO_CACHE_LINE)));
+    uint64_t frames_written;
+    uint64_t overruns;
+    
+    // Karıştırıcı tarafı
+    volatile uint32_t read_pos __attribute__((aligned(AUDIO_CACHE_LINE)));
+    uint64_t underruns;
+    uint8_t playing;               // Son boşalmadan beri veri geldi mi?
+    
+    // Denetim
+    volatile uint32_t state __attribute__((aligned(AUDIO_CACHE_LINE)));
+    volatile uint32_t volume;      // 0-100
+    volatile uint32_t muted;
+    volatile uint32_t paused;
+    char name[AUDIO_STREAM_NAME_MAX];
+    uint32_t sample_rate;
+    uint32_t channels;             // 1 veya 2
+    int16_t* ring;                 // Serpiştirilmiş PCM halkası
+    
+    // Yeniden örnekleyici (yalnızca karıştırıcı kullanır)
+    uint8_t resample;              // Akış hızı aygıt hızından farklı mı?
+    uint64_t step;                 // Çıkış karesi başına giriş adımı (32.32 sabit nokta)
+    uint64_t position;             // Çalışma tamponundaki konum (32.32 sabit nokta)
+    uint32_t buffered;             // Çalışma tamponundaki kare sayısı
+    float filter[AUDIO_RESAMPLER_PHASES * AUDIO_RESAMPLER_TAPS] __attribute__((aligned(16)));
+    float work[2][AUDIO_RESAMPLER_WORK] __attribute__((aligned(16)));
+};
+
+// Karıştırıcı durumu
+static uint8_t mixer_initialized = 0;
+static volatile uint8_t mixer_running = 0;
+static uint32_t mixer_sample_rate = AUDIO_MIXER_DEFAULT_RATE;
+static volatile uint32_t mixer_master_volume = 100;
+static audio_sink_t* mixer_sink = NULL;
+static pthread_t mixer_thread;
+static pthread_mutex_t mixer_control_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t mixer_stats_lock = PTHREAD_MUTEX_INITIALIZER;   // Karıştırıcı iş parçacığı ile okuyucular
+static audio_mixer_stats_t mixer_stats;
+
+// Kayıtlı çıkış aygıtları ve akışlar
+static audio_sink_t* mixer_sinks[AUDIO_DEVICE_COUNT];
+static audio_stream_t mixer_streams[AUDIO_MIXER_MAX_STREAMS];
+
+// Periyot tamponları (yalnızca karıştırıcı kullanır)
+static float mixer_accumulator[AUDIO_MIXER_PERIOD_FRAMES * AUDIO_MIXER_CHANNELS];
+static float mixer_scratch[AUDIO_MIXER_PERIOD_FRAMES * AUDIO_MIXER_CHANNELS];
+static int16_t mixer_output[AUDIO_MIXER_PERIOD_FRAMES * AUDIO_MIXER_CHANNELS];
+
+// Yardımcı işlevler
+static uint64_t audio_now_ns();
+static void audio_build_filter(audio_stream_t* stream);
+static uint32_t audio_stream_pull(audio_stream_t* stream, float* left, float* right, uint32_t max_frames);
+static uint32_t audio_stream_render(audio_stream_t* stream, float* out, uint32_t frames);
+static float audio_dot_scalar(const float* filter, const float* samples);
+static void* audio_mixer_thread(void* arg);
+
+// Çalışma zamanında seçilen iç çarpım çekirdeği
+static float (*audio_dot_impl)(const float*, const float*) = audio_dot_scalar;
+
+// Yerleşik çıkışlar
+static int null_sink_open(audio_sink_t* sink, uint32_t sample_rate, uint32_t channels);
+static int null_sink_write(audio_sink_t* sink, const int16_t* frames, uint32_t frame_count);
+static void null_sink_close(audio_sink_t* sink);
+static int wav_sink_open(audio_sink_t* sink, uint32_t sample_rate, uint32_t channels);
+static int wav_sink_write(audio_sink_t* sink, const int16_t* frames, uint32_t frame_count);
+static void wav_sink_close(audio_sink_t* sink);
+
+static audio_sink_t null_sink = { "null", 0, null_sink_open, null_sink_write, null_sink_close, NULL };
+static audio_sink_t wav_sink = { "wav", 0, wav_sink_open, wav_sink_write, wav_sink_close, NULL };
+static char wav_sink_path[256];
+static uint32_t wav_sink_frames = 0;
+
+#ifdef AUDIO_MIXER_X86
+// 16 katsayılık iç çarpım (SSE)
+AUDIO_TARGET("sse")
+static float audio_dot_sse(const float* filter, const float* samples) {
+    __m128 sum = _mm_mul_ps(_mm_load_ps(filter), _mm_loadu_ps(samples));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_load_ps(filter + 4), _mm_loadu_ps(samples + 4)));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_load_ps(filter + 8), _mm_loadu_ps(samples + 8)));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_load_ps(filter + 12), _mm_loadu_ps(samples + 12)));
+    
+    // Yatay toplam
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+    
+    return _mm_cvtss_f32(sum);
+}
+#endif
+
+// Karıştırıcıyı başlat
+int audio_mixer_init(uint32_t sample_rate, audio_device_type_t device, const char* wav_path) {
+    if (sample_rate < 8000 || sample_rate > 192000 || device >= AUDIO_DEVICE_COUNT) {
+        return -1;
+    }
+    
+    pthread_mutex_lock(&mixer_control_lock);
+    
+    // Zaten başlatıldıysa
+    if (mixer_initialized) {
+        pthread_mutex_unlock(&mixer_control_lock);
+        return 0;
+    }
+    
+    // Çıkış aygıtını seç
+    audio_sink_t* sink = NULL;
+    if (device == AUDIO_DEVICE_AUTO) {
+        for (int i = AUDIO_DEVICE_HDA; i >= AUDIO_DEVICE_SB16 && !sink; i--) {
+            sink = mixer_sinks[i];
+        }
+        if (!sink) {
+            sink = &null_sink;
+        }
+    } else if (device == AUDIO_DEVICE_NULL) {
+        sink = &null_sink;
+    } else if (device == AUDIO_DEVICE_WAV) {
+        if (!wav_path) {
+            pthread_mutex_unlock(&mixer_control_lock);
+            return -1;
+        }
+        strncpy(wav_sink_path, wav_path, sizeof(wav_sink_path) - 1);
+        wav_sink_path[sizeof(wav_sink_path) - 1] = '\0';
+        sink = &wav_sink;
+    } else {
+        // Donanım sürücüsü kayıtlı değil
+        sink = mixer_sinks[device];
+        if (!sink) {
+            pthread_mutex_unlock(&mixer_control_lock);
+            return -2;
+        }
+    }
+    
+    if (sink->open(sink, sample_rate, AUDIO_MIXER_CHANNELS) != 0) {
+        pthread_mutex_unlock(&mixer_control_lock);
+        return -3;
+    }
+    
+    // SIMD çekirdeğini seç
+    audio_dot_impl = audio_dot_scalar;
+    
+#ifdef AUDIO_MIXER_X86
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (edx & bit_SSE)) {
+        audio_dot_impl = audio_dot_sse;
+    }
+#endif
+    
+    mixer_sink = sink;
+    mixer_sample_rate = sample_rate;
+    mixer_master_volume = 100;
+    
+    pthread_mutex_lock(&mixer_stats_lock);
+    memset(&mixer_stats, 0, sizeof(mixer_stats));
+    mixer_stats.simd = (audio_dot_impl != audio_dot_scalar);
+    mixer_stats.sample_rate = sample_rate;
+    mixer_stats.period_frames = AUDIO_MIXER_PERIOD_FRAMES;
+    pthread_mutex_unlock(&mixer_stats_lock);
+    
+    mixer_initialized = 1;
+    
+    pthread_mutex_unlock(&mixer_control_lock);
+    
+    return 0;
+}
+
+// Donanım çıkış sürücüsü kaydet (SB16, AC'97, HDA)
+int audio_mixer_register_sink(audio_device_type_t device, audio_sink_t* sink) {
+    if (device < AUDIO_DEVICE_SB16 || device >= AUDIO_DEVICE_COUNT ||
+        !sink || !sink->open || !sink->write || !sink->close) {
+        return -1;
+    }
+    
+    pthread_mutex_lock(&mixer_control_lock);
+    mixer_sinks[device] = sink;
+    pthread_mutex_unlock(&mixer_control_lock);
+    
+    return 0;
+}
+
+// Gerçek zamanlı karıştırma iş parçacığını başlat
+int audio_mixer_start() {
+    pthread_mutex_lock(&mixer_control_lock);
+    
+    if (!mixer_initialized) {
+        pthread_mutex_unlock(&mixer_control_lock);
+        return -1;
+    }
+    
+    if (mixer_running) {
+        pthread_mutex_unlock(&mixer_control_lock);
+        return 0;
+    }
+    
+    mixer_running = 1;
+    
+    // Önce SCHED_FIFO dene; yetki yoksa normal önceliğe düş
+    pthread_attr_t attr;
+    struct sched_param param;
+    pthread_attr_init(&attr);
+    pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+    pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+    param.sched_priority = sched_get_priority_max(SCHED_FIFO) - 1;
+    pthread_attr_setschedparam(&attr, &param);
+    
+    int result = pthread_create(&mixer_thread, &attr, audio_mixer_thread, NULL);
+    pthread_attr_destroy(&attr);
+    
+    if (result != 0) {
+        result = pthread_create(&mixer_thread, NULL, audio_mixer_thread, NULL);
+    }
+    
+    if (result != 0) {
+        mixer_running = 0;
+        pthread_mutex_unlock(&mixer_control_lock);
+        return -2;
+    }
+    
+    pthread_mutex_unlock(&mixer_control_lock);
+    
+    return 0;
+}
+
+// Karıştırma iş parçacığını durdur
+int audio_mixer_stop() {
+    pthread_mutex_lock(&mixer_control_lock);
+    
+    if (!mixer_running) {
+        pthread_mutex_unlock(&mixer_control_lock);
+        return 0;
+    }
+    
+    mixer_running = 0;
+    pthread_mutex_unlock(&mixer_control_lock);
+    
+    pthread_join(mixer_thread, NULL);
+    
+    return 0;
+}
+
+// Karıştırıcıyı kapat; açık akışlar serbest bırakılır
+int audio_mixer_shutdown() {
+    audio_mixer_stop();
+    
+    pthread_mutex_lock(&mixer_control_lock);
+    
+    if (mixer_initialized) {
+        mixer_sink->close(mixer_sink);
+        mixer_sink = NULL;
+        
+        for (uint32_t i = 0; i < AUDIO_MIXER_MAX_STREAMS; i++) {
+            free(mixer_streams[i].ring);
+            memset(&mixer_streams[i], 0, sizeof(audio_stream_t));
+        }
+        
+        mixer_initialized = 0;
+    }
+    
+    pthread_mutex_unlock(&mixer_control_lock);
+    
+    return 0;
+}
+
+// Karıştırıcı başlatıldı mı?
+uint8_t audio_mixer_is_initialized() {
+    return mixer_initialized;
+}
+
+// Tek bir periyodu karıştır ve çıkışa yaz. İş parçacığı çalışmıyorsa
+// testler bu işlevi doğrudan çağırabilir.
+int audio_mixer_mix_period() {
+    if (!mixer_initialized) {
+        return -1;
+    }
+    
+    uint64_t start = audio_now_ns();
+    uint32_t samples = AUDIO_MIXER_PERIOD_FRAMES * AUDIO_MIXER_CHANNELS;
+    uint32_t active = 0;
+    uint32_t underruns = 0;
+    float master = (float)mixer_master_volume / 100.0f;
+    
+    memset(mixer_accumulator, 0, sizeof(mixer_accumulator));
+    
+    for (uint32_t i = 0; i < AUDIO_MIXER_MAX_STREAMS; i++) {
+        audio_stream_t* stream = &mixer_streams[i];
+        uint32_t state = __atomic_load_n(&stream->state, __ATOMIC_ACQUIRE);
+        
+        // Kapatılan akışın yuvası yeniden kullanılabilir
+        if (state == AUDIO_STREAM_CLOSING) {
+            __atomic_store_n(&stream->state, AUDIO_STREAM_FREE, __ATOMIC_RELEASE);
+            continue;
+        }
+        
+        if (state != AUDIO_STREAM_ACTIVE) {
+            continue;
+        }
+        
+        // Duraklatılan akış açık kalır ama çalan akış sayılmaz
+        if (stream->paused) {
+            continue;
+        }
+        active++;
+        
+        uint32_t frames = audio_stream_render(stream, mixer_scratch, AUDIO_MIXER_PERIOD_FRAMES);
+        
+        // Çalan akış periyodu dolduramadıysa boşalma (her kuruma bir kez sayılır)
+        if (frames == AUDIO_MIXER_PERIOD_FRAMES) {
+            stream->playing = 1;
+        } else if (stream->playing) {
+            stream->playing = 0;
+            stream->underruns++;
+            underruns++;
+        }
+        
+        if (stream->muted || frames == 0) {
+            continue;
+        }
+        
+        // Algılanan ses yüksekliğine yakın olması için karesel eğri
+        float gain = (float)stream->volume / 100.0f;
+        gain = gain * gain * master;
+        
+        for (uint32_t s = 0; s < frames * AUDIO_MIXER_CHANNELS; s++) {
+            mixer_accumulator[s] += mixer_scratch[s] * gain;
+        }
+    }
+    
+    // 16 bit'e kırparak dönüştür
+    for (uint32_t s = 0; s < samples; s++) {
+        float value = mixer_accumulator[s];
+        value = (value > 32767.0f) ? 32767.0f : ((value < -32768.0f) ? -32768.0f : value);
+        mixer_output[s] = (int16_t)lrintf(value);
+    }
+    
+    // İstatistikler periyot başına bir kez, kısa bir kilitle yayımlanır
+    uint64_t elapsed = audio_now_ns() - start;
+    pthread_mutex_lock(&mixer_stats_lock);
+    mixer_stats.mix_time_last_ns = elapsed;
+    mixer_stats.mix_time_total_ns += elapsed;
+    if (elapsed > mixer_stats.mix_time_max_ns) {
+        mixer_stats.mix_time_max_ns = elapsed;
+    }
+    mixer_stats.active_streams = active;
+    mixer_stats.underruns += underruns;
+    mixer_stats.periods_mixed++;
+    pthread_mutex_unlock(&mixer_stats_lock);
+    
+    return mixer_sink->write(mixer_sink, mixer_output, AUDIO_MIXER_PERIOD_FRAMES);
+}
+
+// Ana ses seviyesini ayarla
+int audio_mixer_set_master_volume(uint8_t volume) {
+    mixer_master_volume = (volume > 100) ? 100 : volume;
+    return 0;
+}
+
+// Karıştırıcı istatistiklerini al
+int audio_mixer_get_stats(audio_mixer_stats_t* stats) {
+    if (!stats) {
+        return -1;
+    }
+    
+    // Karıştırıcı iş parçacığı yazarken yarım güncellenmiş kopya alınmasın
+    pthread_mutex_lock(&mixer_stats_lock);
+    *stats = mixer_stats;
+    pthread_mutex_unlock(&mixer_stats_lock);
+    
+    return 0;
+}
+
+// Yeni akış aç. Karıştırıcı başlatılmamışsa varsayılan aygıtla başlatılır.
+audio_stream_t* audio_stream_open(const char* name, uint32_t sample_rate, uint32_t channels) {
+    if (sample_rate < 8000 || sample_rate > 192000 || channels < 1 || channels > 2) {
+        return NULL;
+    }
+    
+    if (!mixer_initialized) {
+        if (audio_mixer_init(AUDIO_MIXER_DEFAULT_RATE, AUDIO_DEVICE_AUTO, NULL) != 0 ||
+            audio_mixer_start() != 0) {
+            return NULL;
+        }
+    }
+    
+    pthread_mutex_lock(&mixer_control_lock);
+    
+    // Boş yuva bul (karıştırıcı yalnızca etkin ve kapanan yuvalara dokunur)
+    audio_stream_t* stream = NULL;
+    for (uint32_t i = 0; i < AUDIO_MIXER_MAX_STREAMS && !stream; i++) {
+        if (__atomic_load_n(&mixer_streams[i].state, __ATOMIC_ACQUIRE) == AUDIO_STREAM_FREE) {
+            stream = &mixer_streams[i];
+        }
+    }
+    
+    if (!stream) {
+        pthread_mutex_unlock(&mixer_control_lock);
+        return NULL;
+    }
+    
+    // Halka belleği yuvayla birlikte yeniden kullanılır
+    if (!stream->ring) {
+        stream->ring = (int16_t*)malloc(AUDIO_STREAM_RING_FRAMES * 2 * sizeof(int16_t));
+        if (!stream->ring) {
+            pthread_mutex_unlock(&mixer_control_lock);
+            return NULL;
+        }
+    }
+    
+    stream->write_pos = 0;
+    stream->read_pos = 0;
+    stream->frames_written = 0;
+    stream->overruns = 0;
+    stream->underruns = 0;
+    stream->playing = 0;
+    stream->volume = 100;
+    stream->muted = 0;
+    stream->paused = 0;
+    strncpy(stream->name, name ? name : "", AUDIO_STREAM_NAME_MAX - 1);
+    stream->name[AUDIO_STREAM_NAME_MAX - 1] = '\0';
+    stream->sample_rate = sample_rate;
+    stream->channels = channels;
+    
+    // Yeniden örnekleyici durumu
+    stream->resample = (sample_rate != mixer_sample_rate);
+    stream->step = ((uint64_t)sample_rate << 32) / mixer_sample_rate;
+    stream->position = 0;
+    stream->buffered = AUDIO_RESAMPLER_TAPS - 1;
+    memset(stream->work, 0, sizeof(stream->work));
+    if (stream->resample) {
+        audio_build_filter(stream);
+    }
+    
+    __atomic_store_n(&stream->state, AUDIO_STREAM_ACTIVE, __ATOMIC_RELEASE);
+    
+    pthread_mutex_unlock(&mixer_control_lock);
+    
+    return stream;
+}
+
+// Akışı kapat. Yuvayı karıştırıcı bir sonraki periyotta serbest bırakır.
+int audio_stream_close(audio_stream_t* stream) {
+    if (!stream) {
+        return -1;
+    }
+    
+    pthread_mutex_lock(&mixer_control_lock);
+    __atomic_store_n(&stream->state, mixer_running ? AUDIO_STREAM_CLOSING : AUDIO_STREAM_FREE,
+                     __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&mixer_control_lock);
+    
+    return 0;
+}
+
+// Akışa serpiştirilmiş PCM kareleri yaz (tek üretici). Engellemez; halkaya
+// sığan kare sayısı döner.
+int audio_stream_write(audio_stream_t* stream, const int16_t* frames, uint32_t frame_count) {
+    if (!stream || (!frames && frame_count > 0)) {
+        return -1;
+    }
+    
+    uint32_t write_pos = stream->write_pos;
+    uint32_t read_pos = __atomic_load_n(&stream->read_pos, __ATOMIC_ACQUIRE);
+    uint32_t space = AUDIO_STREAM_RING_FRAMES - (write_pos - read_pos);
+    uint32_t count = (frame_count < space) ? frame_count : space;
+    
+    if (count < frame_count) {
+        stream->overruns++;
+    }
+    
+    // Halka sonunda ikiye bölünebilir
+    uint32_t first = AUDIO_STREAM_RING_FRAMES - (write_pos & AUDIO_RING_MASK);
+    if (first > count) {
+        first = count;
+    }
+    
+    memcpy(stream->ring + (write_pos & AUDIO_RING_MASK) * stream->channels, frames,
+           first * stream->channels * sizeof(int16_t));
+    memcpy(stream->ring, frames + first * stream->channels,
+           (count - first) * stream->channels * sizeof(int16_t));
+    
+    __atomic_store_n(&stream->write_pos, write_pos + count, __ATOMIC_RELEASE);
+    stream->frames_written += count;
+    
+    return (int)count;
+}
+
+// Akış ses seviyesini ayarla (0-100)
+int audio_stream_set_volume(audio_stream_t* stream, uint8_t volume) {
+    if (!stream) {
+        return -1;
+    }
+    
+    stream->volume = (volume > 100) ? 100 : volume;
+    return 0;
+}
+
+// Akışı sessize al
+int audio_stream_set_muted(audio_stream_t* stream, uint8_t muted) {
+    if (!stream) {
+        return -1;
+    }
+    
+    stream->muted = muted ? 1 : 0;
+    return 0;
+}
+
+// Akışı duraklat; duraklatılan akış boşalma sayılmaz
+int audio_stream_set_paused(audio_stream_t* stream, uint8_t paused) {
+    if (!stream) {
+        return -1;
+    }
+    
+    stream->paused = paused ? 1 : 0;
+    return 0;
+}
+
+// Akış istatistiklerini al
+int audio_stream_get_stats(audio_stream_t* stream, audio_stream_stats_t* stats) {
+    if (!stream || !stats) {
+        return -1;
+    }
+    
+    stats->frames_written = stream->frames_written;
+    stats->overruns = stream->overruns;
+    stats->underruns = stream->underruns;
+    
+    return 0;
+}
+
+// Monoton saat (nanosaniye)
+static uint64_t audio_now_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// Blackman pencereli sinc katsayıları. Her faz, çıkış örneğinin iki giriş
+// örneği arasındaki kesirli konumuna karşılık gelir; alçaltmada kesim frekansı
+// düşürülerek örtüşme önlenir.
+static void audio_build_filter(audio_stream_t* stream) {
+    double cutoff = 0.92;
+    if (stream->sample_rate > mixer_sample_rate) {
+        cutoff *= (double)mixer_sample_rate / stream->sample_rate;
+    }
+    
+    double half = AUDIO_RESAMPLER_TAPS / 2.0;
+    
+    for (uint32_t phase = 0; phase < AUDIO_RESAMPLER_PHASES; phase++) {
+        float* taps = &stream->filter[phase * AUDIO_RESAMPLER_TAPS];
+        double fraction = (double)phase / AUDIO_RESAMPLER_PHASES;
+        double sum = 0.0;
+        
+        for (uint32_t k = 0; k < AUDIO_RESAMPLER_TAPS; k++) {
+            double distance = (double)k - (half - 1.0) - fraction;
+            double x = M_PI * cutoff * distance;
+            double sinc = (fabs(x) < 1e-9) ? 1.0 : sin(x) / x;
+            double window = 0.42 + 0.5 * cos(M_PI * distance / half) + 0.08 * cos(2.0 * M_PI * distance / half);
+            double value = cutoff * sinc * window;
+            
+            taps[k] = (float)value;
+            sum += value;
+        }
+        
+        // Birim kazanç
+        for (uint32_t k = 0; k < AUDIO_RESAMPLER_TAPS; k++) {
+            taps[k] = (float)(taps[k] / sum);
+        }
+    }
+}
+
+// Halkadan en fazla 'max_frames' kare oku ve kanallara ayır (tek tüketici)
+static uint32_t audio_stream_pull(audio_stream_t* stream, float* left, float* right, uint32_t max_frames) {
+    uint32_t read_pos = stream->read_pos;
+    uint32_t available = __atomic_load_n(&stream->write_pos, __ATOMIC_ACQUIRE) - read_pos;
+    uint32_t count = (available < max_frames) ? available : max_frames;
+    
+    if (stream->channels == 2) {
+        for (uint32_t i = 0; i < count; i++) {
+            const int16_t* frame = stream->ring + ((read_pos + i) & AUDIO_RING_MASK) * 2;
+            left[i] = frame[0];
+            right[i] = frame[1];
+        }
+    } else {
+        for (uint32_t i = 0; i < count; i++) {
+            left[i] = right[i] = stream->ring[(read_pos + i) & AUDIO_RING_MASK];
+        }
+    }
+    
+    __atomic_store_n(&stream->read_pos, read_pos + count, __ATOMIC_RELEASE);
+    
+    return count;
+}
+
+// Akıştan aygıt hızında en fazla 'frames' stereo kare üret
+static uint32_t audio_stream_render(audio_stream_t* stream, float* out, uint32_t frames) {
+    float* left = stream->work[0];
+    float* right = stream->work[1];
+    
+    // Aynı hız: yalnızca biçim dönüşümü
+    if (!stream->resample) {
+        uint32_t count = audio_stream_pull(stream, left, right, frames);
+        for (uint32_t i = 0; i < count; i++) {
+            out[i * 2] = left[i];
+            out[i * 2 + 1] = right[i];
+        }
+        return count;
+    }
+    
+    uint32_t produced = 0;
+    
+    while (produced < frames) {
+        uint32_t index = (uint32_t)(stream->position >> 32);
+        
+        if (index + AUDIO_RESAMPLER_TAPS > stream->buffered) {
+            // Tüketilen kareleri at, halkadan yenilerini çek
+            uint32_t discard = (index < stream->buffered) ? index : stream->buffered;
+            memmove(left, left + discard, (stream->buffered - discard) * sizeof(float));
+            memmove(right, right + discard, (stream->buffered - discard) * sizeof(float));
+            stream->buffered -= discard;
+            stream->position -= (uint64_t)discard << 32;
+            
+            stream->buffered += audio_stream_pull(stream, left + stream->buffered, right + stream->buffered,
+                                                  AUDIO_RESAMPLER_WORK - stream->buffered);
+            
+            // Giriş bitti
+            if ((uint32_t)(stream->position >> 32) + AUDIO_RESAMPLER_TAPS > stream->buffered) {
+                break;
+            }
+            continue;
+        }
+        
+        const float* taps = &stream->filter[((uint32_t)stream->position >> (32 - AUDIO_RESAMPLER_PHASE_BITS)) *
+                                            AUDIO_RESAMPLER_TAPS];
+        float sample_left = audio_dot_impl(taps, left + index);
+        
+        out[produced * 2] = sample_left;
+        out[produced * 2 + 1] = (stream->channels == 2) ? audio_dot_impl(taps, right + index) : sample_left;
+        
+        produced++;
+        stream->position += stream->step;
+    }
+    
+    return produced;
+}
+
+// 16 katsayılık iç çarpım (taşınabilir C)
+static float audio_dot_scalar(const float* filter, const float* samples) {
+    float sum = 0.0f;
+    
+    for (uint32_t k = 0; k < AUDIO_RESAMPLER_TAPS; k++) {
+        sum += filter[k] * samples[k];
+    }
+    
+    return sum;
+}
+
+// Karıştırma iş parçacığı: her periyotu mutlak zaman çizelgesine göre üretir.
+// Engelleyen aygıtlarda zamanlamayı aygıtın DMA tamponu belirler.
+static void* audio_mixer_thread(void* arg) {
+    (void)arg;
+    
+    uint64_t period_ns = (uint64_t)AUDIO_MIXER_PERIOD_FRAMES * 1000000000ULL / mixer_sample_rate;
+    uint64_t next = audio_now_ns();
+    
+    while (mixer_running) {
+        audio_mixer_mix_period();
+        
+        if (mixer_sink->blocking) {
+            continue;
+        }
+        
+        next += period_ns;
+        uint64_t now = audio_now_ns();
+        
+        // Bir periyottan fazla geride kalındıysa çizelgeyi yeniden kur
+        if (now > next + period_ns) {
+            pthread_mutex_lock(&mixer_stats_lock);
+            mixer_stats.late_periods++;
+            pthread_mutex_unlock(&mixer_stats_lock);
+            next = now;
+            continue;
+        }
+        
+        struct timespec deadline;
+        deadline.tv_sec = (time_t)(next / 1000000000ULL);
+        deadline.tv_nsec = (long)(next % 1000000000ULL);
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL);
+    }
+    
+    return NULL;
+}
+
+// Boş çıkış
+static int null_sink_open(audio_sink_t* sink, uint32_t sample_rate, uint32_t channels) {
+    (void)sink; (void)sample_rate; (void)channels;
+    return 0;
+}
+
+static int null_sink_write(audio_sink_t* sink, const int16_t* frames, uint32_t frame_count) {
+    (void)sink; (void)frames; (void)frame_count;
+    return 0;
+}
+
+static void null_sink_close(audio_sink_t* sink) {
+    (void)sink;
+}
+
+// Küçük uçlu 16/32 bit değer yaz
+static void wav_put16(uint8_t* p, uint16_t value) {
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+}
+
+static void wav_put32(uint8_t* p, uint32_t value) {
+    wav_put16(p, (uint16_t)value);
+    wav_put16(p + 2, (uint16_t)(value >> 16));
+}
+
+// WAV başlığı (boyutlar dosya kapatılırken düzeltilir)
+static void wav_write_header(FILE* file, uint32_t sample_rate, uint32_t channels, uint32_t frames) {
+    uint8_t header[44];
+    uint32_t data_size = frames * channels * sizeof(int16_t);
+    
+    memcpy(header, "RIFF", 4);
+    wav_put32(header + 4, 36 + data_size);
+    memcpy(header + 8, "WAVEfmt ", 8);
+    wav_put32(header + 16, 16);
+    wav_put16(header + 20, 1);
+    wav_put16(header + 22, (uint16_t)channels);
+    wav_put32(header + 24, sample_rate);
+    wav_put32(header + 28, sample_rate * channels * sizeof(int16_t));
+    wav_put16(header + 32, (uint16_t)(channels * sizeof(int16_t)));
+    wav_put16(header + 34, 16);
+    memcpy(header + 36, "data", 4);
+    wav_put32(header + 40, data_size);
+    
+    fseek(file, 0, SEEK_SET);
+    fwrite(header, 1, sizeof(header), file);
+}
+
+// WAV dosyası çıkışı
+static int wav_sink_open(audio_sink_t* sink, uint32_t sample_rate, uint32_t channels) {
+    FILE* file = fopen(wav_sink_path, "wb");
+    if (!file) {
+        return -1;
+    }
+    
+    wav_sink_frames = 0;
+    wav_write_header(file, sample_rate, channels, 0);
+    sink->private_data = file;
+    
+    return 0;
+}
+
+static int wav_sink_write(audio_sink_t* sink, const int16_t* frames, uint32_t frame_count) {
+    FILE* file = (FILE*)sink->private_data;
+    if (!file) {
+        return -1;
+    }
+    
+    if (fwrite(frames, AUDIO_MIXER_CHANNELS * sizeof(int16_t), frame_count, file) != frame_count) {
+        return -1;
+    }
+    
+    wav_sink_frames += frame_count;
+    
+    return 0;
+}
+
+static void wav_sink_close(audio_sink_t* sink) {
+    FILE* file = (FILE*)sink->private_data;
+    if (!file) {
+        return;
+    }
+    
+    wav_write_header(file, mixer_sample_rate, AUDIO_MIXER_CHANNELS, wav_sink_frames);
+    fclose(file);
+    sink->private_data = NULL;
+}
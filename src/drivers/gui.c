@@ -1,6 +1,7 @@
 #include "../include/gui.h"
 #include "../include/vga.h"
 #include "../include/font.h"
+#include "../include/pixel_format.h"
 #include "../include/context_menu.h"
 #include "../include/desktop.h"
 #include "../include/taskbar.h"
@@ -327,6 +328,44 @@ void gui_window_draw_client(gui_window_t* window) {
     if (window->on_paint) {
         window->on_paint(window);
     }
+    
+    // Harici arka tampon varsa doğrudan göster
+    if (window->backing_store) {
+        gui_window_draw_backing_store(window, 0);
+    }
+}
+
+// Pencere içeriğini güncelle (ör. yeni kare sunulduğunda).
+// Arka tamponlu pencerelerde yalnızca değişen bölgeler çizilir.
+void gui_window_invalidate(gui_window_t* window) {
+    if (!window || !window->visible || window->minimized) return;
+    
+    if (window->on_paint) {
+        window->on_paint(window);
+    }
+    
+    if (window->backing_store) {
+        gui_window_draw_backing_store(window, 1);
+    }
+}
+
+// Pencere güncellemesini GUI döngüsüne bırak. Çizim yapan iş parçacıkları
+// (ör. Android yüzeyi) pencereye doğrudan çizmez; yalnızca bayrak kurulur.
+void gui_window_post_invalidate(gui_window_t* window) {
+    if (!window) return;
+    
+    __atomic_store_n(&window->invalidate_pending, 1, __ATOMIC_RELEASE);
+}
+
+// Bekleyen pencere güncellemelerini uygula (GUI döngüsünden çağrılır)
+void gui_process_invalidations() {
+    gui_window_t* window = gui_window_list;
+    while (window) {
+        if (__atomic_exchange_n(&window->invalidate_pending, 0, __ATOMIC_ACQ_REL)) {
+            gui_window_invalidate(window);
+        }
+        window = window->next;
+    }
 }
 
 // Belirli bir koordinattaki pencereyi bul
@@ -454,6 +493,7 @@ void gui_handle_mouse_event(uint32_t x, uint32_t y, uint8_t button_state) {
     static gui_window_t* drag_window = NULL;
     static uint32_t drag_offset_x = 0;
     static uint32_t drag_offset_y = 0;
+    static gui_window_t* resize_window = NULL;
     
     // Fare pozisyonunu güncelle
     gui_desktop->mouse_x = x;
@@ -491,8 +531,17 @@ void gui_handle_mouse_event(uint32_t x, uint32_t y, uint8_t button_state) {
         // Pencere tıklaması
         gui_window_t* window = gui_window_find_at(x, y);
         if (window) {
-            // Pencere başlık çubuğu tıklaması
-            if (y >= window->y && y < window->y + GUI_WINDOW_TITLE_HEIGHT) {
+            // Sağ alt köşedeki tutamaç: boyutlandırma sürüklemesi. Ara boyutlar
+            // her harekette bildirilir; işleyici pahalı işleri sona bırakabilir.
+            if (window->resizable &&
+                x >= window->x + window->width - GUI_WINDOW_RESIZE_GRIP &&
+                y >= window->y + window->height - GUI_WINDOW_RESIZE_GRIP) {
+                resize_window = window;
+                if (window->on_resize_drag) {
+                    window->on_resize_drag(window, 1);
+                }
+            } else if (y >= window->y && y < window->y + GUI_WINDOW_TITLE_HEIGHT) {
+                // Pencere başlık çubuğu tıklaması
                 dragging = 1;
                 drag_window = window;
                 drag_offset_x = x - window->x;
@@ -524,6 +573,14 @@ void gui_handle_mouse_event(uint32_t x, uint32_t y, uint8_t button_state) {
             dragging = 0;
             drag_window = NULL;
         }
+        
+        if (resize_window) {
+            gui_window_t* window = resize_window;
+            resize_window = NULL;
+            if (window->on_resize_drag) {
+                window->on_resize_drag(window, 0);
+            }
+        }
     }
     
     // Sağ tıklama olayı (basıldı)
@@ -580,6 +637,25 @@ void gui_handle_mouse_event(uint32_t x, uint32_t y, uint8_t button_state) {
         gui_window_move(drag_window, new_x, new_y);
     }
     
+    // Boyutlandırma sürüklemesi
+    if (resize_window && (button_state & 1) && (x != prev_x || y != prev_y)) {
+        uint32_t new_width = (x > resize_window->x) ? x - resize_window->x + 1 : 0;
+        uint32_t new_height = (y > resize_window->y) ? y - resize_window->y + 1 : 0;
+        
+        if (new_width < GUI_WINDOW_MIN_WIDTH) new_width = GUI_WINDOW_MIN_WIDTH;
+        if (new_height < GUI_WINDOW_MIN_HEIGHT) new_height = GUI_WINDOW_MIN_HEIGHT;
+        if (resize_window->x + new_width > gui_desktop->width) {
+            new_width = gui_desktop->width - resize_window->x;
+        }
+        if (resize_window->y + new_height > gui_desktop->height) {
+            new_height = gui_desktop->height - resize_window->y;
+        }
+        
+        if (new_width != resize_window->width || new_height != resize_window->height) {
+            gui_window_resize(resize_window, new_width, new_height);
+        }
+    }
+    
     // Durumu güncelle
     prev_button_state = button_state;
     prev_x = x;
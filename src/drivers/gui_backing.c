@@ -0,0 +1,91 @@
+// Harici arka tamponun (ör. Android yüzeyi) çerçeve tamponuna dönüştürülmesi.
+// Masaüstünden bağımsız tutulur; köprünün hasar ölçümü de aynı kodu kullanır.
+#include "../include/gui.h"
+#include "../include/vga.h"
+#include "../include/pixel_format.h"
+#include <stdint.h>
+
+// Arka tamponun bir bölgesini palete dönüştürüp doğrudan çerçeve tamponuna yaz
+static void gui_window_blit_backing_store(gui_window_t* window, uint32_t x, uint32_t y,
+                                          uint32_t width, uint32_t height) {
+    uint32_t screen_x = window->x + window->client.x + x;
+    uint32_t screen_y = window->y + window->client.y + y;
+    
+    // Ekran dışına taşan kısmı kırp
+    if (screen_x >= vga_width || screen_y >= vga_height) return;
+    if (width > vga_width - screen_x) width = vga_width - screen_x;
+    if (height > vga_height - screen_y) height = vga_height - screen_y;
+    
+    for (uint32_t row = 0; row < height; row++) {
+        const uint32_t* src = window->backing_store + (y + row) * window->backing_stride + x;
+        uint8_t* dst = vga_framebuffer + (screen_y + row) * vga_width + screen_x;
+        
+        pixel_argb_to_indexed(dst, src, width, screen_x, screen_y + row, 1);
+    }
+    
+    window->backing_bytes_converted += width * height * sizeof(uint32_t);
+}
+
+// Harici arka tamponu içerik alanına çiz.
+// Kısmi çizimde yalnızca hasar dikdörtgenlerinin kapsadığı karolar dönüştürülür.
+void gui_window_draw_backing_store(gui_window_t* window, uint8_t partial) {
+    uint32_t width = (window->backing_width < window->client.width) ? 
+                     window->backing_width : window->client.width;
+    uint32_t height = (window->backing_height < window->client.height) ? 
+                      window->backing_height : window->client.height;
+    
+    if (width == 0 || height == 0) return;
+    
+    if (!partial || window->backing_full_damage) {
+        gui_window_blit_backing_store(window, 0, 0, width, height);
+        return;
+    }
+    
+    // Örtüşen dikdörtgenler aynı karoyu iki kez çizmesin diye karo haritası oluştur
+    uint64_t tiles[GUI_DAMAGE_MAX_TILES] = {0};
+    uint32_t last_tile_x = (width - 1) / GUI_DAMAGE_TILE_SIZE;
+    uint32_t last_tile_y = (height - 1) / GUI_DAMAGE_TILE_SIZE;
+    
+    if (last_tile_x >= GUI_DAMAGE_MAX_TILES) last_tile_x = GUI_DAMAGE_MAX_TILES - 1;
+    if (last_tile_y >= GUI_DAMAGE_MAX_TILES) last_tile_y = GUI_DAMAGE_MAX_TILES - 1;
+    
+    for (uint8_t i = 0; i < window->backing_damage_count; i++) {
+        gui_rect_t* rect = &window->backing_damage[i];
+        
+        if (rect->width == 0 || rect->height == 0) continue;
+        if (rect->x >= width || rect->y >= height) continue;
+        
+        uint32_t tx1 = rect->x / GUI_DAMAGE_TILE_SIZE;
+        uint32_t ty1 = rect->y / GUI_DAMAGE_TILE_SIZE;
+        uint32_t tx2 = (rect->x + rect->width - 1) / GUI_DAMAGE_TILE_SIZE;
+        uint32_t ty2 = (rect->y + rect->height - 1) / GUI_DAMAGE_TILE_SIZE;
+        
+        if (tx1 > last_tile_x) tx1 = last_tile_x;
+        if (ty1 > last_tile_y) ty1 = last_tile_y;
+        if (tx2 > last_tile_x) tx2 = last_tile_x;
+        if (ty2 > last_tile_y) ty2 = last_tile_y;
+        
+        for (uint32_t ty = ty1; ty <= ty2; ty++) {
+            for (uint32_t tx = tx1; tx <= tx2; tx++) {
+                tiles[ty] |= (1ULL << tx);
+            }
+        }
+    }
+    
+    // İşaretli karoları çiz (son karo satırı/sütunu tamponun sonuna kadar uzanır)
+    for (uint32_t ty = 0; ty <= last_tile_y; ty++) {
+        if (!tiles[ty]) continue;
+        
+        uint32_t tile_y = ty * GUI_DAMAGE_TILE_SIZE;
+        uint32_t tile_h = (ty == last_tile_y) ? height - tile_y : GUI_DAMAGE_TILE_SIZE;
+        
+        for (uint32_t tx = 0; tx <= last_tile_x; tx++) {
+            if (!(tiles[ty] & (1ULL << tx))) continue;
+            
+            uint32_t tile_x = tx * GUI_DAMAGE_TILE_SIZE;
+            uint32_t tile_w = (tx == last_tile_x) ? width - tile_x : GUI_DAMAGE_TILE_SIZE;
+            
+            gui_window_blit_backing_store(window, tile_x, tile_y, tile_w, tile_h);
+        }
+    }
+}
@@ -0,0 +1,438 @@
+#include "../include/pixel_format.h"
+#include <stdint.h>
+
+#if defined(__i386__) || defined(__x86_64__)
+#define PIXEL_FORMAT_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#define PIXEL_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+// Ters palet tablosu (RGB555 -> palet indeksi)
+static uint8_t pixel_palette_lut[PIXEL_PALETTE_LUT_SIZE];
+
+// 4x4 Bayer eşik matrisi (0..15)
+static const uint8_t pixel_bayer4[4][4] = {
+    {  0,  8,  2, 10 },
+    { 12,  4, 14,  6 },
+    {  3, 11,  1,  9 },
+    { 15,  7, 13,  5 }
+};
+
+// Titreme ofseti (-30..+30); seyrek palette renk adımına yakın tutulur
+#define PIXEL_DITHER_OFFSET(x, y) ((int32_t)pixel_bayer4[(y) & 3][(x) & 3] * 4 - 30)
+
+// Seçilen komut seti
+static pixel_isa_t pixel_isa = PIXEL_ISA_SCALAR;
+
+// Skaler çekirdekler
+static void argb_to_rgb565_scalar(uint16_t* dst, const uint32_t* src, uint32_t count);
+static void argb_to_bgrx_scalar(uint32_t* dst, const uint32_t* src, uint32_t count);
+static void argb_to_indexed_scalar(uint8_t* dst, const uint32_t* src, uint32_t count, 
+                                   uint32_t x, uint32_t y, uint8_t dither);
+static void premultiply_scalar(uint32_t* dst, const uint32_t* src, uint32_t count);
+static void unpremultiply_scalar(uint32_t* dst, const uint32_t* src, uint32_t count);
+
+// Çalışma zamanında seçilen çekirdekler
+static void (*argb_to_rgb565_impl)(uint16_t*, const uint32_t*, uint32_t) = argb_to_rgb565_scalar;
+static void (*argb_to_bgrx_impl)(uint32_t*, const uint32_t*, uint32_t) = argb_to_bgrx_scalar;
+static void (*argb_to_indexed_impl)(uint8_t*, const uint32_t*, uint32_t, uint32_t, uint32_t, uint8_t) = 
+    argb_to_indexed_scalar;
+static void (*premultiply_impl)(uint32_t*, const uint32_t*, uint32_t) = premultiply_scalar;
+static void (*unpremultiply_impl)(uint32_t*, const uint32_t*, uint32_t) = unpremultiply_scalar;
+
+// ARGB -> RGB565
+static void argb_to_rgb565_scalar(uint16_t* dst, const uint32_t* src, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t p = src[i];
+        dst[i] = (uint16_t)(((p >> 8) & 0xF800) | ((p >> 5) & 0x07E0) | ((p >> 3) & 0x001F));
+    }
+}
+
+// ARGB -> BGRX (bellekte X, R, G, B)
+static void argb_to_bgrx_scalar(uint32_t* dst, const uint32_t* src, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t p = src[i];
+        dst[i] = ((p & 0x000000FF) << 24) | ((p & 0x0000FF00) << 8) | ((p & 0x00FF0000) >> 8);
+    }
+}
+
+// ARGB -> 8 bit palet indeksi (isteğe bağlı sıralı titreme)
+static void argb_to_indexed_scalar(uint8_t* dst, const uint32_t* src, uint32_t count, 
+                                   uint32_t x, uint32_t y, uint8_t dither) {
+    for (uint32_t i = 0; i < count; i++) {
+        int32_t r = (src[i] >> 16) & 0xFF;
+        int32_t g = (src[i] >> 8) & 0xFF;
+        int32_t b = src[i] & 0xFF;
+        
+        if (dither) {
+            int32_t offset = PIXEL_DITHER_OFFSET(x + i, y);
+            r += offset;
+            g += offset;
+            b += offset;
+            r = (r < 0) ? 0 : ((r > 255) ? 255 : r);
+            g = (g < 0) ? 0 : ((g > 255) ? 255 : g);
+            b = (b < 0) ? 0 : ((b > 255) ? 255 : b);
+        }
+        
+        dst[i] = pixel_palette_lut[((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3)];
+    }
+}
+
+// Renkleri alfa ile çarp
+static void premultiply_scalar(uint32_t* dst, const uint32_t* src, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t p = src[i];
+        uint32_t a = p >> 24;
+        uint32_t out = p & 0xFF000000;
+        
+        for (uint32_t shift = 0; shift < 24; shift += 8) {
+            // Yuvarlanmış c * a / 255
+            uint32_t t = ((p >> shift) & 0xFF) * a + 128;
+            out |= ((t + (t >> 8)) >> 8) << shift;
+        }
+        
+        dst[i] = out;
+    }
+}
+
+// Alfa çarpımını geri al
+static void unpremultiply_scalar(uint32_t* dst, const uint32_t* src, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t p = src[i];
+        uint32_t a = p >> 24;
+        uint32_t out = p & 0xFF000000;
+        
+        if (a != 0) {
+            for (uint32_t shift = 0; shift < 24; shift += 8) {
+                // Yuvarlanmış c * 255 / a
+                uint32_t c = (((p >> shift) & 0xFF) * 510 + a) / (2 * a);
+                out |= ((c > 255) ? 255 : c) << shift;
+            }
+        }
+        
+        dst[i] = out;
+    }
+}
+
+#ifdef PIXEL_FORMAT_X86
+
+// 4 ARGB pikseli 32 bit şeritlerde RGB565'e çevir
+PIXEL_TARGET("sse2")
+static inline __m128i rgb565_lanes_sse2(__m128i v) {
+    __m128i r = _mm_and_si128(_mm_srli_epi32(v, 8), _mm_set1_epi32(0xF800));
+    __m128i g = _mm_and_si128(_mm_srli_epi32(v, 5), _mm_set1_epi32(0x07E0));
+    __m128i b = _mm_and_si128(_mm_srli_epi32(v, 3), _mm_set1_epi32(0x001F));
+    __m128i p = _mm_or_si128(r, _mm_or_si128(g, b));
+    
+    // packs_epi32 işaretli doyurduğu için önce işaret genişlet
+    return _mm_srai_epi32(_mm_slli_epi32(p, 16), 16);
+}
+
+PIXEL_TARGET("sse2")
+static void argb_to_rgb565_sse2(uint16_t* dst, const uint32_t* src, uint32_t count) {
+    uint32_t i = 0;
+    
+    for (; i + 8 <= count; i += 8) {
+        __m128i lo = rgb565_lanes_sse2(_mm_loadu_si128((const __m128i*)(src + i)));
+        __m128i hi = rgb565_lanes_sse2(_mm_loadu_si128((const __m128i*)(src + i + 4)));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packs_epi32(lo, hi));
+    }
+    
+    argb_to_rgb565_scalar(dst + i, src + i, count - i);
+}
+
+PIXEL_TARGET("sse2")
+static void argb_to_bgrx_sse2(uint32_t* dst, const uint32_t* src, uint32_t count) {
+    const __m128i mask = _mm_set1_epi32((int32_t)0xFFFFFF00);
+    uint32_t i = 0;
+    
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        
+        // 16 bit içinde bayt takası, ardından 16 bit yarıların takası
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+        v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+        
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_and_si128(v, mask));
+    }
+    
+    argb_to_bgrx_scalar(dst + i, src + i, count - i);
+}
+
+PIXEL_TARGET("ssse3")
+static void argb_to_bgrx_ssse3(uint32_t* dst, const uint32_t* src, uint32_t count) {
+    const __m128i shuffle = _mm_setr_epi8(-128, 2, 1, 0, -128, 6, 5, 4, 
+                                          -128, 10, 9, 8, -128, 14, 13, 12);
+    uint32_t i = 0;
+    
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_shuffle_epi8(v, shuffle));
+    }
+    
+    argb_to_bgrx_scalar(dst + i, src + i, count - i);
+}
+
+PIXEL_TARGET("sse2")
+static void argb_to_indexed_sse2(uint8_t* dst, const uint32_t* src, uint32_t count, 
+                                 uint32_t x, uint32_t y, uint8_t dither) {
+    uint8_t add[16] = {0};
+    uint8_t sub[16] = {0};
+    uint32_t index[4];
+    uint32_t i = 0;
+    
+    // Dört piksellik adımlarda titreme deseni satır boyunca sabit kalır
+    if (dither) {
+        for (uint32_t k = 0; k < 4; k++) {
+            int32_t offset = PIXEL_DITHER_OFFSET(x + k, y);
+            
+            for (uint32_t c = 0; c < 3; c++) {
+                add[k * 4 + c] = (offset > 0) ? (uint8_t)offset : 0;
+                sub[k * 4 + c] = (offset < 0) ? (uint8_t)(-offset) : 0;
+            }
+        }
+    }
+    
+    const __m128i dither_add = _mm_loadu_si128((const __m128i*)add);
+    const __m128i dither_sub = _mm_loadu_si128((const __m128i*)sub);
+    const __m128i mask_r = _mm_set1_epi32(0x7C00);
+    const __m128i mask_g = _mm_set1_epi32(0x03E0);
+    const __m128i mask_b = _mm_set1_epi32(0x001F);
+    
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        v = _mm_subs_epu8(_mm_adds_epu8(v, dither_add), dither_sub);
+        
+        // RGB555 tablo indeksi
+        __m128i idx = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(v, 9), mask_r),
+                      _mm_or_si128(_mm_and_si128(_mm_srli_epi32(v, 6), mask_g),
+                                   _mm_and_si128(_mm_srli_epi32(v, 3), mask_b)));
+        _mm_storeu_si128((__m128i*)index, idx);
+        
+        dst[i] = pixel_palette_lut[index[0]];
+        dst[i + 1] = pixel_palette_lut[index[1]];
+        dst[i + 2] = pixel_palette_lut[index[2]];
+        dst[i + 3] = pixel_palette_lut[index[3]];
+    }
+    
+    argb_to_indexed_scalar(dst + i, src + i, count - i, x + i, y, dither);
+}
+
+PIXEL_TARGET("sse2")
+static void premultiply_sse2(uint32_t* dst, const uint32_t* src, uint32_t count) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i rgb_mask = _mm_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+    const __m128i alpha_one = _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+    const __m128i round = _mm_set1_epi16(128);
+    uint32_t i = 0;
+    
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i half[2] = { _mm_unpacklo_epi8(v, zero), _mm_unpackhi_epi8(v, zero) };
+        
+        for (uint32_t h = 0; h < 2; h++) {
+            // Her pikselin alfasını renk şeritlerine yay; alfa şeridi 255 ile çarpılır
+            __m128i a = _mm_shufflelo_epi16(half[h], _MM_SHUFFLE(3, 3, 3, 3));
+            a = _mm_shufflehi_epi16(a, _MM_SHUFFLE(3, 3, 3, 3));
+            a = _mm_or_si128(_mm_and_si128(a, rgb_mask), alpha_one);
+            
+            // Yuvarlanmış c * a / 255
+            __m128i t = _mm_add_epi16(_mm_mullo_epi16(half[h], a), round);
+            half[h] = _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+        }
+        
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(half[0], half[1]));
+    }
+    
+    premultiply_scalar(dst + i, src + i, count - i);
+}
+
+PIXEL_TARGET("sse2")
+static void unpremultiply_sse2(uint32_t* dst, const uint32_t* src, uint32_t count) {
+    const __m128i byte_mask = _mm_set1_epi32(0xFF);
+    const __m128 max = _mm_set1_ps(255.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    uint32_t i = 0;
+    
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i a = _mm_srli_epi32(v, 24);
+        __m128 af = _mm_cvtepi32_ps(a);
+        __m128 nonzero = _mm_cmpneq_ps(af, _mm_setzero_ps());
+        
+        __m128i out = _mm_slli_epi32(a, 24);
+        for (int32_t shift = 0; shift < 24; shift += 8) {
+            __m128i c = _mm_and_si128(_mm_srl_epi32(v, _mm_cvtsi32_si128(shift)), byte_mask);
+            
+            // Yuvarlanmış c * 255 / a (tam sayı bölme ile aynı sonuç); a = 0 için 0
+            __m128 cf = _mm_div_ps(_mm_mul_ps(_mm_cvtepi32_ps(c), max), af);
+            cf = _mm_and_ps(_mm_min_ps(_mm_add_ps(cf, half), max), nonzero);
+            out = _mm_or_si128(out, _mm_sll_epi32(_mm_cvttps_epi32(cf), _mm_cvtsi32_si128(shift)));
+        }
+        
+        _mm_storeu_si128((__m128i*)(dst + i), out);
+    }
+    
+    unpremultiply_scalar(dst + i, src + i, count - i);
+}
+
+#endif // PIXEL_FORMAT_X86
+
+// İşlemci özelliklerine göre çekirdekleri seç
+// İşletim sistemi SSE durumunu yönetiyor mu? Halka 0'da CR4.OSFXSR okunur
+// (cpu_enable_sse ayarlar); kullanıcı kipinde SSE'yi işletim sistemi açmıştır.
+#ifdef PIXEL_FORMAT_X86
+static int pixel_os_sse_enabled() {
+    uint16_t cs;
+    __asm__ volatile("mov %%cs, %0" : "=r"(cs));
+    if (cs & 3) {
+        return 1;
+    }
+    
+    uintptr_t cr4;
+    __asm__ volatile("mov %%cr4, %0" : "=r"(cr4));
+    return (cr4 & (1u << 9)) != 0;
+}
+#endif
+
+// İşlemcinin desteklediği en yüksek komut seti
+static pixel_isa_t pixel_detect_isa() {
+#ifdef PIXEL_FORMAT_X86
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !pixel_os_sse_enabled()) {
+        return PIXEL_ISA_SCALAR;
+    }
+    
+    if (edx & bit_SSE2) {
+        return (ecx & bit_SSSE3) ? PIXEL_ISA_SSSE3 : PIXEL_ISA_SSE2;
+    }
+#endif
+    return PIXEL_ISA_SCALAR;
+}
+
+void pixel_format_init() {
+    pixel_format_set_isa(pixel_detect_isa());
+}
+
+// Çekirdekleri verilen komut setine göre seç (karşılaştırma ve ölçüm için).
+// İşlemci desteklemiyorsa seçim değişmez, -1 döner.
+int pixel_format_set_isa(pixel_isa_t isa) {
+    if (isa > pixel_detect_isa()) {
+        return -1;
+    }
+    
+    pixel_isa = isa;
+    argb_to_rgb565_impl = argb_to_rgb565_scalar;
+    argb_to_bgrx_impl = argb_to_bgrx_scalar;
+    argb_to_indexed_impl = argb_to_indexed_scalar;
+    premultiply_impl = premultiply_scalar;
+    unpremultiply_impl = unpremultiply_scalar;
+    
+#ifdef PIXEL_FORMAT_X86
+    if (isa >= PIXEL_ISA_SSE2) {
+        argb_to_rgb565_impl = argb_to_rgb565_sse2;
+        argb_to_bgrx_impl = argb_to_bgrx_sse2;
+        argb_to_indexed_impl = argb_to_indexed_sse2;
+        premultiply_impl = premultiply_sse2;
+        unpremultiply_impl = unpremultiply_sse2;
+    }
+    
+    if (isa >= PIXEL_ISA_SSSE3) {
+        argb_to_bgrx_impl = argb_to_bgrx_ssse3;
+    }
+#endif
+    
+    return 0;
+}
+
+// Seçilen komut setini al
+pixel_isa_t pixel_format_get_isa() {
+    return pixel_isa;
+}
+
+// Komut seti adı
+const char* pixel_format_isa_name(pixel_isa_t isa) {
+    switch (isa) {
+        case PIXEL_ISA_SSE2:  return "sse2";
+        case PIXEL_ISA_SSSE3: return "ssse3";
+        default:              return "scalar";
+    }
+}
+
+// Her RGB555 rengi için en yakın palet girdisini hesapla
+void pixel_format_build_palette_lut(const vga_color_t* palette, uint32_t count) {
+    if (!palette || count == 0) return;
+    if (count > VGA_PALETTE_SIZE) count = VGA_PALETTE_SIZE;
+    
+    // 6 bit DAC değerlerini 8 bite genişlet
+    int32_t pal_r[VGA_PALETTE_SIZE];
+    int32_t pal_g[VGA_PALETTE_SIZE];
+    int32_t pal_b[VGA_PALETTE_SIZE];
+    
+    for (uint32_t i = 0; i < count; i++) {
+        pal_r[i] = (palette[i].r << 2) | (palette[i].r >> 4);
+        pal_g[i] = (palette[i].g << 2) | (palette[i].g >> 4);
+        pal_b[i] = (palette[i].b << 2) | (palette[i].b >> 4);
+    }
+    
+    for (uint32_t idx = 0; idx < PIXEL_PALETTE_LUT_SIZE; idx++) {
+        int32_t r = ((idx >> 10) & 0x1F) << 3;
+        int32_t g = ((idx >> 5) & 0x1F) << 3;
+        int32_t b = (idx & 0x1F) << 3;
+        
+        // 5 bitlik kanalın orta noktası
+        r |= r >> 5;
+        g |= g >> 5;
+        b |= b >> 5;
+        
+        uint32_t best = 0;
+        int32_t best_dist = 0x7FFFFFFF;
+        
+        for (uint32_t i = 0; i < count; i++) {
+            int32_t dr = r - pal_r[i];
+            int32_t dg = g - pal_g[i];
+            int32_t db = b - pal_b[i];
+            int32_t dist = dr * dr + dg * dg + db * db;
+            
+            if (dist < best_dist) {
+                best_dist = dist;
+                best = i;
+            }
+        }
+        
+        pixel_palette_lut[idx] = (uint8_t)best;
+    }
+}
+
+// ARGB8888 -> RGB565
+void pixel_argb_to_rgb565(uint16_t* dst, const uint32_t* src, uint32_t count) {
+    if (!dst || !src) return;
+    argb_to_rgb565_impl(dst, src, count);
+}
+
+// ARGB8888 -> BGRX8888
+void pixel_argb_to_bgrx(uint32_t* dst, const uint32_t* src, uint32_t count) {
+    if (!dst || !src) return;
+    argb_to_bgrx_impl(dst, src, count);
+}
+
+// ARGB8888 -> 8 bit palet (x, y: titreme deseni için ekran konumu)
+void pixel_argb_to_indexed(uint8_t* dst, const uint32_t* src, uint32_t count, 
+                           uint32_t x, uint32_t y, uint8_t dither) {
+    if (!dst || !src) return;
+    argb_to_indexed_impl(dst, src, count, x, y, dither);
+}
+
+// Alfa ile çarpılmış ARGB'ye çevir
+void pixel_premultiply(uint32_t* dst, const uint32_t* src, uint32_t count) {
+    if (!dst || !src) return;
+    premultiply_impl(dst, src, count);
+}
+
+// Alfa ile çarpılmış ARGB'den düz ARGB'ye çevir
+void pixel_unpremultiply(uint32_t* dst, const uint32_t* src, uint32_t count) {
+    if (!dst || !src) return;
+    unpremultiply_impl(dst, src, count);
+}
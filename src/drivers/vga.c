@@ -1,4 +1,5 @@
 #include "../include/vga.h"
+#include "../include/pixel_format.h"
 #include <stdint.h>
 
 // VGA değişkenleri
@@ -99,6 +100,10 @@ void vga_init() {
         vga_set_palette(i, default_palette[i].r, default_palette[i].g, default_palette[i].b);
     }
     
+    // Piksel dönüştürme çekirdeklerini seç ve ters palet tablosunu oluştur
+    pixel_format_init();
+    pixel_format_build_palette_lut(default_palette, 16);
+    
     // Ekranı temizle
     vga_clear_screen(0);
 }
@@ -0,0 +1,91 @@
+#ifndef AI_INFERENCE_H
+#define AI_INFERENCE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Yerel, nicemlenmiş transformer çıkarım motoru. GGUF dosyasındaki llama
+// mimarisindeki model mmap ile eşlenir; ağırlıklar kopyalanmaz, yalnızca
+// normalizasyon vektörleri açılır.
+//
+// Matris-vektör çarpımlarında etkinleştirmeler 32'lik bloklar halinde
+// int8'e nicemlenir ve Q8_0/Q4_0 ağırlık bloklarıyla tamsayı nokta
+// çarpımı yapılır (AVX2+FMA, SSSE3 ya da skaler; işlemciye göre seçilir).
+// Çarpımların satırları ve dikkat başlıkları iş parçacıkları arasında
+// paylaştırılır.
+//
+// Desteklenen tensör tipleri: F32, F16, Q8_0, Q4_0 (ör. "--pure" ile
+// nicemlenmiş modeller). Sözcük dağarcığı SentencePiece olmalıdır
+// (tokenizer.ggml.model = "llama").
+
+#define AI_INFERENCE_MAX_THREADS        16
+#define AI_INFERENCE_DEFAULT_CONTEXT    2048
+
+// Hata kodları
+#define AI_INFERENCE_ERROR_INVALID      -1      // Geçersiz parametre
+#define AI_INFERENCE_ERROR_IO           -2      // Dosya açılamadı ya da eşlenemedi
+#define AI_INFERENCE_ERROR_FORMAT       -3      // Bozuk GGUF dosyası
+#define AI_INFERENCE_ERROR_UNSUPPORTED  -4      // Mimari, tensör tipi ya da tokenizer desteklenmiyor
+#define AI_INFERENCE_ERROR_NO_MEMORY    -5      // Bellek yetersiz
+#define AI_INFERENCE_ERROR_CONTEXT      -6      // İstem bağlam penceresine sığmıyor
+
+// Çarpım çekirdeklerinin komut seti
+typedef enum {
+    AI_INFERENCE_ISA_SCALAR = 0,
+    AI_INFERENCE_ISA_SSSE3,
+    AI_INFERENCE_ISA_AVX2
+} ai_inference_isa_t;
+
+// Yükleme seçenekleri (NULL: tümü varsayılan)
+typedef struct {
+    uint32_t threads;               // 0: çevrimiçi işlemci sayısı
+    uint32_t context;               // 0: modelin bağlamı, en çok AI_INFERENCE_DEFAULT_CONTEXT
+    uint64_t seed;                  // Örnekleme tohumu (0: zamandan)
+} ai_inference_options_t;
+
+// Model bilgisi
+typedef struct {
+    uint32_t vocab_size;
+    uint32_t embedding;
+    uint32_t layers;
+    uint32_t heads;
+    uint32_t kv_heads;
+    uint32_t feed_forward;
+    uint32_t context;               // Kullanılan bağlam (KV önbelleği)
+    uint32_t threads;
+    ai_inference_isa_t isa;
+    uint64_t mapped_bytes;          // Eşlenen model dosyası
+    uint64_t buffer_bytes;          // KV önbelleği, ara tamponlar ve sözlük
+    double load_ms;
+} ai_inference_info_t;
+
+// Bir üretimin ölçümleri
+typedef struct {
+    uint32_t prompt_tokens;         // BOS dahil
+    uint32_t generated_tokens;
+    double first_token_ms;          // İstemin işlenip ilk tokenın seçilmesine kadar
+    double tokens_per_sec;          // İlk tokendan sonraki üretim hızı
+    double total_ms;
+} ai_inference_stats_t;
+
+typedef struct ai_inference_model ai_inference_model_t;
+
+// GGUF modelini yükle
+int ai_inference_load(const char* path, const ai_inference_options_t* options, ai_inference_model_t** model_out);
+void ai_inference_free(ai_inference_model_t* model);
+
+// Model bilgisini al
+int ai_inference_get_info(ai_inference_model_t* model, ai_inference_info_t* info);
+
+// İstemin devamını üret. temperature <= 0 ise en olası token seçilir.
+// text_out serbest bırakılmalıdır; stats NULL olabilir.
+int ai_inference_generate(ai_inference_model_t* model, const char* prompt, float temperature,
+                          uint32_t max_tokens, char** text_out, ai_inference_stats_t* stats);
+
+// Dosya GGUF mu? (1: evet, 0: hayır)
+int ai_inference_is_gguf(const char* path);
+
+// Komut seti adı
+const char* ai_inference_isa_name(ai_inference_isa_t isa);
+
+#endif /* AI_INFERENCE_H */
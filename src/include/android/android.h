@@ -12,6 +12,7 @@
 #include "android_container.h"    // Konteyner yönetimi
 #include "android_bridge.h"       // KALEM OS köprüsü
 #include "android_manager.h"      // Uygulama yönetimi
+#include "usage_sampler.h"        // Kullanım geçmişi
 
 // Android sistem sürüm bilgileri
 #define ANDROID_VERSION_NAME      "11.0"
@@ -79,6 +80,7 @@ int android_resume_all();
 int android_kill_all();
 int android_get_memory_usage(uint64_t* used, uint64_t* total);
 int android_get_disk_usage(uint64_t* used, uint64_t* total);
+int android_get_usage_history(uint32_t tier, usage_sample_t* samples, uint32_t max_samples, uint32_t* count);
 
 // Loglama
 int android_set_log_level(int level);
@@ -2,7 +2,9 @@
 #define ANDROID_BRIDGE_H
 
 #include <stdint.h>
+#include <pthread.h>
 #include "../gui.h"
+#include "../audio_mixer.h"
 #include "android_container.h"
 
 // Android pencere yöneticisi ile KALEM OS GUI arasındaki bağlantı
@@ -15,27 +17,197 @@ typedef enum {
     ANDROID_DISPLAY_MODE_PICTURE_IN_PICTURE // Resim içinde resim modu
 } android_display_mode_t;
 
+// Yüzey tampon kuyruğu (BufferQueue benzeri üçlü tamponlama)
+#define ANDROID_SURFACE_BUFFER_COUNT   3
+#define ANDROID_SURFACE_NO_SLOT        -1
+#define ANDROID_SURFACE_MAX_DAMAGE     GUI_DAMAGE_MAX_RECTS
+
+// Yüzey üretici servisi (binder). Android tarafı Surface.lockCanvas /
+// unlockCanvasAndPost karşılığı olarak tampon alır ve çizdiği kareyi hasar
+// bölgeleriyle gönderir; pikseller paylaşımlı tamponlara yazılır, binder ile
+// yalnızca küçük başlık gider. Servis adı "surface.<yüzey kimliği>".
+#define ANDROID_SURFACE_SERVICE_NAME_MAX 32
+#define ANDROID_SURFACE_TRANSACT_LOCK    1   // Yanıt: android_surface_lock_reply_t
+#define ANDROID_SURFACE_TRANSACT_UNLOCK  2   // Veri: uint32_t sayı + android_rect_t[sayı] (0: tüm tampon)
+
+// Yüzey dikdörtgeni (hasar bölgeleri için)
+typedef struct {
+    uint32_t x;
+    uint32_t y;
+    uint32_t width;
+    uint32_t height;
+} android_rect_t;
+
+// Tampon alma yanıtı
+typedef struct {
+    int32_t slot;                  // Çizilecek tampon (paylaşımlı tampon sırası)
+    uint32_t buffer_age;           // İçeriğin kaç kare eski olduğu (0: tanımsız)
+    uint32_t width;                // Görünür boyut
+    uint32_t height;
+    uint32_t stride;               // Satır başına piksel
+} android_surface_lock_reply_t;
+
+// Yüzey tamponu durumları
+typedef enum {
+    SURFACE_BUFFER_FREE,           // Üretici tarafından alınabilir
+    SURFACE_BUFFER_DEQUEUED,       // Android tarafı çiziyor
+    SURFACE_BUFFER_QUEUED,         // Gösterilmeyi bekliyor
+    SURFACE_BUFFER_ACQUIRED        // Pencere yöneticisi gösteriyor
+} surface_buffer_state_t;
+
+// Yüzey tamponu
+typedef struct {
+    uint32_t* pixels;              // Sayfa hizalı, paylaşımlı ARGB piksel belleği
+    surface_buffer_state_t state;  // Tampon durumu
+    uint64_t frame_number;         // Kare numarası
+    uint64_t queue_time_us;        // Kuyruğa eklenme zamanı (mikrosaniye)
+    uint32_t width;                // Karenin çizildiği görünür genişlik
+    uint32_t height;               // Karenin çizildiği görünür yükseklik
+    
+    // Önceki gösterilen kareye göre değişen bölgeler (setDamageRegion karşılığı)
+    android_rect_t damage[ANDROID_SURFACE_MAX_DAMAGE];
+    uint8_t damage_count;          // Hasar dikdörtgeni sayısı
+    uint8_t full_damage;           // Tüm tampon değişti mi?
+} android_surface_buffer_t;
+
+// Yüzey sunum istatistikleri
+typedef struct {
+    uint64_t frames_queued;        // Kuyruğa eklenen kare sayısı
+    uint64_t frames_presented;     // Gösterilen kare sayısı
+    uint64_t frames_dropped;       // Gösterilmeden yenisiyle değiştirilen kareler
+    uint64_t buffer_copies;        // Kare kopyaları (sunum kopyalamaz; yalnızca büyümede son kare taşınır)
+    uint64_t total_latency_us;     // Kuyruk -> gösterim toplam gecikmesi
+    uint64_t max_latency_us;       // En yüksek kuyruk -> gösterim gecikmesi
+    uint64_t damage_bytes;         // Gösterilen karelerde değişen toplam bayt
+    uint64_t resizes_in_place;     // Mevcut tamponlarda yapılan boyutlandırmalar
+    uint64_t resize_reallocations; // Tampon yeniden ayıran boyutlandırmalar
+    uint64_t first_frame_us;       // Oluşturma -> ilk gösterilen kare (0: henüz yok)
+} android_surface_stats_t;
+
+// Android ses çıkışı biçimi (AudioFlinger'ın varsayılanı)
+#define ANDROID_AUDIO_SAMPLE_RATE      48000
+#define ANDROID_AUDIO_CHANNELS         2
+
+// Giriş olayı halkası (tek üretici: pencere yöneticisi, tek tüketici: konteyner)
+#define ANDROID_INPUT_RING_SIZE        256   // 2'nin kuvveti olmalı
+#define ANDROID_CACHE_LINE_SIZE        64
+
+// Giriş olayı kaynakları
+typedef enum {
+    ANDROID_INPUT_KEY,             // Klavye
+    ANDROID_INPUT_MOUSE,           // Fare
+    ANDROID_INPUT_TOUCH            // Dokunmatik
+} android_input_type_t;
+
+// Giriş olayı eylemleri
+typedef enum {
+    ANDROID_INPUT_ACTION_DOWN,     // Tuş/düğme basıldı, dokunma başladı
+    ANDROID_INPUT_ACTION_UP,       // Tuş/düğme bırakıldı, dokunma bitti
+    ANDROID_INPUT_ACTION_MOVE      // İmleç veya parmak hareketi
+} android_input_action_t;
+
+// Zaman damgalı giriş olayı
+typedef struct {
+    uint64_t timestamp_us;         // Enjekte edilme zamanı (birleştirilmişse son örnek)
+    uint32_t x;                    // X konumu
+    uint32_t y;                    // Y konumu
+    uint16_t key_code;             // Tuş kodu (klavye olayları)
+    uint16_t sample_count;         // Birleştirilen hareket örneği sayısı
+    uint8_t type;                  // android_input_type_t
+    uint8_t action;                // android_input_action_t
+    uint8_t button;                // Fare düğmesi
+} android_input_event_t;
+
+// Giriş olayı istatistikleri
+typedef struct {
+    uint64_t events_injected;      // Halkaya yazılan olaylar
+    uint64_t events_dropped;       // Halka dolu olduğu için yazılamayan olaylar
+    uint64_t events_read;          // Tüketicinin okuduğu ham olaylar
+    uint64_t events_dispatched;    // Birleştirme sonrası teslim edilen olaylar
+    uint64_t events_coalesced;     // Önceki harekete katılan hareket olayları
+    uint64_t doorbell_wakeups;     // Uyuyan tüketiciyi uyandırma sayısı
+    uint64_t total_latency_us;     // Enjeksiyon -> okuma toplam gecikmesi
+    uint64_t max_latency_us;       // En yüksek enjeksiyon -> okuma gecikmesi
+} android_input_stats_t;
+
+// Konteynerle paylaşılan giriş halkası. Üretici ve tüketicinin yazdığı alanlar
+// ayrı önbellek satırlarında tutulur.
+typedef struct {
+    // Üretici tarafı
+    volatile uint32_t tail __attribute__((aligned(ANDROID_CACHE_LINE_SIZE)));
+    uint64_t events_injected;
+    uint64_t events_dropped;
+    uint64_t doorbell_wakeups;
+    
+    // Tüketici tarafı
+    volatile uint32_t head __attribute__((aligned(ANDROID_CACHE_LINE_SIZE)));
+    uint64_t events_read;
+    uint64_t events_dispatched;
+    uint64_t events_coalesced;
+    uint64_t total_latency_us;
+    uint64_t max_latency_us;
+    
+    // Kapı zili (futex kelimesi) ve tüketicinin uyuduğu bilgisi
+    volatile uint32_t doorbell __attribute__((aligned(ANDROID_CACHE_LINE_SIZE)));
+    volatile uint32_t consumer_waiting;
+    
+    android_input_event_t events[ANDROID_INPUT_RING_SIZE] __attribute__((aligned(ANDROID_CACHE_LINE_SIZE)));
+} android_input_ring_t;
+
 // Android yüzeyi
 typedef struct {
     uint32_t id;                   // Yüzey kimliği
-    uint32_t width;                // Genişlik
-    uint32_t height;               // Yükseklik
-    uint32_t* buffer;              // Piksel tamponu
+    uint32_t width;                // Görünür genişlik
+    uint32_t height;               // Görünür yükseklik
+    uint32_t stride;               // Satır başına piksel (ayrılmış genişlik, >= width)
+    uint32_t capacity_height;      // Ayrılmış satır sayısı (>= height)
+    uint32_t* buffer;              // Android tarafının çizdiği piksel tamponu
     uint8_t has_alpha;             // Alfa kanalı var mı?
     uint8_t dirty;                 // Değişiklik var mı?
     void* native_handle;           // Android tarafındaki yerel tanıtıcı
+    
+    // Tampon kuyruğu
+    android_surface_buffer_t slots[ANDROID_SURFACE_BUFFER_COUNT];
+    uint32_t buffer_size;          // Her tamponun bayt boyutu (sayfa katı)
+    uint32_t* retired[ANDROID_SURFACE_BUFFER_COUNT]; // Büyümeden kalan, pencerenin hâlâ gösterebileceği tamponlar
+    uint32_t retired_size;         // Eski tamponların bayt boyutu
+    int8_t dequeued_slot;          // Android tarafının çizdiği tampon
+    int8_t queued_slot;            // Gösterilmeyi bekleyen en yeni tampon
+    int8_t acquired_slot;          // Ekranda gösterilen tampon
+    uint32_t buffer_age;           // Alınan tamponun kaç kare eski olduğu (0: tanımsız)
+    uint64_t next_frame_number;    // Sonraki kare numarası
+    uint64_t create_time_us;       // Oluşturulma zamanı (ilk kare gecikmesi)
+    pthread_mutex_t queue_lock;    // Kuyruk kilidi
+    android_surface_stats_t stats; // Sunum istatistikleri
+    
+    // Ertelenmiş boyutlandırma (sürükleme sırasında birleştirilir)
+    uint32_t pending_width;        // İstenen son genişlik
+    uint32_t pending_height;       // İstenen son yükseklik
+    uint8_t resize_pending;        // Uygulanmamış boyut isteği var mı?
+    uint8_t resizing;              // Boyutlandırma sürüklemesi sürüyor mu?
+    
+    char service_name[ANDROID_SURFACE_SERVICE_NAME_MAX]; // Üretici servisi (kayıtlı değilse boş)
 } android_surface_t;
 
 // Android-KALEM OS köprü yapısı
 typedef struct {
     android_container_t* container;     // Bağlı konteyner
     gui_window_t* window;              // KALEM OS penceresi
+    gui_window_paint_handler_t window_on_paint; // Bağlanmadan önceki çizim işleyicisi
+    void* window_user_data;            // Bağlanmadan önceki kullanıcı verisi
+    gui_window_resize_handler_t window_on_resize; // Bağlanmadan önceki boyutlandırma işleyicisi
+    gui_window_resize_drag_handler_t window_on_resize_drag; // Bağlanmadan önceki sürükleme işleyicisi
     android_surface_t* surface;        // Android yüzeyi
     android_display_mode_t display_mode; // Ekran modu
     
     // Giriş olayı tamponları
-    void* input_events;                // Giriş olayları
-    uint32_t input_event_count;        // Olay sayısı
+    android_input_ring_t* input_events; // Konteynerle paylaşılan olay halkası
+    uint32_t input_event_count;        // Enjekte edilen olay sayısı
+    uint8_t mouse_buttons;             // Basılı fare düğmeleri
+    uint8_t touch_down;                // Dokunma sürüyor mu?
+    
+    // Ses
+    audio_stream_t* audio_stream;      // Sistem karıştırıcısındaki akış (yönlendirme açıksa)
     
     // Geri çağırma işlevleri
     void (*on_surface_created)(android_surface_t* surface);
@@ -57,13 +229,26 @@ int bridge_destroy(android_bridge_t* bridge);
 // Yüzey yönetimi
 android_surface_t* bridge_create_surface(android_bridge_t* bridge, uint32_t width, uint32_t height);
 int bridge_resize_surface(android_surface_t* surface, uint32_t width, uint32_t height);
+int bridge_begin_resize(android_surface_t* surface);
+int bridge_end_resize(android_surface_t* surface);
 int bridge_destroy_surface(android_surface_t* surface);
 
 // Yüzey erişimi ve senkronizasyonu
+// unlock: damage kareyle birlikte gösterime giden değişen bölgelerdir (yüzey
+// sınırlarına kırpılır). NULL ise bridge_set_damage_region ile bildirilen
+// bölgeler, o da yoksa tüm tampon kullanılır.
 int bridge_lock_surface(android_surface_t* surface, void** buffer);
-int bridge_unlock_surface(android_surface_t* surface);
+int bridge_unlock_surface(android_surface_t* surface, const android_rect_t* damage, uint32_t damage_count);
 int bridge_invalidate_surface(android_surface_t* surface);
 
+// Tampon kuyruğu (üretici: Android, tüketici: pencere yöneticisi)
+int bridge_dequeue_buffer(android_surface_t* surface, void** buffer);
+int bridge_set_damage_region(android_surface_t* surface, const android_rect_t* rects, uint32_t count);
+int bridge_queue_buffer(android_surface_t* surface);
+const uint32_t* bridge_acquire_buffer(android_surface_t* surface);
+int bridge_release_buffer(android_surface_t* surface);
+int bridge_get_surface_stats(android_surface_t* surface, android_surface_stats_t* stats);
+
 // Pencere ve görüntüleme yönetimi
 int bridge_set_display_mode(android_bridge_t* bridge, android_display_mode_t mode);
 int bridge_get_display_mode(android_bridge_t* bridge, android_display_mode_t* mode);
@@ -75,14 +260,21 @@ int bridge_inject_key_event(android_bridge_t* bridge, uint8_t key_code, uint8_t
 int bridge_inject_mouse_event(android_bridge_t* bridge, uint32_t x, uint32_t y, uint8_t button, uint8_t is_press);
 int bridge_inject_touch_event(android_bridge_t* bridge, uint32_t x, uint32_t y, uint8_t is_down);
 
+// Giriş olayı tüketimi (konteyner tarafı)
+int bridge_read_input_events(android_bridge_t* bridge, android_input_event_t* events, uint32_t max_events);
+int bridge_wait_input_events(android_bridge_t* bridge, uint32_t timeout_ms);
+int bridge_get_input_stats(android_bridge_t* bridge, android_input_stats_t* stats);
+
 // Binder IPC entegrasyonu
 int bridge_init_binder();
 int bridge_register_service(const char* name, void* service);
 void* bridge_get_service(const char* name);
 int bridge_send_transaction(void* service, uint32_t code, void* data, uint32_t size);
+int bridge_send_oneway_transaction(void* service, uint32_t code, void* data, uint32_t size);
 
 // Ses yönlendirme
 int bridge_init_audio();
 int bridge_route_android_audio(android_bridge_t* bridge, uint8_t enable);
+int bridge_write_audio(android_bridge_t* bridge, const int16_t* frames, uint32_t frame_count);
 
 #endif /* ANDROID_BRIDGE_H */ 
\ No newline at end of file
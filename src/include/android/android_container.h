@@ -2,6 +2,7 @@
 #define ANDROID_CONTAINER_H
 
 #include <stdint.h>
+#include <sys/types.h>
 
 // Android konteyner durumları
 typedef enum {
@@ -46,6 +47,9 @@ typedef struct android_container {
     void* filesystem;              // Dosya sistemi yapısı
     void* network;                 // Ağ yapısı
     void* ipc;                     // Süreçler arası iletişim
+    void* resources;               // Kaynak denetleyicisi (container_resource_t)
+    void* freezer;                 // İş parçacığı dondurucu (container_freezer_t)
+    void* checkpoint;              // Denetim noktası imajı (container_checkpoint_t)
     
     // İstatistikler
     uint64_t start_time;           // Başlangıç zamanı
@@ -60,13 +64,23 @@ int container_start(android_container_t* container);
 int container_stop(android_container_t* container);
 int container_pause(android_container_t* container);
 int container_resume(android_container_t* container);
+int container_checkpoint(android_container_t* container);
+int container_restore(android_container_t* container);
 int container_destroy(android_container_t* container);
+int container_list_all(android_container_t*** containers, uint32_t* count);
 
 // Dosya sistemi yönetimi
 int container_mount_android_fs(android_container_t* container, const char* system_image);
 int container_mount_data(android_container_t* container, const char* data_path);
 int container_bind_mount(android_container_t* container, const char* host_path, const char* container_path);
 
+// Konteyner içinden dosya erişimi: birleşik katmandan geçer, yazma ve kesme
+// üst katman kullanımını günceller ve max_disk_mb aşılırsa reddedilir.
+// Hatalar OVERLAY_ERROR_* kodlarıdır (dosya sistemi bağlı değilse OVERLAY_ERROR_INVALID).
+int container_open_file(android_container_t* container, const char* path, int flags, mode_t mode);
+ssize_t container_write_file(android_container_t* container, int fd, const void* buffer, size_t size);
+int container_truncate_file(android_container_t* container, int fd, off_t length);
+
 // İşlem yönetimi
 int container_exec(android_container_t* container, const char* command, char* const argv[]);
 int container_kill_process(android_container_t* container, uint32_t pid);
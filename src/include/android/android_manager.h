@@ -56,7 +56,8 @@ typedef struct {
     // APK bilgileri
     char apk_path[256];             // APK dosya yolu
     uint64_t apk_size;              // APK dosya boyutu
-    char apk_signature[256];        // APK imzası
+    char apk_signature[256];        // APK imzası (imzalayan sertifika doğrulandığında)
+    char apk_digest[65];            // v2/v3 içerik özeti, onaltılık (imzalayan doğrulanmaz)
 } android_app_info_t;
 
 // Android uygulama yapısı
@@ -73,13 +74,23 @@ typedef struct {
     float cpu_usage;                // CPU kullanımı
     uint64_t start_time;            // Başlangıç zamanı
     uint64_t last_active_time;      // Son aktif olma zamanı
+    
+    uint64_t apk_mtime;             // Bilgilerin okunduğu APK'nın mtime'ı (ns)
+    uint32_t scan_generation;       // Son görüldüğü dizin taraması
 } android_app_t;
 
 // Android uygulama yöneticisi
 typedef struct {
     uint32_t app_count;             // Kurulu uygulama sayısı
+    uint32_t app_capacity;          // Liste kapasitesi
     android_app_t** apps;           // Uygulama listesi
     
+    struct package_db* package_db;  // Kalıcı paket veritabanı (açılamadıysa NULL)
+    struct intent_router* intent_router; // Intent filtre indeksi ve teslim kuyrukları
+    struct usage_sampler* usage_sampler; // Uygulama kullanım geçmişi (başlatılamadıysa NULL)
+    uint64_t apps_dir_mtime;        // Son taranan uygulama dizininin mtime'ı (ns)
+    uint32_t scan_generation;       // Dizin tarama sayacı
+    
     char apps_dir[256];             // Uygulamalar dizini
     char data_dir[256];             // Veri dizini
     
@@ -121,5 +132,7 @@ int android_revoke_permission(android_app_t* app, android_permission_t permissio
 // İşlevsel API
 int android_send_intent(const char* action, const char* target_package, const char* target_component, void* extras);
 int android_broadcast_intent(const char* action, void* extras);
+int android_register_intent_filter(const char* package_name, const char* component, const char* action,
+                                   const char* type, const char* const* categories);
 
 #endif /* ANDROID_MANAGER_H */ 
\ No newline at end of file
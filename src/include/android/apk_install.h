@@ -0,0 +1,73 @@
+#ifndef APK_INSTALL_H
+#define APK_INSTALL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// APK kurulum hattı. ZIP merkezi dizini bir kez okunur; classes*.dex, kaynaklar
+// (AndroidManifest.xml, resources.arsc, res/, assets/) ve seçilen ABI'nin yerel
+// kütüphaneleri iş parçacıkları arasında paylaştırılarak çıkarılır. APK salt
+// okunur eşlenir, hiçbir zaman tamamı belleğe okunmaz:
+// - STORED girdiler çekirdek içinde kopyalanır (sendfile), veri kullanıcı
+//   alanından geçmez
+// - DEFLATE girdiler eşlenmiş APK'dan eşlenmiş hedef dosyaya doğrudan açılır
+//   ve CRC-32 ile doğrulanır
+// - STORED girdilerin CRC-32'si eşlenmiş APK üzerinden doğrulanır
+// - v2/v3 imza bloğu varsa içerik özeti 1 MB'lık parçalar halinde aynı
+//   iş parçacıklarında hesaplanır ve imzalı veri içindeki özetle karşılaştırılır.
+//   İmzalı verinin imzalayan sertifikayla doğrulanması bu modülün işi değildir;
+//   eşleşen özet APK'nın imzalı olduğunu ya da kimin imzaladığını göstermez.
+//
+// Dosyalar "<hedef>.<pid>.tmp" hazırlık dizinine çıkarılır ve yalnızca başarıda
+// hedefin yerine taşınır; yarıda kalan kurulum önceki sürümü bozmaz.
+
+#define APK_INSTALL_MAX_WORKERS      8
+#define APK_INSTALL_DEFAULT_ABI      "x86"
+#define APK_INSTALL_CHUNK_SIZE       (1024 * 1024)   // İmza özeti parça boyutu
+
+// Hata kodları
+#define APK_INSTALL_ERROR_INVALID    -1      // Geçersiz parametre
+#define APK_INSTALL_ERROR_IO         -2      // APK okunamadı ya da hedef yazılamadı
+#define APK_INSTALL_ERROR_FORMAT     -3      // Bozuk ZIP, desteklenmeyen sıkıştırma ya da güvensiz girdi adı
+#define APK_INSTALL_ERROR_CORRUPT    -4      // Açılan veri bozuk, boyutu ya da CRC-32'si tutmuyor
+#define APK_INSTALL_ERROR_SIGNATURE  -5      // İçerik özeti imzalı özetle eşleşmiyor
+#define APK_INSTALL_ERROR_NO_MEMORY  -6      // Bellek yetersiz
+
+// İmza durumu
+typedef enum {
+    APK_SIGNATURE_NONE,             // İmza bloğu yok (yalnızca v1 ya da imzasız)
+    APK_SIGNATURE_UNSUPPORTED,      // İmza bloğu var, SHA-256 parça özeti yok
+    APK_SIGNATURE_DIGEST_MATCHED    // İçerik özeti imza bloğundaki özetle eşleşti (imzalayan doğrulanmadı)
+} apk_signature_state_t;
+
+// Kurulum istatistikleri
+typedef struct {
+    uint32_t entries;               // Merkezi dizindeki girdi
+    uint32_t extracted;             // Çıkarılan dosya
+    uint32_t stored;                // Çekirdek içinde kopyalanan
+    uint32_t inflated;              // Açılan
+    uint32_t dex_files;             // classes*.dex
+    uint32_t native_libs;           // lib/<abi>/
+    uint32_t resources;             // Manifest, kaynak tablosu, res/, assets/
+    uint32_t digest_chunks;         // Özeti hesaplanan parça
+    uint32_t workers;               // Kullanılan iş parçacığı (çağıran dahil)
+    uint64_t apk_size;
+    uint64_t bytes_written;
+    apk_signature_state_t signature;
+    uint8_t digest[32];             // Eşleşen içerik özeti (SHA-256)
+    double elapsed_ms;
+    double mb_per_sec;              // APK boyutu / kurulum süresi
+} apk_install_stats_t;
+
+// APK'yı target_dir'e kur. abi NULL ise APK_INSTALL_DEFAULT_ABI, workers 0 ise
+// çevrimiçi işlemci sayısı kullanılır (APK_INSTALL_MAX_WORKERS ile sınırlı).
+// stats NULL olabilir.
+int apk_install(const char* apk_path, const char* target_dir, const char* abi, uint32_t workers, apk_install_stats_t* stats);
+
+// Kurulu dizini içeriğiyle birlikte sil
+int apk_install_remove(const char* target_dir);
+
+// SHA-256 (SHA uzantısı varsa donanım sürümü). Yedekleme deposu da kullanır.
+void apk_sha256(const void* data, size_t size, uint8_t digest[32]);
+
+#endif /* APK_INSTALL_H */
@@ -0,0 +1,70 @@
+#ifndef APP_BACKUP_H
+#define APP_BACKUP_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Uygulama verisi yedekleme. Dosyalar içerik tanımlı parçalara bölünür
+// (FastCDC: gear karması, normalleştirilmiş kesim noktaları), her parça
+// SHA-256 özetiyle adreslenir ve yedek dosyasının dizinindeki ortak depoda
+// bir kez tutulur:
+// - "chunks.pack": yalnızca sona eklenen, LZ4 blok biçiminde sıkıştırılmış
+//   parçalar (sıkışmayan parça ham yazılır)
+// - "chunks.db": özet -> paket ofseti (package_db günlüğü)
+// Yedek dosyasının kendisi yalnızca bir manifesttir: dizinler, dosya
+// öznitelikleri ve her dosyanın parça özetleri. Aynı dizindeki tüm yedekler
+// depoyu paylaşır; değişmeyen veri ikinci kez yazılmaz. Boyutu ve mtime'ı
+// önceki manifestteki kayıtla aynı olan dosyalar okunmaz bile.
+//
+// Yedeklemede dosyalar, geri yüklemede parça grupları iş parçacıkları
+// arasında paylaştırılır. Geri yüklenen her parçanın özeti doğrulanır;
+// dosyalar geçici adla yazılıp yerlerine taşınır. Yedekte olmayan dosyalara
+// dokunulmaz.
+
+#define APP_BACKUP_MAGIC             "KABK"
+#define APP_BACKUP_VERSION           1
+#define APP_BACKUP_MIN_CHUNK         (2 * 1024)
+#define APP_BACKUP_AVG_CHUNK         (8 * 1024)
+#define APP_BACKUP_MAX_CHUNK         (64 * 1024)
+#define APP_BACKUP_MAX_WORKERS       8
+#define APP_BACKUP_META_MAX          4096    // Manifestte saklanan çağıran verisi
+#define APP_BACKUP_PACK_NAME         "chunks.pack"
+#define APP_BACKUP_INDEX_NAME        "chunks.db"
+
+// Hata kodları
+#define APP_BACKUP_ERROR_INVALID     -1      // Geçersiz parametre
+#define APP_BACKUP_ERROR_IO          -2      // Kaynak okunamadı ya da depo/hedef yazılamadı
+#define APP_BACKUP_ERROR_FORMAT      -3      // Bozuk ya da desteklenmeyen manifest
+#define APP_BACKUP_ERROR_CORRUPT     -4      // Depoda eksik parça ya da özeti tutmayan veri
+#define APP_BACKUP_ERROR_NO_MEMORY   -5      // Bellek yetersiz
+
+// İstatistikler (yedekleme ve geri yükleme)
+typedef struct {
+    uint32_t files;
+    uint32_t directories;
+    uint32_t unchanged_files;       // Önceki manifestten okunmadan alınan / geri yüklemede atlanan
+    uint32_t skipped;               // Normal dosya ya da dizin olmayan girdiler
+    uint32_t workers;               // Kullanılan iş parçacığı (çağıran dahil)
+    uint64_t chunks;
+    uint64_t new_chunks;            // Depoya yazılan parça
+    uint64_t total_bytes;           // Yedekteki verinin toplamı
+    uint64_t scanned_bytes;         // Okunup parçalanan / geri yazılan
+    uint64_t new_bytes;             // Yeni parçaların ham boyutu
+    uint64_t stored_bytes;          // Depoya yazılan (sıkıştırılmış)
+    double elapsed_ms;
+    double mb_per_sec;              // total_bytes / süre
+    double dedup_ratio;             // total_bytes / (stored_bytes + manifest boyutu), yedeklemede
+} app_backup_stats_t;
+
+// source_dir'i backup_path'e yedekle. meta (ör. uygulama kaydı) manifeste
+// olduğu gibi yazılır. workers 0 ise çevrimiçi işlemci sayısı kullanılır.
+int app_backup_create(const char* source_dir, const char* backup_path, const void* meta, uint32_t meta_size,
+                      uint32_t workers, app_backup_stats_t* stats);
+
+// Yedeği target_dir'e geri yükle; target_dir NULL ise yedeklenen dizine
+int app_backup_restore(const char* backup_path, const char* target_dir, uint32_t workers, app_backup_stats_t* stats);
+
+// Manifestteki çağıran verisini oku
+int app_backup_read_meta(const char* backup_path, void* meta, uint32_t capacity, uint32_t* size);
+
+#endif /* APP_BACKUP_H */
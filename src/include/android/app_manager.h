@@ -50,7 +50,7 @@ typedef struct {
     /** Hedef SDK sürümü */
     uint32_t target_sdk_version;
     
-    /** APK dosya yolu */
+    /** Kurulum yolu (sistem uygulamalarında APK, diğerlerinde ayıklanmış içerik dizini) */
     char apk_path[512];
     
     /** Veri yolu */
@@ -0,0 +1,70 @@
+#ifndef ART_AOT_H
+#define ART_AOT_H
+
+#include <stdint.h>
+#include "dex_file.h"
+#include "art_interp.h"
+
+// Önceden (AOT) derleme. Uygulamanın DEX dosyalarındaki tüm metotlar kurulumda
+// JIT şablonlarıyla konumdan bağımsız koda çevrilir ve tek bir görüntü
+// dosyasına ("<apk>.oat") yazılır. Görüntü DEX sağlaması ve SHA-1 imzasıyla
+// anahtarlanır: DEX değişince görüntü eskimiş sayılır ve yeniden derlenir.
+//
+// Sonraki açılışlarda görüntü eşlenir (tablolar salt okunur, kod bölümü
+// çalıştırılabilir); metot ilk hazırlandığında kodu bağlanır ve yorumlayıcı ile
+// JIT ısınması atlanır. Görüntüdeki tek yer değiştirme içe aktarma tablosudur:
+// yardımcı adresleri yüklemede bu süreçte çözülür.
+//
+// Düzen: başlık, DEX kayıtları, metot tablosu (DEX başına method_idx sıralı),
+// giriş tabloları, sayfa hizalı kod bölümü (başında giriş/dönüş kodu).
+
+#define ART_AOT_MAGIC              "KOAT"
+#define ART_AOT_VERSION            1
+#define ART_AOT_EXTENSION          ".oat"
+#define ART_AOT_MAX_WORKERS        4       // Kurulum derleyici iş parçacığı üst sınırı
+
+// Hata kodları
+#define ART_AOT_ERROR_INVALID      -1      // Geçersiz parametre
+#define ART_AOT_ERROR_IO           -2      // Dosya okunamadı, yazılamadı ya da eşlenemedi
+#define ART_AOT_ERROR_FORMAT       -3      // Bozuk görüntü ya da başka mimari için derlenmiş
+#define ART_AOT_ERROR_STALE        -4      // Görüntü bu DEX dosyalarına ait değil
+#define ART_AOT_ERROR_NO_MEMORY    -5      // Bellek yetersiz
+#define ART_AOT_ERROR_STATE        -6      // Derleyici havuzu başlatılmamış ya da zaten başlatılmış
+#define ART_AOT_ERROR_UNSUPPORTED  -7      // Bu mimaride kod üretilemez
+
+typedef struct art_aot_image art_aot_image_t;
+
+// Derleme istatistikleri
+typedef struct {
+    uint32_t dex_files;             // Derlenen DEX sayısı
+    uint32_t compiled_methods;      // Görüntüye yazılan metot
+    uint32_t skipped_methods;       // Doğrulanamayan ya da derlenemeyen metot
+    uint64_t code_size;             // Kod bölümü (giriş/dönüş kodu dahil)
+    uint64_t image_size;            // Görüntü dosyası
+    double compile_ms;              // Derleme ve yazma süresi
+} art_aot_stats_t;
+
+// Kurulum derleyici havuzu
+int art_aot_init(uint32_t workers);
+void art_aot_cleanup(void);
+
+// APK, kurulum dizini ya da DEX dosyasını derle (eşzamanlı). stats NULL olabilir.
+int art_aot_compile(const char* path, const char* image_path, art_aot_stats_t* stats);
+int art_aot_compile_dex(dex_file_t** dex_files, uint32_t count, const char* image_path, art_aot_stats_t* stats);
+
+// Derlemeyi havuza sıraya koy; art_aot_wait tüm işler bitene dek bekler
+int art_aot_submit(const char* path, const char* image_path);
+void art_aot_wait(void);
+
+// Görüntüyü eşle ve DEX dosyalarıyla eşleştir. DEX dosyaları açık kaldıkça
+// görüntü de açık kalmalıdır; metotları yok edildikten sonra kapatılır.
+int art_aot_open(const char* image_path, dex_file_t** dex_files, uint32_t count, art_aot_image_t** image);
+void art_aot_close(art_aot_image_t* image);
+
+// Hazırlanan metodu açık görüntülerdeki koduna bağla (yorumlayıcı çağırır)
+void art_aot_bind(art_method_t* method);
+
+// Yükleme yolunun görüntü yolu ("<yol>.oat")
+int art_aot_image_path(const char* path, char* buffer, size_t size);
+
+#endif /* ART_AOT_H */
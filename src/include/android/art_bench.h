@@ -0,0 +1,39 @@
+#ifndef ART_BENCH_H
+#define ART_BENCH_H
+
+#include <stdint.h>
+#include "dex_file.h"
+
+// Yorumlayıcı mikro ölçümleri. İş yükleri bellekte kurulan küçük bir DEX'teki
+// metotlardır; her biri süre hedefine ulaşana dek büyütülerek çalıştırılır ve
+// sonucu C'de hesaplanan sağlamayla karşılaştırılır. JIT ve AOT çalışmaları için
+// karşılaştırma tabanıdır.
+
+#define ART_BENCH_WORKLOADS        8       // İş yükü sayısı
+
+// Hata kodları
+#define ART_BENCH_ERROR_INVALID    -1      // Geçersiz parametre
+#define ART_BENCH_ERROR_STATE      -2      // Yorumlayıcı başlatılmamış ya da iş parçacığı bağlı değil
+#define ART_BENCH_ERROR_DEX        -3      // Ölçüm DEX'i kurulamadı
+
+// Tek iş yükünün sonucu
+typedef struct {
+    const char* name;               // "loop", "virtual-poly", ...
+    const char* unit;               // İşlem birimi ("iterasyon", "çağrı", "eleman", ...)
+    uint64_t ops;                   // Son turda yapılan işlem
+    double seconds;                 // Son turun süresi
+    double ops_per_second;
+    uint8_t verified;               // Sonuç beklenen sağlamayla eşleşti mi?
+} art_bench_result_t;
+
+// Tüm iş yüklerini çalıştır; her tur en az min_seconds sürene dek büyütülür.
+// Çağıran iş parçacığı yorumlayıcıya bağlı olmalıdır.
+int art_bench_run(double min_seconds, art_bench_result_t* results, uint32_t max_results, uint32_t* count);
+
+// Sonuçları tablo olarak yazdır
+void art_bench_print(const art_bench_result_t* results, uint32_t count);
+
+// Ölçüm DEX'i (ilk çağrıda kurulur); AOT görüntüsü derlemek ve eşlemek için
+int art_bench_get_dex(dex_file_t** dex);
+
+#endif /* ART_BENCH_H */
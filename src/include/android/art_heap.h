@@ -0,0 +1,126 @@
+#ifndef ART_HEAP_H
+#define ART_HEAP_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "container_freezer.h"
+#include "container_resource.h"
+#include "container_checkpoint.h"
+
+// ART yığını: nesil tabanlı çöp toplayıcı.
+// Genç nesil: iş parçacığı yerel ayırma tamponlarına (TLAB) bölünen, işaretçi
+// kaydırmalı bir bölge. Küçük toplamada canlı nesneler eski nesle taşınır.
+// Eski nesil: taşınmayan, boyut sınıflı boş listelerle yönetilen alan. Eş
+// zamanlı modda arka planda işaretlenir (başlangıç anı görüntüsü yazma bariyeri),
+// kısa bir yeniden işaretleme duraklamasından sonra arka planda süpürülür.
+//
+// Kurallar: güvenli noktalar arasında tutulan nesne referansları kök olarak
+// kaydedilmeli, referans alanlarına yazma art_heap_write_ref ile yapılmalıdır.
+
+// Çöp toplama modları
+typedef enum {
+    ART_GC_STOP_THE_WORLD,          // Eski nesil tek duraklamada toplanır
+    ART_GC_CONCURRENT               // Eski nesil arka planda işaretlenir ve süpürülür
+} art_gc_mode_t;
+
+#define ART_HEAP_TLAB_SIZE         (32 * 1024)         // TLAB boyutu
+#define ART_HEAP_LARGE_OBJECT      (8 * 1024)          // Doğrudan eski nesle ayrılan boyut
+#define ART_HEAP_NURSERY_MAX       (32 * 1024 * 1024)  // Genç nesil üst sınırı
+#define ART_HEAP_OLD_TRIGGER       60                  // Eski nesil doluluğu (%) toplama eşiği
+
+// Hata kodları
+#define ART_HEAP_ERROR_INVALID     -1      // Geçersiz parametre veya bağlı olmayan iş parçacığı
+#define ART_HEAP_ERROR_NO_MEMORY   -2      // Yığın dolu
+#define ART_HEAP_ERROR_STATE       -3      // Yığın zaten oluşturulmuş / oluşturulmamış
+
+// Nesne başlığı. Başlığı ref_count adet referans yuvası, ardından ham veri izler.
+// 0xFFFF ve üzeri yuvalı nesnelerde (büyük referans dizileri) ref_count
+// ART_OBJECT_REFS_EXTENDED olur; gerçek sayı başlıktan sonraki ilk yuvada
+// tutulur ve referans yuvaları onun ardından başlar.
+typedef struct art_object {
+    uint32_t size;                  // Başlık dahil toplam boyut (16'nın katı)
+    uint16_t ref_count;             // Referans yuvası sayısı
+    uint8_t flags;                  // Toplayıcıya ait bayraklar
+    uint8_t mark;                   // İşaretleme dönemi
+    void* klass;                    // Sınıf tanımı
+} art_object_t;
+
+#define ART_OBJECT_REFS_EXTENDED   0xFFFF
+
+#define ART_OBJECT_REFS(object)    ((art_object_t**)((art_object_t*)(object) + 1) + \
+                                    ((object)->ref_count == ART_OBJECT_REFS_EXTENDED))
+#define ART_OBJECT_REF_COUNT(object) \
+    ((object)->ref_count != ART_OBJECT_REFS_EXTENDED ? (uint32_t)(object)->ref_count : \
+     *(uint32_t*)((art_object_t*)(object) + 1))
+#define ART_OBJECT_DATA(object)    ((uint8_t*)(ART_OBJECT_REFS(object) + ART_OBJECT_REF_COUNT(object)))
+
+// Yığın istatistikleri
+typedef struct {
+    uint64_t heap_size;             // Toplam yığın
+    uint64_t nursery_size;          // Genç nesil boyutu
+    uint64_t nursery_used;          // Genç nesilde dağıtılan bayt
+    uint64_t old_size;              // Eski nesil boyutu
+    uint64_t old_used;              // Eski nesilde kullanılan bayt
+    uint64_t total_allocated;       // Toplam ayrılan bayt
+    uint64_t promoted_bytes;        // Eski nesle taşınan bayt
+    uint64_t freed_bytes;           // Süpürmede serbest bırakılan bayt
+    uint32_t minor_count;           // Küçük toplama sayısı
+    uint32_t major_count;           // Eski nesil toplama sayısı
+    uint32_t pause_count;           // Dünyayı durdurma sayısı
+    float pause_avg_ms;             // Ortalama duraklama
+    float pause_p95_ms;             // Son duraklamaların 95. yüzdeliği
+    float pause_max_ms;             // En uzun duraklama
+    float gc_time_percent;          // Duraklamaların çalışma süresine oranı (%)
+    float fragmentation;            // Boş alanın büyük nesne sınırından küçük parçalardaki oranı
+} art_heap_stats_t;
+
+// Oluşturma / yok etme (süreç başına tek yığın)
+int art_heap_create(size_t heap_size, art_gc_mode_t mode);
+void art_heap_destroy(void);
+
+// İş parçacığı kaydı; nesne ayıran her iş parçacığı bağlı olmalıdır
+int art_heap_attach_thread(void);
+void art_heap_detach_thread(void);
+
+// Güvenli nokta ve bloklayan çağrı sınırları
+void art_heap_safepoint(void);
+const int* art_heap_suspend_flag(void);     // Derlenmiş kodun yokladığı durdurma/dondurma isteği
+void art_heap_thread_block(void);
+void art_heap_thread_unblock(void);
+
+// Ayırma ve yazma bariyeri
+art_object_t* art_heap_alloc(void* klass, uint32_t ref_count, uint32_t data_size);
+void art_heap_write_ref(art_object_t* object, uint32_t index, art_object_t* value);
+
+// Kökler: yuva adresleri kaydedilir, taşıma sırasında güncellenir
+int art_heap_add_root(art_object_t** slot);
+int art_heap_remove_root(art_object_t** slot);
+
+// İş parçacığına ait kök dizisi (ör. yorumlayıcının yazmaç yığını). Dizinin
+// ilk count yuvası kök sayılır; count'u yalnızca sahibi iş parçacığı değiştirir.
+// Kayıt kilitsizdir, çerçeveler ters sırada çıkarılmalıdır.
+typedef struct art_heap_frame {
+    struct art_heap_frame* prev;
+    art_object_t** slots;
+    uint32_t count;
+} art_heap_frame_t;
+
+void art_heap_push_frame(art_heap_frame_t* frame);
+void art_heap_pop_frame(art_heap_frame_t* frame);
+
+// Toplama: full = 0 küçük toplama, full = 1 tam eski nesil döngüsü
+int art_heap_collect(int full);
+int art_heap_get_stats(art_heap_stats_t* stats);
+
+// Konteyner bağlantısı. Bağlı ve sonradan bağlanan iş parçacıkları dondurucuya
+// kaydedilir: güvenli noktada ya da bloklayan çağrıda durmuş sayılır, çıkışta
+// çözülmeyi bekler. Yığın bölgesi denetim noktasına eklenir. Kullanılan yığın
+// (dağıtılan TLAB'lar ve eski nesildeki bloklar) kaynak grubuna sayfa olarak
+// ücretlendirilir, sınır aşılırsa ayırma toplamadan sonra başarısız olur;
+// iş parçacığı CPU süresi güvenli noktalarda ücretlendirilir. Süreçte tek
+// bağlantı olur; çözme yalnızca aynı dondurucuyla bağlanmışsa yapılır.
+int art_heap_bind_container(container_freezer_t* freezer, container_resource_t* resources,
+                            container_checkpoint_t* checkpoint);
+void art_heap_unbind_container(container_freezer_t* freezer);
+
+#endif /* ART_HEAP_H */
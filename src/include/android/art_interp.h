@@ -0,0 +1,169 @@
+#ifndef ART_INTERP_H
+#define ART_INTERP_H
+
+#include <stdint.h>
+#include "dex_file.h"
+#include "art_heap.h"
+
+// Dalvik bayt kod yorumlayıcısı. Her iş parçacığının bitişik bir yazmaç
+// yığını vardır: çerçeveler bu yığından pencere alır, nesne yazmaçları ayrı
+// bir dizide tutulur ve çöp toplayıcı yalnızca o diziyi tarar. Dağıtım
+// hesaplanmış goto ile yapılır. Metot ilk çalıştığında kodu doğrulanıp özel
+// bir kopyaya alınır; dizin işlenenleri komut başına önbellek yuvalarına
+// çevrilir (alanlar bir kez çözülür, sanal çağrılar alıcı sınıfına göre
+// monomorfik önbelleklenir).
+
+#define ART_INTERP_STACK_SLOTS     65536   // İş parçacığı başına yazmaç
+#define ART_INTERP_MAX_DEPTH       1024    // En fazla iç içe çağrı
+#define ART_INTERP_MAX_ARGS        255     // Bir çağrıdaki en fazla parametre yazmacı
+
+// Hata kodları
+#define ART_INTERP_ERROR_INVALID     -1    // Geçersiz parametre ya da bozuk bayt kod
+#define ART_INTERP_ERROR_NOT_FOUND   -2    // Sınıf, metot ya da alan çözülemedi
+#define ART_INTERP_ERROR_NO_MEMORY   -3    // Bellek yetersiz
+#define ART_INTERP_ERROR_EXCEPTION   -4    // Yakalanmamış istisna (art_interp_get_exception)
+#define ART_INTERP_ERROR_UNSUPPORTED -5    // Desteklenmeyen komut
+#define ART_INTERP_ERROR_STATE       -6    // Başlatılmamış ya da iş parçacığı bağlı değil
+
+// Sınıf durumları
+#define ART_CLASS_LINKED           0
+#define ART_CLASS_INITIALIZING     1       // <clinit> çalışıyor
+#define ART_CLASS_INITIALIZED      2
+#define ART_CLASS_ERROR            3
+
+// Dizi düzeni: veri alanının ilk 4 baytı uzunluktur. İlkel elemanlar 8. bayttan
+// başlar; referans dizilerinde elemanlar nesnenin referans yuvalarıdır.
+#define ART_ARRAY_LENGTH(object)   (*(int32_t*)ART_OBJECT_DATA(object))
+#define ART_ARRAY_DATA(object)     (ART_OBJECT_DATA(object) + 8)
+#define ART_CLASS_MAX_REF_FIELDS   (ART_OBJECT_REFS_EXTENDED - 1)  // Örnek alanları başlıktaki sayıya sığar
+
+// Java değeri; geniş tipler tek girdidir
+typedef union {
+    int32_t i;
+    int64_t j;
+    float f;
+    double d;
+    art_object_t* l;
+} art_value_t;
+
+typedef struct art_class art_class_t;
+typedef struct art_method art_method_t;
+
+// Yerel metot: args alıcıyla başlar. Nesne ayıramaz (taşıma işaretçileri bozar).
+typedef int (*art_native_method_t)(art_method_t* method, art_value_t* args, art_value_t* result);
+
+// Sınıf tanımlayıcısından bağlanmış DEX sınıfını bulan yükleyici geri çağrısı
+typedef int (*art_interp_resolver_t)(const char* descriptor, dex_class_t** klass);
+
+// Alan
+typedef struct {
+    art_class_t* klass;             // Tanımlayan sınıf
+    const char* name;
+    const char* type;               // Tip tanımlayıcısı
+    uint32_t offset;                // Referans: yuva sırası; ilkel: veri ofseti; statik: statics sırası
+    uint8_t is_static;
+    uint8_t is_ref;
+    uint8_t size;                   // İlkel alan boyutu (1, 2, 4, 8)
+} art_field_t;
+
+// Komut başına önbellek yuvası
+typedef struct {
+    uint32_t index;                 // Özgün field/method/type dizini
+    art_class_t* klass;             // Çözülen sınıf ya da son alıcı sınıfı
+    union {
+        art_field_t* field;
+        art_method_t* method;
+    };
+    uint32_t misses;                // Alıcı sınıfı değişimleri
+} art_inline_cache_t;
+
+// Metot
+struct art_method {
+    art_class_t* klass;
+    const char* name;
+    const char* signature;          // "(ILjava/lang/String;)V"
+    const char* shorty;             // "VIL"
+    uint32_t access_flags;
+    uint32_t method_idx;            // Tanımlandığı DEX'teki sıra
+    uint32_t vtable_index;          // Sanal metotlarda vtable yuvası
+    const dex_code_item_t* code;    // NULL: soyut ya da yerel
+    uint16_t registers_size;
+    uint16_t ins_size;              // Alıcı dahil parametre yazmaçları
+    uint16_t* insns;                // Hazırlanmış kod kopyası (ilk çalışmada)
+    art_inline_cache_t* caches;
+    uint32_t cache_count;
+    art_native_method_t native;
+    uint32_t invoke_count;          // Sıcaklık sayacı (yarışlı, yaklaşık)
+    uint32_t backedge_count;        // Geri dal sayacı (yarışlı, yaklaşık)
+    void* jit_code;                 // Derlenmiş kod (art_jit), yoksa NULL
+};
+
+// Çalışma zamanı sınıfı
+struct art_class {
+    dex_class_t* dex_class;         // Dizi sınıflarında NULL
+    const char* descriptor;
+    art_class_t* superclass;
+    art_class_t** interfaces;
+    uint32_t interface_count;
+    art_class_t* component;         // Dizilerde eleman sınıfı (ilkel ise NULL)
+    uint8_t component_size;         // Dizilerde eleman boyutu (0: referans)
+    uint8_t state;                  // ART_CLASS_*
+    uint32_t access_flags;
+    uint16_t ref_fields;            // Örnek başına referans yuvası (üst sınıflar dahil)
+    uint32_t data_size;             // Örnek başına ilkel veri (üst sınıflar dahil)
+    art_field_t* fields;            // Bu sınıfta tanımlı alanlar
+    uint32_t field_count;
+    art_method_t* methods;          // Bu sınıfta tanımlı metotlar
+    uint32_t method_count;
+    art_method_t** vtable;
+    uint32_t vtable_size;
+    art_value_t* statics;           // Statik alan değerleri
+    uint32_t static_count;
+    void* dex_cache;                // Tanımlandığı DEX'in çözüm tabloları
+    void* init_thread;              // <clinit> çalıştıran iş parçacığı
+    art_class_t* next;              // Kurulan sınıflar listesi
+};
+
+// Yorumlayıcı istatistikleri
+typedef struct {
+    uint32_t linked_classes;        // Çalışma zamanı sınıfı kurulan sınıf
+    uint32_t prepared_methods;      // Kodu hazırlanan metot
+    uint64_t cache_slots;           // Ayrılan önbellek yuvası
+    uint64_t cache_misses;          // Sanal/arayüz çağrısı önbellek kaçırmaları
+    uint64_t exceptions;            // Yakalanmamış istisnalar
+} art_interp_stats_t;
+
+// Başlatma / temizleme
+int art_interp_init(art_interp_resolver_t resolver);
+void art_interp_cleanup(void);
+
+// İş parçacığı kaydı (art_heap_attach_thread'den sonra)
+int art_interp_attach_thread(void);
+void art_interp_detach_thread(void);
+
+// Yerel metot kaydı; sınıf bağlanmadan önce yapılmalıdır
+int art_interp_register_native(const char* descriptor, const char* name, const char* signature,
+                               art_native_method_t function);
+
+// Sınıf ve metot arama
+int art_interp_get_class(dex_class_t* dex_class, art_class_t** klass);
+int art_interp_find_class(const char* descriptor, art_class_t** klass);
+int art_interp_find_method(art_class_t* klass, const char* name, const char* signature, art_method_t** method);
+
+// Nesne ayır (yapıcı çağrılmaz); dönen nesne için yukarıdaki kök kuralı geçerlidir
+int art_interp_alloc_object(art_class_t* klass, art_object_t** object);
+
+// Metodu çağır: args alıcıyla başlar, her parametre için bir değer (shorty sırası).
+// Dönen nesne köklenmemiştir; çağıran bir sonraki ayırmadan önce köke bağlamalıdır.
+int art_interp_invoke(art_method_t* method, const art_value_t* args, uint32_t arg_count, art_value_t* result);
+
+// Yerel metotlar istisnayı bununla bildirir; ART_INTERP_ERROR_EXCEPTION döner
+int art_interp_throw_new(const char* descriptor, const char* message);
+
+// Son yakalanmamış istisna ("Ljava/lang/NullPointerException;: ..."), yoksa NULL
+const char* art_interp_get_exception(void);
+void art_interp_clear_exception(void);
+
+int art_interp_get_stats(art_interp_stats_t* stats);
+
+#endif /* ART_INTERP_H */
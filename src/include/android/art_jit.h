@@ -0,0 +1,114 @@
+#ifndef ART_JIT_H
+#define ART_JIT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "art_interp.h"
+
+// Temel (şablon) JIT derleyicisi. Çağrı ve geri dal sayaçları eşiği geçen
+// metodun hazırlanmış bayt kodu komut komut x86 koduna çevrilir; yazmaçlar
+// yorumlayıcı çerçevesinde kalır, bu yüzden her komut sınırı hem giriş hem
+// çıkış noktasıdır. Döngüdeki metot geri dalda derlenmiş koda geçer (OSR).
+// Şablonu olmayan komutlarda ya da korumalar (boş nesne, sınıf, sınır)
+// tutmadığında kod o komutun adresiyle yorumlayıcıya döner.
+//
+// Kod i386 için üretilir; barındırılan x86-64 derlemesinde işaretçi boyutlu
+// erişimler REX.W önekiyle aynı şablonlardan çıkar. Kod önbelleği sabit
+// boyutludur ve dolunca en uzun süre kullanılmamış (LRU) metotlar çıkarılır.
+//
+// Aynı şablonlar AOT görüntüsü için konumdan bağımsız da üretilir (art_aot):
+// görüntü kodunda mutlak adres yoktur, yardımcılar çerçevedeki içe aktarma
+// tablosundan çağrılır, önbellek korumaları yuvaları çalışırken okur.
+
+#define ART_JIT_MIN_CACHE          (64 * 1024)     // En küçük kod önbelleği
+#define ART_JIT_ALIGN              16              // Kod bloğu hizası
+#define ART_JIT_RETURNED           0x7FFFFFFF      // art_jit_run: metot derlenmiş kodda döndü
+
+// Hata kodları
+#define ART_JIT_ERROR_INVALID      -1      // Geçersiz parametre
+#define ART_JIT_ERROR_NO_MEMORY    -2      // Kod önbelleği ayrılamadı ya da boşaltılamadı
+#define ART_JIT_ERROR_STATE        -3      // JIT başlatılmamış ya da zaten başlatılmış
+#define ART_JIT_ERROR_UNSUPPORTED  -4      // Derlenemeyen metot (yerel, soyut, hazırlanmamış)
+
+// Derlenmiş kodun çalıştığı çerçeve. Taban yazmaçları yardımcı çağrılarından
+// sonra buradan yeniden yüklenir.
+typedef struct {
+    uint32_t* vregs;                // Çerçevenin ilkel yazmaçları
+    art_object_t** refs;            // Çerçevenin nesne yazmaçları
+    void* thread;                   // Yorumlayıcı iş parçacığı
+    art_method_t* method;
+    art_value_t* result;            // Son dönen ilkel değer (move-result)
+    art_object_t** returned;        // Son dönen nesne (move-result-object)
+    const int* suspend;             // Çöp toplayıcının durdurma isteği
+    const void* const* imports;     // Yardımcılar (ART_JIT_SYMBOL_* sırası)
+    art_inline_cache_t* caches;     // Metodun önbellek yuvaları
+} art_jit_frame_t;
+
+// Derlenmiş kodun çağırdığı yardımcılar; görüntüler bu sırayla bağlanır
+enum {
+    ART_JIT_SYMBOL_INVOKE,          // art_interp_jit_invoke
+    ART_JIT_SYMBOL_NEW_INSTANCE,    // art_interp_jit_new_instance
+    ART_JIT_SYMBOL_ALLOC,           // art_heap_alloc
+    ART_JIT_SYMBOL_COUNT
+};
+
+// JIT istatistikleri
+typedef struct {
+    uint32_t compiled_methods;      // Önbellekteki metot
+    uint32_t compilations;          // Toplam derleme (yeniden derlemeler dahil)
+    uint32_t failed;                // Yer açılamadığı için derlenemeyen
+    uint32_t invoke_heavy;          // Çağrı yoğun olduğu için yorumlanan
+    uint32_t evictions;             // LRU ile çıkarılan metot
+    uint64_t cache_size;            // Kod önbelleği boyutu
+    uint64_t cache_used;            // Kullanılan bayt
+    uint64_t hits;                  // Derlenmiş koda girişler
+    uint64_t misses;                // Sıcak ama önbellekte olmayan metot
+    uint64_t osr_entries;           // Döngü ortasından girişler
+    uint64_t bailouts;              // Komut ortasında yorumlayıcıya dönüşler
+    float hit_rate;                 // hits / (hits + misses), %
+} art_jit_stats_t;
+
+// Sıcaklık eşiği (çağrı + geri dal); 0 ise JIT kapalıdır
+extern uint32_t art_jit_threshold;
+
+// Başlatma / temizleme
+int art_jit_init(size_t code_cache_size, uint32_t threshold);
+void art_jit_cleanup(void);
+
+// Tüm derlenmiş kodu at (çalışan kod bitince yeri boşalır)
+void art_jit_flush(void);
+
+// Sıcak metodu derle; yer yoksa LRU metotlar çıkarılır. Çağrı yoğun metotlar
+// ART_JIT_ERROR_UNSUPPORTED ile yorumlayıcıda bırakılır.
+int art_jit_compile(art_method_t* method);
+
+// Çerçeveyi dex pc'sinden itibaren derlenmiş kodda çalıştır. Yorumlayıcının
+// devam edeceği pc'yi (kod yoksa pc'nin kendisi), metot döndüyse
+// ART_JIT_RETURNED, istisnada ART_INTERP_ERROR_* döner.
+int art_jit_run(art_jit_frame_t* frame, uint32_t pc);
+
+int art_jit_get_stats(art_jit_stats_t* stats);
+
+// Görüntü kodu. Giriş/dönüş kodu görüntünün başına yazılır (en çok
+// ART_JIT_STUB_SIZE bayt); metotlar görüntüdeki code_offset'lerine göre bağlanır.
+// entries metodun kodundan ofset + 1'dir (0: giriş noktası değil).
+#define ART_JIT_STUB_SIZE          64
+
+int art_jit_image_stubs(uint8_t* buffer, uint32_t* epilogue);
+int art_jit_compile_image(art_method_t* method, uint32_t code_offset, uint32_t epilogue,
+                          uint8_t** code, uint32_t* size, uint32_t** entries);
+const void* art_jit_symbol(uint32_t symbol);
+
+// Eşlenmiş görüntü kodunu hazırlanmış metoda bağla. Görüntü kodu çıkarılmaz;
+// sahibinin tanımlayıcıları yalnızca metotlar yok olduktan sonra bırakılır.
+int art_jit_attach_image(art_method_t* method, const uint8_t* code, const uint32_t* entries,
+                         const uint8_t* trampoline, const void* const* imports, const void* owner);
+void art_jit_detach_images(const void* owner);
+
+// Yorumlayıcının derlenmiş koda sağladıkları (art_interp.c)
+uint32_t art_interp_insn_width(const uint16_t* insns, uint32_t remaining);
+int art_interp_prepare_method(art_method_t* method, dex_file_t* dex);
+int art_interp_jit_invoke(art_jit_frame_t* frame, uint32_t pc);
+int art_interp_jit_new_instance(art_jit_frame_t* frame, uint32_t pc);
+
+#endif /* ART_JIT_H */
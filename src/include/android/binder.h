@@ -0,0 +1,70 @@
+#ifndef ANDROID_BINDER_H
+#define ANDROID_BINDER_H
+
+#include <stdint.h>
+
+// Binder benzeri IPC taşıma katmanı.
+// Her servis kendi sürecini temsil eder ve mmap ile ayrılmış bir alım tamponuna
+// sahiptir; gönderilen paket bu tampona tek kez kopyalanır ve servis tarafından
+// yerinde okunur. İşlemler servisin döngü (looper) iş parçacıklarında işlenir.
+
+#define BINDER_SERVICE_NAME_MAX      64
+#define BINDER_HASH_SIZE             64                     // 2'nin kuvveti olmalı
+#define BINDER_BUFFER_SIZE           (1024 * 1024 - 8192)   // Süreç başına alım tamponu
+#define BINDER_MAX_THREADS           16                     // Servis başına en fazla döngü iş parçacığı
+#define BINDER_DEFAULT_MAX_THREADS   15
+
+// İşlem bayrakları
+#define BINDER_FLAG_ONEWAY           0x01    // Yanıt beklenmez, gönderen hemen döner
+
+// Binder hata kodları
+#define BINDER_SUCCESS               0
+#define BINDER_ERROR_INVALID         -1      // Geçersiz parametre
+#define BINDER_ERROR_NOT_FOUND       -2      // Servis bulunamadı
+#define BINDER_ERROR_NO_SPACE        -3      // Hedefin alım tamponu dolu
+#define BINDER_ERROR_DEAD            -4      // Servis kaldırıldı
+#define BINDER_ERROR_NO_MEMORY       -5      // Bellek ayrılamadı
+#define BINDER_ERROR_REPLY_TOO_LARGE -6      // Yanıt tampona sığmıyor
+#define BINDER_ERROR_NO_HANDLER      -7      // Servisin işlem işleyicisi yok
+
+// Paket (Parcel)
+typedef struct {
+    uint8_t* data;                 // Paket verisi
+    uint32_t size;                 // Kullanılan bayt sayısı
+    uint32_t capacity;             // Ayrılmış bayt sayısı
+} binder_parcel_t;
+
+// Servis tarafı işlem işleyicisi. 'data' servisin alım tamponunda bulunur ve
+// yalnızca işleyici dönene kadar geçerlidir; yanıt doğrudan gönderenin tamponuna yazılır.
+typedef int (*binder_transact_handler_t)(void* service, uint32_t code,
+                                         const binder_parcel_t* data, binder_parcel_t* reply);
+
+// Binder istatistikleri
+typedef struct {
+    uint64_t transactions;         // Toplam işlem sayısı
+    uint64_t oneway_transactions;  // Tek yönlü işlem sayısı
+    uint64_t bytes_copied;         // Alım tamponlarına kopyalanan bayt
+    uint64_t buffer_full;          // Alım tamponu dolu olduğu için reddedilen işlemler
+    uint64_t threads_spawned;      // Başlatılan döngü iş parçacıkları
+    uint32_t service_count;        // Kayıtlı servis sayısı
+} binder_stats_t;
+
+// Binder sistemini başlat / kapat
+int binder_initialize();
+int binder_cleanup();
+
+// Servis yönetimi
+int binder_register_service(const char* name, void* service);
+int binder_add_service(const char* name, void* service, binder_transact_handler_t handler, uint32_t max_threads);
+int binder_remove_service(const char* name);
+void* binder_get_service(const char* name);
+
+// İşlemler
+int binder_transact(void* service, uint32_t code, const void* data, uint32_t size,
+                    void* reply, uint32_t reply_capacity, uint32_t* reply_size, uint32_t flags);
+int binder_parcel_write(binder_parcel_t* parcel, const void* data, uint32_t size);
+
+// İstatistikler
+int binder_get_stats(binder_stats_t* stats);
+
+#endif /* ANDROID_BINDER_H */
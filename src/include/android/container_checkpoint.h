@@ -0,0 +1,60 @@
+#ifndef CONTAINER_CHECKPOINT_H
+#define CONTAINER_CHECKPOINT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "container_overlay.h"
+
+// Konteyner denetim noktası: kayıtlı bellek bölgeleri ve açık dosyalar yerel bir
+// imaja yazılır. İlk kayıttan sonra bölgeler yazmaya karşı korunur; yazılan
+// sayfalar hata yakalayıcıda kirli işaretlenir ve sonraki kayıtlar yalnızca
+// bu sayfaları yazar. Kirli sayfalar önce bir günlüğe yazılır ve başlık yerine
+// taşındıktan sonra imaja uygulanır; yarıda kesilen kayıt bir önceki kaydı
+// bozmaz. Geri yükleme imajı bölgelere eşler, sayfalar ilk erişimde okunur.
+// Kayıt sırasında konteyner dondurulmuş olmalıdır.
+
+#define CHECKPOINT_MAX_REGIONS         64
+#define CHECKPOINT_MAX_FILES           256
+#define CHECKPOINT_PAGE_SIZE           4096
+
+// Hata kodları
+#define CHECKPOINT_ERROR_INVALID       -1      // Geçersiz parametre
+#define CHECKPOINT_ERROR_IO            -2      // İmaj okunamadı / yazılamadı
+#define CHECKPOINT_ERROR_NO_MEMORY     -3      // Bellek ya da tablo dolu
+#define CHECKPOINT_ERROR_FORMAT        -4      // İmaj bozuk ya da uyumsuz
+
+typedef struct container_checkpoint container_checkpoint_t;
+
+// Denetim noktası istatistikleri
+typedef struct {
+    uint32_t regions;              // Kayıtlı bellek bölgesi sayısı
+    uint32_t files;                // İzlenen açık dosya sayısı
+    uint64_t checkpoints;          // Alınan kayıt sayısı
+    uint64_t generation;           // İmajdaki son kayıt numarası
+    uint64_t last_pages_written;   // Son kayıtta yazılan sayfa
+    uint64_t pages_written;        // Toplam yazılan sayfa
+    uint64_t dirty_faults;         // Kirli sayfa hata sayısı
+    uint64_t last_save_us;         // Son kayıt süresi
+    uint64_t last_restore_us;      // Son geri yükleme süresi
+} checkpoint_stats_t;
+
+// Oluşturma / yok etme
+container_checkpoint_t* checkpoint_create(const char* image_dir);
+void checkpoint_destroy(container_checkpoint_t* checkpoint);
+
+// Bellek bölgeleri (sayfa hizalı, mmap ile ayrılmış olmalı)
+int checkpoint_add_region(container_checkpoint_t* checkpoint, void* address, size_t size);
+int checkpoint_remove_region(container_checkpoint_t* checkpoint, void* address);
+
+// Açık dosyalar (yol konteyner köküne göre)
+int checkpoint_track_file(container_checkpoint_t* checkpoint, int fd, const char* path, int flags);
+int checkpoint_untrack_file(container_checkpoint_t* checkpoint, int fd);
+
+// Kaydet / geri yükle
+int checkpoint_save(container_checkpoint_t* checkpoint);
+int checkpoint_restore(container_checkpoint_t* checkpoint, overlay_t* filesystem);
+
+// İstatistikler
+int checkpoint_get_stats(container_checkpoint_t* checkpoint, checkpoint_stats_t* stats);
+
+#endif /* CONTAINER_CHECKPOINT_H */
@@ -0,0 +1,49 @@
+#ifndef CONTAINER_FREEZER_H
+#define CONTAINER_FREEZER_H
+
+#include <stdint.h>
+
+// Konteyner dondurucu: kayıtlı iş parçacıkları güvenli noktalarda durdurulur.
+// Çalışma zamanı iş parçacıkları freezer_safepoint'i döngülerinde ve uzun
+// işlemlerden önce çağırır; bloklayan çağrılara girerken freezer_thread_block ile
+// kendilerini "güvenli" ilan ederler.
+
+// Dondurucu durumları
+#define FREEZER_THAWED             0       // Çalışıyor
+#define FREEZER_FREEZING           1       // İş parçacıkları güvenli noktaya bekleniyor
+#define FREEZER_FROZEN             2       // Tüm iş parçacıkları durdu
+
+// Hata kodları
+#define FREEZER_ERROR_INVALID      -1      // Geçersiz parametre
+#define FREEZER_ERROR_STATE        -2      // Bu durumda işlem yapılamaz
+#define FREEZER_ERROR_TIMEOUT      -3      // İş parçacıkları zamanında durmadı
+
+typedef struct container_freezer container_freezer_t;
+
+// Donma başlarken (FREEZER_FREEZING) ve çözülürken (FREEZER_THAWED) dondurucu
+// kilidi altında çağrılır. Güvenli noktayı kendi bayrağından yoklayan
+// çalışma zamanı (ör. derlenmiş kod) isteği bununla görür; bekleyemez.
+typedef void (*freezer_notify_t)(void* context, int state);
+
+container_freezer_t* freezer_create(void);
+void freezer_destroy(container_freezer_t* freezer);
+
+// İş parçacığı kaydı
+int freezer_thread_enter(container_freezer_t* freezer);
+void freezer_thread_exit(container_freezer_t* freezer);
+
+// Güvenli nokta; donma isteği varsa çözülene kadar bekler
+void freezer_safepoint(container_freezer_t* freezer);
+
+// Bloklayan çağrı sınırları (uyku, I/O, futex vb.)
+void freezer_thread_block(container_freezer_t* freezer);
+void freezer_thread_unblock(container_freezer_t* freezer);
+
+// Dondur / çöz
+int freezer_freeze(container_freezer_t* freezer, uint32_t timeout_ms);
+int freezer_thaw(container_freezer_t* freezer);
+int freezer_get_state(container_freezer_t* freezer);
+uint32_t freezer_get_thread_count(container_freezer_t* freezer);
+void freezer_set_notify(container_freezer_t* freezer, freezer_notify_t notify, void* context);
+
+#endif /* CONTAINER_FREEZER_H */
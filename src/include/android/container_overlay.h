@@ -0,0 +1,65 @@
+#ifndef CONTAINER_OVERLAY_H
+#define CONTAINER_OVERLAY_H
+
+#include <stdint.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+// Konteyner kök dosya sistemi için yazarken kopyalanan (copy-on-write) birleşik katman.
+// Alt katman: tüm konteynerlerin paylaştığı salt okunur Android sistem ağacı.
+// Üst katman: konteynere özel dizin; değiştirilen dosyalar buraya kopyalanır,
+// silinen alt katman dosyaları ".wh.<ad>" beyaz çıkışlarıyla gizlenir.
+
+#define OVERLAY_PATH_MAX           512
+#define OVERLAY_WHITEOUT_PREFIX    ".wh."
+#define OVERLAY_OPAQUE_MARKER      ".wh..wh..opq"
+
+// Yolun çözüldüğü katman
+#define OVERLAY_LAYER_UPPER        1
+#define OVERLAY_LAYER_LOWER        2
+
+// Hata kodları
+#define OVERLAY_ERROR_INVALID      -1      // Geçersiz parametre veya yol
+#define OVERLAY_ERROR_NOT_FOUND    -2      // Dosya yok (ya da beyaz çıkışla gizlenmiş)
+#define OVERLAY_ERROR_EXISTS       -3      // Dosya zaten var
+#define OVERLAY_ERROR_IO           -4      // Ana sistem dosya işlemi başarısız
+#define OVERLAY_ERROR_NO_MEMORY    -5      // Bellek yetersiz
+#define OVERLAY_ERROR_NO_SPACE     -6      // Üst katman disk kotası aşıldı
+
+typedef struct overlay overlay_t;
+
+// Birleşik katman istatistikleri
+typedef struct {
+    uint32_t lower_entries;        // Paylaşılan alt katman dizinindeki girdi sayısı
+    uint32_t lower_refs;           // Alt katmanı paylaşan konteyner sayısı
+    uint32_t upper_entries;        // Üst katmandaki girdi sayısı (beyaz çıkışlar dahil)
+    uint64_t copy_ups;             // Üst katmana kopyalanan dosya sayısı
+    uint64_t copy_up_bytes;        // Kopyalanan toplam bayt
+    uint64_t whiteouts;            // Oluşturulan beyaz çıkış sayısı
+    uint64_t upper_bytes;          // Üst katmandaki dosyaların toplam boyutu
+    uint64_t quota_bytes;          // Üst katman disk kotası (0 = sınırsız)
+} overlay_stats_t;
+
+// Oluşturma / yok etme
+overlay_t* overlay_create(const char* lower_root, const char* upper_root);
+void overlay_destroy(overlay_t* overlay);
+
+// Dosya işlemleri (yollar konteyner köküne göredir, örn. "/system/bin/sh")
+int overlay_lookup(overlay_t* overlay, const char* path, char* host_path, uint32_t size);
+int overlay_open(overlay_t* overlay, const char* path, int flags, mode_t mode);
+int overlay_stat(overlay_t* overlay, const char* path, struct stat* st);
+int overlay_unlink(overlay_t* overlay, const char* path);
+int overlay_mkdir(overlay_t* overlay, const char* path, mode_t mode);
+int overlay_readdir(overlay_t* overlay, const char* path,
+                    int (*callback)(const char* name, mode_t mode, void* user_data), void* user_data);
+
+// Kotalı yazma: üst katman dosyalarına yazmalar bu yoldan yapılırsa disk kullanımı
+// dizin taranmadan güncel tutulur
+ssize_t overlay_write(overlay_t* overlay, int fd, const void* buffer, size_t size);
+int overlay_truncate(overlay_t* overlay, int fd, off_t length);
+int overlay_set_quota(overlay_t* overlay, uint64_t quota_bytes);
+
+// İstatistikler
+int overlay_get_stats(overlay_t* overlay, overlay_stats_t* stats);
+
+#endif /* CONTAINER_OVERLAY_H */
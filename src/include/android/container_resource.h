@@ -0,0 +1,60 @@
+#ifndef CONTAINER_RESOURCE_H
+#define CONTAINER_RESOURCE_H
+
+#include <stdint.h>
+#include "android_container.h"
+
+// Konteyner başına kaynak denetleyicisi (cgroup benzeri).
+// Bellek sayfa sayfa ücretlendirilir, CPU süresi kota/dönem ile sınırlanır,
+// işlem sayısı sayılır. Sınır değeri 0 olan kaynak sınırsızdır.
+
+#define RESOURCE_PAGE_SIZE             4096
+#define RESOURCE_CPU_PERIOD_US         100000      // CPU bant genişliği dönemi (100 ms)
+
+// Hata kodları
+#define RESOURCE_ERROR_INVALID         -1          // Geçersiz parametre
+#define RESOURCE_ERROR_NO_MEMORY       -2          // Denetleyici için bellek ayrılamadı
+#define RESOURCE_ERROR_LIMIT           -3          // Sınır aşıldı, ücretlendirme reddedildi
+
+typedef struct container_resource container_resource_t;
+
+// Anlık kaynak kullanımı
+typedef struct {
+    uint64_t memory_bytes;         // Ücretlendirilmiş bellek
+    uint64_t memory_peak_bytes;    // En yüksek bellek kullanımı
+    uint64_t memory_failures;      // Sınır nedeniyle reddedilen ücretlendirmeler
+    uint64_t cpu_time_us;          // Toplam CPU süresi
+    float cpu_percent;             // Son tamamlanan dönemdeki CPU kullanımı (%)
+    uint64_t cpu_periods;          // Geçen dönem sayısı
+    uint64_t cpu_throttled;        // Kısıtlanan dönem sayısı
+    uint64_t cpu_throttled_us;     // Kısıtlamada beklenen toplam süre
+    uint32_t processes;            // Çalışan işlem sayısı
+} container_resource_usage_t;
+
+// Çalışma dilimi takibi (iş parçacığı başına)
+typedef struct {
+    uint64_t last_cpu_us;          // Son kontrol noktasındaki iş parçacığı CPU zamanı
+} resource_cpu_slice_t;
+
+// Oluşturma / yok etme
+container_resource_t* resource_group_create(const container_limits_t* limits);
+void resource_group_destroy(container_resource_t* group);
+int resource_set_limits(container_resource_t* group, const container_limits_t* limits);
+
+// Bellek: sayfa ücretlendirme
+int resource_charge_pages(container_resource_t* group, uint64_t pages);
+void resource_uncharge_pages(container_resource_t* group, uint64_t pages);
+
+// CPU: çalışma süresini ücretlendir; kota bittiyse dönem sonuna kadar bekler
+int resource_cpu_charge(container_resource_t* group, uint64_t runtime_us);
+void resource_cpu_slice_begin(resource_cpu_slice_t* slice);
+int resource_cpu_checkpoint(container_resource_t* group, resource_cpu_slice_t* slice);
+
+// İşlem sayısı
+int resource_charge_process(container_resource_t* group);
+void resource_uncharge_process(container_resource_t* group);
+
+// Kullanım bilgisi
+int resource_get_usage(container_resource_t* group, container_resource_usage_t* usage);
+
+#endif /* CONTAINER_RESOURCE_H */
@@ -0,0 +1,136 @@
+#ifndef DEX_FILE_H
+#define DEX_FILE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "android_runtime.h"
+
+// Bellek eşlemeli (mmap) DEX dosyası. Dosya salt okunur eşlenir; başlık dışında
+// hiçbir bölüm açılışta okunmaz. string_ids ve type_ids içerikçe sıralı olduğu
+// için ikili aramayla, sıralı olmayan class_defs ise ilk kullanımda kurulan
+// karma dizinle aranır. Sınıflar yalnızca istendiklerinde çözülür.
+
+#define DEX_MAGIC                  "dex\n"
+#define DEX_HEADER_SIZE            0x70
+#define DEX_ENDIAN_CONSTANT        0x12345678
+#define DEX_NO_INDEX               0xFFFFFFFF
+
+// Bir APK içinde aranacak en fazla DEX sayısı (classes.dex, classes2.dex, ...)
+#define DEX_MAX_APK_FILES          16
+
+// Erişim bayrakları (yalnızca çalışma zamanının baktıkları)
+#define DEX_ACC_PUBLIC             0x0001
+#define DEX_ACC_PRIVATE            0x0002
+#define DEX_ACC_STATIC             0x0008
+#define DEX_ACC_FINAL              0x0010
+#define DEX_ACC_NATIVE             0x0100
+#define DEX_ACC_INTERFACE          0x0200
+#define DEX_ACC_ABSTRACT           0x0400
+#define DEX_ACC_CONSTRUCTOR        0x10000
+
+// Hata kodları
+#define DEX_ERROR_INVALID          -1      // Geçersiz parametre
+#define DEX_ERROR_IO               -2      // Dosya açılamadı veya eşlenemedi
+#define DEX_ERROR_FORMAT           -3      // Bozuk başlık, bölüm veya APK girdisi
+#define DEX_ERROR_NOT_FOUND        -4      // Sınıf bu DEX içinde yok
+#define DEX_ERROR_NO_MEMORY        -5      // Bellek yetersiz
+
+typedef struct dex_file dex_file_t;
+
+// Çözülmüş sınıf. Dizgiler eşlenmiş dosyanın içini gösterir (MUTF-8).
+typedef struct dex_class {
+    dex_file_t* dex;                // Sınıfın bulunduğu DEX
+    uint32_t class_def_idx;         // class_defs içindeki sıra
+    uint32_t type_idx;              // Sınıfın tip tanımlayıcısı
+    const char* descriptor;         // "Ljava/lang/Object;"
+    const char* superclass_descriptor; // Üst sınıf (yoksa NULL)
+    uint32_t access_flags;          // ACC_* bayrakları
+    uint32_t static_fields_size;    // class_data başlığından
+    uint32_t instance_fields_size;
+    uint32_t direct_methods_size;
+    uint32_t virtual_methods_size;
+    const uint8_t* class_data;      // Alan/metot listeleri (başlıktan sonra)
+    const uint16_t* interfaces;     // Uygulanan arayüzlerin type_idx listesi
+    uint32_t interfaces_size;
+    struct dex_class* superclass;   // Sınıf yükleyici tarafından bağlanır
+    uint8_t linked;                 // Üst sınıf bağlandı mı?
+    void* runtime;                  // Yorumlayıcının kurduğu çalışma zamanı sınıfı
+} dex_class_t;
+
+// Alan, metot ve prototip tanımlayıcıları; dosyadaki biçimleriyle eşlemeyi gösterir
+typedef struct {
+    uint16_t class_idx;             // Tanımlayan sınıf
+    uint16_t type_idx;              // Alan tipi
+    uint32_t name_idx;
+} dex_field_id_t;
+
+typedef struct {
+    uint16_t class_idx;             // Tanımlayan sınıf
+    uint16_t proto_idx;
+    uint32_t name_idx;
+} dex_method_id_t;
+
+typedef struct {
+    uint32_t shorty_idx;            // "IJL" gibi kısa imza (önce dönüş tipi)
+    uint32_t return_type_idx;
+    uint32_t parameters_off;        // type_list (parametre yoksa 0)
+} dex_proto_id_t;
+
+// Metot gövdesi
+typedef struct {
+    uint16_t registers_size;
+    uint16_t ins_size;              // Parametre yazmaçları (son yazmaçlar)
+    uint16_t outs_size;
+    uint16_t tries_size;
+    uint32_t debug_info_off;
+    uint32_t insns_size;            // 16 bitlik kod birimi sayısı
+    uint16_t insns[];
+} dex_code_item_t;
+
+// class_data içindeki alan ya da metot girdisi (sıra farkları çözülmüş)
+typedef struct {
+    uint32_t idx;                   // field_idx ya da method_idx
+    uint32_t access_flags;
+    uint32_t code_off;              // Yalnızca metotlar; soyut ve yerel metotlarda 0
+} dex_member_t;
+
+// DEX istatistikleri
+typedef struct {
+    uint32_t string_count;          // string_ids_size
+    uint32_t type_count;            // type_ids_size
+    uint32_t class_count;           // class_defs_size
+    uint32_t resolved_classes;      // Şimdiye kadar çözülen sınıf sayısı
+    uint8_t class_index_built;      // class_defs dizini kuruldu mu?
+    uint64_t mapped_bytes;          // Eşlenen bayt sayısı
+} dex_stats_t;
+
+// Açma / kapatma
+int dex_open(const char* path, dex_file_t** dex);
+int dex_open_apk(const char* apk_path, dex_file_t** dex_files, uint32_t max_files, uint32_t* count);
+int dex_open_dir(const char* dir, dex_file_t** dex_files, uint32_t max_files, uint32_t* count);
+int dex_open_memory(const void* data, size_t size, dex_file_t** dex);
+void dex_close(dex_file_t* dex);
+
+// Arama
+int dex_find_class(dex_file_t* dex, const char* descriptor, dex_class_t** klass);
+int dex_get_class(dex_file_t* dex, uint32_t class_def_idx, dex_class_t** klass);   // Sırayla (tüm sınıfları gezmek için)
+const char* dex_get_string(dex_file_t* dex, uint32_t string_idx);
+const char* dex_get_type_descriptor(dex_file_t* dex, uint32_t type_idx);
+const dex_header_t* dex_get_header(dex_file_t* dex);
+int dex_get_stats(dex_file_t* dex, dex_stats_t* stats);
+
+// Tanımlayıcı tabloları ve metot gövdeleri; sınır dışı girdilerde NULL
+const dex_field_id_t* dex_get_field_id(dex_file_t* dex, uint32_t field_idx);
+const dex_method_id_t* dex_get_method_id(dex_file_t* dex, uint32_t method_idx);
+const dex_proto_id_t* dex_get_proto_id(dex_file_t* dex, uint32_t proto_idx);
+const uint16_t* dex_get_type_list(dex_file_t* dex, uint32_t offset, uint32_t* count);
+const dex_code_item_t* dex_get_code_item(dex_file_t* dex, uint32_t code_off);
+
+// class_data listelerini sırasıyla (statik alanlar, örnek alanları, doğrudan
+// metotlar, sanal metotlar) members dizisine aç; dizi boyutların toplamı kadardır
+int dex_get_class_members(const dex_class_t* klass, dex_member_t* members);
+
+// Tüm dosyanın Adler-32 sağlamasını doğrular (tüm sayfalara dokunur)
+int dex_verify_checksum(dex_file_t* dex);
+
+#endif /* DEX_FILE_H */
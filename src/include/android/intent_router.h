@@ -0,0 +1,101 @@
+#ifndef INTENT_ROUTER_H
+#define INTENT_ROUTER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Intent çözümleme ve dağıtımı.
+// Paketlerin intent filtreleri kurulumda bir indekse derlenir: eylem dizesi
+// karma ile bir filtre kovasına, kategoriler 64 bitlik bir maskeye, MIME türü
+// iki sayısal kimliğe (ana tür / alt tür) çevrilir. Çözümleme eylem kovasını
+// maske ve kimlik karşılaştırmalarıyla tarar; dize karşılaştırması yapılmaz.
+//
+// Teslim zaman uyumsuzdur: her paketin sıralı bir kuyruğu vardır ve kuyruklar
+// sınırlı sayıda işçi iş parçacığı tarafından boşaltılır. Bir paketin
+// intentleri sırayla ve hiçbir zaman aynı anda iki işçide işlenmez. Yayındaki
+// intent tek kez oluşturulur, tüm alıcılar aynı nesneyi paylaşır.
+
+#define INTENT_ACTION_MAX          128
+#define INTENT_TYPE_MAX            64
+#define INTENT_CATEGORY_LIMIT      64      // Farklı kategori sayısı (maske genişliği)
+#define INTENT_QUEUE_DEPTH         256     // Paket başına bekleyen intent
+#define INTENT_MAX_WORKERS         8
+#define INTENT_BATCH               32      // İşçinin bir pakette art arda teslim ettiği intent
+
+// Hata kodları
+#define INTENT_ERROR_INVALID       -1      // Geçersiz parametre
+#define INTENT_ERROR_NO_MEMORY     -2      // Bellek yetersiz
+#define INTENT_ERROR_NOT_FOUND     -3      // Eşleşen alıcı ya da paket yok
+#define INTENT_ERROR_FULL          -4      // Kategori tablosu dolu
+#define INTENT_ERROR_BUSY          -5      // Alıcının kuyruğu dolu
+
+// Filtre tanımı (manifestteki <intent-filter>)
+typedef struct {
+    const char* action;
+    const char* type;                   // "image/png", "image/*", "*/*"; NULL: yalnızca türsüz intentler
+    const char* const* categories;      // NULL ile biten dizi; NULL olabilir
+} intent_filter_t;
+
+// Teslim edilen intent. Yayında tüm alıcılar aynı nesneyi görür; işleyici
+// dönünce geçerliliği biter.
+typedef struct {
+    char action[INTENT_ACTION_MAX];
+    char type[INTENT_TYPE_MAX];
+    char component[INTENT_ACTION_MAX];  // Açık intentte kayıtsız bileşen adı
+    uint64_t categories;                // Kategori maskesi
+    void* extras;
+    uint64_t sent_ns;                   // Gönderim zamanı (CLOCK_MONOTONIC)
+    uint32_t refs;                      // İç kullanım
+} intent_message_t;
+
+// Eşleşme
+typedef struct {
+    const char* package;
+    const char* component;
+} intent_match_t;
+
+// Teslim işleyicisi; işçi iş parçacığında çağrılır
+typedef void (*intent_handler_t)(const char* package, const char* component, const intent_message_t* intent, void* arg);
+
+// İstatistikler
+typedef struct {
+    uint64_t sent;                      // Doğrudan gönderilen intent
+    uint64_t broadcasts;
+    uint64_t delivered;
+    uint64_t dropped;                   // Kuyruk dolu olduğu için bırakılan
+    uint32_t filters;
+    uint32_t receivers;
+    uint32_t workers;
+} intent_router_stats_t;
+
+typedef struct intent_router intent_router_t;
+
+// workers 0 ise çevrimiçi işlemci sayısı (INTENT_MAX_WORKERS ile sınırlı)
+int intent_router_create(uint32_t workers, intent_handler_t handler, void* arg, intent_router_t** router);
+void intent_router_destroy(intent_router_t* router);
+
+// Filtre kaydı. Paket kaldırılınca filtreleri ve bekleyen intentleri silinir.
+int intent_router_add_filter(intent_router_t* router, const char* package, const char* component, const intent_filter_t* filter);
+int intent_router_remove_package(intent_router_t* router, const char* package);
+
+// Yayınlar yalnızca etkin paketlere gider (ör. çalışan uygulamalar)
+int intent_router_set_active(intent_router_t* router, const char* package, uint8_t active);
+
+// Eşleşen alıcıları bul. Dönen dizeler paket kaldırılana kadar geçerlidir.
+int intent_router_resolve(intent_router_t* router, const char* action, const char* type,
+                          const char* const* categories, intent_match_t* matches, uint32_t max_matches, uint32_t* count);
+
+// Açık intent: filtrelere bakılmadan paketin kuyruğuna eklenir
+int intent_router_send(intent_router_t* router, const char* package, const char* component,
+                       const char* action, const char* type, void* extras);
+
+// Yayın: eşleşen tüm etkin alıcıların kuyruğuna eklenir
+int intent_router_broadcast(intent_router_t* router, const char* action, const char* type,
+                            const char* const* categories, void* extras, uint32_t* queued);
+
+// Kuyruktaki tüm intentler teslim edilene kadar bekle
+void intent_router_flush(intent_router_t* router);
+
+int intent_router_get_stats(intent_router_t* router, intent_router_stats_t* stats);
+
+#endif /* INTENT_ROUTER_H */
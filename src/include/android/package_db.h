@@ -0,0 +1,75 @@
+#ifndef PACKAGE_DB_H
+#define PACKAGE_DB_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Paket veritabanı. Kayıtlar sabit boyutludur ve paket adıyla anahtarlanır.
+// Disk düzeni iki dosyadır:
+// - "<yol>": yalnızca sona eklenen kayıt günlüğü (ekleme/güncelleme ve silme
+//   kayıtları, her biri CRC-32 ile). Günlük salt okunur eşlenir; okumalar
+//   kopyasız, doğrudan eşlemeden yapılır.
+// - "<yol>.idx": günlüğün bir önekini kapsayan karma tablosu (paket adı ->
+//   son kaydın ofseti). Açılışta tablo okunur, yalnızca indeksin kapsamadığı
+//   kuyruk kayıtları yeniden oynatılır. İndeks yoksa ya da bozuksa günlüğün
+//   tamamı oynatılır; yarım kalmış son kayıt kesilir.
+// Ölü kayıtlar canlılardan fazlalaşınca günlük sıkıştırılır (geçici dosya ve
+// yer değiştirme).
+//
+// Ayrıca yöneticilerin bellek içi aramaları için açık adresli bir karma
+// (package_index_t) sağlanır: paket adı ya da sayısal anahtar (pid) ile O(1).
+
+#define PACKAGE_DB_MAGIC           "KPDB"
+#define PACKAGE_DB_VERSION         1
+#define PACKAGE_DB_NAME_MAX        255     // Paket adı üst sınırı
+
+// Hata kodları
+#define PACKAGE_DB_ERROR_INVALID   -1      // Geçersiz parametre
+#define PACKAGE_DB_ERROR_IO        -2      // Dosya açılamadı, okunamadı ya da yazılamadı
+#define PACKAGE_DB_ERROR_FORMAT    -3      // Başka kayıt boyutuyla oluşturulmuş ya da bozuk günlük
+#define PACKAGE_DB_ERROR_NO_MEMORY -4      // Bellek yetersiz
+#define PACKAGE_DB_ERROR_NOT_FOUND -5      // Paket yok
+
+typedef struct package_db package_db_t;
+
+// Kayıt gezinme geri çağrısı; sıfır dışı dönüş gezinmeyi durdurur
+typedef int (*package_db_visit_t)(const char* name, const void* record, uint64_t stamp, void* arg);
+
+// Açma / kapatma. Kapatma indeksi yazar.
+int package_db_open(const char* path, uint32_t record_size, package_db_t** db);
+void package_db_close(package_db_t* db);
+
+// Kayıt işlemleri. stamp çağıranın kaynağa ait damgasıdır (ör. APK mtime).
+// Yazılar package_db_sync'e kadar diske zorlanmaz.
+int package_db_put(package_db_t* db, const char* name, const void* record, uint64_t stamp);
+int package_db_delete(package_db_t* db, const char* name);
+
+// Dönen işaretçi eşlemenin içindedir; sonraki put/delete/sync'e kadar geçerlidir
+const void* package_db_get(package_db_t* db, const char* name, uint64_t* stamp);
+
+int package_db_foreach(package_db_t* db, package_db_visit_t visit, void* arg);
+uint32_t package_db_count(package_db_t* db);
+
+// Günlüğü diske zorla, gerekirse sıkıştır ve indeksi yaz
+int package_db_sync(package_db_t* db);
+
+// Bellek içi karma. Dize anahtarları kopyalanmaz: değerin ömrü boyunca
+// geçerli kalmalıdır (ör. uygulama yapısındaki paket adı).
+typedef struct {
+    struct package_index_slot* slots;
+    uint32_t capacity;              // 2'nin kuvveti
+    uint32_t count;
+} package_index_t;
+
+int package_index_init(package_index_t* index, uint32_t capacity);
+void package_index_destroy(package_index_t* index);
+
+int package_index_insert(package_index_t* index, const char* key, void* value);
+void* package_index_find(const package_index_t* index, const char* key);
+int package_index_erase(package_index_t* index, const char* key);
+
+int package_index_insert_id(package_index_t* index, uint32_t id, void* value);
+void* package_index_find_id(const package_index_t* index, uint32_t id);
+int package_index_erase_id(package_index_t* index, uint32_t id);
+
+#endif /* PACKAGE_DB_H */
@@ -0,0 +1,101 @@
+#ifndef USAGE_SAMPLER_H
+#define USAGE_SAMPLER_H
+
+#include <stdint.h>
+#include <sys/types.h>
+
+// Uygulama kullanım örnekleyicisi. Arka plandaki tek bir iş parçacığı izlenen
+// her süreç için CPU, bellek, G/Ç ve uyanma sayısını sabit aralıkla okur ve
+// süreç başına sabit boyutlu halka tamponlara yazar. Okuyucular (ayarlar
+// sayfası gibi) yalnızca tamponlardan okur, ölçüm tetiklemez.
+//
+// Her süreç için üç çözünürlük tutulur; üst katmanlar alt katmanın
+// ortalamasıdır. 1 sn aralıkla: 2 dakika, 30 dakika ve 4 saat geçmiş.
+// Bellek önceden ayrılır, izleme süresince büyümez.
+//
+// Kaynaklar /proc/<pid>/stat (tüm iş parçacıklarının utime + stime değeri),
+// task/*/schedstat (iş parçacığı başına zaman dilimi sayısı), smaps_rollup
+// (Pss; yoksa statm'den özel sayfalar), statm ve io (depolama okuma/yazma)
+// dosyalarıdır. Dosyalar izleme başında bir kez açılır ve her turda baştan
+// okunur; süreç ölünce okuma başarısız olur ve kayıt kapanır, pid yeniden
+// kullanılsa bile yanlış sürece bağlanmaz. CPU çözünürlüğü bir saat tıkıdır
+// (genelde 10 ms).
+//
+// Bellek Pss'tir: zygote'tan paylaşılan sayfalar paylaşan süreçlere bölünür,
+// böylece uygulamaların toplamı gerçek bellek kullanımını aşmaz.
+
+#define USAGE_SAMPLER_DEFAULT_INTERVAL_MS  1000
+#define USAGE_SAMPLER_DEFAULT_MAX_APPS     256
+#define USAGE_SAMPLER_NAME_MAX             128
+#define USAGE_TIER_COUNT                   3
+
+// Katman boyutları ve katsayıları (örnek / önceki katmandan kaç örnek)
+#define USAGE_TIER0_SAMPLES                120
+#define USAGE_TIER1_SAMPLES                180
+#define USAGE_TIER1_FACTOR                 10
+#define USAGE_TIER2_SAMPLES                240
+#define USAGE_TIER2_FACTOR                 6
+
+// Hata kodları
+#define USAGE_ERROR_INVALID                -1      // Geçersiz parametre
+#define USAGE_ERROR_NO_MEMORY              -2      // Bellek yetersiz
+#define USAGE_ERROR_FULL                   -3      // İzlenen süreç sınırı dolu
+#define USAGE_ERROR_NOT_FOUND              -4      // Süreç izlenmiyor ya da henüz örnek yok
+#define USAGE_ERROR_PROCESS                -5      // /proc dosyaları açılamadı (süreç yok)
+
+// Tek örnek; oranlar örnek aralığı boyuncadır
+typedef struct {
+    uint32_t time;                  // Örnekleyicinin başlangıcından bu yana saniye
+    uint16_t cpu_permille;          // 1000 = bir çekirdeğin tamamı
+    uint16_t wakeups;               // Saniyedeki zaman dilimi (uyanma + kesilme), tüm iş parçacıkları
+    uint32_t rss_kb;                // Pss (KB)
+    uint32_t read_kbps;             // Depolamadan okuma (KB/sn)
+    uint32_t write_kbps;            // Depolamaya yazma (KB/sn)
+} usage_sample_t;
+
+// Tüm izlenen süreçlerin son örneklerinin toplamı
+typedef struct {
+    uint32_t apps;                  // Örneği olan süreç
+    float cpu_percent;              // 100 = bir çekirdek
+    uint64_t rss_kb;                // Pss toplamı
+    uint32_t read_kbps;
+    uint32_t write_kbps;
+    uint32_t wakeups;
+    uint32_t time;                  // En yeni örneğin zamanı
+} usage_totals_t;
+
+// Örnekleyicinin kendi maliyeti
+typedef struct {
+    uint64_t rounds;
+    uint64_t samples;
+    uint64_t exited;                // Örnekleme sırasında çıktığı görülen süreç
+    uint64_t cpu_ns;                // Örnekleyici iş parçacığının CPU süresi
+    double overhead_percent;        // cpu_ns / geçen süre
+    uint32_t tracked;
+    uint32_t interval_ms;
+} usage_sampler_stats_t;
+
+typedef struct usage_sampler usage_sampler_t;
+
+// interval_ms 0 ise USAGE_SAMPLER_DEFAULT_INTERVAL_MS, max_apps 0 ise
+// USAGE_SAMPLER_DEFAULT_MAX_APPS
+int usage_sampler_create(uint32_t interval_ms, uint32_t max_apps, usage_sampler_t** sampler);
+void usage_sampler_destroy(usage_sampler_t* sampler);
+
+// Süreç izleme
+int usage_sampler_track(usage_sampler_t* sampler, pid_t pid, const char* name);
+int usage_sampler_untrack(usage_sampler_t* sampler, pid_t pid);
+
+// Okuma (ölçüm yapmaz)
+int usage_sampler_latest(usage_sampler_t* sampler, pid_t pid, usage_sample_t* sample);
+int usage_sampler_series(usage_sampler_t* sampler, pid_t pid, uint32_t tier, usage_sample_t* samples,
+                         uint32_t max_samples, uint32_t* count);
+int usage_sampler_history(usage_sampler_t* sampler, uint32_t tier, usage_sample_t* samples,
+                          uint32_t max_samples, uint32_t* count);
+int usage_sampler_totals(usage_sampler_t* sampler, usage_totals_t* totals);
+int usage_sampler_get_stats(usage_sampler_t* sampler, usage_sampler_stats_t* stats);
+
+// Bir turu hemen çalıştır (testler ve ilk görüntüleme için)
+int usage_sampler_sample_now(usage_sampler_t* sampler);
+
+#endif /* USAGE_SAMPLER_H */
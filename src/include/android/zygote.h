@@ -0,0 +1,74 @@
+#ifndef ZYGOTE_H
+#define ZYGOTE_H
+
+#include <stdint.h>
+#include <sys/types.h>
+
+// Zygote: ART'ı bir kez başlatıp ortak sınıfları önceden yükleyen süreç.
+// Her uygulama bu süreçten fork ile türetilir; önceden yüklenen sayfalar
+// yazılana kadar tüm uygulamalar arasında paylaşılır (copy-on-write).
+
+#define ZYGOTE_PACKAGE_MAX         128
+#define ZYGOTE_PATH_MAX            256
+
+// Yanıt bekleme süreleri (ms); süre aşılırsa zygote askıda sayılır ve
+// uygulamalarıyla birlikte sonlandırılır
+#define ZYGOTE_PRELOAD_TIMEOUT_MS  60000
+#define ZYGOTE_REPLY_TIMEOUT_MS    2000
+
+// Hata kodları
+#define ZYGOTE_ERROR_INVALID       -1      // Geçersiz parametre
+#define ZYGOTE_ERROR_NOT_RUNNING   -2      // Zygote çalışmıyor
+#define ZYGOTE_ERROR_FORK          -3      // Süreç oluşturulamadı
+#define ZYGOTE_ERROR_PRELOAD       -4      // Önyükleme başarısız
+#define ZYGOTE_ERROR_NOT_FOUND     -5      // Süreç bu zygote'tan türetilmemiş ya da sonlanmış
+#define ZYGOTE_ERROR_TIMEOUT       -6      // Zygote zamanında yanıt vermedi
+
+// Uygulama başlatma isteği
+typedef struct {
+    char package_name[ZYGOTE_PACKAGE_MAX];
+    char apk_path[ZYGOTE_PATH_MAX];
+    uint32_t uid;
+    uint64_t request_us;           // İsteğin monoton zamanı (açılış süresi için)
+} zygote_request_t;
+
+// Zygote içinde bir kez çalışır (ART başlatma, sınıf önyükleme)
+typedef int (*zygote_preload_t)(void* user_data);
+
+// Fork edilen uygulama sürecinin ana fonksiyonu; dönüş değeri çıkış kodudur
+typedef int (*zygote_app_main_t)(const zygote_request_t* request, void* user_data);
+
+// Süreç bellek dağılımı (KB)
+typedef struct {
+    uint64_t rss_kb;               // Yerleşik bellek
+    uint64_t pss_kb;               // Paylaşım oranında bölünmüş bellek
+    uint64_t shared_kb;            // Başka süreçlerle paylaşılan sayfalar
+    uint64_t private_kb;           // Yalnızca bu sürece ait sayfalar
+} zygote_memory_t;
+
+// Zygote istatistikleri
+typedef struct {
+    pid_t pid;                     // Zygote süreç kimliği
+    uint64_t forks;                // Başlatılan uygulama sayısı
+    uint64_t preload_us;           // Önyükleme süresi
+    uint64_t last_fork_us;         // Son başlatma isteğinin süresi
+} zygote_stats_t;
+
+// Yaşam döngüsü
+int zygote_start(zygote_preload_t preload, zygote_app_main_t app_main, void* user_data);
+int zygote_stop(void);
+int zygote_is_running(void);
+
+// Uygulama süreçleri
+pid_t zygote_fork_app(const char* package_name, const char* apk_path, uint32_t uid);
+int zygote_kill_app(pid_t pid);
+
+// Bilgi
+int zygote_get_memory(pid_t pid, zygote_memory_t* memory);
+int zygote_get_stats(zygote_stats_t* stats);
+
+// ART tarafından sağlanan geri çağrılar (art_main.c)
+int art_zygote_preload(void* user_data);
+int art_zygote_app_main(const zygote_request_t* request, void* user_data);
+
+#endif /* ZYGOTE_H */
@@ -0,0 +1,84 @@
+#ifndef KALEMOS_AUDIO_MIXER_H
+#define KALEMOS_AUDIO_MIXER_H
+
+#include <stdint.h>
+
+// Sistem ses karıştırıcısı.
+// Uygulamalar (Android, medya oynatıcı, HTML5 oynatıcı) 16 bit PCM akışlarını
+// kilitsiz halkalara yazar; karıştırıcı iş parçacığı her periyotta akışları
+// aygıt hızına örnekler, ses seviyelerini uygular ve çıkış aygıtına yazar.
+
+#define AUDIO_MIXER_DEFAULT_RATE   48000
+#define AUDIO_MIXER_CHANNELS       2        // Çıkış her zaman stereo
+#define AUDIO_MIXER_PERIOD_FRAMES  256      // Periyot (48 kHz'de 5.3 ms)
+#define AUDIO_MIXER_MAX_STREAMS    16
+#define AUDIO_STREAM_RING_FRAMES   8192     // Akış halkası (2'nin kuvveti olmalı)
+#define AUDIO_STREAM_NAME_MAX      32
+
+// Çıkış aygıtları
+typedef enum {
+    AUDIO_DEVICE_AUTO,             // Kayıtlı ilk donanım, yoksa boş çıkış
+    AUDIO_DEVICE_NULL,             // Çıkışı at
+    AUDIO_DEVICE_WAV,              // WAV dosyasına yaz (testler için)
+    AUDIO_DEVICE_SB16,             // Sound Blaster 16
+    AUDIO_DEVICE_AC97,             // AC'97
+    AUDIO_DEVICE_HDA,              // Intel HD Audio
+    AUDIO_DEVICE_COUNT
+} audio_device_type_t;
+
+// Çıkış aygıtı sürücüsü. 'write' DMA tamponu boşalana kadar bekliyorsa
+// 'blocking' ayarlanır; aksi halde karıştırıcı periyotları kendisi zamanlar.
+typedef struct audio_sink {
+    const char* name;
+    uint8_t blocking;
+    int (*open)(struct audio_sink* sink, uint32_t sample_rate, uint32_t channels);
+    int (*write)(struct audio_sink* sink, const int16_t* frames, uint32_t frame_count);
+    void (*close)(struct audio_sink* sink);
+    void* private_data;
+} audio_sink_t;
+
+// Ses akışı
+typedef struct audio_stream audio_stream_t;
+
+// Akış istatistikleri
+typedef struct {
+    uint64_t frames_written;       // Halkaya yazılan kareler
+    uint64_t overruns;             // Halka dolu olduğu için kısa kalan yazmalar
+    uint64_t underruns;            // Periyot doldurulamadan akışın tükenmesi
+} audio_stream_stats_t;
+
+// Karıştırıcı istatistikleri
+typedef struct {
+    uint32_t sample_rate;          // Aygıt örnekleme hızı
+    uint32_t period_frames;        // Periyot uzunluğu (kare)
+    uint32_t active_streams;       // Çalan (duraklatılmamış) akış sayısı
+    uint8_t simd;                  // SIMD yeniden örnekleyici kullanılıyor mu?
+    uint64_t periods_mixed;        // Karıştırılan periyotlar
+    uint64_t underruns;            // Tüm akışlardaki boşalmalar
+    uint64_t late_periods;         // Zamanında karıştırılamayan periyotlar
+    uint64_t mix_time_last_ns;     // Son periyodun karıştırma süresi
+    uint64_t mix_time_max_ns;      // En uzun karıştırma süresi
+    uint64_t mix_time_total_ns;    // Toplam karıştırma süresi
+} audio_mixer_stats_t;
+
+// Karıştırıcı yönetimi
+int audio_mixer_init(uint32_t sample_rate, audio_device_type_t device, const char* wav_path);
+int audio_mixer_register_sink(audio_device_type_t device, audio_sink_t* sink);
+int audio_mixer_start();
+int audio_mixer_stop();
+int audio_mixer_shutdown();
+uint8_t audio_mixer_is_initialized();
+int audio_mixer_mix_period();
+int audio_mixer_set_master_volume(uint8_t volume);
+int audio_mixer_get_stats(audio_mixer_stats_t* stats);
+
+// Akışlar (üretici tarafı)
+audio_stream_t* audio_stream_open(const char* name, uint32_t sample_rate, uint32_t channels);
+int audio_stream_close(audio_stream_t* stream);
+int audio_stream_write(audio_stream_t* stream, const int16_t* frames, uint32_t frame_count);
+int audio_stream_set_volume(audio_stream_t* stream, uint8_t volume);
+int audio_stream_set_muted(audio_stream_t* stream, uint8_t muted);
+int audio_stream_set_paused(audio_stream_t* stream, uint8_t paused);
+int audio_stream_get_stats(audio_stream_t* stream, audio_stream_stats_t* stats);
+
+#endif // KALEMOS_AUDIO_MIXER_H
@@ -4,7 +4,7 @@
 #include "gui.h"
 
 // Masaüstü sabitleri
-#define DESKTOP_MAX_ICONS              100
+#define DESKTOP_MAX_ICONS              1024
 #define DESKTOP_ICON_WIDTH             64
 #define DESKTOP_ICON_HEIGHT            64
 #define DESKTOP_ICON_LABEL_HEIGHT      20
@@ -19,6 +19,14 @@
 #define MAX_SLIDESHOW_IMAGES           10
 #define WALLPAPER_CHANGE_INTERVAL      60 // Saniye cinsinden duvar kağıdı değişim süresi
 
+// Masaüstü arama indeksi sabitleri
+#define DESKTOP_ICON_HASH_SIZE         256    // Ad/yol karma tablosu kova sayısı (2'nin kuvveti)
+#define DESKTOP_GRID_CELL_WIDTH        DESKTOP_ICON_SPACING_X
+#define DESKTOP_GRID_CELL_HEIGHT       DESKTOP_ICON_SPACING_Y
+#define DESKTOP_GRID_COLS              16     // Uzamsal ızgara sütun sayısı (2'nin kuvveti)
+#define DESKTOP_GRID_ROWS              64     // Uzamsal ızgara satır sayısı (2'nin kuvveti)
+#define DESKTOP_ICON_INDEX_NONE        0xFFFF // Boş indeks bağlantısı
+
 // Masaüstü sürükle bırak sabitleri
 #define DESKTOP_DND_MIN_DRAG_DISTANCE  5
 #define DESKTOP_DND_ANIMATION_FRAMES   10
@@ -141,6 +149,18 @@ typedef struct {
     
     // Düzenleme modu
     uint8_t edit_mode;
+    
+    // Arama indeksleri (simge dizisindeki indeksleri tutar)
+    uint16_t name_hash_head[DESKTOP_ICON_HASH_SIZE];       // Ad karma kovaları
+    uint16_t name_hash_next[DESKTOP_MAX_ICONS];            // Ad zinciri bağlantıları
+    uint16_t path_hash_head[DESKTOP_ICON_HASH_SIZE];       // Yol karma kovaları
+    uint16_t path_hash_next[DESKTOP_MAX_ICONS];            // Yol zinciri bağlantıları
+    uint16_t cell_head[DESKTOP_GRID_COLS * DESKTOP_GRID_ROWS]; // Uzamsal ızgara hücreleri
+    uint16_t cell_next[DESKTOP_MAX_ICONS];                 // Hücre zinciri bağlantıları
+    uint16_t icon_cell[DESKTOP_MAX_ICONS];                 // Simgenin bulunduğu hücre
+    
+    // Artımlı düzen (bu indeksten itibaren simgeler yeniden yerleştirilecek)
+    uint16_t layout_dirty_from;
 } desktop_t;
 
 // Global masaüstü
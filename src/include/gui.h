@@ -81,6 +81,10 @@
 #define GUI_WINDOW_MIN_HEIGHT      80
 #define GUI_BUTTON_HEIGHT          24
 #define GUI_MAX_WINDOW_TITLE_LENGTH 64
+#define GUI_DAMAGE_MAX_RECTS       8     // Pencere başına hasar dikdörtgeni
+#define GUI_DAMAGE_TILE_SIZE       16    // Hasar karo boyutu (piksel)
+#define GUI_DAMAGE_MAX_TILES       64    // Eksen başına en fazla karo
+#define GUI_WINDOW_RESIZE_GRIP     8     // Sağ alt köşedeki boyutlandırma tutamacı (piksel)
 
 // Masaüstü durumları
 typedef enum {
@@ -106,11 +110,20 @@ struct gui_window;
 typedef uint8_t (*gui_window_paint_handler_t)(struct gui_window* window);
 typedef uint8_t (*gui_window_close_handler_t)(struct gui_window* window);
 typedef void (*gui_window_resize_handler_t)(struct gui_window* window, uint16_t width, uint16_t height);
+typedef void (*gui_window_resize_drag_handler_t)(struct gui_window* window, uint8_t active);
 typedef void (*gui_window_move_handler_t)(struct gui_window* window, uint16_t x, uint16_t y);
 typedef void (*gui_window_mouse_handler_t)(struct gui_window* window, uint16_t x, uint16_t y, uint8_t button, uint8_t state);
 typedef void (*gui_window_keyboard_handler_t)(struct gui_window* window, uint8_t key, uint8_t state);
 typedef void (*gui_window_right_click_handler_t)(struct gui_window* window, uint16_t x, uint16_t y);
 
+// Dikdörtgen
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+} gui_rect_t;
+
 // Pencere içerik alanı yapısı
 typedef struct {
     uint16_t x;             // İçerik alanı X konumu (pencere içinde)
@@ -148,14 +161,28 @@ typedef struct gui_window {
     gui_window_paint_handler_t on_paint;       // Çizim olayı
     gui_window_close_handler_t on_close;       // Kapatma olayı
     gui_window_resize_handler_t on_resize;     // Yeniden boyutlandırma olayı
+    gui_window_resize_drag_handler_t on_resize_drag; // Boyutlandırma sürüklemesi başladı (1) / bitti (0)
     gui_window_move_handler_t on_move;         // Taşıma olayı
     gui_window_mouse_handler_t on_mouse;       // Fare olayı
     gui_window_keyboard_handler_t on_keyboard; // Klavye olayı
     gui_window_right_click_handler_t on_right_click; // Sağ tık olayı
     
+    // Harici arka tampon (ör. Android yüzeyi, kopyalanmadan gösterilir)
+    const uint32_t* backing_store;    // ARGB8888 piksel tamponu
+    uint32_t backing_stride;          // Satır başına piksel sayısı
+    uint16_t backing_width;           // Tampon genişliği
+    uint16_t backing_height;          // Tampon yüksekliği
+    gui_rect_t backing_damage[GUI_DAMAGE_MAX_RECTS]; // Son karede değişen bölgeler
+    uint8_t backing_damage_count;     // Hasar dikdörtgeni sayısı
+    uint8_t backing_full_damage;      // Tüm tampon değişti mi?
+    uint64_t backing_bytes_converted; // Dönüştürülüp çizilen toplam bayt
+    
     // Kullanıcı verisi
     void* user_data;                  // Özel kullanıcı verisi
     
+    // Başka iş parçacığından istenen, GUI döngüsünde yapılacak güncelleme
+    volatile uint8_t invalidate_pending;
+    
     // Pencere listesi için bağlantı
     struct gui_window* next;          // Sonraki pencere
 } gui_window_t;
@@ -182,6 +209,10 @@ void gui_set_window_visibility(gui_window_t* window, uint8_t visible);
 void gui_set_window_position(gui_window_t* window, uint16_t x, uint16_t y);
 void gui_set_window_size(gui_window_t* window, uint16_t width, uint16_t height);
 void gui_set_window_title(gui_window_t* window, const char* title);
+void gui_window_invalidate(gui_window_t* window);
+void gui_window_post_invalidate(gui_window_t* window);
+void gui_window_draw_backing_store(gui_window_t* window, uint8_t partial);
+void gui_process_invalidations();
 
 // Grafik çizim işlevleri
 void gui_draw_icon(uint16_t x, uint16_t y, uint8_t icon_id, uint16_t size);
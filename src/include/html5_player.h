@@ -4,6 +4,7 @@
 #include <stdint.h>
 #include "../include/gui.h"
 #include "../include/browser.h"
+#include "../include/audio_mixer.h"
 
 // İleriye doğru bildirimler
 typedef enum video_codec_t video_codec_t;
@@ -84,6 +85,7 @@ typedef struct html5_player {
     hw_acceleration_info_t* hw_info;   // Donanım hızlandırma bilgileri
     uint8_t auto_quality;              // Otomatik kalite ayarı (0/1)
     void* frame_buffer;                // Kare tamponu
+    audio_stream_t* audio_stream;      // Sistem karıştırıcısındaki ses akışı
 } html5_player_t;
 
 // İşlev prototipleri
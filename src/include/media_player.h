@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include "../include/gui.h"
+#include "../include/audio_mixer.h"
 
 // Medya tipi
 typedef enum {
@@ -106,6 +107,8 @@ typedef struct {
     uint8_t repeat;        // Tekrarlama modu
     uint8_t shuffle;       // Karıştırma modu
     void* codec_data;      // Codec özel verisi
+    audio_stream_t* audio_stream;  // Sistem karıştırıcısındaki akış
+    media_file_t* audio_file;      // Akışın açıldığı dosya
 } media_player_t;
 
 // Fonksiyon prototipleri
@@ -92,4 +92,7 @@ uint32_t noteplus_get_line_count(noteplus_editor_t* editor);
 // Açık noteplus editörünü al
 noteplus_editor_t* noteplus_get_active_editor();
 
+// Metni Python'da özetle (tampon kopyalanmadan paylaşılır, sonuç JSON)
+int noteplus_analyze_text(noteplus_editor_t* editor, char** result_out);
+
 #endif // KALEMOS_NOTEPLUS_H 
\ No newline at end of file
@@ -0,0 +1,34 @@
+#ifndef KALEMOS_PIXEL_FORMAT_H
+#define KALEMOS_PIXEL_FORMAT_H
+
+#include <stdint.h>
+#include "vga.h"
+
+// Ters palet tablosu: RGB555 (32K girdi) -> palet indeksi
+#define PIXEL_PALETTE_LUT_SIZE  32768
+
+// Seçilen çekirdek komut seti
+typedef enum {
+    PIXEL_ISA_SCALAR = 0,   // Taşınabilir C
+    PIXEL_ISA_SSE2,         // SSE2
+    PIXEL_ISA_SSSE3         // SSE2 + SSSE3 (pshufb)
+} pixel_isa_t;
+
+// Başlatma (CPUID ile çekirdek seçimi)
+void pixel_format_init();
+pixel_isa_t pixel_format_get_isa();
+int pixel_format_set_isa(pixel_isa_t isa);
+const char* pixel_format_isa_name(pixel_isa_t isa);
+
+// Ters palet tablosunu oluştur (palet değerleri 6 bit VGA DAC biçiminde)
+void pixel_format_build_palette_lut(const vga_color_t* palette, uint32_t count);
+
+// Satır dönüştürme çekirdekleri (kaynak ARGB8888)
+void pixel_argb_to_rgb565(uint16_t* dst, const uint32_t* src, uint32_t count);
+void pixel_argb_to_bgrx(uint32_t* dst, const uint32_t* src, uint32_t count);
+void pixel_argb_to_indexed(uint8_t* dst, const uint32_t* src, uint32_t count, 
+                           uint32_t x, uint32_t y, uint8_t dither);
+void pixel_premultiply(uint32_t* dst, const uint32_t* src, uint32_t count);
+void pixel_unpremultiply(uint32_t* dst, const uint32_t* src, uint32_t count);
+
+#endif // KALEMOS_PIXEL_FORMAT_H
@@ -2,6 +2,7 @@
 #define PYTHON_AI_H
 
 #include <stdint.h>
+#include <stddef.h>
 
 /**
  * @file python_ai.h
@@ -32,6 +33,13 @@ typedef enum {
     AI_OPTIMIZE_BALANCE          // Dengeli optimizasyon
 } ai_optimization_target_t;
 
+/** Metin modeli çıkarım arka ucu */
+typedef enum {
+    AI_BACKEND_AUTO = 0,         // model_path GGUF ise yerel, değilse Python
+    AI_BACKEND_PYTHON,           // transformers/torch (model_name)
+    AI_BACKEND_NATIVE            // Yerel nicemlenmiş motor (model_path, GGUF)
+} ai_backend_t;
+
 /** Yapay zeka model yapılandırması */
 typedef struct {
     char model_name[64];         // Model adı
@@ -43,6 +51,7 @@ typedef struct {
     uint32_t max_memory_mb;      // Maksimum bellek kullanımı (MB)
     uint8_t thread_count;        // İş parçacığı sayısı
     uint8_t optimization_level;  // Optimizasyon seviyesi (0-5)
+    uint8_t backend;             // Çıkarım arka ucu (ai_backend_t)
 } ai_model_config_t;
 
 /** Sistem kaynak kullanım bilgisi */
@@ -161,6 +170,29 @@ int python_ai_explain_code(const char* code, char** result_out);
  */
 int python_ai_analyze_code(const char* code, char** result_out);
 
+/**
+ * Donanım bileşen verisini toplar ve Python'da özetler
+ * 
+ * hw_manager_collect_ai_data çıktısı Python'a kopyalanmadan paylaşılır.
+ * 
+ * @param components En fazla bileşen sayısı
+ * @param result_out Özet (JSON formatında, serbest bırakılmalıdır)
+ * @return int 0: başarılı, <0: hata
+ */
+int python_ai_analyze_hardware(uint32_t components, char** result_out);
+
+/**
+ * Metin tamponunu Python'da özetler (satır, kelime, bayt)
+ * 
+ * Tampon Python'a kopyalanmadan, salt okunur paylaşılır.
+ * 
+ * @param text Metin (NUL ile bitmesi gerekmez)
+ * @param length Bayt cinsinden uzunluk
+ * @param result_out Özet (JSON formatında, serbest bırakılmalıdır)
+ * @return int 0: başarılı, <0: hata
+ */
+int python_ai_analyze_text(const char* text, size_t length, char** result_out);
+
 /**
  * Yapay zeka ile doğal dil komutunu yorumlar
  * 
@@ -2,6 +2,7 @@
 #define PYTHON_MANAGER_H
 
 #include <stdint.h>
+#include <stddef.h>
 
 /**
  * @file python_manager.h
@@ -47,6 +48,37 @@ typedef struct {
     uint32_t memory_limit_kb;     // Bellek sınırı (KB)
 } python_environment_t;
 
+/** Önceden derlenmiş Python modülü (opak) */
+typedef struct python_module python_module_t;
+
+/** Python modülünden alınmış çağrılabilir işlev (opak) */
+typedef struct python_function python_function_t;
+
+/** Python nesnesi referansı (opak; çağrılara "O" biçimiyle verilir) */
+typedef struct python_object python_object_t;
+
+/** Python'a paylaşılan C dizisinin öğe tipi */
+typedef enum {
+    PYTHON_BUFFER_UINT8 = 0,      // "B" (ham bayt, yapı dizileri)
+    PYTHON_BUFFER_INT32,          // "i"
+    PYTHON_BUFFER_UINT32,         // "I"
+    PYTHON_BUFFER_INT64,          // "q"
+    PYTHON_BUFFER_UINT64,         // "Q"
+    PYTHON_BUFFER_FLOAT32,        // "f"
+    PYTHON_BUFFER_FLOAT64,        // "d"
+    PYTHON_BUFFER_TYPE_COUNT
+} python_buffer_type_t;
+
+/** Python nesnesinden kopyalanmadan alınan bellek */
+typedef struct {
+    void* data;                   // Python nesnesinin belleği
+    size_t size;                  // Bayt cinsinden boyut
+    size_t item_size;             // Öğe boyutu
+    const char* format;           // struct modülü biçimi ("B", "f", ...)
+    uint8_t readonly;             // Salt okunur mu?
+    void* internal;               // İç kullanım (python_buffer_release bırakır)
+} python_buffer_t;
+
 /** Python script kayıt bilgisi */
 typedef struct python_script {
     char path[256];               // Betik yolu
@@ -98,6 +130,121 @@ int python_run_string(const char* code);
  */
 int python_run_string_with_output(const char* code, char** output_out);
 
+/**
+ * Python kaynağını bir kez derleyip yeni bir modülde çalıştırır
+ * 
+ * Modül sys.modules'a eklenmez, yalnızca dönen tanıtıcıyla erişilir.
+ * Tanıtıcılar python_manager_cleanup'tan önce serbest bırakılmalıdır.
+ * 
+ * @param name Modül adı (hata mesajlarında da kullanılır)
+ * @param source Python kaynak kodu
+ * @param module_out Modül tanıtıcısı
+ * @return int 0: başarılı, <0: hata
+ */
+int python_module_load(const char* name, const char* source, python_module_t** module_out);
+
+/**
+ * Modülü serbest bırakır
+ * 
+ * @param module Modül tanıtıcısı (NULL olabilir)
+ */
+void python_module_free(python_module_t* module);
+
+/**
+ * Modüldeki bir işlevi çağrılmak üzere alır
+ * 
+ * @param module Modül tanıtıcısı
+ * @param name İşlev adı
+ * @param function_out İşlev tanıtıcısı
+ * @return int 0: başarılı, <0: hata
+ */
+int python_module_get_function(python_module_t* module, const char* name, python_function_t** function_out);
+
+/**
+ * İşlev tanıtıcısını serbest bırakır
+ * 
+ * @param function İşlev tanıtıcısı (NULL olabilir)
+ */
+void python_function_free(python_function_t* function);
+
+/**
+ * İşlevi çağırır, str ya da bytes sonucunu döndürür
+ * 
+ * Argümanlar Py_BuildValue biçimiyle verilir (ör. "(isd)"); '#' biçimlerinde
+ * uzunluk Py_ssize_t'dir. Python istisnası python_get_last_error ile okunur.
+ * 
+ * @param function İşlev tanıtıcısı
+ * @param result_out Sonuç (UTF-8 ya da ham bayt, sonunda '\0', serbest bırakılmalıdır)
+ * @param size_out Sonuç uzunluğu (NULL olabilir)
+ * @param format Argüman biçimi (NULL: argümansız)
+ * @return int 0: başarılı, <0: hata
+ */
+int python_call_text(python_function_t* function, char** result_out, size_t* size_out, const char* format, ...);
+
+/**
+ * İşlevi çağırır, tamsayı ya da bool sonucunu döndürür
+ * 
+ * @param function İşlev tanıtıcısı
+ * @param result_out Sonuç (NULL: sonuç yok sayılır)
+ * @param format Argüman biçimi (NULL: argümansız)
+ * @return int 0: başarılı, <0: hata
+ */
+int python_call_long(python_function_t* function, long* result_out, const char* format, ...);
+
+/**
+ * C belleğini kopyalamadan Python'a paylaşır
+ * 
+ * Dönen tanıtıcı bir kalem.SharedMemory nesnesidir ve python_call_*
+ * çağrılarına "O" biçimiyle verilir. Nesne tampon protokolünü destekler:
+ * Python tarafında memoryview(x) öğe tipine göre biçimlenmiş tek boyutlu bir
+ * görünüm, numpy.frombuffer(x, dtype) kopyasız bir dizi verir. Bellek,
+ * python_buffer_unshare başarılı olana kadar geçerli kalmalıdır.
+ * 
+ * @param data Paylaşılacak bellek
+ * @param size Bayt cinsinden boyut (öğe boyutunun katı)
+ * @param type Öğe tipi
+ * @param writable Python belleğe yazabilsin mi?
+ * @param shared_out kalem.SharedMemory tanıtıcısı
+ * @return int 0: başarılı, <0: hata
+ */
+int python_buffer_share(void* data, size_t size, python_buffer_type_t type, uint8_t writable,
+                        python_object_t** shared_out);
+
+/**
+ * Paylaşımı geri alır
+ * 
+ * kalem.SharedMemory kendisinden alınan tamponları sayar. Python'da hâlâ
+ * yaşayan bir tampon (memoryview, dilim, numpy dizisi, python_call_buffer
+ * ile alınmış sonuç) varsa PYTHON_ERROR_API döner: tanıtıcı geçerli kalır,
+ * C belleği serbest bırakılmamalı ve çağrı daha sonra yinelenmelidir. İlk
+ * denemeden sonra nesneden yeni tampon alınamaz (BufferError). Başarılı
+ * olunca nesneye Python'da referans kalsa da belleğe erişilemez.
+ * 
+ * @param shared python_buffer_share ile alınan tanıtıcı (NULL olabilir)
+ * @return int 0: başarılı, <0: hata (başka tipte nesne dahil)
+ */
+int python_buffer_unshare(python_object_t* shared);
+
+/**
+ * İşlevi çağırır, tampon protokolünü destekleyen sonucun belleğini kopyalamadan döndürür
+ * 
+ * Sonuç (bytes, bytearray, memoryview, array, numpy dizisi...) C-bitişik
+ * olmalıdır. Paylaşılan bir görünüm geri döndürülürse veri C belleğinin kendisidir.
+ * 
+ * @param function İşlev tanıtıcısı
+ * @param buffer_out Tampon (python_buffer_release ile bırakılmalıdır)
+ * @param format Argüman biçimi (NULL: argümansız)
+ * @return int 0: başarılı, <0: hata
+ */
+int python_call_buffer(python_function_t* function, python_buffer_t* buffer_out, const char* format, ...);
+
+/**
+ * python_call_buffer ile alınan tamponu bırakır
+ * 
+ * @param buffer Tampon
+ */
+void python_buffer_release(python_buffer_t* buffer);
+
 /**
  * Son Python hatasını döndürür
  * 
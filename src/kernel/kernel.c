@@ -163,6 +163,34 @@ void process_memory_map(multiboot_info_t* mbi) {
     terminal_write_string("Bellek yöneticisi başlatıldı.\n");
 }
 
+// İşlemci SSE destekliyorsa etkinleştir. Önyükleyiciden sonra CR4.OSFXSR
+// kapalıdır ve ilk SSE komutu #UD üretir. Çekirdekte bağlam değiştirme
+// olmadığından XMM durumu kaydedilmez; zamanlayıcı eklendiğinde görev
+// başına FXSAVE alanı gerekir.
+void cpu_enable_sse() {
+    uint32_t eax = 1, ebx, ecx = 0, edx;
+    __asm__ volatile("cpuid" : "+a"(eax), "=b"(ebx), "+c"(ecx), "=d"(edx));
+    
+    // SSE (bit 25) ve FXSAVE/FXRSTOR (bit 24) birlikte gerekir
+    if (!(edx & (1u << 25)) || !(edx & (1u << 24))) {
+        terminal_write_string("SSE desteklenmiyor, skaler yollar kullanılacak.\n");
+        return;
+    }
+    
+    uint32_t cr0, cr4;
+    __asm__ volatile("mov %%cr0, %0" : "=r"(cr0));
+    cr0 &= ~((1u << 2) | (1u << 3));   // EM: FPU öykünmesi yok, TS: görev değişimi yok
+    cr0 |= 1u << 1;                     // MP: WAIT/FWAIT TS'yi denetler
+    __asm__ volatile("mov %0, %%cr0" : : "r"(cr0));
+    
+    __asm__ volatile("mov %%cr4, %0" : "=r"(cr4));
+    cr4 |= (1u << 9) | (1u << 10);      // OSFXSR, OSXMMEXCPT
+    __asm__ volatile("mov %0, %%cr4" : : "r"(cr4));
+    
+    __asm__ volatile("fninit");
+    terminal_write_string("SSE etkinleştirildi.\n");
+}
+
 // Grafik sistemini başlat
 void init_graphics() {
     vga_init();
@@ -195,6 +223,9 @@ void kernel_main(multiboot_info_t* mbi) {
         terminal_write_string("Hata: Multiboot bilgileri alınamadı!\n");
     }
     
+    // pixel_format_init SSE çekirdeklerini yalnızca bu adımdan sonra seçer
+    cpu_enable_sse();
+    
     terminal_write_string("\nGrafik arayüzü başlatılıyor...\n");
     
     // Grafik sistemini başlat
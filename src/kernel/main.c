@@ -4,6 +4,9 @@ int main() {
     
     // Ana döngü
     while (1) {
+        // Diğer iş parçacıklarının istediği pencere güncellemeleri
+        gui_process_invalidations();
+        
         // GUI güncelleme
         gui_desktop_draw();
     }
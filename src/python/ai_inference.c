@@ -0,0 +1,1998 @@
+#include "../include/ai_inference.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#if defined(__i386__) || defined(__x86_64__)
+#define AI_INFERENCE_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#define AI_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+// GGUF dosya biçimi
+#define GGUF_MAGIC                  0x46554747u     // "GGUF"
+#define GGUF_DEFAULT_ALIGNMENT      32
+#define GGUF_MAX_DIMS               4
+
+// GGUF değer tipleri
+#define GGUF_TYPE_UINT8             0
+#define GGUF_TYPE_INT8              1
+#define GGUF_TYPE_UINT16            2
+#define GGUF_TYPE_INT16             3
+#define GGUF_TYPE_UINT32            4
+#define GGUF_TYPE_INT32             5
+#define GGUF_TYPE_FLOAT32           6
+#define GGUF_TYPE_BOOL              7
+#define GGUF_TYPE_STRING            8
+#define GGUF_TYPE_ARRAY             9
+#define GGUF_TYPE_UINT64            10
+#define GGUF_TYPE_INT64             11
+#define GGUF_TYPE_FLOAT64           12
+
+// ggml tensör tipleri
+#define GGML_TYPE_F32               0
+#define GGML_TYPE_F16               1
+#define GGML_TYPE_Q4_0              2
+#define GGML_TYPE_Q8_0              8
+
+// tokenizer.ggml.token_type değerleri
+#define AI_TOKEN_TYPE_CONTROL       3
+#define AI_TOKEN_TYPE_BYTE          6
+
+#define AI_BLOCK                    32              // Nicemleme blok uzunluğu
+#define AI_BUFFER_ALIGN             64
+#define AI_POOL_SPIN                20000           // Uyumadan önce iş bekleme turu
+#define AI_TOKEN_NONE               UINT32_MAX
+
+// Ağırlık blokları (ggml ile aynı düzen)
+typedef struct {
+    uint16_t d;                     // Ölçek (fp16)
+    int8_t qs[AI_BLOCK];
+} ai_block_q8_0_t;
+
+typedef struct {
+    uint16_t d;                     // Ölçek (fp16)
+    uint8_t qs[AI_BLOCK / 2];       // Alt dörtlü: 0..15, üst dörtlü: 16..31
+} ai_block_q4_0_t;
+
+// Nicemlenmiş etkinleştirme bloğu
+typedef struct {
+    float d;
+    int8_t qs[AI_BLOCK];
+} ai_block_qx_t;
+
+// Eşlenen dosyadaki tensör (satır düzeninde; cols = ne0)
+typedef struct {
+    const uint8_t* data;
+    uint32_t type;
+    uint32_t cols;
+    uint32_t rows;
+    size_t row_bytes;
+} ai_tensor_t;
+
+typedef struct {
+    float* attn_norm;
+    float* ffn_norm;
+    ai_tensor_t wq;
+    ai_tensor_t wk;
+    ai_tensor_t wv;
+    ai_tensor_t wo;
+    ai_tensor_t w_gate;
+    ai_tensor_t w_up;
+    ai_tensor_t w_down;
+} ai_layer_t;
+
+typedef struct ai_inference_model ai_model_t;
+typedef void (*ai_task_t)(ai_model_t* model, void* arg, uint32_t start, uint32_t end);
+
+// İş parçacığı havuzu. Çağıran da işe katılır; işçiler yeni işi kısa süre
+// dönerek bekler, sonra uyur.
+typedef struct {
+    pthread_t threads[AI_INFERENCE_MAX_THREADS];
+    uint32_t workers;               // Çağıran hariç
+    uint32_t started;
+    pthread_mutex_t lock;
+    pthread_cond_t start_cond;
+    pthread_cond_t done_cond;
+    ai_task_t task;
+    void* arg;
+    uint32_t total;
+    uint32_t chunk;
+    uint32_t next;                  // Sıradaki iş (atomik)
+    uint32_t active;                // İşini bitirmemiş işçi (atomik)
+    uint64_t generation;            // İş sayacı (atomik)
+    uint32_t sleepers;
+    int stop;
+} ai_pool_t;
+
+// GGUF tensör kaydı
+typedef struct {
+    const char* name;
+    uint64_t name_len;
+    uint32_t n_dims;
+    uint64_t dims[GGUF_MAX_DIMS];
+    uint32_t type;
+    uint64_t offset;
+} gguf_tensor_info_t;
+
+// Motorun kullandığı üst veriler
+typedef struct {
+    char architecture[32];
+    char tokenizer[32];
+    double context_length;
+    double embedding;
+    double block_count;
+    double feed_forward;
+    double head_count;
+    double head_count_kv;
+    double rope_base;
+    double rope_dims;
+    double rms_eps;
+    double bos;
+    double eos;
+    double add_space_prefix;
+    uint64_t alignment;
+    const uint8_t* tokens;          // Dizgi dizisinin ilk öğesi
+    uint64_t token_count;
+    const uint8_t* scores;          // float32 dizisi
+    uint64_t score_count;
+    const uint8_t* token_types;     // int32 dizisi
+    uint64_t token_type_count;
+} gguf_meta_t;
+
+typedef struct {
+    const uint8_t* data;
+    size_t size;
+    size_t pos;
+    int failed;
+} gguf_reader_t;
+
+struct ai_inference_model {
+    pthread_mutex_t lock;           // Aynı anda tek üretim
+    
+    // Eşlenen dosya
+    void* map;
+    size_t map_size;
+    
+    // Hiperparametreler
+    uint32_t n_vocab;
+    uint32_t n_embd;
+    uint32_t n_layer;
+    uint32_t n_head;
+    uint32_t n_head_kv;
+    uint32_t n_ff;
+    uint32_t n_ctx;
+    uint32_t head_dim;
+    uint32_t kv_dim;
+    float rms_eps;
+    
+    // Ağırlıklar
+    ai_tensor_t token_embd;
+    ai_tensor_t output;
+    ai_layer_t* layers;
+    float* norms;                   // Tüm normalizasyon vektörleri (açılmış)
+    float* output_norm;
+    
+    // Sözlük
+    char** vocab;
+    uint32_t* vocab_len;
+    float* scores;
+    uint8_t* token_types;
+    char* vocab_pool;
+    uint32_t* vocab_index;          // Açık adresleme: id + 1
+    uint32_t vocab_mask;
+    uint32_t max_token_len;
+    uint32_t byte_tokens[256];
+    uint32_t bos;
+    uint32_t eos;
+    int add_space_prefix;
+    
+    // Çalışma tamponları (tek ayırma)
+    void* buffers;
+    size_t buffer_bytes;
+    float* x;
+    float* xb;
+    float* xb2;
+    float* q;
+    float* hb;
+    float* hb2;
+    float* att;
+    float* logits;
+    float* rope_freq;
+    float* rope_cos;
+    float* rope_sin;
+    float* key_cache;
+    float* value_cache;
+    ai_block_qx_t* xq;
+    
+    ai_pool_t pool;
+    uint64_t rng;
+    double load_ms;
+};
+
+// Seçilen çekirdekler
+static ai_inference_isa_t ai_isa = AI_INFERENCE_ISA_SCALAR;
+static float (*ai_dot_q8_0_impl)(const void* row, const ai_block_qx_t* x, uint32_t blocks);
+static float (*ai_dot_q4_0_impl)(const void* row, const ai_block_qx_t* x, uint32_t blocks);
+static float (*ai_dot_f32_impl)(const float* a, const float* b, uint32_t n);
+static pthread_once_t ai_once = PTHREAD_ONCE_INIT;
+static float ai_fp16_table[65536];
+
+// Yardımcı fonksiyonlar
+static void ai_init_kernels(void);
+static double ai_now_ms(void);
+static float ai_fp16_to_fp32(uint16_t h);
+static size_t ai_row_bytes(uint32_t type, uint32_t cols);
+static void ai_tensor_row_to_floats(const ai_tensor_t* tensor, uint32_t row, float* out);
+static void ai_quantize_row(const float* x, ai_block_qx_t* out, uint32_t n);
+static int ai_parse_gguf(ai_model_t* model, gguf_meta_t* meta, gguf_tensor_info_t** infos_out,
+                         uint64_t* count_out, const uint8_t** data_out, size_t* data_size_out);
+static int ai_bind_weights(ai_model_t* model, const gguf_meta_t* meta, const gguf_tensor_info_t* infos,
+                           uint64_t count, const uint8_t* data, size_t data_size);
+static int ai_load_vocab(ai_model_t* model, const gguf_meta_t* meta);
+static int ai_alloc_buffers(ai_model_t* model, uint32_t context, float rope_base);
+static int ai_pool_start(ai_model_t* model, uint32_t threads);
+static void ai_pool_stop(ai_model_t* model);
+static void ai_pool_run(ai_model_t* model, ai_task_t task, void* arg, uint32_t total, uint32_t min_chunk);
+static void ai_forward(ai_model_t* model, uint32_t token, uint32_t pos, int want_logits);
+static int ai_encode(ai_model_t* model, const char* text, uint32_t* tokens, uint32_t capacity, uint32_t* count);
+static uint32_t ai_sample(ai_model_t* model, float temperature);
+
+// ---------------------------------------------------------------------------
+// Sayısal yardımcılar ve çekirdekler
+// ---------------------------------------------------------------------------
+
+static double ai_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1e6;
+}
+
+// IEEE yarım duyarlıklı sayıyı float'a çevir (tablo kurulumunda)
+static float ai_fp16_compute(uint16_t h) {
+    uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+    uint32_t exponent = (h >> 10) & 0x1F;
+    uint32_t mantissa = h & 0x3FF;
+    uint32_t bits;
+    
+    if (exponent == 0) {
+        if (mantissa == 0) {
+            bits = sign;
+        } else {
+            // Normal olmayan sayıyı normalleştir
+            exponent = 127 - 15 + 1;
+            while (!(mantissa & 0x400)) {
+                mantissa <<= 1;
+                exponent--;
+            }
+            bits = sign | (exponent << 23) | ((mantissa & 0x3FF) << 13);
+        }
+    } else if (exponent == 0x1F) {
+        bits = sign | 0x7F800000u | (mantissa << 13);
+    } else {
+        bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+    }
+    
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static float ai_fp16_to_fp32(uint16_t h) {
+    return ai_fp16_table[h];
+}
+
+// Skaler çekirdekler
+static float ai_dot_q8_0_scalar(const void* row, const ai_block_qx_t* x, uint32_t blocks) {
+    const ai_block_q8_0_t* w = (const ai_block_q8_0_t*)row;
+    float sum = 0.0f;
+    for (uint32_t i = 0; i < blocks; i++) {
+        int32_t dot = 0;
+        for (uint32_t j = 0; j < AI_BLOCK; j++) {
+            dot += (int32_t)w[i].qs[j] * (int32_t)x[i].qs[j];
+        }
+        sum += (float)dot * ai_fp16_to_fp32(w[i].d) * x[i].d;
+    }
+    return sum;
+}
+
+static float ai_dot_q4_0_scalar(const void* row, const ai_block_qx_t* x, uint32_t blocks) {
+    const ai_block_q4_0_t* w = (const ai_block_q4_0_t*)row;
+    float sum = 0.0f;
+    for (uint32_t i = 0; i < blocks; i++) {
+        int32_t dot = 0;
+        for (uint32_t j = 0; j < AI_BLOCK / 2; j++) {
+            dot += ((int32_t)(w[i].qs[j] & 0x0F) - 8) * (int32_t)x[i].qs[j];
+            dot += ((int32_t)(w[i].qs[j] >> 4) - 8) * (int32_t)x[i].qs[j + AI_BLOCK / 2];
+        }
+        sum += (float)dot * ai_fp16_to_fp32(w[i].d) * x[i].d;
+    }
+    return sum;
+}
+
+static float ai_dot_f32_scalar(const float* a, const float* b, uint32_t n) {
+    float sum = 0.0f;
+    for (uint32_t i = 0; i < n; i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+#ifdef AI_INFERENCE_X86
+AI_TARGET("sse2")
+static inline float ai_hsum_sse(__m128 v) {
+    __m128 high = _mm_movehl_ps(v, v);
+    __m128 sums = _mm_add_ps(v, high);
+    high = _mm_shuffle_ps(sums, sums, 1);
+    return _mm_cvtss_f32(_mm_add_ss(sums, high));
+}
+
+// İşaretli int8 çarpımlarının 4'lü toplamları: |a| * sign(b, a) ile maddubs
+AI_TARGET("ssse3")
+static inline __m128i ai_mul_sum_i8_ssse3(__m128i a, __m128i b) {
+    __m128i ax = _mm_sign_epi8(a, a);
+    __m128i sy = _mm_sign_epi8(b, a);
+    return _mm_madd_epi16(_mm_maddubs_epi16(ax, sy), _mm_set1_epi16(1));
+}
+
+AI_TARGET("ssse3")
+static float ai_dot_q8_0_ssse3(const void* row, const ai_block_qx_t* x, uint32_t blocks) {
+    const ai_block_q8_0_t* w = (const ai_block_q8_0_t*)row;
+    __m128 acc = _mm_setzero_ps();
+    for (uint32_t i = 0; i < blocks; i++) {
+        __m128i lo = ai_mul_sum_i8_ssse3(_mm_loadu_si128((const __m128i*)w[i].qs),
+                                         _mm_loadu_si128((const __m128i*)x[i].qs));
+        __m128i hi = ai_mul_sum_i8_ssse3(_mm_loadu_si128((const __m128i*)(w[i].qs + 16)),
+                                         _mm_loadu_si128((const __m128i*)(x[i].qs + 16)));
+        __m128 scale = _mm_set1_ps(ai_fp16_to_fp32(w[i].d) * x[i].d);
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(lo, hi)), scale));
+    }
+    return ai_hsum_sse(acc);
+}
+
+AI_TARGET("ssse3")
+static float ai_dot_q4_0_ssse3(const void* row, const ai_block_qx_t* x, uint32_t blocks) {
+    const ai_block_q4_0_t* w = (const ai_block_q4_0_t*)row;
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    const __m128i offset = _mm_set1_epi8(8);
+    __m128 acc = _mm_setzero_ps();
+    for (uint32_t i = 0; i < blocks; i++) {
+        __m128i packed = _mm_loadu_si128((const __m128i*)w[i].qs);
+        __m128i lo = _mm_sub_epi8(_mm_and_si128(packed, mask), offset);
+        __m128i hi = _mm_sub_epi8(_mm_and_si128(_mm_srli_epi16(packed, 4), mask), offset);
+        __m128i sum = _mm_add_epi32(ai_mul_sum_i8_ssse3(lo, _mm_loadu_si128((const __m128i*)x[i].qs)),
+                                    ai_mul_sum_i8_ssse3(hi, _mm_loadu_si128((const __m128i*)(x[i].qs + 16))));
+        __m128 scale = _mm_set1_ps(ai_fp16_to_fp32(w[i].d) * x[i].d);
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_cvtepi32_ps(sum), scale));
+    }
+    return ai_hsum_sse(acc);
+}
+
+AI_TARGET("sse2")
+static float ai_dot_f32_sse(const float* a, const float* b, uint32_t n) {
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(b + i + 4)));
+    }
+    float sum = ai_hsum_sse(_mm_add_ps(acc0, acc1));
+    for (; i < n; i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+AI_TARGET("avx2,fma")
+static inline float ai_hsum_avx(__m256 v) {
+    return ai_hsum_sse(_mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1)));
+}
+
+AI_TARGET("avx2,fma")
+static inline __m256 ai_mul_sum_i8_avx2(__m256i a, __m256i b) {
+    __m256i ax = _mm256_sign_epi8(a, a);
+    __m256i sy = _mm256_sign_epi8(b, a);
+    __m256i dot = _mm256_madd_epi16(_mm256_maddubs_epi16(ax, sy), _mm256_set1_epi16(1));
+    return _mm256_cvtepi32_ps(dot);
+}
+
+AI_TARGET("avx2,fma")
+static float ai_dot_q8_0_avx2(const void* row, const ai_block_qx_t* x, uint32_t blocks) {
+    const ai_block_q8_0_t* w = (const ai_block_q8_0_t*)row;
+    __m256 acc = _mm256_setzero_ps();
+    for (uint32_t i = 0; i < blocks; i++) {
+        __m256i wq = _mm256_loadu_si256((const __m256i*)w[i].qs);
+        __m256i xq = _mm256_loadu_si256((const __m256i*)x[i].qs);
+        __m256 scale = _mm256_set1_ps(ai_fp16_to_fp32(w[i].d) * x[i].d);
+        acc = _mm256_fmadd_ps(scale, ai_mul_sum_i8_avx2(wq, xq), acc);
+    }
+    return ai_hsum_avx(acc);
+}
+
+AI_TARGET("avx2,fma")
+static float ai_dot_q4_0_avx2(const void* row, const ai_block_qx_t* x, uint32_t blocks) {
+    const ai_block_q4_0_t* w = (const ai_block_q4_0_t*)row;
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    const __m256i offset = _mm256_set1_epi8(8);
+    __m256 acc = _mm256_setzero_ps();
+    for (uint32_t i = 0; i < blocks; i++) {
+        // Alt dörtlüler ilk 16, üst dörtlüler son 16 öğe
+        __m128i packed = _mm_loadu_si128((const __m128i*)w[i].qs);
+        __m256i nibbles = _mm256_set_m128i(_mm_srli_epi16(packed, 4), packed);
+        __m256i wq = _mm256_sub_epi8(_mm256_and_si256(nibbles, mask), offset);
+        __m256i xq = _mm256_loadu_si256((const __m256i*)x[i].qs);
+        __m256 scale = _mm256_set1_ps(ai_fp16_to_fp32(w[i].d) * x[i].d);
+        acc = _mm256_fmadd_ps(scale, ai_mul_sum_i8_avx2(wq, xq), acc);
+    }
+    return ai_hsum_avx(acc);
+}
+
+AI_TARGET("avx2,fma")
+static float ai_dot_f32_avx2(const float* a, const float* b, uint32_t n) {
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc0);
+        acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8), acc1);
+    }
+    for (; i + 8 <= n; i += 8) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc0);
+    }
+    float sum = ai_hsum_avx(_mm256_add_ps(acc0, acc1));
+    for (; i < n; i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+// YMM durumunun işletim sistemince saklandığını doğrula
+static int ai_os_supports_avx(void) {
+    uint32_t low, high;
+    __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+    (void)high;
+    return (low & 0x6) == 0x6;
+}
+#endif
+
+// fp16 tablosunu kur ve işlemciye göre çekirdekleri seç
+static void ai_init_kernels(void) {
+    for (uint32_t i = 0; i < 65536; i++) {
+        ai_fp16_table[i] = ai_fp16_compute((uint16_t)i);
+    }
+    
+    ai_isa = AI_INFERENCE_ISA_SCALAR;
+    ai_dot_q8_0_impl = ai_dot_q8_0_scalar;
+    ai_dot_q4_0_impl = ai_dot_q4_0_scalar;
+    ai_dot_f32_impl = ai_dot_f32_scalar;
+    
+#ifdef AI_INFERENCE_X86
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return;
+    }
+    
+    if (edx & bit_SSE2) {
+        ai_dot_f32_impl = ai_dot_f32_sse;
+    }
+    
+    if (ecx & bit_SSSE3) {
+        ai_isa = AI_INFERENCE_ISA_SSSE3;
+        ai_dot_q8_0_impl = ai_dot_q8_0_ssse3;
+        ai_dot_q4_0_impl = ai_dot_q4_0_ssse3;
+    }
+    
+    int avx = (ecx & bit_OSXSAVE) && (ecx & bit_AVX) && (ecx & bit_FMA) && ai_os_supports_avx();
+    unsigned int eax7, ebx7, ecx7, edx7;
+    if (avx && __get_cpuid_count(7, 0, &eax7, &ebx7, &ecx7, &edx7) && (ebx7 & bit_AVX2)) {
+        ai_isa = AI_INFERENCE_ISA_AVX2;
+        ai_dot_q8_0_impl = ai_dot_q8_0_avx2;
+        ai_dot_q4_0_impl = ai_dot_q4_0_avx2;
+        ai_dot_f32_impl = ai_dot_f32_avx2;
+    }
+#endif
+}
+
+// Bir satırın bayt boyutu (desteklenmeyen tip ya da blok dışı uzunlukta 0)
+static size_t ai_row_bytes(uint32_t type, uint32_t cols) {
+    switch (type) {
+        case GGML_TYPE_F32:
+            return (size_t)cols * sizeof(float);
+        case GGML_TYPE_F16:
+            return (size_t)cols * sizeof(uint16_t);
+        case GGML_TYPE_Q8_0:
+            return cols % AI_BLOCK ? 0 : (size_t)(cols / AI_BLOCK) * sizeof(ai_block_q8_0_t);
+        case GGML_TYPE_Q4_0:
+            return cols % AI_BLOCK ? 0 : (size_t)(cols / AI_BLOCK) * sizeof(ai_block_q4_0_t);
+        default:
+            return 0;
+    }
+}
+
+// Tensör satırını float'a aç (gömme ve normalizasyon vektörleri için)
+static void ai_tensor_row_to_floats(const ai_tensor_t* tensor, uint32_t row, float* out) {
+    const uint8_t* data = tensor->data + (size_t)row * tensor->row_bytes;
+    
+    switch (tensor->type) {
+        case GGML_TYPE_F32:
+            memcpy(out, data, (size_t)tensor->cols * sizeof(float));
+            break;
+    
+        case GGML_TYPE_F16: {
+            const uint16_t* values = (const uint16_t*)data;
+            for (uint32_t i = 0; i < tensor->cols; i++) {
+                out[i] = ai_fp16_to_fp32(values[i]);
+            }
+            break;
+        }
+    
+        case GGML_TYPE_Q8_0: {
+            const ai_block_q8_0_t* blocks = (const ai_block_q8_0_t*)data;
+            for (uint32_t b = 0; b < tensor->cols / AI_BLOCK; b++) {
+                float d = ai_fp16_to_fp32(blocks[b].d);
+                for (uint32_t j = 0; j < AI_BLOCK; j++) {
+                    out[b * AI_BLOCK + j] = (float)blocks[b].qs[j] * d;
+                }
+            }
+            break;
+        }
+    
+        case GGML_TYPE_Q4_0: {
+            const ai_block_q4_0_t* blocks = (const ai_block_q4_0_t*)data;
+            for (uint32_t b = 0; b < tensor->cols / AI_BLOCK; b++) {
+                float d = ai_fp16_to_fp32(blocks[b].d);
+                for (uint32_t j = 0; j < AI_BLOCK / 2; j++) {
+                    out[b * AI_BLOCK + j] = (float)((int32_t)(blocks[b].qs[j] & 0x0F) - 8) * d;
+                    out[b * AI_BLOCK + j + AI_BLOCK / 2] = (float)((int32_t)(blocks[b].qs[j] >> 4) - 8) * d;
+                }
+            }
+            break;
+        }
+    }
+}
+
+// Etkinleştirmeleri 32'lik bloklarda simetrik int8'e nicemle
+static void ai_quantize_row(const float* x, ai_block_qx_t* out, uint32_t n) {
+    for (uint32_t b = 0; b < n / AI_BLOCK; b++) {
+        const float* values = x + b * AI_BLOCK;
+        float amax = 0.0f;
+        for (uint32_t j = 0; j < AI_BLOCK; j++) {
+            float magnitude = fabsf(values[j]);
+            amax = magnitude > amax ? magnitude : amax;
+        }
+    
+        float d = amax / 127.0f;
+        float id = d > 0.0f ? 1.0f / d : 0.0f;
+        out[b].d = d;
+        for (uint32_t j = 0; j < AI_BLOCK; j++) {
+            float scaled = values[j] * id;
+            out[b].qs[j] = (int8_t)(scaled >= 0.0f ? scaled + 0.5f : scaled - 0.5f);
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// GGUF ayrıştırma
+// ---------------------------------------------------------------------------
+
+static const uint8_t* gguf_take(gguf_reader_t* reader, uint64_t size) {
+    if (reader->failed || size > reader->size - reader->pos) {
+        reader->failed = 1;
+        return NULL;
+    }
+    const uint8_t* data = reader->data + reader->pos;
+    reader->pos += (size_t)size;
+    return data;
+}
+
+static uint32_t gguf_u32(gguf_reader_t* reader) {
+    uint32_t value = 0;
+    const uint8_t* data = gguf_take(reader, sizeof(value));
+    if (data) {
+        memcpy(&value, data, sizeof(value));
+    }
+    return value;
+}
+
+static uint64_t gguf_u64(gguf_reader_t* reader) {
+    uint64_t value = 0;
+    const uint8_t* data = gguf_take(reader, sizeof(value));
+    if (data) {
+        memcpy(&value, data, sizeof(value));
+    }
+    return value;
+}
+
+static const char* gguf_string(gguf_reader_t* reader, uint64_t* length) {
+    *length = gguf_u64(reader);
+    return (const char*)gguf_take(reader, *length);
+}
+
+static int gguf_key_is(const char* key, uint64_t length, const char* expected) {
+    return strlen(expected) == length && memcmp(key, expected, length) == 0;
+}
+
+// Skaler değer tipinin boyutu (dizgi ve dizi için 0)
+static size_t gguf_scalar_size(uint32_t type) {
+    switch (type) {
+        case GGUF_TYPE_UINT8:
+        case GGUF_TYPE_INT8:
+        case GGUF_TYPE_BOOL:
+            return 1;
+        case GGUF_TYPE_UINT16:
+        case GGUF_TYPE_INT16:
+            return 2;
+        case GGUF_TYPE_UINT32:
+        case GGUF_TYPE_INT32:
+        case GGUF_TYPE_FLOAT32:
+            return 4;
+        case GGUF_TYPE_UINT64:
+        case GGUF_TYPE_INT64:
+        case GGUF_TYPE_FLOAT64:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+// Sayısal ya da bool değeri oku
+static double gguf_number(gguf_reader_t* reader, uint32_t type) {
+    const uint8_t* data = gguf_take(reader, gguf_scalar_size(type));
+    if (!data) {
+        return 0.0;
+    }
+    
+    switch (type) {
+        case GGUF_TYPE_UINT8:   return *(const uint8_t*)data;
+        case GGUF_TYPE_INT8:    return *(const int8_t*)data;
+        case GGUF_TYPE_BOOL:    return *data ? 1.0 : 0.0;
+        case GGUF_TYPE_UINT16:  { uint16_t v; memcpy(&v, data, 2); return v; }
+        case GGUF_TYPE_INT16:   { int16_t v; memcpy(&v, data, 2); return v; }
+        case GGUF_TYPE_UINT32:  { uint32_t v; memcpy(&v, data, 4); return v; }
+        case GGUF_TYPE_INT32:   { int32_t v; memcpy(&v, data, 4); return v; }
+        case GGUF_TYPE_FLOAT32: { float v; memcpy(&v, data, 4); return v; }
+        case GGUF_TYPE_UINT64:  { uint64_t v; memcpy(&v, data, 8); return (double)v; }
+        case GGUF_TYPE_INT64:   { int64_t v; memcpy(&v, data, 8); return (double)v; }
+        case GGUF_TYPE_FLOAT64: { double v; memcpy(&v, data, 8); return v; }
+        default:                return 0.0;
+    }
+}
+
+// Bir değeri atla (diziler iç içe olabilir)
+static void gguf_skip(gguf_reader_t* reader, uint32_t type, int depth) {
+    if (type == GGUF_TYPE_STRING) {
+        uint64_t length;
+        gguf_string(reader, &length);
+    } else if (type == GGUF_TYPE_ARRAY) {
+        uint32_t item_type = gguf_u32(reader);
+        uint64_t count = gguf_u64(reader);
+        size_t item_size = gguf_scalar_size(item_type);
+    
+        if (depth > 2) {
+            reader->failed = 1;
+        } else if (item_size > 0) {
+            if (count > (reader->size - reader->pos) / item_size) {
+                reader->failed = 1;
+            } else {
+                gguf_take(reader, count * item_size);
+            }
+        } else {
+            for (uint64_t i = 0; i < count && !reader->failed; i++) {
+                gguf_skip(reader, item_type, depth + 1);
+            }
+        }
+    } else if (gguf_scalar_size(type) > 0) {
+        gguf_take(reader, gguf_scalar_size(type));
+    } else {
+        reader->failed = 1;
+    }
+}
+
+// Sabit uzunluklu dizgiyi kopyala
+static void gguf_copy_string(gguf_reader_t* reader, char* out, size_t capacity) {
+    uint64_t length;
+    const char* value = gguf_string(reader, &length);
+    size_t copy = value ? (length < capacity - 1 ? (size_t)length : capacity - 1) : 0;
+    memcpy(out, value ? value : "", copy);
+    out[copy] = '\0';
+}
+
+// Başlığı, üst verileri ve tensör kayıtlarını oku
+static int ai_parse_gguf(ai_model_t* model, gguf_meta_t* meta, gguf_tensor_info_t** infos_out,
+                         uint64_t* count_out, const uint8_t** data_out, size_t* data_size_out) {
+    gguf_reader_t reader = { (const uint8_t*)model->map, model->map_size, 0, 0 };
+    
+    memset(meta, 0, sizeof(gguf_meta_t));
+    meta->context_length = -1;
+    meta->embedding = -1;
+    meta->block_count = -1;
+    meta->feed_forward = -1;
+    meta->head_count = -1;
+    meta->head_count_kv = -1;
+    meta->rope_base = 10000.0;
+    meta->rope_dims = -1;
+    meta->rms_eps = 1e-5;
+    meta->bos = 1;
+    meta->eos = 2;
+    meta->add_space_prefix = 1;
+    meta->alignment = GGUF_DEFAULT_ALIGNMENT;
+    
+    uint32_t magic = gguf_u32(&reader);
+    uint32_t version = gguf_u32(&reader);
+    if (reader.failed || magic != GGUF_MAGIC) {
+        return AI_INFERENCE_ERROR_FORMAT;
+    }
+    if (version < 2 || version > 3) {
+        return AI_INFERENCE_ERROR_UNSUPPORTED;
+    }
+    
+    uint64_t tensor_count = gguf_u64(&reader);
+    uint64_t kv_count = gguf_u64(&reader);
+    
+    // Üst veriler
+    for (uint64_t i = 0; i < kv_count && !reader.failed; i++) {
+        uint64_t key_len;
+        const char* key = gguf_string(&reader, &key_len);
+        uint32_t type = gguf_u32(&reader);
+        if (reader.failed) {
+            break;
+        }
+    
+        if (type == GGUF_TYPE_ARRAY) {
+            size_t start = reader.pos;
+            uint32_t item_type = gguf_u32(&reader);
+            uint64_t count = gguf_u64(&reader);
+            const uint8_t* items = reader.data + reader.pos;
+    
+            if (gguf_key_is(key, key_len, "tokenizer.ggml.tokens") && item_type == GGUF_TYPE_STRING) {
+                meta->tokens = items;
+                meta->token_count = count;
+            } else if (gguf_key_is(key, key_len, "tokenizer.ggml.scores") && item_type == GGUF_TYPE_FLOAT32) {
+                meta->scores = items;
+                meta->score_count = count;
+            } else if (gguf_key_is(key, key_len, "tokenizer.ggml.token_type") && item_type == GGUF_TYPE_INT32) {
+                meta->token_types = items;
+                meta->token_type_count = count;
+            }
+    
+            reader.pos = start;
+            gguf_skip(&reader, GGUF_TYPE_ARRAY, 0);
+        } else if (type == GGUF_TYPE_STRING) {
+            if (gguf_key_is(key, key_len, "general.architecture")) {
+                gguf_copy_string(&reader, meta->architecture, sizeof(meta->architecture));
+            } else if (gguf_key_is(key, key_len, "tokenizer.ggml.model")) {
+                gguf_copy_string(&reader, meta->tokenizer, sizeof(meta->tokenizer));
+            } else {
+                gguf_skip(&reader, type, 0);
+            }
+        } else if (gguf_scalar_size(type) > 0) {
+            double value = gguf_number(&reader, type);
+    
+            if (gguf_key_is(key, key_len, "llama.context_length")) meta->context_length = value;
+            else if (gguf_key_is(key, key_len, "llama.embedding_length")) meta->embedding = value;
+            else if (gguf_key_is(key, key_len, "llama.block_count")) meta->block_count = value;
+            else if (gguf_key_is(key, key_len, "llama.feed_forward_length")) meta->feed_forward = value;
+            else if (gguf_key_is(key, key_len, "llama.attention.head_count")) meta->head_count = value;
+            else if (gguf_key_is(key, key_len, "llama.attention.head_count_kv")) meta->head_count_kv = value;
+            else if (gguf_key_is(key, key_len, "llama.rope.freq_base")) meta->rope_base = value;
+            else if (gguf_key_is(key, key_len, "llama.rope.dimension_count")) meta->rope_dims = value;
+            else if (gguf_key_is(key, key_len, "llama.attention.layer_norm_rms_epsilon")) meta->rms_eps = value;
+            else if (gguf_key_is(key, key_len, "tokenizer.ggml.bos_token_id")) meta->bos = value;
+            else if (gguf_key_is(key, key_len, "tokenizer.ggml.eos_token_id")) meta->eos = value;
+            else if (gguf_key_is(key, key_len, "tokenizer.ggml.add_space_prefix")) meta->add_space_prefix = value;
+            else if (gguf_key_is(key, key_len, "general.alignment")) meta->alignment = (uint64_t)value;
+        } else {
+            reader.failed = 1;
+        }
+    }
+    
+    // Tensör kayıtları (her kayıt en az 24 bayt)
+    if (reader.failed || tensor_count > (reader.size - reader.pos) / 24) {
+        return AI_INFERENCE_ERROR_FORMAT;
+    }
+    
+    gguf_tensor_info_t* infos = (gguf_tensor_info_t*)calloc(tensor_count ? tensor_count : 1, sizeof(gguf_tensor_info_t));
+    if (!infos) {
+        return AI_INFERENCE_ERROR_NO_MEMORY;
+    }
+    
+    for (uint64_t i = 0; i < tensor_count && !reader.failed; i++) {
+        gguf_tensor_info_t* info = &infos[i];
+        info->name = gguf_string(&reader, &info->name_len);
+        info->n_dims = gguf_u32(&reader);
+        if (info->n_dims == 0 || info->n_dims > GGUF_MAX_DIMS) {
+            reader.failed = 1;
+            break;
+        }
+        for (uint32_t d = 0; d < GGUF_MAX_DIMS; d++) {
+            info->dims[d] = d < info->n_dims ? gguf_u64(&reader) : 1;
+        }
+        info->type = gguf_u32(&reader);
+        info->offset = gguf_u64(&reader);
+    }
+    
+    // Hizalama 8'in katı bir ikinin kuvveti olmalı; tensörler buna göre
+    // hizalıysa float ve fp16 okumaları da hizalı olur
+    uint64_t alignment = meta->alignment;
+    if (reader.failed || alignment < 8 || alignment > 65536 || (alignment & (alignment - 1)) != 0) {
+        free(infos);
+        return AI_INFERENCE_ERROR_FORMAT;
+    }
+    
+    for (uint64_t i = 0; i < tensor_count; i++) {
+        if (infos[i].offset % alignment != 0) {
+            free(infos);
+            return AI_INFERENCE_ERROR_FORMAT;
+        }
+    }
+    
+    // Veri bölümü hizalanmış olarak başlar
+    size_t data_start = (size_t)((reader.pos + alignment - 1) & ~(alignment - 1));
+    if (data_start > reader.size) {
+        free(infos);
+        return AI_INFERENCE_ERROR_FORMAT;
+    }
+    
+    *infos_out = infos;
+    *count_out = tensor_count;
+    *data_out = reader.data + data_start;
+    *data_size_out = reader.size - data_start;
+    return 0;
+}
+
+static const gguf_tensor_info_t* ai_find_tensor(const gguf_tensor_info_t* infos, uint64_t count, const char* name) {
+    size_t length = strlen(name);
+    for (uint64_t i = 0; i < count; i++) {
+        if (infos[i].name_len == length && memcmp(infos[i].name, name, length) == 0) {
+            return &infos[i];
+        }
+    }
+    return NULL;
+}
+
+// Tensörü bul, boyutlarını ve tipini doğrula
+static int ai_bind_tensor(const gguf_tensor_info_t* infos, uint64_t count, const uint8_t* data, size_t data_size,
+                          const char* name, uint32_t cols, uint32_t rows, ai_tensor_t* tensor) {
+    const gguf_tensor_info_t* info = ai_find_tensor(infos, count, name);
+    if (!info) {
+        fprintf(stderr, "[AI] Tensör eksik: %s\n", name);
+        return AI_INFERENCE_ERROR_FORMAT;
+    }
+    
+    if (info->dims[0] != cols || info->dims[1] != rows || info->dims[2] != 1 || info->dims[3] != 1) {
+        fprintf(stderr, "[AI] Tensör boyutu uyumsuz: %s\n", name);
+        return AI_INFERENCE_ERROR_FORMAT;
+    }
+    
+    size_t row_bytes = ai_row_bytes(info->type, cols);
+    if (row_bytes == 0) {
+        fprintf(stderr, "[AI] Desteklenmeyen tensör tipi %u: %s\n", info->type, name);
+        return AI_INFERENCE_ERROR_UNSUPPORTED;
+    }
+    
+    // 32 bit derlemede çarpım taşabilir
+    size_t tensor_bytes;
+    if (info->offset > data_size || __builtin_mul_overflow(row_bytes, (size_t)rows, &tensor_bytes) ||
+        tensor_bytes > data_size - info->offset) {
+        return AI_INFERENCE_ERROR_FORMAT;
+    }
+    
+    tensor->data = data + info->offset;
+    tensor->type = info->type;
+    tensor->cols = cols;
+    tensor->rows = rows;
+    tensor->row_bytes = row_bytes;
+    return 0;
+}
+
+// Normalizasyon vektörünü bul ve float olarak aç
+static int ai_bind_norm(const gguf_tensor_info_t* infos, uint64_t count, const uint8_t* data, size_t data_size,
+                        const char* name, uint32_t length, float* out) {
+    ai_tensor_t tensor;
+    int result = ai_bind_tensor(infos, count, data, data_size, name, length, 1, &tensor);
+    if (result == 0) {
+        ai_tensor_row_to_floats(&tensor, 0, out);
+    }
+    return result;
+}
+
+// Hiperparametreleri doğrula ve ağırlıkları bağla
+static int ai_bind_weights(ai_model_t* model, const gguf_meta_t* meta, const gguf_tensor_info_t* infos,
+                           uint64_t count, const uint8_t* data, size_t data_size) {
+    if (strcmp(meta->architecture, "llama") != 0) {
+        fprintf(stderr, "[AI] Desteklenmeyen mimari: %s\n", meta->architecture);
+        return AI_INFERENCE_ERROR_UNSUPPORTED;
+    }
+    
+    if (meta->embedding <= 0 || meta->block_count <= 0 || meta->feed_forward <= 0 ||
+        meta->head_count <= 0 || meta->embedding > 65536 || meta->block_count > 1024 ||
+        meta->feed_forward > 262144 || meta->head_count > 1024) {
+        return AI_INFERENCE_ERROR_FORMAT;
+    }
+    
+    model->n_embd = (uint32_t)meta->embedding;
+    model->n_layer = (uint32_t)meta->block_count;
+    model->n_ff = (uint32_t)meta->feed_forward;
+    model->n_head = (uint32_t)meta->head_count;
+    model->n_head_kv = meta->head_count_kv > 0 ? (uint32_t)meta->head_count_kv : model->n_head;
+    model->rms_eps = (float)meta->rms_eps;
+    
+    // Etkinleştirmeler 32'lik bloklarda nicemlenir
+    if (model->n_embd % model->n_head != 0 || model->n_head % model->n_head_kv != 0 ||
+        model->n_embd % AI_BLOCK != 0 || model->n_ff % AI_BLOCK != 0 ||
+        ((model->n_embd / model->n_head) & 1) != 0) {
+        return AI_INFERENCE_ERROR_UNSUPPORTED;
+    }
+    model->head_dim = model->n_embd / model->n_head;
+    model->kv_dim = model->head_dim * model->n_head_kv;
+    
+    if (meta->rope_dims > 0 && (uint32_t)meta->rope_dims != model->head_dim) {
+        return AI_INFERENCE_ERROR_UNSUPPORTED;
+    }
+    
+    model->layers = (ai_layer_t*)calloc(model->n_layer, sizeof(ai_layer_t));
+    model->norms = (float*)malloc(((size_t)model->n_layer * 2 + 1) * model->n_embd * sizeof(float));
+    if (!model->layers || !model->norms) {
+        return AI_INFERENCE_ERROR_NO_MEMORY;
+    }
+    
+    int result = ai_bind_tensor(infos, count, data, data_size, "token_embd.weight",
+                                model->n_embd, model->n_vocab, &model->token_embd);
+    if (result != 0) {
+        return result;
+    }
+    
+    // Ayrı çıkış katmanı yoksa gömme matrisi paylaşılır
+    if (ai_find_tensor(infos, count, "output.weight")) {
+        result = ai_bind_tensor(infos, count, data, data_size, "output.weight",
+                                model->n_embd, model->n_vocab, &model->output);
+    } else {
+        model->output = model->token_embd;
+    }
+    if (result != 0) {
+        return result;
+    }
+    
+    model->output_norm = model->norms + (size_t)model->n_layer * 2 * model->n_embd;
+    result = ai_bind_norm(infos, count, data, data_size, "output_norm.weight", model->n_embd, model->output_norm);
+    
+    for (uint32_t l = 0; l < model->n_layer && result == 0; l++) {
+        ai_layer_t* layer = &model->layers[l];
+        char name[64];
+    
+        layer->attn_norm = model->norms + (size_t)l * 2 * model->n_embd;
+        layer->ffn_norm = layer->attn_norm + model->n_embd;
+    
+        snprintf(name, sizeof(name), "blk.%u.attn_norm.weight", l);
+        result = ai_bind_norm(infos, count, data, data_size, name, model->n_embd, layer->attn_norm);
+        if (result == 0) {
+            snprintf(name, sizeof(name), "blk.%u.ffn_norm.weight", l);
+            result = ai_bind_norm(infos, count, data, data_size, name, model->n_embd, layer->ffn_norm);
+        }
+    
+        struct {
+            const char* suffix;
+            ai_tensor_t* tensor;
+            uint32_t cols;
+            uint32_t rows;
+        } weights[] = {
+            { "attn_q", &layer->wq, model->n_embd, model->n_embd },
+            { "attn_k", &layer->wk, model->n_embd, model->kv_dim },
+            { "attn_v", &layer->wv, model->n_embd, model->kv_dim },
+            { "attn_output", &layer->wo, model->n_embd, model->n_embd },
+            { "ffn_gate", &layer->w_gate, model->n_embd, model->n_ff },
+            { "ffn_up", &layer->w_up, model->n_embd, model->n_ff },
+            { "ffn_down", &layer->w_down, model->n_ff, model->n_embd },
+        };
+    
+        for (size_t w = 0; w < sizeof(weights) / sizeof(weights[0]) && result == 0; w++) {
+            snprintf(name, sizeof(name), "blk.%u.%s.weight", l, weights[w].suffix);
+            result = ai_bind_tensor(infos, count, data, data_size, name,
+                                    weights[w].cols, weights[w].rows, weights[w].tensor);
+        }
+    }
+    
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+// Sözlük (SentencePiece)
+// ---------------------------------------------------------------------------
+
+static uint32_t ai_hash(const char* text, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ (uint8_t)text[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static uint32_t ai_vocab_find(const ai_model_t* model, const char* text, size_t length) {
+    uint32_t slot = ai_hash(text, length) & model->vocab_mask;
+    while (model->vocab_index[slot] != 0) {
+        uint32_t id = model->vocab_index[slot] - 1;
+        if (model->vocab_len[id] == length && memcmp(model->vocab[id], text, length) == 0) {
+            return id;
+        }
+        slot = (slot + 1) & model->vocab_mask;
+    }
+    return AI_TOKEN_NONE;
+}
+
+static int ai_load_vocab(ai_model_t* model, const gguf_meta_t* meta) {
+    if (strcmp(meta->tokenizer, "llama") != 0 || !meta->tokens || meta->token_count == 0 ||
+        meta->token_count > 1000000) {
+        fprintf(stderr, "[AI] Desteklenmeyen sözlük: %s\n", meta->tokenizer);
+        return AI_INFERENCE_ERROR_UNSUPPORTED;
+    }
+    
+    uint32_t n_vocab = (uint32_t)meta->token_count;
+    model->n_vocab = n_vocab;
+    
+    // Dizgilerin toplam boyutu
+    gguf_reader_t reader = { (const uint8_t*)model->map, model->map_size,
+                             (size_t)(meta->tokens - (const uint8_t*)model->map), 0 };
+    size_t pool_size = 0;
+    for (uint32_t i = 0; i < n_vocab; i++) {
+        uint64_t length;
+        gguf_string(&reader, &length);
+        if (reader.failed || length > 1024) {
+            return AI_INFERENCE_ERROR_FORMAT;
+        }
+        pool_size += (size_t)length + 1;
+    }
+    
+    uint32_t index_size = 1;
+    while (index_size < n_vocab * 2) {
+        index_size <<= 1;
+    }
+    
+    model->vocab = (char**)malloc(n_vocab * sizeof(char*));
+    model->vocab_len = (uint32_t*)malloc(n_vocab * sizeof(uint32_t));
+    model->scores = (float*)calloc(n_vocab, sizeof(float));
+    model->token_types = (uint8_t*)calloc(n_vocab, 1);
+    model->vocab_pool = (char*)malloc(pool_size);
+    model->vocab_index = (uint32_t*)calloc(index_size, sizeof(uint32_t));
+    if (!model->vocab || !model->vocab_len || !model->scores || !model->token_types ||
+        !model->vocab_pool || !model->vocab_index) {
+        return AI_INFERENCE_ERROR_NO_MEMORY;
+    }
+    model->vocab_mask = index_size - 1;
+    
+    reader.pos = (size_t)(meta->tokens - (const uint8_t*)model->map);
+    char* cursor = model->vocab_pool;
+    for (uint32_t i = 0; i < n_vocab; i++) {
+        uint64_t length;
+        const char* text = gguf_string(&reader, &length);
+        memcpy(cursor, text, (size_t)length);
+        cursor[length] = '\0';
+        model->vocab[i] = cursor;
+        model->vocab_len[i] = (uint32_t)length;
+        model->max_token_len = (uint32_t)length > model->max_token_len ? (uint32_t)length : model->max_token_len;
+        cursor += length + 1;
+    
+        // Aynı dizgi birden fazla kez varsa ilki kullanılır
+        if (ai_vocab_find(model, text, (size_t)length) == AI_TOKEN_NONE) {
+            uint32_t slot = ai_hash(text, (size_t)length) & model->vocab_mask;
+            while (model->vocab_index[slot] != 0) {
+                slot = (slot + 1) & model->vocab_mask;
+            }
+            model->vocab_index[slot] = i + 1;
+        }
+    }
+    
+    if (meta->scores && meta->score_count == n_vocab &&
+        (size_t)(meta->scores - (const uint8_t*)model->map) + (size_t)n_vocab * 4 <= model->map_size) {
+        memcpy(model->scores, meta->scores, (size_t)n_vocab * sizeof(float));
+    }
+    
+    if (meta->token_types && meta->token_type_count == n_vocab &&
+        (size_t)(meta->token_types - (const uint8_t*)model->map) + (size_t)n_vocab * 4 <= model->map_size) {
+        for (uint32_t i = 0; i < n_vocab; i++) {
+            int32_t type;
+            memcpy(&type, meta->token_types + (size_t)i * 4, sizeof(type));
+            model->token_types[i] = (uint8_t)type;
+        }
+    }
+    
+    // Bayt geri dönüş tokenları ("<0xAB>")
+    for (uint32_t b = 0; b < 256; b++) {
+        char piece[8];
+        snprintf(piece, sizeof(piece), "<0x%02X>", b);
+        model->byte_tokens[b] = ai_vocab_find(model, piece, 6);
+        if (model->byte_tokens[b] != AI_TOKEN_NONE && !meta->token_types) {
+            model->token_types[model->byte_tokens[b]] = AI_TOKEN_TYPE_BYTE;
+        }
+    }
+    
+    model->bos = (uint32_t)meta->bos < n_vocab ? (uint32_t)meta->bos : 0;
+    model->eos = (uint32_t)meta->eos < n_vocab ? (uint32_t)meta->eos : 0;
+    model->add_space_prefix = meta->add_space_prefix != 0;
+    return 0;
+}
+
+// Metni tokenlara böl: karakterler sözlükte aranır (yoksa baytlar), sonra
+// skoru en yüksek komşu birleşim tekrar tekrar uygulanır
+static int ai_encode(ai_model_t* model, const char* text, uint32_t* tokens, uint32_t capacity, uint32_t* count) {
+    static const char space[] = "\xE2\x96\x81";     // "▁"
+    size_t length = strlen(text);
+    
+    // SentencePiece biçimi: boşluklar "▁", başta bir "▁"
+    char* normalized = (char*)malloc(length * 3 + 4);
+    char* merged = (char*)malloc((size_t)model->max_token_len * 2 + 1);
+    if (!normalized || !merged) {
+        free(normalized);
+        free(merged);
+        return AI_INFERENCE_ERROR_NO_MEMORY;
+    }
+    
+    size_t n_bytes = 0;
+    if (model->add_space_prefix && length > 0) {
+        memcpy(normalized, space, 3);
+        n_bytes = 3;
+    }
+    for (size_t i = 0; i < length; i++) {
+        if (text[i] == ' ') {
+            memcpy(normalized + n_bytes, space, 3);
+            n_bytes += 3;
+        } else {
+            normalized[n_bytes++] = text[i];
+        }
+    }
+    
+    uint32_t n = 0;
+    tokens[n++] = model->bos;
+    
+    for (size_t i = 0; i < n_bytes && n < capacity;) {
+        uint8_t lead = (uint8_t)normalized[i];
+        size_t char_len = lead < 0x80 ? 1 : lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 1;
+        if (char_len > n_bytes - i) {
+            char_len = n_bytes - i;
+        }
+    
+        uint32_t id = ai_vocab_find(model, normalized + i, char_len);
+        if (id != AI_TOKEN_NONE) {
+            tokens[n++] = id;
+        } else {
+            for (size_t b = 0; b < char_len && n < capacity; b++) {
+                uint32_t byte_token = model->byte_tokens[(uint8_t)normalized[i + b]];
+                tokens[n++] = byte_token != AI_TOKEN_NONE ? byte_token : 0;
+            }
+        }
+        i += char_len;
+    }
+    
+    // Birleştirme (BOS'a dokunulmaz)
+    for (;;) {
+        float best_score = -1e30f;
+        uint32_t best_id = AI_TOKEN_NONE;
+        uint32_t best_index = 0;
+    
+        for (uint32_t i = 1; i + 1 < n; i++) {
+            uint32_t a = tokens[i];
+            uint32_t b = tokens[i + 1];
+            memcpy(merged, model->vocab[a], model->vocab_len[a]);
+            memcpy(merged + model->vocab_len[a], model->vocab[b], model->vocab_len[b]);
+    
+            uint32_t id = ai_vocab_find(model, merged, (size_t)model->vocab_len[a] + model->vocab_len[b]);
+            if (id != AI_TOKEN_NONE && model->scores[id] > best_score) {
+                best_score = model->scores[id];
+                best_id = id;
+                best_index = i;
+            }
+        }
+    
+        if (best_id == AI_TOKEN_NONE) {
+            break;
+        }
+    
+        tokens[best_index] = best_id;
+        memmove(&tokens[best_index + 1], &tokens[best_index + 2], (n - best_index - 2) * sizeof(uint32_t));
+        n--;
+    }
+    
+    free(normalized);
+    free(merged);
+    *count = n;
+    return 0;
+}
+
+// Üretilen metin
+typedef struct {
+    char* data;
+    size_t length;
+    size_t capacity;
+} ai_text_t;
+
+static int ai_text_append(ai_text_t* text, const char* data, size_t length) {
+    if (text->length + length + 1 > text->capacity) {
+        size_t capacity = text->capacity ? text->capacity * 2 : 256;
+        while (capacity < text->length + length + 1) {
+            capacity *= 2;
+        }
+        char* grown = (char*)realloc(text->data, capacity);
+        if (!grown) {
+            return AI_INFERENCE_ERROR_NO_MEMORY;
+        }
+        text->data = grown;
+        text->capacity = capacity;
+    }
+    
+    memcpy(text->data + text->length, data, length);
+    text->length += length;
+    text->data[text->length] = '\0';
+    return 0;
+}
+
+// Tokenın metnini ekle: "▁" boşluğa, bayt tokenları bayta çevrilir
+static int ai_append_token(ai_model_t* model, ai_text_t* text, uint32_t token) {
+    const char* piece = model->vocab[token];
+    uint32_t length = model->vocab_len[token];
+    
+    if (model->token_types[token] == AI_TOKEN_TYPE_CONTROL) {
+        return 0;
+    }
+    
+    if (model->token_types[token] == AI_TOKEN_TYPE_BYTE && length == 6) {
+        char byte = (char)strtol(piece + 3, NULL, 16);
+        return ai_text_append(text, &byte, 1);
+    }
+    
+    uint32_t start = 0;
+    for (uint32_t i = 0; i + 2 < length; i++) {
+        if ((uint8_t)piece[i] == 0xE2 && (uint8_t)piece[i + 1] == 0x96 && (uint8_t)piece[i + 2] == 0x81) {
+            if (ai_text_append(text, piece + start, i - start) != 0 || ai_text_append(text, " ", 1) != 0) {
+                return AI_INFERENCE_ERROR_NO_MEMORY;
+            }
+            start = i + 3;
+            i += 2;
+        }
+    }
+    return ai_text_append(text, piece + start, length - start);
+}
+
+// ---------------------------------------------------------------------------
+// İş parçacığı havuzu
+// ---------------------------------------------------------------------------
+
+static void ai_pool_work(ai_model_t* model) {
+    ai_pool_t* pool = &model->pool;
+    for (;;) {
+        uint32_t start = __atomic_fetch_add(&pool->next, pool->chunk, __ATOMIC_RELAXED);
+        if (start >= pool->total) {
+            break;
+        }
+        uint32_t end = start + pool->chunk < pool->total ? start + pool->chunk : pool->total;
+        pool->task(model, pool->arg, start, end);
+    }
+}
+
+static inline void ai_cpu_relax(void) {
+#ifdef AI_INFERENCE_X86
+    __builtin_ia32_pause();
+#endif
+}
+
+static void* ai_pool_worker(void* arg) {
+    ai_model_t* model = (ai_model_t*)arg;
+    ai_pool_t* pool = &model->pool;
+    uint64_t seen = 0;
+    
+    for (;;) {
+        // Yeni işi önce dönerek, sonra uyuyarak bekle
+        uint64_t generation = __atomic_load_n(&pool->generation, __ATOMIC_ACQUIRE);
+        for (uint32_t spin = 0; generation == seen && spin < AI_POOL_SPIN; spin++) {
+            ai_cpu_relax();
+            generation = __atomic_load_n(&pool->generation, __ATOMIC_ACQUIRE);
+        }
+    
+        if (generation == seen) {
+            pthread_mutex_lock(&pool->lock);
+            while ((generation = __atomic_load_n(&pool->generation, __ATOMIC_ACQUIRE)) == seen) {
+                pool->sleepers++;
+                pthread_cond_wait(&pool->start_cond, &pool->lock);
+                pool->sleepers--;
+            }
+            pthread_mutex_unlock(&pool->lock);
+        }
+        seen = generation;
+    
+        if (__atomic_load_n(&pool->stop, __ATOMIC_ACQUIRE)) {
+            break;
+        }
+    
+        ai_pool_work(model);
+    
+        if (__atomic_sub_fetch(&pool->active, 1, __ATOMIC_ACQ_REL) == 0) {
+            pthread_mutex_lock(&pool->lock);
+            pthread_cond_signal(&pool->done_cond);
+            pthread_mutex_unlock(&pool->lock);
+        }
+    }
+    return NULL;
+}
+
+static int ai_pool_start(ai_model_t* model, uint32_t threads) {
+    ai_pool_t* pool = &model->pool;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start_cond, NULL);
+    pthread_cond_init(&pool->done_cond, NULL);
+    
+    for (uint32_t i = 0; i + 1 < threads; i++) {
+        if (pthread_create(&pool->threads[i], NULL, ai_pool_worker, model) != 0) {
+            break;
+        }
+        pool->started++;
+    }
+    pool->workers = pool->started;
+    return 0;
+}
+
+static void ai_pool_stop(ai_model_t* model) {
+    ai_pool_t* pool = &model->pool;
+    
+    pthread_mutex_lock(&pool->lock);
+    __atomic_store_n(&pool->stop, 1, __ATOMIC_RELEASE);
+    __atomic_add_fetch(&pool->generation, 1, __ATOMIC_RELEASE);
+    pthread_cond_broadcast(&pool->start_cond);
+    pthread_mutex_unlock(&pool->lock);
+    
+    for (uint32_t i = 0; i < pool->started; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+    
+    pthread_cond_destroy(&pool->done_cond);
+    pthread_cond_destroy(&pool->start_cond);
+    pthread_mutex_destroy(&pool->lock);
+}
+
+// total işi parçalara bölüp havuzda çalıştır; dönüşte iş bitmiştir
+static void ai_pool_run(ai_model_t* model, ai_task_t task, void* arg, uint32_t total, uint32_t min_chunk) {
+    ai_pool_t* pool = &model->pool;
+    if (pool->workers == 0 || total <= min_chunk) {
+        task(model, arg, 0, total);
+        return;
+    }
+    
+    uint32_t chunk = total / ((pool->workers + 1) * 4);
+    pool->task = task;
+    pool->arg = arg;
+    pool->total = total;
+    pool->chunk = chunk > min_chunk ? chunk : min_chunk;
+    __atomic_store_n(&pool->next, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&pool->active, pool->workers, __ATOMIC_RELAXED);
+    
+    pthread_mutex_lock(&pool->lock);
+    __atomic_add_fetch(&pool->generation, 1, __ATOMIC_RELEASE);
+    if (pool->sleepers > 0) {
+        pthread_cond_broadcast(&pool->start_cond);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    
+    ai_pool_work(model);
+    
+    for (uint32_t spin = 0; spin < AI_POOL_SPIN; spin++) {
+        if (__atomic_load_n(&pool->active, __ATOMIC_ACQUIRE) == 0) {
+            return;
+        }
+        ai_cpu_relax();
+    }
+    
+    pthread_mutex_lock(&pool->lock);
+    while (__atomic_load_n(&pool->active, __ATOMIC_ACQUIRE) != 0) {
+        pthread_cond_wait(&pool->done_cond, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+// ---------------------------------------------------------------------------
+// İleri geçiş
+// ---------------------------------------------------------------------------
+
+// Aynı girdiyle en çok üç çarpım tek iş olarak dağıtılır
+typedef struct {
+    uint32_t count;
+    const ai_tensor_t* tensors[3];
+    float* outputs[3];
+    uint32_t offsets[4];
+    const float* x;
+    const ai_block_qx_t* xq;
+} ai_matmul_job_t;
+
+static void ai_matmul_rows(const ai_tensor_t* tensor, const float* x, const ai_block_qx_t* xq,
+                           float* out, uint32_t start, uint32_t end) {
+    const uint8_t* row = tensor->data + (size_t)start * tensor->row_bytes;
+    uint32_t blocks = tensor->cols / AI_BLOCK;
+    
+    switch (tensor->type) {
+        case GGML_TYPE_Q8_0:
+            for (uint32_t r = start; r < end; r++, row += tensor->row_bytes) {
+                out[r] = ai_dot_q8_0_impl(row, xq, blocks);
+            }
+            break;
+    
+        case GGML_TYPE_Q4_0:
+            for (uint32_t r = start; r < end; r++, row += tensor->row_bytes) {
+                out[r] = ai_dot_q4_0_impl(row, xq, blocks);
+            }
+            break;
+    
+        case GGML_TYPE_F32:
+            for (uint32_t r = start; r < end; r++, row += tensor->row_bytes) {
+                out[r] = ai_dot_f32_impl((const float*)row, x, tensor->cols);
+            }
+            break;
+    
+        case GGML_TYPE_F16:
+            for (uint32_t r = start; r < end; r++, row += tensor->row_bytes) {
+                const uint16_t* values = (const uint16_t*)row;
+                float sum = 0.0f;
+                for (uint32_t i = 0; i < tensor->cols; i++) {
+                    sum += ai_fp16_to_fp32(values[i]) * x[i];
+                }
+                out[r] = sum;
+            }
+            break;
+    }
+}
+
+static void ai_matmul_task(ai_model_t* model, void* arg, uint32_t start, uint32_t end) {
+    (void)model;
+    ai_matmul_job_t* job = (ai_matmul_job_t*)arg;
+    for (uint32_t t = 0; t < job->count; t++) {
+        uint32_t lo = start > job->offsets[t] ? start : job->offsets[t];
+        uint32_t hi = end < job->offsets[t + 1] ? end : job->offsets[t + 1];
+        if (lo < hi) {
+            ai_matmul_rows(job->tensors[t], job->x, job->xq, job->outputs[t],
+                           lo - job->offsets[t], hi - job->offsets[t]);
+        }
+    }
+}
+
+// out_i = W_i · x (tüm W_i aynı sütun sayısında)
+static void ai_matmul(ai_model_t* model, const float* x, uint32_t count,
+                      const ai_tensor_t* const* tensors, float* const* outputs) {
+    ai_matmul_job_t job;
+    job.count = count;
+    job.x = x;
+    job.xq = model->xq;
+    job.offsets[0] = 0;
+    
+    int quantized = 0;
+    for (uint32_t t = 0; t < count; t++) {
+        job.tensors[t] = tensors[t];
+        job.outputs[t] = outputs[t];
+        job.offsets[t + 1] = job.offsets[t] + tensors[t]->rows;
+        quantized |= tensors[t]->type == GGML_TYPE_Q8_0 || tensors[t]->type == GGML_TYPE_Q4_0;
+    }
+    
+    if (quantized) {
+        ai_quantize_row(x, model->xq, tensors[0]->cols);
+    }
+    
+    ai_pool_run(model, ai_matmul_task, &job, job.offsets[count], 16);
+}
+
+static void ai_rmsnorm(float* out, const float* x, const float* weight, uint32_t n, float eps) {
+    float sum = 0.0f;
+    for (uint32_t i = 0; i < n; i++) {
+        sum += x[i] * x[i];
+    }
+    float scale = 1.0f / sqrtf(sum / (float)n + eps);
+    for (uint32_t i = 0; i < n; i++) {
+        out[i] = x[i] * scale * weight[i];
+    }
+}
+
+static void ai_softmax(float* x, uint32_t n) {
+    float max = x[0];
+    for (uint32_t i = 1; i < n; i++) {
+        max = x[i] > max ? x[i] : max;
+    }
+    float sum = 0.0f;
+    for (uint32_t i = 0; i < n; i++) {
+        x[i] = expf(x[i] - max);
+        sum += x[i];
+    }
+    for (uint32_t i = 0; i < n; i++) {
+        x[i] /= sum;
+    }
+}
+
+// Dikkat işi: başlıklar paylaştırılır
+typedef struct {
+    uint32_t layer;
+    uint32_t pos;
+} ai_attention_job_t;
+
+static void ai_attention_task(ai_model_t* model, void* arg, uint32_t start, uint32_t end) {
+    const ai_attention_job_t* job = (const ai_attention_job_t*)arg;
+    uint32_t head_dim = model->head_dim;
+    uint32_t group = model->n_head / model->n_head_kv;
+    float scale = 1.0f / sqrtf((float)head_dim);
+    size_t layer_offset = (size_t)job->layer * model->n_ctx * model->kv_dim;
+    
+    for (uint32_t h = start; h < end; h++) {
+        const float* q = model->q + (size_t)h * head_dim;
+        float* att = model->att + (size_t)h * model->n_ctx;
+        size_t kv_offset = layer_offset + (size_t)(h / group) * head_dim;
+    
+        for (uint32_t t = 0; t <= job->pos; t++) {
+            const float* k = model->key_cache + kv_offset + (size_t)t * model->kv_dim;
+            att[t] = ai_dot_f32_impl(q, k, head_dim) * scale;
+        }
+        ai_softmax(att, job->pos + 1);
+    
+        float* out = model->xb + (size_t)h * head_dim;
+        memset(out, 0, head_dim * sizeof(float));
+        for (uint32_t t = 0; t <= job->pos; t++) {
+            const float* v = model->value_cache + kv_offset + (size_t)t * model->kv_dim;
+            float weight = att[t];
+            for (uint32_t i = 0; i < head_dim; i++) {
+                out[i] += weight * v[i];
+            }
+        }
+    }
+}
+
+// Ardışık çiftleri döndür (llama GGUF düzeni)
+static void ai_rope(ai_model_t* model, uint32_t pos, float* q, float* k) {
+    uint32_t half = model->head_dim / 2;
+    for (uint32_t i = 0; i < half; i++) {
+        float angle = (float)pos * model->rope_freq[i];
+        model->rope_cos[i] = cosf(angle);
+        model->rope_sin[i] = sinf(angle);
+    }
+    
+    for (uint32_t i = 0; i < model->n_embd; i += 2) {
+        uint32_t pair = (i % model->head_dim) / 2;
+        float c = model->rope_cos[pair];
+        float s = model->rope_sin[pair];
+    
+        float q0 = q[i];
+        float q1 = q[i + 1];
+        q[i] = q0 * c - q1 * s;
+        q[i + 1] = q0 * s + q1 * c;
+    
+        if (i < model->kv_dim) {
+            float k0 = k[i];
+            float k1 = k[i + 1];
+            k[i] = k0 * c - k1 * s;
+            k[i + 1] = k0 * s + k1 * c;
+        }
+    }
+}
+
+// Bir tokenı pos konumunda işle; want_logits ise model->logits doldurulur
+static void ai_forward(ai_model_t* model, uint32_t token, uint32_t pos, int want_logits) {
+    uint32_t dim = model->n_embd;
+    ai_tensor_row_to_floats(&model->token_embd, token, model->x);
+    
+    for (uint32_t l = 0; l < model->n_layer; l++) {
+        ai_layer_t* layer = &model->layers[l];
+        size_t cache_offset = ((size_t)l * model->n_ctx + pos) * model->kv_dim;
+        float* k = model->key_cache + cache_offset;
+        float* v = model->value_cache + cache_offset;
+    
+        // Dikkat
+        ai_rmsnorm(model->xb, model->x, layer->attn_norm, dim, model->rms_eps);
+        const ai_tensor_t* qkv[3] = { &layer->wq, &layer->wk, &layer->wv };
+        float* qkv_out[3] = { model->q, k, v };
+        ai_matmul(model, model->xb, 3, qkv, qkv_out);
+        ai_rope(model, pos, model->q, k);
+    
+        ai_attention_job_t job = { l, pos };
+        ai_pool_run(model, ai_attention_task, &job, model->n_head, 1);
+    
+        const ai_tensor_t* wo[1] = { &layer->wo };
+        float* wo_out[1] = { model->xb2 };
+        ai_matmul(model, model->xb, 1, wo, wo_out);
+        for (uint32_t i = 0; i < dim; i++) {
+            model->x[i] += model->xb2[i];
+        }
+    
+        // İleri besleme (SwiGLU)
+        ai_rmsnorm(model->xb, model->x, layer->ffn_norm, dim, model->rms_eps);
+        const ai_tensor_t* gate_up[2] = { &layer->w_gate, &layer->w_up };
+        float* gate_up_out[2] = { model->hb, model->hb2 };
+        ai_matmul(model, model->xb, 2, gate_up, gate_up_out);
+        for (uint32_t i = 0; i < model->n_ff; i++) {
+            float gate = model->hb[i];
+            model->hb[i] = gate / (1.0f + expf(-gate)) * model->hb2[i];
+        }
+    
+        const ai_tensor_t* down[1] = { &layer->w_down };
+        float* down_out[1] = { model->xb };
+        ai_matmul(model, model->hb, 1, down, down_out);
+        for (uint32_t i = 0; i < dim; i++) {
+            model->x[i] += model->xb[i];
+        }
+    }
+    
+    // İstemin son tokenı dışında çıkış katmanı atlanır
+    if (want_logits) {
+        ai_rmsnorm(model->x, model->x, model->output_norm, dim, model->rms_eps);
+        const ai_tensor_t* output[1] = { &model->output };
+        float* logits[1] = { model->logits };
+        ai_matmul(model, model->x, 1, output, logits);
+    }
+}
+
+static uint64_t ai_random(ai_model_t* model) {
+    model->rng ^= model->rng >> 12;
+    model->rng ^= model->rng << 25;
+    model->rng ^= model->rng >> 27;
+    return model->rng * 0x2545F4914F6CDD1DULL;
+}
+
+static uint32_t ai_sample(ai_model_t* model, float temperature) {
+    float* logits = model->logits;
+    uint32_t best = 0;
+    for (uint32_t i = 1; i < model->n_vocab; i++) {
+        if (logits[i] > logits[best]) {
+            best = i;
+        }
+    }
+    
+    if (temperature <= 0.0f) {
+        return best;
+    }
+    
+    float max = logits[best];
+    float sum = 0.0f;
+    for (uint32_t i = 0; i < model->n_vocab; i++) {
+        logits[i] = expf((logits[i] - max) / temperature);
+        sum += logits[i];
+    }
+    
+    float target = (float)(ai_random(model) >> 40) / (float)(1 << 24) * sum;
+    float cumulative = 0.0f;
+    for (uint32_t i = 0; i < model->n_vocab; i++) {
+        cumulative += logits[i];
+        if (cumulative > target) {
+            return i;
+        }
+    }
+    return best;
+}
+
+// ---------------------------------------------------------------------------
+// Genel arayüz
+// ---------------------------------------------------------------------------
+
+static void* ai_carve(uint8_t** cursor, size_t bytes) {
+    void* block = *cursor;
+    *cursor += (bytes + AI_BUFFER_ALIGN - 1) & ~(size_t)(AI_BUFFER_ALIGN - 1);
+    return block;
+}
+
+static int ai_alloc_buffers(ai_model_t* model, uint32_t context, float rope_base) {
+    model->n_ctx = context;
+    
+    uint32_t max_dim = model->n_ff > model->n_embd ? model->n_ff : model->n_embd;
+    
+    // Bağlama bağlı tamponlar; 32 bit derlemede taşma denetlenir
+    size_t cache;
+    size_t att;
+    if (__builtin_mul_overflow((size_t)model->n_layer * model->kv_dim, (size_t)context, &cache) ||
+        __builtin_mul_overflow(cache, sizeof(float), &cache) ||
+        __builtin_mul_overflow((size_t)model->n_head, (size_t)context, &att) ||
+        __builtin_mul_overflow(att, sizeof(float), &att)) {
+        return AI_INFERENCE_ERROR_NO_MEMORY;
+    }
+    
+    size_t sizes[] = {
+        model->n_embd * sizeof(float),                      // x
+        model->n_embd * sizeof(float),                      // xb
+        model->n_embd * sizeof(float),                      // xb2
+        model->n_embd * sizeof(float),                      // q
+        model->n_ff * sizeof(float),                        // hb
+        model->n_ff * sizeof(float),                        // hb2
+        att,                                                // att
+        model->n_vocab * sizeof(float),                     // logits
+        model->head_dim / 2 * sizeof(float),                // rope_freq
+        model->head_dim / 2 * sizeof(float),                // rope_cos
+        model->head_dim / 2 * sizeof(float),                // rope_sin
+        cache,                                              // key_cache
+        cache,                                              // value_cache
+        max_dim / AI_BLOCK * sizeof(ai_block_qx_t),         // xq
+    };
+    
+    size_t total = 0;
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        if (sizes[i] > SIZE_MAX - AI_BUFFER_ALIGN ||
+            __builtin_add_overflow(total, (sizes[i] + AI_BUFFER_ALIGN - 1) & ~(size_t)(AI_BUFFER_ALIGN - 1), &total)) {
+            return AI_INFERENCE_ERROR_NO_MEMORY;
+        }
+    }
+    
+    if (posix_memalign(&model->buffers, AI_BUFFER_ALIGN, total) != 0) {
+        model->buffers = NULL;
+        return AI_INFERENCE_ERROR_NO_MEMORY;
+    }
+    model->buffer_bytes = total;
+    
+    uint8_t* cursor = (uint8_t*)model->buffers;
+    model->x = (float*)ai_carve(&cursor, sizes[0]);
+    model->xb = (float*)ai_carve(&cursor, sizes[1]);
+    model->xb2 = (float*)ai_carve(&cursor, sizes[2]);
+    model->q = (float*)ai_carve(&cursor, sizes[3]);
+    model->hb = (float*)ai_carve(&cursor, sizes[4]);
+    model->hb2 = (float*)ai_carve(&cursor, sizes[5]);
+    model->att = (float*)ai_carve(&cursor, sizes[6]);
+    model->logits = (float*)ai_carve(&cursor, sizes[7]);
+    model->rope_freq = (float*)ai_carve(&cursor, sizes[8]);
+    model->rope_cos = (float*)ai_carve(&cursor, sizes[9]);
+    model->rope_sin = (float*)ai_carve(&cursor, sizes[10]);
+    model->key_cache = (float*)ai_carve(&cursor, sizes[11]);
+    model->value_cache = (float*)ai_carve(&cursor, sizes[12]);
+    model->xq = (ai_block_qx_t*)ai_carve(&cursor, sizes[13]);
+    
+    for (uint32_t i = 0; i < model->head_dim / 2; i++) {
+        model->rope_freq[i] = powf(rope_base, -2.0f * (float)i / (float)model->head_dim);
+    }
+    return 0;
+}
+
+// GGUF modelini yükle
+int ai_inference_load(const char* path, const ai_inference_options_t* options, ai_inference_model_t** model_out) {
+    if (!path || !model_out) {
+        return AI_INFERENCE_ERROR_INVALID;
+    }
+    *model_out = NULL;
+    pthread_once(&ai_once, ai_init_kernels);
+    
+    double started = ai_now_ms();
+    ai_model_t* model = (ai_model_t*)calloc(1, sizeof(ai_model_t));
+    if (!model) {
+        return AI_INFERENCE_ERROR_NO_MEMORY;
+    }
+    pthread_mutex_init(&model->lock, NULL);
+    model->map = MAP_FAILED;
+    
+    // Ağırlıklar dosyadan doğrudan okunur, kopyalanmaz
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0 || st.st_size <= 0) {
+        if (fd >= 0) {
+            close(fd);
+        }
+        ai_inference_free(model);
+        return AI_INFERENCE_ERROR_IO;
+    }
+    
+    model->map_size = (size_t)st.st_size;
+    model->map = mmap(NULL, model->map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (model->map == MAP_FAILED) {
+        ai_inference_free(model);
+        return AI_INFERENCE_ERROR_IO;
+    }
+    madvise(model->map, model->map_size, MADV_WILLNEED);
+    
+    gguf_meta_t meta;
+    gguf_tensor_info_t* infos = NULL;
+    uint64_t tensor_count = 0;
+    const uint8_t* data = NULL;
+    size_t data_size = 0;
+    
+    int result = ai_parse_gguf(model, &meta, &infos, &tensor_count, &data, &data_size);
+    if (result == 0) {
+        result = ai_load_vocab(model, &meta);
+    }
+    if (result == 0) {
+        result = ai_bind_weights(model, &meta, infos, tensor_count, data, data_size);
+    }
+    free(infos);
+    
+    if (result == 0) {
+        // Bağlam: seçenek, model sınırı ve varsayılan üst sınır
+        uint32_t context = options && options->context ? options->context : AI_INFERENCE_DEFAULT_CONTEXT;
+        if (meta.context_length > 0 && (double)context > meta.context_length) {
+            context = (uint32_t)meta.context_length;
+        }
+        result = ai_alloc_buffers(model, context, (float)meta.rope_base);
+    }
+    
+    if (result == 0) {
+        uint32_t threads = options && options->threads ? options->threads : 0;
+        if (threads == 0) {
+            long online = sysconf(_SC_NPROCESSORS_ONLN);
+            threads = online > 0 ? (uint32_t)online : 1;
+        }
+        if (threads > AI_INFERENCE_MAX_THREADS) {
+            threads = AI_INFERENCE_MAX_THREADS;
+        }
+        result = ai_pool_start(model, threads);
+    }
+    
+    if (result != 0) {
+        ai_inference_free(model);
+        return result;
+    }
+    
+    model->rng = options && options->seed ? options->seed : (uint64_t)time(NULL) ^ (uint64_t)(uintptr_t)model;
+    if (model->rng == 0) {
+        model->rng = 0x9E3779B97F4A7C15ULL;
+    }
+    model->load_ms = ai_now_ms() - started;
+    *model_out = model;
+    return 0;
+}
+
+// Modeli serbest bırak
+void ai_inference_free(ai_inference_model_t* model) {
+    if (!model) {
+        return;
+    }
+    
+    if (model->buffers) {
+        ai_pool_stop(model);
+    }
+    if (model->map != MAP_FAILED && model->map) {
+        munmap(model->map, model->map_size);
+    }
+    
+    free(model->buffers);
+    free(model->layers);
+    free(model->norms);
+    free(model->vocab);
+    free(model->vocab_len);
+    free(model->scores);
+    free(model->token_types);
+    free(model->vocab_pool);
+    free(model->vocab_index);
+    pthread_mutex_destroy(&model->lock);
+    free(model);
+}
+
+// Model bilgisini al
+int ai_inference_get_info(ai_inference_model_t* model, ai_inference_info_t* info) {
+    if (!model || !info) {
+        return AI_INFERENCE_ERROR_INVALID;
+    }
+    
+    memset(info, 0, sizeof(ai_inference_info_t));
+    info->vocab_size = model->n_vocab;
+    info->embedding = model->n_embd;
+    info->layers = model->n_layer;
+    info->heads = model->n_head;
+    info->kv_heads = model->n_head_kv;
+    info->feed_forward = model->n_ff;
+    info->context = model->n_ctx;
+    info->threads = model->pool.workers + 1;
+    info->isa = ai_isa;
+    info->mapped_bytes = model->map_size;
+    info->buffer_bytes = model->buffer_bytes + (uint64_t)(model->vocab_mask + 1) * sizeof(uint32_t) +
+                         (uint64_t)model->n_vocab * (sizeof(char*) + sizeof(uint32_t) + sizeof(float) + 1) +
+                         ((uint64_t)model->n_layer * 2 + 1) * model->n_embd * sizeof(float);
+    info->load_ms = model->load_ms;
+    return 0;
+}
+
+// İstemin devamını üret
+int ai_inference_generate(ai_inference_model_t* model, const char* prompt, float temperature,
+                          uint32_t max_tokens, char** text_out, ai_inference_stats_t* stats) {
+    if (!model || !prompt || !text_out) {
+        return AI_INFERENCE_ERROR_INVALID;
+    }
+    *text_out = NULL;
+    
+    pthread_mutex_lock(&model->lock);
+    double started = ai_now_ms();
+    
+    // En kötü durumda her bayt bir token, artı BOS
+    size_t capacity = strlen(prompt) * 3 + 4;
+    uint32_t* tokens = (uint32_t*)malloc(capacity * sizeof(uint32_t));
+    if (!tokens) {
+        pthread_mutex_unlock(&model->lock);
+        return AI_INFERENCE_ERROR_NO_MEMORY;
+    }
+    
+    uint32_t n_prompt = 0;
+    int result = ai_encode(model, prompt, tokens, (uint32_t)capacity, &n_prompt);
+    if (result == 0 && n_prompt >= model->n_ctx) {
+        result = AI_INFERENCE_ERROR_CONTEXT;
+    }
+    
+    ai_text_t text = { NULL, 0, 0 };
+    uint32_t generated = 0;
+    double first_token = 0.0;
+    
+    if (result == 0) {
+        for (uint32_t pos = 0; pos < n_prompt; pos++) {
+            ai_forward(model, tokens[pos], pos, pos + 1 == n_prompt);
+        }
+    
+        uint32_t pos = n_prompt;
+        while (generated < max_tokens) {
+            uint32_t next = ai_sample(model, temperature);
+            if (generated == 0) {
+                first_token = ai_now_ms();
+            }
+            if (next == model->eos) {
+                break;
+            }
+    
+            result = ai_append_token(model, &text, next);
+            generated++;
+            if (result != 0 || generated == max_tokens || pos >= model->n_ctx) {
+                break;
+            }
+    
+            ai_forward(model, next, pos, 1);
+            pos++;
+        }
+    }
+    free(tokens);
+    
+    double finished = ai_now_ms();
+    pthread_mutex_unlock(&model->lock);
+    
+    if (result == 0 && !text.data) {
+        result = ai_text_append(&text, "", 0);
+    }
+    if (result != 0) {
+        free(text.data);
+        return result;
+    }
+    
+    // Python yolu gibi baştaki ve sondaki boşluklar atılır
+    size_t begin = 0;
+    while (begin < text.length && (text.data[begin] == ' ' || text.data[begin] == '\n')) {
+        begin++;
+    }
+    while (text.length > begin && (text.data[text.length - 1] == ' ' || text.data[text.length - 1] == '\n')) {
+        text.length--;
+    }
+    memmove(text.data, text.data + begin, text.length - begin);
+    text.data[text.length - begin] = '\0';
+    
+    if (stats) {
+        stats->prompt_tokens = n_prompt;
+        stats->generated_tokens = generated;
+        stats->first_token_ms = first_token > 0.0 ? first_token - started : 0.0;
+        stats->tokens_per_sec = generated > 1 && finished > first_token ?
+                                (double)(generated - 1) * 1000.0 / (finished - first_token) : 0.0;
+        stats->total_ms = finished - started;
+    }
+    
+    *text_out = text.data;
+    return 0;
+}
+
+// Dosya GGUF mu?
+int ai_inference_is_gguf(const char* path) {
+    if (!path || !path[0]) {
+        return 0;
+    }
+    
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return 0;
+    }
+    
+    uint32_t magic = 0;
+    ssize_t got = read(fd, &magic, sizeof(magic));
+    close(fd);
+    return got == (ssize_t)sizeof(magic) && magic == GGUF_MAGIC;
+}
+
+// Komut seti adı
+const char* ai_inference_isa_name(ai_inference_isa_t isa) {
+    switch (isa) {
+        case AI_INFERENCE_ISA_SSSE3: return "ssse3";
+        case AI_INFERENCE_ISA_AVX2:  return "avx2";
+        default:                     return "scalar";
+    }
+}
@@ -1,13 +1,17 @@
 #include "../include/python_ai.h"
 #include "../include/python_manager.h"
+#include "../include/ai_inference.h"
+#include "../include/hardware_manager_kernel.h"
 #include "../include/logger.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stddef.h>
 #include <time.h>
 
 // Yapay zeka motor durumu
 static int ai_initialized = 0;
+static int ai_python_ready = 0;     // Python yolu kullanılabilir mi?
 
 // Yüklü model listesi
 #define MAX_MODELS 8
@@ -15,13 +19,224 @@ static struct {
     int id;
     ai_model_type_t type;
     ai_model_config_t config;
-    void* model_handle;
+    void* model_handle;             // Yerel arka uçta ai_inference_model_t
+    uint8_t backend;                // Seçilen arka uç (ai_backend_t)
     uint8_t is_loaded;
 } loaded_models[MAX_MODELS];
 
 static int model_count = 0;
 static int next_model_id = 1;
 
+// Yardımcı Python modülü. python_ai_init'te bir kez derlenir; çağrılar
+// derlenmiş işlevlere argümanları doğrudan verir, her çağrıda kaynak
+// üretilip ayrıştırılmaz ve sonuç stdout üzerinden okunmaz.
+#define AI_HELPER_MODULE "kalem_ai"
+static const char ai_helper_source[] =
+    "import gc\n"
+    "import json\n"
+    "import sys\n"
+    "\n"
+    "try:\n"
+    "    import numpy as np\n"
+    "    import ctypes\n"
+    "    _ready = True\n"
+    "except ImportError as e:\n"
+    "    print(f'AI modüllerinin yüklenmesinde hata: {e}')\n"
+    "    _ready = False\n"
+    "\n"
+    "# model_id -> (tokenizer, model)\n"
+    "_models = {}\n"
+    "\n"
+    "def is_ready():\n"
+    "    return _ready\n"
+    "\n"
+    "def load_text_model(model_id, model_name, use_gpu, quantized):\n"
+    "    from transformers import AutoModelForCausalLM, AutoTokenizer\n"
+    "    import torch\n"
+    "    device = 'cuda' if torch.cuda.is_available() and use_gpu else 'cpu'\n"
+    "    tokenizer = AutoTokenizer.from_pretrained(model_name)\n"
+    "    if quantized:\n"
+    "        model = AutoModelForCausalLM.from_pretrained(model_name, device_map=device, load_in_8bit=True)\n"
+    "    else:\n"
+    "        model = AutoModelForCausalLM.from_pretrained(model_name, device_map=device)\n"
+    "    _models[model_id] = (tokenizer, model)\n"
+    "    return True\n"
+    "\n"
+    "def unload_model(model_id):\n"
+    "    if _models.pop(model_id, None) is None:\n"
+    "        return False\n"
+    "    gc.collect()\n"
+    "    torch = sys.modules.get('torch')\n"
+    "    if torch is not None and torch.cuda.is_available():\n"
+    "        torch.cuda.empty_cache()\n"
+    "    return True\n"
+    "\n"
+    "def generate_text(model_id, prompt, temperature, max_tokens):\n"
+    "    import torch\n"
+    "    tokenizer, model = _models[model_id]\n"
+    "    inputs = tokenizer(prompt, return_tensors='pt')\n"
+    "    if torch.cuda.is_available() and model.device.type == 'cuda':\n"
+    "        inputs = {k: v.cuda() for k, v in inputs.items()}\n"
+    "    with torch.no_grad():\n"
+    "        output = model.generate(\n"
+    "            **inputs,\n"
+    "            max_length=len(inputs['input_ids'][0]) + max_tokens,\n"
+    "            temperature=temperature,\n"
+    "            do_sample=temperature > 0.0,\n"
+    "            pad_token_id=tokenizer.eos_token_id\n"
+    "        )\n"
+    "    generated_text = tokenizer.decode(output[0], skip_special_tokens=True)\n"
+    "    return generated_text[len(prompt):].strip()\n"
+    "\n"
+    "def analyze_code(code):\n"
+    "    import ast\n"
+    "    import re\n"
+    "    analysis = {\n"
+    "        'syntax_valid': True,\n"
+    "        'line_count': code.count('\\n') + 1,\n"
+    "        'char_count': len(code),\n"
+    "        'comment_count': len(re.findall(r'#.*$', code, re.MULTILINE)),\n"
+    "        'functions': [],\n"
+    "        'classes': [],\n"
+    "        'imports': [],\n"
+    "        'variables': [],\n"
+    "        'complexity': {\n"
+    "            'cyclomatic': 0,\n"
+    "            'cognitive': 0\n"
+    "        },\n"
+    "        'issues': []\n"
+    "    }\n"
+    "\n"
+    "    # Sözdizimi kontrolü\n"
+    "    try:\n"
+    "        tree = ast.parse(code)\n"
+    "    except SyntaxError as e:\n"
+    "        analysis['syntax_valid'] = False\n"
+    "        analysis['issues'].append({\n"
+    "            'type': 'syntax_error',\n"
+    "            'message': str(e),\n"
+    "            'line': e.lineno if hasattr(e, 'lineno') else 0\n"
+    "        })\n"
+    "        return json.dumps(analysis, indent=2)\n"
+    "\n"
+    "    for node in ast.walk(tree):\n"
+    "        # Fonksiyonları bul\n"
+    "        if isinstance(node, ast.FunctionDef):\n"
+    "            analysis['functions'].append({\n"
+    "                'name': node.name,\n"
+    "                'line': node.lineno,\n"
+    "                'args': len(node.args.args),\n"
+    "                'returns': node.returns is not None\n"
+    "            })\n"
+    "            # Karmaşıklık ölçümü\n"
+    "            analysis['complexity']['cyclomatic'] += sum(1 for _ in ast.walk(node) if isinstance(_, (ast.If, ast.For, ast.While, ast.Try)))\n"
+    "\n"
+    "        # Sınıfları bul\n"
+    "        elif isinstance(node, ast.ClassDef):\n"
+    "            analysis['classes'].append({\n"
+    "                'name': node.name,\n"
+    "                'line': node.lineno,\n"
+    "                'methods': len([m for m in node.body if isinstance(m, ast.FunctionDef)]),\n"
+    "                'has_init': any(m.name == '__init__' for m in node.body if isinstance(m, ast.FunctionDef))\n"
+    "            })\n"
+    "\n"
+    "        # İçe aktarmaları bul\n"
+    "        elif isinstance(node, ast.Import):\n"
+    "            for name in node.names:\n"
+    "                analysis['imports'].append({\n"
+    "                    'name': name.name,\n"
+    "                    'alias': name.asname\n"
+    "                })\n"
+    "        elif isinstance(node, ast.ImportFrom):\n"
+    "            for name in node.names:\n"
+    "                analysis['imports'].append({\n"
+    "                    'name': f'{node.module}.{name.name}',\n"
+    "                    'alias': name.asname\n"
+    "                })\n"
+    "\n"
+    "    # Karmaşıklık puanı\n"
+    "    analysis['complexity']['cognitive'] = analysis['complexity']['cyclomatic'] + len(analysis['functions']) // 2\n"
+    "\n"
+    "    # Olası sorunları tespit et\n"
+    "    if analysis['line_count'] > 300:\n"
+    "        analysis['issues'].append({\n"
+    "            'type': 'code_size',\n"
+    "            'message': 'Dosya çok uzun, daha küçük modüllere bölünmesi önerilir',\n"
+    "            'severity': 'warning'\n"
+    "        })\n"
+    "\n"
+    "    if analysis['comment_count'] < analysis['line_count'] // 10:\n"
+    "        analysis['issues'].append({\n"
+    "            'type': 'documentation',\n"
+    "            'message': 'Yorum sayısı düşük, daha fazla belgeleme yapılması önerilir',\n"
+    "            'severity': 'info'\n"
+    "        })\n"
+    "\n"
+    "    if any(len(f.get('name', '')) < 3 for f in analysis['functions']):\n"
+    "        analysis['issues'].append({\n"
+    "            'type': 'naming',\n"
+    "            'message': 'Bazı fonksiyon isimleri çok kısa, daha açıklayıcı isimler kullanılması önerilir',\n"
+    "            'severity': 'info'\n"
+    "        })\n"
+    "\n"
+    "    return json.dumps(analysis, indent=2)\n"
+    "\n"
+    "# Donanım bileşen dizisi C belleğinden kopyalanmadan okunur; fmt kayıt\n"
+    "# düzenini (alan konumları ve dolgular) C tarafı offsetof ile üretir\n"
+    "def analyze_hardware(shared, fmt):\n"
+    "    import struct\n"
+    "    rows = list(struct.iter_unpack(fmt, shared))\n"
+    "    result = {'components': len(rows), 'max_temperature': 0, 'hottest_id': None,\n"
+    "              'mean_utilization': 0.0, 'total_power_mw': 0, 'error_components': []}\n"
+    "    for cid, ctype, status, temperature, utilization, power, errors in rows:\n"
+    "        if result['hottest_id'] is None or temperature > result['max_temperature']:\n"
+    "            result['max_temperature'] = temperature\n"
+    "            result['hottest_id'] = cid\n"
+    "        result['mean_utilization'] += utilization\n"
+    "        result['total_power_mw'] += power\n"
+    "        if errors:\n"
+    "            result['error_components'].append(cid)\n"
+    "    if rows:\n"
+    "        result['mean_utilization'] /= len(rows)\n"
+    "    return json.dumps(result)\n"
+    "\n"
+    "# Metin tamponu bayt olarak taranır; re tampon protokolünü doğrudan okur\n"
+    "def analyze_text(shared):\n"
+    "    import re\n"
+    "    view = memoryview(shared)\n"
+    "    size = len(view)\n"
+    "    lines = sum(1 for _ in re.finditer(rb'\\n', shared))\n"
+    "    if size and view[-1] != 10:\n"
+    "        lines += 1\n"
+    "    words = sum(1 for _ in re.finditer(rb'\\S+', shared))\n"
+    "    non_ascii = sum(1 for _ in re.finditer(rb'[\\x80-\\xff]', shared))\n"
+    "    return json.dumps({'bytes': size, 'lines': lines, 'words': words, 'non_ascii_bytes': non_ascii})\n";
+
+// Yardımcı modüldeki işlevler
+typedef enum {
+    AI_HELPER_IS_READY = 0,
+    AI_HELPER_LOAD_TEXT_MODEL,
+    AI_HELPER_UNLOAD_MODEL,
+    AI_HELPER_GENERATE_TEXT,
+    AI_HELPER_ANALYZE_CODE,
+    AI_HELPER_ANALYZE_HARDWARE,
+    AI_HELPER_ANALYZE_TEXT,
+    AI_HELPER_COUNT
+} ai_helper_t;
+
+static const char* const ai_helper_names[AI_HELPER_COUNT] = {
+    "is_ready",
+    "load_text_model",
+    "unload_model",
+    "generate_text",
+    "analyze_code",
+    "analyze_hardware",
+    "analyze_text"
+};
+
+static python_module_t* ai_helper_module = NULL;
+static python_function_t* ai_helpers[AI_HELPER_COUNT] = {NULL};
+
 // Python AI hata kodları
 typedef enum {
     AI_ERROR_NONE = 0,
@@ -54,6 +269,35 @@ static void ai_set_error(ai_error_t error, const char* format, ...) {
     ai_log(last_error_message);
 }
 
+// Yardımcı modül tanıtıcılarını bırak
+static void ai_release_helpers(void) {
+    for (int i = 0; i < AI_HELPER_COUNT; i++) {
+        python_function_free(ai_helpers[i]);
+        ai_helpers[i] = NULL;
+    }
+    
+    python_module_free(ai_helper_module);
+    ai_helper_module = NULL;
+}
+
+// Yardımcı modülü derle ve işlevlerini çöz
+static int ai_load_helpers(void) {
+    if (python_module_load(AI_HELPER_MODULE, ai_helper_source, &ai_helper_module) != 0) {
+        ai_set_error(AI_ERROR_INIT, "Yardımcı modül derlenemedi: %s", python_get_last_error());
+        return AI_ERROR_INIT;
+    }
+    
+    for (int i = 0; i < AI_HELPER_COUNT; i++) {
+        if (python_module_get_function(ai_helper_module, ai_helper_names[i], &ai_helpers[i]) != 0) {
+            ai_set_error(AI_ERROR_INIT, "Yardımcı işlev bulunamadı: %s", ai_helper_names[i]);
+            ai_release_helpers();
+            return AI_ERROR_INIT;
+        }
+    }
+    
+    return 0;
+}
+
 // Yapay zeka modülünü başlat
 int python_ai_init() {
     if (ai_initialized) {
@@ -62,43 +306,25 @@ int python_ai_init() {
     
     ai_log("Yapay zeka modülü başlatılıyor...");
     
-    // Python yöneticisinin başlatıldığından emin ol
+    // Python yolu kurulamazsa yerel motorla devam edilir
+    ai_python_ready = 0;
     if (python_manager_init() != 0) {
         ai_set_error(AI_ERROR_INIT, "Python yöneticisi başlatılamadı");
-        return AI_ERROR_INIT;
+    } else if (ai_load_helpers() == 0) {
+        // Gerekli Python modüllerinin yüklenip yüklenmediğini kontrol et
+        long ready = 0;
+        if (python_call_long(ai_helpers[AI_HELPER_IS_READY], &ready, NULL) == 0 && ready) {
+            ai_python_ready = 1;
+        } else {
+            ai_set_error(AI_ERROR_INIT, "AI modülleri başlatılamadı");
+            ai_release_helpers();
+        }
     }
     
-    // Gerekli Python modüllerini yükle
-    int result = python_run_string(
-        "try:\n"
-        "    import numpy as np\n"
-        "    import ctypes\n"
-        "    import json\n"
-        "    import sys\n"
-        "    print('AI için gerekli Python modülleri yüklendi')\n"
-        "    kalem_ai_ready = True\n"
-        "except ImportError as e:\n"
-        "    print(f'AI modüllerinin yüklenmesinde hata: {e}')\n"
-        "    kalem_ai_ready = False\n"
-    );
-    
-    if (result != 0) {
-        ai_set_error(AI_ERROR_INIT, "Gerekli Python modülleri yüklenemedi");
-        return AI_ERROR_INIT;
+    if (!ai_python_ready) {
+        ai_log("Python yolu kullanılamıyor, yalnızca yerel GGUF modelleri yüklenebilir");
     }
     
-    // Python değişkeninden hazır olup olmadığını kontrol et
-    char* output = NULL;
-    result = python_run_string_with_output("print(kalem_ai_ready)", &output);
-    
-    if (result != 0 || !output || strstr(output, "True") == NULL) {
-        ai_set_error(AI_ERROR_INIT, "AI modülleri başlatılamadı");
-        free(output);
-        return AI_ERROR_INIT;
-    }
-    
-    free(output);
-    
     // Model listesini temizle
     memset(loaded_models, 0, sizeof(loaded_models));
     model_count = 0;
@@ -118,86 +344,82 @@ int python_ai_cleanup() {
     ai_log("Yapay zeka modülü temizleniyor...");
     
     // Tüm modelleri boşalt
-    for (int i = 0; i < MAX_MODELS; i++) {
+    for (int i = 0; i < model_count; i++) {
         if (loaded_models[i].is_loaded) {
-            // Python modeli temizleme kodu
-            char cmd[256];
-            snprintf(cmd, sizeof(cmd), "if 'model_%d' in globals(): del model_%d", 
-                    loaded_models[i].id, loaded_models[i].id);
-            python_run_string(cmd);
+            if (loaded_models[i].backend == AI_BACKEND_NATIVE) {
+                ai_inference_free((ai_inference_model_t*)loaded_models[i].model_handle);
+            } else if (ai_python_ready) {
+                // Python tarafındaki modeli bırak
+                python_call_long(ai_helpers[AI_HELPER_UNLOAD_MODEL], NULL, "(i)", loaded_models[i].id);
+            }
             
             loaded_models[i].is_loaded = 0;
             loaded_models[i].model_handle = NULL;
         }
     }
+    memset(loaded_models, 0, sizeof(loaded_models));
+    model_count = 0;
+    
+    if (ai_python_ready) {
+        ai_release_helpers();
+        ai_python_ready = 0;
+    }
     
     ai_initialized = 0;
     ai_log("Yapay zeka modülü temizlendi");
     return 0;
 }
 
-// Model yükleme destek fonksiyonu
-static int load_text_model(int model_id, const ai_model_config_t* config) {
-    char cmd[1024];
-    
-    // Model yükleme kodu
-    snprintf(cmd, sizeof(cmd),
-        "try:\n"
-        "    from transformers import AutoModelForCausalLM, AutoTokenizer\n"
-        "    import torch\n"
-        "    \n"
-        "    model_name = '%s'\n"
-        "    use_gpu = %s\n"
-        "    quantized = %s\n"
-        "    \n"
-        "    device = 'cuda' if torch.cuda.is_available() and use_gpu else 'cpu'\n"
-        "    \n"
-        "    tokenizer_%d = AutoTokenizer.from_pretrained(model_name)\n"
-        "    \n"
-        "    if quantized:\n"
-        "        model_%d = AutoModelForCausalLM.from_pretrained(\n"
-        "            model_name,\n"
-        "            device_map=device,\n"
-        "            load_in_8bit=True\n"
-        "        )\n"
-        "    else:\n"
-        "        model_%d = AutoModelForCausalLM.from_pretrained(\n"
-        "            model_name,\n"
-        "            device_map=device\n"
-        "        )\n"
-        "    \n"
-        "    print(f'Model {model_name} yüklendi (ID: %d)')\n"
-        "    kalem_model_loaded_%d = True\n"
-        "except Exception as e:\n"
-        "    print(f'Model yükleme hatası: {e}')\n"
-        "    kalem_model_loaded_%d = False\n",
-        config->model_name,
-        config->use_gpu ? "True" : "False",
-        config->quantized ? "True" : "False",
-        model_id, model_id, model_id, model_id, model_id, model_id
-    );
-    
-    // Komutu çalıştır
-    int result = python_run_string(cmd);
+// Arka ucu belirle: AUTO, model_path GGUF ise yerel motoru seçer
+static uint8_t resolve_backend(const ai_model_config_t* config) {
+    if (config->backend == AI_BACKEND_PYTHON || config->backend == AI_BACKEND_NATIVE) {
+        return config->backend;
+    }
+    return ai_inference_is_gguf(config->model_path) ? AI_BACKEND_NATIVE : AI_BACKEND_PYTHON;
+}
+
+// Yerel motorla GGUF modelini yükle
+static int load_native_text_model(const ai_model_config_t* config, void** handle_out) {
+    ai_inference_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.threads = config->thread_count;
+    
+    ai_inference_model_t* model = NULL;
+    int result = ai_inference_load(config->model_path, &options, &model);
     if (result != 0) {
-        ai_set_error(AI_ERROR_MODEL_LOAD, "Model yükleme komutu çalıştırılamadı");
+        ai_set_error(AI_ERROR_MODEL_LOAD, "Yerel model yüklenemedi (%d): %s", result, config->model_path);
         return AI_ERROR_MODEL_LOAD;
     }
     
-    // Başarılı yüklenip yüklenmediğini kontrol et
-    char check_cmd[128];
-    snprintf(check_cmd, sizeof(check_cmd), "print(kalem_model_loaded_%d)", model_id);
+    ai_inference_info_t info;
+    ai_inference_get_info(model, &info);
     
-    char* output = NULL;
-    result = python_run_string_with_output(check_cmd, &output);
+    char log_msg[256];
+    snprintf(log_msg, sizeof(log_msg), "Yerel model: %u katman, %u boyut, %u iş parçacığı, %s, %.1f ms",
+            info.layers, info.embedding, info.threads, ai_inference_isa_name(info.isa), info.load_ms);
+    ai_log(log_msg);
     
-    if (result != 0 || !output || strstr(output, "True") == NULL) {
-        ai_set_error(AI_ERROR_MODEL_LOAD, "Model yüklenemedi");
-        free(output);
+    *handle_out = model;
+    return 0;
+}
+
+// Model yükleme destek fonksiyonu
+static int load_text_model(int model_id, const ai_model_config_t* config) {
+    if (!ai_python_ready) {
+        ai_set_error(AI_ERROR_NOT_SUPPORTED, "Python yolu kullanılamıyor");
+        return AI_ERROR_NOT_SUPPORTED;
+    }
+    
+    long loaded = 0;
+    int result = python_call_long(ai_helpers[AI_HELPER_LOAD_TEXT_MODEL], &loaded, "(isii)",
+                                  model_id, config->model_name,
+                                  config->use_gpu ? 1 : 0, config->quantized ? 1 : 0);
+    
+    if (result != 0 || !loaded) {
+        ai_set_error(AI_ERROR_MODEL_LOAD, "Model yüklenemedi: %s", python_get_last_error());
         return AI_ERROR_MODEL_LOAD;
     }
     
-    free(output);
     return 0;
 }
 
@@ -228,10 +450,16 @@ int python_ai_load_model(ai_model_type_t model_type, const ai_model_config_t* co
     
     // Model tipine göre yükleme işlemi
     int result = AI_ERROR_NOT_SUPPORTED;
+    uint8_t backend = resolve_backend(config);
+    void* handle = (void*)(intptr_t)model_id; // Python yolunda ID handle olarak kullanılır
     
     switch (model_type) {
         case AI_MODEL_TEXT:
-            result = load_text_model(model_id, config);
+            if (backend == AI_BACKEND_NATIVE) {
+                result = load_native_text_model(config, &handle);
+            } else {
+                result = load_text_model(model_id, config);
+            }
             break;
             
         case AI_MODEL_IMAGE:
@@ -255,7 +483,8 @@ int python_ai_load_model(ai_model_type_t model_type, const ai_model_config_t* co
     loaded_models[idx].id = model_id;
     loaded_models[idx].type = model_type;
     loaded_models[idx].is_loaded = 1;
-    loaded_models[idx].model_handle = (void*)(intptr_t)model_id; // ID'yi handle olarak kullan
+    loaded_models[idx].backend = backend;
+    loaded_models[idx].model_handle = handle;
     memcpy(&loaded_models[idx].config, config, sizeof(ai_model_config_t));
     
     snprintf(log_msg, sizeof(log_msg), "Model başarıyla yüklendi (ID: %d)", model_id);
@@ -285,27 +514,16 @@ int python_ai_unload_model(int model_id) {
         return AI_ERROR_NOT_FOUND;
     }
     
-    // Python'da modeli temizle
-    char cmd[256];
-    snprintf(cmd, sizeof(cmd), 
-        "try:\n"
-        "    if 'model_%d' in globals():\n"
-        "        del model_%d\n"
-        "        del tokenizer_%d\n"
-        "        import gc\n"
-        "        gc.collect()\n"
-        "        if 'torch' in sys.modules and hasattr(torch, 'cuda') and torch.cuda.is_available():\n"
-        "            torch.cuda.empty_cache()\n"
-        "        print('Model %d kaldırıldı')\n"
-        "except Exception as e:\n"
-        "    print(f'Model kaldırma hatası: {e}')\n",
-        model_id, model_id, model_id, model_id
-    );
-    
-    int result = python_run_string(cmd);
-    if (result != 0) {
-        ai_set_error(AI_ERROR_UNKNOWN, "Model kaldırılırken hata oluştu");
-        return AI_ERROR_UNKNOWN;
+    if (loaded_models[model_idx].backend == AI_BACKEND_NATIVE) {
+        ai_inference_free((ai_inference_model_t*)loaded_models[model_idx].model_handle);
+        loaded_models[model_idx].model_handle = NULL;
+    } else {
+        // Python'da modeli temizle
+        int result = python_call_long(ai_helpers[AI_HELPER_UNLOAD_MODEL], NULL, "(i)", model_id);
+        if (result != 0) {
+            ai_set_error(AI_ERROR_UNKNOWN, "Model kaldırılırken hata oluştu: %s", python_get_last_error());
+            return AI_ERROR_UNKNOWN;
+        }
     }
     
     // Modeli listeden çıkar (tüm modelleri kaydırarak)
@@ -316,6 +534,9 @@ int python_ai_unload_model(int model_id) {
     }
     model_count--;
     
+    // Kayan son kayıt aynı tanıtıcıyı taşır, iki kez bırakılmasın
+    memset(&loaded_models[model_count], 0, sizeof(loaded_models[0]));
+    
     char log_msg[256];
     snprintf(log_msg, sizeof(log_msg), "Model kaldırıldı (ID: %d)", model_id);
     ai_log(log_msg);
@@ -355,82 +576,36 @@ int python_ai_generate_text(int model_id, const char* prompt, char** result_out)
         return AI_ERROR_NOT_SUPPORTED;
     }
     
-    // Metin üretme kodu
-    char cmd[4096];
-    
-    // Prompt'u güvenli bir şekilde kaçış
-    char* escaped_prompt = (char*)malloc(strlen(prompt) * 2 + 1);
-    if (!escaped_prompt) {
-        ai_set_error(AI_ERROR_MEMORY, "Bellek ayırma hatası");
-        return AI_ERROR_MEMORY;
-    }
-    
-    const char* src = prompt;
-    char* dst = escaped_prompt;
-    while (*src) {
-        if (*src == '\'' || *src == '\"' || *src == '\\') {
-            *dst++ = '\\';
-        }
-        *dst++ = *src++;
-    }
-    *dst = '\0';
-    
     const ai_model_config_t* config = &loaded_models[model_idx].config;
     
-    snprintf(cmd, sizeof(cmd),
-        "try:\n"
-        "    prompt = \"\"\"%s\"\"\"\n"
-        "    temperature = %f\n"
-        "    max_tokens = %d\n"
-        "    \n"
-        "    inputs = tokenizer_%d(prompt, return_tensors='pt')\n"
-        "    if torch.cuda.is_available() and model_%d.device.type == 'cuda':\n"
-        "        inputs = {k: v.cuda() for k, v in inputs.items()}\n"
-        "    \n"
-        "    with torch.no_grad():\n"
-        "        output = model_%d.generate(\n"
-        "            **inputs,\n"
-        "            max_length=len(inputs['input_ids'][0]) + max_tokens,\n"
-        "            temperature=temperature,\n"
-        "            do_sample=temperature > 0.0,\n"
-        "            pad_token_id=tokenizer_%d.eos_token_id\n"
-        "        )\n"
-        "    \n"
-        "    generated_text = tokenizer_%d.decode(output[0], skip_special_tokens=True)\n"
-        "    response_text = generated_text[len(prompt):].strip()\n"
-        "    \n"
-        "    kalem_ai_result = response_text\n"
-        "    print(f'Metin üretildi (model: %d)')\n"
-        "except Exception as e:\n"
-        "    print(f'Metin üretme hatası: {e}')\n"
-        "    kalem_ai_result = None\n",
-        escaped_prompt,
-        config->temperature,
-        config->max_tokens,
-        model_id, model_id, model_id, model_id, model_id, model_id
-    );
-    
-    free(escaped_prompt);
-    
-    int result = python_run_string(cmd);
-    if (result != 0) {
-        ai_set_error(AI_ERROR_INFERENCE, "Metin üretme komutu çalıştırılamadı");
-        return AI_ERROR_INFERENCE;
+    if (loaded_models[model_idx].backend == AI_BACKEND_NATIVE) {
+        char* text = NULL;
+        ai_inference_stats_t stats;
+        int status = ai_inference_generate((ai_inference_model_t*)loaded_models[model_idx].model_handle,
+                                           prompt, config->temperature, config->max_tokens, &text, &stats);
+        if (status != 0) {
+            ai_set_error(AI_ERROR_INFERENCE, "Metin üretme başarısız (%d)", status);
+            return AI_ERROR_INFERENCE;
+        }
+        
+        *result_out = text;
+        
+        char log_msg[256];
+        snprintf(log_msg, sizeof(log_msg),
+                "Metin üretildi (model ID: %d, %u+%u token, ilk token %.1f ms, %.1f token/s)",
+                model_id, stats.prompt_tokens, stats.generated_tokens, stats.first_token_ms, stats.tokens_per_sec);
+        ai_log(log_msg);
+        return 0;
     }
     
-    // Sonucu al
+    // İstek metni Python'a dizgi argümanı olarak geçer, kaçış gerekmez
     char* output = NULL;
-    result = python_run_string_with_output(
-        "if kalem_ai_result is not None:\n"
-        "    print(kalem_ai_result)\n"
-        "else:\n"
-        "    print('ERROR: Metin üretme başarısız')",
-        &output
-    );
+    int result = python_call_text(ai_helpers[AI_HELPER_GENERATE_TEXT], &output, NULL, "(isdI)",
+                                  model_id, prompt, (double)config->temperature,
+                                  (unsigned int)config->max_tokens);
     
-    if (result != 0 || !output || strstr(output, "ERROR") != NULL) {
-        ai_set_error(AI_ERROR_INFERENCE, "Metin üretme başarısız");
-        free(output);
+    if (result != 0) {
+        ai_set_error(AI_ERROR_INFERENCE, "Metin üretme başarısız: %s", python_get_last_error());
         return AI_ERROR_INFERENCE;
     }
     
@@ -1005,178 +1180,143 @@ int python_ai_analyze_code(const char* code, char** result_out) {
         return AI_ERROR_PARAM;
     }
     
-    // JSON formatında analiz sonuçları oluştur
-    char* analysis = (char*)malloc(4096);
-    if (!analysis) {
-        ai_set_error(AI_ERROR_MEMORY, "Bellek ayırma hatası");
-        return AI_ERROR_MEMORY;
+    if (!ai_python_ready) {
+        ai_set_error(AI_ERROR_NOT_SUPPORTED, "Python yolu kullanılamıyor");
+        return AI_ERROR_NOT_SUPPORTED;
     }
     
-    // Kodu Python'a gönderip analiz et
-    char* escaped_code = (char*)malloc(strlen(code) * 2 + 1);
-    if (!escaped_code) {
-        ai_set_error(AI_ERROR_MEMORY, "Bellek ayırma hatası");
-        free(analysis);
-        return AI_ERROR_MEMORY;
-    }
+    // Kod Python'a olduğu gibi verilir, sonuç JSON dizgisi olarak döner
+    char* output = NULL;
+    int result = python_call_text(ai_helpers[AI_HELPER_ANALYZE_CODE], &output, NULL, "(s)", code);
     
-    // Kod içeriğini kaçış
-    const char* src = code;
-    char* dst = escaped_code;
-    while (*src) {
-        if (*src == '\\' || *src == '\'' || *src == '\"') {
-            *dst++ = '\\';
-        }
-        if (*src == '\n') {
-            *dst++ = '\\';
-            *dst++ = 'n';
-            src++;
-            continue;
-        }
-        *dst++ = *src++;
-    }
-    *dst = '\0';
-    
-    // Python kod analizi komutu
-    char cmd[8192];
-    snprintf(cmd, sizeof(cmd),
-            "try:\n"
-            "    import json\n"
-            "    import ast\n"
-            "    import re\n"
-            "    \n"
-            "    code = \"\"\"%s\"\"\"\n"
-            "    \n"
-            "    analysis = {\n"
-            "        'syntax_valid': True,\n"
-            "        'line_count': code.count('\\n') + 1,\n"
-            "        'char_count': len(code),\n"
-            "        'comment_count': len(re.findall(r'#.*$', code, re.MULTILINE)),\n"
-            "        'functions': [],\n"
-            "        'classes': [],\n"
-            "        'imports': [],\n"
-            "        'variables': [],\n"
-            "        'complexity': {\n"
-            "            'cyclomatic': 0,\n"
-            "            'cognitive': 0\n"
-            "        },\n"
-            "        'issues': []\n"
-            "    }\n"
-            "    \n"
-            "    # Sözdizimi kontrolü\n"
-            "    try:\n"
-            "        tree = ast.parse(code)\n"
-            "    except SyntaxError as e:\n"
-            "        analysis['syntax_valid'] = False\n"
-            "        analysis['issues'].append({\n"
-            "            'type': 'syntax_error',\n"
-            "            'message': str(e),\n"
-            "            'line': e.lineno if hasattr(e, 'lineno') else 0\n"
-            "        })\n"
-            "    \n"
-            "    if analysis['syntax_valid']:\n"
-            "        # Fonksiyonları bul\n"
-            "        for node in ast.walk(tree):\n"
-            "            if isinstance(node, ast.FunctionDef):\n"
-            "                analysis['functions'].append({\n"
-            "                    'name': node.name,\n"
-            "                    'line': node.lineno,\n"
-            "                    'args': len(node.args.args),\n"
-            "                    'returns': node.returns is not None\n"
-            "                })\n"
-            "                # Karmaşıklık ölçümü\n"
-            "                analysis['complexity']['cyclomatic'] += sum(1 for _ in ast.walk(node) if isinstance(_, (ast.If, ast.For, ast.While, ast.Try)))\n"
-            "            \n"
-            "            # Sınıfları bul\n"
-            "            elif isinstance(node, ast.ClassDef):\n"
-            "                analysis['classes'].append({\n"
-            "                    'name': node.name,\n"
-            "                    'line': node.lineno,\n"
-            "                    'methods': len([m for m in node.body if isinstance(m, ast.FunctionDef)]),\n"
-            "                    'has_init': any(m.name == '__init__' for m in node.body if isinstance(m, ast.FunctionDef))\n"
-            "                })\n"
-            "            \n"
-            "            # İçe aktarmaları bul\n"
-            "            elif isinstance(node, ast.Import):\n"
-            "                for name in node.names:\n"
-            "                    analysis['imports'].append({\n"
-            "                        'name': name.name,\n"
-            "                        'alias': name.asname\n"
-            "                    })\n"
-            "            elif isinstance(node, ast.ImportFrom):\n"
-            "                for name in node.names:\n"
-            "                    analysis['imports'].append({\n"
-            "                        'name': f'{node.module}.{name.name}',\n"
-            "                        'alias': name.asname\n"
-            "                    })\n"
-            "        \n"
-            "        # Karmaşıklık puanı\n"
-            "        analysis['complexity']['cognitive'] = analysis['complexity']['cyclomatic'] + len(analysis['functions']) // 2\n"
-            "        \n"
-            "        # Olası sorunları tespit et\n"
-            "        if analysis['line_count'] > 300:\n"
-            "            analysis['issues'].append({\n"
-            "                'type': 'code_size',\n"
-            "                'message': 'Dosya çok uzun, daha küçük modüllere bölünmesi önerilir',\n"
-            "                'severity': 'warning'\n"
-            "            })\n"
-            "        \n"
-            "        if analysis['comment_count'] < analysis['line_count'] // 10:\n"
-            "            analysis['issues'].append({\n"
-            "                'type': 'documentation',\n"
-            "                'message': 'Yorum sayısı düşük, daha fazla belgeleme yapılması önerilir',\n"
-            "                'severity': 'info'\n"
-            "            })\n"
-            "        \n"
-            "        if any(len(f.get('name', '')) < 3 for f in analysis['functions']):\n"
-            "            analysis['issues'].append({\n"
-            "                'type': 'naming',\n"
-            "                'message': 'Bazı fonksiyon isimleri çok kısa, daha açıklayıcı isimler kullanılması önerilir',\n"
-            "                'severity': 'info'\n"
-            "            })\n"
-            "    \n"
-            "    kalem_code_analysis = json.dumps(analysis, indent=2)\n"
-            "    print('Kod analizi tamamlandı')\n"
-            "except Exception as e:\n"
-            "    kalem_code_analysis = json.dumps({\n"
-            "        'error': True,\n"
-            "        'message': str(e)\n"
-            "    })\n"
-            "    print(f'Kod analizi hatası: {e}')\n",
-            escaped_code
-    );
+    if (result != 0) {
+        ai_set_error(AI_ERROR_INFERENCE, "Kod analizi başarısız: %s", python_get_last_error());
+        return AI_ERROR_INFERENCE;
+    }
     
-    free(escaped_code);
+    *result_out = output;
     
-    // Analiz komutunu çalıştır
-    int result = python_run_string(cmd);
-    if (result != 0) {
-        ai_set_error(AI_ERROR_INFERENCE, "Kod analizi komutu çalıştırılamadı");
-        free(analysis);
+    ai_log("Kod analizi tamamlandı");
+    return 0;
+}
+
+// Paylaşılan belleği Python'a verip JSON sonucunu al. Paylaşım çağrıdan sonra
+// geri alınır; Python tamponu tutuyorsa bellek serbest bırakılmamalıdır.
+static int ai_call_shared(ai_helper_t helper, void* data, size_t size, const char* fmt, char** result_out) {
+    python_object_t* shared = NULL;
+    if (python_buffer_share(data, size, PYTHON_BUFFER_UINT8, 0, &shared) != 0) {
+        ai_set_error(AI_ERROR_INFERENCE, "Bellek paylaşılamadı: %s", python_get_last_error());
         return AI_ERROR_INFERENCE;
     }
     
-    // Analiz sonucunu al
     char* output = NULL;
-    result = python_run_string_with_output(
-        "print(kalem_code_analysis)",
-        &output
-    );
+    int result = fmt ?
+        python_call_text(ai_helpers[helper], &output, NULL, "(Os)", shared, fmt) :
+        python_call_text(ai_helpers[helper], &output, NULL, "(O)", shared);
     
-    if (result != 0 || !output) {
-        ai_set_error(AI_ERROR_INFERENCE, "Kod analizi sonucu alınamadı");
-        free(analysis);
-        if (output) free(output);
+    if (python_buffer_unshare(shared) != 0) {
+        free(output);
+        ai_set_error(AI_ERROR_INFERENCE, "Python paylaşılan belleği bırakmadı: %s", python_get_last_error());
         return AI_ERROR_INFERENCE;
     }
     
-    // Output'u doğrudan result_out'a ata
-    *result_out = output;
+    if (result != 0) {
+        ai_set_error(AI_ERROR_INFERENCE, "%s başarısız: %s", ai_helper_names[helper], python_get_last_error());
+        return AI_ERROR_INFERENCE;
+    }
     
-    ai_log("Kod analizi tamamlandı");
+    *result_out = output;
     return 0;
 }
 
+// Donanım bileşen verisini topla ve kopyalamadan Python'da özetle
+int python_ai_analyze_hardware(uint32_t components, char** result_out) {
+    if (!ai_initialized) {
+        ai_set_error(AI_ERROR_INIT, "Yapay zeka modülü başlatılmadı");
+        return AI_ERROR_INIT;
+    }
+    
+    if (!result_out) {
+        ai_set_error(AI_ERROR_PARAM, "Geçersiz parametreler");
+        return AI_ERROR_PARAM;
+    }
+    
+    if (!ai_python_ready) {
+        ai_set_error(AI_ERROR_NOT_SUPPORTED, "Python yolu kullanılamıyor");
+        return AI_ERROR_NOT_SUPPORTED;
+    }
+    
+    hw_ai_data_t* data = (hw_ai_data_t*)calloc(1, sizeof(hw_ai_data_t));
+    if (!data) {
+        ai_set_error(AI_ERROR_MEMORY, "Bellek ayırma hatası");
+        return AI_ERROR_MEMORY;
+    }
+    
+    uint32_t capacity = sizeof(data->components) / sizeof(data->components[0]);
+    if (hw_manager_collect_ai_data(data, components < capacity ? components : capacity) != 0) {
+        free(data);
+        ai_set_error(AI_ERROR_INFERENCE, "Donanım verisi toplanamadı");
+        return AI_ERROR_INFERENCE;
+    }
+    
+    // Kayıt düzeni: okunan alanlar ve aralarındaki dolgular (struct modülü)
+    static const struct {
+        size_t offset;
+        size_t size;
+    } fields[] = {
+        { offsetof(hw_ai_component_data_t, component_id), sizeof(((hw_ai_component_data_t*)0)->component_id) },
+        { offsetof(hw_ai_component_data_t, type), sizeof(((hw_ai_component_data_t*)0)->type) },
+        { offsetof(hw_ai_component_data_t, status), sizeof(((hw_ai_component_data_t*)0)->status) },
+        { offsetof(hw_ai_component_data_t, temperature), sizeof(((hw_ai_component_data_t*)0)->temperature) },
+        { offsetof(hw_ai_component_data_t, utilization), sizeof(((hw_ai_component_data_t*)0)->utilization) },
+        { offsetof(hw_ai_component_data_t, power_usage), sizeof(((hw_ai_component_data_t*)0)->power_usage) },
+        { offsetof(hw_ai_component_data_t, error_count), sizeof(((hw_ai_component_data_t*)0)->error_count) }
+    };
+    char fmt[64];
+    size_t length = (size_t)snprintf(fmt, sizeof(fmt), "=");
+    size_t position = 0;
+    for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++) {
+        const char* code = fields[i].size == 1 ? "B" : fields[i].size == 2 ? "H" : fields[i].size == 4 ? "I" : "Q";
+        length += (size_t)snprintf(fmt + length, sizeof(fmt) - length, "%zux%s", fields[i].offset - position, code);
+        position = fields[i].offset + fields[i].size;
+    }
+    snprintf(fmt + length, sizeof(fmt) - length, "%zux", sizeof(hw_ai_component_data_t) - position);
+    
+    int result = ai_call_shared(AI_HELPER_ANALYZE_HARDWARE, data->components,
+                                (size_t)data->component_count * sizeof(hw_ai_component_data_t), fmt, result_out);
+    if (result == 0) {
+        free(data);
+        ai_log("Donanım verisi analiz edildi");
+    }
+    // Paylaşım geri alınamadıysa Python belleği hâlâ görebilir; serbest bırakılmaz
+    return result;
+}
+
+// Metin tamponunu kopyalamadan Python'da özetle
+int python_ai_analyze_text(const char* text, size_t length, char** result_out) {
+    if (!ai_initialized) {
+        ai_set_error(AI_ERROR_INIT, "Yapay zeka modülü başlatılmadı");
+        return AI_ERROR_INIT;
+    }
+    
+    if ((!text && length > 0) || !result_out) {
+        ai_set_error(AI_ERROR_PARAM, "Geçersiz parametreler");
+        return AI_ERROR_PARAM;
+    }
+    
+    if (!ai_python_ready) {
+        ai_set_error(AI_ERROR_NOT_SUPPORTED, "Python yolu kullanılamıyor");
+        return AI_ERROR_NOT_SUPPORTED;
+    }
+    
+    // Salt okunur paylaşılır; Python'un yazamayacağı bellek const kalır
+    int result = ai_call_shared(AI_HELPER_ANALYZE_TEXT, (void*)text, length, NULL, result_out);
+    if (result == 0) {
+        ai_log("Metin analizi tamamlandı");
+    }
+    return result;
+}
+
 // Yapay zeka ile doğal dil komutunu yorumla
 int python_ai_interpret_command(const char* nl_command, char** result_out) {
     if (!ai_initialized) {
@@ -1661,7 +1801,8 @@ int python_ai_get_model_info(int model_id, char** info_out) {
             "    \"quantized\": %s,\n"
             "    \"memory_limit_mb\": %d,\n"
             "    \"thread_count\": %d,\n"
-            "    \"optimization_level\": %d\n"
+            "    \"optimization_level\": %d,\n"
+            "    \"backend\": \"%s\"\n"
             "  },\n"
             "  \"status\": {\n"
             "    \"loaded\": %s,\n"
@@ -1681,6 +1822,7 @@ int python_ai_get_model_info(int model_id, char** info_out) {
             config->max_memory_mb,
             config->thread_count,
             config->optimization_level,
+            loaded_models[model_idx].backend == AI_BACKEND_NATIVE ? "native" : "python",
             loaded_models[model_idx].is_loaded ? "true" : "false",
             config->max_memory_mb / 2  // Tahmini bellek kullanımı
     );
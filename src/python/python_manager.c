@@ -4,6 +4,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdarg.h>
 #include <unistd.h>
 #include <sys/stat.h>
 #include <dirent.h>
@@ -35,6 +36,7 @@ typedef void PyObject;
 #define PySys_GetObject(name) ((PyObject*)0)
 #define PyImport_GetModuleDict() ((PyObject*)0)
 #else
+#define PY_SSIZE_T_CLEAN
 #include <Python.h>
 #endif
 
@@ -47,6 +49,17 @@ static uint8_t stdout_color = 0;
 static uint8_t stderr_color = 0;
 static uint8_t prompt_color = 0;
 
+// Önceden derlenmiş modül ve işlev tanıtıcıları
+struct python_module {
+    char name[64];
+    PyObject* module;
+};
+
+struct python_function {
+    char name[128];                 // "modül.işlev"
+    PyObject* callable;
+};
+
 // Kayıtlı Python betikleri listesi
 static python_script_t* script_list = NULL;
 
@@ -292,6 +305,582 @@ int python_run_string_with_output(const char* code, char** output_out) {
     return 0;
 }
 
+#if MOCK_PYTHON
+// Python C API olmadan derlemede önceden derlenmiş modüller desteklenmez
+int python_module_load(const char* name, const char* source, python_module_t** module_out) {
+    (void)name;
+    (void)source;
+    if (module_out) {
+        *module_out = NULL;
+    }
+    python_error("Önceden derlenmiş modüller Python C API gerektirir");
+    return PYTHON_ERROR_API;
+}
+
+void python_module_free(python_module_t* module) {
+    free(module);
+}
+
+int python_module_get_function(python_module_t* module, const char* name, python_function_t** function_out) {
+    (void)module;
+    (void)name;
+    if (function_out) {
+        *function_out = NULL;
+    }
+    return PYTHON_ERROR_API;
+}
+
+void python_function_free(python_function_t* function) {
+    free(function);
+}
+
+int python_call_text(python_function_t* function, char** result_out, size_t* size_out, const char* format, ...) {
+    (void)function;
+    (void)format;
+    if (result_out) {
+        *result_out = NULL;
+    }
+    if (size_out) {
+        *size_out = 0;
+    }
+    return PYTHON_ERROR_API;
+}
+
+int python_call_long(python_function_t* function, long* result_out, const char* format, ...) {
+    (void)function;
+    (void)format;
+    if (result_out) {
+        *result_out = 0;
+    }
+    return PYTHON_ERROR_API;
+}
+
+int python_buffer_share(void* data, size_t size, python_buffer_type_t type, uint8_t writable,
+                        python_object_t** shared_out) {
+    (void)data;
+    (void)size;
+    (void)type;
+    (void)writable;
+    if (shared_out) {
+        *shared_out = NULL;
+    }
+    return PYTHON_ERROR_API;
+}
+
+int python_buffer_unshare(python_object_t* shared) {
+    return shared ? PYTHON_ERROR_API : 0;
+}
+
+int python_call_buffer(python_function_t* function, python_buffer_t* buffer_out, const char* format, ...) {
+    (void)function;
+    (void)format;
+    if (buffer_out) {
+        memset(buffer_out, 0, sizeof(python_buffer_t));
+    }
+    return PYTHON_ERROR_API;
+}
+
+void python_buffer_release(python_buffer_t* buffer) {
+    if (buffer) {
+        memset(buffer, 0, sizeof(python_buffer_t));
+    }
+}
+#else
+// Bekleyen Python istisnasını son hata olarak kaydet
+static void python_capture_exception(const char* context) {
+    PyObject* type = NULL;
+    PyObject* value = NULL;
+    PyObject* traceback = NULL;
+    PyErr_Fetch(&type, &value, &traceback);
+    
+    PyObject* text = value ? PyObject_Str(value) : NULL;
+    const char* message = text ? PyUnicode_AsUTF8(text) : NULL;
+    if (!message) {
+        PyErr_Clear();
+        message = type ? ((PyTypeObject*)type)->tp_name : "bilinmeyen istisna";
+    }
+    python_error("%s: %s", context, message);
+    
+    Py_XDECREF(text);
+    Py_XDECREF(type);
+    Py_XDECREF(value);
+    Py_XDECREF(traceback);
+}
+
+// Argümanları kurup işlevi çağır (GIL tutulurken)
+static PyObject* python_call_object(python_function_t* function, const char* format, va_list args) {
+    PyObject* arguments = NULL;
+    if (format && format[0]) {
+        arguments = Py_VaBuildValue(format, args);
+        if (!arguments) {
+            return NULL;
+        }
+    
+        // Tek argüman parantezsiz verildiyse demete sar
+        if (!PyTuple_Check(arguments)) {
+            PyObject* tuple = PyTuple_Pack(1, arguments);
+            Py_DECREF(arguments);
+            if (!tuple) {
+                return NULL;
+            }
+            arguments = tuple;
+        }
+    }
+    
+    PyObject* result = PyObject_CallObject(function->callable, arguments);
+    Py_XDECREF(arguments);
+    return result;
+}
+
+// Python kaynağını derleyip yeni bir modülde çalıştır
+int python_module_load(const char* name, const char* source, python_module_t** module_out) {
+    if (!name || !source || !module_out) {
+        python_error("Geçersiz modül parametreleri");
+        return PYTHON_ERROR_API;
+    }
+    *module_out = NULL;
+    
+    // Python başlatılmamışsa başlat
+    if (!is_initialized) {
+        if (python_manager_init() != 0) {
+            python_error("Python yorumlayıcısı başlatılamadı");
+            return PYTHON_ERROR_INIT;
+        }
+    }
+    
+    python_module_t* module = (python_module_t*)calloc(1, sizeof(python_module_t));
+    if (!module) {
+        python_error("Bellek ayırma hatası");
+        return PYTHON_ERROR_MEMORY;
+    }
+    strncpy(module->name, name, sizeof(module->name) - 1);
+    
+    PyGILState_STATE gil = PyGILState_Ensure();
+    int result = 0;
+    
+    // Kaynak yalnızca burada derlenir; çağrılar derlenmiş işlevleri kullanır
+    PyObject* code = Py_CompileString(source, module->name, Py_file_input);
+    if (!code) {
+        python_capture_exception(module->name);
+        result = PYTHON_ERROR_SCRIPT;
+    } else {
+        module->module = PyModule_New(module->name);
+        PyObject* globals = module->module ? PyModule_GetDict(module->module) : NULL;
+    
+        if (!globals || PyDict_SetItemString(globals, "__builtins__", PyEval_GetBuiltins()) != 0) {
+            python_capture_exception(module->name);
+            result = PYTHON_ERROR_MODULE;
+        } else {
+            PyObject* value = PyEval_EvalCode(code, globals, globals);
+            if (!value) {
+                python_capture_exception(module->name);
+                result = PYTHON_ERROR_MODULE;
+            }
+            Py_XDECREF(value);
+        }
+        Py_DECREF(code);
+    }
+    
+    if (result != 0) {
+        Py_XDECREF(module->module);
+        free(module);
+        module = NULL;
+    }
+    PyGILState_Release(gil);
+    
+    *module_out = module;
+    return result;
+}
+
+// Modülü serbest bırak
+void python_module_free(python_module_t* module) {
+    if (!module) {
+        return;
+    }
+    
+    if (Py_IsInitialized()) {
+        PyGILState_STATE gil = PyGILState_Ensure();
+        Py_XDECREF(module->module);
+        PyGILState_Release(gil);
+    }
+    free(module);
+}
+
+// Modüldeki işlevi al
+int python_module_get_function(python_module_t* module, const char* name, python_function_t** function_out) {
+    if (!module || !name || !function_out) {
+        python_error("Geçersiz işlev parametreleri");
+        return PYTHON_ERROR_API;
+    }
+    *function_out = NULL;
+    
+    python_function_t* function = (python_function_t*)calloc(1, sizeof(python_function_t));
+    if (!function) {
+        python_error("Bellek ayırma hatası");
+        return PYTHON_ERROR_MEMORY;
+    }
+    snprintf(function->name, sizeof(function->name), "%s.%s", module->name, name);
+    
+    PyGILState_STATE gil = PyGILState_Ensure();
+    int result = 0;
+    
+    function->callable = PyObject_GetAttrString(module->module, name);
+    if (!function->callable) {
+        python_capture_exception(function->name);
+        result = PYTHON_ERROR_MODULE;
+    } else if (!PyCallable_Check(function->callable)) {
+        python_error("%s çağrılabilir değil", function->name);
+        Py_CLEAR(function->callable);
+        result = PYTHON_ERROR_MODULE;
+    }
+    PyGILState_Release(gil);
+    
+    if (result != 0) {
+        free(function);
+        return result;
+    }
+    
+    *function_out = function;
+    return 0;
+}
+
+// İşlev tanıtıcısını serbest bırak
+void python_function_free(python_function_t* function) {
+    if (!function) {
+        return;
+    }
+    
+    if (Py_IsInitialized()) {
+        PyGILState_STATE gil = PyGILState_Ensure();
+        Py_XDECREF(function->callable);
+        PyGILState_Release(gil);
+    }
+    free(function);
+}
+
+// İşlevi çağır, str ya da bytes sonucunu kopyala
+int python_call_text(python_function_t* function, char** result_out, size_t* size_out, const char* format, ...) {
+    if (!function || !result_out) {
+        python_error("Geçersiz çağrı parametreleri");
+        return PYTHON_ERROR_API;
+    }
+    *result_out = NULL;
+    if (size_out) {
+        *size_out = 0;
+    }
+    
+    PyGILState_STATE gil = PyGILState_Ensure();
+    
+    va_list args;
+    va_start(args, format);
+    PyObject* value = python_call_object(function, format, args);
+    va_end(args);
+    
+    int result = 0;
+    const char* data = NULL;
+    Py_ssize_t size = 0;
+    
+    if (!value) {
+        python_capture_exception(function->name);
+        result = PYTHON_ERROR_SCRIPT;
+    } else if (PyUnicode_Check(value)) {
+        data = PyUnicode_AsUTF8AndSize(value, &size);
+        if (!data) {
+            python_capture_exception(function->name);
+            result = PYTHON_ERROR_SCRIPT;
+        }
+    } else if (PyBytes_Check(value)) {
+        data = PyBytes_AS_STRING(value);
+        size = PyBytes_GET_SIZE(value);
+    } else {
+        python_error("%s: sonuç str ya da bytes değil (%s)", function->name, Py_TYPE(value)->tp_name);
+        result = PYTHON_ERROR_API;
+    }
+    
+    // Sonucun tek kopyası çağırana verilir
+    if (result == 0) {
+        char* copy = (char*)malloc((size_t)size + 1);
+        if (!copy) {
+            python_error("Bellek ayırma hatası");
+            result = PYTHON_ERROR_MEMORY;
+        } else {
+            memcpy(copy, data, (size_t)size);
+            copy[size] = '\0';
+            *result_out = copy;
+            if (size_out) {
+                *size_out = (size_t)size;
+            }
+        }
+    }
+    
+    Py_XDECREF(value);
+    PyGILState_Release(gil);
+    return result;
+}
+
+// İşlevi çağır, tamsayı sonucunu döndür
+int python_call_long(python_function_t* function, long* result_out, const char* format, ...) {
+    if (!function) {
+        python_error("Geçersiz çağrı parametreleri");
+        return PYTHON_ERROR_API;
+    }
+    if (result_out) {
+        *result_out = 0;
+    }
+    
+    PyGILState_STATE gil = PyGILState_Ensure();
+    
+    va_list args;
+    va_start(args, format);
+    PyObject* value = python_call_object(function, format, args);
+    va_end(args);
+    
+    int result = 0;
+    if (!value) {
+        python_capture_exception(function->name);
+        result = PYTHON_ERROR_SCRIPT;
+    } else if (result_out) {
+        long number = PyLong_AsLong(value);
+        if (number == -1 && PyErr_Occurred()) {
+            python_capture_exception(function->name);
+            result = PYTHON_ERROR_API;
+        } else {
+            *result_out = number;
+        }
+    }
+    
+    Py_XDECREF(value);
+    PyGILState_Release(gil);
+    return result;
+}
+
+// Paylaşılan C belleğini dışa aktaran nesne (kalem.SharedMemory). Python
+// tarafındaki her tampon (memoryview(x), numpy.frombuffer(x), bunlardan
+// türeyen dilim ve cast'ler) getbuffer/releasebuffer üzerinden exports'a
+// yansır; sayım yalnızca bu nesnede tutulur, CPython iç yapıları okunmaz.
+typedef struct {
+    PyObject_HEAD
+    void* data;
+    Py_ssize_t size;
+    Py_ssize_t count;               // Öğe sayısı (shape)
+    Py_ssize_t item_size;
+    const char* format;
+    int readonly;
+    int revoked;                    // Paylaşım geri alındı, yeni dışa aktarım yok
+    Py_ssize_t exports;
+} python_shared_memory_t;
+
+static int python_shared_getbuffer(PyObject* self, Py_buffer* view, int flags) {
+    python_shared_memory_t* shared = (python_shared_memory_t*)self;
+    if (shared->revoked) {
+        PyErr_SetString(PyExc_BufferError, "Paylaşılan C belleği geri alındı");
+        view->obj = NULL;
+        return -1;
+    }
+    
+    if (PyBuffer_FillInfo(view, self, shared->data, shared->size, shared->readonly, flags) != 0) {
+        return -1;
+    }
+    
+    // FillInfo bayt görünümü kurar; öğe tipini ve sayısını düzelt
+    view->itemsize = shared->item_size;
+    if (flags & PyBUF_FORMAT) {
+        view->format = (char*)shared->format;
+    }
+    if (flags & PyBUF_ND) {
+        view->shape = &shared->count;
+    }
+    
+    shared->exports++;
+    return 0;
+}
+
+static void python_shared_releasebuffer(PyObject* self, Py_buffer* view) {
+    (void)view;
+    ((python_shared_memory_t*)self)->exports--;
+}
+
+static void python_shared_dealloc(PyObject* self) {
+    Py_TYPE(self)->tp_free(self);
+}
+
+static PyBufferProcs python_shared_buffer_procs = {
+    python_shared_getbuffer,
+    python_shared_releasebuffer
+};
+
+static PyTypeObject python_shared_type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "kalem.SharedMemory",
+    .tp_basicsize = sizeof(python_shared_memory_t),
+    .tp_dealloc = python_shared_dealloc,
+    .tp_as_buffer = &python_shared_buffer_procs,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = "KALEM OS C belleği (kopyasız paylaşım)",
+};
+
+// Öğe tiplerinin struct biçimleri ve boyutları
+static const char* const python_buffer_formats[PYTHON_BUFFER_TYPE_COUNT] = {
+    "B", "i", "I", "q", "Q", "f", "d"
+};
+
+static const size_t python_buffer_item_sizes[PYTHON_BUFFER_TYPE_COUNT] = {
+    sizeof(uint8_t), sizeof(int32_t), sizeof(uint32_t), sizeof(int64_t),
+    sizeof(uint64_t), sizeof(float), sizeof(double)
+};
+
+// C belleğini kalem.SharedMemory nesnesiyle paylaş
+int python_buffer_share(void* data, size_t size, python_buffer_type_t type, uint8_t writable,
+                        python_object_t** shared_out) {
+    if (!shared_out || type >= PYTHON_BUFFER_TYPE_COUNT || (!data && size > 0) ||
+        size % python_buffer_item_sizes[type] != 0 || size > (size_t)PY_SSIZE_T_MAX) {
+        python_error("Geçersiz paylaşım parametreleri");
+        return PYTHON_ERROR_API;
+    }
+    *shared_out = NULL;
+    
+    // Python başlatılmamışsa başlat
+    if (!is_initialized) {
+        if (python_manager_init() != 0) {
+            python_error("Python yorumlayıcısı başlatılamadı");
+            return PYTHON_ERROR_INIT;
+        }
+    }
+    
+    PyGILState_STATE gil = PyGILState_Ensure();
+    
+    if (PyType_Ready(&python_shared_type) != 0) {
+        python_capture_exception("kalem.SharedMemory");
+        PyGILState_Release(gil);
+        return PYTHON_ERROR_API;
+    }
+    
+    python_shared_memory_t* shared = PyObject_New(python_shared_memory_t, &python_shared_type);
+    if (!shared) {
+        PyErr_Clear();
+        python_error("Bellek ayırma hatası");
+        PyGILState_Release(gil);
+        return PYTHON_ERROR_MEMORY;
+    }
+    
+    // Boş paylaşımda da geçerli bir adres gerekir
+    static uint8_t empty;
+    shared->data = data ? data : &empty;
+    shared->size = (Py_ssize_t)size;
+    shared->item_size = (Py_ssize_t)python_buffer_item_sizes[type];
+    shared->count = shared->size / shared->item_size;
+    shared->format = python_buffer_formats[type];
+    shared->readonly = writable ? 0 : 1;
+    shared->revoked = 0;
+    shared->exports = 0;
+    PyGILState_Release(gil);
+    
+    // C tarafı tek referansı tutar; python_buffer_unshare bırakır
+    *shared_out = (python_object_t*)shared;
+    return 0;
+}
+
+// Paylaşımı geri al
+int python_buffer_unshare(python_object_t* shared_object) {
+    if (!shared_object) {
+        return 0;
+    }
+    
+    PyGILState_STATE gil = PyGILState_Ensure();
+    
+    if (!PyObject_TypeCheck((PyObject*)shared_object, &python_shared_type)) {
+        PyGILState_Release(gil);
+        python_error("python_buffer_share ile oluşturulmamış nesne");
+        return PYTHON_ERROR_API;
+    }
+    
+    // İlk denemeden sonra yeni tampon verilmez; yaşayanlar bırakılınca
+    // çağrı yinelenebilir
+    python_shared_memory_t* shared = (python_shared_memory_t*)shared_object;
+    shared->revoked = 1;
+    
+    Py_ssize_t in_use = shared->exports;
+    if (in_use > 0) {
+        PyGILState_Release(gil);
+        python_error("Paylaşılan bellek Python'da hâlâ kullanımda (%zd tampon)", in_use);
+        return PYTHON_ERROR_API;
+    }
+    
+    // Python'da nesneye referans kalsa bile artık belleğe ulaşamaz
+    shared->data = NULL;
+    shared->size = 0;
+    shared->count = 0;
+    Py_DECREF((PyObject*)shared);
+    
+    PyGILState_Release(gil);
+    return 0;
+}
+
+// İşlevi çağır, sonucun belleğini kopyalamadan al
+int python_call_buffer(python_function_t* function, python_buffer_t* buffer_out, const char* format, ...) {
+    if (!function || !buffer_out) {
+        python_error("Geçersiz çağrı parametreleri");
+        return PYTHON_ERROR_API;
+    }
+    memset(buffer_out, 0, sizeof(python_buffer_t));
+    
+    Py_buffer* view = (Py_buffer*)calloc(1, sizeof(Py_buffer));
+    if (!view) {
+        python_error("Bellek ayırma hatası");
+        return PYTHON_ERROR_MEMORY;
+    }
+    
+    PyGILState_STATE gil = PyGILState_Ensure();
+    
+    va_list args;
+    va_start(args, format);
+    PyObject* value = python_call_object(function, format, args);
+    va_end(args);
+    
+    int result = 0;
+    if (!value) {
+        python_capture_exception(function->name);
+        result = PYTHON_ERROR_SCRIPT;
+    } else if (PyObject_GetBuffer(value, view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0) {
+        python_capture_exception(function->name);
+        result = PYTHON_ERROR_API;
+    }
+    
+    // Tampon, nesneye kendi referansını tutar
+    Py_XDECREF(value);
+    PyGILState_Release(gil);
+    
+    if (result != 0) {
+        free(view);
+        return result;
+    }
+    
+    buffer_out->data = view->buf;
+    buffer_out->size = (size_t)view->len;
+    buffer_out->item_size = (size_t)view->itemsize;
+    buffer_out->format = view->format ? view->format : "B";
+    buffer_out->readonly = view->readonly ? 1 : 0;
+    buffer_out->internal = view;
+    return 0;
+}
+
+// Alınan tamponu bırak
+void python_buffer_release(python_buffer_t* buffer) {
+    if (!buffer || !buffer->internal) {
+        return;
+    }
+    
+    Py_buffer* view = (Py_buffer*)buffer->internal;
+    if (Py_IsInitialized()) {
+        PyGILState_STATE gil = PyGILState_Ensure();
+        PyBuffer_Release(view);
+        PyGILState_Release(gil);
+    }
+    free(view);
+    memset(buffer, 0, sizeof(python_buffer_t));
+}
+#endif
+
 // Son Python hatasını döndür
 const char* python_get_last_error() {
     if (strlen(last_error) == 0) {
@@ -26,6 +26,10 @@ static gui_window_t* android_settings_window = NULL;
 #define BUTTON_OPEN_APP_MANAGER       15
 #define BUTTON_VERSION_SELECT         16
 
+// Kullanım geçmişi: örnekleyicinin 10 sn'lik katmanından son 20 örnek
+#define HISTORY_TIER                  1
+#define HISTORY_SAMPLES               20
+
 // Form bileşenleri
 typedef struct {
     gui_button_t* enable_android;
@@ -49,6 +53,8 @@ typedef struct {
     gui_label_t* status_label;
     gui_progress_bar_t* memory_bar;
     gui_progress_bar_t* cpu_bar;
+    gui_label_t* memory_history;
+    gui_label_t* cpu_history;
     
     // Seçili ayarlar (geçici depolama)
     uint8_t android_enabled;
@@ -65,6 +71,7 @@ static android_settings_form_t form = {0};
 // İleri bildirimler
 static void update_settings_display();
 static void update_system_stats();
+static void format_history(char* text, const uint32_t* values, uint32_t count, uint32_t limit);
 static void handle_button_click(gui_button_t* button);
 static void apply_settings();
 
@@ -119,11 +126,13 @@ gui_window_t* android_settings_create() {
     
     // Bellek kullanım çubuğu
     gui_label_create(android_settings_window, 20, 90, 100, 20, "Bellek Kullanımı:");
-    form.memory_bar = gui_progress_bar_create(android_settings_window, 130, 90, 450, 20, 0, 100, 0);
+    form.memory_bar = gui_progress_bar_create(android_settings_window, 130, 90, 250, 20, 0, 100, 0);
+    form.memory_history = gui_label_create(android_settings_window, 390, 90, 190, 20, "");
     
     // CPU kullanım çubuğu
     gui_label_create(android_settings_window, 20, 120, 100, 20, "CPU Kullanımı:");
-    form.cpu_bar = gui_progress_bar_create(android_settings_window, 130, 120, 450, 20, 0, 100, 0);
+    form.cpu_bar = gui_progress_bar_create(android_settings_window, 130, 120, 250, 20, 0, 100, 0);
+    form.cpu_history = gui_label_create(android_settings_window, 390, 120, 190, 20, "");
     
     // Yatay ayırıcı
     gui_separator_create(android_settings_window, 20, 150, 560, 2, GUI_SEPARATOR_HORIZONTAL);
@@ -286,6 +295,24 @@ static void update_system_stats() {
         gui_progress_bar_set_value(form.cpu_bar, (int)info.cpu_usage_percent);
         gui_progress_bar_set_text(form.cpu_bar, "%.1f%% / %.1f%%", 
                                 info.cpu_usage_percent, info.cpu_limit_percent);
+        
+        // Geçmiş: örnekleyicinin halkalarından okunur, ölçüm yapılmaz
+        usage_sample_t samples[HISTORY_SAMPLES];
+        uint32_t memory_values[HISTORY_SAMPLES];
+        uint32_t cpu_values[HISTORY_SAMPLES];
+        uint32_t count = 0;
+        char history_text[HISTORY_SAMPLES + 1];
+        if (android_get_usage_history(HISTORY_TIER, samples, HISTORY_SAMPLES, &count) != ANDROID_SUCCESS) {
+            count = 0;
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            memory_values[i] = samples[i].rss_kb / 1024;
+            cpu_values[i] = samples[i].cpu_permille / 10;
+        }
+        format_history(history_text, memory_values, count, info.memory_limit_mb);
+        gui_label_set_text(form.memory_history, history_text);
+        format_history(history_text, cpu_values, count, (uint32_t)info.cpu_limit_percent);
+        gui_label_set_text(form.cpu_history, history_text);
     } else {
         // Android başlatılmamış
         gui_label_set_text(form.status_label, "Durum: Android etkin değil");
@@ -293,7 +320,21 @@ static void update_system_stats() {
         gui_progress_bar_set_text(form.memory_bar, "0 MB / 0 MB (0%)");
         gui_progress_bar_set_value(form.cpu_bar, 0);
         gui_progress_bar_set_text(form.cpu_bar, "0% / 0%");
+        gui_label_set_text(form.memory_history, "");
+        gui_label_set_text(form.cpu_history, "");
+    }
+}
+
+// Değerleri sınıra göre sekiz seviyeli bir karakter çizgisine çevir
+// (eskiden yeniye, soldan sağa)
+static void format_history(char* text, const uint32_t* values, uint32_t count, uint32_t limit) {
+    static const char levels[] = " _.-=+*#";
+    
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t level = limit ? values[i] * 7 / limit : 0;
+        text[i] = levels[level > 7 ? 7 : level];
     }
+    text[count] = '\0';
 }
 
 // Buton tıklama olayını işle
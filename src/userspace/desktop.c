@@ -13,6 +13,15 @@ desktop_t* desktop = NULL;
 #define ICON_START_Y DESKTOP_MARGIN_Y
 #define ICON_MAX_PER_ROW ((VGA_WIDTH - (2 * DESKTOP_MARGIN_X)) / DESKTOP_ICON_SPACING_X)
 
+// Simge indeksi yardımcı fonksiyonları
+static uint32_t desktop_hash_string(const char* str);
+static void desktop_index_insert(uint16_t index);
+static void desktop_index_rebuild();
+static void desktop_move_icon(uint16_t index, uint16_t x, uint16_t y);
+static void desktop_flush_layout();
+static uint16_t desktop_query_rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                                   uint16_t* out, uint16_t max);
+
 // Masaüstü başlatma
 void desktop_init() {
     // Masaüstü için bellek ayır
@@ -41,6 +50,10 @@ void desktop_init() {
     // Seçim alanını sıfırla
     desktop->selection.active = 0;
     
+    // Arama indekslerini ve bekleyen düzeni sıfırla
+    desktop_index_rebuild();
+    desktop->layout_dirty_from = DESKTOP_ICON_INDEX_NONE;
+    
     // Masaüstü menüsünü başlat
     desktop_context_menu_init();
     
@@ -59,6 +72,9 @@ void desktop_init() {
 void desktop_draw() {
     if (!desktop) return;
     
+    // Bekleyen simge yerleşimlerini uygula
+    desktop_flush_layout();
+    
     // Arkaplanı çiz
     desktop_update_background();
     
@@ -351,28 +367,9 @@ uint8_t desktop_handle_keyboard(uint8_t key, uint8_t state) {
 void desktop_auto_arrange_icons() {
     if (!desktop) return;
     
-    uint16_t x = ICON_START_X;
-    uint16_t y = ICON_START_Y;
-    uint16_t count_in_row = 0;
-    
-    for (uint16_t i = 0; i < desktop->icon_count; i++) {
-        desktop_icon_t* icon = &desktop->icons[i];
-        
-        // Simgenin konumunu ayarla
-        icon->x = x;
-        icon->y = y;
-        
-        // Sonraki simge konumu
-        x += DESKTOP_ICON_SPACING_X;
-        count_in_row++;
-        
-        // Satır sonu kontrolü
-        if (count_in_row >= ICON_MAX_PER_ROW) {
-            x = ICON_START_X;
-            y += DESKTOP_ICON_SPACING_Y;
-            count_in_row = 0;
-        }
-    }
+    // Tüm simgeleri yeniden yerleştir
+    desktop->layout_dirty_from = 0;
+    desktop_flush_layout();
     
     // Masaüstünü yeniden çiz
     desktop_draw();
@@ -423,6 +420,18 @@ void desktop_begin_selection(uint16_t x, uint16_t y) {
 void desktop_update_selection(uint16_t x, uint16_t y) {
     if (!desktop || !desktop->selection.active) return;
     
+    desktop_flush_layout();
+    
+    // Önceki seçim alanı (artık kapsanmayan simgelerin seçimi kaldırılmalı)
+    uint16_t old_x1 = (desktop->selection.start_x < desktop->selection.end_x) ? 
+                      desktop->selection.start_x : desktop->selection.end_x;
+    uint16_t old_y1 = (desktop->selection.start_y < desktop->selection.end_y) ? 
+                      desktop->selection.start_y : desktop->selection.end_y;
+    uint16_t old_x2 = (desktop->selection.start_x > desktop->selection.end_x) ? 
+                      desktop->selection.start_x : desktop->selection.end_x;
+    uint16_t old_y2 = (desktop->selection.start_y > desktop->selection.end_y) ? 
+                      desktop->selection.start_y : desktop->selection.end_y;
+    
     desktop->selection.end_x = x;
     desktop->selection.end_y = y;
     
@@ -436,9 +445,18 @@ void desktop_update_selection(uint16_t x, uint16_t y) {
     uint16_t sel_y2 = (desktop->selection.start_y > desktop->selection.end_y) ? 
                       desktop->selection.start_y : desktop->selection.end_y;
     
-    // Her simge için seçim kontrolü
-    for (uint16_t i = 0; i < desktop->icon_count; i++) {
-        desktop_icon_t* icon = &desktop->icons[i];
+    // Yalnızca eski ve yeni seçim alanlarını kapsayan bölgedeki simgeleri incele.
+    // Seçim başlarken diğer simgelerin seçimi zaten kaldırılmış olur.
+    uint16_t candidates[DESKTOP_MAX_ICONS];
+    uint16_t candidate_count = desktop_query_rect(
+        (old_x1 < sel_x1) ? old_x1 : sel_x1,
+        (old_y1 < sel_y1) ? old_y1 : sel_y1,
+        (old_x2 > sel_x2) ? old_x2 : sel_x2,
+        (old_y2 > sel_y2) ? old_y2 : sel_y2,
+        candidates, DESKTOP_MAX_ICONS);
+    
+    for (uint16_t c = 0; c < candidate_count; c++) {
+        desktop_icon_t* icon = &desktop->icons[candidates[c]];
         
         // Simge seçim alanıyla kesişiyor mu?
         uint8_t intersects = !(icon->x + icon->width < sel_x1 || 
@@ -525,6 +543,14 @@ desktop_icon_t* desktop_add_icon(const char* name, const char* path, desktop_ico
     // Öğe sayısını artır
     desktop->icon_count++;
     
+    // Arama indekslerine ekle
+    desktop_index_insert(index);
+    
+    // Otomatik düzende yalnızca yeni simge yerleştirilir
+    if (desktop->layout == DESKTOP_LAYOUT_AUTO && index < desktop->layout_dirty_from) {
+        desktop->layout_dirty_from = index;
+    }
+    
     return icon;
 }
 
@@ -532,13 +558,10 @@ desktop_icon_t* desktop_add_icon(const char* name, const char* path, desktop_ico
 void desktop_remove_icon(desktop_icon_t* icon) {
     if (!desktop || !icon) return;
     
-    // Simge indeksini bul
-    for (uint16_t i = 0; i < desktop->icon_count; i++) {
-        if (&desktop->icons[i] == icon) {
-            desktop_remove_icon_by_index(i);
-            return;
-        }
-    }
+    // Simge dizide değilse yoksay
+    if (icon < desktop->icons || icon >= desktop->icons + desktop->icon_count) return;
+    
+    desktop_remove_icon_by_index((uint16_t)(icon - desktop->icons));
 }
 
 // Simgeyi indeksle kaldır
@@ -554,54 +577,88 @@ void desktop_remove_icon_by_index(uint16_t index) {
     // Öğe sayısını azalt
     desktop->icon_count--;
     
+    // Kaydırılan simgelerin indeksleri değişti, arama indekslerini yenile
+    desktop_index_rebuild();
+    
+    // Otomatik düzende yalnızca silinen simgeden sonrakiler kayar
+    if (desktop->layout == DESKTOP_LAYOUT_AUTO && index < desktop->layout_dirty_from) {
+        desktop->layout_dirty_from = index;
+    }
+    
     // Masaüstünü yeniden çiz
     desktop_draw();
 }
 
+// Simge konumunu ayarla
+void desktop_set_icon_position(desktop_icon_t* icon, uint16_t x, uint16_t y) {
+    if (!desktop || !icon) return;
+    if (icon < desktop->icons || icon >= desktop->icons + desktop->icon_count) return;
+    
+    desktop_move_icon((uint16_t)(icon - desktop->icons), x, y);
+}
+
 // X,Y koordinatındaki simgeyi bul
 desktop_icon_t* desktop_find_icon_at(uint16_t x, uint16_t y) {
     if (!desktop) return NULL;
     
-    // Sondan başa doğru kontrol (üstteki simgeleri önce bulmak için)
-    for (int16_t i = desktop->icon_count - 1; i >= 0; i--) {
-        desktop_icon_t* icon = &desktop->icons[i];
+    desktop_flush_layout();
+    
+    // Yalnızca noktayı kapsayabilecek hücrelerdeki simgeleri incele
+    uint16_t candidates[DESKTOP_MAX_ICONS];
+    uint16_t candidate_count = desktop_query_rect(x, y, x, y, candidates, DESKTOP_MAX_ICONS);
+    
+    // En yüksek indeksli simge üstte çizilir, önce o bulunmalı
+    desktop_icon_t* found = NULL;
+    for (uint16_t c = 0; c < candidate_count; c++) {
+        desktop_icon_t* icon = &desktop->icons[candidates[c]];
         
         if (!icon->visible) continue;
+        if (found && icon < found) continue;
         
         // Fare simge sınırları içinde mi?
         if (x >= icon->x && x < icon->x + icon->width &&
             y >= icon->y && y < icon->y + icon->height + DESKTOP_ICON_LABEL_HEIGHT) {
-            return icon;
+            found = icon;
         }
     }
     
-    return NULL;
+    return found;
 }
 
 // İsimle simge bul
 desktop_icon_t* desktop_find_icon_by_name(const char* name) {
     if (!desktop || !name) return NULL;
     
-    for (uint16_t i = 0; i < desktop->icon_count; i++) {
-        if (strcmp(desktop->icons[i].name, name) == 0) {
-            return &desktop->icons[i];
+    // Aynı adlı simgelerden en düşük indeksli olanı döndür
+    uint16_t found = DESKTOP_ICON_INDEX_NONE;
+    uint32_t bucket = desktop_hash_string(name) & (DESKTOP_ICON_HASH_SIZE - 1);
+    
+    for (uint16_t i = desktop->name_hash_head[bucket]; i != DESKTOP_ICON_INDEX_NONE;
+         i = desktop->name_hash_next[i]) {
+        if (i < found && strcmp(desktop->icons[i].name, name) == 0) {
+            found = i;
         }
     }
     
-    return NULL;
+    return (found != DESKTOP_ICON_INDEX_NONE) ? &desktop->icons[found] : NULL;
 }
 
 // Yolla simge bul
 desktop_icon_t* desktop_find_icon_by_path(const char* path) {
     if (!desktop || !path) return NULL;
     
-    for (uint16_t i = 0; i < desktop->icon_count; i++) {
-        if (strcmp(desktop->icons[i].path, path) == 0) {
-            return &desktop->icons[i];
+    // Aynı yollu simgelerden en düşük indeksli olanı döndür
+    uint16_t found = DESKTOP_ICON_INDEX_NONE;
+    uint32_t bucket = desktop_hash_string(path) & (DESKTOP_ICON_HASH_SIZE - 1);
+    
+    for (uint16_t i = desktop->path_hash_head[bucket]; i != DESKTOP_ICON_INDEX_NONE;
+         i = desktop->path_hash_next[i]) {
+        if (i < found && strcmp(desktop->icons[i].path, path) == 0) {
+            found = i;
         }
     }
     
-    return NULL;
+    return (found != DESKTOP_ICON_INDEX_NONE) ? &desktop->icons[found] : NULL;
 }
 
 // Sürüklemeyi başlat
@@ -638,16 +695,18 @@ void desktop_end_drag(uint16_t x, uint16_t y) {
     // Tüm seçili simgeleri taşı
     for (uint16_t i = 0; i < desktop->icon_count; i++) {
         if (desktop->icons[i].selected) {
-            desktop->icons[i].x += dx;
-            desktop->icons[i].y += dy;
+            int32_t new_x = desktop->icons[i].x + dx;
+            int32_t new_y = desktop->icons[i].y + dy;
             
             // Ekran sınırları kontrolü
-            if (desktop->icons[i].x < 0) desktop->icons[i].x = 0;
-            if (desktop->icons[i].y < 0) desktop->icons[i].y = 0;
-            if (desktop->icons[i].x > VGA_WIDTH - desktop->icons[i].width) 
-                desktop->icons[i].x = VGA_WIDTH - desktop->icons[i].width;
-            if (desktop->icons[i].y > VGA_HEIGHT - desktop->icons[i].height - DESKTOP_ICON_LABEL_HEIGHT) 
-                desktop->icons[i].y = VGA_HEIGHT - desktop->icons[i].height - DESKTOP_ICON_LABEL_HEIGHT;
+            if (new_x < 0) new_x = 0;
+            if (new_y < 0) new_y = 0;
+            if (new_x > VGA_WIDTH - desktop->icons[i].width) 
+                new_x = VGA_WIDTH - desktop->icons[i].width;
+            if (new_y > VGA_HEIGHT - desktop->icons[i].height - DESKTOP_ICON_LABEL_HEIGHT) 
+                new_y = VGA_HEIGHT - desktop->icons[i].height - DESKTOP_ICON_LABEL_HEIGHT;
+            
+            desktop_move_icon(i, (uint16_t)new_x, (uint16_t)new_y);
         }
     }
     
@@ -732,14 +791,16 @@ void desktop_paste() {
         
         // Konum ayarla
         if (new_icon) {
-            new_icon->x = paste_x + (i * 20);
-            new_icon->y = paste_y + (i * 20);
+            uint16_t new_x = paste_x + (i * 20);
+            uint16_t new_y = paste_y + (i * 20);
             
             // Ekran sınırları kontrolü
-            if (new_icon->x > VGA_WIDTH - new_icon->width) 
-                new_icon->x = VGA_WIDTH - new_icon->width;
-            if (new_icon->y > VGA_HEIGHT - new_icon->height - DESKTOP_ICON_LABEL_HEIGHT) 
-                new_icon->y = VGA_HEIGHT - new_icon->height - DESKTOP_ICON_LABEL_HEIGHT;
+            if (new_x > VGA_WIDTH - new_icon->width) 
+                new_x = VGA_WIDTH - new_icon->width;
+            if (new_y > VGA_HEIGHT - new_icon->height - DESKTOP_ICON_LABEL_HEIGHT) 
+                new_y = VGA_HEIGHT - new_icon->height - DESKTOP_ICON_LABEL_HEIGHT;
+            
+            desktop_set_icon_position(new_icon, new_x, new_y);
             
             // Önceki seçimleri temizle ve yeni simgeyi seç
             desktop_deselect_all_icons();
@@ -784,6 +845,149 @@ void desktop_arrange_icons() {
     desktop_auto_arrange_icons();
 }
 
+// Dize karması (FNV-1a)
+static uint32_t desktop_hash_string(const char* str) {
+    uint32_t hash = 2166136261u;
+    
+    while (*str) {
+        hash ^= (uint8_t)*str++;
+        hash *= 16777619u;
+    }
+    
+    return hash;
+}
+
+// Konumun düştüğü uzamsal ızgara hücresi (ızgara ekran dışına sarmalanır)
+static uint16_t desktop_cell_of(uint16_t x, uint16_t y) {
+    uint16_t cx = (x / DESKTOP_GRID_CELL_WIDTH) & (DESKTOP_GRID_COLS - 1);
+    uint16_t cy = (y / DESKTOP_GRID_CELL_HEIGHT) & (DESKTOP_GRID_ROWS - 1);
+    
+    return cy * DESKTOP_GRID_COLS + cx;
+}
+
+// Simgeyi hücre zincirine bağla
+static void desktop_cell_link(uint16_t index) {
+    uint16_t cell = desktop_cell_of(desktop->icons[index].x, desktop->icons[index].y);
+    
+    desktop->icon_cell[index] = cell;
+    desktop->cell_next[index] = desktop->cell_head[cell];
+    desktop->cell_head[cell] = index;
+}
+
+// Simgeyi hücre zincirinden çıkar
+static void desktop_cell_unlink(uint16_t index) {
+    uint16_t* link = &desktop->cell_head[desktop->icon_cell[index]];
+    
+    while (*link != DESKTOP_ICON_INDEX_NONE) {
+        if (*link == index) {
+            *link = desktop->cell_next[index];
+            return;
+        }
+        link = &desktop->cell_next[*link];
+    }
+}
+
+// Simgeyi ad, yol ve hücre indekslerine ekle
+static void desktop_index_insert(uint16_t index) {
+    desktop_icon_t* icon = &desktop->icons[index];
+    uint32_t name_bucket = desktop_hash_string(icon->name) & (DESKTOP_ICON_HASH_SIZE - 1);
+    uint32_t path_bucket = desktop_hash_string(icon->path) & (DESKTOP_ICON_HASH_SIZE - 1);
+    
+    desktop->name_hash_next[index] = desktop->name_hash_head[name_bucket];
+    desktop->name_hash_head[name_bucket] = index;
+    
+    desktop->path_hash_next[index] = desktop->path_hash_head[path_bucket];
+    desktop->path_hash_head[path_bucket] = index;
+    
+    desktop_cell_link(index);
+}
+
+// Tüm arama indekslerini baştan oluştur
+static void desktop_index_rebuild() {
+    for (uint16_t i = 0; i < DESKTOP_ICON_HASH_SIZE; i++) {
+        desktop->name_hash_head[i] = DESKTOP_ICON_INDEX_NONE;
+        desktop->path_hash_head[i] = DESKTOP_ICON_INDEX_NONE;
+    }
+    
+    for (uint16_t i = 0; i < DESKTOP_GRID_COLS * DESKTOP_GRID_ROWS; i++) {
+        desktop->cell_head[i] = DESKTOP_ICON_INDEX_NONE;
+    }
+    
+    for (uint16_t i = 0; i < desktop->icon_count; i++) {
+        desktop_index_insert(i);
+    }
+}
+
+// Simgeyi taşı ve hücre değiştiyse uzamsal indeksi güncelle
+static void desktop_move_icon(uint16_t index, uint16_t x, uint16_t y) {
+    desktop_icon_t* icon = &desktop->icons[index];
+    
+    if (icon->x == x && icon->y == y) return;
+    
+    icon->x = x;
+    icon->y = y;
+    
+    if (desktop_cell_of(x, y) != desktop->icon_cell[index]) {
+        desktop_cell_unlink(index);
+        desktop_cell_link(index);
+    }
+}
+
+// Bekleyen otomatik düzeni uygula (yalnızca değişen noktadan sonraki simgeler)
+static void desktop_flush_layout() {
+    if (desktop->layout_dirty_from == DESKTOP_ICON_INDEX_NONE) return;
+    
+    for (uint16_t i = desktop->layout_dirty_from; i < desktop->icon_count; i++) {
+        uint16_t x = ICON_START_X + (i % ICON_MAX_PER_ROW) * DESKTOP_ICON_SPACING_X;
+        uint16_t y = ICON_START_Y + (i / ICON_MAX_PER_ROW) * DESKTOP_ICON_SPACING_Y;
+        
+        desktop_move_icon(i, x, y);
+    }
+    
+    desktop->layout_dirty_from = DESKTOP_ICON_INDEX_NONE;
+}
+
+// Dikdörtgenle kesişen simgelerin indekslerini topla.
+// Simgeler bir hücreden büyük olmadığından sol ve üst komşu hücreler de taranır.
+static uint16_t desktop_query_rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                                   uint16_t* out, uint16_t max) {
+    int32_t cx1 = (int32_t)(x1 / DESKTOP_GRID_CELL_WIDTH) - 1;
+    int32_t cy1 = (int32_t)(y1 / DESKTOP_GRID_CELL_HEIGHT) - 1;
+    int32_t cx2 = x2 / DESKTOP_GRID_CELL_WIDTH;
+    int32_t cy2 = y2 / DESKTOP_GRID_CELL_HEIGHT;
+    uint16_t count = 0;
+    
+    if (cx1 < 0) cx1 = 0;
+    if (cy1 < 0) cy1 = 0;
+    
+    // Izgara sarmalandığı için her hücre en fazla bir kez taranmalı
+    if (cx2 - cx1 >= DESKTOP_GRID_COLS) cx2 = cx1 + DESKTOP_GRID_COLS - 1;
+    if (cy2 - cy1 >= DESKTOP_GRID_ROWS) cy2 = cy1 + DESKTOP_GRID_ROWS - 1;
+    
+    for (int32_t cy = cy1; cy <= cy2; cy++) {
+        for (int32_t cx = cx1; cx <= cx2; cx++) {
+            uint16_t cell = (cy & (DESKTOP_GRID_ROWS - 1)) * DESKTOP_GRID_COLS +
+                            (cx & (DESKTOP_GRID_COLS - 1));
+            
+            for (uint16_t i = desktop->cell_head[cell]; i != DESKTOP_ICON_INDEX_NONE;
+                 i = desktop->cell_next[i]) {
+                desktop_icon_t* icon = &desktop->icons[i];
+                
+                if (icon->x + icon->width < x1 || icon->x > x2 ||
+                    icon->y + icon->height + DESKTOP_ICON_LABEL_HEIGHT < y1 || icon->y > y2) {
+                    continue;
+                }
+                
+                if (count < max) {
+                    out[count++] = i;
+                }
+            }
+        }
+    }
+    
+    return count;
+}
+
 // Belleği temizle
 void desktop_cleanup() {
     if (!desktop) return;
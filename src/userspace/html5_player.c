@@ -12,6 +12,7 @@
 #define MIN_BUFFER_THRESHOLD 0.2 // %20 doluluk gerekli
 #define FRAME_PROCESS_INTERVAL 16 // ~60 FPS
 #define MAX_4K_BITRATE 60000000 // 60 Mbps
+#define AUDIO_OUTPUT_RATE 48000 // Çözülen sesin örnekleme hızı
 
 // Kayıtlı codecler
 static video_codec_info_t registered_codecs[MAX_CODECS];
@@ -200,6 +201,17 @@ int html5_player_play(html5_player_t* player) {
         }
     }
     
+    // Ses içeren akış için karıştırıcıda akış aç
+    if (player->stream_info.has_audio && !player->audio_stream) {
+        uint32_t channels = (player->stream_info.audio_channels == 1) ? 1 : 2;
+        player->audio_stream = audio_stream_open("html5_player", AUDIO_OUTPUT_RATE, channels);
+        if (player->audio_stream) {
+            audio_stream_set_volume(player->audio_stream, player->volume);
+            audio_stream_set_muted(player->audio_stream, player->muted);
+        }
+    }
+    audio_stream_set_paused(player->audio_stream, 0);
+    
     player->state = PLAYER_STATE_PLAYING;
     return 0;
 }
@@ -210,6 +222,7 @@ int html5_player_pause(html5_player_t* player) {
     
     if (player->state == PLAYER_STATE_PLAYING) {
         player->state = PLAYER_STATE_PAUSED;
+        audio_stream_set_paused(player->audio_stream, 1);
     }
     
     return 0;
@@ -226,6 +239,12 @@ int html5_player_stop(html5_player_t* player) {
     player->buffer_stats.used_size = 0;
     player->buffer_stats.buffered_duration = 0;
     
+    // Ses akışını kapat
+    if (player->audio_stream) {
+        audio_stream_close(player->audio_stream);
+        player->audio_stream = NULL;
+    }
+    
     return 0;
 }
 
@@ -258,6 +277,7 @@ int html5_player_set_volume(html5_player_t* player, uint8_t volume) {
     if (!player) return -1;
     
     player->volume = volume > 100 ? 100 : volume;
+    audio_stream_set_volume(player->audio_stream, player->volume);
     
     return 0;
 }
@@ -267,6 +287,7 @@ int html5_player_mute(html5_player_t* player, uint8_t mute) {
     if (!player) return -1;
     
     player->muted = mute ? 1 : 0;
+    audio_stream_set_muted(player->audio_stream, player->muted);
     
     return 0;
 }
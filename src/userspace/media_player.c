@@ -35,6 +35,8 @@ static void media_player_draw_video(uint32_t x, uint32_t y, uint32_t width, uint
 static void media_player_draw_audio_visualizer(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
 static media_format_t media_player_detect_format(const char* filename);
 static codec_t media_player_detect_codec(media_format_t format, uint8_t is_video);
+static int media_player_open_audio();
+static void media_player_close_audio();
 
 // Medya oynatıcı başlatma
 void media_player_init() {
@@ -56,6 +58,8 @@ void media_player_init() {
     player->repeat = 0;           // Tekrar kapalı
     player->shuffle = 0;          // Karıştır kapalı
     player->codec_data = NULL;
+    player->audio_stream = NULL;
+    player->audio_file = NULL;
     player->fullscreen = 0;       // Tam ekran değil
     
     // Demo medya dosyaları ve codec'leri oluştur
@@ -843,6 +847,10 @@ int media_player_open_file(const char* filename) {
 int media_player_play() {
     if (!player || !player->current_file) return -1;
     
+    // Çözülen PCM verisi karıştırıcıdaki akışa yazılır; ses aygıtı
+    // açılamazsa oynatma sessiz sürer (video ve konum ilerlemeye devam eder)
+    media_player_open_audio();
+    
     player->state = PLAYER_STATE_PLAYING;
     
     // Gerçek bir oynatıcıda burada codec başlatılır ve oynatma başlar
@@ -861,6 +869,9 @@ int media_player_pause() {
         player->state = PLAYER_STATE_PLAYING;
     }
     
+    // Duraklatılan akış karıştırılmaz ve boşalma sayılmaz
+    audio_stream_set_paused(player->audio_stream, player->state == PLAYER_STATE_PAUSED);
+    
     return 0;
 }
 
@@ -871,6 +882,8 @@ int media_player_stop() {
     player->state = PLAYER_STATE_STOPPED;
     player->position = 0;
     
+    media_player_close_audio();
+    
     return 0;
 }
 
@@ -902,6 +915,10 @@ int media_player_set_volume(uint32_t volume) {
         player->muted = 0;
     }
     
+    // Karıştırıcıdaki akışa uygula
+    audio_stream_set_volume(player->audio_stream, (uint8_t)player->volume);
+    audio_stream_set_muted(player->audio_stream, player->muted);
+    
     return 0;
 }
 
@@ -911,6 +928,8 @@ int media_player_mute(uint8_t mute) {
     
     player->muted = mute ? 1 : 0;
     
+    audio_stream_set_muted(player->audio_stream, player->muted);
+    
     return 0;
 }
 
@@ -996,6 +1015,37 @@ void media_player_toggle_fullscreen() {
     }
 }
 
+// Geçerli dosya için karıştırıcıda akış aç (dosya değiştiyse yeniden açılır)
+static int media_player_open_audio() {
+    if (player->audio_stream && player->audio_file == player->current_file) {
+        audio_stream_set_paused(player->audio_stream, 0);
+        return 0;
+    }
+    
+    media_player_close_audio();
+    
+    uint32_t sample_rate = player->current_file->sample_rate ? player->current_file->sample_rate : 44100;
+    uint32_t channels = (player->current_file->channels == 1) ? 1 : 2;
+    
+    player->audio_stream = audio_stream_open("media_player", sample_rate, channels);
+    if (!player->audio_stream) return -1;
+    
+    player->audio_file = player->current_file;
+    audio_stream_set_volume(player->audio_stream, (uint8_t)player->volume);
+    audio_stream_set_muted(player->audio_stream, player->muted);
+    
+    return 0;
+}
+
+// Karıştırıcıdaki akışı kapat
+static void media_player_close_audio() {
+    if (player->audio_stream) {
+        audio_stream_close(player->audio_stream);
+        player->audio_stream = NULL;
+        player->audio_file = NULL;
+    }
+}
+
 // Medya dosyalarının listesini güncelle
 static void media_player_update_ui() {
     if (!player || !player->window) return;
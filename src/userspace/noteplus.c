@@ -2,6 +2,7 @@
 #include "../include/gui.h"
 #include "../include/font.h"
 #include "../include/vga.h"
+#include "../include/python_ai.h"
 #include <string.h>
 #include <stdlib.h>
 
@@ -619,6 +620,13 @@ void noteplus_draw_text_area(noteplus_editor_t* editor) {
     }
 }
 
+// Metni Python'da özetle; editör tamponu çağrı süresince paylaşılır
+int noteplus_analyze_text(noteplus_editor_t* editor, char** result_out) {
+    if (!editor || !editor->text_buffer || !result_out) return -1;
+    
+    return python_ai_analyze_text(editor->text_buffer, editor->buffer_size, result_out);
+}
+
 // Not++ uygulama penceresini çiz
 void noteplus_paint(gui_window_t* window) {
     if (!window || !active_editor) return;
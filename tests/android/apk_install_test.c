@@ -0,0 +1,201 @@
+// apk_install: girdi adı doğrulaması, STORED girdilerin CRC-32'si ve yarıda
+// kalan kurulumun etkisi.
+// APK'lar burada STORED girdilerle elle yazılır; imza bloğu yoktur.
+#include "android/apk_install.h"
+#include "test.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+typedef struct {
+    const char* name;
+    uint16_t name_length;           // 0: strlen(name)
+    const char* data;
+} apk_entry_t;
+
+static char root[64];
+
+static uint32_t crc32_update(const uint8_t* data, size_t size) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+static void put16(FILE* file, uint32_t value) {
+    fputc(value & 0xFF, file);
+    fputc((value >> 8) & 0xFF, file);
+}
+
+static void put32(FILE* file, uint32_t value) {
+    put16(file, value & 0xFFFF);
+    put16(file, value >> 16);
+}
+
+// Yalnızca STORED girdilerle ZIP yaz
+static void write_apk(const char* path, const apk_entry_t* entries, uint32_t count) {
+    FILE* file = fopen(path, "wb");
+    uint32_t offsets[16];
+
+    for (uint32_t i = 0; i < count; i++) {
+        uint16_t length = entries[i].name_length ? entries[i].name_length : (uint16_t)strlen(entries[i].name);
+        uint32_t size = (uint32_t)strlen(entries[i].data);
+        offsets[i] = (uint32_t)ftell(file);
+        put32(file, 0x04034B50);
+        put16(file, 10); put16(file, 0); put16(file, 0); put16(file, 0); put16(file, 0);
+        put32(file, crc32_update((const uint8_t*)entries[i].data, size));
+        put32(file, size); put32(file, size);
+        put16(file, length); put16(file, 0);
+        fwrite(entries[i].name, 1, length, file);
+        fwrite(entries[i].data, 1, size, file);
+    }
+
+    uint32_t central = (uint32_t)ftell(file);
+    for (uint32_t i = 0; i < count; i++) {
+        uint16_t length = entries[i].name_length ? entries[i].name_length : (uint16_t)strlen(entries[i].name);
+        uint32_t size = (uint32_t)strlen(entries[i].data);
+        put32(file, 0x02014B50);
+        put16(file, 20); put16(file, 10); put16(file, 0); put16(file, 0); put16(file, 0); put16(file, 0);
+        put32(file, crc32_update((const uint8_t*)entries[i].data, size));
+        put32(file, size); put32(file, size);
+        put16(file, length); put16(file, 0); put16(file, 0); put16(file, 0); put16(file, 0);
+        put32(file, 0); put32(file, offsets[i]);
+        fwrite(entries[i].name, 1, length, file);
+    }
+    uint32_t central_size = (uint32_t)ftell(file) - central;
+
+    put32(file, 0x06054B50);
+    put16(file, 0); put16(file, 0); put16(file, count); put16(file, count);
+    put32(file, central_size); put32(file, central); put16(file, 0);
+    fclose(file);
+}
+
+static int exists(const char* format, const char* name) {
+    char path[256];
+    struct stat st;
+    snprintf(path, sizeof(path), format, root, name);
+    return stat(path, &st) == 0;
+}
+
+static int read_equals(const char* name, const char* expected) {
+    char path[256];
+    char buffer[256] = "";
+    snprintf(path, sizeof(path), "%s/app/%s", root, name);
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return 0;
+    }
+    size_t size = fread(buffer, 1, sizeof(buffer) - 1, file);
+    fclose(file);
+    buffer[size] = '\0';
+    return strcmp(buffer, expected) == 0;
+}
+
+// Yalnızca hedef dizin oluşur; başka ABI'ler ve tanınmayan girdiler atlanır
+static void test_layout(void) {
+    static const apk_entry_t entries[] = {
+        { "AndroidManifest.xml", 0, "<manifest/>" },
+        { "classes.dex", 0, "dex\n035" },
+        { "res/layout/main.xml", 0, "<layout/>" },
+        { "assets/data/a.txt", 0, "assets" },
+        { "lib/x86/libfoo.so", 0, "x86" },
+        { "lib/arm64-v8a/libfoo.so", 0, "arm64" },
+        { "META-INF/MANIFEST.MF", 0, "Manifest-Version: 1.0" },
+        { "../outside.txt", 0, "skipped" },
+    };
+    char apk[128], target[128];
+    apk_install_stats_t stats;
+
+    snprintf(apk, sizeof(apk), "%s/layout.apk", root);
+    snprintf(target, sizeof(target), "%s/app", root);
+    write_apk(apk, entries, sizeof(entries) / sizeof(entries[0]));
+
+    CHECK(apk_install(apk, target, "x86", 2, &stats) == 0);
+    CHECK(stats.entries == 8 && stats.extracted == 5);
+    CHECK(stats.dex_files == 1 && stats.native_libs == 1 && stats.resources == 3);
+    CHECK(stats.signature == APK_SIGNATURE_NONE);
+    CHECK(read_equals("classes.dex", "dex\n035"));
+    CHECK(read_equals("res/layout/main.xml", "<layout/>"));
+    CHECK(read_equals("assets/data/a.txt", "assets"));
+    CHECK(read_equals("lib/x86/libfoo.so", "x86"));
+    CHECK(!exists("%s/app/%s", "lib/arm64-v8a"));
+    CHECK(!exists("%s/app/%s", "META-INF"));
+    CHECK(!exists("%s/%s", "outside.txt"));
+}
+
+// Hazırlık dizininden çıkabilecek her ad kurulumu reddeder; önceki sürüm kalır
+static void test_traversal(void) {
+    static const apk_entry_t unsafe[] = {
+        { "res/../../escape.txt", 0, "x" },
+        { "assets/../../../escape.txt", 0, "x" },
+        { "assets/./a.txt", 0, "x" },
+        { "res//a.xml", 0, "x" },
+        { "res/..", 0, "x" },
+        { "assets/a\\..\\..\\escape.txt", 0, "x" },
+        { "lib/x86/..", 0, "x" },
+        { "assets/a.txt\0/../../escape.txt", sizeof("assets/a.txt\0/../../escape.txt") - 1, "x" },
+    };
+    char apk[128], target[128];
+
+    snprintf(apk, sizeof(apk), "%s/bad.apk", root);
+    snprintf(target, sizeof(target), "%s/app", root);
+
+    for (uint32_t i = 0; i < sizeof(unsafe) / sizeof(unsafe[0]); i++) {
+        apk_entry_t entries[2] = {
+            { "classes.dex", 0, "new" },
+            unsafe[i],
+        };
+        write_apk(apk, entries, 2);
+
+        CHECK_MSG(apk_install(apk, target, "x86", 1, NULL) == APK_INSTALL_ERROR_FORMAT, "%s", unsafe[i].name);
+        CHECK_MSG(!exists("%s/%s", "escape.txt") && !exists("%s/../%s", "escape.txt"), "%s", unsafe[i].name);
+        CHECK_MSG(read_equals("classes.dex", "dex\n035"), "%s", unsafe[i].name);
+    }
+}
+
+// Verisi merkezi dizindeki CRC-32'yi tutmayan STORED girdi kurulumu durdurur
+static void test_stored_crc(void) {
+    static const apk_entry_t entries[] = {
+        { "classes.dex", 0, "dex\n039" },
+        { "assets/b.txt", 0, "b" },
+    };
+    char apk[128], target[128];
+
+    snprintf(apk, sizeof(apk), "%s/crc.apk", root);
+    snprintf(target, sizeof(target), "%s/app", root);
+    write_apk(apk, entries, 2);
+
+    // classes.dex verisinin son baytı: yerel başlık + ad + 6
+    FILE* file = fopen(apk, "r+b");
+    CHECK(file != NULL);
+    if (file) {
+        fseek(file, 30 + 11 + 6, SEEK_SET);
+        fputc('8', file);
+        fclose(file);
+    }
+
+    CHECK(apk_install(apk, target, "x86", 2, NULL) == APK_INSTALL_ERROR_CORRUPT);
+    CHECK(read_equals("classes.dex", "dex\n035"));
+    CHECK(!exists("%s/app/%s", "assets/b.txt"));
+}
+
+int main(void) {
+    snprintf(root, sizeof(root), "/tmp/apk_install_test.%d", (int)getpid());
+    mkdir(root, 0755);
+
+    test_layout();
+    test_traversal();
+    test_stored_crc();
+
+    char command[128];
+    snprintf(command, sizeof(command), "rm -rf %s", root);
+    CHECK(system(command) == 0);
+
+    return test_report("apk_install");
+}
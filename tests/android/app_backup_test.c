@@ -0,0 +1,164 @@
+// app_backup: yedekle / geri yükle gidiş-dönüşü, ortak depoda tekilleştirme,
+// değişmeyen dosyaların atlanması ve bozuk parçanın yakalanması.
+#include "android/app_backup.h"
+#include "test.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+static char root[64];
+
+static void write_file(const char* name, const void* data, size_t size, mode_t mode) {
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s", root, name);
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, mode);
+    CHECK_MSG(fd >= 0 && write(fd, data, size) == (ssize_t)size, "%s", name);
+    if (fd >= 0) {
+        close(fd);
+    }
+}
+
+static void make_dir(const char* name) {
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s", root, name);
+    CHECK_MSG(mkdir(path, 0755) == 0, "%s", name);
+}
+
+static int run(const char* format, ...) __attribute__((format(printf, 1, 2)));
+static int run(const char* format, ...) {
+    char command[512];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(command, sizeof(command), format, args);
+    va_end(args);
+    return system(command);
+}
+
+static mode_t file_mode(const char* name) {
+    char path[256];
+    struct stat st;
+    snprintf(path, sizeof(path), "%s/%s", root, name);
+    return stat(path, &st) == 0 ? (st.st_mode & 07777) : 0;
+}
+
+// Kaynak ağacı: boş dosya, sıkışan metin, sıkışmayan veri, iç içe dizinler
+static void make_source(uint8_t* random, size_t random_size) {
+    make_dir("src");
+    make_dir("src/shared_prefs");
+    make_dir("src/databases");
+    make_dir("src/cache");
+    make_dir("src/cache/empty_dir");
+    write_file("src/empty", "", 0, 0644);
+    write_file("src/shared_prefs/settings.xml", "<map><int name=\"launches\" value=\"3\" /></map>", 46, 0600);
+
+    char* text = (char*)malloc(300 * 1024);
+    for (size_t i = 0, n = 0; i < 300 * 1024; n++) {
+        int length = snprintf(text + i, 300 * 1024 - i, "satır %zu: KALEM OS yedekleme testi\n", n);
+        if (length <= 0 || (size_t)length >= 300 * 1024 - i) {
+            memset(text + i, '.', 300 * 1024 - i);
+            break;
+        }
+        i += (size_t)length;
+    }
+    write_file("src/databases/notes.db", text, 300 * 1024, 0644);
+    free(text);
+
+    write_file("src/cache/blob.bin", random, random_size, 0644);
+
+    char link[256], target[256];
+    snprintf(link, sizeof(link), "%s/src/link", root);
+    snprintf(target, sizeof(target), "%s/src/empty", root);
+    CHECK(symlink(target, link) == 0);
+}
+
+int main(void) {
+    app_backup_stats_t stats;
+    char source[128], store[128], first[128], second[128], target[128];
+
+    snprintf(root, sizeof(root), "/tmp/app_backup_test.%d", (int)getpid());
+    mkdir(root, 0755);
+    snprintf(source, sizeof(source), "%s/src", root);
+    snprintf(store, sizeof(store), "%s/store", root);
+    snprintf(first, sizeof(first), "%s/store/first.kab", root);
+    snprintf(second, sizeof(second), "%s/store/second.kab", root);
+    mkdir(store, 0755);
+
+    size_t random_size = 1024 * 1024;
+    uint8_t* random = (uint8_t*)malloc(random_size + 4096);
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < random_size + 4096; i++) {
+        seed = seed * 1103515245 + 12345;
+        random[i] = (uint8_t)(seed >> 16);
+    }
+    make_source(random, random_size);
+
+    // İlk yedek: tüm veri yeni; bağlantı atlanır
+    CHECK(app_backup_create(source, first, "kayit", 5, 4, &stats) == 0);
+    CHECK(stats.files == 4 && stats.directories == 4 && stats.skipped == 1);
+    CHECK(stats.new_chunks == stats.chunks && stats.chunks > 0);
+    CHECK(stats.total_bytes == 300 * 1024 + random_size + 46);
+    CHECK(stats.stored_bytes < stats.total_bytes);
+
+    char meta[16];
+    uint32_t meta_size = 0;
+    CHECK(app_backup_read_meta(first, meta, sizeof(meta), &meta_size) == 0 && meta_size == 5 && memcmp(meta, "kayit", 5) == 0);
+
+    // Gidiş-dönüş: içerik, izinler ve boş dizin
+    snprintf(target, sizeof(target), "%s/restore1", root);
+    CHECK(app_backup_restore(first, target, 4, &stats) == 0);
+    CHECK(stats.files == 4);
+    CHECK(run("diff -r --no-dereference -x link %s %s", source, target) == 0);
+    CHECK(file_mode("restore1/shared_prefs/settings.xml") == 0600);
+    CHECK(file_mode("restore1/cache/empty_dir") != 0);
+
+    // Blobun ortasına 100 bayt ekle: yalnızca değişen bölgenin parçaları yazılır.
+    // Önceki manifest aynı yoldan okunur; boyutu ve mtime'ı aynı kalan dosyalar okunmaz
+    memmove(random + 500 * 1024 + 100, random + 500 * 1024, random_size - 500 * 1024);
+    memset(random + 500 * 1024, 0xAB, 100);
+    write_file("src/cache/blob.bin", random, random_size + 100, 0644);
+    CHECK(run("cp %s %s", first, second) == 0);
+
+    CHECK(app_backup_create(source, second, NULL, 0, 4, &stats) == 0);
+    CHECK(stats.unchanged_files >= 3);
+    CHECK_MSG(stats.new_chunks > 0 && stats.new_chunks * 8 < stats.chunks, "%llu / %llu",
+              (unsigned long long)stats.new_chunks, (unsigned long long)stats.chunks);
+    CHECK_MSG(stats.new_bytes < 4 * APP_BACKUP_MAX_CHUNK, "%llu", (unsigned long long)stats.new_bytes);
+
+    // İkinci yedek yeni içeriği, ilki eskisini verir (ortak depo)
+    snprintf(target, sizeof(target), "%s/restore2", root);
+    CHECK(app_backup_restore(second, target, 2, NULL) == 0);
+    CHECK(run("diff -r --no-dereference -x link %s %s", source, target) == 0);
+
+    snprintf(target, sizeof(target), "%s/restore1", root);
+    write_file("restore1/extra.txt", "yedekte yok", 11, 0644);
+    CHECK(app_backup_restore(first, target, 1, NULL) == 0);
+    CHECK(run("cmp -s %s/restore1/cache/blob.bin %s/restore2/cache/blob.bin", root, root) != 0);
+    CHECK(run("cmp -s %s/restore1/databases/notes.db %s/src/databases/notes.db", root, root) == 0);
+    CHECK(file_mode("restore1/extra.txt") != 0);
+
+    // Bozuk depo: özeti tutmayan parça geri yüklemeyi durdurur
+    char pack[160];
+    snprintf(pack, sizeof(pack), "%s/%s", store, APP_BACKUP_PACK_NAME);
+    int fd = open(pack, O_RDWR);
+    CHECK(fd >= 0);
+    if (fd >= 0) {
+        uint8_t bytes[64];
+        CHECK(pread(fd, bytes, sizeof(bytes), 4096) == (ssize_t)sizeof(bytes));
+        for (size_t i = 0; i < sizeof(bytes); i++) {
+            bytes[i] ^= 0x5A;
+        }
+        CHECK(pwrite(fd, bytes, sizeof(bytes), 4096) == (ssize_t)sizeof(bytes));
+        close(fd);
+    }
+    snprintf(target, sizeof(target), "%s/restore3", root);
+    CHECK(app_backup_restore(first, target, 4, NULL) == APP_BACKUP_ERROR_CORRUPT);
+
+    free(random);
+    CHECK(run("rm -rf %s", root) == 0);
+
+    return test_report("app_backup");
+}
@@ -0,0 +1,93 @@
+// art_heap: 0xFFFF ve üzeri yuvalı nesneler (geniş referans sayısı). Yuvalar,
+// veri alanı ve genç nesneye işaret eden uzak yuvalar küçük ve tam
+// toplamalardan sonra doğru kalmalı.
+#include "android/art_heap.h"
+#include "test.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#define BIG_REFS 100000
+
+// Verisinde kendi numarasını taşıyan genç nesne
+static art_object_t* make_value(uint32_t number) {
+    art_object_t* object = art_heap_alloc(NULL, 0, sizeof(uint32_t));
+    if (object) {
+        memcpy(ART_OBJECT_DATA(object), &number, sizeof(number));
+    }
+    return object;
+}
+
+static uint32_t value_number(art_object_t* object) {
+    uint32_t number = 0;
+    if (object) {
+        memcpy(&number, ART_OBJECT_DATA(object), sizeof(number));
+    }
+    return number;
+}
+
+int main(void) {
+    static const uint32_t slots[] = { 0, 1, 0xFFFE, 0xFFFF, 0x10000, 70000, BIG_REFS - 1 };
+    art_object_t* big = NULL;
+    art_object_t* edge = NULL;
+    art_object_t* narrow = NULL;
+
+    CHECK(art_heap_create(64 * 1024 * 1024, ART_GC_CONCURRENT) == 0);
+    CHECK(art_heap_attach_thread() == 0);
+    art_heap_add_root(&big);
+    art_heap_add_root(&edge);
+    art_heap_add_root(&narrow);
+
+    // Sınırın iki yanı: 0xFFFE başlığa sığar, 0xFFFF geniş sayı kullanır
+    narrow = art_heap_alloc(NULL, 0xFFFE, 8);
+    edge = art_heap_alloc(NULL, 0xFFFF, 8);
+    CHECK(narrow && narrow->ref_count == 0xFFFE && ART_OBJECT_REF_COUNT(narrow) == 0xFFFE);
+    CHECK(edge && edge->ref_count == ART_OBJECT_REFS_EXTENDED && ART_OBJECT_REF_COUNT(edge) == 0xFFFF);
+    CHECK(ART_OBJECT_REFS(narrow) == (art_object_t**)(narrow + 1));
+    CHECK(ART_OBJECT_REFS(edge) == (art_object_t**)(edge + 1) + 1);
+
+    big = art_heap_alloc(NULL, BIG_REFS, 8);
+    CHECK(big && ART_OBJECT_REF_COUNT(big) == BIG_REFS);
+    if (!big || !edge || !narrow) {
+        return test_report("art_heap");
+    }
+
+    // Veri alanı son yuvadan sonra başlar ve nesnenin içinde kalır
+    CHECK(ART_OBJECT_DATA(big) == (uint8_t*)(ART_OBJECT_REFS(big) + BIG_REFS));
+    CHECK(ART_OBJECT_DATA(big) + 8 <= (uint8_t*)big + big->size);
+    memcpy(ART_OBJECT_DATA(big), "uzunluk", 8);
+
+    for (size_t i = 0; i < sizeof(slots) / sizeof(slots[0]); i++) {
+        art_heap_write_ref(big, slots[i], make_value(slots[i] + 1));
+    }
+    art_heap_write_ref(edge, 0xFFFE, make_value(7));
+    art_heap_write_ref(narrow, 0xFFFD, make_value(9));
+
+    // Küçük toplama: genç nesneler taşınır, eski dizideki uzak yuvalar güncellenir
+    CHECK(art_heap_collect(0) == 0);
+    for (size_t i = 0; i < sizeof(slots) / sizeof(slots[0]); i++) {
+        CHECK_MSG(value_number(ART_OBJECT_REFS(big)[slots[i]]) == slots[i] + 1, "yuva %u", slots[i]);
+    }
+    CHECK(value_number(ART_OBJECT_REFS(edge)[0xFFFE]) == 7);
+    CHECK(value_number(ART_OBJECT_REFS(narrow)[0xFFFD]) == 9);
+    CHECK(ART_OBJECT_REF_COUNT(big) == BIG_REFS && memcmp(ART_OBJECT_DATA(big), "uzunluk", 8) == 0);
+
+    // Tam toplama: erişilebilir nesneler işaretlenir, yuvalar korunur
+    art_heap_write_ref(big, 80000, make_value(80001));
+    CHECK(art_heap_collect(1) == 0);
+    CHECK(art_heap_collect(0) == 0);
+    CHECK(value_number(ART_OBJECT_REFS(big)[80000]) == 80001);
+    CHECK(value_number(ART_OBJECT_REFS(big)[BIG_REFS - 1]) == BIG_REFS);
+    CHECK(ART_OBJECT_REFS(big)[2] == NULL);
+
+    art_heap_stats_t stats;
+    CHECK(art_heap_get_stats(&stats) == 0 && stats.minor_count >= 2);
+
+    art_heap_remove_root(&narrow);
+    art_heap_remove_root(&edge);
+    art_heap_remove_root(&big);
+    art_heap_detach_thread();
+    art_heap_destroy();
+
+    return test_report("art_heap");
+}
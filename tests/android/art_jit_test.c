@@ -0,0 +1,75 @@
+// art_jit: kod önbelleği hiçbir adreste aynı anda yazılabilir ve
+// çalıştırılabilir değildir; derlenmiş ölçüm iş yükleri doğru sonuç verir.
+#include "android/art_heap.h"
+#include "android/art_interp.h"
+#include "android/art_jit.h"
+#include "android/art_bench.h"
+#include "test.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+static int resolve(const char* descriptor, dex_class_t** klass) {
+    dex_file_t* dex;
+    if (art_bench_get_dex(&dex) != 0) {
+        return -1;
+    }
+    return dex_find_class(dex, descriptor, klass);
+}
+
+// /proc/self/maps: yazılabilir ve çalıştırılabilir eşlemeler ile önbelleğin görünümleri
+static void scan_maps(int* writable_exec, int* cache_exec, int* cache_write) {
+    char line[512];
+    FILE* maps = fopen("/proc/self/maps", "r");
+
+    *writable_exec = *cache_exec = *cache_write = 0;
+    if (!maps) {
+        return;
+    }
+    while (fgets(line, sizeof(line), maps)) {
+        char perms[8] = "";
+        if (sscanf(line, "%*s %7s", perms) != 1) {
+            continue;
+        }
+        int write = perms[1] == 'w', exec = perms[2] == 'x';
+        *writable_exec += write && exec;
+        if (strstr(line, "art-jit")) {
+            *cache_exec += exec && !write;
+            *cache_write += write && !exec;
+        }
+    }
+    fclose(maps);
+}
+
+int main(void) {
+    int writable_exec, cache_exec, cache_write;
+
+    CHECK(art_heap_create(64 * 1024 * 1024, ART_GC_STOP_THE_WORLD) == 0);
+    CHECK(art_heap_attach_thread() == 0);
+    CHECK(art_interp_init(resolve) == 0);
+    CHECK(art_interp_attach_thread() == 0);
+
+    CHECK(art_jit_init(1024 * 1024, 1000) == 0);
+    scan_maps(&writable_exec, &cache_exec, &cache_write);
+    CHECK_MSG(writable_exec == 0, "%d", writable_exec);
+    CHECK(cache_exec == 1 && cache_write == 1);
+
+    // Derlenen kod çalıştırılabilir görünümden yürür
+    art_bench_result_t results[ART_BENCH_WORKLOADS];
+    uint32_t count = 0;
+    CHECK(art_bench_run(0.02, results, ART_BENCH_WORKLOADS, &count) == 0 && count == ART_BENCH_WORKLOADS);
+    for (uint32_t i = 0; i < count; i++) {
+        CHECK_MSG(results[i].verified, "%s", results[i].name);
+    }
+
+    art_jit_stats_t stats;
+    CHECK(art_jit_get_stats(&stats) == 0 && stats.compiled_methods > 0 && stats.hits > 0);
+    scan_maps(&writable_exec, &cache_exec, &cache_write);
+    CHECK(writable_exec == 0);
+
+    art_jit_cleanup();
+    scan_maps(&writable_exec, &cache_exec, &cache_write);
+    CHECK(cache_exec == 0 && cache_write == 0);
+
+    return test_report("art_jit");
+}
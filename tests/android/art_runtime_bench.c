@@ -0,0 +1,72 @@
+// Çalışma zamanı ölçüm iş yüklerini önce yorumlayıcıyla, ardından aynı süreçte
+// JIT açıkken çalıştırır ve ops/s oranlarını yazdırır. Her sonuç iş yükünün
+// kendi doğrulamasından geçer; doğrulanmayan satır işaretlenir.
+//
+//   art_runtime_bench [stw|concurrent] [önbellek KB] [eşik] [süre s]
+#include "android/art_heap.h"
+#include "android/art_interp.h"
+#include "android/art_jit.h"
+#include "android/art_bench.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+static int resolve(const char* descriptor, dex_class_t** klass) {
+    dex_file_t* dex;
+    if (art_bench_get_dex(&dex) != 0) {
+        return -1;
+    }
+    return dex_find_class(dex, descriptor, klass);
+}
+
+int main(int argc, char** argv) {
+    art_gc_mode_t mode = (argc > 1 && strcmp(argv[1], "concurrent") == 0) ? ART_GC_CONCURRENT : ART_GC_STOP_THE_WORLD;
+    size_t cache_size = argc > 2 ? (size_t)atoi(argv[2]) * 1024 : 1024 * 1024;
+    uint32_t threshold = argc > 3 ? (uint32_t)atoi(argv[3]) : 1000;
+    double seconds = argc > 4 ? atof(argv[4]) : 0.5;
+
+    if (art_heap_create(64 * 1024 * 1024, mode) != 0 || art_heap_attach_thread() != 0 ||
+        art_interp_init(resolve) != 0 || art_interp_attach_thread() != 0) {
+        fprintf(stderr, "çalışma zamanı başlatılamadı\n");
+        return 1;
+    }
+
+    art_bench_result_t interp[ART_BENCH_WORKLOADS], jit[ART_BENCH_WORKLOADS];
+    uint32_t interp_count = 0, jit_count = 0;
+    if (art_bench_run(seconds, interp, ART_BENCH_WORKLOADS, &interp_count) != 0) {
+        fprintf(stderr, "yorumlayıcı ölçümü başarısız\n");
+        return 1;
+    }
+
+    int status = art_jit_init(cache_size, threshold);
+    if (status != 0) {
+        fprintf(stderr, "JIT başlatılamadı: %d\n", status);
+        return 1;
+    }
+    if (art_bench_run(seconds, jit, ART_BENCH_WORKLOADS, &jit_count) != 0 || jit_count != interp_count) {
+        fprintf(stderr, "JIT ölçümü başarısız\n");
+        return 1;
+    }
+
+    printf("%s GC, eşik %u, önbellek %zu KB, en az %.2f s\n",
+           mode == ART_GC_CONCURRENT ? "eşzamanlı" : "dünyayı durduran", threshold, cache_size / 1024, seconds);
+    printf("%-18s %14s %14s %7s\n", "iş yükü", "yorumlayıcı", "JIT", "oran");
+    int failed = 0;
+    for (uint32_t i = 0; i < interp_count; i++) {
+        int verified = interp[i].verified && jit[i].verified;
+        failed += !verified;
+        printf("%-18s %14.0f %14.0f %6.2fx%s\n", interp[i].name, interp[i].ops_per_second, jit[i].ops_per_second,
+               interp[i].ops_per_second > 0 ? jit[i].ops_per_second / interp[i].ops_per_second : 0.0,
+               verified ? "" : "  DOĞRULANMADI");
+    }
+
+    art_jit_stats_t stats;
+    if (art_jit_get_stats(&stats) == 0) {
+        printf("\nJIT: %u yöntem, %u derleme, %u başarısız, %u çağrı ağırlıklı, %u çıkarma, %llu/%llu bayt, isabet %.3f%%\n",
+               stats.compiled_methods, stats.compilations, stats.failed, stats.invoke_heavy, stats.evictions,
+               (unsigned long long)stats.cache_used, (unsigned long long)stats.cache_size, stats.hit_rate);
+    }
+
+    art_jit_cleanup();
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,174 @@
+// Kısmi güncelleme ile tam kare güncellemenin karşılaştırması. Android tarafı
+// gibi binder üzerinden tampon alır, çizer ve hasar bölgeleriyle gönderir;
+// pencere tarafı gui_backing.c'deki gerçek dönüştürme yolunu çalıştırır.
+//   - metin düzenleyici: her karede bir karakter (8x16) ve imleç (2x16)
+//   - video: her karede tüm kare, hasar bildirilmez
+//
+//   bridge_damage_bench [genişlik] [yükseklik] [kare]
+#include "android/android_bridge.h"
+#include "android/binder.h"
+#include "pixel_format.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+
+uint8_t* vga_framebuffer;
+uint32_t vga_width;
+uint32_t vga_height;
+
+// GUI döngüsündeki gui_window_invalidate ile aynı: çizim işleyicisi, ardından kısmi çizim
+void gui_window_invalidate(gui_window_t* window) {
+    if (window->on_paint) {
+        window->on_paint(window);
+    }
+    if (window->backing_store) {
+        gui_window_draw_backing_store(window, 1);
+    }
+}
+
+void gui_window_post_invalidate(gui_window_t* window) {
+    __atomic_store_n(&window->invalidate_pending, 1, __ATOMIC_RELEASE);
+}
+
+static double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+typedef struct {
+    double frame_us;        // Binder ile al + çiz + gönder
+    double convert_us;      // Pencere tarafı (çizim işleyicisi + dönüştürme)
+    uint64_t converted;     // Dönüştürülen bayt
+    uint64_t damage;        // Bildirilen hasar baytı
+} bench_result_t;
+
+static void fill_rect(uint32_t* pixels, uint32_t stride, const android_rect_t* rect, uint32_t color) {
+    for (uint32_t y = rect->y; y < rect->y + rect->height; y++) {
+        for (uint32_t x = rect->x; x < rect->x + rect->width; x++) {
+            pixels[(size_t)y * stride + x] = color;
+        }
+    }
+}
+
+static int run(android_bridge_t* bridge, gui_window_t* window, uint32_t frames, int editor, bench_result_t* result) {
+    android_surface_t* surface = bridge->surface;
+    void* service = binder_get_service(surface->service_name);
+    android_surface_stats_t before, after;
+    uint64_t converted = window->backing_bytes_converted;
+    uint32_t columns = surface->width / 8, rows = surface->height / 16;
+
+    memset(result, 0, sizeof(*result));
+    bridge_get_surface_stats(surface, &before);
+
+    for (uint32_t frame = 0; frame < frames; frame++) {
+        double start = now_us();
+
+        android_surface_lock_reply_t lock;
+        uint32_t reply_size;
+        if (binder_transact(service, ANDROID_SURFACE_TRANSACT_LOCK, NULL, 0, &lock, sizeof(lock), &reply_size, 0) != 0) {
+            return -1;
+        }
+        uint32_t* pixels = surface->slots[lock.slot].pixels;
+
+        struct {
+            uint32_t count;
+            android_rect_t rects[2];
+        } post;
+
+        if (editor) {
+            // Yazılan karakter ve bir sonraki konumdaki imleç
+            uint32_t cell = frame % (columns * rows);
+            uint32_t next = (frame + 1) % (columns * rows);
+            post.count = 2;
+            post.rects[0] = (android_rect_t){ (cell % columns) * 8, (cell / columns) * 16, 8, 16 };
+            post.rects[1] = (android_rect_t){ (next % columns) * 8, (next / columns) * 16, 2, 16 };
+            fill_rect(pixels, lock.stride, &post.rects[0], 0xFF202020 + frame);
+            fill_rect(pixels, lock.stride, &post.rects[1], 0xFF000000);
+        } else {
+            android_rect_t all = { 0, 0, lock.width, lock.height };
+            post.count = 0;
+            fill_rect(pixels, lock.stride, &all, 0xFF000000 | (frame * 0x010203));
+        }
+
+        uint32_t size = sizeof(uint32_t) + post.count * sizeof(android_rect_t);
+        if (binder_transact(service, ANDROID_SURFACE_TRANSACT_UNLOCK, &post, size, NULL, 0, NULL, 0) != 0) {
+            return -1;
+        }
+        double drawn = now_us();
+
+        gui_window_invalidate(window);
+        double shown = now_us();
+
+        result->frame_us += drawn - start;
+        result->convert_us += shown - drawn;
+    }
+
+    bridge_get_surface_stats(surface, &after);
+    result->frame_us /= frames;
+    result->convert_us /= frames;
+    result->converted = (window->backing_bytes_converted - converted) / frames;
+    result->damage = (after.damage_bytes - before.damage_bytes) / frames;
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    uint32_t width = argc > 1 ? (uint32_t)atoi(argv[1]) : 640;
+    uint32_t height = argc > 2 ? (uint32_t)atoi(argv[2]) : 480;
+    uint32_t frames = argc > 3 ? (uint32_t)atoi(argv[3]) : 600;
+    if (width < 64 || height < 64 || width > 1024 || height > 1024 || frames == 0) {
+        fprintf(stderr, "kullanım: %s [genişlik] [yükseklik] [kare]\n", argv[0]);
+        return 2;
+    }
+
+    // Çerçeve tamponu ve 6 bit DAC paleti (3-3-2 küp)
+    vga_width = width;
+    vga_height = height;
+    vga_framebuffer = (uint8_t*)calloc((size_t)width * height, 1);
+    vga_color_t palette[256];
+    for (uint32_t i = 0; i < 256; i++) {
+        palette[i].r = (uint8_t)(((i >> 5) & 7) * 63 / 7);
+        palette[i].g = (uint8_t)(((i >> 2) & 7) * 63 / 7);
+        palette[i].b = (uint8_t)((i & 3) * 63 / 3);
+    }
+    pixel_format_init();
+    pixel_format_build_palette_lut(palette, 256);
+
+    android_container_t container;
+    gui_window_t window;
+    memset(&container, 0, sizeof(container));
+    memset(&window, 0, sizeof(window));
+    window.width = (uint16_t)width;
+    window.height = (uint16_t)height;
+    window.client.width = (uint16_t)width;
+    window.client.height = (uint16_t)height;
+    window.visible = 1;
+
+    bridge_initialize();
+    android_bridge_t* bridge = bridge_create(&container);
+    if (!bridge || bridge_connect_to_window(bridge, &window) != 0 || !bridge->surface->service_name[0]) {
+        fprintf(stderr, "köprü kurulamadı\n");
+        return 1;
+    }
+
+    bench_result_t editor, video;
+    if (run(bridge, &window, 60, 0, &video) != 0 ||
+        run(bridge, &window, frames, 1, &editor) != 0 ||
+        run(bridge, &window, frames, 0, &video) != 0) {
+        fprintf(stderr, "kare gönderilemedi\n");
+        return 1;
+    }
+
+    printf("%ux%u, %u kare, çekirdek %s\n", width, height, frames, pixel_format_isa_name(pixel_format_get_isa()));
+    printf("%-18s %14s %14s %12s %12s\n", "", "hasar B/kare", "dönüşüm B/kare", "gönderim us", "dönüşüm us");
+    printf("%-18s %14llu %14llu %12.1f %12.1f\n", "metin düzenleyici",
+           (unsigned long long)editor.damage, (unsigned long long)editor.converted, editor.frame_us, editor.convert_us);
+    printf("%-18s %14llu %14llu %12.1f %12.1f\n", "video",
+           (unsigned long long)video.damage, (unsigned long long)video.converted, video.frame_us, video.convert_us);
+    printf("düzenleyici / video dönüşüm baytı: %.4f\n", (double)editor.converted / (double)video.converted);
+
+    bridge_destroy(bridge);
+    free(vga_framebuffer);
+    return 0;
+}
@@ -0,0 +1,151 @@
+// bridge: yüzey kuyruğu ve pencere boyutlandırması. Sürüklemede ara boyutlar
+// birleştirilir; büyüme sırasında pencerenin gösterdiği eski tampon, pencere
+// yeni bir tampon alana dek geçerli kalır; kuyruktaki kare kaybolmaz.
+#include "android/android_bridge.h"
+#include "android/binder.h"
+#include "test.h"
+#include <string.h>
+
+// GUI döngüsü yerine: geçersiz kılma çizim işleyicisini hemen çağırır
+void gui_window_invalidate(gui_window_t* window) {
+    if (window->on_paint) {
+        window->on_paint(window);
+    }
+}
+
+void gui_window_post_invalidate(gui_window_t* window) {
+    __atomic_store_n(&window->invalidate_pending, 1, __ATOMIC_RELEASE);
+}
+
+static uint32_t pattern(uint32_t x, uint32_t y, uint32_t frame) {
+    return 0xFF000000u | (frame << 16) | ((y & 0xFF) << 8) | (x & 0xFF);
+}
+
+// Bir kare çiz ve kuyruğa ekle
+static void draw_frame(android_surface_t* surface, uint32_t frame) {
+    void* buffer;
+    CHECK(bridge_lock_surface(surface, &buffer) == 0);
+    for (uint32_t y = 0; y < surface->height; y++) {
+        for (uint32_t x = 0; x < surface->width; x++) {
+            ((uint32_t*)buffer)[(size_t)y * surface->stride + x] = pattern(x, y, frame);
+        }
+    }
+    CHECK(bridge_unlock_surface(surface, NULL, 0) == 0);
+}
+
+// Pencerenin gösterdiği piksel
+static uint32_t shown(const gui_window_t* window, uint32_t x, uint32_t y) {
+    return window->backing_store[(size_t)y * window->backing_stride + x];
+}
+
+int main(void) {
+    android_container_t container;
+    gui_window_t window;
+    memset(&container, 0, sizeof(container));
+    memset(&window, 0, sizeof(window));
+    window.width = 100;
+    window.height = 50;
+    window.visible = 1;
+    window.resizable = 1;
+
+    CHECK(bridge_initialize() == 0);
+    android_bridge_t* bridge = bridge_create(&container);
+    CHECK(bridge && bridge_connect_to_window(bridge, &window) == 0);
+    android_surface_t* surface = bridge->surface;
+    CHECK(surface && window.on_resize && window.on_resize_drag);
+
+    draw_frame(surface, 1);
+    gui_window_invalidate(&window);
+    CHECK(window.backing_store && shown(&window, 10, 5) == pattern(10, 5, 1));
+
+    // Küçülme ve ayrılmış alan içindeki büyüme yerinde
+    window.on_resize(&window, 60, 30);
+    window.on_resize(&window, 100, (uint16_t)surface->capacity_height);
+    CHECK(surface->stats.resize_reallocations == 0 && surface->stats.resizes_in_place == 2);
+
+    // Pencere sürüklemesi: ara boyutlar yeniden ayırmaz, yalnızca son boyut ayırır
+    const uint32_t* before = window.backing_store;
+    window.on_resize_drag(&window, 1);
+    for (int i = 0; i <= 200; i++) {
+        window.on_resize(&window, (uint16_t)(100 + i), (uint16_t)(50 + i * 130 / 200));
+    }
+    CHECK(surface->stats.resize_reallocations == 0);
+    window.on_resize_drag(&window, 0);
+    CHECK(surface->stats.resize_reallocations == 1);
+    CHECK(surface->width == 300 && surface->height == 180);
+    
+    // Sunum işaretçi takasıdır; tek kopya büyümede son karenin taşınmasıdır
+    android_surface_stats_t stats;
+    CHECK(bridge_get_surface_stats(surface, &stats) == 0);
+    CHECK(stats.buffer_copies == 1 && stats.frames_presented == 1);
+
+    // Pencere bir sonraki çizime dek eski tamponu okuyabilir
+    CHECK(window.backing_store == before && surface->retired[0] != NULL);
+    CHECK(shown(&window, 10, 5) == pattern(10, 5, 1));
+    gui_window_invalidate(&window);
+    CHECK(window.backing_store == surface->slots[0].pixels && window.backing_stride == surface->stride);
+    CHECK(surface->retired[0] == NULL && window.backing_full_damage);
+    CHECK(shown(&window, 10, 5) == pattern(10, 5, 1));
+
+    // Kuyruktaki kare büyümede kuyrukta kalır: gösterildiğinde sayılır
+    draw_frame(surface, 2);
+    uint64_t presented = surface->stats.frames_presented;
+    before = window.backing_store;
+    CHECK(bridge_resize_surface(surface, 600, 400) == 0);
+    CHECK(surface->stats.resize_reallocations == 2);
+    CHECK(surface->queued_slot == 0 && surface->slots[0].state == SURFACE_BUFFER_QUEUED);
+    CHECK(surface->acquired_slot == ANDROID_SURFACE_NO_SLOT);
+
+    // İkinci büyüme pencerenin hiç görmediği ara tamponları hemen bırakır;
+    // pencerenin gösterdiği ilk tampon saklanmaya devam eder
+    CHECK(bridge_resize_surface(surface, 1000, 700) == 0);
+    CHECK(surface->stats.resize_reallocations == 3 && surface->queued_slot == 0);
+    CHECK(window.backing_store == before && shown(&window, 10, 5) == pattern(10, 5, 1));
+
+    gui_window_invalidate(&window);
+    CHECK(surface->stats.frames_presented == presented + 1);
+    CHECK(surface->stats.buffer_copies == 3);
+    CHECK(surface->retired[0] == NULL && window.backing_store == surface->slots[0].pixels);
+    CHECK(shown(&window, 250, 150) == pattern(250, 150, 2));
+    CHECK(window.backing_width == 300 && window.backing_height == 180 && window.backing_full_damage);
+
+    // Çizim sürerken gelen boyut kare kuyruğa girince uygulanır
+    void* buffer;
+    CHECK(bridge_lock_surface(surface, &buffer) == 0);
+    CHECK(bridge_resize_surface(surface, 120, 90) == 0 && surface->width == 1000);
+    CHECK(bridge_unlock_surface(surface, NULL, 0) == 0 && surface->width == 120);
+
+    // Android çizim yolu: binder üzerinden tampon al, iki dikdörtgen çiz, gönder
+    void* service = binder_get_service(surface->service_name);
+    CHECK(service != NULL);
+    gui_window_invalidate(&window);
+    android_surface_lock_reply_t lock;
+    uint32_t reply_size = 0;
+    CHECK(binder_transact(service, ANDROID_SURFACE_TRANSACT_LOCK, NULL, 0,
+                          &lock, sizeof(lock), &reply_size, 0) == 0);
+    CHECK(reply_size == sizeof(lock) && lock.slot >= 0 && lock.width == 120 && lock.stride == surface->stride);
+    uint32_t* pixels = surface->slots[lock.slot].pixels;
+    pixels[(size_t)5 * lock.stride + 7] = 0xFF123456;
+    
+    struct {
+        uint32_t count;
+        android_rect_t rects[2];
+    } post = { 2, { { 7, 5, 8, 16 }, { 100, 80, 50, 50 } } };
+    CHECK(binder_transact(service, ANDROID_SURFACE_TRANSACT_UNLOCK, &post, sizeof(post), NULL, 0, NULL, 0) == 0);
+    CHECK(binder_transact(service, ANDROID_SURFACE_TRANSACT_UNLOCK, &post, sizeof(post), NULL, 0, NULL, 0) == -2);
+    CHECK(__atomic_load_n(&window.invalidate_pending, __ATOMIC_ACQUIRE));
+    gui_window_invalidate(&window);
+    CHECK(shown(&window, 7, 5) == 0xFF123456 && !window.backing_full_damage);
+    CHECK(window.backing_damage_count == 2 && window.backing_damage[0].width == 8);
+    CHECK(window.backing_damage[1].width == 20 && window.backing_damage[1].height == 10);
+    
+    // Ayrılınca pencerenin kendi işleyicileri geri gelir
+    char service_name[ANDROID_SURFACE_SERVICE_NAME_MAX];
+    strcpy(service_name, surface->service_name);
+    CHECK(bridge_destroy(bridge) == 0);
+    CHECK(window.on_paint == NULL && window.on_resize == NULL && window.on_resize_drag == NULL);
+    CHECK(window.backing_store == NULL);
+    CHECK(binder_get_service(service_name) == NULL);
+
+    return test_report("bridge");
+}
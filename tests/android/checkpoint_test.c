@@ -0,0 +1,156 @@
+// checkpoint: artımlı kayıt, yarıda kalan kaydın önceki imajı bozmaması,
+// başlığı yazılmış günlüğün geri yüklemede uygulanması ve bölgeler
+// kaldırılırken yazmaya devam eden iş parçacıkları.
+#include "android/container_checkpoint.h"
+#include "test.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define PAGES 16
+
+static char root[64];
+
+static int image_matches(const uint8_t* memory, size_t size) {
+    char path[128];
+    uint8_t* image = (uint8_t*)malloc(size);
+    snprintf(path, sizeof(path), "%s/memory.img", root);
+    int fd = open(path, O_RDONLY);
+    int same = fd >= 0 && image && pread(fd, image, size, 0) == (ssize_t)size && memcmp(image, memory, size) == 0;
+    if (fd >= 0) {
+        close(fd);
+    }
+    free(image);
+    return same;
+}
+
+static int path_exists(const char* name) {
+    char path[128];
+    struct stat st;
+    snprintf(path, sizeof(path), "%s/%s", root, name);
+    return stat(path, &st) == 0;
+}
+
+static int run(const char* command) {
+    char line[256];
+    snprintf(line, sizeof(line), command, root, root);
+    return system(line);
+}
+
+// Bölge kaldırılıp yeniden eklenirken sürekli yaz. Kayıt sırasında konteyner
+// donmuş olur; bunun yerine yazıcı kilitle durdurulur
+static volatile int writer_stop;
+static pthread_mutex_t writer_lock = PTHREAD_MUTEX_INITIALIZER;
+static void* writer(void* arg) {
+    volatile uint8_t* memory = (volatile uint8_t*)arg;
+    for (uint32_t n = 0; !writer_stop; n++) {
+        pthread_mutex_lock(&writer_lock);
+        for (uint32_t page = 0; page < PAGES; page++) {
+            memory[page * CHECKPOINT_PAGE_SIZE + (n % 64)] = (uint8_t)n;
+        }
+        pthread_mutex_unlock(&writer_lock);
+    }
+    return NULL;
+}
+
+int main(void) {
+    size_t size = PAGES * CHECKPOINT_PAGE_SIZE;
+    checkpoint_stats_t stats;
+
+    snprintf(root, sizeof(root), "/tmp/checkpoint_test.%d", (int)getpid());
+    uint8_t* memory = (uint8_t*)mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    uint8_t* expected = (uint8_t*)malloc(size);
+    CHECK(memory != MAP_FAILED && expected);
+    for (size_t i = 0; i < size; i++) {
+        memory[i] = (uint8_t)(i * 7);
+    }
+
+    container_checkpoint_t* checkpoint = checkpoint_create(root);
+    CHECK(checkpoint && checkpoint_add_region(checkpoint, memory, size) == 0);
+
+    // İlk kayıt her sayfayı, sonraki yalnızca yazılanları yazar
+    CHECK(checkpoint_save(checkpoint) == 0);
+    CHECK(checkpoint_get_stats(checkpoint, &stats) == 0 && stats.generation == 1 && stats.last_pages_written == PAGES);
+    CHECK(image_matches(memory, size));
+    CHECK(!path_exists("memory.journal"));
+
+    memory[3 * CHECKPOINT_PAGE_SIZE] = 0xA1;
+    memory[9 * CHECKPOINT_PAGE_SIZE + 100] = 0xB2;
+    CHECK(checkpoint_save(checkpoint) == 0);
+    CHECK(checkpoint_get_stats(checkpoint, &stats) == 0 && stats.generation == 2 && stats.last_pages_written == 2);
+    CHECK(stats.dirty_faults >= 2);
+    CHECK(image_matches(memory, size));
+
+    // Başlık yazılamazsa kayıt tamamlanmaz: imaj ve kuşak değişmez, kirli
+    // sayfalar bir sonraki kayda kalır
+    memcpy(expected, memory, size);
+    memory[5 * CHECKPOINT_PAGE_SIZE] = 0xC3;
+    CHECK(run("mkdir %s/checkpoint.img.tmp") == 0);
+    CHECK(checkpoint_save(checkpoint) == CHECKPOINT_ERROR_IO);
+    CHECK(checkpoint_get_stats(checkpoint, &stats) == 0 && stats.generation == 2);
+    CHECK(image_matches(expected, size));
+    CHECK(!path_exists("memory.journal"));
+    CHECK(run("rmdir %s/checkpoint.img.tmp") == 0);
+    CHECK(checkpoint_save(checkpoint) == 0);
+    CHECK(checkpoint_get_stats(checkpoint, &stats) == 0 && stats.generation == 3 && stats.last_pages_written == 1);
+    CHECK(image_matches(memory, size));
+
+    // Başlık yazıldıktan sonra imaja uygulama kesilirse günlük kalır ve geri
+    // yükleme onu uygular
+    memory[12 * CHECKPOINT_PAGE_SIZE + 8] = 0xD4;
+    memcpy(expected, memory, size);
+    CHECK(run("mv %s/memory.img %s/memory.img.bak") == 0);
+    CHECK(run("mkdir %s/memory.img") == 0);
+    CHECK(checkpoint_save(checkpoint) == CHECKPOINT_ERROR_IO);
+    CHECK(checkpoint_get_stats(checkpoint, &stats) == 0 && stats.generation == 4);
+    CHECK(path_exists("memory.journal"));
+    CHECK(run("rmdir %s/memory.img") == 0);
+    CHECK(run("mv %s/memory.img.bak %s/memory.img") == 0);
+
+    memset(memory, 0, size);
+    CHECK(checkpoint_restore(checkpoint, NULL) == 0);
+    CHECK(memcmp(memory, expected, size) == 0);
+    CHECK(image_matches(expected, size));
+    CHECK(!path_exists("memory.journal"));
+
+    // Başka kuşağın günlüğü yarım kalmış kayıttır, uygulanmaz
+    CHECK(run("head -c 8192 /dev/urandom > %s/memory.journal") == 0);
+    CHECK(checkpoint_restore(checkpoint, NULL) == 0);
+    CHECK(memcmp(memory, expected, size) == 0);
+    CHECK(!path_exists("memory.journal"));
+
+    // Yazmalar sürerken bölgeyi kaldırıp yeniden ekle
+    CHECK(checkpoint_remove_region(checkpoint, memory) == 0);
+    munmap(memory, size);
+    memory = (uint8_t*)mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    CHECK(memory != MAP_FAILED);
+    pthread_t thread;
+    writer_stop = 0;
+    CHECK(pthread_create(&thread, NULL, writer, memory) == 0);
+    int failures = 0;
+    for (int i = 0; i < 200; i++) {
+        pthread_mutex_lock(&writer_lock);
+        failures += checkpoint_add_region(checkpoint, memory, size) != 0;
+        failures += checkpoint_save(checkpoint) != 0;
+        pthread_mutex_unlock(&writer_lock);
+        sched_yield();
+        failures += checkpoint_remove_region(checkpoint, memory) != 0;
+    }
+    writer_stop = 1;
+    pthread_join(thread, NULL);
+    CHECK_MSG(failures == 0, "%d", failures);
+    CHECK(checkpoint_get_stats(checkpoint, &stats) == 0 && stats.regions == 0);
+
+    checkpoint_destroy(checkpoint);
+    munmap(memory, size);
+    free(expected);
+    CHECK(run("rm -rf %s") == 0);
+
+    return test_report("checkpoint");
+}
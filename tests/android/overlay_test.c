@@ -0,0 +1,112 @@
+// overlay: üst katman disk kotası. Yazma, kesme ve yazarken kopyalama
+// upper_bytes'ı dosya boyutlarıyla tutarlı tutmalı ve kotayı aşan büyüme reddedilmeli.
+#include "android/container_overlay.h"
+#include "test.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+static uint64_t upper_bytes(overlay_t* overlay) {
+    overlay_stats_t stats;
+    return overlay_get_stats(overlay, &stats) == 0 ? stats.upper_bytes : (uint64_t)-1;
+}
+
+int main(void) {
+    char root[64], lower[96], upper[96], path[160], command[256];
+    static uint8_t data[8192];
+
+    snprintf(root, sizeof(root), "/tmp/overlay_test.%d", (int)getpid());
+    snprintf(lower, sizeof(lower), "%s/lower", root);
+    snprintf(upper, sizeof(upper), "%s/upper", root);
+    mkdir(root, 0755);
+    mkdir(lower, 0755);
+    mkdir(upper, 0755);
+    memset(data, 0x5A, sizeof(data));
+
+    // Alt katmanda 3000 baytlık bir dosya ve boş data dizini
+    snprintf(path, sizeof(path), "%s/data", lower);
+    mkdir(path, 0755);
+    snprintf(path, sizeof(path), "%s/base.bin", lower);
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    CHECK(fd >= 0 && write(fd, data, 3000) == 3000);
+    close(fd);
+
+    overlay_t* overlay = overlay_create(lower, upper);
+    CHECK(overlay != NULL);
+    if (!overlay) {
+        return test_report("overlay");
+    }
+    CHECK(overlay_set_quota(overlay, 10000) == 0);
+    CHECK(upper_bytes(overlay) == 0);
+
+    // Yeni dosya: büyüme kotadan düşülür, kotayı aşan yazma hiç yapılmaz
+    fd = overlay_open(overlay, "data/app.db", O_RDWR | O_CREAT, 0644);
+    CHECK(fd >= 0);
+    CHECK(overlay_write(overlay, fd, data, 4000) == 4000);
+    CHECK(upper_bytes(overlay) == 4000);
+    CHECK(overlay_write(overlay, fd, data, 8000) == OVERLAY_ERROR_NO_SPACE);
+    CHECK(upper_bytes(overlay) == 4000);
+    CHECK(lseek(fd, 0, SEEK_END) == 4000);
+
+    // Mevcut boyutun içinde üzerine yazmak ücretsiz; taşan kısım ücretlenir
+    CHECK(lseek(fd, 1000, SEEK_SET) == 1000);
+    CHECK(overlay_write(overlay, fd, data, 2000) == 2000);
+    CHECK(upper_bytes(overlay) == 4000);
+    CHECK(lseek(fd, 3500, SEEK_SET) == 3500);
+    CHECK(overlay_write(overlay, fd, data, 1500) == 1500);
+    CHECK(upper_bytes(overlay) == 5000);
+
+    // Kesme: küçültme kullanımı düşürür, kotayı aşan büyütme reddedilir
+    CHECK(overlay_truncate(overlay, fd, 2000) == 0);
+    CHECK(upper_bytes(overlay) == 2000);
+    CHECK(overlay_truncate(overlay, fd, 20000) == OVERLAY_ERROR_NO_SPACE);
+    CHECK(upper_bytes(overlay) == 2000);
+    CHECK(overlay_truncate(overlay, fd, 6000) == 0);
+    CHECK(upper_bytes(overlay) == 6000);
+    close(fd);
+
+    // O_APPEND: konum dosya sonu kabul edilir
+    fd = overlay_open(overlay, "data/app.db", O_WRONLY | O_APPEND, 0);
+    CHECK(fd >= 0);
+    CHECK(overlay_write(overlay, fd, data, 1000) == 1000);
+    CHECK(upper_bytes(overlay) == 7000);
+    CHECK(overlay_write(overlay, fd, data, 4000) == OVERLAY_ERROR_NO_SPACE);
+    close(fd);
+
+    // Yazarken kopyalama alt katman dosyasını üste taşır ve boyutu ücretlenir
+    fd = overlay_open(overlay, "base.bin", O_WRONLY, 0);
+    CHECK(fd >= 0);
+    CHECK(upper_bytes(overlay) == 10000);
+    CHECK(overlay_write(overlay, fd, data, 100) == 100);
+    CHECK(upper_bytes(overlay) == 10000);
+    CHECK(lseek(fd, 0, SEEK_END) == 3000);
+    CHECK(overlay_write(overlay, fd, data, 1) == OVERLAY_ERROR_NO_SPACE);
+    close(fd);
+
+    // O_TRUNC ve silme alanı geri verir
+    fd = overlay_open(overlay, "data/app.db", O_WRONLY | O_TRUNC, 0);
+    CHECK(fd >= 0);
+    CHECK(upper_bytes(overlay) == 3000);
+    close(fd);
+    CHECK(overlay_unlink(overlay, "base.bin") == 0);
+    CHECK(upper_bytes(overlay) == 0);
+
+    // Kota kaldırılınca sınır yok
+    CHECK(overlay_set_quota(overlay, 0) == 0);
+    fd = overlay_open(overlay, "data/app.db", O_WRONLY, 0);
+    CHECK(fd >= 0);
+    for (int i = 0; i < 4; i++) {
+        CHECK(overlay_write(overlay, fd, data, sizeof(data)) == (ssize_t)sizeof(data));
+    }
+    CHECK(upper_bytes(overlay) == 4 * sizeof(data));
+    close(fd);
+
+    overlay_destroy(overlay);
+    snprintf(command, sizeof(command), "rm -rf %s", root);
+    CHECK(system(command) == 0);
+
+    return test_report("overlay");
+}
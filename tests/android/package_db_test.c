@@ -0,0 +1,192 @@
+// package_db: açılışta indeks + kuyruk oynatma, yarım kayıt, bozuk ya da
+// eskimiş indeks ve sıkıştırma sonrası içerik.
+#include "android/package_db.h"
+#include "test.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+typedef struct {
+    char name[64];
+    uint32_t version;
+    char padding[188];
+} record_t;
+
+static char path[64];
+static char index_path[72];
+
+// Beklenen içerik: versions[i] 0 ise com.test<i> silinmiş olmalı
+#define PACKAGES 1200
+static uint32_t versions[PACKAGES];
+
+static void put(package_db_t* db, uint32_t i, uint32_t version) {
+    record_t record;
+    memset(&record, 0, sizeof(record));
+    snprintf(record.name, sizeof(record.name), "com.test%u", i);
+    record.version = version;
+    CHECK(package_db_put(db, record.name, &record, version) == 0);
+    versions[i] = version;
+}
+
+static void delete(package_db_t* db, uint32_t i) {
+    char name[64];
+    snprintf(name, sizeof(name), "com.test%u", i);
+    CHECK(package_db_delete(db, name) == 0);
+    versions[i] = 0;
+}
+
+static int visit(const char* name, const void* data, uint64_t stamp, void* arg) {
+    const record_t* record = (const record_t*)data;
+    uint32_t* visited = (uint32_t*)arg;
+    unsigned i;
+
+    (*visited)++;
+    CHECK_MSG(sscanf(name, "com.test%u", &i) == 1 && i < PACKAGES, "%s", name);
+    if (i < PACKAGES) {
+        CHECK_MSG(strcmp(record->name, name) == 0 && record->version == versions[i] && stamp == versions[i], "%s", name);
+    }
+    return 0;
+}
+
+// Veritabanını aç ve beklenen içerikle karşılaştır
+static void verify(const char* stage) {
+    package_db_t* db;
+    uint32_t expected = 0;
+    uint32_t visited = 0;
+
+    for (uint32_t i = 0; i < PACKAGES; i++) {
+        expected += versions[i] != 0;
+    }
+
+    int status = package_db_open(path, sizeof(record_t), &db);
+    CHECK_MSG(status == 0, "%s: açılış %d", stage, status);
+    if (status != 0) {
+        return;
+    }
+
+    CHECK_MSG(package_db_count(db) == expected, "%s: %u != %u", stage, package_db_count(db), expected);
+    package_db_foreach(db, visit, &visited);
+    CHECK_MSG(visited == expected, "%s", stage);
+
+    for (uint32_t i = 0; i < PACKAGES; i += 97) {
+        char name[64];
+        uint64_t stamp = 0;
+        snprintf(name, sizeof(name), "com.test%u", i);
+        const record_t* record = (const record_t*)package_db_get(db, name, &stamp);
+        CHECK_MSG(versions[i] ? record && record->version == versions[i] && stamp == versions[i] : !record, "%s: %s", stage, name);
+    }
+
+    package_db_close(db);
+}
+
+static off_t file_size(const char* file) {
+    struct stat st;
+    return stat(file, &st) == 0 ? st.st_size : -1;
+}
+
+static void copy_file(const char* from, const char* to) {
+    char command[256];
+    snprintf(command, sizeof(command), "cp %s %s", from, to);
+    CHECK(system(command) == 0);
+}
+
+int main(void) {
+    package_db_t* db;
+
+    snprintf(path, sizeof(path), "/tmp/package_db_test.%d", (int)getpid());
+    snprintf(index_path, sizeof(index_path), "%s.idx", path);
+
+    // Kayıt boyutu başka olan veritabanı açılmaz
+    CHECK(package_db_open(path, sizeof(record_t), &db) == 0);
+    for (uint32_t i = 0; i < 1000; i++) {
+        put(db, i, i + 1);
+    }
+    package_db_close(db);
+    CHECK(package_db_open(path, sizeof(record_t) + 8, &db) == PACKAGE_DB_ERROR_FORMAT);
+    verify("kapatma");
+
+    // Sıkıştırma: silinenler canlılardan fazla, günlük küçülür
+    off_t before = file_size(path);
+    CHECK(package_db_open(path, sizeof(record_t), &db) == 0);
+    for (uint32_t i = 0; i < 700; i++) {
+        delete(db, i);
+    }
+    CHECK(package_db_sync(db) == 0);
+    package_db_close(db);
+    CHECK_MSG(file_size(path) < before, "%lld >= %lld", (long long)file_size(path), (long long)before);
+    verify("sıkıştırma");
+
+    // Eskimiş indeks: aynı kuşak, günlük indeksin ötesinde sürer
+    char stale_index[96];
+    snprintf(stale_index, sizeof(stale_index), "%s.old", index_path);
+    copy_file(index_path, stale_index);
+
+    // Çökme: sync'ten sonra yazılanlar indekste yok, kapatma yapılmaz
+    pid_t child = fork();
+    if (child == 0) {
+        if (package_db_open(path, sizeof(record_t), &db) != 0) {
+            _exit(1);
+        }
+        for (uint32_t i = 1000; i < 1100; i++) {
+            put(db, i, i + 1);
+        }
+        for (uint32_t i = 700; i < 750; i++) {
+            put(db, i, 5000 + i);
+        }
+        package_db_sync(db);
+        for (uint32_t i = 1100; i < 1200; i++) {
+            put(db, i, i + 1);
+        }
+        for (uint32_t i = 750; i < 760; i++) {
+            delete(db, i);
+        }
+        _exit(0);
+    }
+    int child_status;
+    waitpid(child, &child_status, 0);
+    CHECK(WIFEXITED(child_status) && WEXITSTATUS(child_status) == 0);
+    for (uint32_t i = 1000; i < 1200; i++) {
+        versions[i] = i + 1;
+    }
+    for (uint32_t i = 700; i < 750; i++) {
+        versions[i] = 5000 + i;
+    }
+    for (uint32_t i = 750; i < 760; i++) {
+        versions[i] = 0;
+    }
+    verify("kuyruk oynatma");
+
+    copy_file(stale_index, index_path);
+    verify("eskimiş indeks");
+
+    // Bozuk indeks: günlüğün tamamı oynatılır
+    FILE* file = fopen(index_path, "r+b");
+    CHECK(file != NULL);
+    if (file) {
+        fseek(file, 64, SEEK_SET);
+        fputs("bozuk", file);
+        fclose(file);
+    }
+    verify("bozuk indeks");
+
+    // Yarım son kayıt (silme, com.test759) kesilir; öncekiler korunur
+    unlink(index_path);
+    CHECK(truncate(path, file_size(path) - 5) == 0);
+    versions[759] = 760;
+    verify("yarım kayıt");
+
+    // Kesilen kuyruğun ardına yazılan kayıt sonraki açılışta okunur
+    CHECK(package_db_open(path, sizeof(record_t), &db) == 0);
+    put(db, 5, 42);
+    package_db_close(db);
+    verify("kesme sonrası yazma");
+
+    unlink(path);
+    unlink(index_path);
+    unlink(stale_index);
+
+    return test_report("package_db");
+}
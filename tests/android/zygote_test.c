@@ -0,0 +1,97 @@
+// zygote: yalnızca zygote'un türettiği süreçler öldürülebilir, toplanmış
+// süreçlerin pid'leri reddedilir ve yanıt vermeyen zygote çağıranı
+// süresiz bekletmez.
+#include "android/zygote.h"
+#include "test.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <signal.h>
+#include <time.h>
+#include <sys/wait.h>
+
+static int app_main(const zygote_request_t* request, void* user_data) {
+    (void)request;
+    (void)user_data;
+    for (;;) {
+        pause();
+    }
+    return 0;
+}
+
+static int process_alive(pid_t pid) {
+    return kill(pid, 0) == 0;
+}
+
+// Zygote süreci topladıktan sonra pid artık bilinmez
+static int wait_unknown(pid_t pid) {
+    for (int i = 0; i < 200; i++) {
+        if (zygote_kill_app(pid) == ZYGOTE_ERROR_NOT_FOUND) {
+            return 1;
+        }
+        usleep(10000);
+    }
+    return 0;
+}
+
+int main(void) {
+    zygote_stats_t stats;
+
+    CHECK(zygote_kill_app(1) == ZYGOTE_ERROR_NOT_RUNNING);
+    CHECK(zygote_fork_app("com.kalem.test", NULL, 10000) == ZYGOTE_ERROR_NOT_RUNNING);
+    CHECK(zygote_start(NULL, app_main, NULL) == 0);
+    CHECK(zygote_get_stats(&stats) == 0 && stats.pid > 0);
+
+    pid_t first = zygote_fork_app("com.kalem.first", NULL, 10001);
+    pid_t second = zygote_fork_app("com.kalem.second", NULL, 10002);
+    CHECK(first > 0 && second > 0 && first != second);
+
+    // Zygote'un türetmediği süreçler: bu test, kendi çocuğumuz, zygote'un kendisi
+    pid_t bystander = fork();
+    if (bystander == 0) {
+        for (;;) {
+            pause();
+        }
+    }
+    CHECK(bystander > 0);
+    CHECK(zygote_kill_app(getpid()) == ZYGOTE_ERROR_NOT_FOUND);
+    CHECK(zygote_kill_app(bystander) == ZYGOTE_ERROR_NOT_FOUND);
+    CHECK(zygote_kill_app(stats.pid) == ZYGOTE_ERROR_NOT_FOUND);
+    CHECK(zygote_kill_app(0) == ZYGOTE_ERROR_INVALID);
+    CHECK(process_alive(bystander));
+
+    // Kendi süreci öldürülür ve toplandıktan sonra pid'i tanınmaz
+    CHECK(zygote_kill_app(first) == 0);
+    CHECK(wait_unknown(first));
+    CHECK(process_alive(second));
+
+    // Askıdaki zygote: istek süre sınırında döner, zygote ve uygulamaları sonlanır
+    CHECK(kill(stats.pid, SIGSTOP) == 0);
+    struct timespec started, ended;
+    clock_gettime(CLOCK_MONOTONIC, &started);
+    CHECK(zygote_fork_app("com.kalem.third", NULL, 10003) == ZYGOTE_ERROR_TIMEOUT);
+    clock_gettime(CLOCK_MONOTONIC, &ended);
+    long elapsed_ms = (ended.tv_sec - started.tv_sec) * 1000 + (ended.tv_nsec - started.tv_nsec) / 1000000;
+    CHECK_MSG(elapsed_ms >= ZYGOTE_REPLY_TIMEOUT_MS - 10 && elapsed_ms < ZYGOTE_REPLY_TIMEOUT_MS + 1000, "%ld ms", elapsed_ms);
+    CHECK(!zygote_is_running());
+    CHECK(zygote_kill_app(second) == ZYGOTE_ERROR_NOT_RUNNING);
+
+    int gone = 0;
+    for (int i = 0; i < 200 && !gone; i++) {
+        gone = !process_alive(second);
+        usleep(10000);
+    }
+    CHECK(gone);
+
+    // Yeniden başlatılabilir
+    CHECK(zygote_start(NULL, app_main, NULL) == 0);
+    pid_t fourth = zygote_fork_app("com.kalem.fourth", NULL, 10004);
+    CHECK(fourth > 0 && zygote_kill_app(fourth) == 0);
+    CHECK(zygote_stop() == 0);
+
+    kill(bystander, SIGKILL);
+    waitpid(bystander, NULL, 0);
+
+    return test_report("zygote");
+}
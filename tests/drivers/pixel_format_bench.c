@@ -0,0 +1,102 @@
+// pixel_format çekirdeklerinin hızı (Mpiksel/s), desteklenen her komut seti için.
+// Satır: önbellekte kalan tek satır; kare: her turda tüm kare (bellek bant genişliği).
+//
+//   pixel_format_bench [genişlik] [yükseklik] [süre ms]
+#include "pixel_format.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+enum { KERNEL_RGB565, KERNEL_BGRX, KERNEL_INDEXED, KERNEL_INDEXED_DITHER,
+       KERNEL_PREMULTIPLY, KERNEL_UNPREMULTIPLY, KERNEL_COUNT };
+
+static const char* kernel_names[KERNEL_COUNT] = {
+    "rgb565", "bgrx", "indexed", "indexed+dither", "premultiply", "unpremultiply"
+};
+
+static void run_row(int kernel, void* dst, const uint32_t* src, uint32_t count, uint32_t y) {
+    switch (kernel) {
+        case KERNEL_RGB565:         pixel_argb_to_rgb565((uint16_t*)dst, src, count); break;
+        case KERNEL_BGRX:           pixel_argb_to_bgrx((uint32_t*)dst, src, count); break;
+        case KERNEL_INDEXED:        pixel_argb_to_indexed((uint8_t*)dst, src, count, 0, y, 0); break;
+        case KERNEL_INDEXED_DITHER: pixel_argb_to_indexed((uint8_t*)dst, src, count, 0, y, 1); break;
+        case KERNEL_PREMULTIPLY:    pixel_premultiply((uint32_t*)dst, src, count); break;
+        default:                    pixel_unpremultiply((uint32_t*)dst, src, count); break;
+    }
+}
+
+// Süre dolana dek satırları dönüştür; Mpiksel/s döner
+static double measure(int kernel, uint32_t* dst, const uint32_t* src, uint32_t width, uint32_t rows,
+                      uint32_t stride, double seconds) {
+    uint64_t pixels = 0;
+    double start = now_s(), elapsed;
+    do {
+        for (uint32_t y = 0; y < rows; y++) {
+            run_row(kernel, dst + (size_t)y * stride, src + (size_t)y * stride, width, y);
+        }
+        pixels += (uint64_t)width * rows;
+        elapsed = now_s() - start;
+    } while (elapsed < seconds);
+    return pixels / elapsed / 1e6;
+}
+
+int main(int argc, char** argv) {
+    uint32_t width = argc > 1 ? (uint32_t)atoi(argv[1]) : 1024;
+    uint32_t height = argc > 2 ? (uint32_t)atoi(argv[2]) : 768;
+    double seconds = (argc > 3 ? atoi(argv[3]) : 200) / 1000.0;
+    if (width == 0 || height == 0 || seconds <= 0) {
+        fprintf(stderr, "kullanım: %s [genişlik] [yükseklik] [süre ms]\n", argv[0]);
+        return 2;
+    }
+
+    size_t count = (size_t)width * height;
+    uint32_t* src = (uint32_t*)malloc(count * sizeof(uint32_t));
+    uint32_t* dst = (uint32_t*)malloc(count * sizeof(uint32_t));
+    uint32_t seed = 1;
+    for (size_t i = 0; i < count; i++) {
+        seed = seed * 1103515245 + 12345;
+        src[i] = seed;
+    }
+
+    vga_color_t palette[256];
+    for (uint32_t i = 0; i < 256; i++) {
+        palette[i].r = (uint8_t)(((i >> 5) & 7) * 63 / 7);
+        palette[i].g = (uint8_t)(((i >> 2) & 7) * 63 / 7);
+        palette[i].b = (uint8_t)((i & 3) * 63 / 3);
+    }
+    pixel_format_init();
+    pixel_format_build_palette_lut(palette, 256);
+    pixel_isa_t best = pixel_format_get_isa();
+
+    printf("%ux%u, Mpiksel/s (satır: tek satır önbellekte, kare: tüm kare)\n", width, height);
+    printf("%-16s", "");
+    for (pixel_isa_t isa = PIXEL_ISA_SCALAR; isa <= best; isa++) {
+        char label[32];
+        snprintf(label, sizeof(label), "%s satır", pixel_format_isa_name(isa));
+        printf(" %12s", label);
+        snprintf(label, sizeof(label), "%s kare", pixel_format_isa_name(isa));
+        printf(" %12s", label);
+    }
+    printf("\n");
+
+    for (int kernel = 0; kernel < KERNEL_COUNT; kernel++) {
+        printf("%-16s", kernel_names[kernel]);
+        for (pixel_isa_t isa = PIXEL_ISA_SCALAR; isa <= best; isa++) {
+            pixel_format_set_isa(isa);
+            printf(" %12.1f", measure(kernel, dst, src, width, 1, width, seconds));
+            printf(" %12.1f", measure(kernel, dst, src, width, height, width, seconds));
+        }
+        printf("\n");
+    }
+
+    free(src);
+    free(dst);
+    return 0;
+}
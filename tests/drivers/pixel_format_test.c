@@ -0,0 +1,150 @@
+// pixel_format: SIMD çekirdekleri skaler çekirdekle bayt bayt aynı sonucu
+// vermeli. Uzunluklar ve hizalamalar vektör döngüsünün kuyruğunu da kapsar;
+// alfa çarpımı tüm (renk, alfa) çiftleri için ayrıca tam olarak denetlenir.
+#include "pixel_format.h"
+#include "test.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_COUNT 67
+#define BUFFER    (MAX_COUNT + 4)
+
+static uint32_t seed = 2463534242u;
+
+static uint32_t next_random(void) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+// Rastgele pikseller; alfa sıklıkla 0 ya da 255, renkler sıklıkla uç değerde
+static void fill_pixels(uint32_t* pixels, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t p = next_random();
+        switch (next_random() & 7) {
+            case 0: p &= 0x00FFFFFF; break;
+            case 1: p |= 0xFF000000; break;
+            case 2: p |= 0x00FFFFFF; break;
+            case 3: p &= 0xFF000000; break;
+            default: break;
+        }
+        pixels[i] = p;
+    }
+}
+
+// Tüm çekirdekleri seçili komut setiyle çalıştır
+typedef struct {
+    uint16_t rgb565[BUFFER];
+    uint32_t bgrx[BUFFER];
+    uint8_t indexed[2][BUFFER];
+    uint32_t premultiplied[BUFFER];
+    uint32_t unpremultiplied[BUFFER];
+} outputs_t;
+
+static void run_kernels(outputs_t* out, const uint32_t* src, uint32_t count, uint32_t x, uint32_t y) {
+    memset(out, 0xCD, sizeof(*out));
+    pixel_argb_to_rgb565(out->rgb565, src, count);
+    pixel_argb_to_bgrx(out->bgrx, src, count);
+    pixel_argb_to_indexed(out->indexed[0], src, count, x, y, 0);
+    pixel_argb_to_indexed(out->indexed[1], src, count, x, y, 1);
+    pixel_premultiply(out->premultiplied, src, count);
+    pixel_unpremultiply(out->unpremultiplied, src, count);
+}
+
+static void compare_isa(pixel_isa_t isa) {
+    uint32_t storage[BUFFER + 1];
+
+    for (uint32_t round = 0; round < 200; round++) {
+        for (uint32_t count = 0; count <= MAX_COUNT; count++) {
+            // Hizasız kaynak: vektör yüklemeleri loadu olmalı
+            uint32_t* src = storage + (round & 1);
+            uint32_t x = next_random() & 1023, y = next_random() & 1023;
+            outputs_t scalar, simd;
+            fill_pixels(src, count);
+
+            pixel_format_set_isa(PIXEL_ISA_SCALAR);
+            run_kernels(&scalar, src, count, x, y);
+            pixel_format_set_isa(isa);
+            run_kernels(&simd, src, count, x, y);
+
+            const char* name = pixel_format_isa_name(isa);
+            CHECK_MSG(memcmp(scalar.rgb565, simd.rgb565, sizeof(simd.rgb565)) == 0, "%s rgb565 %u", name, count);
+            CHECK_MSG(memcmp(scalar.bgrx, simd.bgrx, sizeof(simd.bgrx)) == 0, "%s bgrx %u", name, count);
+            CHECK_MSG(memcmp(scalar.indexed, simd.indexed, sizeof(simd.indexed)) == 0, "%s indexed %u x=%u", name, count, x);
+            CHECK_MSG(memcmp(scalar.premultiplied, simd.premultiplied, sizeof(simd.premultiplied)) == 0,
+                      "%s premultiply %u", name, count);
+            CHECK_MSG(memcmp(scalar.unpremultiplied, simd.unpremultiplied, sizeof(simd.unpremultiplied)) == 0,
+                      "%s unpremultiply %u", name, count);
+        }
+    }
+}
+
+// Her (renk, alfa) çifti: c * a / 255 en yakına yuvarlanır, geri alma
+// c * 255 / a en yakına yuvarlanıp 255'te doyar; tüm komut setleri aynı sonucu verir
+static void check_alpha_rounding(pixel_isa_t isa) {
+    static uint32_t src[256 * 256], dst[256 * 256];
+    for (uint32_t a = 0; a < 256; a++) {
+        for (uint32_t c = 0; c < 256; c++) {
+            src[a * 256 + c] = (a << 24) | (c << 16) | ((255 - c) << 8) | (c ^ 0x5A);
+        }
+    }
+
+    pixel_format_set_isa(isa);
+    pixel_premultiply(dst, src, 256 * 256);
+    uint32_t wrong = 0;
+    for (uint32_t i = 0; i < 256 * 256; i++) {
+        uint32_t a = src[i] >> 24;
+        for (uint32_t shift = 0; shift < 24; shift += 8) {
+            uint32_t c = (src[i] >> shift) & 0xFF;
+            uint32_t expected = (c * a * 2 + 255) / 510;
+            wrong += ((dst[i] >> shift) & 0xFF) != expected;
+        }
+        wrong += (dst[i] >> 24) != a;
+    }
+    CHECK_MSG(wrong == 0, "%s premultiply: %u kanal", pixel_format_isa_name(isa), wrong);
+
+    pixel_unpremultiply(dst, src, 256 * 256);
+    wrong = 0;
+    for (uint32_t i = 0; i < 256 * 256; i++) {
+        uint32_t a = src[i] >> 24;
+        for (uint32_t shift = 0; shift < 24; shift += 8) {
+            uint32_t c = (src[i] >> shift) & 0xFF;
+            uint32_t expected = a ? (c * 510 + a) / (2 * a) : 0;
+            if (expected > 255) expected = 255;
+            wrong += ((dst[i] >> shift) & 0xFF) != expected;
+        }
+    }
+    CHECK_MSG(wrong == 0, "%s unpremultiply: %u kanal", pixel_format_isa_name(isa), wrong);
+}
+
+int main(void) {
+    // 3-3-2 küp palet (6 bit DAC)
+    vga_color_t palette[256];
+    for (uint32_t i = 0; i < 256; i++) {
+        palette[i].r = (uint8_t)(((i >> 5) & 7) * 63 / 7);
+        palette[i].g = (uint8_t)(((i >> 2) & 7) * 63 / 7);
+        palette[i].b = (uint8_t)((i & 3) * 63 / 3);
+    }
+    pixel_format_init();
+    pixel_format_build_palette_lut(palette, 256);
+    pixel_isa_t best = pixel_format_get_isa();
+
+    // Desteklenmeyen komut seti seçilemez
+    CHECK(pixel_format_set_isa(PIXEL_ISA_SCALAR) == 0 && pixel_format_get_isa() == PIXEL_ISA_SCALAR);
+    if (best < PIXEL_ISA_SSSE3) {
+        CHECK(pixel_format_set_isa(PIXEL_ISA_SSSE3) == -1 && pixel_format_get_isa() == PIXEL_ISA_SCALAR);
+    }
+
+    for (pixel_isa_t isa = PIXEL_ISA_SCALAR; isa <= best; isa++) {
+        if (isa != PIXEL_ISA_SCALAR) {
+            compare_isa(isa);
+        }
+        check_alpha_rounding(isa);
+    }
+    if (best == PIXEL_ISA_SCALAR) {
+        printf("pixel_format: SIMD desteklenmiyor, yalnızca skaler denetlendi\n");
+    }
+
+    return test_report("pixel_format");
+}
@@ -0,0 +1,109 @@
+// Yerel çıkarım motorunun ölçümleri: yükleme, ilk token, token/s ve RSS.
+// Tek başına da çalışır; ai_compare.py aynı modelin Python yoluyla
+// karşılaştırmasında bu çıktıyı okur (anahtar=değer satırları).
+//
+//   ai_compare <model.gguf> [istem] [token] [iş parçacığı] [tekrar]
+#include "ai_inference.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+// /proc/self/status alanını MB olarak oku
+static double status_mb(const char* field) {
+    FILE* file = fopen("/proc/self/status", "r");
+    char line[256];
+    double kb = 0.0;
+    size_t length = strlen(field);
+
+    if (!file) {
+        return 0.0;
+    }
+    while (fgets(line, sizeof(line), file)) {
+        if (strncmp(line, field, length) == 0 && line[length] == ':') {
+            kb = atof(line + length + 1);
+            break;
+        }
+    }
+    fclose(file);
+    return kb / 1024.0;
+}
+
+static int compare_doubles(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return x < y ? -1 : x > y;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "kullanım: %s <model.gguf> [istem] [token] [iş parçacığı] [tekrar]\n", argv[0]);
+        return 2;
+    }
+    const char* prompt = argc > 2 ? argv[2] : "The capital of France is";
+    uint32_t max_tokens = argc > 3 ? (uint32_t)atoi(argv[3]) : 64;
+    uint32_t threads = argc > 4 ? (uint32_t)atoi(argv[4]) : 0;
+    int runs = argc > 5 ? atoi(argv[5]) : 3;
+    if (runs < 1 || runs > 16) {
+        runs = 3;
+    }
+
+    double base_rss = status_mb("VmRSS");
+    ai_inference_options_t options = { threads, 0, 1 };
+    ai_inference_model_t* model;
+    int status = ai_inference_load(argv[1], &options, &model);
+    if (status != 0) {
+        fprintf(stderr, "model yüklenemedi: %d\n", status);
+        return 1;
+    }
+
+    ai_inference_info_t info;
+    ai_inference_get_info(model, &info);
+    double load_rss = status_mb("VmRSS");
+
+    // Açgözlü üretim; ilk token ve hız tekrarların ortancası
+    double first_token[16], speed[16];
+    ai_inference_stats_t stats;
+    char* text = NULL;
+    for (int i = 0; i < runs; i++) {
+        free(text);
+        status = ai_inference_generate(model, prompt, 0.0f, max_tokens, &text, &stats);
+        if (status != 0) {
+            fprintf(stderr, "üretim başarısız: %d\n", status);
+            ai_inference_free(model);
+            return 1;
+        }
+        first_token[i] = stats.first_token_ms;
+        speed[i] = stats.tokens_per_sec;
+    }
+    qsort(first_token, (size_t)runs, sizeof(double), compare_doubles);
+    qsort(speed, (size_t)runs, sizeof(double), compare_doubles);
+
+    printf("backend=native\n");
+    printf("isa=%s\n", ai_inference_isa_name(info.isa));
+    printf("threads=%u\n", info.threads);
+    printf("load_ms=%.1f\n", info.load_ms);
+    printf("first_token_ms=%.1f\n", first_token[runs / 2]);
+    printf("tokens_per_sec=%.2f\n", speed[runs / 2]);
+    printf("prompt_tokens=%u\n", stats.prompt_tokens);
+    printf("generated_tokens=%u\n", stats.generated_tokens);
+    printf("base_rss_mb=%.1f\n", base_rss);
+    printf("load_rss_mb=%.1f\n", load_rss);
+    printf("rss_mb=%.1f\n", status_mb("VmRSS"));
+    printf("peak_rss_mb=%.1f\n", status_mb("VmHWM"));
+
+    // Metin tek satırda; satır sonları kaçışlı
+    printf("text=");
+    for (const char* c = text; *c; c++) {
+        if (*c == '\n') {
+            fputs("\\n", stdout);
+        } else if (*c == '\\') {
+            fputs("\\\\", stdout);
+        } else {
+            putchar(*c);
+        }
+    }
+    putchar('\n');
+
+    free(text);
+    ai_inference_free(model);
+    return 0;
+}
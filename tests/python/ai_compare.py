@@ -0,0 +1,149 @@
+# python_ai metin üretiminin iki arka ucunu aynı model üzerinde karşılaştırır:
+#   - Python yolu: kalem_ai yardımcısındaki load_text_model / generate_text ile
+#     aynı transformers çağrıları (python_ai.c içindeki ai_helper_source)
+#   - Yerel motor: build/tests/ai_compare (ai_inference.c)
+#
+# Aynı modelin Hugging Face dizini ya da adı ve GGUF dönüşümü verilir, ör.:
+#   python3 llama.cpp/convert_hf_to_gguf.py TinyLlama-1.1B --outtype q8_0 --outfile tl-q8.gguf
+#   make -C tests tools
+#   python3 tests/python/ai_compare.py TinyLlama-1.1B tl-q8.gguf --threads 4
+#
+# Ölçülenler: yükleme süresi (Python yolunda torch/transformers içe aktarımı
+# dahil, gömülü yardımcıda olduğu gibi), ilk token süresi, ilk tokendan sonraki
+# token/s ve süreç RSS'i. Her iki taraf da açgözlü üretir; metinlerin ortak
+# öneki ayrıca yazdırılır.
+
+import argparse
+import os
+import statistics
+import subprocess
+import sys
+import time
+
+
+def status_mb(field):
+    with open('/proc/self/status') as status:
+        for line in status:
+            if line.startswith(field + ':'):
+                return int(line.split()[1]) / 1024.0
+    return 0.0
+
+
+def measure_python(model_name, prompt, max_tokens, threads, runs):
+    base_rss = status_mb('VmRSS')
+    started = time.perf_counter()
+
+    # load_text_model(model_id, model_name, use_gpu=0, quantized=0)
+    from transformers import AutoModelForCausalLM, AutoTokenizer, StoppingCriteria, StoppingCriteriaList
+    import torch
+    if threads:
+        torch.set_num_threads(threads)
+    tokenizer = AutoTokenizer.from_pretrained(model_name)
+    model = AutoModelForCausalLM.from_pretrained(model_name, device_map='cpu')
+    load_ms = (time.perf_counter() - started) * 1000.0
+    load_rss = status_mb('VmRSS')
+
+    # Her üretim adımının bitişi
+    class Steps(StoppingCriteria):
+        def __init__(self):
+            self.times = []
+
+        def __call__(self, input_ids, scores, **kwargs):
+            self.times.append(time.perf_counter())
+            return False
+
+    first_token = []
+    speed = []
+    for _ in range(runs):
+        # generate_text(model_id, prompt, temperature=0, max_tokens)
+        steps = Steps()
+        started = time.perf_counter()
+        inputs = tokenizer(prompt, return_tensors='pt')
+        with torch.no_grad():
+            output = model.generate(
+                **inputs,
+                max_length=len(inputs['input_ids'][0]) + max_tokens,
+                do_sample=False,
+                pad_token_id=tokenizer.eos_token_id,
+                stopping_criteria=StoppingCriteriaList([steps])
+            )
+        text = tokenizer.decode(output[0], skip_special_tokens=True)[len(prompt):].strip()
+
+        first_token.append((steps.times[0] - started) * 1000.0)
+        if len(steps.times) > 1:
+            speed.append((len(steps.times) - 1) / (steps.times[-1] - steps.times[0]))
+
+    return {
+        'backend': 'python',
+        'threads': str(torch.get_num_threads()),
+        'load_ms': f'{load_ms:.1f}',
+        'first_token_ms': f'{statistics.median(first_token):.1f}',
+        'tokens_per_sec': f'{statistics.median(speed):.2f}' if speed else '0',
+        'prompt_tokens': str(len(inputs['input_ids'][0])),
+        'generated_tokens': str(len(output[0]) - len(inputs['input_ids'][0])),
+        'base_rss_mb': f'{base_rss:.1f}',
+        'load_rss_mb': f'{load_rss:.1f}',
+        'rss_mb': f'{status_mb("VmRSS"):.1f}',
+        'peak_rss_mb': f'{status_mb("VmHWM"):.1f}',
+        'text': text.replace('\\', '\\\\').replace('\n', '\\n'),
+    }
+
+
+def measure_native(binary, gguf, prompt, max_tokens, threads, runs):
+    result = subprocess.run([binary, gguf, prompt, str(max_tokens), str(threads), str(runs)],
+                            capture_output=True, encoding='utf-8', errors='replace')
+    if result.returncode != 0:
+        sys.exit(f'{binary}: {result.stderr.strip()}')
+    values = {}
+    for line in result.stdout.splitlines():
+        key, _, value = line.partition('=')
+        values[key] = value
+    return values
+
+
+def main():
+    root = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..'))
+    parser = argparse.ArgumentParser(description='Python yolu ile yerel motoru karşılaştır')
+    parser.add_argument('model', help='Hugging Face model adı ya da dizini (Python yolu)')
+    parser.add_argument('gguf', help='Aynı modelin GGUF dönüşümü (yerel motor)')
+    parser.add_argument('--prompt', default='The capital of France is')
+    parser.add_argument('--tokens', type=int, default=64)
+    parser.add_argument('--threads', type=int, default=0, help='0: tüm çekirdekler')
+    parser.add_argument('--runs', type=int, default=3)
+    parser.add_argument('--native', default=os.path.join(root, 'build', 'tests', 'ai_compare'))
+    args = parser.parse_args()
+
+    # Yerel taraf önce ve ayrı süreçte; RSS'ler birbirini içermez
+    native = measure_native(args.native, args.gguf, args.prompt, args.tokens, args.threads, args.runs)
+    python = measure_python(args.model, args.prompt, args.tokens, args.threads, args.runs)
+
+    rows = [
+        ('iş parçacığı', 'threads'),
+        ('yükleme (ms)', 'load_ms'),
+        ('ilk token (ms)', 'first_token_ms'),
+        ('token/s', 'tokens_per_sec'),
+        ('istem / üretilen token', None),
+        ('yükleme sonrası RSS (MB)', 'load_rss_mb'),
+        ('son RSS (MB)', 'rss_mb'),
+        ('tepe RSS (MB)', 'peak_rss_mb'),
+    ]
+    print(f'{"":26} {"Python":>12} {"yerel":>12}')
+    for label, key in rows:
+        if key is None:
+            cells = [f'{side["prompt_tokens"]}/{side["generated_tokens"]}' for side in (python, native)]
+        else:
+            cells = [python[key], native[key]]
+        print(f'{label:26} {cells[0]:>12} {cells[1]:>12}')
+
+    common = 0
+    for a, b in zip(python['text'].split(), native['text'].split()):
+        if a != b:
+            break
+        common += 1
+    print(f'\nPython: {python["text"]}')
+    print(f'yerel:  {native["text"]}')
+    print(f'ortak önek: {common} sözcük')
+
+
+if __name__ == '__main__':
+    main()
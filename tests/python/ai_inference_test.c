@@ -0,0 +1,444 @@
+// ai_inference: GGUF ayrıştırma ve doğrulama, tensör tipleri, iş parçacığı
+// sayısından bağımsız ve tohumla tekrarlanabilir üretim. Küçük llama modeli
+// burada yazılır; ağırlıklar rastgele, sözlük bayt tokenları ve birkaç parçadır.
+#include "ai_inference.h"
+#include "test.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#define EMBEDDING       32
+#define HEADS           2
+#define LAYERS          1
+#define FEED_FORWARD    64
+#define CONTEXT         128
+#define ALIGNMENT       32
+
+#define TYPE_UINT8      0
+#define TYPE_UINT32     4
+#define TYPE_FLOAT32    6
+#define TYPE_STRING     8
+#define TYPE_ARRAY      9
+
+#define GGML_F32        0
+#define GGML_F16        1
+#define GGML_Q4_0       2
+#define GGML_Q8_0       8
+
+typedef struct {
+    uint8_t* data;
+    size_t size;
+    size_t capacity;
+} buffer_t;
+
+// Bozma testlerinin değiştirdiği alanların konumları
+typedef struct {
+    size_t first_key;               // İlk anahtarın uzunluk alanı
+    size_t first_dims;              // İlk tensörün (token_embd) n_dims alanı
+    size_t first_type;
+    size_t first_offset;
+    size_t data;                    // Veri bölümünün başı
+} layout_t;
+
+static char path[64];
+static uint32_t vocab_size;
+static uint32_t seed;
+
+static void put(buffer_t* buffer, const void* data, size_t size) {
+    if (buffer->size + size > buffer->capacity) {
+        buffer->capacity = (buffer->size + size) * 2;
+        buffer->data = (uint8_t*)realloc(buffer->data, buffer->capacity);
+    }
+    memcpy(buffer->data + buffer->size, data, size);
+    buffer->size += size;
+}
+
+static void put_u32(buffer_t* buffer, uint32_t value) {
+    put(buffer, &value, sizeof(value));
+}
+
+static void put_u64(buffer_t* buffer, uint64_t value) {
+    put(buffer, &value, sizeof(value));
+}
+
+static void put_string(buffer_t* buffer, const char* text) {
+    put_u64(buffer, strlen(text));
+    put(buffer, text, strlen(text));
+}
+
+static void put_align(buffer_t* buffer) {
+    static const uint8_t zeros[ALIGNMENT];
+    put(buffer, zeros, (ALIGNMENT - buffer->size % ALIGNMENT) % ALIGNMENT);
+}
+
+static void put_kv_string(buffer_t* buffer, const char* key, const char* value) {
+    put_string(buffer, key);
+    put_u32(buffer, TYPE_STRING);
+    put_string(buffer, value);
+}
+
+static void put_kv_u32(buffer_t* buffer, const char* key, uint32_t value) {
+    put_string(buffer, key);
+    put_u32(buffer, TYPE_UINT32);
+    put_u32(buffer, value);
+}
+
+static float next_weight(void) {
+    seed = seed * 1103515245 + 12345;
+    return ((float)((seed >> 8) & 0xFFFF) / 65535.0f - 0.5f) * 0.7f;
+}
+
+// Normal aralıktaki değerler için fp16; çok küçükler sıfıra yuvarlanır
+static uint16_t to_fp16(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint16_t sign = (uint16_t)((bits >> 16) & 0x8000);
+    int32_t exponent = (int32_t)((bits >> 23) & 0xFF) - 127 + 15;
+    if (exponent <= 0) {
+        return sign;
+    }
+    return (uint16_t)(sign | (exponent << 10) | ((bits >> 13) & 0x3FF));
+}
+
+static float from_fp16(uint16_t half) {
+    uint32_t exponent = (half >> 10) & 0x1F;
+    uint32_t bits = exponent ? ((uint32_t)(half & 0x8000) << 16) | ((exponent - 15 + 127) << 23) |
+                               ((uint32_t)(half & 0x3FF) << 13) : ((uint32_t)(half & 0x8000) << 16);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Bir satırı istenen tipte yaz (Q8_0 / Q4_0: ggml blok düzeni)
+static void put_row(buffer_t* buffer, uint32_t type, const float* row, uint32_t cols) {
+    if (type == GGML_F32) {
+        put(buffer, row, cols * sizeof(float));
+        return;
+    }
+    if (type == GGML_F16) {
+        for (uint32_t i = 0; i < cols; i++) {
+            uint16_t half = to_fp16(row[i]);
+            put(buffer, &half, sizeof(half));
+        }
+        return;
+    }
+
+    for (uint32_t b = 0; b < cols / 32; b++) {
+        const float* values = row + b * 32;
+        float amax = 0.0f, max = 0.0f;
+        for (uint32_t j = 0; j < 32; j++) {
+            if (values[j] > amax || -values[j] > amax) {
+                amax = values[j] > 0 ? values[j] : -values[j];
+                max = values[j];
+            }
+        }
+
+        if (type == GGML_Q8_0) {
+            uint16_t d = to_fp16(amax / 127.0f);
+            float id = from_fp16(d) > 0.0f ? 1.0f / from_fp16(d) : 0.0f;
+            int8_t qs[32];
+            for (uint32_t j = 0; j < 32; j++) {
+                float scaled = values[j] * id;
+                scaled = scaled > 127.0f ? 127.0f : scaled < -127.0f ? -127.0f : scaled;
+                qs[j] = (int8_t)(scaled >= 0.0f ? scaled + 0.5f : scaled - 0.5f);
+            }
+            put(buffer, &d, sizeof(d));
+            put(buffer, qs, sizeof(qs));
+        } else {
+            uint16_t d = to_fp16(max / -8.0f);
+            float id = from_fp16(d) != 0.0f ? 1.0f / from_fp16(d) : 0.0f;
+            uint8_t qs[16];
+            for (uint32_t j = 0; j < 16; j++) {
+                int low = (int)(values[j] * id + 8.5f);
+                int high = (int)(values[j + 16] * id + 8.5f);
+                low = low < 0 ? 0 : low > 15 ? 15 : low;
+                high = high < 0 ? 0 : high > 15 ? 15 : high;
+                qs[j] = (uint8_t)(low | (high << 4));
+            }
+            put(buffer, &d, sizeof(d));
+            put(buffer, qs, sizeof(qs));
+        }
+    }
+}
+
+// Modeli yaz. nesting: eklenen iç içe dizi üst verisinin derinliği (0: yok)
+static void write_model(uint32_t type, const char* architecture, uint32_t nesting, layout_t* layout) {
+    static const char* pieces[] = { "\xe2\x96\x81", "a", "b", "\xe2\x96\x81" "a", "ab" };
+    static const struct {
+        const char* name;
+        uint32_t cols;
+        uint32_t rows;                  // 0: sözlük boyutu
+    } tensors[] = {
+        { "token_embd.weight", EMBEDDING, 0 },
+        { "output_norm.weight", EMBEDDING, 1 },
+        { "blk.0.attn_norm.weight", EMBEDDING, 1 },
+        { "blk.0.ffn_norm.weight", EMBEDDING, 1 },
+        { "blk.0.attn_q.weight", EMBEDDING, EMBEDDING },
+        { "blk.0.attn_k.weight", EMBEDDING, EMBEDDING },
+        { "blk.0.attn_v.weight", EMBEDDING, EMBEDDING },
+        { "blk.0.attn_output.weight", EMBEDDING, EMBEDDING },
+        { "blk.0.ffn_gate.weight", EMBEDDING, FEED_FORWARD },
+        { "blk.0.ffn_up.weight", EMBEDDING, FEED_FORWARD },
+        { "blk.0.ffn_down.weight", FEED_FORWARD, EMBEDDING },
+    };
+    const uint32_t tensor_count = sizeof(tensors) / sizeof(tensors[0]);
+    buffer_t header = { NULL, 0, 0 };
+    buffer_t data = { NULL, 0, 0 };
+    char token[16];
+
+    vocab_size = 3 + 256 + sizeof(pieces) / sizeof(pieces[0]);
+    seed = 1;
+
+    put_u32(&header, 0x46554747);
+    put_u32(&header, 3);
+    put_u64(&header, tensor_count);
+    put_u64(&header, 9 + (nesting ? 1 : 0));
+
+    layout->first_key = header.size;
+    put_kv_string(&header, "general.architecture", architecture);
+    put_kv_string(&header, "tokenizer.ggml.model", "llama");
+    put_kv_u32(&header, "llama.context_length", CONTEXT);
+    put_kv_u32(&header, "llama.embedding_length", EMBEDDING);
+    put_kv_u32(&header, "llama.block_count", LAYERS);
+    put_kv_u32(&header, "llama.feed_forward_length", FEED_FORWARD);
+    put_kv_u32(&header, "llama.attention.head_count", HEADS);
+
+    put_string(&header, "tokenizer.ggml.tokens");
+    put_u32(&header, TYPE_ARRAY);
+    put_u32(&header, TYPE_STRING);
+    put_u64(&header, vocab_size);
+    put_string(&header, "<unk>");
+    put_string(&header, "<s>");
+    put_string(&header, "</s>");
+    for (uint32_t i = 0; i < 256; i++) {
+        snprintf(token, sizeof(token), "<0x%02X>", i);
+        put_string(&header, token);
+    }
+    for (uint32_t i = 0; i < sizeof(pieces) / sizeof(pieces[0]); i++) {
+        put_string(&header, pieces[i]);
+    }
+
+    put_string(&header, "tokenizer.ggml.scores");
+    put_u32(&header, TYPE_ARRAY);
+    put_u32(&header, TYPE_FLOAT32);
+    put_u64(&header, vocab_size);
+    for (uint32_t i = 0; i < vocab_size; i++) {
+        float score = -(float)i;
+        put(&header, &score, sizeof(score));
+    }
+
+    // Dizi dizisi: en içte boş bir bayt dizisi
+    if (nesting) {
+        put_string(&header, "test.nested");
+        put_u32(&header, TYPE_ARRAY);
+        for (uint32_t level = 1; level < nesting; level++) {
+            put_u32(&header, TYPE_ARRAY);
+            put_u64(&header, 1);
+        }
+        put_u32(&header, TYPE_UINT8);
+        put_u64(&header, 0);
+    }
+
+    for (uint32_t t = 0; t < tensor_count; t++) {
+        uint32_t rows = tensors[t].rows ? tensors[t].rows : vocab_size;
+        uint32_t tensor_type = rows == 1 ? GGML_F32 : type;
+        float row[FEED_FORWARD];
+
+        if (t > 0) {
+            put_align(&data);
+        }
+        if (t == 0) {
+            layout->first_dims = header.size + 8 + strlen(tensors[t].name);
+        }
+        put_string(&header, tensors[t].name);
+        put_u32(&header, 2);
+        put_u64(&header, tensors[t].cols);
+        put_u64(&header, rows);
+        if (t == 0) {
+            layout->first_type = header.size;
+            layout->first_offset = header.size + 4;
+        }
+        put_u32(&header, tensor_type);
+        put_u64(&header, data.size);
+
+        // Normlar 1; EOS gömmesi sıfır, böylece üretim erken bitmez
+        for (uint32_t r = 0; r < rows; r++) {
+            for (uint32_t c = 0; c < tensors[t].cols; c++) {
+                row[c] = rows == 1 ? 1.0f : (t == 0 && r == 2) ? 0.0f : next_weight();
+            }
+            put_row(&data, tensor_type, row, tensors[t].cols);
+        }
+    }
+    put_align(&header);
+    layout->data = header.size;
+
+    FILE* file = fopen(path, "wb");
+    CHECK(file && fwrite(header.data, 1, header.size, file) == header.size &&
+          fwrite(data.data, 1, data.size, file) == data.size);
+    if (file) {
+        fclose(file);
+    }
+    free(header.data);
+    free(data.data);
+}
+
+static void patch(size_t offset, const void* value, size_t size) {
+    FILE* file = fopen(path, "r+b");
+    CHECK(file != NULL);
+    if (file) {
+        fseek(file, (long)offset, SEEK_SET);
+        fwrite(value, 1, size, file);
+        fclose(file);
+    }
+}
+
+static int load(uint32_t threads, uint32_t context, uint64_t sample_seed, ai_inference_model_t** model) {
+    ai_inference_options_t options = { threads, context, sample_seed };
+    return ai_inference_load(path, &options, model);
+}
+
+// Yükle, üret ve metni döndür (hata: NULL)
+static char* generate(uint32_t threads, float temperature, const char* label) {
+    ai_inference_model_t* model;
+    ai_inference_stats_t stats;
+    char* text = NULL;
+
+    int status = load(threads, 0, 7, &model);
+    CHECK_MSG(status == 0, "%s: yükleme %d", label, status);
+    if (status != 0) {
+        return NULL;
+    }
+    status = ai_inference_generate(model, "a b ab", temperature, 8, &text, &stats);
+    CHECK_MSG(status == 0 && text, "%s: üretim %d", label, status);
+    CHECK_MSG(stats.prompt_tokens >= 4 && stats.generated_tokens == 8, "%s: %u / %u", label,
+              stats.prompt_tokens, stats.generated_tokens);
+    ai_inference_free(model);
+    return text;
+}
+
+// Her tensör tipi yüklenir; sonuç iş parçacığı sayısına bağlı değildir
+static void test_types(void) {
+    static const struct {
+        uint32_t type;
+        const char* name;
+    } types[] = {
+        { GGML_F32, "F32" }, { GGML_F16, "F16" }, { GGML_Q8_0, "Q8_0" }, { GGML_Q4_0, "Q4_0" },
+    };
+    layout_t layout;
+
+    for (size_t i = 0; i < sizeof(types) / sizeof(types[0]); i++) {
+        write_model(types[i].type, "llama", 0, &layout);
+
+        char* single = generate(1, 0.0f, types[i].name);
+        char* parallel = generate(3, 0.0f, types[i].name);
+        CHECK_MSG(single && parallel && strcmp(single, parallel) == 0, "%s: '%s' != '%s'", types[i].name,
+                  single ? single : "", parallel ? parallel : "");
+        free(single);
+        free(parallel);
+
+        // Aynı tohumla örnekleme tekrarlanır
+        single = generate(1, 0.8f, types[i].name);
+        parallel = generate(2, 0.8f, types[i].name);
+        CHECK_MSG(single && parallel && strcmp(single, parallel) == 0, "%s örnekleme", types[i].name);
+        free(single);
+        free(parallel);
+    }
+}
+
+static void test_info(void) {
+    ai_inference_model_t* model;
+    ai_inference_info_t info;
+    layout_t layout;
+    char* text = NULL;
+
+    write_model(GGML_Q8_0, "llama", 0, &layout);
+    CHECK(ai_inference_is_gguf(path));
+    CHECK(load(2, 0, 1, &model) == 0);
+    CHECK(ai_inference_get_info(model, &info) == 0);
+    CHECK(info.vocab_size == vocab_size && info.embedding == EMBEDDING && info.layers == LAYERS);
+    CHECK(info.heads == HEADS && info.kv_heads == HEADS && info.feed_forward == FEED_FORWARD);
+    CHECK(info.context == CONTEXT && info.threads == 2);
+    ai_inference_free(model);
+
+    // İstem bağlama sığmazsa üretilmez
+    CHECK(load(1, 4, 1, &model) == 0);
+    CHECK(ai_inference_generate(model, "a b a b a b", 0.0f, 4, &text, NULL) == AI_INFERENCE_ERROR_CONTEXT && !text);
+    ai_inference_free(model);
+
+    // İç içe diziler: üç düzey atlanır, dördüncü reddedilir
+    write_model(GGML_Q8_0, "llama", 3, &layout);
+    CHECK(load(1, 0, 1, &model) == 0);
+    ai_inference_free(model);
+    write_model(GGML_Q8_0, "llama", 4, &layout);
+    CHECK(load(1, 0, 1, &model) == AI_INFERENCE_ERROR_FORMAT && !model);
+
+    write_model(GGML_Q8_0, "gpt2", 0, &layout);
+    CHECK(load(1, 0, 1, &model) == AI_INFERENCE_ERROR_UNSUPPORTED);
+}
+
+// Bozuk başlık ve tensör kayıtları ayrıştırıcıdan geçmez
+static void test_corrupt(void) {
+    static const struct {
+        const char* name;
+        int field;                      // 0: sihirli sayı, 1: sürüm, 2: tensör sayısı, 3: anahtar uzunluğu,
+                                        // 4: n_dims, 5: dims[0], 6: tip, 7: ofset
+        uint64_t value;
+        int expected;
+    } cases[] = {
+        { "sihirli sayı", 0, 0x46554748, AI_INFERENCE_ERROR_FORMAT },
+        { "sürüm", 1, 4, AI_INFERENCE_ERROR_UNSUPPORTED },
+        { "tensör sayısı", 2, 1ULL << 60, AI_INFERENCE_ERROR_FORMAT },
+        { "anahtar uzunluğu", 3, 1ULL << 62, AI_INFERENCE_ERROR_FORMAT },
+        { "n_dims", 4, 5, AI_INFERENCE_ERROR_FORMAT },
+        { "boyut", 5, EMBEDDING * 2, AI_INFERENCE_ERROR_FORMAT },
+        { "tip", 6, 99, AI_INFERENCE_ERROR_UNSUPPORTED },
+        { "hizasız ofset", 7, 4, AI_INFERENCE_ERROR_FORMAT },
+        { "taşan ofset", 7, 1ULL << 40, AI_INFERENCE_ERROR_FORMAT },
+        { "sona uzanan ofset", 7, 1ULL << 62, AI_INFERENCE_ERROR_FORMAT },
+    };
+    ai_inference_model_t* model;
+    layout_t layout;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        write_model(GGML_Q8_0, "llama", 0, &layout);
+        const size_t offsets[] = { 0, 4, 8, layout.first_key, layout.first_dims, layout.first_dims + 4,
+                                   layout.first_type, layout.first_offset };
+        const size_t sizes[] = { 4, 4, 8, 8, 4, 8, 4, 8 };
+        patch(offsets[cases[i].field], &cases[i].value, sizes[cases[i].field]);
+
+        int status = load(1, 0, 1, &model);
+        CHECK_MSG(status == cases[i].expected && !model, "%s: %d", cases[i].name, status);
+    }
+
+    // Her kesik dosya reddedilir: başlık boyunca her bayt, verilerde seyrek
+    write_model(GGML_Q8_0, "llama", 0, &layout);
+    FILE* file = fopen(path, "rb");
+    fseek(file, 0, SEEK_END);
+    size_t size = (size_t)ftell(file);
+    fclose(file);
+
+    uint32_t accepted = 0;
+    for (size_t length = size - 1; length > 0; length -= length > layout.data + 64 ? 61 : 1) {
+        CHECK(truncate(path, (off_t)length) == 0);
+        if (load(1, 0, 1, &model) != AI_INFERENCE_ERROR_FORMAT) {
+            accepted++;
+            ai_inference_free(model);
+        }
+    }
+    CHECK_MSG(accepted == 0, "%u kesik dosya kabul edildi", accepted);
+
+    CHECK(truncate(path, 0) == 0);
+    CHECK(load(1, 0, 1, &model) == AI_INFERENCE_ERROR_IO && !ai_inference_is_gguf(path));
+}
+
+int main(void) {
+    snprintf(path, sizeof(path), "/tmp/ai_inference_test.%d.gguf", (int)getpid());
+
+    test_types();
+    test_info();
+    test_corrupt();
+
+    unlink(path);
+    return test_report("ai_inference");
+}
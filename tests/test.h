@@ -0,0 +1,35 @@
+#ifndef KALEM_TEST_H
+#define KALEM_TEST_H
+
+#include <stdio.h>
+
+// Sunucu (host) üzerinde çalışan modül testleri için en küçük yardımcılar.
+// Başarısız denetim yazdırılır, test sürer; sonuç test_report ile döner.
+
+static int test_checks = 0;
+static int test_failures = 0;
+
+#define CHECK_MSG(condition, ...) do { \
+        test_checks++; \
+        if (!(condition)) { \
+            test_failures++; \
+            fprintf(stderr, "%s:%d: başarısız: %s (", __FILE__, __LINE__, #condition); \
+            fprintf(stderr, __VA_ARGS__); \
+            fprintf(stderr, ")\n"); \
+        } \
+    } while (0)
+
+#define CHECK(condition) do { \
+        test_checks++; \
+        if (!(condition)) { \
+            test_failures++; \
+            fprintf(stderr, "%s:%d: başarısız: %s\n", __FILE__, __LINE__, #condition); \
+        } \
+    } while (0)
+
+static inline int test_report(const char* name) {
+    printf("%-16s %d denetim, %d başarısız\n", name, test_checks, test_failures);
+    return test_failures ? 1 : 0;
+}
+
+#endif /* KALEM_TEST_H */